@@ -0,0 +1,137 @@
+#include "../../src/Resources.h"
+#include "../../src/Block.h"
+#include "../../src/PNG.h"
+#include "../../src/LZ.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+struct Texture
+{
+  std::string name;
+  unsigned int width;
+  unsigned int height;
+  unsigned int components;
+  std::vector<unsigned char> pixels;
+};
+
+static bool decode(const char* name, const unsigned char* data, size_t length, Texture& texture)
+{
+  upng_t* upng = upng_new_from_bytes(data, (unsigned long)length);
+
+  if (upng_decode(upng) != UPNG_EOK)
+  {
+    printf("bake error: failed to decode %s.\n", name);
+
+    upng_free(upng);
+    return false;
+  }
+
+  texture.name = name;
+  texture.width = upng_get_width(upng);
+  texture.height = upng_get_height(upng);
+  texture.components = upng_get_components(upng);
+  texture.pixels.assign(upng_get_buffer(upng), upng_get_buffer(upng) + upng_get_size(upng));
+
+  upng_free(upng);
+
+  return true;
+}
+
+static Texture crop(const char* name, const Texture& source, unsigned int tile)
+{
+  const unsigned int size = 16;
+  const unsigned int left = tile % size * size;
+  const unsigned int top = tile / size * size;
+
+  Texture texture;
+  texture.name = name;
+  texture.width = size;
+  texture.height = size;
+  texture.components = source.components;
+
+  for (unsigned int y = top; y < top + size; y++)
+  {
+    const auto row = source.pixels.begin() + (y * source.width + left) * source.components;
+
+    texture.pixels.insert(texture.pixels.end(), row, row + size * source.components);
+  }
+
+  return texture;
+}
+
+static void writeArray(FILE* file, const char* name, const std::vector<unsigned char>& data)
+{
+  fprintf(file, "static const unsigned char %sData[%zu] = {", name, data.size());
+
+  for (size_t i = 0; i < data.size(); i++)
+  {
+    fprintf(file, i % 12 ? " 0x%02X," : "\n  0x%02X,", data[i]);
+  }
+
+  fprintf(file, "\n};\n\n");
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 3)
+  {
+    printf("usage: %s Baked.h Baked.cpp\n", argv[0]);
+    return 1;
+  }
+
+  std::vector<Texture> textures(5);
+
+  if (
+    !decode("cloudsBakedTexture", cloudsResourceTexture, sizeof(cloudsResourceTexture), textures[0]) ||
+    !decode("fontBakedTexture", fontResourceTexture, sizeof(fontResourceTexture), textures[1]) ||
+    !decode("interfaceBakedTexture", interfaceResourceTexture, sizeof(interfaceResourceTexture), textures[2]) ||
+    !decode("playerBakedTexture", playerResourceTexture, sizeof(playerResourceTexture), textures[3]) ||
+    !decode("terrainBakedTexture", terrainResourceTexture, sizeof(terrainResourceTexture), textures[4])
+  )
+  {
+    return 1;
+  }
+
+  const Texture terrain = textures[4];
+
+  textures.push_back(crop("bedrockBakedTexture", terrain, Block::Definitions[(unsigned char)Block::Type::BLOCK_BEDROCK].sideTexture));
+  textures.push_back(crop("waterBakedTexture", terrain, Block::Definitions[(unsigned char)Block::Type::BLOCK_WATER].sideTexture));
+
+  FILE* header = fopen(argv[1], "w");
+  FILE* source = fopen(argv[2], "w");
+
+  if (!header || !source)
+  {
+    printf("bake error: failed to open output files.\n");
+    return 1;
+  }
+
+  fprintf(header, "#pragma once\n#include <stddef.h>\n\n");
+  fprintf(header, "struct BakedTexture\n{\n  unsigned int width;\n  unsigned int height;\n  unsigned int components;\n  size_t size;\n  size_t length;\n  const unsigned char* data;\n};\n\n");
+
+  fprintf(source, "#include \"Baked.h\"\n\n");
+
+  for (const auto& texture : textures)
+  {
+    std::vector<unsigned char> compressed(texture.pixels.size() * 2 + 66);
+
+    const int length = fastlz_compress_level(2, texture.pixels.data(), (int)texture.pixels.size(), compressed.data());
+    compressed.resize(length);
+
+    fprintf(header, "extern const BakedTexture %s;\n", texture.name.c_str());
+
+    writeArray(source, texture.name.c_str(), compressed);
+
+    fprintf(source, "const BakedTexture %s = { %u, %u, %u, %zu, %zu, %sData };\n\n",
+      texture.name.c_str(), texture.width, texture.height, texture.components, texture.pixels.size(), compressed.size(), texture.name.c_str());
+
+    printf("%s: %ux%ux%u, %zu bytes -> %zu bytes\n", texture.name.c_str(), texture.width, texture.height, texture.components, texture.pixels.size(), compressed.size());
+  }
+
+  fclose(header);
+  fclose(source);
+
+  return 0;
+}
@@ -0,0 +1,1176 @@
+#include "../../src/Game.h"
+#include "../../src/ChunkMesher.h"
+#include "../../src/BlockSource.h"
+#include "../../src/AABB.h"
+#include "../../src/AABBPosition.h"
+#include "../../src/PerlinNoise.h"
+#include "../../src/OctaveNoise.h"
+#include "../../src/Random.h"
+#include "../../src/Resources.h"
+#include "../../src/PNG.h"
+#include "../../src/LZ.h"
+#include "../../src/Datagram.h"
+#include "../../src/SaveFile.h"
+#include "../../src/Entity.h"
+#include "../../src/AllocationTracker.h"
+#include "../../src/Host.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+Game game;
+
+static const uint64_t SEED = 0x5EED;
+static const int REPEATS = 5;
+static const double TARGET_SECONDS = 0.05;
+
+static const float TRANSPORT_LOSS = 0.02f;
+static const uint32_t TRANSPORT_SAMPLES = 1000;
+static const double TRANSPORT_INTERVAL = 0.004;
+
+static const int JOB_CHAIN_LENGTH = 64;
+static const int WALK_TICKS = 2000;
+
+static const int HOST_ROOMS = 128;
+static const int HOST_PLAYERS = 4;
+
+static const int ATLAS_SIZE = 4096;
+
+static const int LARGE_LEVEL_SIZE = 1024;
+static const int LARGE_LEVEL_VIEW = 128;
+
+static const char* filter = nullptr;
+static volatile uint64_t sink = 0;
+
+template <typename Function>
+static double measure(Function& function, uint64_t iterations)
+{
+  auto start = std::chrono::steady_clock::now();
+
+  for (uint64_t i = 0; i < iterations; i++)
+  {
+    function();
+  }
+
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Runs the function in batches long enough to time reliably and reports the fastest batch, which is the least disturbed by the rest of the machine.
+template <typename Function>
+static void run(const char* name, double bytes, Function function)
+{
+  if (filter && !strstr(name, filter))
+  {
+    return;
+  }
+
+  uint64_t iterations = 1;
+  double seconds = measure(function, iterations);
+
+  while (seconds < TARGET_SECONDS && iterations < (uint64_t(1) << 40))
+  {
+    iterations = seconds > 0.0 ? std::max(iterations * 2, uint64_t(iterations * TARGET_SECONDS / seconds)) : iterations * 16;
+    seconds = measure(function, iterations);
+  }
+
+  for (int i = 1; i < REPEATS; i++)
+  {
+    seconds = std::min(seconds, measure(function, iterations));
+  }
+
+  const double nanoseconds = seconds * 1e9 / double(iterations);
+  const double megabytes = bytes > 0.0 ? bytes / (nanoseconds / 1e9) / (1024.0 * 1024.0) : 0.0;
+
+  printf("{\"name\":\"%s\",\"iterations\":%llu,\"ns_per_op\":%.1f,\"mb_per_s\":%.2f}\n", name, (unsigned long long)iterations, nanoseconds, megabytes);
+  fflush(stdout);
+}
+
+static void generateLevel()
+{
+  game.levelGenerator.setSeed(SEED);
+  game.levelGenerator.init();
+  game.levelGenerator.generate();
+  game.level.calculateLightDepths(0, 0, Level::WIDTH, Level::DEPTH);
+}
+
+static void benchGeneration()
+{
+  run("level.generate", Level::VOLUME, [] {
+    game.levelGenerator.setSeed(SEED);
+    game.levelGenerator.init();
+    game.levelGenerator.generate();
+  });
+
+  generateLevel();
+}
+
+static void benchMeshing()
+{
+  const int chunksX = Level::WIDTH / ChunkMesher::SIZE;
+  const int chunksY = Level::HEIGHT / ChunkMesher::SIZE;
+  const int chunksZ = Level::DEPTH / ChunkMesher::SIZE;
+
+  std::unique_ptr<ChunkMesher> mesher(new ChunkMesher);
+  ChunkMesher::Mesh mesh;
+
+  size_t index = 0;
+
+  run("chunk.mesh", ChunkMesher::SIZE * ChunkMesher::SIZE * ChunkMesher::SIZE, [&] {
+    const int chunk = int(index++ % (chunksX * chunksY * chunksZ));
+    const glm::ivec3 position(chunk % chunksX, chunk / chunksX % chunksY, chunk / chunksX / chunksY);
+
+    mesher->build(BlockSource(game.level), position * ChunkMesher::SIZE, mesh);
+    sink += mesh.vertices.size() + mesh.waterVertices.size();
+  });
+}
+
+// Walking and meshing must not allocate once their buffers have grown to fit. Both run the same work twice, and the
+// second time is counted, which only means anything when built with ALLOCATIONS=1.
+static void benchAllocations()
+{
+  if (!AllocationTracker::ENABLED || (filter && !strstr("allocations", filter)))
+  {
+    return;
+  }
+
+  const int scope = AllocationTracker::MAX_SCOPES - 1;
+
+  Entity entity;
+  entity.init(&game.level);
+
+  auto walk = [&]() {
+    entity.setPosition(game.level.spawn.x, game.level.spawn.y, game.level.spawn.z);
+    entity.velocity = glm::vec3(0.0f);
+
+    for (int i = 0; i < WALK_TICKS; i++)
+    {
+      entity.turn(3.0f, 0.0f);
+      entity.moveRelative(0.0f, 1.0f, 0.1f);
+      entity.velocity.y -= 0.08f;
+      entity.move(entity.velocity.x, entity.velocity.y, entity.velocity.z);
+      entity.velocity *= 0.91f;
+    }
+  };
+
+  const int chunksX = Level::WIDTH / ChunkMesher::SIZE;
+  const int chunksY = Level::HEIGHT / ChunkMesher::SIZE;
+  const int chunksZ = Level::DEPTH / ChunkMesher::SIZE;
+
+  std::unique_ptr<ChunkMesher> mesher(new ChunkMesher);
+  ChunkMesher::Mesh mesh;
+
+  auto meshAll = [&]() {
+    for (int chunk = 0; chunk < chunksX * chunksY * chunksZ; chunk++)
+    {
+      const glm::ivec3 position(chunk % chunksX, chunk / chunksX % chunksY, chunk / chunksX / chunksY);
+
+      mesher->build(BlockSource(game.level), position * ChunkMesher::SIZE, mesh);
+      sink += mesh.vertices.size() + mesh.waterVertices.size();
+    }
+  };
+
+  auto count = [&](const char* name, auto& function) {
+    function();
+
+    AllocationTracker::collect(scope);
+    const int parent = AllocationTracker::enter(scope);
+
+    function();
+
+    AllocationTracker::leave(parent);
+    const auto totals = AllocationTracker::collect(scope);
+
+    printf("{\"name\":\"%s\",\"allocations\":%zu,\"bytes\":%zu}\n", name, totals.count, totals.bytes);
+
+    if (totals.count > 0)
+    {
+      printf("bench error: %s allocated %zu times.\n", name, totals.count);
+    }
+  };
+
+  count("allocations.walk", walk);
+  count("allocations.mesh", meshAll);
+
+  fflush(stdout);
+}
+
+static void benchCollision()
+{
+  Random random(SEED);
+
+  std::vector<AABB> boxes(1024);
+  std::vector<glm::vec3> starts(1024);
+  std::vector<glm::vec3> ends(1024);
+
+  for (size_t i = 0; i < boxes.size(); i++)
+  {
+    const float x = float(random.uniformRange(1.0, Level::WIDTH - 1.0));
+    const float y = float(random.uniformRange(game.level.groundLevel - 4.0, game.level.waterLevel + 8.0));
+    const float z = float(random.uniformRange(1.0, Level::DEPTH - 1.0));
+
+    // Roughly a player's bounding box swept by one tick of movement.
+    boxes[i] = AABB{ x - 0.3f, y, z - 0.3f, x + 0.3f, y + 1.8f, z + 0.3f }.expand(0.5f, -0.5f, 0.5f);
+
+    starts[i] = glm::vec3(x, y + 1.62f, z);
+    ends[i] = starts[i] + glm::normalize(glm::vec3(random.uniformRange(-1.0, 1.0), random.uniformRange(-1.0, 0.2), random.uniformRange(-1.0, 1.0))) * 5.0f;
+  }
+
+  std::vector<AABB> tiles;
+  size_t index = 0;
+
+  run("level.getTileAABB", 0.0, [&] {
+    game.level.getTileAABB(boxes[index++ % boxes.size()], tiles);
+    sink += tiles.size();
+  });
+
+  run("level.clip", 0.0, [&] {
+    const size_t i = index++ % starts.size();
+    sink += game.level.clip(starts[i], ends[i]).isValid;
+  });
+
+  run("level.containsLiquid", 0.0, [&] {
+    sink += game.level.containsLiquid(boxes[index++ % boxes.size()], Block::Type::BLOCK_WATER);
+  });
+}
+
+static void benchLighting()
+{
+  run("level.calculateLightDepths", Level::VOLUME, [] {
+    game.level.calculateLightDepths(0, 0, Level::WIDTH, Level::DEPTH);
+  });
+}
+
+static void benchFlooding()
+{
+  const int floor = 8;
+  const size_t layer = size_t(Level::WIDTH) * Level::DEPTH;
+
+  std::unique_ptr<unsigned char[]> saved(new unsigned char[Level::VOLUME]);
+  memcpy(saved.get(), game.level.blocks, Level::VOLUME);
+
+  // A flat stone basin flooded from a single source in the middle, until the water has covered the whole floor.
+  run("level.flood", double(layer), [&] {
+    for (int z = 0; z < Level::DEPTH; z++)
+    {
+      for (int y = 0; y < Level::HEIGHT; y++)
+      {
+        memset(game.level.blocks + (z * Level::HEIGHT + y) * Level::WIDTH, int(y < floor ? Block::Type::BLOCK_STONE : Block::Type::BLOCK_AIR), Level::WIDTH);
+      }
+    }
+
+    game.level.blocks[(Level::DEPTH / 2 * Level::HEIGHT + floor) * Level::WIDTH + Level::WIDTH / 2] = (unsigned char)Block::Type::BLOCK_WATER;
+    game.level.updateTile(Level::WIDTH / 2, floor, Level::DEPTH / 2);
+
+    while (!game.level.updates.empty())
+    {
+      game.level.tick();
+    }
+  });
+
+  memcpy(game.level.blocks, saved.get(), Level::VOLUME);
+}
+
+// One tick of a host holding many copies of the level, each with a spring flowing and a few players walking about.
+static void benchHost()
+{
+  if (filter && !strstr("host.tick", filter))
+  {
+    return;
+  }
+
+  Host host;
+  host.init(&game.jobs, 20.0f);
+
+  Random random(SEED);
+  std::vector<Host::Room*> rooms;
+
+  for (int i = 0; i < HOST_ROOMS; i++)
+  {
+    auto room = host.create("room " + std::to_string(i), game.level.blocks);
+
+    const glm::ivec3 spring = glm::ivec3(room->level.spawn) + glm::ivec3(4, 1, 4);
+    room->level.setTileWithNeighborChange(spring.x, spring.y, spring.z, (unsigned char)Block::Type::BLOCK_WATER);
+
+    for (int j = 0; j < HOST_PLAYERS; j++)
+    {
+      host.join(room, room->level.spawn + glm::vec3(0.5f, 2.0f, 0.5f));
+    }
+
+    rooms.push_back(room);
+  }
+
+  run("host.tick", 0.0, [&] {
+    for (auto room : rooms)
+    {
+      for (auto& player : room->players)
+      {
+        player.moveRelative(float(random.uniformRange(-1.0, 1.0)), float(random.uniformRange(-1.0, 1.0)), 0.1f);
+      }
+    }
+
+    host.tick();
+  });
+}
+
+static void benchNoise()
+{
+  Random random(SEED);
+
+  PerlinNoise perlin(random);
+  OctaveNoise octave(random, 8);
+
+  float row[Level::WIDTH];
+  float out[Level::WIDTH];
+
+  for (int x = 0; x < Level::WIDTH; x++)
+  {
+    row[x] = x * 1.3f;
+  }
+
+  float z = 0.0f;
+
+  run("noise.perlin", sizeof(float), [&] {
+    sink += uint64_t(perlin.compute(z, z * 0.5f) * 1024.0f);
+    z += 0.37f;
+  });
+
+  run("noise.perlin.accumulate", sizeof(out), [&] {
+    memset(out, 0, sizeof(out));
+    perlin.accumulate(row, z, 1.0f, 1.0f, out, Level::WIDTH);
+    sink += uint64_t(out[0]);
+    z += 0.37f;
+  });
+
+  run("noise.octave", sizeof(float), [&] {
+    sink += uint64_t(octave.compute(z, z * 0.5f) * 1024.0f);
+    z += 0.37f;
+  });
+
+  run("noise.octave.row", sizeof(out), [&] {
+    octave.compute(row, z, out, Level::WIDTH);
+    sink += uint64_t(out[0]);
+    z += 0.37f;
+  });
+}
+
+static void benchCompression()
+{
+  std::vector<unsigned char> compressed(Level::VOLUME + Level::VOLUME / 16 + 66);
+  std::vector<unsigned char> decompressed(Level::VOLUME);
+
+  run("lz.compress", Level::VOLUME, [&] {
+    sink += fastlz_compress(game.level.blocks, Level::VOLUME, compressed.data());
+  });
+
+  run("lz.compress.level2", Level::VOLUME, [&] {
+    sink += fastlz_compress_level(2, game.level.blocks, Level::VOLUME, compressed.data());
+  });
+
+  const int length = fastlz_compress(game.level.blocks, Level::VOLUME, compressed.data());
+
+  if (fastlz_decompress(compressed.data(), length, decompressed.data(), Level::VOLUME) != Level::VOLUME || memcmp(decompressed.data(), game.level.blocks, Level::VOLUME) != 0)
+  {
+    printf("bench error: decompressed level does not match.\n");
+    return;
+  }
+
+  run("lz.decompress", Level::VOLUME, [&] {
+    sink += fastlz_decompress(compressed.data(), length, decompressed.data(), Level::VOLUME);
+  });
+}
+
+// Writes bits least significant first, as deflate expects.
+struct BitWriter
+{
+  std::vector<unsigned char>& out;
+  uint32_t buffer = 0;
+  int count = 0;
+
+  void write(uint32_t bits, int length)
+  {
+    buffer |= bits << count;
+    count += length;
+
+    while (count >= 8)
+    {
+      out.push_back((unsigned char)buffer);
+      buffer >>= 8;
+      count -= 8;
+    }
+  }
+
+  // Huffman codes are stored most significant bit first.
+  void writeCode(uint32_t code, int length)
+  {
+    uint32_t reversed = 0;
+
+    for (int i = 0; i < length; i++)
+    {
+      reversed |= ((code >> i) & 1) << (length - 1 - i);
+    }
+
+    write(reversed, length);
+  }
+
+  void writeSymbol(int symbol)
+  {
+    if (symbol < 144) { writeCode(0x30 + symbol, 8); }
+    else if (symbol < 256) { writeCode(0x190 + symbol - 144, 9); }
+    else if (symbol < 280) { writeCode(symbol - 256, 7); }
+    else { writeCode(0xC0 + symbol - 280, 8); }
+  }
+};
+
+// A zlib stream of a single fixed Huffman block, with greedy matches found through a one entry hash table.
+static void deflate(const std::vector<unsigned char>& data, std::vector<unsigned char>& out)
+{
+  static const int lengthBase[] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+  static const int lengthExtra[] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+  static const int distanceBase[] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+  static const int distanceExtra[] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+  out.push_back(0x78);
+  out.push_back(0x01);
+
+  BitWriter writer = { out };
+  writer.write(1, 1);
+  writer.write(1, 2);
+
+  std::vector<int> table(1 << 15, -1);
+  const size_t size = data.size();
+  size_t i = 0;
+
+  while (i < size)
+  {
+    int length = 0;
+    size_t distance = 0;
+
+    if (i + 3 <= size)
+    {
+      const uint32_t hash = ((data[i] << 16 | data[i + 1] << 8 | data[i + 2]) * 2654435761u) >> 17;
+      const int candidate = table[hash];
+      table[hash] = int(i);
+
+      if (candidate >= 0 && i - candidate <= 32768)
+      {
+        while (length < 258 && i + length < size && data[candidate + length] == data[i + length])
+        {
+          length++;
+        }
+
+        distance = i - candidate;
+      }
+    }
+
+    if (length < 3)
+    {
+      writer.writeSymbol(data[i++]);
+      continue;
+    }
+
+    int code = 28;
+    while (lengthBase[code] > length) { code--; }
+
+    writer.writeSymbol(257 + code);
+    writer.write(length - lengthBase[code], lengthExtra[code]);
+
+    code = 29;
+    while (distanceBase[code] > int(distance)) { code--; }
+
+    writer.writeCode(code, 5);
+    writer.write(uint32_t(distance - distanceBase[code]), distanceExtra[code]);
+
+    i += length;
+  }
+
+  writer.writeSymbol(256);
+  writer.write(0, 7);
+
+  uint32_t a = 1;
+  uint32_t b = 0;
+
+  for (const auto value : data)
+  {
+    a = (a + value) % 65521;
+    b = (b + a) % 65521;
+  }
+
+  const uint32_t adler = b << 16 | a;
+
+  for (int shift = 24; shift >= 0; shift -= 8)
+  {
+    out.push_back((unsigned char)(adler >> shift));
+  }
+}
+
+static void writeChunk(std::vector<unsigned char>& png, const char* type, const std::vector<unsigned char>& data)
+{
+  static uint32_t table[256];
+
+  if (!table[1])
+  {
+    for (uint32_t n = 0; n < 256; n++)
+    {
+      uint32_t c = n;
+
+      for (int k = 0; k < 8; k++)
+      {
+        c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      }
+
+      table[n] = c;
+    }
+  }
+
+  const uint32_t length = uint32_t(data.size());
+
+  for (int shift = 24; shift >= 0; shift -= 8)
+  {
+    png.push_back((unsigned char)(length >> shift));
+  }
+
+  const size_t start = png.size();
+  png.insert(png.end(), type, type + 4);
+  png.insert(png.end(), data.begin(), data.end());
+
+  uint32_t crc = 0xFFFFFFFFu;
+
+  for (size_t i = start; i < png.size(); i++)
+  {
+    crc = table[(crc ^ png[i]) & 0xFF] ^ (crc >> 8);
+  }
+
+  crc ^= 0xFFFFFFFFu;
+
+  for (int shift = 24; shift >= 0; shift -= 8)
+  {
+    png.push_back((unsigned char)(crc >> shift));
+  }
+}
+
+// A texture pack sized atlas made of the terrain texture tiled across it, with every other copy lightly noised so
+// both long matches and runs of literals get decoded. Rows cycle through all five filters.
+static bool encodeAtlas(std::vector<unsigned char>& pixels, std::vector<unsigned char>& png)
+{
+  upng_t* upng = upng_new_from_bytes(terrainResourceTexture, sizeof(terrainResourceTexture));
+
+  if (upng_decode(upng) != UPNG_EOK || upng_get_components(upng) != 4)
+  {
+    upng_free(upng);
+    return false;
+  }
+
+  const int tileSize = int(upng_get_width(upng));
+  const unsigned char* terrain = upng_get_buffer(upng);
+  const size_t stride = size_t(ATLAS_SIZE) * 4;
+
+  pixels.resize(stride * ATLAS_SIZE);
+
+  for (int y = 0; y < ATLAS_SIZE; y++)
+  {
+    for (int x = 0; x < ATLAS_SIZE; x++)
+    {
+      const unsigned char* source = terrain + ((y % tileSize) * tileSize + x % tileSize) * 4;
+      unsigned char* pixel = pixels.data() + y * stride + x * 4;
+
+      uint32_t noise = 0;
+
+      if ((x / tileSize + y / tileSize) & 1)
+      {
+        noise = uint32_t(x) * 73856093u ^ uint32_t(y) * 19349663u;
+        noise ^= noise >> 13;
+        noise *= 0x5bd1e995u;
+        noise ^= noise >> 15;
+      }
+
+      for (int c = 0; c < 3; c++)
+      {
+        pixel[c] = (unsigned char)glm::clamp(int(source[c]) + int((noise >> (c * 8)) & 7) - 3, 0, 255);
+      }
+
+      pixel[3] = source[3];
+    }
+  }
+
+  upng_free(upng);
+
+  std::vector<unsigned char> filtered((stride + 1) * ATLAS_SIZE);
+
+  for (int y = 0; y < ATLAS_SIZE; y++)
+  {
+    const int type = y % 5;
+    const unsigned char* row = pixels.data() + y * stride;
+    const unsigned char* previous = y > 0 ? row - stride : nullptr;
+    unsigned char* out = filtered.data() + y * (stride + 1);
+
+    *out++ = (unsigned char)type;
+
+    for (size_t i = 0; i < stride; i++)
+    {
+      const int left = i >= 4 ? row[i - 4] : 0;
+      const int up = previous ? previous[i] : 0;
+      const int upLeft = previous && i >= 4 ? previous[i - 4] : 0;
+
+      int predictor = 0;
+
+      if (type == 1) { predictor = left; }
+      else if (type == 2) { predictor = up; }
+      else if (type == 3) { predictor = (left + up) / 2; }
+      else if (type == 4)
+      {
+        const int p = left + up - upLeft;
+        const int pa = abs(p - left);
+        const int pb = abs(p - up);
+        const int pc = abs(p - upLeft);
+
+        predictor = pa <= pb && pa <= pc ? left : pb <= pc ? up : upLeft;
+      }
+
+      out[i] = (unsigned char)(row[i] - predictor);
+    }
+  }
+
+  static const unsigned char signature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+  png.assign(signature, signature + sizeof(signature));
+
+  std::vector<unsigned char> header = {
+    0, 0, ATLAS_SIZE >> 8 & 0xFF, ATLAS_SIZE & 0xFF,
+    0, 0, ATLAS_SIZE >> 8 & 0xFF, ATLAS_SIZE & 0xFF,
+    8, 6, 0, 0, 0,
+  };
+
+  std::vector<unsigned char> data;
+  deflate(filtered, data);
+
+  writeChunk(png, "IHDR", header);
+  writeChunk(png, "IDAT", data);
+  writeChunk(png, "IEND", {});
+
+  return true;
+}
+
+static void benchPNG()
+{
+  upng_t* upng = upng_new_from_bytes(terrainResourceTexture, sizeof(terrainResourceTexture));
+
+  if (upng_decode(upng) != UPNG_EOK)
+  {
+    printf("bench error: failed to decode terrain texture.\n");
+
+    upng_free(upng);
+    return;
+  }
+
+  const double size = upng_get_size(upng);
+  upng_free(upng);
+
+  run("png.decode", size, [] {
+    upng_t* upng = upng_new_from_bytes(terrainResourceTexture, sizeof(terrainResourceTexture));
+    sink += upng_decode(upng);
+    upng_free(upng);
+  });
+
+  if (filter && !strstr("png.decode.atlas", filter))
+  {
+    return;
+  }
+
+  std::vector<unsigned char> pixels;
+  std::vector<unsigned char> png;
+
+  if (!encodeAtlas(pixels, png))
+  {
+    printf("bench error: failed to build the atlas.\n");
+    return;
+  }
+
+  upng = upng_new_from_bytes(png.data(), (unsigned long)png.size());
+
+  const bool decoded = upng_decode(upng) == UPNG_EOK && upng_get_size(upng) == pixels.size() &&
+    memcmp(upng_get_buffer(upng), pixels.data(), pixels.size()) == 0;
+
+  upng_free(upng);
+
+  if (!decoded)
+  {
+    printf("bench error: the %dx%d atlas decoded differently from what was encoded.\n", ATLAS_SIZE, ATLAS_SIZE);
+    return;
+  }
+
+  run("png.decode.atlas", double(pixels.size()), [&] {
+    upng_t* upng = upng_new_from_bytes(png.data(), (unsigned long)png.size());
+    sink += upng_decode(upng);
+    upng_free(upng);
+  });
+}
+
+// Schedules chains of jobs that each depend on the one before, and checks they ran in order, that a job can hand
+// work back to the main thread, and that waiting on a parallelFor doesn't run a job queued before it.
+static void benchJobs()
+{
+  if (filter && !strstr("jobs.chain", filter))
+  {
+    return;
+  }
+
+  std::vector<int> order;
+  order.reserve(JOB_CHAIN_LENGTH);
+
+  bool ordered = true;
+
+  run("jobs.chain", 0, [&] {
+    order.clear();
+
+    JobSystem::Handle previous = game.jobs.schedule([&order]() { order.push_back(0); });
+
+    for (int i = 1; i < JOB_CHAIN_LENGTH; i++)
+    {
+      previous = game.jobs.schedule([&order, i]() { order.push_back(i); }, { previous });
+    }
+
+    game.jobs.wait(previous);
+
+    for (int i = 0; i < JOB_CHAIN_LENGTH; i++)
+    {
+      ordered = ordered && order.size() == size_t(JOB_CHAIN_LENGTH) && order[i] == i;
+    }
+  });
+
+  if (!ordered)
+  {
+    printf("bench error: jobs ran before the jobs they depend on.\n");
+  }
+
+  const auto mainThread = std::this_thread::get_id();
+  bool onMainThread = false;
+
+  auto job = game.jobs.schedule([&]() {
+    game.jobs.runOnMainThread([&]() { onMainThread = std::this_thread::get_id() == mainThread; });
+  });
+
+  game.jobs.wait(job);
+  game.jobs.update();
+
+  if (!onMainThread)
+  {
+    printf("bench error: a job's main thread function didn't run on the main thread.\n");
+  }
+
+  // Without workers every job runs on the main thread anyway.
+  if (game.jobs.getThreadCount() > 1)
+  {
+    std::atomic<bool> waiting = { false };
+    std::atomic<bool> stolen = { false };
+
+    auto background = game.jobs.schedule([&]() { stolen = waiting && std::this_thread::get_id() == mainThread; });
+
+    waiting = true;
+    game.jobs.parallelFor(0, game.jobs.getThreadCount() * 4, 1, [](int, int) { std::this_thread::yield(); });
+    waiting = false;
+
+    game.jobs.wait(background);
+
+    if (stolen)
+    {
+      printf("bench error: waiting on a parallelFor ran an unrelated job.\n");
+    }
+  }
+}
+
+static double milliseconds(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static double residentMegabytes()
+{
+  long pages = 0;
+  long resident = 0;
+
+  FILE* file = fopen("/proc/self/statm", "r");
+
+  if (file)
+  {
+    if (fscanf(file, "%ld %ld", &pages, &resident) != 2)
+    {
+      resident = 0;
+    }
+
+    fclose(file);
+  }
+
+  return double(resident) * sysconf(_SC_PAGESIZE) / 1048576.0;
+}
+
+static void dropCache(const char* path)
+{
+  const int descriptor = open(path, O_RDONLY);
+
+  if (descriptor >= 0)
+  {
+    fdatasync(descriptor);
+    posix_fadvise(descriptor, 0, 0, POSIX_FADV_DONTNEED);
+    close(descriptor);
+  }
+}
+
+// Opening a level as large as a 1024x1024 world by reading it whole, and by mapping it and touching only the columns
+// around the player. The file is dropped from the page cache before each open, resident memory is the growth of the
+// process while the level is open.
+static void benchLargeLevel()
+{
+  if (filter && !strstr("level.open", filter))
+  {
+    return;
+  }
+
+  const char* path = "output/bench-large.level";
+  const size_t width = LARGE_LEVEL_SIZE;
+  const size_t depth = LARGE_LEVEL_SIZE;
+  const size_t size = width * Level::HEIGHT * depth;
+
+  {
+    std::vector<unsigned char> row(width);
+    FILE* file = fopen(path, "wb");
+
+    if (!file)
+    {
+      printf("bench error: failed to create %s.\n", path);
+      return;
+    }
+
+    for (size_t z = 0; z < depth; z++)
+    {
+      for (size_t y = 0; y < Level::HEIGHT; y++)
+      {
+        for (size_t x = 0; x < width; x++)
+        {
+          row[x] = game.level.blocks[((z % Level::DEPTH) * Level::HEIGHT + y) * Level::WIDTH + x % Level::WIDTH];
+        }
+
+        fwrite(row.data(), 1, row.size(), file);
+      }
+    }
+
+    fclose(file);
+  }
+
+  const size_t x0 = (width - LARGE_LEVEL_VIEW) / 2;
+  const size_t z0 = (depth - LARGE_LEVEL_VIEW) / 2;
+
+  dropCache(path);
+
+  double resident = residentMegabytes();
+  auto start = std::chrono::steady_clock::now();
+
+  {
+    std::unique_ptr<unsigned char[]> blocks(new unsigned char[size]);
+    FILE* file = fopen(path, "rb");
+
+    const bool read = file && fread(blocks.get(), 1, size, file) == size;
+
+    if (file)
+    {
+      fclose(file);
+    }
+
+    if (!read)
+    {
+      printf("bench error: failed to read %s.\n", path);
+      return;
+    }
+
+    for (size_t z = z0; z < z0 + LARGE_LEVEL_VIEW; z++)
+    {
+      for (size_t y = 0; y < Level::HEIGHT; y++)
+      {
+        sink += blocks[(z * Level::HEIGHT + y) * width + x0];
+      }
+    }
+
+    printf("{\"name\":\"level.open.fread\",\"size_mb\":%.1f,\"ms\":%.2f,\"resident_mb\":%.1f}\n", size / 1048576.0, milliseconds(start), residentMegabytes() - resident);
+  }
+
+  dropCache(path);
+
+  resident = residentMegabytes();
+  start = std::chrono::steady_clock::now();
+
+  {
+    const int descriptor = open(path, O_RDONLY);
+    void* mapping = descriptor >= 0 ? mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0) : MAP_FAILED;
+
+    if (mapping == MAP_FAILED)
+    {
+      printf("bench error: failed to map %s.\n", path);
+
+      if (descriptor >= 0)
+      {
+        close(descriptor);
+      }
+
+      return;
+    }
+
+    const unsigned char* blocks = (const unsigned char*)mapping;
+
+    for (size_t z = z0; z < z0 + LARGE_LEVEL_VIEW; z++)
+    {
+      for (size_t y = 0; y < Level::HEIGHT; y++)
+      {
+        sink += blocks[(z * Level::HEIGHT + y) * width + x0];
+      }
+    }
+
+    printf("{\"name\":\"level.open.mmap\",\"size_mb\":%.1f,\"ms\":%.2f,\"resident_mb\":%.1f}\n", size / 1048576.0, milliseconds(start), residentMegabytes() - resident);
+
+    munmap(mapping, size);
+    close(descriptor);
+  }
+
+  fflush(stdout);
+  remove(path);
+}
+
+// Saving after a single edit, once to a save file and once as a flush of the mapped level.
+static void benchSave()
+{
+  if (filter && !strstr("level.save", filter))
+  {
+    return;
+  }
+
+  const char* savePath = "output/bench.save";
+  const char* mappedPath = "output/bench-mapped.level";
+
+  SaveFile::Snapshot snapshot;
+  snapshot.blocks.assign(game.level.blocks, game.level.blocks + Level::VOLUME);
+
+  SaveFile::Cache cache;
+  size_t index = 0;
+
+  run("level.save.file", Level::VOLUME, [&] {
+    snapshot.blocks[index++ % Level::VOLUME] ^= 1;
+    sink += SaveFile::write(savePath, snapshot, cache);
+  });
+
+  std::unique_ptr<unsigned char[]> saved(new unsigned char[Level::VOLUME]);
+  memcpy(saved.get(), game.level.blocks, Level::VOLUME);
+
+  bool existing;
+
+  if (!game.level.map(mappedPath, existing))
+  {
+    printf("bench error: failed to map %s.\n", mappedPath);
+    return;
+  }
+
+  memcpy(game.level.blocks, saved.get(), Level::VOLUME);
+  game.level.flush();
+
+  run("level.save.mapped", Level::VOLUME, [&] {
+    game.level.blocks[index++ % Level::VOLUME] ^= 1;
+    sink += game.level.flush();
+  });
+
+  game.level.unmap();
+  memcpy(game.level.blocks, saved.get(), Level::VOLUME);
+
+  remove(savePath);
+  remove(mappedPath);
+}
+
+static void reportLatency(const char* name, std::vector<double>& ages, size_t sent, size_t received)
+{
+  if (ages.empty())
+  {
+    printf("bench error: no samples for %s.\n", name);
+    return;
+  }
+
+  std::sort(ages.begin(), ages.end());
+
+  double total = 0.0;
+
+  for (const auto age : ages)
+  {
+    total += age;
+  }
+
+  printf(
+    "{\"name\":\"%s\",\"loss\":%.2f,\"sent\":%zu,\"received\":%zu,\"mean_ms\":%.2f,\"p99_ms\":%.2f,\"max_ms\":%.2f}\n",
+    name, TRANSPORT_LOSS, sent, received,
+    total / double(ages.size()) * 1000.0, ages[ages.size() * 99 / 100] * 1000.0, ages.back() * 1000.0
+  );
+  fflush(stdout);
+}
+
+// Streams positions to a loopback echo peer over both datagram channels at once, with seeded loss on each side, and
+// reports how old the newest echoed position is on every poll. The reliable channel stands in for the websocket,
+// a lost datagram holds back everything after it until the retransmit arrives.
+static void benchTransport()
+{
+  if (filter && !strstr("datagram.position", filter))
+  {
+    return;
+  }
+
+  Datagram peer;
+  Datagram client;
+
+  peer.seed(1);
+  peer.loss = TRANSPORT_LOSS;
+  client.seed(2);
+  client.loss = TRANSPORT_LOSS;
+
+  peer.onMessage = [&](const unsigned char* data, size_t size, bool) {
+    peer.send(data, size, data[0] ? Datagram::Channel::Reliable : Datagram::Channel::Unreliable);
+  };
+
+  struct Sample
+  {
+    uint8_t reliable;
+    uint32_t index;
+    double time;
+  };
+
+  const auto now = [] {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  };
+
+  double newest[2] = {};
+  size_t received[2] = {};
+  uint32_t expected = 0;
+  bool ordered = true;
+
+  client.onMessage = [&](const unsigned char* data, size_t size, bool) {
+    Sample sample;
+
+    if (size != sizeof(sample))
+    {
+      ordered = false;
+      return;
+    }
+
+    memcpy(&sample, data, sizeof(sample));
+
+    if (sample.reliable)
+    {
+      ordered = ordered && sample.index == expected++;
+    }
+
+    newest[sample.reliable] = std::max(newest[sample.reliable], sample.time);
+    received[sample.reliable]++;
+  };
+
+  if (!peer.listen(0) || !client.open("127.0.0.1", peer.getPort()))
+  {
+    printf("bench error: failed to open loopback datagram peers.\n");
+    return;
+  }
+
+  const double start = now();
+
+  while (!client.isOpen() && now() - start < 1.0)
+  {
+    client.poll();
+    peer.poll();
+  }
+
+  if (!client.isOpen())
+  {
+    printf("bench error: loopback datagram peer never accepted.\n");
+    return;
+  }
+
+  std::vector<double> ages[2];
+  uint32_t sent = 0;
+  double next = now();
+
+  while (sent < TRANSPORT_SAMPLES || client.getBufferedAmount() || peer.getBufferedAmount())
+  {
+    const double time = now();
+
+    if (sent < TRANSPORT_SAMPLES && time >= next)
+    {
+      for (uint8_t reliable = 0; reliable < 2; reliable++)
+      {
+        const Sample sample = { reliable, sent, time };
+        client.send((const unsigned char*)&sample, sizeof(sample), reliable ? Datagram::Channel::Reliable : Datagram::Channel::Unreliable);
+      }
+
+      sent++;
+      next += TRANSPORT_INTERVAL;
+    }
+
+    client.poll();
+    peer.poll();
+
+    if (sent < TRANSPORT_SAMPLES)
+    {
+      for (int reliable = 0; reliable < 2; reliable++)
+      {
+        if (newest[reliable] > 0.0)
+        {
+          ages[reliable].push_back(now() - newest[reliable]);
+        }
+      }
+    }
+
+    if (time - start > 30.0)
+    {
+      printf("bench error: loopback datagram peer stopped responding.\n");
+      return;
+    }
+
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+  }
+
+  if (!ordered || received[1] != TRANSPORT_SAMPLES)
+  {
+    printf("bench error: reliable channel delivered %zu of %u messages%s.\n", received[1], TRANSPORT_SAMPLES, ordered ? "" : " out of order");
+  }
+
+  reportLatency("datagram.position.unreliable", ages[0], sent, received[0]);
+  reportLatency("datagram.position.reliable", ages[1], sent, received[1]);
+}
+
+int main(int argc, char** argv)
+{
+  if (argc > 1)
+  {
+    filter = argv[1];
+  }
+
+  game.profiler.tracing = false;
+  game.jobs.init();
+
+  generateLevel();
+
+  benchGeneration();
+  benchMeshing();
+  benchAllocations();
+  benchCollision();
+  benchLighting();
+  benchFlooding();
+  benchHost();
+  benchNoise();
+  benchCompression();
+  benchPNG();
+  benchJobs();
+  benchLargeLevel();
+  benchSave();
+  benchTransport();
+
+  return 0;
+}
@@ -0,0 +1,119 @@
+#include "AllocationTracker.h"
+
+#if defined(CUBIC_TRACK_ALLOCATIONS)
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Plain statics, so allocations made before or after the game exists are still safe to count.
+static std::atomic<size_t> counts[AllocationTracker::MAX_SCOPES];
+static std::atomic<size_t> bytes[AllocationTracker::MAX_SCOPES];
+static thread_local int currentScope = 0;
+
+static void track(size_t size)
+{
+  counts[currentScope].fetch_add(1, std::memory_order_relaxed);
+  bytes[currentScope].fetch_add(size, std::memory_order_relaxed);
+}
+
+int AllocationTracker::enter(int scope)
+{
+  const int parent = currentScope;
+  currentScope = scope;
+
+  return parent;
+}
+
+void AllocationTracker::leave(int scope)
+{
+  currentScope = scope;
+}
+
+AllocationTracker::Totals AllocationTracker::collect(int scope)
+{
+  return { counts[scope].exchange(0, std::memory_order_relaxed), bytes[scope].exchange(0, std::memory_order_relaxed) };
+}
+
+#if defined(__GLIBC__)
+// glibc lets the executable interpose malloc itself, which also catches allocations made by C code and by the
+// standard library's own operator new.
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void* __libc_realloc(void* pointer, size_t size);
+
+extern "C" void* malloc(size_t size)
+{
+  track(size);
+  return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count, size_t size)
+{
+  track(count * size);
+  return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* pointer, size_t size)
+{
+  track(size);
+  return __libc_realloc(pointer, size);
+}
+
+static void* allocate(size_t size)
+{
+  return std::malloc(size ? size : 1);
+}
+#else
+static void* allocate(size_t size)
+{
+  track(size);
+  return std::malloc(size ? size : 1);
+}
+#endif
+
+void* operator new(size_t size)
+{
+  void* pointer = allocate(size);
+  if (!pointer)
+  {
+    throw std::bad_alloc();
+  }
+
+  return pointer;
+}
+
+void* operator new[](size_t size)
+{
+  return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+  return allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+  return allocate(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept
+{
+  std::free(pointer);
+}
+#endif
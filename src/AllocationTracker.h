@@ -0,0 +1,30 @@
+#pragma once
+#include <cstddef>
+
+// Counts heap allocations against the innermost profiler scope of the thread making them. Only compiled in when
+// CUBIC_TRACK_ALLOCATIONS is defined, since it replaces the global allocation functions.
+class AllocationTracker
+{
+public:
+  struct Totals
+  {
+    size_t count;
+    size_t bytes;
+  };
+
+#if defined(CUBIC_TRACK_ALLOCATIONS)
+  static int enter(int scope);
+  static void leave(int scope);
+  static Totals collect(int scope);
+
+  constexpr static bool ENABLED = true;
+#else
+  static int enter(int) { return 0; }
+  static void leave(int) {}
+  static Totals collect(int) { return {}; }
+
+  constexpr static bool ENABLED = false;
+#endif
+
+  constexpr static int MAX_SCOPES = 64;
+};
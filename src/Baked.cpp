@@ -0,0 +1,8720 @@
+#include "Baked.h"
+
+static const unsigned char cloudsBakedTextureData[29072] = {
+  0x21, 0x00, 0x00, 0xE0, 0x39, 0x01, 0x00, 0xFF, 0xE0, 0x06, 0x00, 0xE0,
+  0x07, 0x51, 0x40, 0x1E, 0xE0, 0x07, 0x13, 0xE0, 0xFF, 0x10, 0x00, 0x41,
+  0x2B, 0x40, 0x00, 0x41, 0x1F, 0x40, 0x07, 0x40, 0x00, 0xC0, 0x0B, 0x40,
+  0x07, 0xE0, 0x0B, 0x00, 0x40, 0x23, 0xE0, 0x03, 0x00, 0xE0, 0x0B, 0x23,
+  0xE0, 0x3B, 0x00, 0x40, 0x63, 0xE0, 0x3B, 0x47, 0xE0, 0x5F, 0x00, 0xE0,
+  0x03, 0xAF, 0x40, 0x0B, 0x40, 0x00, 0xE0, 0x37, 0x7B, 0x40, 0x43, 0xC0,
+  0x00, 0xE0, 0x07, 0x4B, 0x40, 0x17, 0xE0, 0x07, 0x13, 0x40, 0x00, 0x40,
+  0x17, 0x40, 0x00, 0xE0, 0x07, 0x0B, 0xE0, 0x7B, 0x00, 0x40, 0x97, 0x40,
+  0x00, 0xE0, 0x23, 0x8B, 0xE0, 0x07, 0x2F, 0x40, 0x0F, 0xE0, 0x03, 0x00,
+  0xE0, 0x03, 0x4B, 0xC0, 0x17, 0xC0, 0x13, 0x40, 0x0F, 0xC0, 0x0B, 0xE0,
+  0x0F, 0x00, 0x40, 0x23, 0x40, 0x00, 0xE0, 0x0F, 0x1F, 0xE0, 0x2F, 0x00,
+  0x40, 0x53, 0x40, 0x00, 0xE0, 0x0B, 0x3F, 0x40, 0x17, 0xC0, 0x00, 0xE0,
+  0x0B, 0x1F, 0xE0, 0x27, 0x00, 0xE0, 0x37, 0x4B, 0x40, 0x3F, 0xC0, 0x73,
+  0x40, 0x0B, 0xE0, 0x07, 0x00, 0xC0, 0x1B, 0x40, 0x00, 0xE0, 0x03, 0x1B,
+  0x40, 0x0F, 0xE0, 0x27, 0x00, 0x40, 0x3F, 0xE0, 0x17, 0x33, 0x40, 0x23,
+  0x40, 0x00, 0xE0, 0x17, 0x27, 0xE0, 0x1F, 0x00, 0xE0, 0x13, 0x4B, 0x40,
+  0x1B, 0x40, 0x00, 0xE0, 0x1F, 0x4B, 0xE0, 0x5B, 0x00, 0x40, 0x8F, 0xE0,
+  0x03, 0x00, 0xE0, 0x23, 0x73, 0xE0, 0x03, 0x37, 0xC0, 0x00, 0xE0, 0x23,
+  0x3F, 0xE0, 0x57, 0x00, 0xE0, 0x37, 0x93, 0xC0, 0x3F, 0x40, 0x00, 0xE0,
+  0x17, 0xAB, 0x40, 0x23, 0x40, 0x00, 0xE0, 0x17, 0x27, 0xE0, 0x4F, 0x00,
+  0xE0, 0x53, 0x7B, 0xE0, 0x03, 0x5B, 0x40, 0x0B, 0xC0, 0x00, 0xE0, 0x2B,
+  0xCB, 0x40, 0x3B, 0x40, 0x37, 0x40, 0x07, 0xE0, 0x07, 0x00, 0x40, 0x17,
+  0xE0, 0x3F, 0x00, 0xC0, 0x5B, 0xE0, 0x3F, 0x4F, 0xE0, 0x2F, 0x00, 0xC0,
+  0x87, 0xC0, 0x00, 0xE0, 0x2F, 0x47, 0xE0, 0x07, 0x00, 0x40, 0x4F, 0xE0,
+  0x07, 0x13, 0xE0, 0x2F, 0x00, 0x40, 0x4B, 0x40, 0x00, 0xE0, 0x1F, 0x3F,
+  0x40, 0x2B, 0xE0, 0x13, 0x00, 0xE0, 0x1F, 0x47, 0xE0, 0x2F, 0x00, 0x40,
+  0x7B, 0xE0, 0x1B, 0x3B, 0x40, 0x27, 0xC0, 0x00, 0xE0, 0x1B, 0x2F, 0xE0,
+  0x07, 0x00, 0xC0, 0x3B, 0x40, 0x00, 0xC0, 0x1B, 0xE0, 0x03, 0x0B, 0xE0,
+  0xDB, 0x00, 0x40, 0xEF, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0xF3, 0xC0, 0x17,
+  0xE0, 0x03, 0x13, 0xE0, 0x13, 0x00, 0xC0, 0x2F, 0xE0, 0x0F, 0x00, 0xE0,
+  0x03, 0x3B, 0x40, 0x23, 0xE0, 0x03, 0x0F, 0x40, 0x00, 0x40, 0x13, 0xC0,
+  0x00, 0x40, 0x0F, 0xE0, 0x0B, 0x00, 0xC0, 0x1F, 0xE0, 0x03, 0x00, 0xE0,
+  0x0B, 0x27, 0xE0, 0x53, 0x00, 0xE0, 0x03, 0x7B, 0xE0, 0x07, 0x00, 0xE0,
+  0x17, 0x77, 0xC0, 0x2F, 0xE0, 0x13, 0x27, 0xC0, 0x23, 0xE0, 0x03, 0x00,
+  0xE0, 0x13, 0x2F, 0xE0, 0x3F, 0x00, 0xE0, 0x03, 0x6F, 0xE0, 0x17, 0x00,
+  0xE0, 0x3F, 0x73, 0xE0, 0x07, 0x00, 0xC0, 0x77, 0xE0, 0x07, 0x17, 0xE0,
+  0x07, 0x00, 0xC0, 0x27, 0xC0, 0x00, 0xE0, 0x07, 0x1F, 0xE0, 0x1B, 0x00,
+  0xC0, 0x3B, 0xE0, 0x0F, 0x00, 0xE0, 0x07, 0x43, 0x40, 0x27, 0xE0, 0x07,
+  0x13, 0xE0, 0xD7, 0x00, 0xE0, 0x23, 0xF3, 0x40, 0x2B, 0xE0, 0x13, 0x00,
+  0xE1, 0x07, 0x2B, 0xC0, 0x2B, 0x40, 0x17, 0xC0, 0x0B, 0xC0, 0x00, 0x40,
+  0x13, 0xE0, 0x1B, 0x00, 0xE0, 0x27, 0x2F, 0xE0, 0x37, 0x00, 0xC0, 0x6F,
+  0xE0, 0x03, 0x00, 0xE0, 0x3B, 0x53, 0xE0, 0x03, 0x43, 0xC0, 0x5B, 0xC0,
+  0x13, 0x40, 0x0F, 0xC0, 0x0B, 0xE0, 0x33, 0x00, 0xE0, 0x17, 0x47, 0x40,
+  0x1F, 0xE0, 0x23, 0x00, 0xE0, 0x33, 0x8B, 0xE0, 0x1B, 0x00, 0x40, 0x8B,
+  0xE0, 0x0F, 0x27, 0x40, 0x1B, 0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x27, 0xE0,
+  0x0F, 0x00, 0xE0, 0x03, 0x3B, 0xE0, 0x0F, 0x00, 0xE0, 0x0F, 0x3B, 0xE0,
+  0xFF, 0x10, 0x00, 0xE1, 0x0F, 0x47, 0xC0, 0x00, 0xE1, 0x07, 0x37, 0xC0,
+  0x17, 0xE0, 0x0F, 0x00, 0xE0, 0x03, 0x2F, 0x40, 0x23, 0xE0, 0x03, 0x0F,
+  0x40, 0x00, 0x40, 0x13, 0xE0, 0x07, 0x00, 0x40, 0x17, 0xE0, 0x53, 0x00,
+  0x40, 0x6F, 0xE0, 0x97, 0x5F, 0x40, 0xA3, 0x40, 0x00, 0xE0, 0x07, 0xA7,
+  0x40, 0x13, 0x40, 0x00, 0x40, 0x17, 0xC0, 0x07, 0xC0, 0x00, 0x40, 0x0F,
+  0xE0, 0x23, 0x00, 0xE0, 0x0B, 0x37, 0xC0, 0x13, 0xE0, 0x17, 0x00, 0x40,
+  0x67, 0xE0, 0x03, 0x23, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0,
+  0x17, 0x00, 0x40, 0x2F, 0xE0, 0x0B, 0x00, 0xE0, 0x17, 0x37, 0x40, 0x00,
+  0xC0, 0x37, 0x40, 0x0B, 0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x07, 0x00, 0x40,
+  0x1B, 0xE0, 0xFF, 0x24, 0x00, 0xE1, 0x07, 0x3F, 0xC0, 0x00, 0x41, 0x43,
+  0xE0, 0x03, 0x0B, 0x40, 0x00, 0x40, 0x0F, 0xC0, 0x07, 0xE0, 0x17, 0x00,
+  0x40, 0x27, 0xE0, 0x0B, 0x00, 0xE0, 0x0B, 0x37, 0xE0, 0x0B, 0x27, 0xE0,
+  0x4F, 0x00, 0xC0, 0x7F, 0xE0, 0x3F, 0x5F, 0xC0, 0x4F, 0xE0, 0x03, 0x00,
+  0xE0, 0x0B, 0x5B, 0x40, 0x1F, 0xE0, 0x03, 0x17, 0x40, 0x0F, 0xC0, 0x00,
+  0xE0, 0x03, 0x17, 0xE0, 0x27, 0x00, 0xE0, 0x03, 0x43, 0xC0, 0x0B, 0xE0,
+  0x13, 0x00, 0xE0, 0x27, 0x5F, 0xE0, 0x0F, 0x00, 0xE0, 0x07, 0x63, 0xE0,
+  0x0F, 0x27, 0xE0, 0x0B, 0x00, 0xE0, 0x1B, 0x3B, 0xE0, 0x07, 0x23, 0x40,
+  0x00, 0xE0, 0x07, 0x4B, 0x40, 0x13, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x23,
+  0xE0, 0xFF, 0x1C, 0x00, 0xE1, 0x07, 0x43, 0x40, 0x00, 0x41, 0x37, 0x40,
+  0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xC0, 0x00, 0xE0, 0x03, 0x17, 0xE0,
+  0x0F, 0x00, 0xC0, 0x2B, 0xE0, 0x07, 0x00, 0xE0, 0x0F, 0x2F, 0x40, 0x00,
+  0xE0, 0x07, 0x2B, 0xE0, 0x43, 0x00, 0x40, 0x5F, 0x40, 0x00, 0x40, 0x53,
+  0xC0, 0x07, 0xE0, 0x33, 0x00, 0x40, 0x43, 0xE0, 0x07, 0x00, 0xE0, 0x1F,
+  0x4F, 0xE0, 0x2F, 0x37, 0x40, 0x00, 0x40, 0x3B, 0x40, 0x07, 0xE0, 0x13,
+  0x00, 0x40, 0x23, 0xC0, 0x00, 0xE0, 0x13, 0x27, 0xE0, 0x33, 0x00, 0xC0,
+  0x5F, 0xC0, 0x00, 0xE0, 0x1F, 0x4B, 0xC0, 0x2F, 0x40, 0x00, 0x40, 0x33,
+  0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x2B, 0x00, 0xE0, 0x33, 0x3B,
+  0xE0, 0x8F, 0x00, 0xE0, 0x63, 0xD3, 0x40, 0x6B, 0xE0, 0x1F, 0x00, 0x41,
+  0x2F, 0xE0, 0x23, 0x2B, 0xE0, 0x03, 0x00, 0xE0, 0x13, 0x37, 0xE0, 0x03,
+  0x27, 0xE0, 0x03, 0x00, 0x40, 0x33, 0xE0, 0x03, 0x0F, 0xE0, 0x87, 0x00,
+  0x40, 0x9F, 0xC0, 0x00, 0xE0, 0x23, 0x9B, 0x40, 0x33, 0xE0, 0x23, 0x2F,
+  0xE0, 0x27, 0x00, 0xC0, 0x5F, 0xC0, 0x07, 0xE0, 0x4F, 0x00, 0x40, 0x5F,
+  0xC0, 0x00, 0xE0, 0x17, 0x63, 0xC0, 0x27, 0xC0, 0x00, 0xC0, 0x2F, 0xC0,
+  0x0F, 0x40, 0x00, 0xC0, 0x13, 0xE0, 0x07, 0x00, 0x40, 0x1B, 0xC0, 0x00,
+  0xE0, 0x07, 0x1B, 0xE0, 0xAF, 0x00, 0x40, 0xCF, 0xE0, 0x03, 0xBB, 0x40,
+  0x0F, 0x40, 0x00, 0x40, 0x13, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0,
+  0x3B, 0x00, 0xE0, 0x07, 0x4B, 0x40, 0x0F, 0xC0, 0x00, 0x40, 0x5F, 0xC0,
+  0x0B, 0xE0, 0x2F, 0x00, 0x40, 0x43, 0x40, 0x00, 0xE0, 0x03, 0x3F, 0x40,
+  0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x1B, 0xE0, 0x03, 0x00, 0xE0, 0x03,
+  0x23, 0xE0, 0x07, 0x00, 0xC0, 0x27, 0xE0, 0x07, 0x17, 0xE0, 0x6F, 0x00,
+  0x40, 0x8F, 0xE0, 0x03, 0x7B, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x03, 0x13,
+  0xE0, 0x87, 0x00, 0xE0, 0x57, 0x9F, 0x40, 0x5F, 0x40, 0x00, 0xE0, 0x17,
+  0xF7, 0x40, 0x23, 0xC0, 0x00, 0xE0, 0x03, 0x2B, 0xC0, 0x13, 0xC0, 0x00,
+  0xE0, 0x03, 0x1B, 0x40, 0x00, 0xC0, 0x17, 0xC0, 0x00, 0x40, 0x13, 0xE0,
+  0xC7, 0x00, 0xC0, 0xDB, 0xE0, 0x07, 0x00, 0xE0, 0x3B, 0xE7, 0xC0, 0x53,
+  0xE0, 0x03, 0x4B, 0xE0, 0x03, 0x13, 0xC0, 0x0B, 0xE0, 0x2F, 0x00, 0xE0,
+  0x03, 0x57, 0x40, 0x00, 0xC0, 0x47, 0x40, 0x0B, 0xC0, 0x00, 0xC0, 0x13,
+  0xE0, 0x13, 0x00, 0xC0, 0x2B, 0x40, 0x00, 0x40, 0x27, 0x40, 0x07, 0xE0,
+  0x83, 0x00, 0x40, 0x93, 0xC0, 0x00, 0xC0, 0x97, 0x40, 0x0F, 0xC0, 0x0B,
+  0xE0, 0xAB, 0x00, 0xE0, 0x73, 0xBF, 0x40, 0x7B, 0xE0, 0x03, 0x00, 0xC1,
+  0x3F, 0xE0, 0x07, 0x13, 0xC0, 0x0F, 0x40, 0x1F, 0x40, 0x0B, 0x40, 0x07,
+  0xE0, 0x03, 0x00, 0xE0, 0x0B, 0x13, 0xE0, 0xB3, 0x00, 0x40, 0xCF, 0x40,
+  0x00, 0xE0, 0x3F, 0xC3, 0x40, 0x4B, 0x40, 0x00, 0xE0, 0x03, 0x4F, 0x40,
+  0x0F, 0xE0, 0x3B, 0x00, 0xE0, 0x03, 0x53, 0xE0, 0x03, 0x00, 0xC0, 0x5B,
+  0xC0, 0x13, 0xC0, 0x0F, 0xE0, 0x13, 0x00, 0xC0, 0x2B, 0x40, 0x00, 0x40,
+  0x27, 0x40, 0x07, 0xE0, 0xFF, 0x10, 0x00, 0xE1, 0x43, 0x1F, 0xE0, 0x43,
+  0x4B, 0xE0, 0x1F, 0x00, 0x40, 0x73, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x3B,
+  0x40, 0x1B, 0xC0, 0x0F, 0x40, 0x0B, 0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x03,
+  0x00, 0x40, 0x17, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0xBB, 0x00, 0xE0,
+  0x3F, 0xD3, 0x40, 0x47, 0xE0, 0x03, 0x00, 0x41, 0x1B, 0xE0, 0x03, 0x0F,
+  0x40, 0x00, 0x40, 0x13, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x27, 0x00, 0x40,
+  0x37, 0xE0, 0x03, 0x00, 0xC0, 0x3F, 0xE0, 0x03, 0x13, 0xC0, 0x00, 0xC0,
+  0x1B, 0xE0, 0x1F, 0x00, 0xC0, 0x37, 0xE0, 0x03, 0x00, 0x40, 0x3B, 0xE0,
+  0x03, 0x0F, 0xE0, 0xEF, 0x00, 0xE1, 0xAF, 0x07, 0x40, 0xB7, 0xE0, 0x13,
+  0x00, 0xE1, 0x23, 0xCF, 0xE0, 0x0B, 0x47, 0xE0, 0x23, 0x3F, 0xE0, 0x57,
+  0x00, 0x40, 0x9F, 0x40, 0x63, 0xC0, 0x07, 0xE0, 0x7F, 0x00, 0x40, 0x8F,
+  0xE0, 0x07, 0x00, 0x40, 0x9B, 0xE0, 0x1B, 0x13, 0xE0, 0x03, 0x00, 0x40,
+  0x33, 0xE0, 0x07, 0x00, 0xC0, 0x1F, 0xE0, 0x07, 0x17, 0xE0, 0x0F, 0x00,
+  0xC0, 0x2F, 0xE0, 0x07, 0x00, 0xE0, 0x0F, 0x2F, 0xE0, 0xFF, 0x00, 0x00,
+  0x41, 0x2F, 0xE1, 0x37, 0x0B, 0x40, 0x43, 0x40, 0x00, 0x40, 0x47, 0x40,
+  0x07, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x4F, 0x00, 0x40, 0x63, 0x40, 0x5B,
+  0x40, 0x07, 0x40, 0x00, 0xC0, 0x0B, 0x40, 0x07, 0xE0, 0x0B, 0x00, 0xC0,
+  0x23, 0xE0, 0x0B, 0x00, 0x40, 0x1B, 0xE0, 0x07, 0x00, 0xE0, 0x0B, 0x27,
+  0xE0, 0xFB, 0x00, 0x41, 0x27, 0x41, 0x07, 0x40, 0x07, 0xE0, 0x07, 0x00,
+  0x40, 0x17, 0xC0, 0x00, 0xE0, 0x0B, 0x1B, 0x40, 0x13, 0xC0, 0x1F, 0x40,
+  0x00, 0x40, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xC0, 0x00, 0xC0, 0x17,
+  0xC0, 0x0F, 0xC0, 0x00, 0xC0, 0x17, 0x40, 0x00, 0xC0, 0x13, 0xE0, 0x07,
+  0x00, 0x40, 0x1B, 0xC0, 0x00, 0x40, 0x1B, 0xE0, 0x03, 0x0B, 0xE0, 0xA7,
+  0x00, 0xE0, 0x47, 0xBB, 0xE0, 0x03, 0x4F, 0xE0, 0x03, 0x0B, 0xE0, 0x37,
+  0x00, 0xC0, 0x4B, 0x40, 0x00, 0xE0, 0x37, 0x4B, 0xE0, 0x0B, 0x00, 0xE0,
+  0x03, 0x57, 0x40, 0x0B, 0x40, 0x00, 0xC0, 0x27, 0xE0, 0x03, 0x0B, 0xE0,
+  0x13, 0x00, 0xE0, 0x13, 0x27, 0x40, 0x1B, 0xE0, 0x0B, 0x00, 0xE0, 0x13,
+  0x4F, 0xE0, 0x9B, 0x00, 0x40, 0xD3, 0xE0, 0x4B, 0xA7, 0x40, 0x57, 0x40,
+  0x00, 0xC0, 0x5B, 0xE0, 0x03, 0x0B, 0x40, 0x00, 0x40, 0x0F, 0xE0, 0x0B,
+  0x00, 0x40, 0x1B, 0xC0, 0x00, 0xE0, 0x07, 0x1F, 0xC0, 0x17, 0x40, 0x00,
+  0xE0, 0x0F, 0x1B, 0xE0, 0x0F, 0x17, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x27,
+  0x40, 0x00, 0xE0, 0x07, 0x23, 0xE0, 0x0B, 0x00, 0xE0, 0x1F, 0x27, 0xE0,
+  0x57, 0x00, 0xE0, 0x03, 0x87, 0xE0, 0x03, 0x0B, 0xE0, 0x37, 0x00, 0xE0,
+  0x03, 0x4B, 0x40, 0x0B, 0xC0, 0x00, 0xC0, 0x57, 0xE0, 0x07, 0x0F, 0xE0,
+  0x1F, 0x00, 0xE0, 0x2F, 0x37, 0xE0, 0x1B, 0x00, 0xE0, 0x3F, 0x5B, 0xE0,
+  0x0F, 0x47, 0xC0, 0x17, 0x40, 0x00, 0x40, 0x8F, 0x40, 0x07, 0xE0, 0x03,
+  0x00, 0x40, 0x13, 0xE0, 0xAF, 0x00, 0x40, 0xC7, 0xE0, 0x5B, 0xBB, 0xE0,
+  0x03, 0x67, 0x40, 0x0B, 0xE0, 0x0F, 0x00, 0xC0, 0x8B, 0x40, 0x1F, 0xC0,
+  0x0B, 0xE0, 0x13, 0x00, 0xE0, 0x0F, 0x27, 0xE0, 0x07, 0x17, 0xE0, 0x03,
+  0x0F, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0x5B, 0xE0, 0x03, 0x0B, 0xE0, 0xF7,
+  0x00, 0x41, 0x0B, 0x41, 0x03, 0x40, 0x07, 0x40, 0x00, 0xE0, 0x1F, 0x0B,
+  0x40, 0x00, 0x40, 0x2F, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x97, 0x00, 0xE0,
+  0x07, 0xA7, 0x40, 0x0F, 0xC0, 0x00, 0x40, 0xBB, 0xE0, 0x07, 0x0B, 0x40,
+  0x13, 0xE0, 0x03, 0x00, 0xC0, 0x1F, 0x40, 0x00, 0xE0, 0x03, 0x17, 0xE0,
+  0xFF, 0x1C, 0x00, 0x41, 0x33, 0xE0, 0x03, 0x00, 0xE1, 0x07, 0x33, 0xC0,
+  0x1B, 0xE0, 0x07, 0x17, 0xE0, 0x0B, 0x00, 0x40, 0x2B, 0xC0, 0x17, 0xE0,
+  0x03, 0x0B, 0xE0, 0x07, 0x00, 0x40, 0x1B, 0xE0, 0x13, 0x00, 0xE0, 0x07,
+  0x2F, 0xE0, 0xF7, 0x00, 0xE1, 0x0B, 0x2B, 0x41, 0x13, 0x40, 0x17, 0x40,
+  0x07, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x0F, 0x00, 0xC0, 0x23, 0xE0, 0x8B,
+  0x00, 0x40, 0xB3, 0xE0, 0x03, 0x97, 0x40, 0x0F, 0x40, 0x00, 0x40, 0x13,
+  0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x0F, 0x00, 0xE0, 0x17, 0x1F,
+  0x40, 0x00, 0x40, 0x23, 0xC0, 0x00, 0x40, 0x0F, 0x40, 0x00, 0x40, 0x0F,
+  0x40, 0x07, 0xE0, 0x77, 0x00, 0x40, 0x87, 0x40, 0x00, 0xE0, 0x67, 0x87,
+  0x40, 0x73, 0x40, 0x00, 0x40, 0x77, 0x40, 0x07, 0xE0, 0x07, 0x00, 0x40,
+  0x17, 0x40, 0x00, 0x40, 0x17, 0x40, 0x07, 0xE0, 0x47, 0x00, 0x40, 0x57,
+  0xE0, 0x0B, 0x00, 0xE0, 0x47, 0x67, 0xE0, 0xB7, 0x00, 0xE1, 0x0B, 0x23,
+  0xE0, 0x03, 0x00, 0x40, 0xDF, 0xE0, 0x13, 0x0F, 0x40, 0x00, 0x40, 0x23,
+  0xE0, 0x37, 0x00, 0xE0, 0x3F, 0x47, 0xE0, 0x13, 0x00, 0x40, 0x63, 0x40,
+  0x00, 0x40, 0x23, 0x40, 0x07, 0x40, 0x00, 0xC0, 0x0B, 0x40, 0x07, 0xE0,
+  0x03, 0x00, 0xC0, 0x1B, 0xE0, 0x0B, 0x00, 0xE0, 0x0F, 0x1B, 0x40, 0x17,
+  0x40, 0x00, 0xE0, 0x0B, 0x33, 0xE0, 0x6F, 0x00, 0x40, 0x8F, 0xC0, 0x00,
+  0xE0, 0x63, 0x83, 0x40, 0x73, 0xC0, 0x6F, 0x40, 0x0B, 0xE0, 0x13, 0x00,
+  0xC0, 0x27, 0xC0, 0x00, 0x40, 0x2B, 0xC0, 0x0B, 0xE0, 0x3B, 0x00, 0x40,
+  0x4F, 0x40, 0x00, 0xE0, 0x0B, 0x4B, 0xE0, 0x0F, 0x17, 0xE0, 0xB3, 0x00,
+  0xE0, 0x0F, 0xD3, 0x40, 0x17, 0x40, 0x00, 0xE0, 0x03, 0xDB, 0x40, 0x0F,
+  0xE0, 0x3B, 0x00, 0xE0, 0x03, 0x53, 0xE0, 0x37, 0x00, 0x40, 0x8F, 0xE0,
+  0x0B, 0x43, 0x40, 0x17, 0x40, 0x00, 0xE0, 0x0B, 0x1B, 0xE0, 0x27, 0x00,
+  0x40, 0x47, 0x40, 0x00, 0x40, 0x37, 0x40, 0x07, 0xC0, 0x00, 0x40, 0x0F,
+  0x40, 0x00, 0x40, 0x0F, 0x40, 0x07, 0xE0, 0x0B, 0x00, 0x40, 0x1B, 0x40,
+  0x00, 0xE0, 0x0F, 0x1B, 0xE0, 0x0B, 0x17, 0xE0, 0x73, 0x00, 0xE0, 0x03,
+  0xAB, 0xC0, 0x0B, 0xC0, 0x07, 0xE0, 0x63, 0x00, 0x40, 0x73, 0xC0, 0x00,
+  0xE0, 0x0F, 0x77, 0xE0, 0x17, 0x1F, 0xE0, 0x0F, 0x00, 0x40, 0x37, 0xE0,
+  0x0B, 0x1B, 0x40, 0x17, 0xC0, 0x00, 0xE0, 0x0F, 0x1F, 0xE0, 0x0B, 0x17,
+  0xE0, 0xCF, 0x00, 0x41, 0x0B, 0xE0, 0x03, 0xDB, 0x40, 0x0F, 0xE0, 0x3B,
+  0x00, 0xE0, 0x03, 0x53, 0xE0, 0x0B, 0x00, 0x40, 0x63, 0xE0, 0x03, 0x17,
+  0xE0, 0x07, 0x0F, 0xE0, 0x53, 0x00, 0xE0, 0x0F, 0x6B, 0x40, 0x17, 0xE0,
+  0x13, 0x00, 0xE0, 0x0F, 0x93, 0xC0, 0x33, 0x40, 0x1F, 0xE0, 0x03, 0x0B,
+  0xC0, 0x00, 0x40, 0x13, 0xC0, 0x0B, 0xE0, 0x6F, 0x00, 0xE0, 0x03, 0x83,
+  0x40, 0x0B, 0xE0, 0x0B, 0x00, 0xE0, 0x63, 0x9B, 0xE0, 0x07, 0x7F, 0xE0,
+  0x4B, 0x7B, 0x40, 0x63, 0x40, 0x57, 0xC0, 0x07, 0x40, 0x00, 0x40, 0x0B,
+  0x40, 0x00, 0x40, 0x0B, 0xE0, 0xFF, 0x0C, 0x00, 0x41, 0x1B, 0xE0, 0x1B,
+  0x00, 0xC1, 0x3B, 0xE0, 0x17, 0x2B, 0xC0, 0x27, 0xE0, 0x17, 0x00, 0xC0,
+  0x47, 0xE0, 0x17, 0x27, 0xE0, 0x37, 0x00, 0x40, 0x67, 0xE0, 0x13, 0x43,
+  0xE0, 0x03, 0x1F, 0x40, 0x0B, 0x40, 0x00, 0xE0, 0x13, 0x2F, 0x40, 0x00,
+  0x40, 0x23, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x97, 0x00, 0xC0, 0xAB, 0x40,
+  0x00, 0xE0, 0x27, 0xAB, 0xE0, 0x2B, 0x33, 0xE0, 0x03, 0x00, 0xC0, 0x3F,
+  0x40, 0x07, 0x40, 0x00, 0xE0, 0x03, 0x1B, 0xE0, 0x3B, 0x00, 0x40, 0x53,
+  0xE0, 0x0B, 0x00, 0xE0, 0x3B, 0x5B, 0xE0, 0xCF, 0x00, 0xE1, 0x0B, 0x2F,
+  0xE0, 0x17, 0x00, 0xE1, 0x07, 0x0B, 0xE0, 0x0B, 0x2F, 0xE0, 0x07, 0x23,
+  0xE0, 0x7B, 0x00, 0x40, 0xA7, 0xC0, 0x87, 0x40, 0x0B, 0xE0, 0x03, 0x00,
+  0xC0, 0x17, 0xC0, 0x00, 0xC0, 0x1B, 0xC0, 0x0F, 0xE0, 0x13, 0x00, 0xE0,
+  0x0B, 0x2B, 0x40, 0x13, 0xE0, 0x13, 0x33, 0xE0, 0x8F, 0x00, 0xE0, 0x0B,
+  0xB7, 0x40, 0x13, 0xE0, 0x03, 0x00, 0xE0, 0x2F, 0xBB, 0xE0, 0x03, 0x43,
+  0x40, 0x00, 0xE0, 0x1B, 0x47, 0xC0, 0x27, 0xC0, 0x07, 0xE0, 0x13, 0x00,
+  0x40, 0x23, 0xE0, 0x07, 0x00, 0x40, 0x2F, 0xC0, 0x13, 0x40, 0x0B, 0xE0,
+  0xFB, 0x00, 0xC1, 0x0F, 0xE0, 0x0F, 0x00, 0xC1, 0x23, 0x40, 0x1F, 0x40,
+  0x0B, 0x40, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x0B, 0x00, 0xE0,
+  0x1B, 0x23, 0xE0, 0x73, 0x00, 0x40, 0x9F, 0xE0, 0x0B, 0x7F, 0xE0, 0x07,
+  0x17, 0x40, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x33, 0xE0, 0x07, 0x0F, 0xE0,
+  0x0B, 0x00, 0x40, 0x23, 0xC0, 0x17, 0xE0, 0x03, 0x0B, 0xE0, 0x73, 0x00,
+  0x40, 0x87, 0x40, 0x00, 0xE0, 0x07, 0x83, 0x40, 0x13, 0x40, 0x00, 0xE0,
+  0x07, 0x17, 0x40, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x3B, 0x00, 0xE0, 0x53,
+  0x5B, 0xE0, 0x03, 0x00, 0x40, 0x67, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x1B,
+  0xE0, 0xF7, 0x00, 0xE1, 0x03, 0x17, 0xE0, 0x03, 0x00, 0x41, 0x17, 0x40,
+  0x0F, 0xC0, 0x07, 0xE0, 0x13, 0x00, 0x40, 0x23, 0xE0, 0x07, 0x00, 0xE0,
+  0x03, 0x2F, 0xE0, 0x03, 0x1B, 0x40, 0x17, 0xE0, 0x03, 0x0F, 0xE0, 0x87,
+  0x00, 0x40, 0x9F, 0xE0, 0x47, 0x00, 0xE0, 0x7B, 0xE3, 0xE0, 0x1B, 0xD3,
+  0xC0, 0xA7, 0xC0, 0x2B, 0x40, 0x0F, 0xE0, 0x03, 0x0B, 0xE0, 0xB3, 0x00,
+  0xC0, 0xC7, 0x40, 0x00, 0xE0, 0x8B, 0xC7, 0xE0, 0x63, 0x97, 0xE0, 0x03,
+  0x6B, 0x40, 0x0B, 0xE0, 0x07, 0x00, 0xE1, 0x03, 0x1F, 0xE0, 0x03, 0x1B,
+  0x40, 0x17, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x00, 0xE0, 0x03, 0x0B, 0xE0,
+  0x03, 0x00, 0x40, 0x17, 0x40, 0x00, 0x40, 0x13, 0x40, 0x07, 0x40, 0x00,
+  0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x1F,
+  0x00, 0x40, 0x2F, 0x40, 0x00, 0xE0, 0x07, 0x2F, 0xE0, 0x0B, 0x13, 0xE0,
+  0x17, 0x00, 0xE0, 0x17, 0x33, 0x40, 0x1F, 0x40, 0x00, 0xC0, 0x47, 0x40,
+  0x0B, 0xE0, 0x0B, 0x00, 0x40, 0x1F, 0xE0, 0x03, 0x17, 0xE0, 0x07, 0x0F,
+  0xE0, 0x0B, 0x00, 0x40, 0x23, 0xE0, 0x6B, 0x00, 0xE0, 0x0B, 0x8B, 0xE0,
+  0x03, 0x00, 0xE0, 0x07, 0x93, 0xE0, 0x03, 0x1B, 0xC0, 0x00, 0xE0, 0x07,
+  0x23, 0xE0, 0xAF, 0x00, 0x40, 0xCF, 0xE0, 0x63, 0xBB, 0xE0, 0x1F, 0x6F,
+  0xE0, 0x1F, 0x27, 0xE0, 0x37, 0x00, 0xE0, 0x03, 0x67, 0x40, 0x0B, 0xE0,
+  0x07, 0x00, 0x40, 0x5F, 0xE0, 0x03, 0x13, 0x40, 0x0F, 0xE0, 0x3B, 0x00,
+  0xE0, 0x03, 0x53, 0x40, 0x00, 0xC0, 0x53, 0xC0, 0x0B, 0xC0, 0x07, 0xE0,
+  0x4B, 0x00, 0x40, 0x5B, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x67, 0xE0, 0x23,
+  0x1F, 0xC0, 0x3B, 0xC0, 0x33, 0x40, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x40,
+  0x13, 0x40, 0x00, 0xE0, 0x07, 0x0F, 0xE0, 0x5F, 0x00, 0xC0, 0x77, 0xE0,
+  0x03, 0x00, 0x40, 0x7B, 0x40, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x40, 0x0F,
+  0xE0, 0x07, 0x00, 0xC0, 0x1B, 0x40, 0x00, 0xE0, 0x07, 0x1B, 0xE0, 0x8B,
+  0x00, 0xE0, 0x0F, 0xA7, 0x40, 0x17, 0x40, 0x00, 0xC0, 0xB3, 0xE0, 0x03,
+  0x0B, 0xE0, 0x47, 0x00, 0x40, 0x5B, 0x40, 0x00, 0xE0, 0x2B, 0x57, 0x40,
+  0x37, 0x40, 0x00, 0xE0, 0x2B, 0x3B, 0xE0, 0x23, 0x00, 0xE0, 0x03, 0x63,
+  0x40, 0x0B, 0xE0, 0x1B, 0x00, 0xE0, 0x23, 0x5F, 0xE0, 0x0F, 0x00, 0xE0,
+  0x13, 0x67, 0xE0, 0x0F, 0x33, 0xE0, 0x43, 0x00, 0xE0, 0x0B, 0x7F, 0xC0,
+  0x5F, 0xE0, 0x13, 0x1B, 0x40, 0x00, 0xE0, 0x2F, 0x1F, 0xE0, 0x03, 0x37,
+  0x40, 0x47, 0xE0, 0x63, 0x00, 0x40, 0x7B, 0x40, 0x6F, 0x40, 0x07, 0x40,
+  0x00, 0xE0, 0x07, 0x0B, 0x40, 0x00, 0xC0, 0x17, 0xE0, 0x07, 0x00, 0x40,
+  0x17, 0xC0, 0x00, 0xE0, 0x07, 0x1B, 0xE0, 0x17, 0x00, 0x40, 0x37, 0xE0,
+  0x17, 0x23, 0xE0, 0x5B, 0x00, 0x40, 0x87, 0xE0, 0x03, 0x00, 0x40, 0x73,
+  0xE0, 0x07, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0xE0, 0x03, 0x0F, 0xE0,
+  0x67, 0x00, 0x40, 0x7F, 0x40, 0x00, 0xC0, 0x77, 0xE0, 0x03, 0x0B, 0xE0,
+  0x4F, 0x00, 0x40, 0x63, 0xE0, 0x1B, 0x00, 0xE0, 0x3B, 0x7F, 0xE0, 0x07,
+  0x67, 0x40, 0x53, 0xE0, 0x03, 0x13, 0x40, 0x0F, 0xE0, 0x03, 0x00, 0xC0,
+  0x1B, 0xE0, 0x03, 0x13, 0xE0, 0x37, 0x00, 0xC0, 0x53, 0xC0, 0x00, 0xC0,
+  0x4F, 0xC0, 0x0F, 0xE0, 0x03, 0x00, 0xC0, 0x1B, 0x40, 0x00, 0xE0, 0x03,
+  0x17, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0x40, 0x00, 0x40, 0x13, 0x40, 0x07,
+  0xE0, 0x07, 0x00, 0x40, 0x17, 0x40, 0x00, 0xE0, 0x07, 0x17, 0xE0, 0x63,
+  0x00, 0x40, 0x7F, 0x40, 0x00, 0xC0, 0x73, 0x40, 0x0B, 0x40, 0x00, 0x40,
+  0x0F, 0x40, 0x07, 0x40, 0x00, 0xC0, 0x0B, 0xC0, 0x07, 0xC0, 0x00, 0x40,
+  0x0F, 0xE0, 0x33, 0x00, 0xE0, 0x2F, 0x47, 0x40, 0x37, 0xE0, 0x03, 0x77,
+  0x40, 0x0F, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x13, 0x00, 0x40, 0x2B,
+  0xE0, 0x17, 0x00, 0x40, 0x3F, 0xE0, 0x07, 0x23, 0x40, 0x13, 0xE0, 0x6F,
+  0x00, 0xE0, 0x07, 0x8B, 0x40, 0x00, 0xE0, 0x5B, 0x8B, 0x40, 0x67, 0xE0,
+  0x13, 0x00, 0xE0, 0x3F, 0x83, 0xE0, 0x07, 0x63, 0xE0, 0x03, 0x57, 0xE0,
+  0x07, 0x1B, 0xE0, 0x03, 0x00, 0x40, 0x27, 0x40, 0x0F, 0x40, 0x07, 0xE0,
+  0x2B, 0x00, 0x40, 0x3B, 0xE0, 0x03, 0x00, 0x40, 0x43, 0xE0, 0x03, 0x0F,
+  0xC0, 0x00, 0x40, 0x17, 0x40, 0x00, 0x40, 0x0F, 0x40, 0x07, 0xE0, 0x47,
+  0x00, 0xE0, 0x4F, 0x57, 0xE0, 0x13, 0x00, 0x40, 0x73, 0xC0, 0x00, 0xE0,
+  0x13, 0x27, 0x40, 0x00, 0x40, 0x27, 0xC0, 0x07, 0xE0, 0x03, 0x00, 0x40,
+  0x13, 0xE0, 0x0F, 0x00, 0xC0, 0x27, 0xE0, 0x0F, 0x1F, 0xE0, 0x23, 0x00,
+  0x40, 0x4B, 0xE0, 0x03, 0x2F, 0x40, 0x0F, 0x40, 0x00, 0xC0, 0x13, 0xE0,
+  0x03, 0x0B, 0xE0, 0x13, 0x00, 0x40, 0x27, 0x40, 0x00, 0x40, 0x23, 0x40,
+  0x07, 0xE0, 0x23, 0x00, 0x40, 0x33, 0xE0, 0xAF, 0x00, 0x40, 0xE7, 0xE0,
+  0x33, 0xBB, 0x40, 0x3F, 0xE0, 0x0B, 0x00, 0xE0, 0x33, 0x53, 0x40, 0x00,
+  0x40, 0x53, 0xC0, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x0F, 0x00,
+  0xE0, 0x1F, 0x27, 0xE0, 0x13, 0x00, 0x40, 0x43, 0x40, 0x1F, 0xE0, 0x03,
+  0x07, 0x40, 0x00, 0xC0, 0x13, 0xE0, 0x07, 0x00, 0x40, 0x17, 0xE0, 0x03,
+  0x00, 0xE0, 0x03, 0x1F, 0xE0, 0x03, 0x17, 0xE0, 0x2F, 0x00, 0x40, 0x4F,
+  0xE0, 0x2F, 0x3B, 0xE0, 0x23, 0x00, 0x40, 0x67, 0x40, 0x00, 0x40, 0x33,
+  0x40, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x1F, 0x00, 0xE0, 0x1B,
+  0x37, 0xC0, 0x23, 0xE0, 0x1F, 0x53, 0xE0, 0x0F, 0x00, 0xE0, 0x0B, 0x47,
+  0xC0, 0x13, 0x40, 0x00, 0xE0, 0x0F, 0x37, 0xE0, 0x07, 0x00, 0x40, 0x2B,
+  0x40, 0x00, 0xE0, 0x07, 0x17, 0x40, 0x00, 0x40, 0x17, 0xC0, 0x00, 0xE0,
+  0x07, 0x0F, 0x40, 0x00, 0x40, 0x13, 0xE0, 0x67, 0x00, 0xC0, 0x77, 0xC0,
+  0x07, 0xE0, 0x2F, 0x00, 0x40, 0x3F, 0x40, 0x00, 0xE0, 0x2F, 0x3F, 0x40,
+  0x00, 0x40, 0x3F, 0xE0, 0x0B, 0x00, 0x40, 0x1B, 0xE0, 0x2B, 0x00, 0xE0,
+  0x07, 0x4B, 0x40, 0x43, 0xE0, 0x0B, 0x13, 0xE0, 0x13, 0x00, 0xE0, 0x03,
+  0x2F, 0xE0, 0x13, 0x27, 0xE0, 0x1B, 0x00, 0xC0, 0x4B, 0x40, 0x2B, 0xC0,
+  0x0B, 0xC0, 0x00, 0x40, 0x13, 0xE0, 0x07, 0x00, 0xC0, 0x1B, 0x40, 0x00,
+  0xE0, 0x07, 0x1B, 0xE0, 0x2B, 0x00, 0xE0, 0x3F, 0x47, 0xE0, 0x27, 0x00,
+  0x40, 0x77, 0xC0, 0x00, 0xE0, 0x03, 0x3B, 0x40, 0x13, 0xE0, 0x03, 0x0F,
+  0xE0, 0x07, 0x00, 0x40, 0x1F, 0xC0, 0x00, 0xE0, 0x07, 0x1B, 0xC0, 0x00,
+  0xE0, 0x1B, 0x1F, 0xC0, 0x2B, 0xE0, 0x77, 0x00, 0x40, 0xAB, 0xE0, 0x07,
+  0x83, 0x40, 0x13, 0xC0, 0x00, 0xE0, 0x07, 0x1B, 0xE0, 0x1F, 0x00, 0x40,
+  0x3F, 0xE0, 0x1F, 0x2B, 0xE0, 0x43, 0x00, 0x40, 0x77, 0xE0, 0x07, 0x00,
+  0xE0, 0x33, 0x5F, 0xC0, 0x4B, 0xE0, 0x33, 0x43, 0xE0, 0x03, 0x00, 0xC0,
+  0x4F, 0x40, 0x00, 0xE0, 0x03, 0x17, 0xE0, 0x27, 0x00, 0x40, 0x3F, 0x40,
+  0x00, 0xE0, 0x27, 0x37, 0xE0, 0x07, 0x00, 0x40, 0x43, 0xE0, 0x0F, 0x00,
+  0x40, 0x2B, 0xC0, 0x1B, 0xE0, 0x03, 0x0B, 0xE0, 0x07, 0x00, 0x40, 0x1B,
+  0xE0, 0xAF, 0x00, 0xE0, 0x07, 0xCB, 0x40, 0x00, 0xE0, 0x13, 0xCB, 0xC0,
+  0x1F, 0x40, 0x07, 0x40, 0x00, 0xE0, 0x03, 0x2B, 0x40, 0x0F, 0xE0, 0x07,
+  0x00, 0xE0, 0x03, 0x1F, 0xE0, 0x5F, 0x00, 0xC0, 0x83, 0xE0, 0x5F, 0x6F,
+  0xE0, 0x07, 0x00, 0xC0, 0x7F, 0x40, 0x00, 0xE0, 0x07, 0x1B, 0xE0, 0x5B,
+  0x00, 0x40, 0x77, 0xE0, 0x07, 0x00, 0xE0, 0x2B, 0x77, 0xE0, 0x03, 0x43,
+  0xE0, 0x2B, 0x3F, 0xE0, 0x37, 0x00, 0xC0, 0x7F, 0x40, 0x47, 0xC0, 0x0B,
+  0xE0, 0x03, 0x00, 0x40, 0x17, 0xC0, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x17,
+  0x00, 0xE0, 0x03, 0x37, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x3B, 0xE0, 0x07,
+  0x1F, 0xC0, 0x00, 0xE0, 0x07, 0x27, 0xE0, 0x93, 0x00, 0x40, 0xB3, 0x40,
+  0x9F, 0x40, 0x07, 0xE0, 0x0F, 0x00, 0x40, 0x1F, 0xE0, 0x1B, 0x00, 0xC0,
+  0x3F, 0xC0, 0x2B, 0xC0, 0x0F, 0xC0, 0x00, 0xC0, 0x17, 0xE0, 0x03, 0x00,
+  0x40, 0x1B, 0xE0, 0x03, 0x0F, 0xE0, 0x3F, 0x00, 0xE0, 0x0F, 0x57, 0xE0,
+  0x0F, 0x17, 0xE0, 0x57, 0x00, 0x40, 0x77, 0x40, 0x00, 0xE0, 0x2F, 0x67,
+  0xE0, 0x37, 0x3B, 0xE0, 0x13, 0x00, 0xE0, 0x1F, 0x93, 0xE0, 0x03, 0x43,
+  0xE0, 0x1F, 0x33, 0xE0, 0x57, 0x00, 0xE0, 0x03, 0x93, 0xE0, 0x0B, 0x00,
+  0xE0, 0x2F, 0x7F, 0xE0, 0x03, 0x4B, 0xE0, 0x0F, 0x43, 0xE0, 0x03, 0x23,
+  0x40, 0x00, 0xE0, 0x0F, 0x27, 0xE0, 0x4B, 0x00, 0xE0, 0x3B, 0x6F, 0x40,
+  0x43, 0xE0, 0x1B, 0x00, 0xE0, 0x23, 0xBF, 0xE0, 0x0F, 0x4F, 0xE0, 0x23,
+  0x43, 0xE0, 0x03, 0x00, 0xC0, 0x4F, 0xE0, 0x03, 0x13, 0xE0, 0x17, 0x00,
+  0xE0, 0x2B, 0x33, 0xE0, 0x1F, 0x00, 0x40, 0x5B, 0xE0, 0x1F, 0x2B, 0xE0,
+  0x03, 0x00, 0x40, 0x37, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x13, 0x00,
+  0xE0, 0x03, 0x2B, 0x40, 0x0B, 0x40, 0x00, 0xE0, 0x13, 0x2F, 0xE0, 0x13,
+  0x00, 0x40, 0x3B, 0xE0, 0x0B, 0x00, 0x40, 0x33, 0xC0, 0x17, 0x40, 0x0B,
+  0x40, 0x00, 0xE0, 0x07, 0x0F, 0xE0, 0x07, 0x00, 0x40, 0x1F, 0xE0, 0x07,
+  0x13, 0xE0, 0x37, 0x00, 0x40, 0x53, 0x40, 0x00, 0xE0, 0x33, 0x47, 0x40,
+  0x3F, 0xE0, 0x0F, 0x00, 0xE0, 0x2B, 0x57, 0xE0, 0x0F, 0x4B, 0xE0, 0x07,
+  0x00, 0xE0, 0x2B, 0x5B, 0xE0, 0x07, 0x00, 0x40, 0x53, 0xE0, 0x07, 0x13,
+  0xE0, 0x6B, 0x00, 0x40, 0x87, 0xE0, 0x0B, 0x00, 0xE0, 0x2B, 0x8B, 0x40,
+  0x47, 0xC0, 0x37, 0x40, 0x0B, 0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x3B, 0x00,
+  0xE0, 0x47, 0x4F, 0xE0, 0x1F, 0x00, 0x40, 0x77, 0xC0, 0x00, 0xE0, 0x57,
+  0x33, 0xE0, 0x03, 0x5F, 0x40, 0x73, 0xE0, 0x03, 0x0F, 0xE0, 0x1B, 0x00,
+  0x40, 0x33, 0xC0, 0x00, 0x40, 0x2F, 0xC0, 0x0B, 0xC0, 0x00, 0xC0, 0x13,
+  0x40, 0x07, 0xC0, 0x00, 0x40, 0x1B, 0xC0, 0x0B, 0xE0, 0x5F, 0x00, 0x40,
+  0x73, 0x40, 0x00, 0xE0, 0x13, 0x6F, 0xE0, 0x07, 0x1F, 0x40, 0x0F, 0x40,
+  0x00, 0x40, 0x33, 0x40, 0x07, 0xE0, 0x13, 0x00, 0x40, 0x23, 0xE0, 0x1B,
+  0x00, 0xE0, 0x07, 0x43, 0xC0, 0x33, 0xE0, 0x07, 0x17, 0xC0, 0x00, 0xC0,
+  0x1F, 0xE0, 0x33, 0x00, 0xE0, 0x1F, 0x4B, 0xE0, 0x13, 0x27, 0x40, 0x1B,
+  0xE0, 0x33, 0x83, 0xE0, 0x03, 0x00, 0x40, 0x4B, 0xE0, 0x03, 0x00, 0xE0,
+  0x03, 0x1B, 0xE0, 0x2F, 0x00, 0xE0, 0x1F, 0x4F, 0x40, 0x27, 0xE0, 0x1F,
+  0x63, 0xE0, 0x23, 0x2B, 0xE0, 0x23, 0x00, 0xE0, 0x03, 0x57, 0xE0, 0x03,
+  0x0B, 0xC0, 0x00, 0x40, 0x13, 0xE0, 0x03, 0x00, 0xC0, 0x17, 0xC0, 0x00,
+  0xE0, 0x03, 0x1B, 0xE0, 0x13, 0x00, 0xC0, 0x2F, 0xE0, 0x0F, 0x00, 0x40,
+  0x3B, 0xE0, 0x0F, 0x1B, 0xE0, 0x1F, 0x00, 0x40, 0x43, 0xE0, 0x07, 0x00,
+  0xE0, 0x17, 0x3B, 0x40, 0x2F, 0x40, 0x23, 0x40, 0x07, 0x40, 0x00, 0x40,
+  0x0B, 0xE0, 0x77, 0x00, 0x40, 0x87, 0xE0, 0x0B, 0x00, 0xC0, 0x97, 0xC0,
+  0x1B, 0xE0, 0x0F, 0x0F, 0xE0, 0x03, 0x00, 0xC0, 0x2B, 0x40, 0x00, 0xE0,
+  0x03, 0x17, 0xC0, 0x00, 0x40, 0x17, 0xE0, 0x1F, 0x00, 0xC0, 0x33, 0xE0,
+  0x07, 0x00, 0x40, 0x3F, 0xE0, 0x07, 0x13, 0xE0, 0x37, 0x00, 0x40, 0x53,
+  0xC0, 0x00, 0xE0, 0x2B, 0x4B, 0x40, 0x3B, 0xE0, 0x2B, 0x37, 0xE0, 0x2F,
+  0x00, 0xE0, 0x07, 0x6F, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x0B, 0x4F, 0x40,
+  0x17, 0xC0, 0x00, 0xE0, 0x0B, 0x1F, 0x40, 0x00, 0xE0, 0x03, 0x1F, 0xC0,
+  0x0B, 0xE0, 0x03, 0x00, 0xC0, 0x23, 0x40, 0x07, 0xE0, 0x33, 0x00, 0xC0,
+  0x53, 0x40, 0x43, 0xE0, 0x0B, 0x0B, 0xC0, 0x00, 0x40, 0x1F, 0xE0, 0x07,
+  0x00, 0xC0, 0x1B, 0xE0, 0x17, 0x00, 0xE0, 0x07, 0x37, 0xE0, 0x53, 0x00,
+  0xE0, 0x03, 0x8B, 0xE0, 0x13, 0x67, 0xE0, 0x03, 0x27, 0x40, 0x00, 0xE0,
+  0x13, 0x2B, 0xE0, 0x23, 0x00, 0xE0, 0x17, 0x4B, 0x40, 0x1F, 0x40, 0x00,
+  0xE0, 0x13, 0x53, 0x40, 0x1F, 0xE0, 0x0F, 0x00, 0xE0, 0x0B, 0x37, 0xE0,
+  0x0F, 0x2B, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x3B, 0xE0, 0x07, 0x1F, 0xC0,
+  0x00, 0xC0, 0x27, 0xC0, 0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x1B, 0x1B, 0xE0,
+  0x43, 0x00, 0xC0, 0x7B, 0xE0, 0x27, 0x53, 0x40, 0x37, 0xE0, 0x0F, 0x33,
+  0xE0, 0x13, 0x1B, 0xE0, 0x0B, 0x00, 0xE0, 0x13, 0x2F, 0x40, 0x1B, 0xE0,
+  0x03, 0x00, 0xC0, 0x3F, 0x40, 0x13, 0xE0, 0x0B, 0x0B, 0x40, 0x00, 0x40,
+  0x1B, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x07, 0x00, 0xC0, 0x1B, 0xE0, 0x1F,
+  0x00, 0xE0, 0x07, 0x3F, 0xE0, 0x23, 0x00, 0xC0, 0x63, 0xE0, 0x07, 0x33,
+  0xE0, 0x0F, 0x17, 0xE0, 0x03, 0x00, 0xC0, 0x23, 0xC0, 0x00, 0x40, 0x1B,
+  0xC0, 0x0B, 0xC0, 0x00, 0x40, 0x13, 0xE0, 0x8B, 0x00, 0xC0, 0x9F, 0x40,
+  0x00, 0xE0, 0x37, 0x9F, 0xE0, 0x03, 0x43, 0x40, 0x0B, 0x40, 0x00, 0xE0,
+  0x0F, 0x53, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x0B, 0x1F, 0x40, 0x17, 0xE0,
+  0x1B, 0x00, 0x40, 0x3B, 0xE0, 0x2B, 0x27, 0x40, 0x37, 0xE0, 0x03, 0x00,
+  0xE0, 0x13, 0x43, 0x40, 0x27, 0xE0, 0x13, 0x1F, 0xE0, 0x0F, 0x00, 0x40,
+  0x37, 0x40, 0x00, 0x40, 0x1F, 0x40, 0x07, 0xE0, 0x3B, 0x00, 0xE0, 0x27,
+  0x4B, 0x40, 0x2F, 0x40, 0x00, 0xE0, 0x0B, 0x7B, 0xE0, 0x27, 0x17, 0xE0,
+  0x17, 0x00, 0x40, 0x4F, 0xE0, 0x03, 0x00, 0xC0, 0x2F, 0xC0, 0x13, 0x40,
+  0x0F, 0xC0, 0x0B, 0xE0, 0x07, 0x00, 0x40, 0x1B, 0xE0, 0x13, 0x00, 0xC0,
+  0x2F, 0xE0, 0x13, 0x23, 0xE0, 0x17, 0x00, 0x40, 0x43, 0xE0, 0x03, 0x23,
+  0xE0, 0x07, 0x0F, 0xE0, 0x0F, 0x00, 0xE0, 0x33, 0x27, 0x40, 0x3B, 0xC0,
+  0x00, 0xE0, 0x0F, 0x5F, 0xE0, 0x57, 0x00, 0x40, 0x7F, 0xE0, 0x0F, 0x63,
+  0x40, 0x1B, 0x40, 0x00, 0xE0, 0x0F, 0x1F, 0xE0, 0x73, 0x00, 0x40, 0x97,
+  0x40, 0x00, 0x40, 0x83, 0x40, 0x07, 0xE0, 0x07, 0x00, 0x40, 0x17, 0x40,
+  0x00, 0x40, 0x17, 0x40, 0x07, 0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x13, 0x40,
+  0x00, 0xE0, 0x03, 0x27, 0xC0, 0x00, 0x40, 0x17, 0xC0, 0x00, 0x40, 0x13,
+  0xC0, 0x0B, 0xE0, 0x1B, 0x00, 0x40, 0x2F, 0x40, 0x00, 0xE0, 0x17, 0x2B,
+  0x40, 0x23, 0xC0, 0x00, 0x40, 0x2B, 0xC0, 0x0B, 0xE0, 0x0B, 0x00, 0xE0,
+  0x03, 0x1F, 0x40, 0x0B, 0xE0, 0x07, 0x00, 0xE0, 0x0B, 0x33, 0xE0, 0x0B,
+  0x00, 0xE0, 0x03, 0x37, 0xE0, 0x0B, 0x1F, 0xE0, 0x03, 0x00, 0xE0, 0x07,
+  0x2B, 0xC0, 0x0F, 0xE0, 0x03, 0x23, 0xE0, 0x13, 0x00, 0xC0, 0x2F, 0xE0,
+  0x03, 0x00, 0x40, 0x2F, 0xE0, 0x03, 0x0F, 0xE0, 0x0B, 0x00, 0x40, 0x23,
+  0xE0, 0x43, 0x00, 0xE0, 0x03, 0x63, 0xE0, 0x43, 0x57, 0xE0, 0x27, 0x00,
+  0xE0, 0x0F, 0x87, 0x40, 0x17, 0xE0, 0x1B, 0x4B, 0xE0, 0x1F, 0x27, 0xE0,
+  0x03, 0x00, 0xE0, 0x03, 0x33, 0x40, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x23,
+  0xC0, 0x00, 0x40, 0x1B, 0xC0, 0x0B, 0xE0, 0x8B, 0x00, 0xE0, 0x0B, 0x9F,
+  0x40, 0x13, 0x40, 0x00, 0xE0, 0x03, 0xAF, 0xE0, 0x07, 0x0F, 0xE0, 0x07,
+  0x00, 0x40, 0x1F, 0xE0, 0x23, 0x00, 0x40, 0x3F, 0xE0, 0x23, 0x2F, 0xE0,
+  0x1F, 0x00, 0x40, 0x57, 0xE0, 0x2F, 0x00, 0x40, 0x63, 0xC0, 0x3B, 0xE0,
+  0x03, 0x0B, 0x40, 0x00, 0xE0, 0x07, 0x0F, 0xC0, 0x00, 0x40, 0x17, 0xE0,
+  0x03, 0x00, 0x40, 0x17, 0xC0, 0x0F, 0x40, 0x0B, 0xE0, 0x07, 0x00, 0xE0,
+  0x03, 0x1B, 0xE0, 0x03, 0x0B, 0xE0, 0x17, 0x00, 0xC0, 0x2B, 0xE0, 0x2F,
+  0x00, 0xE0, 0x17, 0x5F, 0xE0, 0x2F, 0x00, 0x40, 0x8F, 0xE0, 0x07, 0x3B,
+  0xE0, 0x0B, 0x13, 0xE0, 0x63, 0x00, 0x40, 0x7F, 0xC0, 0x00, 0xE0, 0x3F,
+  0x77, 0x40, 0x4F, 0xE0, 0x03, 0x4B, 0xE0, 0x07, 0x0F, 0xE0, 0x0F, 0x00,
+  0xE0, 0x1F, 0x27, 0xE0, 0x37, 0x00, 0xE0, 0x2F, 0x67, 0xE0, 0x1F, 0x37,
+  0x40, 0x27, 0x40, 0x00, 0xC0, 0xA7, 0xE0, 0x03, 0x0B, 0x40, 0x00, 0x40,
+  0x0F, 0xE0, 0x17, 0x00, 0xE0, 0x03, 0x27, 0xE0, 0x03, 0x0B, 0xE0, 0x4B,
+  0x00, 0x40, 0x5F, 0xE0, 0x37, 0x00, 0x40, 0x97, 0xE0, 0x0F, 0x43, 0x40,
+  0x1B, 0x40, 0x00, 0xC0, 0x1F, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0xC0, 0x17,
+  0xE0, 0x07, 0x00, 0xE0, 0x03, 0x23, 0x40, 0x00, 0xE0, 0x07, 0x1F, 0xC0,
+  0x00, 0x40, 0x1B, 0xE0, 0x17, 0x00, 0x40, 0x2B, 0xE0, 0x17, 0x23, 0xC0,
+  0x00, 0x40, 0x2B, 0xE0, 0x3F, 0x00, 0x40, 0x53, 0xE0, 0x0F, 0x4B, 0x40,
+  0x1B, 0xE0, 0x0B, 0x00, 0xE0, 0x0B, 0x2F, 0xE0, 0x03, 0x27, 0xE0, 0x0B,
+  0x1F, 0xE0, 0x27, 0x00, 0xE0, 0x03, 0x4F, 0xC0, 0x00, 0xE0, 0x27, 0x43,
+  0xE0, 0x0F, 0x00, 0x40, 0x4F, 0xE0, 0x0F, 0x1B, 0xE0, 0x0B, 0x00, 0xC0,
+  0x2F, 0xC0, 0x07, 0xE0, 0x57, 0x00, 0xE0, 0x2F, 0x67, 0xC0, 0x37, 0x40,
+  0x07, 0x40, 0x00, 0xE0, 0x2F, 0xA7, 0xC0, 0x3B, 0x40, 0x07, 0xC0, 0x00,
+  0xE0, 0x07, 0x4B, 0xE0, 0x0B, 0x17, 0xE0, 0x03, 0x13, 0xC0, 0x0B, 0xE0,
+  0x0B, 0x00, 0x40, 0x4B, 0x40, 0x17, 0xC0, 0x07, 0xE0, 0x13, 0x00, 0x40,
+  0x23, 0xE0, 0x57, 0x00, 0xC0, 0x7F, 0xC0, 0x67, 0xC0, 0x0F, 0xC0, 0x00,
+  0xC0, 0x17, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x1F, 0x40, 0x0B, 0xE0, 0x07,
+  0x1F, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x23, 0x40, 0x0B, 0xE0, 0x0B, 0x00,
+  0xC0, 0x33, 0xE0, 0x03, 0x1B, 0x40, 0x13, 0xE0, 0x03, 0x0F, 0xE0, 0x03,
+  0x00, 0x40, 0x1B, 0xE0, 0x2F, 0x00, 0xC0, 0x47, 0xC0, 0x3F, 0x40, 0x0F,
+  0xC0, 0x0B, 0x40, 0x00, 0x40, 0x0F, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x17,
+  0x00, 0xC0, 0x2B, 0x40, 0x00, 0xE0, 0x17, 0x2B, 0xE0, 0x0F, 0x00, 0x40,
+  0x3B, 0xE0, 0x0B, 0x00, 0xE0, 0x0F, 0x2F, 0xE0, 0x5B, 0x00, 0x40, 0x8F,
+  0xE0, 0x0B, 0x67, 0x40, 0x17, 0x40, 0x00, 0xE0, 0x0B, 0x1B, 0xE0, 0x2B,
+  0x00, 0xE0, 0x37, 0x4B, 0x40, 0x3F, 0xE0, 0x03, 0x00, 0xE0, 0x2B, 0x83,
+  0xC0, 0x00, 0xE0, 0x03, 0x47, 0x40, 0x00, 0xC0, 0x17, 0xC0, 0x00, 0x40,
+  0x13, 0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x07, 0x00, 0x40, 0x1B, 0xE0, 0x0F,
+  0x00, 0xE0, 0x03, 0x2B, 0xE0, 0x0F, 0x23, 0xC0, 0x00, 0xC0, 0x2B, 0xE0,
+  0x07, 0x0F, 0xE0, 0x2B, 0x00, 0xC0, 0x43, 0x40, 0x00, 0xC0, 0x3F, 0x40,
+  0x0B, 0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x17, 0xE0, 0x07,
+  0x00, 0xC0, 0x1F, 0xE0, 0x07, 0x17, 0x40, 0x00, 0xC0, 0x1B, 0xE0, 0x23,
+  0x00, 0x40, 0x37, 0xE0, 0x03, 0x00, 0xE0, 0x0B, 0x3B, 0xE0, 0x03, 0x1F,
+  0xE0, 0x0B, 0x00, 0xE0, 0x0B, 0x33, 0xE0, 0x1B, 0x00, 0xC0, 0x4B, 0xC0,
+  0x2B, 0x40, 0x0F, 0xC0, 0x0B, 0xE0, 0x33, 0x00, 0x40, 0x47, 0xC0, 0x00,
+  0xE0, 0x03, 0x47, 0xE0, 0x0B, 0x13, 0xC0, 0x00, 0xC0, 0x1B, 0xE0, 0x0F,
+  0x00, 0xC0, 0x27, 0xE0, 0x13, 0x00, 0x40, 0x3B, 0xE0, 0x0B, 0x1F, 0xE0,
+  0x0F, 0x17, 0xE0, 0x23, 0x00, 0xE0, 0x07, 0x43, 0x40, 0x0F, 0xE0, 0x07,
+  0x00, 0xE0, 0x27, 0x4F, 0xE0, 0x03, 0x00, 0xE0, 0x23, 0x3B, 0xE0, 0x13,
+  0x00, 0xC0, 0x53, 0xE0, 0x13, 0x23, 0xE0, 0x1F, 0x00, 0xE0, 0x0F, 0x4B,
+  0xC0, 0x17, 0x40, 0x00, 0xE0, 0x0B, 0x4B, 0x40, 0x17, 0x40, 0x00, 0x40,
+  0x1B, 0x40, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x0B, 0x00, 0x40,
+  0x23, 0xE0, 0x03, 0x17, 0x40, 0x0F, 0xC0, 0x00, 0xE0, 0x03, 0x17, 0xE0,
+  0x2F, 0x00, 0xC0, 0x4B, 0xC0, 0x00, 0xC0, 0x47, 0xC0, 0x0F, 0x40, 0x00,
+  0xE0, 0x0B, 0x13, 0xE0, 0x07, 0x00, 0xE0, 0x13, 0x23, 0xC0, 0x1B, 0xE0,
+  0x23, 0x00, 0xE0, 0x03, 0x5F, 0xE0, 0x0F, 0x37, 0x40, 0x23, 0x40, 0x1B,
+  0x40, 0x07, 0xE0, 0x0B, 0x00, 0x40, 0x1B, 0xE0, 0x27, 0x00, 0xE0, 0x03,
+  0x47, 0xC0, 0x3B, 0x40, 0x13, 0xC0, 0x0B, 0xE0, 0x1B, 0x00, 0xE0, 0x0B,
+  0x2F, 0x40, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x47, 0x40, 0x0F, 0xC0, 0x07,
+  0x40, 0x00, 0x40, 0x0B, 0xE0, 0x0F, 0x00, 0x40, 0x1F, 0xE0, 0x07, 0x00,
+  0xE0, 0x0F, 0x2B, 0xE0, 0x1F, 0x00, 0x40, 0x4F, 0xE0, 0x1F, 0x2B, 0xE0,
+  0x03, 0x00, 0xE0, 0x13, 0x37, 0xC0, 0x1B, 0xC0, 0x07, 0x40, 0x00, 0xE0,
+  0x03, 0x0B, 0xE0, 0x17, 0x00, 0x40, 0x2B, 0xE0, 0x07, 0x00, 0xE0, 0x17,
+  0x33, 0xE0, 0x1B, 0x00, 0xE0, 0x0B, 0x53, 0x40, 0x13, 0xE0, 0x1B, 0x3B,
+  0xE0, 0x07, 0x00, 0xE0, 0x2F, 0x37, 0x40, 0x00, 0x40, 0x3B, 0xE0, 0x07,
+  0x00, 0x40, 0x17, 0xE0, 0x0B, 0x00, 0xC0, 0x27, 0xE0, 0x03, 0x1B, 0xC0,
+  0x13, 0x40, 0x00, 0xE0, 0x03, 0x17, 0xE0, 0x2F, 0x00, 0x40, 0x47, 0x40,
+  0x00, 0xE0, 0x07, 0x3F, 0x40, 0x13, 0xC0, 0x00, 0xC0, 0x1B, 0xC0, 0x0F,
+  0x40, 0x00, 0x40, 0x13, 0x40, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0x40,
+  0x00, 0xE0, 0x03, 0x13, 0x40, 0x00, 0x40, 0x13, 0xE0, 0x2B, 0x00, 0xE0,
+  0x27, 0x3B, 0x40, 0x2F, 0xC0, 0x00, 0xE0, 0x2B, 0x6F, 0x40, 0x00, 0xE0,
+  0x23, 0x3F, 0x40, 0x2B, 0x40, 0x33, 0xE0, 0x03, 0x00, 0x40, 0x13, 0x40,
+  0x00, 0xE0, 0x03, 0x13, 0xE0, 0x17, 0x00, 0x40, 0x2F, 0x40, 0x00, 0xE0,
+  0x0F, 0x27, 0x40, 0x1B, 0xE0, 0x07, 0x00, 0xE0, 0x0F, 0x2B, 0xE0, 0x5B,
+  0x00, 0xC0, 0x8B, 0xE0, 0x03, 0x6B, 0xE0, 0x0B, 0x13, 0xC0, 0x00, 0xE0,
+  0x13, 0x1B, 0xE0, 0x0B, 0x00, 0xC0, 0x2F, 0xC0, 0x00, 0xE0, 0x0B, 0x23,
+  0xE0, 0x2B, 0x00, 0xC0, 0x4F, 0x40, 0x00, 0xE0, 0x27, 0x3F, 0x40, 0x33,
+  0x40, 0x00, 0x40, 0x37, 0x40, 0x07, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x07,
+  0x00, 0xC0, 0x1B, 0x40, 0x00, 0xE0, 0x07, 0x1B, 0x40, 0x00, 0x40, 0x17,
+  0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x07, 0x00, 0xC0, 0x1B, 0xC0, 0x00, 0x40,
+  0x1F, 0xC0, 0x0B, 0xE0, 0x07, 0x00, 0x40, 0x1B, 0xE0, 0x63, 0x00, 0xE0,
+  0x1B, 0x7F, 0xC0, 0x23, 0xE0, 0x2B, 0x97, 0xC0, 0x3B, 0x40, 0x00, 0x40,
+  0x3F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x07, 0x00, 0xE0, 0x07,
+  0x17, 0xE0, 0x07, 0x0F, 0xE0, 0x2F, 0x00, 0x40, 0x47, 0xC0, 0x00, 0xE0,
+  0x13, 0x43, 0x40, 0x23, 0xE0, 0x13, 0x1F, 0xE0, 0x0F, 0x00, 0xE0, 0x07,
+  0x37, 0xE0, 0x07, 0x0F, 0xE0, 0x07, 0x00, 0x40, 0x1F, 0xE0, 0x03, 0x00,
+  0xE0, 0x0B, 0x1F, 0xE0, 0x07, 0x13, 0xE0, 0x6B, 0x00, 0x40, 0xA3, 0xE0,
+  0x0F, 0x77, 0xE0, 0x13, 0x1B, 0xE0, 0x03, 0x00, 0x40, 0x27, 0xE0, 0x03,
+  0x00, 0xE0, 0x03, 0x1B, 0xE0, 0x73, 0x00, 0xC0, 0x93, 0xE0, 0x13, 0x83,
+  0xC0, 0x23, 0xC0, 0x00, 0xE0, 0x03, 0x2B, 0x40, 0x13, 0xE0, 0x03, 0x0F,
+  0xE0, 0x0F, 0x00, 0x40, 0x27, 0xE0, 0x1F, 0x00, 0xE0, 0x0F, 0x43, 0xE0,
+  0x13, 0x00, 0x40, 0x5B, 0x40, 0x1F, 0xC0, 0x07, 0xE0, 0x2B, 0x00, 0x40,
+  0x3B, 0x40, 0x00, 0xE0, 0x2B, 0x3B, 0xE0, 0x13, 0x00, 0x40, 0x53, 0xE0,
+  0x03, 0x00, 0xE0, 0x13, 0x2B, 0x40, 0x00, 0x40, 0x2B, 0x40, 0x07, 0xE0,
+  0x47, 0x00, 0x40, 0x57, 0xE0, 0x03, 0x00, 0xE0, 0x43, 0x5F, 0xE0, 0x03,
+  0x57, 0xE0, 0x03, 0x00, 0xE0, 0x13, 0x63, 0xE0, 0x03, 0x27, 0x40, 0x00,
+  0xE0, 0x13, 0x2B, 0xE0, 0x67, 0x00, 0xC0, 0x8F, 0x40, 0x07, 0xC0, 0x00,
+  0xE0, 0x0F, 0x83, 0x40, 0x1F, 0xE0, 0x0F, 0x1B, 0x40, 0x00, 0x40, 0x1F,
+  0xE0, 0x07, 0x00, 0x40, 0x17, 0xC0, 0x00, 0xC0, 0x1B, 0xC0, 0x0F, 0xE0,
+  0x67, 0x00, 0xE0, 0x17, 0x7F, 0x40, 0x1F, 0x40, 0x93, 0x40, 0x07, 0x40,
+  0x00, 0xE0, 0x07, 0x0B, 0xE0, 0x07, 0x00, 0xC0, 0x23, 0xE0, 0x03, 0x00,
+  0x40, 0x13, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x1B, 0x40, 0x00, 0xE0, 0x13,
+  0x1B, 0xE0, 0x2F, 0x00, 0x40, 0x53, 0xE0, 0x1F, 0x3B, 0x40, 0x2B, 0x40,
+  0x00, 0xE0, 0x1F, 0x2F, 0xE0, 0x23, 0x00, 0x40, 0x57, 0xE0, 0x03, 0x00,
+  0xE0, 0x23, 0x3B, 0xE0, 0x43, 0x00, 0x40, 0x83, 0xE0, 0x43, 0x4F, 0xE0,
+  0x07, 0x00, 0xE0, 0x2B, 0x5F, 0x40, 0x33, 0x40, 0x00, 0xE0, 0x07, 0x4B,
+  0xE0, 0x73, 0x00, 0xE0, 0x03, 0x8F, 0x40, 0x0B, 0x40, 0x00, 0xE0, 0x0F,
+  0x8F, 0x40, 0x1B, 0xC0, 0x00, 0xC0, 0x23, 0x40, 0x0F, 0xC0, 0x0B, 0x40,
+  0x00, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xC0, 0x13,
+  0xE0, 0x03, 0x07, 0xE0, 0x5F, 0x00, 0xC0, 0x83, 0xE0, 0x03, 0x00, 0xE0,
+  0x07, 0x7B, 0x40, 0x1B, 0xE0, 0x07, 0x13, 0xE0, 0x17, 0x00, 0x40, 0x33,
+  0x40, 0x00, 0xE0, 0x0B, 0x27, 0xE0, 0x07, 0x17, 0x40, 0x0F, 0x40, 0x00,
+  0xC0, 0x2B, 0x40, 0x0B, 0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x07, 0x00, 0xE0,
+  0x13, 0x1B, 0xE0, 0x07, 0x00, 0xE0, 0x23, 0x2B, 0x40, 0x00, 0xE0, 0x27,
+  0x2F, 0xE0, 0xFF, 0x30, 0x00, 0x41, 0x67, 0x40, 0x00, 0x41, 0x3F, 0x40,
+  0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x73, 0x00, 0x40, 0x83, 0xE0, 0x03,
+  0x00, 0xE0, 0x03, 0x8B, 0xC0, 0x17, 0xE0, 0x03, 0x13, 0xC0, 0x00, 0xC0,
+  0x1B, 0xE0, 0x07, 0x00, 0xC0, 0x1F, 0x40, 0x00, 0xE0, 0x07, 0x1B, 0xE0,
+  0x0B, 0x00, 0x40, 0x27, 0xE0, 0x6B, 0x00, 0x40, 0x8B, 0xE0, 0x1F, 0x77,
+  0xE0, 0x23, 0x2B, 0xE0, 0x13, 0x00, 0xE0, 0x03, 0x47, 0x40, 0x0B, 0xC0,
+  0x00, 0x40, 0x33, 0xE0, 0x03, 0x0B, 0xE0, 0x0F, 0x00, 0x40, 0x23, 0xE0,
+  0x03, 0x1B, 0xE0, 0x07, 0x0F, 0xE0, 0x93, 0x00, 0x40, 0xAB, 0x40, 0x00,
+  0xE0, 0x93, 0xA3, 0xE0, 0x33, 0x00, 0x40, 0xDB, 0xE0, 0x03, 0x00, 0xC0,
+  0x4B, 0xE0, 0x03, 0x13, 0x40, 0x00, 0xC0, 0x17, 0x40, 0x00, 0xE0, 0x07,
+  0x0F, 0xE0, 0x6F, 0x00, 0xE0, 0x0B, 0x87, 0x40, 0x13, 0x40, 0x00, 0xE0,
+  0x0B, 0x93, 0xE0, 0x07, 0x17, 0xE0, 0x07, 0x0F, 0xC0, 0x00, 0x40, 0x17,
+  0xE0, 0x17, 0x00, 0xC0, 0x2B, 0xE0, 0x43, 0x00, 0x40, 0x73, 0xE0, 0x43,
+  0x4F, 0xE0, 0x3F, 0x00, 0x40, 0x97, 0xE0, 0x0B, 0x00, 0xC0, 0x5F, 0xC0,
+  0x1B, 0xC0, 0x0F, 0xE0, 0x07, 0x00, 0x40, 0x1F, 0xE0, 0x07, 0x13, 0xE0,
+  0x27, 0x00, 0xE0, 0x0F, 0x43, 0xE0, 0x0F, 0x17, 0xE0, 0x1F, 0x00, 0x40,
+  0x3F, 0x40, 0x00, 0xE0, 0x07, 0x2F, 0xC0, 0x13, 0x40, 0x07, 0xC0, 0x00,
+  0xE0, 0x07, 0x23, 0xE0, 0x63, 0x00, 0xE0, 0x17, 0x83, 0x40, 0x1F, 0xE0,
+  0x27, 0x8F, 0x40, 0x33, 0xE0, 0x1F, 0x00, 0xC0, 0x5B, 0xE0, 0x07, 0x2F,
+  0xC0, 0x17, 0xE0, 0x7F, 0x00, 0xC0, 0x9F, 0xE0, 0x07, 0x8F, 0xE0, 0x0B,
+  0x17, 0x40, 0x13, 0xE0, 0x07, 0x27, 0x40, 0x00, 0xC0, 0x17, 0xC0, 0x07,
+  0xE0, 0xFF, 0x04, 0x00, 0x41, 0x13, 0xC0, 0x00, 0xC1, 0x17, 0x40, 0x0F,
+  0xC0, 0x0B, 0xE0, 0x4F, 0x00, 0xE0, 0x1B, 0x63, 0xE0, 0x1B, 0x23, 0xE0,
+  0x03, 0x00, 0xE0, 0x1B, 0x2F, 0x40, 0x23, 0x40, 0x00, 0xE0, 0x03, 0x37,
+  0xE0, 0x6F, 0x00, 0xE0, 0x17, 0x87, 0x40, 0x1F, 0xE0, 0x03, 0x00, 0x40,
+  0xA7, 0xE0, 0x07, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x1F, 0xE0, 0x1B,
+  0x00, 0x40, 0x3F, 0x40, 0x27, 0x40, 0x07, 0xE0, 0x8B, 0x00, 0x40, 0x9B,
+  0xC0, 0x00, 0xC0, 0x9F, 0xC0, 0x0F, 0x40, 0x00, 0xC0, 0x13, 0x40, 0x00,
+  0xE0, 0x07, 0x0F, 0xE0, 0x07, 0x00, 0xC0, 0x1F, 0x40, 0x07, 0x40, 0x00,
+  0xE0, 0x07, 0x1F, 0xE0, 0xFF, 0x5C, 0x00, 0xE1, 0x0F, 0x77, 0xE0, 0x0F,
+  0x17, 0x40, 0x00, 0x40, 0x1B, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x0F, 0x00,
+  0x40, 0x1F, 0x40, 0x00, 0xE0, 0x0F, 0x1F, 0xE0, 0x9F, 0x00, 0xE0, 0x03,
+  0xC3, 0x40, 0x0B, 0xE0, 0x1B, 0x00, 0xE0, 0x03, 0xDB, 0xE0, 0x1B, 0x2F,
+  0xE0, 0x03, 0x00, 0xE0, 0x03, 0x3B, 0xE0, 0x8F, 0x00, 0xC0, 0xAF, 0xE0,
+  0x3F, 0x9F, 0xC0, 0x4F, 0x40, 0x00, 0xE0, 0x3F, 0x53, 0xE0, 0x53, 0x00,
+  0xE0, 0x2F, 0xA7, 0x40, 0x37, 0x40, 0x00, 0xC0, 0x9B, 0xE0, 0x03, 0x0B,
+  0x40, 0x00, 0x40, 0x0F, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x3B, 0x00, 0xE0,
+  0x27, 0x4B, 0xE0, 0x1B, 0x2F, 0x40, 0x23, 0x40, 0x00, 0xE0, 0x33, 0x9F,
+  0xE0, 0x37, 0x3F, 0xE0, 0x6F, 0x00, 0x40, 0xB7, 0xE0, 0x17, 0x00, 0xE0,
+  0x03, 0x9B, 0xE0, 0x17, 0x2B, 0xE0, 0x0B, 0x00, 0xE0, 0x0B, 0x3F, 0xE0,
+  0x03, 0x13, 0xE0, 0x57, 0x00, 0x40, 0x93, 0xE0, 0x13, 0x63, 0x40, 0x1F,
+  0x40, 0x00, 0xE0, 0x13, 0x23, 0xE0, 0x1F, 0x00, 0x40, 0x47, 0x40, 0x00,
+  0xE0, 0x1F, 0x2F, 0xE0, 0x7B, 0x00, 0x40, 0xAF, 0xC0, 0x00, 0xC0, 0x8F,
+  0x40, 0x0F, 0xC0, 0x0B, 0xE0, 0x0F, 0x00, 0x40, 0x23, 0xE0, 0x1F, 0x00,
+  0xE0, 0x0F, 0x43, 0xE0, 0x27, 0x00, 0x40, 0x6F, 0xE0, 0x1F, 0x33, 0x40,
+  0x2B, 0x40, 0x00, 0xE0, 0x17, 0x2F, 0x40, 0x23, 0xC0, 0x00, 0xE0, 0x17,
+  0x2B, 0xC0, 0x00, 0x40, 0x2F, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xC0, 0x13,
+  0xE0, 0x43, 0x00, 0x40, 0x5B, 0xE0, 0x43, 0x4F, 0xC0, 0x00, 0x40, 0x57,
+  0x40, 0x00, 0x40, 0x0F, 0x40, 0x07, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x07,
+  0x00, 0xC0, 0x1B, 0xE0, 0x27, 0x00, 0xE0, 0x03, 0x47, 0xE0, 0x07, 0x3B,
+  0xE0, 0x03, 0x1B, 0xE0, 0x4F, 0x00, 0xE0, 0x07, 0x73, 0x40, 0x00, 0xE0,
+  0x03, 0x6B, 0x40, 0x0F, 0xC0, 0x00, 0xE0, 0x03, 0x17, 0xE0, 0x13, 0x00,
+  0x40, 0x2F, 0xE0, 0x0F, 0x1F, 0xE0, 0x13, 0x1B, 0xE0, 0x8F, 0x00, 0x40,
+  0xB3, 0x40, 0x00, 0xE0, 0x03, 0x9F, 0xE0, 0x07, 0x0F, 0xE0, 0x0B, 0x00,
+  0x40, 0x23, 0xE0, 0x1F, 0x00, 0xE0, 0x0B, 0x3F, 0xE0, 0x5B, 0x00, 0x40,
+  0x9F, 0xE0, 0x1B, 0x67, 0x40, 0x27, 0xC0, 0x00, 0xE0, 0x1B, 0x2F, 0xE0,
+  0x0B, 0x00, 0x40, 0x3F, 0xE0, 0x0B, 0x17, 0xE0, 0x93, 0x00, 0x40, 0xB3,
+  0xE0, 0x0B, 0x00, 0x40, 0xB3, 0xE0, 0x0B, 0x17, 0xC0, 0x00, 0x40, 0x1F,
+  0x40, 0x00, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x03,
+  0x00, 0x40, 0x13, 0xC0, 0x00, 0xE0, 0x03, 0x17, 0xE0, 0x07, 0x00, 0xC0,
+  0x23, 0xE0, 0x4F, 0x00, 0xE0, 0x13, 0x6F, 0xE0, 0x03, 0x1B, 0xE0, 0x3B,
+  0x7F, 0x40, 0x4F, 0xE0, 0x23, 0x47, 0xE0, 0x27, 0x2F, 0xE0, 0x6B, 0x00,
+  0xE0, 0x0F, 0xA3, 0x40, 0x17, 0xE0, 0x0B, 0x00, 0xE0, 0x0F, 0xA3, 0x40,
+  0x2B, 0xE0, 0x0F, 0x1B, 0xE0, 0x23, 0x00, 0xE0, 0x3F, 0x47, 0xE0, 0x0F,
+  0x00, 0x40, 0x5F, 0xE0, 0x0B, 0x00, 0xE0, 0x03, 0x2F, 0x40, 0x1F, 0xE0,
+  0x03, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x03, 0x13,
+  0xE0, 0x27, 0x00, 0xE0, 0x37, 0x3F, 0xE0, 0x1F, 0x00, 0x40, 0x67, 0xE0,
+  0x23, 0x00, 0xE0, 0x07, 0x57, 0xC0, 0x3B, 0x40, 0x17, 0xC0, 0x0B, 0xC0,
+  0x00, 0x40, 0x13, 0xC0, 0x00, 0xC0, 0x13, 0xE0, 0x03, 0x00, 0xC0, 0x1B,
+  0xE0, 0x57, 0x00, 0xE0, 0x1B, 0x73, 0x40, 0x23, 0xE0, 0x1F, 0x87, 0x40,
+  0x2B, 0xE0, 0x03, 0x00, 0xE0, 0x1F, 0x37, 0xE0, 0x7B, 0x00, 0xE0, 0x43,
+  0xB7, 0xE0, 0x03, 0x4B, 0xE0, 0x07, 0x00, 0x40, 0xEB, 0x40, 0x13, 0x40,
+  0x07, 0x40, 0x00, 0xE0, 0x03, 0x0B, 0xE0, 0xAB, 0x00, 0xE0, 0x07, 0xBF,
+  0xE0, 0x07, 0x0F, 0xE0, 0x43, 0x00, 0x40, 0x5B, 0x40, 0x00, 0xE0, 0x43,
+  0x53, 0xE0, 0x0F, 0x00, 0x40, 0x67, 0xE0, 0x03, 0x00, 0x40, 0x27, 0xE0,
+  0x03, 0x0F, 0xE0, 0x07, 0x00, 0x40, 0x1F, 0xE0, 0x03, 0x00, 0xC0, 0x1F,
+  0xE0, 0x17, 0x13, 0xE0, 0x6F, 0x00, 0xC0, 0x9F, 0x40, 0x00, 0xE0, 0x0F,
+  0x83, 0xE0, 0x13, 0x1B, 0xE0, 0xAF, 0x00, 0xE0, 0x13, 0xD3, 0x40, 0x1B,
+  0x40, 0x00, 0xC0, 0xDB, 0xE0, 0x03, 0x0B, 0xE0, 0x1F, 0x00, 0x40, 0x33,
+  0xE0, 0x07, 0x00, 0xE0, 0x07, 0x3B, 0xE0, 0x0F, 0x1F, 0xC0, 0x17, 0xE0,
+  0x07, 0x2F, 0xE0, 0x33, 0x00, 0xC0, 0x53, 0xC0, 0x00, 0xE0, 0x33, 0x4B,
+  0xE0, 0x17, 0x00, 0xE0, 0x53, 0x63, 0xC0, 0x5B, 0x40, 0x00, 0xE0, 0x17,
+  0x87, 0xE0, 0x3B, 0x00, 0xC0, 0x67, 0x40, 0x07, 0x40, 0x00, 0xC0, 0x53,
+  0x40, 0x0B, 0xE0, 0x07, 0x00, 0xC0, 0x1B, 0xC0, 0x00, 0xE0, 0x03, 0x1F,
+  0xC0, 0x13, 0xC0, 0x00, 0xC0, 0x1B, 0xC0, 0x0F, 0xE0, 0x07, 0x00, 0x40,
+  0x1F, 0xE0, 0x07, 0x13, 0xE0, 0x3B, 0x00, 0xE0, 0x03, 0x57, 0x40, 0x0B,
+  0xE0, 0x03, 0x00, 0xE0, 0x07, 0x5F, 0x40, 0x1B, 0xE0, 0x07, 0x13, 0xE0,
+  0x33, 0x00, 0x40, 0x4F, 0xE0, 0x0F, 0x00, 0xE0, 0x33, 0x57, 0xE0, 0x2B,
+  0x00, 0x40, 0x87, 0xE0, 0x13, 0x37, 0xE0, 0x17, 0x1F, 0xE0, 0x17, 0x00,
+  0x40, 0x3F, 0x40, 0x00, 0xE0, 0x17, 0x27, 0xC0, 0x00, 0x40, 0x2B, 0x40,
+  0x00, 0x40, 0x0F, 0x40, 0x07, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x37, 0x00,
+  0xC0, 0x4B, 0xC0, 0x00, 0xE0, 0x37, 0x4F, 0xE0, 0x73, 0x00, 0x40, 0xC3,
+  0xE0, 0x13, 0x7F, 0xE0, 0x17, 0x1F, 0xE0, 0x07, 0x00, 0xE0, 0x17, 0x2F,
+  0x40, 0x1F, 0x40, 0x00, 0xE0, 0x0B, 0x37, 0xE0, 0x07, 0x00, 0xE0, 0x13,
+  0x23, 0xE0, 0x1B, 0x1B, 0x40, 0x4F, 0xE0, 0x07, 0x27, 0xE0, 0x73, 0x00,
+  0xE0, 0x43, 0x8F, 0xE0, 0x03, 0x4B, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0xDF,
+  0x40, 0x0B, 0x40, 0x07, 0xE0, 0x63, 0x00, 0xE0, 0x17, 0x73, 0x40, 0x1F,
+  0x40, 0x00, 0xE0, 0x2F, 0x93, 0x40, 0x3B, 0x40, 0x00, 0xE0, 0x17, 0x3F,
+  0x40, 0x23, 0xC0, 0x00, 0xE0, 0x03, 0x2B, 0xE0, 0x0B, 0x13, 0xE0, 0x1F,
+  0x00, 0x40, 0x3B, 0xC0, 0x2B, 0x40, 0x0B, 0xE0, 0x0B, 0x00, 0xC0, 0x1F,
+  0xE0, 0xA7, 0x00, 0x40, 0xCB, 0xE0, 0x63, 0xB3, 0x40, 0x6F, 0x40, 0x00,
+  0xE0, 0x0B, 0x73, 0x40, 0x17, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x23, 0xE0,
+  0x0F, 0x17, 0xC0, 0x00, 0xE0, 0x03, 0x1F, 0xE0, 0x0B, 0x00, 0xC0, 0x27,
+  0xE0, 0xB3, 0x00, 0x40, 0xD7, 0x40, 0xBF, 0x40, 0x07, 0x40, 0x00, 0x40,
+  0x0B, 0x40, 0x00, 0xE0, 0x07, 0x0B, 0x40, 0x00, 0x40, 0x17, 0xE0, 0x1B,
+  0x00, 0xE0, 0x23, 0x2B, 0xE0, 0x0F, 0x00, 0xE0, 0x07, 0x43, 0xE0, 0x07,
+  0x0F, 0x40, 0x00, 0xE0, 0x0B, 0x13, 0xE0, 0x47, 0x00, 0x40, 0x63, 0xE0,
+  0x07, 0x00, 0xE0, 0x47, 0x63, 0x40, 0x00, 0xE0, 0x5B, 0x63, 0xE0, 0x5B,
+  0x00, 0xC0, 0xC7, 0xE0, 0x07, 0x6B, 0x40, 0x17, 0xE0, 0x07, 0x13, 0xE0,
+  0x43, 0x00, 0xE0, 0x17, 0x5F, 0x40, 0x1F, 0xE0, 0x0B, 0x00, 0xC0, 0x83,
+  0x40, 0x1B, 0xC0, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x17, 0xE0, 0x07, 0x00,
+  0xE0, 0x03, 0x1F, 0xE0, 0x8B, 0x00, 0x40, 0xAF, 0xE0, 0x17, 0x97, 0x40,
+  0x23, 0x40, 0x00, 0xC0, 0x27, 0x40, 0x0B, 0xC0, 0x00, 0xC0, 0x13, 0x40,
+  0x00, 0xC0, 0x13, 0xC0, 0x00, 0x40, 0x13, 0xE0, 0x57, 0x00, 0xE0, 0x07,
+  0x6B, 0x40, 0x0F, 0xE0, 0x57, 0x73, 0xC0, 0x00, 0xC0, 0x6B, 0xE0, 0x03,
+  0x07, 0xE0, 0x07, 0x00, 0xC0, 0x2B, 0xE0, 0x2B, 0x00, 0x40, 0x4B, 0xE0,
+  0x13, 0x37, 0x40, 0x1F, 0x40, 0x00, 0xC0, 0x23, 0xC0, 0x0B, 0x40, 0x07,
+  0xE0, 0x07, 0x00, 0xC0, 0x23, 0xE0, 0x83, 0x00, 0xC0, 0xA3, 0x40, 0x93,
+  0xC0, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x17, 0xE0, 0x4B, 0x00, 0x40, 0x63,
+  0xE0, 0x17, 0x57, 0x40, 0x23, 0xE0, 0x07, 0x00, 0xC0, 0x33, 0x40, 0x17,
+  0xC0, 0x0B, 0xC0, 0x00, 0x40, 0x13, 0xE0, 0x03, 0x00, 0xC0, 0x17, 0xE0,
+  0x97, 0x00, 0xC0, 0xB3, 0xE0, 0x13, 0xA7, 0xC0, 0x23, 0xE0, 0x13, 0x00,
+  0x40, 0x3F, 0xE0, 0x0B, 0x1F, 0x40, 0x17, 0xE0, 0x57, 0x00, 0x40, 0x77,
+  0x40, 0x63, 0x40, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x5B, 0x00,
+  0xE0, 0x03, 0x73, 0xE0, 0x0B, 0x00, 0xE0, 0x4F, 0x83, 0xE0, 0x0F, 0x6B,
+  0xE0, 0x07, 0x17, 0xE0, 0x4F, 0x7F, 0xE0, 0x2B, 0x00, 0x40, 0x9B, 0xC0,
+  0x37, 0x40, 0x0B, 0xE0, 0x0B, 0x00, 0xC0, 0x1F, 0xE0, 0x73, 0x00, 0xE0,
+  0x1F, 0x97, 0x40, 0x27, 0x40, 0xA7, 0x40, 0x07, 0xE0, 0x03, 0x00, 0x40,
+  0x13, 0x40, 0x00, 0x40, 0x13, 0x40, 0x07, 0xE0, 0x5F, 0x00, 0xE0, 0x4B,
+  0x6F, 0x40, 0x53, 0xE0, 0x37, 0x00, 0xE0, 0x4F, 0xFF, 0xC0, 0x97, 0x40,
+  0x5F, 0xC0, 0x0B, 0xE0, 0x07, 0x00, 0x40, 0x1B, 0xE0, 0x13, 0x00, 0xE0,
+  0x03, 0x2F, 0xE0, 0x13, 0x27, 0xE0, 0x0B, 0x00, 0x40, 0x3B, 0xC0, 0x17,
+  0x40, 0x0B, 0xE0, 0x03, 0x00, 0xC0, 0x17, 0xE0, 0x53, 0x00, 0xE0, 0x03,
+  0x6F, 0xE0, 0x0F, 0x00, 0xE0, 0x53, 0x7F, 0xE0, 0x27, 0x00, 0xC0, 0xA3,
+  0xC0, 0x37, 0xE0, 0x07, 0x0F, 0xE0, 0x7F, 0x00, 0xC0, 0x97, 0xE0, 0x03,
+  0x00, 0xE0, 0x0B, 0x9B, 0xE0, 0x03, 0x1F, 0xE0, 0x13, 0x00, 0xE0, 0x0B,
+  0x3B, 0xE0, 0x3B, 0x00, 0xC0, 0x73, 0xE0, 0x3B, 0x4B, 0xE0, 0x13, 0x00,
+  0xC0, 0x67, 0xE0, 0x0B, 0x00, 0x40, 0x37, 0xE0, 0x0B, 0x17, 0xE0, 0x03,
+  0x00, 0x40, 0x23, 0xE0, 0x3F, 0x00, 0xE0, 0x03, 0x57, 0xE0, 0x13, 0x00,
+  0xE0, 0x3F, 0x6F, 0xE0, 0x13, 0x00, 0xC0, 0x7F, 0x40, 0x23, 0xC0, 0x0B,
+  0xC0, 0x00, 0x40, 0x13, 0xE0, 0x53, 0x00, 0xC0, 0x67, 0xE0, 0x03, 0x00,
+  0xC0, 0x6F, 0xE0, 0x03, 0x13, 0x40, 0x00, 0xC0, 0x17, 0xE0, 0x77, 0x00,
+  0x40, 0x8B, 0x40, 0x00, 0x40, 0x87, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B,
+  0xE0, 0x07, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x63, 0x00, 0x40, 0x83, 0xE0,
+  0x0B, 0x00, 0xE0, 0x07, 0x83, 0xE0, 0x0B, 0x23, 0xE0, 0x0B, 0x00, 0xE0,
+  0x07, 0x37, 0xE0, 0xA7, 0x00, 0xE0, 0x0B, 0xD3, 0xE0, 0x1F, 0x00, 0xE0,
+  0x5B, 0xEB, 0xE0, 0x07, 0x8B, 0xE0, 0x03, 0x73, 0x40, 0x1B, 0xE0, 0x03,
+  0x0F, 0xE0, 0x3F, 0x00, 0x40, 0x57, 0xE0, 0x0F, 0x00, 0xE0, 0x2B, 0x63,
+  0xC0, 0x4B, 0xE0, 0x1B, 0x3B, 0xC0, 0x2B, 0x40, 0x00, 0xE0, 0x0F, 0x2F,
+  0x40, 0x1B, 0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x27, 0xE0, 0x5B, 0x00, 0xE0,
+  0x1B, 0x87, 0xE0, 0x03, 0x23, 0xE0, 0x03, 0x00, 0xE0, 0x2F, 0x9F, 0x40,
+  0x43, 0xE0, 0x33, 0x3B, 0xE0, 0x0B, 0x00, 0xE0, 0x0B, 0x4F, 0xE0, 0x03,
+  0x27, 0xE0, 0x03, 0x1F, 0xE0, 0x0F, 0x17, 0xE0, 0x93, 0x00, 0xC0, 0xB3,
+  0xE0, 0x0B, 0xA3, 0xC0, 0x1B, 0xE0, 0x27, 0x00, 0xE0, 0x0B, 0x4B, 0xE0,
+  0x17, 0x00, 0xC0, 0x63, 0xC0, 0x27, 0x40, 0x0F, 0xC0, 0x0B, 0xE0, 0x17,
+  0x00, 0xE0, 0x23, 0x2B, 0xE0, 0x1B, 0x00, 0xE0, 0x2F, 0x4F, 0xE0, 0x2F,
+  0x37, 0xE0, 0x1B, 0x00, 0x40, 0x5B, 0xC0, 0x00, 0xE0, 0x03, 0x2F, 0x40,
+  0x13, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x63, 0x00,
+  0xE0, 0x13, 0x73, 0x40, 0x1B, 0x40, 0x00, 0xC0, 0x8F, 0xE0, 0x03, 0x0B,
+  0xC0, 0x00, 0x40, 0x13, 0xE0, 0x07, 0x00, 0xC0, 0x1B, 0xE0, 0x63, 0x00,
+  0x40, 0x83, 0xE0, 0x07, 0x6F, 0xE0, 0x0B, 0x13, 0xE0, 0x03, 0x00, 0x40,
+  0x1F, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0x40, 0x0F, 0x40, 0x07, 0xE0, 0x9F,
+  0x00, 0x40, 0xAF, 0x40, 0x00, 0xE0, 0x0B, 0xAF, 0x40, 0x17, 0xE0, 0x37,
+  0x00, 0xE0, 0x07, 0x57, 0x40, 0x4F, 0xE0, 0x07, 0x13, 0xC0, 0x00, 0xE0,
+  0x13, 0x1B, 0xE0, 0x0F, 0x00, 0x40, 0x33, 0x40, 0x00, 0xE0, 0x0F, 0x1F,
+  0xE0, 0x2B, 0x00, 0xE0, 0x47, 0x4F, 0xE0, 0x27, 0x00, 0xE0, 0x07, 0x7F,
+  0x40, 0x0F, 0xC0, 0x00, 0xC0, 0x4B, 0xC0, 0x0F, 0xE0, 0x03, 0x00, 0xC0,
+  0x1B, 0xE0, 0x63, 0x00, 0x40, 0x7F, 0xE0, 0x1B, 0x6F, 0x40, 0x27, 0x40,
+  0x00, 0x40, 0x2B, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40,
+  0x0B, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x6B, 0x00, 0x40, 0x7B, 0x40, 0x00,
+  0xE0, 0x07, 0x7B, 0xE0, 0x0B, 0x13, 0xC0, 0x00, 0x40, 0x1B, 0xE0, 0x07,
+  0x00, 0xC0, 0x1B, 0xE0, 0x8B, 0x00, 0xC0, 0xAB, 0xE0, 0x1B, 0x9B, 0xC0,
+  0x2B, 0xE0, 0x3B, 0x00, 0x40, 0x6F, 0xC0, 0x47, 0xE0, 0x07, 0x0B, 0xE0,
+  0x3B, 0x00, 0xC0, 0x5B, 0xC0, 0x00, 0xE0, 0x1B, 0x53, 0x40, 0x2B, 0xE0,
+  0x03, 0x27, 0xE0, 0x07, 0x0F, 0xE0, 0x33, 0x00, 0xE0, 0x43, 0x4B, 0xC0,
+  0x00, 0xE0, 0x0B, 0x53, 0x40, 0x13, 0xE0, 0x07, 0x00, 0xC0, 0x2F, 0xE0,
+  0x63, 0x00, 0xC0, 0x83, 0xE0, 0x0F, 0x73, 0xC0, 0x1F, 0x40, 0x00, 0xE0,
+  0x03, 0x23, 0xC0, 0x0F, 0x40, 0x07, 0x40, 0x00, 0xE0, 0x0B, 0x1B, 0xE0,
+  0x77, 0x00, 0xE0, 0x07, 0x97, 0xC0, 0x00, 0x40, 0x17, 0xE0, 0x0F, 0x00,
+  0xC0, 0x23, 0xE0, 0x9B, 0x00, 0xE0, 0x03, 0xC3, 0xE0, 0x03, 0xAF, 0xE0,
+  0x03, 0x17, 0xE0, 0x1B, 0x00, 0x40, 0x3B, 0xE0, 0x0F, 0x27, 0x40, 0x1B,
+  0xE0, 0x03, 0x00, 0xC0, 0x27, 0xE0, 0x03, 0x13, 0xE0, 0x33, 0x00, 0xC0,
+  0x4F, 0xC0, 0x00, 0xE0, 0x03, 0x4B, 0xE0, 0x13, 0x13, 0xE0, 0x07, 0x00,
+  0x40, 0x37, 0x40, 0x13, 0x40, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0x40,
+  0x00, 0x40, 0x13, 0x40, 0x07, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x0B, 0x00,
+  0xE0, 0x17, 0x1F, 0xE0, 0x37, 0x00, 0xC0, 0x5F, 0xE0, 0x07, 0x00, 0xC0,
+  0x57, 0x40, 0x17, 0xE0, 0x0B, 0x0B, 0xE0, 0x53, 0x00, 0xE0, 0x03, 0x73,
+  0xC0, 0x00, 0x40, 0x13, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x17, 0xC0, 0x0F,
+  0xE0, 0x93, 0x00, 0x40, 0xBF, 0xE0, 0x07, 0x9F, 0x40, 0x13, 0x40, 0x00,
+  0xC0, 0x17, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x17, 0xC0, 0x0B,
+  0xE0, 0x8F, 0x00, 0xE0, 0x03, 0xB7, 0x40, 0x00, 0xE0, 0x07, 0xA7, 0xE0,
+  0x03, 0x13, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x2B, 0xE0, 0x03, 0x0F,
+  0xE0, 0x0B, 0x00, 0x40, 0x23, 0xC0, 0x00, 0xE0, 0x03, 0x1F, 0xC0, 0x13,
+  0xE0, 0x37, 0x00, 0xE0, 0x03, 0x53, 0x40, 0x00, 0xE0, 0x03, 0x4F, 0x40,
+  0x0F, 0x40, 0x00, 0xE0, 0x0B, 0x13, 0xE0, 0x07, 0x00, 0xC0, 0x23, 0x40,
+  0x17, 0x40, 0x0B, 0x40, 0x07, 0x40, 0x00, 0xE0, 0x03, 0x0B, 0xC0, 0x00,
+  0x40, 0x13, 0xE0, 0x0F, 0x00, 0xC0, 0x23, 0x40, 0x00, 0xE0, 0x0F, 0x23,
+  0xE0, 0x1B, 0x00, 0x40, 0x3F, 0xC0, 0x00, 0xE0, 0x0B, 0x2F, 0xC0, 0x1B,
+  0xE0, 0x03, 0x00, 0xE0, 0x0B, 0x27, 0xE0, 0x77, 0x00, 0xE0, 0x03, 0x9F,
+  0x40, 0x00, 0xC0, 0x8F, 0x40, 0x0B, 0x40, 0x00, 0xE0, 0x03, 0x0F, 0xC0,
+  0x0B, 0xE0, 0x9B, 0x00, 0x40, 0xBB, 0xE0, 0x0B, 0x00, 0xE0, 0x1F, 0xBB,
+  0xE0, 0x03, 0x3B, 0xE0, 0x1F, 0x33, 0xE0, 0x4B, 0x00, 0x40, 0x87, 0xE0,
+  0x13, 0x57, 0x40, 0x1F, 0xE0, 0x03, 0x00, 0x40, 0x2B, 0xC0, 0x0F, 0xE0,
+  0x03, 0x0B, 0xE0, 0x0F, 0x00, 0xE0, 0x03, 0x23, 0x40, 0x0B, 0xE0, 0x43,
+  0x00, 0xE0, 0x0B, 0x73, 0xE0, 0x03, 0x5F, 0xC0, 0x1F, 0xE0, 0x03, 0x13,
+  0xE0, 0x07, 0x00, 0xC0, 0x23, 0xE0, 0x03, 0x00, 0xC0, 0x23, 0xC0, 0x13,
+  0xC0, 0x0F, 0x40, 0x00, 0x40, 0x13, 0x40, 0x07, 0xE0, 0x17, 0x00, 0xE0,
+  0x1F, 0x27, 0xE0, 0x0F, 0x00, 0x40, 0x3F, 0xE0, 0x03, 0x00, 0xE0, 0x0F,
+  0x27, 0x40, 0x00, 0xE0, 0x1F, 0x27, 0xE0, 0x5F, 0x00, 0xC0, 0x8F, 0xE0,
+  0x07, 0x6F, 0x40, 0x17, 0x40, 0x13, 0x40, 0x07, 0xE0, 0x0B, 0x00, 0x40,
+  0x1B, 0xE0, 0x0B, 0x00, 0x40, 0x2B, 0xE0, 0x0B, 0x17, 0xE0, 0x77, 0x00,
+  0x40, 0x97, 0xE0, 0x07, 0x00, 0xE0, 0x77, 0x93, 0xE0, 0x47, 0x00, 0xC0,
+  0xDF, 0xE0, 0x07, 0x57, 0xC0, 0x17, 0xE0, 0x23, 0x00, 0xE0, 0x07, 0x43,
+  0xE0, 0x37, 0x00, 0xE0, 0x0B, 0x7B, 0x40, 0x53, 0xE0, 0x03, 0x17, 0xE0,
+  0x17, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x2B, 0xE0, 0x07, 0x00, 0x40, 0x1F,
+  0xE0, 0x07, 0x13, 0xE0, 0x1B, 0x00, 0xE0, 0x2F, 0x37, 0xC0, 0x00, 0xE0,
+  0x03, 0x3F, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x13, 0x40, 0x0B,
+  0xC0, 0x00, 0xE0, 0x0B, 0x1F, 0xE0, 0x6B, 0x00, 0x40, 0x8F, 0xE0, 0x13,
+  0x77, 0x40, 0x1F, 0xE0, 0x07, 0x00, 0xE0, 0x13, 0x2F, 0xE0, 0x93, 0x00,
+  0xC0, 0xC7, 0xE0, 0x93, 0xA3, 0xE0, 0x17, 0x00, 0x40, 0xC3, 0xE0, 0x0B,
+  0x23, 0xE0, 0x0F, 0x17, 0xE0, 0x07, 0x00, 0x40, 0x27, 0xE0, 0x1F, 0x00,
+  0xE0, 0x07, 0x3B, 0xE0, 0x33, 0x00, 0xE0, 0x03, 0x73, 0xE0, 0x0F, 0x47,
+  0xE0, 0x03, 0x23, 0xE0, 0x03, 0x00, 0x40, 0x2F, 0xE0, 0x07, 0x0F, 0xE0,
+  0x07, 0x00, 0xC0, 0x1F, 0xE0, 0x07, 0x17, 0xE0, 0x13, 0x00, 0x40, 0x33,
+  0xE0, 0x13, 0x1F, 0xE0, 0x27, 0x00, 0x40, 0x4F, 0xC0, 0x00, 0xE0, 0x0F,
+  0x3B, 0x40, 0x1F, 0xC0, 0x1B, 0x40, 0x0B, 0x40, 0x00, 0xC0, 0x0F, 0xE0,
+  0x03, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x43, 0x00, 0x40, 0x63, 0x40, 0x00,
+  0xE0, 0x1B, 0x53, 0x40, 0x27, 0xC0, 0x00, 0xE0, 0x1B, 0x2F, 0xE0, 0x6B,
+  0x00, 0xE0, 0x1B, 0x9F, 0xE0, 0x1B, 0x23, 0xE0, 0x97, 0x00, 0xE0, 0x37,
+  0xC3, 0xC0, 0x3F, 0xE0, 0x17, 0x00, 0xE1, 0x43, 0x07, 0x40, 0x6B, 0xC0,
+  0x4F, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0x40, 0x13, 0xE0, 0x0B, 0x00, 0xE0,
+  0x0B, 0x1F, 0xC0, 0x13, 0xE0, 0x8B, 0x00, 0xC0, 0xC3, 0xE0, 0x07, 0x9B,
+  0xC0, 0x17, 0xC0, 0x00, 0x40, 0x1F, 0xC0, 0x0B, 0xC0, 0x00, 0x40, 0x13,
+  0xE0, 0x5B, 0x00, 0xC0, 0x6F, 0x40, 0x00, 0xE0, 0x27, 0x6F, 0x40, 0x33,
+  0x40, 0x00, 0xE0, 0x27, 0x37, 0xE0, 0x57, 0x00, 0x40, 0x93, 0xE0, 0x03,
+  0x00, 0xE0, 0x0F, 0x6F, 0x40, 0x23, 0xE0, 0x0B, 0x1B, 0xE0, 0x0F, 0x17,
+  0xE0, 0xBF, 0x00, 0xC0, 0xDF, 0x40, 0x07, 0xE0, 0x07, 0x00, 0x40, 0xE3,
+  0x40, 0x13, 0x40, 0x07, 0x40, 0x00, 0xC0, 0x0B, 0x40, 0x07, 0x40, 0x00,
+  0x40, 0x13, 0xE0, 0x53, 0x00, 0x40, 0x63, 0xE0, 0x0B, 0x00, 0xE0, 0x03,
+  0x73, 0xC0, 0x1F, 0xE0, 0x03, 0x13, 0xE0, 0x2B, 0x00, 0x40, 0x47, 0xE0,
+  0x2B, 0x37, 0xE0, 0x2F, 0x00, 0x40, 0x6F, 0xE0, 0x13, 0x00, 0xC0, 0x57,
+  0x40, 0x23, 0xC0, 0x0B, 0xE0, 0x53, 0x00, 0x40, 0x67, 0xC0, 0x00, 0xE0,
+  0x2F, 0x67, 0xE0, 0x3B, 0x3F, 0xE0, 0x2F, 0x7B, 0xE0, 0x33, 0x00, 0xE0,
+  0x17, 0xB7, 0x40, 0x1F, 0xE0, 0x33, 0x5F, 0xE0, 0x93, 0x00, 0x40, 0xDB,
+  0xE0, 0x07, 0x00, 0xE0, 0x13, 0xAF, 0xE0, 0x23, 0x2B, 0x40, 0x00, 0xC0,
+  0x2F, 0x40, 0x0B, 0xE0, 0x1F, 0x00, 0x40, 0x33, 0xE0, 0x4B, 0x2B, 0xE0,
+  0x63, 0x00, 0xE0, 0x1B, 0xC3, 0x40, 0x23, 0xE0, 0x0F, 0x00, 0xE0, 0x63,
+  0xAB, 0x40, 0x00, 0xE0, 0x07, 0x87, 0x40, 0x13, 0xE0, 0x2B, 0x00, 0x40,
+  0x47, 0xE0, 0x2B, 0x37, 0xE0, 0x4F, 0x00, 0x40, 0x8F, 0x40, 0x00, 0xE0,
+  0x0F, 0x5F, 0x40, 0x1B, 0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x27, 0xE0, 0xD3,
+  0x00, 0x40, 0xFF, 0x40, 0xDF, 0x40, 0x07, 0xC0, 0x00, 0x40, 0x0F, 0xE0,
+  0x03, 0x00, 0xE0, 0x03, 0x17, 0xE0, 0x03, 0x0B, 0xE0, 0x1B, 0x00, 0x40,
+  0x2F, 0xE0, 0x1B, 0x27, 0xC0, 0x00, 0x40, 0x2F, 0x40, 0x00, 0xC0, 0x0F,
+  0xE0, 0x47, 0x00, 0xE0, 0x53, 0x5B, 0xE0, 0x0F, 0x00, 0x40, 0x73, 0xE0,
+  0x03, 0x00, 0x40, 0x27, 0xE0, 0x03, 0x0F, 0xE0, 0x0B, 0x00, 0x40, 0x23,
+  0xE0, 0x37, 0x00, 0x40, 0x57, 0xC0, 0x43, 0x40, 0x0B, 0x40, 0x00, 0xC0,
+  0x0F, 0xE0, 0x0B, 0x00, 0x40, 0x1F, 0xC0, 0x00, 0xE0, 0x0B, 0x1F, 0xE0,
+  0xA7, 0x00, 0xE0, 0x13, 0xCB, 0xC0, 0x1B, 0xE0, 0x03, 0x00, 0xC0, 0xDF,
+  0x40, 0x13, 0xC0, 0x0B, 0xE0, 0x23, 0x00, 0xE0, 0x1F, 0x37, 0xE0, 0x1F,
+  0x27, 0xE0, 0x37, 0x00, 0x40, 0x67, 0x40, 0x00, 0xE0, 0x17, 0x47, 0x40,
+  0x23, 0xC0, 0x00, 0x40, 0x2B, 0xC0, 0x0B, 0x40, 0x00, 0x40, 0x0F, 0xE0,
+  0x03, 0x00, 0x40, 0x13, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x37, 0x00,
+  0x40, 0x4F, 0xE0, 0x07, 0x00, 0xE0, 0x37, 0x53, 0x40, 0x00, 0x40, 0x53,
+  0x40, 0x07, 0xE0, 0x17, 0x00, 0x40, 0x27, 0xC0, 0x00, 0xE0, 0x17, 0x2B,
+  0xE0, 0x1F, 0x00, 0x40, 0x4F, 0xE0, 0x07, 0x2B, 0x40, 0x13, 0x40, 0x00,
+  0x40, 0x17, 0x40, 0x07, 0xE0, 0x13, 0x00, 0x40, 0x23, 0xE0, 0x37, 0x00,
+  0x40, 0x5F, 0xE0, 0x1B, 0x43, 0x40, 0x27, 0xE0, 0x0B, 0x00, 0xE0, 0x1B,
+  0x3B, 0xE0, 0x8F, 0x00, 0xC0, 0xCF, 0xE0, 0x0B, 0x9F, 0xC0, 0x1B, 0xE0,
+  0x07, 0x00, 0xE0, 0x0B, 0x2B, 0xE0, 0x13, 0x00, 0x40, 0x3F, 0xE0, 0x13,
+  0x1F, 0xE0, 0x0F, 0x00, 0xE0, 0x2F, 0x37, 0xE0, 0x27, 0x00, 0x40, 0x67,
+  0xE0, 0x03, 0x00, 0x40, 0x3F, 0xC0, 0x0F, 0x40, 0x0B, 0x40, 0x00, 0xC0,
+  0x0F, 0x40, 0x00, 0xE0, 0x03, 0x0F, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0x40,
+  0x1F, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x1F, 0xE0, 0x23, 0x00, 0x40, 0x47,
+  0xE0, 0x03, 0x2F, 0x40, 0x0F, 0x40, 0x00, 0x40, 0x13, 0x40, 0x07, 0x40,
+  0x00, 0x40, 0x0B, 0xE0, 0x3B, 0x00, 0xE0, 0x13, 0x4B, 0x40, 0x1B, 0xE0,
+  0x07, 0x00, 0xE0, 0x37, 0x73, 0xE0, 0x03, 0x4F, 0xE0, 0x07, 0x4B, 0xC0,
+  0x1B, 0x40, 0x17, 0xC0, 0x0B, 0xC0, 0x00, 0xE0, 0x0F, 0x13, 0xE0, 0x33,
+  0x00, 0xE0, 0x03, 0x5B, 0xE0, 0x0F, 0x00, 0xC0, 0x23, 0xC0, 0x00, 0x40,
+  0x27, 0xE0, 0x03, 0x0B, 0xE0, 0x23, 0x00, 0x40, 0x37, 0xE0, 0x23, 0x2F,
+  0xE0, 0x27, 0x00, 0x40, 0x5F, 0x40, 0x00, 0x40, 0x37, 0x40, 0x07, 0x40,
+  0x00, 0x40, 0x0B, 0xE0, 0x0B, 0x00, 0x40, 0x1B, 0xE0, 0x03, 0x00, 0xE0,
+  0x0B, 0x23, 0xE0, 0x0B, 0x00, 0x40, 0x33, 0xE0, 0x0B, 0x17, 0xE0, 0x0B,
+  0x00, 0xE0, 0x23, 0x2B, 0xE0, 0x03, 0x00, 0xE0, 0x2F, 0x37, 0xE0, 0x1B,
+  0x00, 0xE0, 0x07, 0x5B, 0x40, 0x0F, 0xC0, 0x00, 0xC0, 0x3F, 0xC0, 0x0F,
+  0xE0, 0x03, 0x00, 0x40, 0x1B, 0xE0, 0x07, 0x0F, 0xE0, 0x03, 0x00, 0xE0,
+  0x0F, 0x1B, 0x40, 0x17, 0xE0, 0x1B, 0x27, 0xE0, 0x3B, 0x00, 0xE0, 0x07,
+  0x6B, 0xE0, 0xA3, 0x00, 0x40, 0xBB, 0xC0, 0x00, 0x40, 0xB7, 0xC0, 0x0B,
+  0xE0, 0x13, 0x00, 0x40, 0x27, 0xE0, 0x33, 0x00, 0xE0, 0x03, 0x5B, 0xE0,
+  0x0F, 0x47, 0xE0, 0x03, 0x23, 0xC0, 0x00, 0x40, 0x2B, 0x40, 0x0B, 0x40,
+  0x07, 0x40, 0x00, 0xE0, 0x03, 0x0B, 0xE0, 0x23, 0x00, 0x40, 0x37, 0x40,
+  0x00, 0xE0, 0x23, 0x33, 0xE0, 0x4B, 0x00, 0x40, 0x83, 0xE0, 0x07, 0x00,
+  0xE0, 0x4B, 0x67, 0xE0, 0x7B, 0x00, 0x40, 0xE7, 0x40, 0x87, 0xE0, 0x03,
+  0x07, 0x40, 0x00, 0x40, 0x13, 0xE0, 0x07, 0x00, 0xE0, 0x2B, 0x17, 0x40,
+  0x00, 0xE0, 0x07, 0x47, 0xC0, 0x00, 0x40, 0x1B, 0xC0, 0x00, 0xC0, 0x13,
+  0xE0, 0x03, 0x00, 0x40, 0x1B, 0xE0, 0x03, 0x0F, 0xE0, 0x07, 0x00, 0xE0,
+  0x17, 0x1F, 0x40, 0x00, 0xE0, 0x1B, 0x23, 0xE0, 0x8F, 0x00, 0x40, 0xBB,
+  0xE0, 0x1B, 0x00, 0xE0, 0x3F, 0xBF, 0xE0, 0x07, 0x6B, 0xC0, 0x57, 0xE0,
+  0x07, 0x17, 0xC0, 0x00, 0xE0, 0x07, 0x1F, 0xC0, 0x0F, 0x40, 0x00, 0xE0,
+  0x07, 0x23, 0xE0, 0x17, 0x00, 0xC0, 0x2F, 0x40, 0x00, 0xE0, 0x17, 0x2B,
+  0xE0, 0x53, 0x00, 0x40, 0x7F, 0x40, 0x00, 0x40, 0x63, 0x40, 0x07, 0x40,
+  0x00, 0x40, 0x0B, 0xE0, 0xD3, 0x00, 0x40, 0xE3, 0x40, 0x00, 0xE0, 0x3F,
+  0xE3, 0x40, 0x4B, 0xE0, 0x03, 0x00, 0xE0, 0x0B, 0x57, 0xC0, 0x1F, 0xE0,
+  0x0B, 0x1B, 0xC0, 0x00, 0x40, 0x23, 0xC0, 0x0B, 0xE0, 0x0B, 0x00, 0xE0,
+  0x17, 0x1F, 0xE0, 0x07, 0x00, 0xE0, 0x27, 0x2F, 0xE0, 0x27, 0x00, 0xE0,
+  0x3F, 0x5F, 0xE0, 0x03, 0x47, 0x40, 0x0B, 0xE0, 0x17, 0x00, 0xE0, 0x27,
+  0xA7, 0xE0, 0x27, 0x00, 0xE0, 0x0B, 0x7F, 0xE0, 0x03, 0x43, 0xC0, 0x1F,
+  0xE0, 0x0B, 0x13, 0x40, 0x00, 0xE0, 0x03, 0x17, 0xE0, 0x53, 0x00, 0xE0,
+  0x1F, 0x6B, 0xE0, 0x07, 0x27, 0xE0, 0x03, 0x0F, 0x40, 0x0B, 0xE0, 0x03,
+  0x00, 0xE0, 0x53, 0xAF, 0xE0, 0x07, 0x00, 0x40, 0x77, 0xE0, 0x07, 0x13,
+  0xE0, 0x57, 0x00, 0x40, 0x73, 0xE0, 0x03, 0x00, 0xE0, 0x57, 0x6F, 0xE0,
+  0x1F, 0x00, 0xC0, 0x93, 0xE0, 0x1F, 0x2F, 0xE0, 0x6B, 0x00, 0xE0, 0x47,
+  0xA3, 0xC0, 0x4F, 0xE0, 0x27, 0x00, 0xE0, 0x6B, 0xFB, 0xE0, 0x03, 0x00,
+  0x40, 0xAF, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00,
+  0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x93, 0x00, 0xE0, 0x07, 0xA3,
+  0x40, 0x0F, 0x40, 0x00, 0xE0, 0x67, 0xB3, 0x40, 0x73, 0x40, 0x00, 0xE0,
+  0x7F, 0x77, 0x40, 0x8B, 0xC0, 0x00, 0xE0, 0x13, 0x93, 0x40, 0x23, 0xE0,
+  0x13, 0x1F, 0xE0, 0x03, 0x00, 0xE0, 0x13, 0x2B, 0x40, 0x1B, 0x40, 0x00,
+  0x40, 0x2F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x8F, 0x00, 0x40,
+  0x9F, 0xC0, 0x00, 0xE0, 0x3B, 0xA3, 0xC0, 0x4B, 0xE0, 0x2B, 0x00, 0xE0,
+  0x1B, 0x7F, 0xC0, 0x57, 0xE0, 0x1B, 0x2B, 0xE0, 0x3B, 0x00, 0x40, 0x6F,
+  0xE0, 0x3B, 0x47, 0xE0, 0x27, 0x00, 0xE0, 0x27, 0x77, 0xE0, 0x07, 0x2F,
+  0x40, 0x0F, 0x40, 0x00, 0xC0, 0x77, 0xE0, 0x03, 0x0B, 0xE0, 0x53, 0x00,
+  0xE0, 0x3F, 0x67, 0xE0, 0x3F, 0x47, 0xE0, 0x47, 0x00, 0x40, 0x97, 0xC0,
+  0x00, 0xE0, 0x3F, 0x5B, 0x40, 0x4F, 0xE0, 0x3F, 0x4B, 0xE0, 0x13, 0x00,
+  0x40, 0x67, 0xC0, 0x00, 0x40, 0x27, 0xC0, 0x0B, 0xC0, 0x00, 0x40, 0x13,
+  0xE0, 0x37, 0x00, 0xC0, 0x4B, 0xE0, 0x2B, 0x00, 0xE0, 0x1B, 0x7B, 0xE0,
+  0x03, 0x57, 0xE0, 0x1B, 0x2F, 0xE0, 0xFF, 0x00, 0x00, 0x41, 0x37, 0xE1,
+  0x33, 0x0B, 0xE0, 0x27, 0x3F, 0x40, 0x2F, 0x40, 0x00, 0xE0, 0x2F, 0x73,
+  0x40, 0x3B, 0xC0, 0x00, 0xE0, 0x2F, 0x43, 0xE0, 0x33, 0x00, 0xE0, 0x17,
+  0x7B, 0xE0, 0x17, 0x1F, 0xE0, 0x17, 0x00, 0xC0, 0x3F, 0xE0, 0x03, 0x00,
+  0xE0, 0x17, 0x33, 0xE0, 0x33, 0x00, 0xE0, 0x03, 0x67, 0x40, 0x00, 0xE0,
+  0x33, 0x4B, 0xE0, 0x0F, 0x00, 0x40, 0x57, 0xE0, 0x2F, 0x00, 0x40, 0x53,
+  0x40, 0x3B, 0x40, 0x07, 0xE0, 0x17, 0x00, 0x40, 0x27, 0x40, 0x00, 0xE0,
+  0x17, 0x27, 0xE0, 0x83, 0x00, 0xC0, 0xAF, 0xC0, 0x07, 0xE0, 0xA7, 0x00,
+  0xE0, 0x27, 0xB7, 0xE0, 0x27, 0x2F, 0xE0, 0x4B, 0x00, 0xE0, 0x33, 0x83,
+  0x40, 0x3B, 0x40, 0x00, 0x40, 0x97, 0x40, 0x07, 0xC0, 0x00, 0x40, 0x0F,
+  0xE0, 0x03, 0x00, 0x40, 0x17, 0xE0, 0x03, 0x0F, 0xE0, 0x1F, 0x00, 0x40,
+  0x37, 0xE0, 0x07, 0x00, 0xE0, 0x1F, 0x3B, 0xE0, 0x1B, 0x00, 0x40, 0x5B,
+  0xE0, 0x03, 0x27, 0x40, 0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x1B, 0xE0,
+  0x3F, 0x00, 0xE0, 0x03, 0x5F, 0xE0, 0x33, 0x00, 0xE0, 0x17, 0x8F, 0xC0,
+  0x5B, 0xE0, 0x17, 0x27, 0xE0, 0x7F, 0x00, 0xC0, 0xAF, 0x40, 0x00, 0xE0,
+  0x7F, 0x93, 0xE0, 0xB7, 0x00, 0xE1, 0x1B, 0x4B, 0xC0, 0x23, 0x40, 0x07,
+  0x40, 0x00, 0xE0, 0x23, 0xF3, 0xE0, 0x03, 0x2F, 0x40, 0x0B, 0xC0, 0x00,
+  0xE0, 0x23, 0x43, 0xE0, 0x1B, 0x00, 0xC0, 0x57, 0x40, 0x00, 0xE0, 0x1B,
+  0x2F, 0xE0, 0x1F, 0x00, 0xE0, 0x07, 0x4F, 0x40, 0x0F, 0xE0, 0x0B, 0x00,
+  0xE0, 0x1F, 0x4F, 0xE0, 0x1F, 0x00, 0xC0, 0x63, 0x40, 0x2F, 0xC0, 0x0B,
+  0xE0, 0x27, 0x00, 0x40, 0x3B, 0xE0, 0x07, 0x00, 0x40, 0x43, 0x40, 0x13,
+  0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0xA3, 0x00, 0xE0, 0x17, 0xB3,
+  0xE0, 0x17, 0x1F, 0xE0, 0x2F, 0x00, 0xE0, 0x03, 0x57, 0x40, 0x0B, 0x40,
+  0x00, 0x40, 0x4B, 0xC0, 0x07, 0xE0, 0xFF, 0x10, 0x00, 0xE1, 0x07, 0x1F,
+  0xE0, 0x07, 0x0F, 0xE0, 0x3F, 0x00, 0x40, 0x57, 0xC0, 0x00, 0xE0, 0x3F,
+  0x53, 0x40, 0x00, 0xE0, 0x07, 0x53, 0xE0, 0x03, 0x0F, 0xC0, 0x0B, 0xE0,
+  0x03, 0x00, 0x40, 0x33, 0xE0, 0x3B, 0x00, 0x40, 0x53, 0xE0, 0x17, 0x47,
+  0x40, 0x23, 0x40, 0x00, 0x40, 0x27, 0x40, 0x07, 0xC0, 0x00, 0xC0, 0x0F,
+  0x40, 0x07, 0xE0, 0x03, 0x00, 0xC0, 0x1F, 0xE0, 0x03, 0x00, 0xE0, 0x03,
+  0x1F, 0xE0, 0x47, 0x00, 0xC0, 0x67, 0xE0, 0x37, 0x57, 0xE0, 0x13, 0x47,
+  0x40, 0x1B, 0xE0, 0x37, 0x5F, 0xE0, 0x17, 0x00, 0x40, 0x63, 0xE0, 0x1B,
+  0x00, 0xE0, 0x0B, 0x47, 0xC0, 0x37, 0xE0, 0x0B, 0x1B, 0xE0, 0x03, 0x00,
+  0x40, 0x27, 0xE0, 0x03, 0x0F, 0xE0, 0xB3, 0x00, 0xE0, 0x0F, 0xCB, 0x40,
+  0x17, 0x40, 0x00, 0xE0, 0x3F, 0xDB, 0x40, 0x4B, 0xE0, 0x03, 0x00, 0xE0,
+  0x3F, 0x57, 0xE0, 0x03, 0x00, 0xC0, 0x5F, 0xC0, 0x13, 0x40, 0x0F, 0xE0,
+  0x03, 0x0B, 0xE0, 0x03, 0x00, 0xC0, 0x17, 0xE0, 0x63, 0x00, 0xE0, 0x03,
+  0x7F, 0x40, 0x00, 0xE0, 0x0B, 0x7B, 0xE0, 0x0B, 0x17, 0x40, 0x13, 0xC0,
+  0x00, 0xE0, 0x0B, 0x33, 0xE0, 0x37, 0x00, 0xC0, 0x5B, 0xC0, 0x00, 0xE0,
+  0x33, 0x4F, 0xC0, 0x43, 0x40, 0x00, 0xC0, 0x47, 0xE0, 0x03, 0x0B, 0xC0,
+  0x00, 0xC0, 0x13, 0x40, 0x07, 0x40, 0x00, 0xC0, 0x17, 0xE0, 0x3B, 0x00,
+  0x40, 0x4F, 0xE0, 0x17, 0x00, 0xE0, 0x37, 0x67, 0x40, 0x5F, 0x40, 0x43,
+  0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x3F, 0x00, 0xE0, 0x47, 0x4F,
+  0xE0, 0x13, 0x00, 0xE0, 0x53, 0x6B, 0xE0, 0x53, 0x5B, 0xE0, 0x07, 0x00,
+  0x40, 0x6B, 0x40, 0x00, 0xC0, 0x17, 0x40, 0x0B, 0x40, 0x00, 0xE0, 0x07,
+  0x0F, 0x40, 0x00, 0xC0, 0x13, 0xE0, 0x3F, 0x00, 0x40, 0x53, 0x40, 0x00,
+  0xE0, 0x03, 0x4F, 0x40, 0x0F, 0xC0, 0x00, 0xC0, 0x17, 0xC0, 0x0F, 0xC0,
+  0x00, 0x40, 0x17, 0x40, 0x0B, 0x40, 0x07, 0xE0, 0x1B, 0x00, 0xE0, 0x23,
+  0x2B, 0xE0, 0x1B, 0x00, 0x40, 0x4F, 0x40, 0x00, 0xC0, 0x2B, 0xE0, 0x0F,
+  0x0B, 0xE0, 0x1B, 0x00, 0x40, 0x3B, 0x40, 0x00, 0x40, 0x2B, 0x40, 0x07,
+  0x40, 0x00, 0xC0, 0x0B, 0x40, 0x07, 0xE0, 0x0F, 0x00, 0x40, 0x27, 0x40,
+  0x00, 0xE0, 0x0F, 0x1F, 0xE0, 0x33, 0x00, 0xE0, 0x0F, 0x57, 0x40, 0x17,
+  0x40, 0x00, 0xE0, 0x33, 0x5B, 0xC0, 0x00, 0x40, 0x47, 0xC0, 0x00, 0xC0,
+  0x13, 0xE0, 0x77, 0x00, 0xE0, 0x33, 0x8F, 0xE0, 0x13, 0x3B, 0x40, 0x1B,
+  0xE0, 0x27, 0xDB, 0xE0, 0x1B, 0x33, 0xE0, 0x03, 0x23, 0xE0, 0x0F, 0x0B,
+  0xE0, 0x17, 0x00, 0x40, 0x37, 0xE0, 0x0F, 0x00, 0x40, 0x3B, 0xE0, 0x03,
+  0x1B, 0x40, 0x0F, 0x40, 0x00, 0x40, 0x13, 0x40, 0x07, 0xE0, 0x37, 0x00,
+  0xE0, 0x07, 0x47, 0x40, 0x0F, 0xC0, 0x00, 0xE0, 0x0B, 0x5B, 0x40, 0x1B,
+  0xE0, 0x0B, 0x17, 0xE0, 0x17, 0x00, 0xE0, 0x2F, 0x37, 0xE0, 0x23, 0x00,
+  0x40, 0x63, 0xE0, 0x03, 0x00, 0xE0, 0x37, 0x3B, 0x40, 0x4B, 0xE0, 0x23,
+  0x43, 0xE0, 0x3B, 0x00, 0x40, 0x73, 0xC0, 0x00, 0xE0, 0x03, 0x4F, 0x40,
+  0x13, 0xE0, 0x03, 0x0F, 0xE0, 0x2F, 0x00, 0xE0, 0x17, 0x47, 0xE0, 0x17,
+  0x1F, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x2F, 0xE0, 0x03, 0x0B, 0xE0, 0x2F,
+  0x00, 0xE0, 0x37, 0x43, 0x40, 0x3F, 0x40, 0x00, 0xE0, 0x2F, 0x7F, 0xE0,
+  0x23, 0x00, 0x40, 0x67, 0xC0, 0x00, 0xC0, 0x37, 0xC0, 0x0F, 0x40, 0x00,
+  0xC0, 0x13, 0xE0, 0x0B, 0x00, 0x40, 0x1F, 0xE0, 0x0B, 0x00, 0x40, 0x2B,
+  0xE0, 0x03, 0x17, 0x40, 0x0F, 0x40, 0x00, 0x40, 0x13, 0x40, 0x07, 0x40,
+  0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x37, 0x00, 0xE0, 0x03,
+  0x47, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x37, 0x5B, 0x40, 0x00, 0xC0,
+  0x4F, 0x40, 0x0B, 0xE0, 0x57, 0x00, 0xE0, 0x03, 0x6B, 0x40, 0x0B, 0xE0,
+  0x0B, 0x6F, 0x40, 0x17, 0x40, 0x00, 0xE0, 0x1F, 0x1B, 0x40, 0x2B, 0x40,
+  0x00, 0xE0, 0x0B, 0x2F, 0xE0, 0x27, 0x00, 0xE0, 0x1B, 0x47, 0x40, 0x23,
+  0xE0, 0x07, 0x00, 0x40, 0x67, 0x40, 0x13, 0x40, 0x07, 0xE0, 0x13, 0x00,
+  0x40, 0x23, 0x40, 0x00, 0xE0, 0x1B, 0x23, 0x40, 0x00, 0xE0, 0x03, 0x27,
+  0x40, 0x0F, 0xC0, 0x00, 0xE0, 0x07, 0x17, 0xE0, 0x03, 0x0F, 0xE0, 0x07,
+  0x00, 0xC0, 0x33, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x27, 0xE0, 0x5F, 0x00,
+  0xE0, 0x03, 0x87, 0xE0, 0x1F, 0x73, 0x40, 0x33, 0xE0, 0x1B, 0x2B, 0xE0,
+  0x07, 0x27, 0x40, 0x0F, 0xE0, 0x0F, 0x00, 0xE0, 0x1F, 0x4F, 0xE0, 0x07,
+  0x00, 0x40, 0x37, 0xE0, 0x07, 0x13, 0xC0, 0x00, 0x40, 0x1B, 0x40, 0x00,
+  0xC0, 0x0F, 0x40, 0x00, 0x40, 0x0F, 0xE0, 0x33, 0x00, 0xE0, 0x03, 0x43,
+  0x40, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x33, 0x57, 0xE0, 0x6F, 0x00, 0xE0,
+  0x2F, 0xBF, 0xE0, 0x03, 0x37, 0xE0, 0x07, 0x00, 0xE0, 0x43, 0xCB, 0x40,
+  0x5B, 0xE0, 0x03, 0x4F, 0xE0, 0x0B, 0x0F, 0x40, 0x00, 0xC0, 0x23, 0xE0,
+  0x03, 0x0B, 0xE0, 0x1B, 0x00, 0x40, 0x2F, 0x40, 0x00, 0xE0, 0x07, 0x2B,
+  0xE0, 0x0B, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x1F, 0xE0, 0x03, 0x00, 0x40,
+  0x1B, 0xC0, 0x0F, 0x40, 0x0B, 0xE0, 0x17, 0x00, 0xC0, 0x2B, 0xE0, 0x0B,
+  0x00, 0xE0, 0x17, 0x3B, 0xE0, 0x43, 0x00, 0xC0, 0x7F, 0xE0, 0x43, 0x53,
+  0xC0, 0x00, 0xC0, 0x5B, 0xC0, 0x00, 0x40, 0x17, 0xC0, 0x0B, 0xE0, 0x03,
+  0x00, 0x40, 0x17, 0x40, 0x00, 0x40, 0x13, 0x40, 0x07, 0xE0, 0x0B, 0x00,
+  0x40, 0x1B, 0xE0, 0x0B, 0x00, 0xE0, 0x03, 0x2B, 0xE0, 0x03, 0x1F, 0xE0,
+  0x03, 0x17, 0x40, 0x00, 0xC0, 0x1B, 0x40, 0x0B, 0xE0, 0x33, 0x00, 0x40,
+  0x47, 0xE0, 0x07, 0x3F, 0x40, 0x13, 0xE0, 0x0B, 0x00, 0xE0, 0x07, 0x27,
+  0xE0, 0x8B, 0x00, 0xE0, 0x07, 0xB7, 0xE0, 0x1B, 0xA3, 0xE0, 0x07, 0x33,
+  0xE0, 0x0B, 0x00, 0xE0, 0x1B, 0x47, 0xE0, 0x5F, 0x00, 0x40, 0x9F, 0xE0,
+  0x0F, 0x6B, 0x40, 0x1B, 0xE0, 0x0F, 0x00, 0xE0, 0x23, 0x33, 0x40, 0x2B,
+  0xE0, 0x0B, 0x47, 0x40, 0x17, 0xE0, 0x17, 0x00, 0xE0, 0x07, 0x37, 0xE0,
+  0x17, 0x2F, 0xE0, 0x07, 0x00, 0x40, 0x3F, 0xE0, 0x07, 0x13, 0xE0, 0x0F,
+  0x00, 0xE0, 0x07, 0x2B, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x03, 0x2F, 0xE0,
+  0x07, 0x0F, 0xE0, 0x2F, 0x00, 0x40, 0x47, 0xE0, 0x03, 0x00, 0x40, 0x47,
+  0xC0, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0xC0, 0x13, 0xE0, 0x03, 0x00, 0x40,
+  0x1B, 0xE0, 0x03, 0x0F, 0xE0, 0x17, 0x00, 0x40, 0x2F, 0x40, 0x00, 0x40,
+  0x27, 0x40, 0x07, 0xC0, 0x00, 0x40, 0x0F, 0xC0, 0x00, 0xC0, 0x13, 0xE0,
+  0x47, 0x00, 0xC0, 0x5F, 0xE0, 0x03, 0x00, 0xE0, 0x47, 0x63, 0xE0, 0x27,
+  0x00, 0x40, 0x8B, 0xE0, 0x13, 0x33, 0x40, 0x1F, 0xE0, 0x07, 0x00, 0xE0,
+  0x13, 0x2F, 0xE0, 0x07, 0x00, 0xC0, 0x3B, 0xC0, 0x17, 0xC0, 0x0F, 0xC0,
+  0x00, 0xC0, 0x17, 0xE0, 0x4F, 0x00, 0x40, 0x67, 0xE0, 0x33, 0x5B, 0xC0,
+  0x3F, 0x40, 0x07, 0x40, 0x00, 0xE0, 0x03, 0x4B, 0x40, 0x0F, 0x40, 0x00,
+  0xE0, 0x03, 0x13, 0xE0, 0x0F, 0x00, 0xE0, 0x07, 0x27, 0x40, 0x0F, 0x40,
+  0x00, 0xE0, 0x03, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0xC0, 0x17, 0xC0, 0x0F,
+  0xE0, 0x0B, 0x00, 0xC0, 0x23, 0xE0, 0x5B, 0x00, 0x40, 0x7F, 0xE0, 0x03,
+  0x67, 0xE0, 0x07, 0x0F, 0x40, 0x00, 0xE0, 0x0B, 0x13, 0xE0, 0x1F, 0x00,
+  0xE0, 0x03, 0x3B, 0x40, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x3F, 0xC0, 0x13,
+  0xE0, 0x2F, 0x00, 0xE0, 0x03, 0x4B, 0xE0, 0x0F, 0x00, 0x40, 0x5B, 0xE0,
+  0x0F, 0x1B, 0xE0, 0x2F, 0x00, 0x40, 0x53, 0xE0, 0x03, 0x00, 0x40, 0x47,
+  0x40, 0x0F, 0x40, 0x07, 0xE0, 0x5F, 0x00, 0xE0, 0x0F, 0x6F, 0xE0, 0x03,
+  0x17, 0xE0, 0x03, 0x0B, 0x40, 0x00, 0x40, 0x0F, 0xE0, 0x03, 0x00, 0x40,
+  0x13, 0xE0, 0x13, 0x00, 0x40, 0x2B, 0xE0, 0x03, 0x1F, 0x40, 0x0F, 0x40,
+  0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x00, 0xE0, 0x13, 0x1B, 0xE0, 0x3F,
+  0x00, 0xE0, 0x17, 0x63, 0x40, 0x1F, 0xC0, 0x00, 0x40, 0x73, 0xE0, 0x03,
+  0x0B, 0x40, 0x00, 0xC0, 0x0F, 0xC0, 0x00, 0x40, 0x13, 0xC0, 0x00, 0xC0,
+  0x13, 0x40, 0x00, 0xC0, 0x13, 0xE0, 0x0B, 0x00, 0x40, 0x1F, 0x40, 0x00,
+  0xE0, 0x03, 0x1B, 0xE0, 0x07, 0x0F, 0x40, 0x00, 0x40, 0x13, 0xE0, 0x1B,
+  0x00, 0xE0, 0x03, 0x2B, 0x40, 0x0B, 0xE0, 0x67, 0x00, 0x40, 0xA3, 0xE0,
+  0x67, 0x73, 0xC0, 0x00, 0x40, 0x7B, 0xE0, 0x37, 0x00, 0xC0, 0x4B, 0xE0,
+  0x67, 0x00, 0x40, 0xB7, 0xC0, 0x73, 0xE0, 0x03, 0x0B, 0xE0, 0x73, 0x00,
+  0xE0, 0x07, 0x87, 0x40, 0x0F, 0xE0, 0x0F, 0x00, 0xE0, 0x33, 0xA7, 0x40,
+  0x53, 0xE0, 0x07, 0x3F, 0x40, 0x13, 0x40, 0x00, 0xE0, 0x07, 0x17, 0xE0,
+  0x67, 0x00, 0x40, 0x83, 0xE0, 0x13, 0x00, 0xE0, 0x0F, 0x8F, 0xE0, 0x0F,
+  0x33, 0xE0, 0x07, 0x2F, 0xE0, 0x37, 0x27, 0xE0, 0x07, 0x00, 0xE0, 0x07,
+  0x5F, 0xE0, 0x67, 0x00, 0xE0, 0x13, 0x8F, 0x40, 0x1B, 0xE0, 0x37, 0x8F,
+  0xE0, 0x07, 0x43, 0xE0, 0x0B, 0x0F, 0xE0, 0x3F, 0x00, 0xE0, 0x0B, 0xAB,
+  0x40, 0x5B, 0xE0, 0x0B, 0x17, 0xE0, 0x37, 0x00, 0xE0, 0x0F, 0x57, 0x40,
+  0x17, 0x40, 0x00, 0xE0, 0x37, 0x5F, 0xE0, 0x3F, 0x00, 0x40, 0x8B, 0x40,
+  0x00, 0x40, 0x4F, 0x40, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0x40, 0x00,
+  0xC0, 0x13, 0x40, 0x0B, 0xE0, 0x17, 0x00, 0xE0, 0x07, 0x2B, 0x40, 0x0F,
+  0xE0, 0x03, 0x33, 0xE0, 0x07, 0x0F, 0xE0, 0x07, 0x00, 0x40, 0x1F, 0x40,
+  0x00, 0xE0, 0x07, 0x17, 0xE0, 0x2B, 0x00, 0xE0, 0x0F, 0x47, 0x40, 0x17,
+  0xE0, 0x13, 0x00, 0xE0, 0x0B, 0x6B, 0xE0, 0x0F, 0x2F, 0xE0, 0x03, 0x2B,
+  0xE0, 0x03, 0x23, 0xC0, 0x17, 0xE0, 0x0B, 0x13, 0x40, 0x00, 0xE0, 0x03,
+  0x17, 0x40, 0x00, 0x40, 0x13, 0xE0, 0x07, 0x00, 0xE0, 0x0F, 0x17, 0xE0,
+  0x47, 0x00, 0x40, 0x67, 0x40, 0x00, 0xE0, 0x13, 0x57, 0xE0, 0x17, 0x1F,
+  0xE0, 0x4F, 0x00, 0x40, 0x77, 0xE0, 0x0F, 0x00, 0x40, 0x73, 0xE0, 0x0F,
+  0x1B, 0xE0, 0x03, 0x00, 0xC0, 0x27, 0x40, 0x07, 0xE0, 0x3B, 0x00, 0xC0,
+  0x5B, 0xC0, 0x4B, 0x40, 0x0F, 0xC0, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x0F,
+  0x17, 0xE0, 0x8F, 0x00, 0x40, 0xAF, 0xE0, 0x03, 0x00, 0xE0, 0x1F, 0xA7,
+  0xC0, 0x33, 0x40, 0x2F, 0xE0, 0x03, 0x0B, 0xE0, 0x17, 0x00, 0x40, 0x2B,
+  0xE0, 0x17, 0x23, 0xE0, 0x33, 0x00, 0xE0, 0x1B, 0x5F, 0x40, 0x23, 0xC0,
+  0x00, 0x40, 0x6B, 0xE0, 0x07, 0x0B, 0xE0, 0x03, 0x13, 0xC0, 0x00, 0xE0,
+  0x1F, 0x13, 0xE0, 0x0F, 0x00, 0xE0, 0x0F, 0x3F, 0xC0, 0x00, 0xC0, 0x37,
+  0xC0, 0x0F, 0xE0, 0x3F, 0x00, 0x40, 0x57, 0xE0, 0x0B, 0x4B, 0xE0, 0x0F,
+  0x17, 0xE0, 0x7B, 0x00, 0x40, 0x9B, 0xE0, 0x03, 0x00, 0x40, 0x93, 0xE0,
+  0x03, 0x0F, 0xE0, 0x0F, 0x00, 0xC0, 0x27, 0x40, 0x07, 0xE0, 0x43, 0x00,
+  0xE0, 0x13, 0x6F, 0xE0, 0x0B, 0x00, 0x40, 0x2F, 0xE0, 0x0B, 0x17, 0xE0,
+  0x93, 0x00, 0x40, 0xB3, 0x40, 0x00, 0xE0, 0x27, 0xA3, 0x40, 0x33, 0xE0,
+  0x03, 0x00, 0xE0, 0x17, 0x3F, 0xC0, 0x2B, 0xE0, 0x17, 0x27, 0x40, 0x00,
+  0xE0, 0x23, 0x2B, 0xE0, 0x23, 0x00, 0xC0, 0x57, 0xC0, 0x00, 0xE0, 0x03,
+  0x3B, 0xC0, 0x13, 0xC0, 0x00, 0xE0, 0x17, 0x1B, 0xC0, 0x27, 0xE0, 0x1F,
+  0x00, 0xE0, 0x03, 0x4F, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x3F, 0xE0, 0x03,
+  0x17, 0xE0, 0x33, 0x00, 0x40, 0x53, 0xE0, 0x33, 0x3F, 0xE0, 0x6F, 0x00,
+  0x40, 0xB7, 0xE0, 0x17, 0x00, 0x40, 0x9B, 0xE0, 0x0F, 0x23, 0xC0, 0x1B,
+  0xE0, 0x03, 0x07, 0xE0, 0x37, 0x00, 0xE0, 0x0B, 0x6B, 0xE0, 0x37, 0x53,
+  0xE0, 0x7B, 0x00, 0xE0, 0x0B, 0xD7, 0xE0, 0x03, 0x00, 0xE0, 0x13, 0xA3,
+  0xE0, 0x03, 0x27, 0xC0, 0x00, 0xE0, 0x2B, 0x2F, 0xC0, 0x3B, 0xE0, 0x03,
+  0x00, 0xE0, 0x13, 0x47, 0xE0, 0x33, 0x00, 0xE0, 0x03, 0x63, 0xE0, 0x07,
+  0x00, 0xE0, 0x13, 0x57, 0xE0, 0x07, 0x2B, 0xE0, 0x2F, 0x00, 0xE0, 0x13,
+  0x63, 0x40, 0x00, 0x40, 0x57, 0x40, 0x07, 0xE0, 0x4F, 0x00, 0xE0, 0x07,
+  0x5F, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x4F, 0x6F, 0xE0, 0x0B, 0x00, 0x40,
+  0x6F, 0xC0, 0x00, 0xE0, 0x1F, 0x1F, 0xE0, 0x1F, 0x2F, 0xC0, 0x00, 0xC0,
+  0x57, 0x40, 0x0F, 0xC0, 0x0B, 0xE0, 0x33, 0x00, 0x40, 0x47, 0xE0, 0x0F,
+  0x00, 0xE0, 0x13, 0x57, 0xC0, 0x33, 0xE0, 0x07, 0x23, 0x40, 0x17, 0xE0,
+  0x07, 0x13, 0xE0, 0x07, 0x00, 0x40, 0x23, 0xC0, 0x00, 0xE0, 0x07, 0x1B,
+  0xE0, 0x3B, 0x00, 0xC0, 0x5B, 0xE0, 0x13, 0x00, 0xE0, 0x13, 0x67, 0xE0,
+  0x0B, 0x37, 0x40, 0x2F, 0xC0, 0x17, 0x40, 0x0B, 0xC0, 0x00, 0xC0, 0x13,
+  0xE0, 0x1B, 0x00, 0xC0, 0x33, 0x40, 0x00, 0x40, 0x2F, 0x40, 0x07, 0xE0,
+  0x3B, 0x00, 0x40, 0x4B, 0x40, 0x00, 0xC0, 0x4B, 0x40, 0x0B, 0xE0, 0x03,
+  0x00, 0xC0, 0x17, 0xE0, 0x0B, 0x00, 0xE0, 0x0B, 0x27, 0xE0, 0x03, 0x13,
+  0xE0, 0x17, 0x00, 0xE0, 0x03, 0x53, 0xC0, 0x2B, 0xE0, 0x03, 0x13, 0xE0,
+  0x5F, 0x00, 0x40, 0x7B, 0xE0, 0x07, 0x6B, 0xE0, 0x0B, 0x13, 0xE0, 0x53,
+  0x00, 0xC0, 0x6F, 0x40, 0x07, 0x40, 0x00, 0xE0, 0x0B, 0x6B, 0x40, 0x17,
+  0x40, 0x00, 0x40, 0x1B, 0x40, 0x07, 0xE0, 0x0B, 0x00, 0x40, 0x1B, 0x40,
+  0x00, 0xE0, 0x17, 0x1B, 0x40, 0x23, 0xE0, 0x2F, 0x00, 0x40, 0x5B, 0xC0,
+  0x3B, 0x40, 0x0B, 0xE0, 0x0B, 0x00, 0xC0, 0x1F, 0xE0, 0xAF, 0x00, 0xE0,
+  0x13, 0xD3, 0x40, 0x1B, 0xE0, 0x13, 0xD7, 0x40, 0x1F, 0xE0, 0x03, 0x00,
+  0x40, 0x2B, 0xC0, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x13, 0xE0,
+  0x03, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x0B, 0x17, 0x40, 0x13, 0xE0, 0x03,
+  0x23, 0xE0, 0x33, 0x00, 0x40, 0x4B, 0xC0, 0x00, 0x40, 0x47, 0xC0, 0x0B,
+  0x40, 0x00, 0x40, 0x0F, 0xE0, 0x17, 0x00, 0xE0, 0x0B, 0x27, 0x40, 0x13,
+  0xE0, 0x1B, 0x00, 0x40, 0x5B, 0xE0, 0x0B, 0x27, 0x40, 0x17, 0xE0, 0x5B,
+  0x00, 0xE0, 0x03, 0x7B, 0xE0, 0x5B, 0x6F, 0xE0, 0x13, 0x00, 0x40, 0x8B,
+  0xC0, 0x1F, 0x40, 0x0B, 0x40, 0x00, 0xC0, 0x0F, 0x40, 0x00, 0x40, 0x0F,
+  0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x0F, 0x00, 0xE0,
+  0x1B, 0x1F, 0xE0, 0x13, 0x00, 0xC0, 0x57, 0xE0, 0x03, 0x23, 0xE0, 0x0B,
+  0x13, 0x40, 0x00, 0xC0, 0x17, 0x40, 0x00, 0x40, 0x0F, 0x40, 0x00, 0x40,
+  0x0B, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x9B, 0x00, 0xC0, 0xB3, 0x40,
+  0xAB, 0xC0, 0x0B, 0x40, 0x00, 0x40, 0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x03,
+  0x13, 0xE0, 0x03, 0x0B, 0xE0, 0x17, 0x00, 0x40, 0x2B, 0x40, 0x00, 0xC0,
+  0x27, 0x40, 0x0B, 0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x2B, 0x00, 0xE0, 0x37,
+  0x3F, 0x40, 0x00, 0x40, 0x43, 0xE0, 0x07, 0x00, 0x40, 0x17, 0xE0, 0x1F,
+  0x00, 0xE0, 0x03, 0x3B, 0xE0, 0x0B, 0x33, 0xE0, 0x03, 0x1F, 0xE0, 0x1B,
+  0x00, 0xC0, 0x43, 0x40, 0x2B, 0xC0, 0x0B, 0xE0, 0x47, 0x00, 0x40, 0x5B,
+  0xE0, 0x03, 0x00, 0xE0, 0x47, 0x5F, 0xE0, 0x27, 0x00, 0xE0, 0x03, 0x8B,
+  0xC0, 0x00, 0xE0, 0x07, 0x43, 0xE0, 0x03, 0x17, 0xC0, 0x0B, 0xE0, 0x07,
+  0x00, 0x40, 0x33, 0xE0, 0x07, 0x13, 0xE0, 0x07, 0x00, 0x40, 0x23, 0xE0,
+  0x27, 0x00, 0xE0, 0x07, 0x43, 0xE0, 0x07, 0x00, 0xC0, 0x4F, 0xE0, 0x0F,
+  0x17, 0xE0, 0x9B, 0x00, 0xC0, 0xBB, 0x40, 0xAB, 0xC0, 0x0B, 0xE0, 0x03,
+  0x00, 0x40, 0x17, 0xE0, 0x23, 0x00, 0xE0, 0x03, 0x3B, 0xE0, 0x13, 0x00,
+  0xE0, 0x1B, 0x53, 0xE0, 0x37, 0x3F, 0xE0, 0x53, 0x00, 0x40, 0x9B, 0xE0,
+  0x13, 0x5F, 0x40, 0x1F, 0xE0, 0x1F, 0x00, 0xE0, 0x13, 0x47, 0xE0, 0x4B,
+  0x00, 0xC0, 0x97, 0xE0, 0x4B, 0x5B, 0xE0, 0x23, 0x00, 0xC0, 0x87, 0xE0,
+  0x03, 0x00, 0xE0, 0x07, 0x3F, 0xE0, 0x03, 0x1B, 0xE0, 0x1B, 0x00, 0xC0,
+  0x3F, 0xE0, 0x13, 0x2B, 0xC0, 0x23, 0xE0, 0x17, 0x00, 0xE0, 0x13, 0x43,
+  0xC0, 0x00, 0x40, 0x43, 0xE0, 0x03, 0x0B, 0xE0, 0x1B, 0x00, 0xE0, 0x27,
+  0x2F, 0xE0, 0x57, 0x00, 0xC0, 0x8F, 0xE0, 0x0B, 0x00, 0xE0, 0x27, 0x7B,
+  0xE0, 0x0B, 0x43, 0x40, 0x00, 0x40, 0x47, 0x40, 0x07, 0xC0, 0x00, 0x40,
+  0x0F, 0xE0, 0x0F, 0x00, 0x40, 0x23, 0xE0, 0x07, 0x1B, 0x40, 0x13, 0x40,
+  0x00, 0xE0, 0x03, 0x17, 0xE0, 0x17, 0x0F, 0xE0, 0x0F, 0x00, 0xE0, 0x07,
+  0x37, 0xC0, 0x00, 0x40, 0x17, 0xC0, 0x00, 0xC0, 0x13, 0xE0, 0x2B, 0x00,
+  0xC0, 0x43, 0xE0, 0x0B, 0x00, 0xC0, 0x4F, 0xC0, 0x1B, 0xC0, 0x0F, 0xE0,
+  0x1B, 0x00, 0xC0, 0x33, 0x40, 0x00, 0xE0, 0x1B, 0x2F, 0xE0, 0x9B, 0x00,
+  0x40, 0xCB, 0xE0, 0x33, 0x00, 0xC0, 0xE3, 0x40, 0x43, 0xC0, 0x0B, 0xC0,
+  0x00, 0xE0, 0x03, 0x13, 0xE0, 0x07, 0x0B, 0x40, 0x00, 0xC0, 0x27, 0xC0,
+  0x00, 0x40, 0x13, 0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x0F, 0x00, 0xE0, 0x07,
+  0x23, 0x40, 0x0F, 0xC0, 0x00, 0xE0, 0x1F, 0x33, 0xE0, 0x7F, 0x00, 0xC0,
+  0xB7, 0xE0, 0x0F, 0x00, 0xE0, 0x0B, 0xA7, 0xE0, 0x0F, 0x2B, 0xE0, 0x0F,
+  0x00, 0xC0, 0x43, 0xC0, 0x1F, 0xC0, 0x0F, 0x40, 0x00, 0xE0, 0x0B, 0x13,
+  0x40, 0x00, 0xE0, 0x03, 0x17, 0xE0, 0x03, 0x0B, 0xE0, 0x57, 0x00, 0xE0,
+  0x43, 0x6B, 0xC0, 0x4B, 0xE0, 0x03, 0x00, 0xC0, 0xBF, 0x40, 0x13, 0xC0,
+  0x0B, 0xE0, 0x0B, 0x00, 0xE0, 0x0F, 0x1F, 0x40, 0x17, 0x40, 0x00, 0xE0,
+  0x0B, 0x33, 0xE0, 0x77, 0x00, 0x40, 0x97, 0x40, 0x00, 0xE0, 0x1F, 0x87,
+  0x40, 0x2B, 0xE0, 0x33, 0x00, 0xE0, 0x1F, 0x67, 0x40, 0x00, 0x40, 0x67,
+  0x40, 0x07, 0xC0, 0x00, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x07, 0x0F, 0x40,
+  0x00, 0xC0, 0x13, 0xE0, 0x23, 0x00, 0x40, 0x37, 0xE0, 0x0F, 0x00, 0x40,
+  0x47, 0xC0, 0x1B, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0F, 0x40, 0x07, 0xE0,
+  0x0B, 0x00, 0x40, 0x1B, 0x40, 0x00, 0xC0, 0x1B, 0xE0, 0x03, 0x0B, 0xE0,
+  0x43, 0x00, 0x40, 0x57, 0xE0, 0x13, 0x00, 0xE0, 0x0F, 0x6B, 0xE0, 0x13,
+  0x33, 0x40, 0x00, 0xE0, 0x0F, 0x37, 0xE0, 0x07, 0x00, 0x40, 0x2B, 0xE0,
+  0x07, 0x00, 0xC0, 0x23, 0xC0, 0x17, 0x40, 0x0F, 0xE0, 0x03, 0x0B, 0xE0,
+  0x43, 0x00, 0x40, 0x57, 0xE0, 0x07, 0x4F, 0x40, 0x13, 0x40, 0x00, 0xE0,
+  0x07, 0x17, 0xE0, 0x03, 0x00, 0x40, 0x1F, 0xE0, 0x03, 0x00, 0xC0, 0x1B,
+  0xE0, 0x03, 0x13, 0xE0, 0x1B, 0x00, 0xC0, 0x37, 0xC0, 0x00, 0xE0, 0x03,
+  0x33, 0xC0, 0x13, 0x40, 0x00, 0x40, 0x17, 0x40, 0x07, 0x40, 0x00, 0xE0,
+  0x03, 0x0B, 0xE0, 0x87, 0x00, 0x40, 0x9B, 0x40, 0x00, 0xE0, 0x07, 0x97,
+  0xE0, 0x0B, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x1F, 0xE0, 0x1F, 0x00, 0x40,
+  0x37, 0xC0, 0x2B, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0x13, 0xC0, 0x0B, 0xE0,
+  0x0B, 0x00, 0xE0, 0x03, 0x1F, 0x40, 0x0B, 0xE0, 0x17, 0x00, 0xE0, 0x07,
+  0x43, 0x40, 0x2F, 0xE0, 0x07, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x1F, 0x40,
+  0x00, 0x40, 0x13, 0x40, 0x07, 0xE0, 0x0B, 0x00, 0x40, 0x1B, 0xE0, 0x1B,
+  0x00, 0x40, 0x3B, 0xE0, 0x07, 0x27, 0x40, 0x13, 0x40, 0x00, 0xE0, 0x07,
+  0x17, 0xE0, 0x37, 0x00, 0x40, 0x53, 0xE0, 0x03, 0x00, 0x40, 0x4F, 0xE0,
+  0x07, 0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x1B, 0xE0, 0x13, 0x00, 0xE0,
+  0x03, 0x33, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x33, 0x40, 0x1B, 0xE0, 0x03,
+  0x13, 0xE0, 0x03, 0x0F, 0x40, 0x0B, 0xE0, 0x93, 0x00, 0xE0, 0x0F, 0xB7,
+  0xE0, 0x17, 0x00, 0xE0, 0x13, 0xD3, 0x40, 0x3B, 0xE0, 0x0F, 0x1F, 0x40,
+  0x1B, 0xC0, 0x00, 0xE0, 0x0F, 0x23, 0xE0, 0x73, 0x00, 0xE0, 0x2F, 0x9B,
+  0xE0, 0x03, 0x37, 0xC0, 0x0B, 0xE0, 0x17, 0x00, 0xE0, 0x23, 0xE7, 0xE0,
+  0x17, 0x4B, 0xE0, 0x0F, 0x00, 0xC0, 0x63, 0xE0, 0x03, 0x1F, 0xC0, 0x13,
+  0xE0, 0x03, 0x00, 0xE0, 0x03, 0x1F, 0xE0, 0x0F, 0x00, 0xE0, 0x03, 0x2F,
+  0xE0, 0x13, 0x00, 0xE0, 0x03, 0x3F, 0xE0, 0x03, 0x27, 0xC0, 0x17, 0xE0,
+  0x03, 0x13, 0xE0, 0x33, 0x00, 0xC0, 0x4F, 0xE0, 0x17, 0x00, 0xE0, 0x0B,
+  0x63, 0xE0, 0x07, 0x33, 0x40, 0x23, 0xE0, 0x07, 0x13, 0x40, 0x00, 0x40,
+  0x17, 0xE0, 0x07, 0x00, 0x40, 0x17, 0xC0, 0x00, 0xE0, 0x03, 0x1B, 0xC0,
+  0x13, 0x40, 0x00, 0xE0, 0x03, 0x17, 0xE0, 0x6B, 0x00, 0x40, 0x83, 0xC0,
+  0x00, 0xE0, 0x17, 0x7F, 0xC0, 0x27, 0xE0, 0x1F, 0x00, 0xE0, 0x17, 0x4F,
+  0xE0, 0x03, 0x00, 0x40, 0x53, 0xE0, 0x07, 0x0F, 0xC0, 0x00, 0xE0, 0x03,
+  0x17, 0xE0, 0x73, 0x00, 0x40, 0x8F, 0xE0, 0x37, 0x7F, 0x40, 0x43, 0xE0,
+  0x17, 0x00, 0x40, 0x63, 0xC0, 0x23, 0x40, 0x0B, 0xE0, 0x1F, 0x00, 0xE0,
+  0x03, 0x33, 0xC0, 0x0B, 0xE0, 0x1B, 0x00, 0xC0, 0x5F, 0xE0, 0x03, 0x2B,
+  0xC0, 0x13, 0x40, 0x00, 0xC0, 0x17, 0xE0, 0x03, 0x0B, 0xE0, 0x13, 0x00,
+  0x40, 0x27, 0xE0, 0x1B, 0x00, 0xC0, 0x43, 0xE0, 0x1B, 0x2B, 0xE0, 0x2B,
+  0x00, 0xC0, 0x5F, 0xE0, 0x13, 0x00, 0xE0, 0x0B, 0x57, 0x40, 0x2F, 0xC0,
+  0x17, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0x13, 0xC0, 0x0B, 0x40, 0x00, 0xE0,
+  0x03, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0x1B, 0xE0, 0x0B, 0x00, 0x40,
+  0x1F, 0xC0, 0x17, 0xE0, 0x17, 0x0B, 0x40, 0x1F, 0xE0, 0x77, 0x00, 0x40,
+  0xAB, 0xE0, 0x07, 0x83, 0x40, 0x13, 0xC0, 0x00, 0x40, 0x1B, 0xC0, 0x0B,
+  0xE0, 0x07, 0x00, 0x40, 0x1B, 0xE0, 0x1F, 0x00, 0xC0, 0x3B, 0xC0, 0x2F,
+  0x40, 0x0F, 0x40, 0x0B, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x93,
+  0x00, 0xE0, 0x07, 0xA3, 0xE0, 0x13, 0x0F, 0x40, 0x1B, 0xE0, 0x17, 0x00,
+  0xE0, 0x2B, 0xEB, 0xE0, 0x03, 0x53, 0xC0, 0x3F, 0xE0, 0x03, 0x13, 0xC0,
+  0x00, 0xE0, 0x07, 0x1B, 0xC0, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x2B, 0xC0,
+  0x0F, 0x40, 0x0B, 0xE0, 0x17, 0x00, 0xE0, 0x13, 0x2B, 0xC0, 0x1B, 0xE0,
+  0x67, 0x00, 0xE0, 0x07, 0xB3, 0x40, 0x7F, 0xE0, 0x07, 0x13, 0x40, 0x00,
+  0x40, 0x17, 0xE0, 0x07, 0x00, 0x40, 0x17, 0x40, 0x00, 0x40, 0x17, 0x40,
+  0x07, 0xE0, 0x1F, 0x00, 0x40, 0x2F, 0x40, 0x00, 0xE0, 0x13, 0x2F, 0x40,
+  0x1F, 0xC0, 0x00, 0xE0, 0x17, 0x27, 0x40, 0x1F, 0xC0, 0x2B, 0xE0, 0x77,
+  0x00, 0x40, 0x8B, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x8F, 0xC0, 0x1B, 0xE0,
+  0x07, 0x17, 0xE0, 0x17, 0x00, 0xC0, 0x37, 0x40, 0x00, 0x40, 0x2B, 0xC0,
+  0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x07, 0x00, 0x40, 0x17, 0xE0, 0x83,
+  0x00, 0xC0, 0x9F, 0xC0, 0x93, 0xC0, 0x0F, 0x40, 0x00, 0x40, 0x13, 0x40,
+  0x07, 0x40, 0x00, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x0F, 0x00,
+  0xC0, 0x23, 0xE0, 0x27, 0x00, 0xE0, 0x03, 0x4F, 0x40, 0x3B, 0xE0, 0x0F,
+  0x0F, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x03, 0x1F, 0xE0, 0x0F, 0x00, 0xE0,
+  0x1F, 0x27, 0xE0, 0x13, 0x00, 0x40, 0x43, 0xE0, 0x67, 0x00, 0xE0, 0x03,
+  0x8F, 0xE0, 0x03, 0x7B, 0xE0, 0x03, 0x17, 0xC0, 0x00, 0xE0, 0x03, 0x1F,
+  0xE0, 0x0B, 0x00, 0xC0, 0x27, 0xE0, 0x1B, 0x00, 0xC0, 0x3F, 0xE0, 0x07,
+  0x2B, 0x40, 0x17, 0xC0, 0x13, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0x13, 0xC0,
+  0x0B, 0x40, 0x00, 0xE0, 0x03, 0x0F, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x17,
+  0xE0, 0x8F, 0x00, 0xE0, 0x3F, 0x9F, 0xE0, 0x0F, 0x47, 0x40, 0x17, 0xC0,
+  0x00, 0xE1, 0x8B, 0x03, 0xE0, 0x1B, 0x9B, 0xE0, 0x0B, 0x23, 0xC0, 0x13,
+  0xE0, 0x03, 0x00, 0xE0, 0x33, 0xDF, 0x40, 0x47, 0xE0, 0x07, 0x3F, 0x40,
+  0x13, 0xC0, 0x00, 0x40, 0x1B, 0xC0, 0x0B, 0xC0, 0x00, 0xE0, 0x1B, 0x13,
+  0x40, 0x23, 0xC0, 0x00, 0xC0, 0x37, 0xE0, 0x27, 0x00, 0xC0, 0x3F, 0xC0,
+  0x00, 0xE0, 0x07, 0x3F, 0x40, 0x17, 0xC0, 0x13, 0x40, 0x0B, 0xE0, 0x13,
+  0x00, 0xE0, 0x27, 0x27, 0x40, 0x00, 0xE0, 0x07, 0x4F, 0xE0, 0x03, 0x13,
+  0x40, 0x0B, 0x40, 0x00, 0x40, 0x23, 0x40, 0x07, 0xC0, 0x00, 0x40, 0x0F,
+  0xC0, 0x00, 0xC0, 0x13, 0xE0, 0x17, 0x00, 0xC0, 0x2F, 0xC0, 0x00, 0xC0,
+  0x2F, 0xC0, 0x0F, 0xE0, 0x23, 0x00, 0xC0, 0x3B, 0xC0, 0x00, 0xE0, 0x23,
+  0x3B, 0xE0, 0x5F, 0x00, 0xC0, 0x9B, 0x40, 0x00, 0xE0, 0x5F, 0x73, 0xE0,
+  0x87, 0x00, 0x40, 0xFB, 0x40, 0x00, 0xE0, 0x17, 0x97, 0x40, 0x23, 0xC0,
+  0x00, 0x40, 0x2B, 0xC0, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x17, 0xE0, 0x2F,
+  0x00, 0x40, 0x47, 0xE0, 0x0B, 0x3B, 0x40, 0x17, 0x40, 0x00, 0x40, 0x1B,
+  0xC0, 0x07, 0x40, 0x00, 0xE0, 0x03, 0x0B, 0x40, 0x00, 0xE0, 0x03, 0x0F,
+  0x40, 0x0B, 0xC0, 0x00, 0x40, 0x1B, 0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x0B,
+  0x00, 0xE0, 0x17, 0x1F, 0x40, 0x00, 0xE0, 0x0B, 0x23, 0x40, 0x13, 0xC0,
+  0x00, 0xC0, 0x23, 0xE0, 0x5B, 0x00, 0x40, 0x6B, 0xE0, 0x07, 0x00, 0x40,
+  0x77, 0xE0, 0x07, 0x13, 0xE0, 0x27, 0x00, 0x40, 0x43, 0x40, 0x00, 0x40,
+  0x37, 0x40, 0x07, 0x40, 0x00, 0xE0, 0x03, 0x0B, 0xE0, 0x0F, 0x00, 0x40,
+  0x23, 0x40, 0x00, 0xE0, 0x07, 0x1F, 0x40, 0x13, 0xC0, 0x00, 0xE0, 0x07,
+  0x1B, 0xE0, 0x7F, 0x00, 0xE0, 0x3F, 0x9F, 0x40, 0x47, 0xE0, 0x7F, 0xD3,
+  0xE0, 0x2B, 0x00, 0xE0, 0x13, 0xBF, 0x40, 0x1B, 0xE0, 0x03, 0x00, 0x40,
+  0x5F, 0x40, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x47, 0x00,
+  0xE0, 0x0F, 0x5B, 0xE0, 0x0F, 0x17, 0xC0, 0x00, 0x40, 0x1F, 0xC0, 0x0B,
+  0xC0, 0x00, 0x40, 0x13, 0xC0, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x0B,
+  0xC0, 0x00, 0xE0, 0x0B, 0x13, 0xE0, 0x07, 0x00, 0xC0, 0x23, 0xE0, 0x07,
+  0x00, 0xC0, 0x27, 0xE0, 0x07, 0x17, 0xE0, 0x3B, 0x00, 0xC0, 0x5B, 0xE0,
+  0x2B, 0x00, 0xC0, 0x7F, 0xE0, 0x0F, 0x3B, 0xE0, 0x07, 0x1F, 0x40, 0x0F,
+  0x40, 0x2B, 0x40, 0x07, 0xE0, 0x13, 0x00, 0x40, 0x23, 0xC0, 0x00, 0xE0,
+  0x07, 0x27, 0xC0, 0x17, 0x40, 0x00, 0xE0, 0x07, 0x1B, 0x40, 0x00, 0xE0,
+  0x0F, 0x17, 0xE0, 0x5F, 0x00, 0xE0, 0x3F, 0x7F, 0x40, 0x47, 0x40, 0x00,
+  0xE0, 0x53, 0xB7, 0x40, 0x5F, 0x40, 0x00, 0xE0, 0x07, 0x63, 0xE0, 0x0B,
+  0x13, 0xE0, 0x07, 0x00, 0xE0, 0x1B, 0x23, 0xE0, 0x17, 0x00, 0xE0, 0x03,
+  0x43, 0xE0, 0x03, 0x0B, 0xE0, 0x67, 0x00, 0x40, 0x7B, 0x40, 0x00, 0xE0,
+  0x2F, 0x77, 0x40, 0x3B, 0x40, 0x00, 0xE0, 0x03, 0x3F, 0x40, 0x0F, 0xE0,
+  0x03, 0x00, 0xE0, 0x13, 0x1B, 0xE0, 0x03, 0x00, 0xC0, 0x27, 0xE0, 0x0F,
+  0x13, 0xC0, 0x1F, 0xE0, 0x1F, 0x00, 0x40, 0x47, 0xE0, 0x27, 0x2B, 0x40,
+  0x33, 0xE0, 0x1F, 0x00, 0x40, 0x5B, 0xE0, 0x0B, 0x2B, 0x40, 0x17, 0xC0,
+  0x00, 0xE0, 0x03, 0x1F, 0xC0, 0x13, 0xE0, 0x37, 0x00, 0xE0, 0x4B, 0x53,
+  0xE0, 0x3B, 0x00, 0x40, 0x97, 0xE0, 0x4B, 0x47, 0xE0, 0x3B, 0x57, 0x40,
+  0x43, 0x40, 0x00, 0xE0, 0x3B, 0x9F, 0xE0, 0x27, 0x00, 0xE0, 0x13, 0x77,
+  0xE0, 0x13, 0x1B, 0xE0, 0x8B, 0x00, 0xE0, 0x07, 0xAF, 0x40, 0x0F, 0x40,
+  0x00, 0x40, 0xAB, 0x40, 0x07, 0xE0, 0x0B, 0x00, 0xE0, 0x13, 0x1B, 0xE0,
+  0x03, 0x00, 0x40, 0x27, 0xC0, 0x00, 0xC0, 0x17, 0xC0, 0x0F, 0xE0, 0x1B,
+  0x00, 0x40, 0x33, 0xE0, 0x03, 0x27, 0xE0, 0x07, 0x0F, 0xE0, 0x13, 0x00,
+  0x40, 0x2B, 0x40, 0x00, 0x40, 0x23, 0x40, 0x07, 0xE0, 0x33, 0x00, 0x40,
+  0x43, 0xE0, 0x3B, 0x00, 0x40, 0x83, 0xE0, 0x0F, 0x47, 0xE0, 0x13, 0x1B,
+  0xE0, 0x9F, 0x00, 0xE0, 0x07, 0xC3, 0x40, 0x0F, 0xC0, 0x00, 0xE0, 0x47,
+  0xC3, 0xC0, 0x57, 0x40, 0x00, 0xE0, 0x47, 0x5B, 0xE0, 0x13, 0x00, 0x40,
+  0x6F, 0xC0, 0x00, 0xE0, 0x03, 0x27, 0xE0, 0x0F, 0x13, 0xE0, 0x03, 0x23,
+  0xE0, 0x57, 0x00, 0x40, 0x83, 0xE0, 0x4B, 0x63, 0xC0, 0x57, 0xC0, 0x07,
+  0x40, 0x00, 0x40, 0x0B, 0xE0, 0x17, 0x00, 0x40, 0x27, 0xE0, 0x33, 0x00,
+  0x40, 0x5F, 0xE0, 0x37, 0x3F, 0xE0, 0x4F, 0x00, 0xE0, 0x2B, 0x97, 0xC0,
+  0x8B, 0xC0, 0x3B, 0x40, 0x0F, 0xC0, 0x0B, 0xE0, 0xCB, 0x00, 0xE0, 0x1F,
+  0xDF, 0xE0, 0x1F, 0x27, 0xC0, 0x00, 0xE0, 0x0B, 0x2F, 0xE0, 0x03, 0x13,
+  0xC0, 0x0B, 0x40, 0x07, 0x40, 0x00, 0xC0, 0x37, 0xE0, 0x3B, 0x00, 0x40,
+  0x4F, 0x40, 0x00, 0xE0, 0x07, 0x4B, 0x40, 0x13, 0x40, 0x00, 0xC0, 0x17,
+  0x40, 0x0B, 0xC0, 0x00, 0xC0, 0x13, 0xE0, 0x23, 0x00, 0x40, 0x3B, 0xE0,
+  0x23, 0x2F, 0xC0, 0x00, 0xE0, 0x27, 0x37, 0x40, 0x2F, 0x40, 0x00, 0xC0,
+  0x3F, 0xE0, 0x0B, 0x00, 0x40, 0x1F, 0x40, 0x00, 0x40, 0x1B, 0x40, 0x07,
+  0x40, 0x00, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x03, 0x00,
+  0xE0, 0x03, 0x1B, 0xE0, 0x6F, 0x00, 0xE0, 0x03, 0x8F, 0xE0, 0x03, 0x00,
+  0x40, 0x8F, 0xE0, 0x03, 0x0F, 0xE0, 0x2B, 0x00, 0x40, 0x43, 0xE0, 0x07,
+  0x00, 0x40, 0x47, 0xE0, 0x07, 0x13, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x23,
+  0xE0, 0x07, 0x0F, 0xE0, 0x57, 0x00, 0x40, 0x6F, 0xE0, 0x03, 0x00, 0xE0,
+  0x57, 0x6F, 0xE0, 0x3F, 0x00, 0x40, 0xB3, 0xE0, 0x1F, 0x4B, 0x40, 0x2B,
+  0xE0, 0x07, 0x00, 0xE0, 0x1F, 0x3B, 0xE0, 0x13, 0x00, 0xE0, 0x03, 0x53,
+  0xE0, 0x07, 0x27, 0xC0, 0x1B, 0xE0, 0x03, 0x17, 0xE0, 0x0B, 0x13, 0xE0,
+  0x1F, 0x00, 0x40, 0x3B, 0xE0, 0x1F, 0x2B, 0xE0, 0x57, 0x00, 0xE0, 0x03,
+  0x8B, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x7B, 0x40, 0x17, 0xE0,
+  0x03, 0x0F, 0xE0, 0x57, 0x00, 0xE0, 0x17, 0x6F, 0x40, 0x1F, 0xE0, 0x0B,
+  0x00, 0xE0, 0x03, 0x97, 0xE0, 0x0B, 0x1F, 0xE0, 0x13, 0x00, 0xE0, 0x03,
+  0x3B, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x37, 0xE0, 0x07, 0x1B, 0xE0, 0x03,
+  0x00, 0x40, 0x27, 0xE0, 0x03, 0x0F, 0xE0, 0x67, 0x00, 0x40, 0x7F, 0xE0,
+  0x03, 0x00, 0xE0, 0x47, 0x7F, 0x40, 0x5B, 0xE0, 0x33, 0x53, 0xE0, 0x3B,
+  0x3F, 0xE0, 0x0B, 0x00, 0xE0, 0x1F, 0x93, 0x40, 0x3B, 0xE0, 0x0B, 0x2B,
+  0x40, 0x17, 0xE0, 0x07, 0x00, 0xC0, 0x27, 0xC0, 0x17, 0xC0, 0x0F, 0xE0,
+  0x3B, 0x00, 0xE0, 0x17, 0x53, 0xC0, 0x1F, 0x40, 0x00, 0xE0, 0x3B, 0x6F,
+  0x40, 0x00, 0x40, 0x4B, 0x40, 0x00, 0x40, 0x0B, 0xC0, 0x00, 0xE0, 0x03,
+  0x0F, 0x40, 0x0B, 0xC0, 0x00, 0xC0, 0x1F, 0xE0, 0x0F, 0x00, 0xE0, 0x1F,
+  0x27, 0xE0, 0x2F, 0x00, 0x40, 0x5F, 0xE0, 0x0F, 0x3B, 0x40, 0x1B, 0x40,
+  0x00, 0xE0, 0x0F, 0x1F, 0xE0, 0x13, 0x00, 0x40, 0x37, 0xC0, 0x00, 0xE0,
+  0x07, 0x27, 0x40, 0x17, 0xE0, 0x07, 0x13, 0x40, 0x00, 0x40, 0x17, 0xE0,
+  0x03, 0x00, 0x40, 0x13, 0xE0, 0x6B, 0x00, 0x40, 0x83, 0xE0, 0x1B, 0x77,
+  0x40, 0x27, 0xE0, 0x03, 0x00, 0xE0, 0x1B, 0x33, 0xE0, 0x1F, 0x00, 0x40,
+  0x57, 0xC0, 0x2B, 0x40, 0x0B, 0xC0, 0x00, 0xC0, 0x13, 0xC0, 0x00, 0x40,
+  0x17, 0xE0, 0x03, 0x0B, 0xE0, 0x0B, 0x00, 0xC0, 0x1F, 0xE0, 0x3F, 0x00,
+  0x40, 0x63, 0xE0, 0x13, 0x4B, 0xE0, 0x1B, 0x1F, 0xE0, 0x07, 0x00, 0xE0,
+  0x13, 0x4F, 0xE0, 0x2F, 0x00, 0xC0, 0x63, 0xE0, 0x2F, 0x3F, 0xE0, 0x33,
+  0x00, 0x40, 0x7B, 0xE0, 0x33, 0x3F, 0xE0, 0x03, 0x00, 0xE0, 0x43, 0x4B,
+  0xE0, 0x23, 0x00, 0xC0, 0x77, 0x40, 0x07, 0x40, 0x00, 0x40, 0x3B, 0xC0,
+  0x07, 0xE0, 0x1F, 0x00, 0xE0, 0x27, 0x2F, 0xE0, 0x7B, 0x00, 0x40, 0xB3,
+  0x40, 0x00, 0xE0, 0x03, 0x8B, 0xE0, 0x07, 0x0F, 0x40, 0x00, 0x40, 0x13,
+  0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x3F, 0x00, 0x40, 0x57, 0xC0, 0x4B,
+  0x40, 0x0B, 0x40, 0x00, 0xC0, 0x0F, 0xC0, 0x00, 0x40, 0x13, 0xC0, 0x00,
+  0xE0, 0x07, 0x13, 0xC0, 0x0F, 0xE0, 0x2B, 0x00, 0xE0, 0x07, 0x53, 0xE0,
+  0x07, 0x00, 0x40, 0x1F, 0xE0, 0x07, 0x13, 0xE0, 0x1F, 0x00, 0x40, 0x3B,
+  0x40, 0x00, 0x40, 0x2F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x5B,
+  0x00, 0x40, 0x6B, 0xC0, 0x00, 0xE0, 0x4B, 0x6F, 0x40, 0x5B, 0xE0, 0x37,
+  0x57, 0xC0, 0x43, 0x40, 0x07, 0xC0, 0x00, 0xE0, 0x37, 0x53, 0xE0, 0x17,
+  0x00, 0xE0, 0x13, 0x67, 0xC0, 0x1B, 0x40, 0x00, 0x40, 0x47, 0xC0, 0x07,
+  0x40, 0x00, 0xE0, 0x03, 0x0B, 0xE0, 0x83, 0x00, 0xE0, 0x0F, 0x97, 0x40,
+  0x17, 0xC0, 0x00, 0xE0, 0x13, 0xAF, 0xE0, 0x07, 0x23, 0xE0, 0x0B, 0x0F,
+  0xE0, 0x13, 0x3F, 0xE0, 0x47, 0x00, 0xC0, 0x7F, 0xE0, 0x13, 0x00, 0xC0,
+  0x73, 0xC0, 0x23, 0xC0, 0x0F, 0xE0, 0x27, 0x00, 0xC0, 0x3F, 0x40, 0x00,
+  0xE0, 0x07, 0x3B, 0x40, 0x13, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x1F, 0xE0,
+  0x17, 0x00, 0xE0, 0x33, 0x3B, 0xE0, 0x0F, 0x00, 0x40, 0x53, 0xE0, 0x0F,
+  0x1B, 0x40, 0x00, 0xC0, 0x1F, 0x40, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x1B,
+  0xE0, 0x43, 0x00, 0x40, 0x5B, 0xE0, 0x43, 0x4F, 0xC0, 0x00, 0x40, 0x57,
+  0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x1F, 0x00, 0xE0, 0x23, 0x33, 0x40, 0x2B,
+  0xE0, 0x17, 0x00, 0xE0, 0x1F, 0x77, 0xE0, 0x8F, 0x00, 0xE0, 0x07, 0xDF,
+  0xE0, 0x0F, 0xA7, 0xE0, 0x07, 0x27, 0xE0, 0x0B, 0x00, 0xE0, 0x0F, 0x3B,
+  0xE0, 0x3B, 0x00, 0x40, 0x6F, 0xE0, 0x0B, 0x47, 0x40, 0x17, 0xC0, 0x00,
+  0xC0, 0x1F, 0xC0, 0x0F, 0x40, 0x00, 0xC0, 0x13, 0x40, 0x00, 0x40, 0x0F,
+  0x40, 0x00, 0x40, 0x0B, 0xE0, 0x33, 0x00, 0x40, 0x43, 0x40, 0x00, 0xE0,
+  0x07, 0x43, 0x40, 0x13, 0xE0, 0x07, 0x00, 0x40, 0x23, 0x40, 0x13, 0x40,
+  0x07, 0xE0, 0x0B, 0x00, 0xE0, 0x03, 0x1B, 0x40, 0x0B, 0x40, 0x00, 0xE0,
+  0x0B, 0x27, 0xE0, 0x17, 0x00, 0x40, 0x37, 0x40, 0x00, 0xE0, 0x17, 0x27,
+  0x40, 0x00, 0x40, 0x27, 0x40, 0x00, 0xE0, 0x07, 0x0B, 0xE0, 0x0F, 0x00,
+  0x40, 0x2B, 0x40, 0x00, 0xE0, 0x0F, 0x1F, 0xE0, 0x6B, 0x00, 0x40, 0x8F,
+  0xC0, 0x00, 0xE0, 0x4F, 0x7F, 0x40, 0x5F, 0xE0, 0x03, 0x5B, 0x40, 0x0F,
+  0xE0, 0x03, 0x00, 0xE0, 0x03, 0x1B, 0xE0, 0xAF, 0x00, 0xE0, 0x03, 0xCF,
+  0x40, 0x00, 0xE0, 0x0F, 0xC7, 0x40, 0x1B, 0xE0, 0x17, 0x00, 0x40, 0x3B,
+  0xE0, 0x0B, 0x23, 0x40, 0x17, 0xE0, 0x33, 0x00, 0xE0, 0x07, 0x53, 0xE0,
+  0x07, 0x4B, 0xC0, 0x1F, 0xC0, 0x17, 0xC0, 0x0F, 0xC0, 0x00, 0xE0, 0x17,
+  0x17, 0xE0, 0x2F, 0x00, 0x40, 0x5F, 0x40, 0x3B, 0x40, 0x07, 0xE0, 0x17,
+  0x00, 0x40, 0x27, 0xE0, 0x07, 0x00, 0x40, 0x33, 0xE0, 0x0B, 0x13, 0x40,
+  0x00, 0xE0, 0x07, 0x17, 0xE0, 0x1B, 0x00, 0xE0, 0x17, 0x37, 0x40, 0x1F,
+  0xC0, 0x00, 0xC0, 0x4F, 0xC0, 0x0F, 0xC0, 0x00, 0xC0, 0x17, 0xE0, 0x3F,
+  0x00, 0x40, 0x57, 0xE0, 0x3F, 0x4B, 0xE0, 0x07, 0x00, 0x40, 0x5B, 0x40,
+  0x00, 0xE0, 0x07, 0x17, 0xE0, 0x43, 0x00, 0xE0, 0x03, 0x5F, 0x40, 0x0B,
+  0xE0, 0x03, 0x00, 0xE0, 0x43, 0x67, 0xE0, 0x17, 0x00, 0x40, 0x77, 0xE0,
+  0x17, 0x23, 0xE0, 0x37, 0x00, 0x40, 0x63, 0xE0, 0x03, 0x00, 0xE0, 0x03,
+  0x4F, 0xE0, 0x03, 0x17, 0xE0, 0x1B, 0x00, 0xE0, 0x03, 0x3B, 0xE0, 0x3F,
+  0x00, 0x40, 0x77, 0xE0, 0x07, 0x4B, 0x40, 0x13, 0xC0, 0x00, 0xC0, 0x1B,
+  0xC0, 0x0F, 0xE0, 0x0F, 0x00, 0x40, 0x27, 0xE0, 0x03, 0x1B, 0x40, 0x0F,
+  0xE0, 0x37, 0x00, 0xC0, 0x4F, 0x40, 0x47, 0xC0, 0x0B, 0xE0, 0x03, 0x00,
+  0x40, 0x17, 0xE0, 0x03, 0x00, 0xC0, 0x1B, 0xC0, 0x13, 0x40, 0x0F, 0xC0,
+  0x0B, 0xE0, 0x37, 0x00, 0xE0, 0x07, 0x4B, 0x40, 0x0F, 0x40, 0x00, 0xC0,
+  0x57, 0x40, 0x0B, 0xE0, 0x0F, 0x00, 0xC0, 0x23, 0xE0, 0x0F, 0x00, 0x40,
+  0x37, 0xE0, 0x0F, 0x1B, 0xE0, 0x93, 0x00, 0xE0, 0x3B, 0xB7, 0xE0, 0x07,
+  0x43, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x4F, 0xF7, 0x40, 0x5B, 0xE0, 0x07,
+  0x00, 0xE0, 0x43, 0x6B, 0x40, 0x5B, 0xE0, 0x07, 0x4F, 0x40, 0x13, 0xE0,
+  0x03, 0x00, 0xC0, 0x1F, 0xE0, 0x03, 0x13, 0xC0, 0x00, 0x40, 0x1B, 0xC0,
+  0x0B, 0xE0, 0x0B, 0x00, 0x40, 0x1F, 0xE0, 0x13, 0x00, 0xC0, 0x33, 0xE0,
+  0x0F, 0x23, 0x40, 0x1F, 0xE0, 0x0F, 0x1B, 0x40, 0x00, 0x40, 0x1F, 0x40,
+  0x00, 0xE0, 0x03, 0x0B, 0xE0, 0x0B, 0x00, 0x40, 0x1F, 0xE0, 0x0B, 0x00,
+  0xE0, 0x03, 0x2B, 0x40, 0x1F, 0x40, 0x0F, 0x40, 0x07, 0xE0, 0x33, 0x00,
+  0x40, 0x43, 0xE0, 0x07, 0x00, 0xE0, 0x0F, 0x4F, 0xE0, 0x1F, 0x27, 0xE0,
+  0x3B, 0x00, 0x40, 0x6B, 0xC0, 0x47, 0x40, 0x0B, 0x40, 0x00, 0xC0, 0x0F,
+  0xE0, 0xFF, 0x0C, 0x00, 0xE1, 0x7F, 0x1F, 0x40, 0x87, 0xC0, 0x00, 0xE1,
+  0x53, 0xA7, 0xC0, 0x63, 0xE0, 0x03, 0x00, 0xE0, 0x0B, 0x6F, 0xE0, 0x03,
+  0x1F, 0xE0, 0x13, 0x00, 0xE0, 0x0B, 0x3B, 0xE0, 0x37, 0x00, 0xE0, 0x03,
+  0x6F, 0xC0, 0x4B, 0x40, 0x13, 0xE0, 0x03, 0x0B, 0xE0, 0x1B, 0x00, 0xC0,
+  0x2F, 0x40, 0x00, 0x40, 0x2F, 0x40, 0x07, 0xE0, 0x33, 0x00, 0x40, 0x43,
+  0xE0, 0x17, 0x00, 0x40, 0x5F, 0xE0, 0x1B, 0x23, 0xC0, 0x00, 0x40, 0x2B,
+  0xC0, 0x0B, 0xE0, 0x2B, 0x00, 0xE0, 0x07, 0x3F, 0xE0, 0x07, 0x0F, 0x40,
+  0x00, 0xE0, 0x0B, 0x13, 0xE0, 0xFF, 0x0C, 0x00, 0xE1, 0x13, 0x27, 0xE0,
+  0x13, 0x1B, 0xE0, 0x37, 0x00, 0x40, 0x5B, 0x40, 0x00, 0xE0, 0x37, 0x47,
+  0xE0, 0x1B, 0x00, 0x40, 0x67, 0xE0, 0x07, 0x00, 0xE0, 0x13, 0x37, 0xE0,
+  0x07, 0x2B, 0x40, 0x00, 0x40, 0x2F, 0x40, 0x07, 0xC0, 0x00, 0x40, 0x0F,
+  0xE0, 0x2B, 0x00, 0x40, 0x3F, 0xE0, 0x03, 0x37, 0x40, 0x0F, 0xE0, 0x07,
+  0x00, 0xC0, 0x1F, 0xC0, 0x17, 0x40, 0x0F, 0xC0, 0x0B, 0xE0, 0x07, 0x00,
+  0x40, 0x1B, 0x40, 0x00, 0xC0, 0x17, 0x40, 0x0B, 0xE0, 0x0B, 0x00, 0x40,
+  0x1F, 0xE0, 0x0B, 0x17, 0xE0, 0x0B, 0x00, 0xE0, 0x07, 0x2B, 0x40, 0x0F,
+  0xE0, 0x2F, 0x00, 0xE0, 0x03, 0x5F, 0xE0, 0x03, 0x43, 0xE0, 0x03, 0x17,
+  0xE0, 0x27, 0x00, 0x40, 0x47, 0xE0, 0x03, 0x33, 0xE0, 0x03, 0x0F, 0xC0,
+  0x0B, 0x40, 0x07, 0x40, 0x00, 0xE0, 0x03, 0x27, 0xE0, 0xFF, 0x24, 0x00,
+  0x41, 0x3B, 0x40, 0x00, 0xE1, 0x53, 0x33, 0xE0, 0x57, 0x5F, 0xE0, 0x03,
+  0x00, 0x40, 0x6B, 0xC0, 0x00, 0x40, 0x17, 0xC0, 0x0B, 0xE0, 0x03, 0x00,
+  0x40, 0x17, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x13, 0x00, 0x40, 0x2B,
+  0xE0, 0x2F, 0x00, 0x40, 0x57, 0xC0, 0x3B, 0x40, 0x0B, 0xC0, 0x00, 0xC0,
+  0x13, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xC0, 0x0B, 0x40, 0x00, 0x40, 0x1B,
+  0xE0, 0x07, 0x00, 0x40, 0x17, 0x40, 0x00, 0xE0, 0x07, 0x17, 0xE0, 0x03,
+  0x00, 0xE0, 0x17, 0x1F, 0xC0, 0x00, 0xC0, 0x27, 0x40, 0x07, 0xE0, 0x33,
+  0x00, 0xC0, 0x4F, 0xE0, 0x07, 0x00, 0x40, 0x53, 0xE0, 0x07, 0x13, 0xE0,
+  0x23, 0x00, 0xE0, 0x03, 0x3F, 0x40, 0x0B, 0xE0, 0x1F, 0x00, 0xE0, 0x23,
+  0x63, 0xE0, 0x43, 0x00, 0xC0, 0x9F, 0xE0, 0x3B, 0x53, 0x40, 0x4B, 0xE0,
+  0x3B, 0x47, 0xE0, 0x53, 0x00, 0x40, 0xA3, 0xC0, 0x00, 0xE0, 0x2F, 0x67,
+  0xE0, 0x37, 0x3F, 0xE0, 0x0B, 0x00, 0xC0, 0x53, 0xE0, 0x0F, 0x00, 0x40,
+  0x33, 0xE0, 0x03, 0x1B, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0,
+  0x0B, 0x00, 0x40, 0x23, 0xE0, 0x27, 0x00, 0xC0, 0x47, 0xE0, 0x13, 0x37,
+  0x40, 0x23, 0xE0, 0x03, 0x1F, 0x40, 0x0F, 0xC0, 0x00, 0xE0, 0x03, 0x17,
+  0xE0, 0x13, 0x00, 0xE0, 0x03, 0x2F, 0x40, 0x0B, 0xC0, 0x2B, 0x40, 0x0B,
+  0xE0, 0x13, 0x00, 0x40, 0x27, 0xE0, 0x0F, 0x1F, 0x40, 0x1B, 0xC0, 0x00,
+  0xE0, 0x03, 0x23, 0xC0, 0x13, 0xE0, 0x1B, 0x00, 0xC0, 0x37, 0xE0, 0x1B,
+  0x2B, 0xE0, 0x17, 0x00, 0x40, 0x4B, 0xC0, 0x23, 0x40, 0x0B, 0xE0, 0x07,
+  0x00, 0xC0, 0x1B, 0xE0, 0x6F, 0x00, 0x40, 0x8F, 0xE0, 0x0F, 0x7B, 0x40,
+  0x1B, 0xC0, 0x00, 0xE0, 0x0F, 0x23, 0xE0, 0x2F, 0x00, 0x40, 0x57, 0xE0,
+  0x2F, 0x3B, 0xE0, 0x77, 0x00, 0x40, 0xBB, 0xC0, 0x00, 0xE0, 0x43, 0x8B,
+  0xC0, 0x53, 0xE0, 0x0B, 0x00, 0xE0, 0x17, 0x67, 0xE0, 0x0B, 0x33, 0xC0,
+  0x00, 0xE0, 0x0B, 0x3B, 0x40, 0x1B, 0xE0, 0x03, 0x17, 0x40, 0x0F, 0xE0,
+  0x07, 0x00, 0xE0, 0x03, 0x1F, 0xE0, 0x0B, 0x00, 0xE0, 0x03, 0x2F, 0xC0,
+  0x1F, 0x40, 0x13, 0xE0, 0x0B, 0x0B, 0xE0, 0x0F, 0x00, 0xE0, 0x03, 0x2F,
+  0xC0, 0x00, 0x40, 0x13, 0xE0, 0x27, 0x00, 0xC0, 0x3B, 0x40, 0x00, 0xE0,
+  0x07, 0x3B, 0x40, 0x13, 0xE0, 0x63, 0x00, 0xE0, 0x03, 0x7F, 0xE0, 0x07,
+  0x77, 0xE0, 0x13, 0x1B, 0xE0, 0x6B, 0x00, 0x40, 0x8F, 0xE0, 0x0F, 0x77,
+  0x40, 0x1B, 0xC0, 0x00, 0xE0, 0x0F, 0x23, 0xE0, 0xEB, 0x00, 0xC1, 0x13,
+  0x40, 0x00, 0xE0, 0x17, 0xFF, 0xE0, 0x1B, 0x23, 0xC0, 0x00, 0x40, 0x2B,
+  0xE0, 0x0F, 0x00, 0xC0, 0x23, 0x40, 0x00, 0x40, 0x23, 0xE0, 0x03, 0x07,
+  0x40, 0x00, 0xC0, 0x13, 0x40, 0x00, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0x0F,
+  0xE0, 0x0B, 0x00, 0x40, 0x1F, 0xE0, 0x03, 0x17, 0x40, 0x0F, 0xE0, 0x07,
+  0x00, 0xE0, 0x03, 0x1F, 0xE0, 0x0F, 0x00, 0xC0, 0x33, 0xE0, 0x03, 0x1F,
+  0xC0, 0x13, 0x40, 0x00, 0xE0, 0x03, 0x17, 0xE0, 0x0B, 0x00, 0xE0, 0x0B,
+  0x23, 0x40, 0x13, 0xE0, 0x0B, 0x00, 0xC0, 0x3F, 0xC0, 0x1B, 0xC0, 0x0F,
+  0xE0, 0x07, 0x00, 0xC0, 0x1F, 0xC0, 0x00, 0xE0, 0x07, 0x1F, 0xE0, 0x73,
+  0x00, 0xE0, 0x87, 0x93, 0xC0, 0x8F, 0x40, 0x00, 0xE1, 0x0F, 0x17, 0xE0,
+  0x13, 0x1B, 0xE0, 0xEB, 0x00, 0x41, 0x0F, 0xC0, 0x00, 0xE0, 0x17, 0xFF,
+  0x40, 0x27, 0xE0, 0x17, 0x23, 0xE0, 0x03, 0x00, 0x40, 0x2F, 0xE0, 0x1B,
+  0x00, 0x40, 0x33, 0xE0, 0x0B, 0x27, 0xE0, 0x07, 0x17, 0x40, 0x0F, 0x40,
+  0x00, 0x40, 0x2B, 0x40, 0x07, 0xE0, 0x17, 0x00, 0x40, 0x27, 0x40, 0x00,
+  0xE0, 0x17, 0x27, 0xC0, 0x00, 0xE0, 0x0F, 0x2B, 0xE0, 0x0F, 0x17, 0xE0,
+  0x07, 0x00, 0xE0, 0x07, 0x27, 0x40, 0x0F, 0x40, 0x00, 0x40, 0x27, 0x40,
+  0x07, 0xC0, 0x00, 0xC0, 0x0F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x17, 0x40,
+  0x07, 0x40, 0x00, 0xC0, 0x0B, 0x40, 0x07, 0xE0, 0x07, 0x00, 0x40, 0x1F,
+  0xE0, 0x37, 0x00, 0xC0, 0x53, 0xE0, 0x37, 0x47, 0x40, 0x00, 0xE0, 0x43,
+  0x4B, 0xE0, 0x23, 0x00, 0xE0, 0x0F, 0x77, 0xC0, 0x17, 0x40, 0x00, 0xE0,
+  0x13, 0x4F, 0x40, 0x1F, 0x40, 0x00, 0xE0, 0x13, 0x23, 0xE0, 0xE3, 0x00,
+  0x41, 0x0B, 0x40, 0x00, 0xE0, 0x47, 0xF3, 0x40, 0x53, 0xC0, 0x00, 0xC0,
+  0x5B, 0xC0, 0x0F, 0xE0, 0x27, 0x00, 0xC0, 0x3F, 0xE0, 0x27, 0x00, 0xE0,
+  0x03, 0x67, 0xE0, 0x27, 0x3B, 0xE0, 0x37, 0x00, 0x40, 0x7B, 0x40, 0x43,
+  0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00,
+  0x40, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x07, 0x00, 0xC0, 0x1F,
+  0x40, 0x17, 0xE0, 0x03, 0x0B, 0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x03, 0x00,
+  0xE0, 0x17, 0x17, 0x40, 0x1F, 0xC0, 0x00, 0xE0, 0x03, 0x37, 0xE0, 0x13,
+  0x00, 0xE0, 0x27, 0x2F, 0xE0, 0x57, 0x00, 0xC0, 0x8F, 0xC0, 0x00, 0xC0,
+  0x6F, 0x40, 0x0F, 0xC0, 0x0B, 0xE0, 0x0B, 0x00, 0x40, 0x1F, 0xC0, 0x00,
+  0xE0, 0x0B, 0x1F, 0xC0, 0x00, 0x40, 0x23, 0xC0, 0x0B, 0xE0, 0xF3, 0x00,
+  0xE1, 0x33, 0x07, 0x40, 0x3B, 0x40, 0x00, 0xE1, 0x03, 0x3F, 0x40, 0x0F,
+  0x40, 0x00, 0x40, 0x13, 0x40, 0x07, 0xE0, 0x23, 0x00, 0x40, 0x33, 0xE0,
+  0x1F, 0x00, 0x40, 0x57, 0xE0, 0x1F, 0x2B, 0xE0, 0x1B, 0x00, 0xE0, 0x2F,
+  0x4F, 0xC0, 0x37, 0xC0, 0x07, 0xC0, 0x00, 0xE0, 0x07, 0x0F, 0xC0, 0x00,
+  0x40, 0x17, 0xE0, 0x0F, 0x00, 0xC0, 0x23, 0xE0, 0x37, 0x00, 0xE0, 0x0B,
+  0x5F, 0xE0, 0x13, 0x53, 0xC0, 0x2F, 0xE0, 0x13, 0x23, 0xE0, 0x63, 0x00,
+  0xE0, 0x03, 0x8F, 0xC0, 0x0B, 0x40, 0x00, 0xE0, 0x0F, 0x83, 0xE0, 0x13,
+  0x1B, 0xE0, 0x0F, 0x00, 0xE0, 0x2B, 0x33, 0xE0, 0xFF, 0x04, 0x00, 0xE1,
+  0x0B, 0x3F, 0x40, 0x13, 0x40, 0x00, 0xC1, 0x27, 0x40, 0x0B, 0xE0, 0x1B,
+  0x00, 0xE0, 0x03, 0x2F, 0xC0, 0x0B, 0x40, 0x00, 0x40, 0x3B, 0x40, 0x07,
+  0xE0, 0x17, 0x00, 0x40, 0x27, 0x40, 0x00, 0xE0, 0x17, 0x27, 0xE0, 0x0F,
+  0x00, 0x40, 0x3B, 0x40, 0x00, 0xE0, 0x0F, 0x1F, 0xE0, 0x0F, 0x00, 0xE0,
+  0x0F, 0x33, 0x40, 0x17, 0xE0, 0x07, 0x00, 0x40, 0x43, 0xE0, 0x07, 0x13,
+  0xE0, 0x07, 0x00, 0x40, 0x23, 0xE0, 0x0F, 0x00, 0x40, 0x2B, 0xE0, 0x0F,
+  0x1B, 0xE0, 0x13, 0x00, 0xE0, 0x2F, 0x37, 0xC0, 0x00, 0xE0, 0x07, 0x3F,
+  0xE0, 0x17, 0x0F, 0xE0, 0x3F, 0x00, 0x40, 0x67, 0xE0, 0x0B, 0x00, 0xE0,
+  0x3B, 0x5F, 0xC0, 0x57, 0xE0, 0x3B, 0x4B, 0xE0, 0x0F, 0x00, 0x40, 0x63,
+  0xE0, 0x0F, 0x1B, 0xE0, 0xD3, 0x00, 0xE0, 0x0B, 0xF7, 0x40, 0x13, 0xE0,
+  0x13, 0x00, 0xE1, 0x03, 0x0F, 0x40, 0x27, 0xE0, 0x03, 0x0F, 0xE0, 0x1B,
+  0x00, 0x40, 0x33, 0x40, 0x00, 0xE0, 0x1B, 0x2B, 0xE0, 0x0F, 0x00, 0xE0,
+  0x37, 0x3F, 0xC0, 0x00, 0x40, 0x47, 0xE0, 0x0B, 0x00, 0x40, 0x1F, 0xE0,
+  0x0B, 0x17, 0xC0, 0x00, 0x40, 0x1F, 0xE0, 0x0B, 0x00, 0xC0, 0x1F, 0x40,
+  0x00, 0xE0, 0x0B, 0x1F, 0xE0, 0x37, 0x00, 0xE0, 0x13, 0x57, 0x40, 0x1B,
+  0xC0, 0x00, 0x40, 0x67, 0xE0, 0x0B, 0x0B, 0xC0, 0x00, 0x40, 0x1F, 0xE0,
+  0x43, 0x00, 0xE0, 0x03, 0x57, 0xC0, 0x0B, 0x40, 0x00, 0xE0, 0x43, 0x63,
+  0xE0, 0x4B, 0x00, 0x40, 0xA3, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x63, 0xE0,
+  0x13, 0x1B, 0xC0, 0x00, 0xC0, 0x23, 0xC0, 0x0F, 0xE0, 0x27, 0x00, 0x40,
+  0x3F, 0xC0, 0x33, 0xE0, 0x03, 0x0B, 0xE0, 0x5B, 0x00, 0x40, 0x6F, 0x40,
+  0x00, 0xE0, 0x0F, 0x6B, 0x40, 0x1B, 0xE0, 0x0B, 0x00, 0xE0, 0x0F, 0x2F,
+  0xE0, 0x17, 0x00, 0xE0, 0x03, 0x4B, 0xE0, 0x1F, 0x2B, 0xE0, 0x07, 0x27,
+  0x40, 0x43, 0xE0, 0x07, 0x13, 0xE0, 0x27, 0x00, 0x40, 0x43, 0xE0, 0x23,
+  0x00, 0xE0, 0x1F, 0x5F, 0xC0, 0x53, 0xE0, 0x1F, 0x2F, 0xE0, 0x27, 0x00,
+  0x40, 0x5F, 0xE0, 0x0B, 0x33, 0x40, 0x17, 0xE0, 0x03, 0x00, 0xC0, 0x23,
+  0xE0, 0x03, 0x13, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x1F, 0xC0, 0x0F, 0xE0,
+  0x2F, 0x00, 0xC0, 0x5B, 0x40, 0x3F, 0xC0, 0x0B, 0x40, 0x00, 0x40, 0x0F,
+  0xE0, 0x8F, 0x00, 0x40, 0x9F, 0xE0, 0x0B, 0x00, 0xE0, 0x07, 0xAF, 0xC0,
+  0x23, 0xE0, 0x07, 0x17, 0xC0, 0x00, 0xC0, 0x1F, 0x40, 0x00, 0xC0, 0x13,
+  0xE0, 0xBB, 0x00, 0x40, 0xCF, 0xC0, 0x00, 0x40, 0xCF, 0xC0, 0x0B, 0x40,
+  0x00, 0x40, 0x0F, 0xE0, 0x0F, 0x00, 0xC0, 0x1F, 0x40, 0x07, 0x40, 0x00,
+  0xC0, 0x27, 0x40, 0x0B, 0xC0, 0x00, 0xC0, 0x13, 0xE0, 0x0F, 0x00, 0xC0,
+  0x27, 0xC0, 0x00, 0xE0, 0x0F, 0x27, 0xE0, 0x3B, 0x00, 0xC0, 0x63, 0xE0,
+  0x17, 0x00, 0xE0, 0x03, 0x6B, 0x40, 0x2B, 0xE0, 0x03, 0x0F, 0xC0, 0x00,
+  0xE0, 0x0F, 0x17, 0xE0, 0x4F, 0x00, 0x40, 0x6F, 0x40, 0x00, 0xC0, 0x5F,
+  0x40, 0x0B, 0x40, 0x00, 0xC0, 0x0F, 0x40, 0x00, 0x40, 0x0F, 0xE0, 0x17,
+  0x00, 0x40, 0x27, 0xE0, 0x2B, 0x00, 0xE0, 0x4F, 0x57, 0xE0, 0x53, 0x00,
+  0xE0, 0x07, 0xB3, 0x40, 0x6B, 0xC0, 0x13, 0x40, 0x0B, 0xE0, 0x0B, 0x00,
+  0xE0, 0x07, 0x1F, 0xE0, 0x03, 0x0F, 0xE0, 0x03, 0x0B, 0xE0, 0xB7, 0x00,
+  0xC0, 0xCB, 0xE0, 0x07, 0x00, 0x40, 0xD7, 0xC0, 0x13, 0x40, 0x0B, 0xE0,
+  0x0F, 0x00, 0xC0, 0x23, 0x40, 0x00, 0xE0, 0x0B, 0x23, 0xE0, 0x0F, 0x17,
+  0xE0, 0x13, 0x00, 0x40, 0x33, 0xE0, 0x03, 0x00, 0xE0, 0x13, 0x2B, 0xE0,
+  0x2B, 0x00, 0xE0, 0x03, 0x5B, 0xE0, 0x17, 0x00, 0xC0, 0x5F, 0xC0, 0x27,
+  0xC0, 0x0F, 0xE0, 0x0B, 0x00, 0x40, 0x23, 0xE0, 0x23, 0x17, 0xE0, 0x3B,
+  0x00, 0xC0, 0x73, 0x40, 0x07, 0x40, 0x00, 0x40, 0x53, 0x40, 0x07, 0xE0,
+  0x1B, 0x00, 0x40, 0x2B, 0xE0, 0x23, 0x00, 0xE0, 0x4B, 0x53, 0xE0, 0x73,
+  0x00, 0x40, 0xCF, 0x40, 0x7F, 0xE0, 0x03, 0x07, 0x40, 0x00, 0x40, 0x13,
+  0xE0, 0x0B, 0x00, 0x40, 0x1B, 0xC0, 0x00, 0x40, 0x1F, 0xE0, 0x03, 0x0B,
+  0xE0, 0xAF, 0x00, 0xC0, 0xC3, 0xE0, 0x17, 0x00, 0xC0, 0xDF, 0x40, 0x27,
+  0xC0, 0x0B, 0x40, 0x00, 0x40, 0x0F, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x37,
+  0x00, 0xC0, 0x4B, 0x40, 0x00, 0xE0, 0x37, 0x4B, 0xE0, 0x0F, 0x00, 0x40,
+  0x5B, 0xE0, 0x1F, 0x00, 0x40, 0x43, 0xE0, 0x03, 0x2B, 0xE0, 0x0B, 0x0F,
+  0xE0, 0x17, 0x00, 0x40, 0x3F, 0xE0, 0x17, 0x23, 0xE0, 0x3B, 0x00, 0x40,
+  0x67, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x53, 0xE0, 0x13, 0x1B, 0xE0, 0x0F,
+  0x00, 0x40, 0x33, 0x40, 0x1B, 0x40, 0x07, 0xC0, 0x00, 0xE0, 0x07, 0x0F,
+  0xC0, 0x00, 0x40, 0x17, 0xE0, 0x03, 0x00, 0x40, 0x17, 0xE0, 0x03, 0x0F,
+  0xE0, 0x8B, 0x00, 0x40, 0xA3, 0x40, 0x00, 0x40, 0x9B, 0x40, 0x07, 0x40,
+  0x00, 0x40, 0x0B, 0xE0, 0x0F, 0x00, 0x40, 0x1F, 0xE0, 0x0B, 0x00, 0xE0,
+  0x0F, 0x2F, 0xE0, 0x93, 0x00, 0xE0, 0x0B, 0xC7, 0xE0, 0x0F, 0x00, 0xE0,
+  0x0F, 0xC7, 0xE0, 0x07, 0x2F, 0xE0, 0x0F, 0x27, 0xE0, 0x0B, 0x00, 0xE0,
+  0x03, 0x3B, 0x40, 0x1F, 0xE0, 0x07, 0x0F, 0xE0, 0x4B, 0x00, 0xC0, 0x63,
+  0x40, 0x5B, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xC0, 0x13, 0xE0, 0x23, 0x00,
+  0xE0, 0x03, 0x3B, 0xC0, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x4B, 0xE0, 0x03,
+  0x0F, 0xE0, 0x4F, 0x00, 0x40, 0x67, 0xE0, 0x0B, 0x00, 0xE0, 0x03, 0x6F,
+  0xC0, 0x1F, 0xE0, 0x03, 0x13, 0xE0, 0x13, 0x00, 0x40, 0x2F, 0x40, 0x1F,
+  0x40, 0x07, 0x40, 0x00, 0xE0, 0x03, 0x0B, 0xE0, 0x23, 0x00, 0x40, 0x37,
+  0xE0, 0x8B, 0x00, 0xC0, 0xC3, 0x40, 0x9B, 0xE0, 0x03, 0x0B, 0xE0, 0x17,
+  0x00, 0xE0, 0x23, 0x2B, 0xE0, 0x2F, 0x00, 0x40, 0x63, 0xE0, 0x2F, 0x3B,
+  0xE0, 0x1F, 0x00, 0x40, 0x63, 0xE0, 0x1B, 0x00, 0xE0, 0x07, 0x4F, 0x40,
+  0x33, 0xC0, 0x13, 0xC0, 0x0B, 0xC0, 0x07, 0xE0, 0x23, 0x00, 0xE0, 0x23,
+  0x33, 0x40, 0x2B, 0xC0, 0x00, 0xE0, 0x23, 0x63, 0xE0, 0x0F, 0x00, 0xE0,
+  0x07, 0x4B, 0xC0, 0x0F, 0xE0, 0x13, 0x00, 0x40, 0x4B, 0xE0, 0x03, 0x1F,
+  0x40, 0x0F, 0xE0, 0x5B, 0x00, 0x40, 0x73, 0xE0, 0x0F, 0x67, 0xE0, 0x03,
+  0x1B, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x33, 0xC0, 0x1B, 0xE0,
+  0x07, 0x17, 0xE0, 0x27, 0x00, 0xC0, 0x47, 0xE0, 0x1F, 0x00, 0xE0, 0x27,
+  0x5F, 0xE0, 0x5F, 0x00, 0xC0, 0xBF, 0xE0, 0x0F, 0x6F, 0xE0, 0x17, 0x1F,
+  0xE0, 0x53, 0x00, 0xC0, 0x7B, 0x40, 0x00, 0xE0, 0x5F, 0x67, 0xE0, 0x27,
+  0x00, 0x40, 0x97, 0xE0, 0x07, 0x33, 0x40, 0x13, 0xE0, 0x4B, 0x00, 0xE0,
+  0x03, 0x67, 0xE0, 0x3F, 0x5F, 0xE0, 0x03, 0x53, 0xE0, 0x1B, 0x00, 0xE0,
+  0x0B, 0x77, 0x40, 0x37, 0xE0, 0x0B, 0x17, 0xE0, 0x3F, 0x00, 0x40, 0x5F,
+  0x40, 0x00, 0xE0, 0x1B, 0x4F, 0x40, 0x27, 0xE0, 0x03, 0x00, 0xE0, 0x07,
+  0x33, 0x40, 0x1B, 0xE0, 0x07, 0x13, 0xE0, 0x2F, 0x00, 0x40, 0x4B, 0xC0,
+  0x00, 0xE0, 0x07, 0x43, 0x40, 0x17, 0xE0, 0x07, 0x13, 0xE0, 0x5F, 0x00,
+  0x40, 0x7B, 0x40, 0x00, 0xE0, 0x13, 0x6F, 0xC0, 0x1F, 0x40, 0x07, 0x40,
+  0x00, 0xE0, 0x0F, 0x2B, 0x40, 0x1B, 0xC0, 0x00, 0xE0, 0x17, 0x23, 0xE0,
+  0x0F, 0x1F, 0xE0, 0x33, 0x00, 0x40, 0x7B, 0xE0, 0x33, 0x3F, 0xE0, 0x1F,
+  0x00, 0x40, 0x67, 0xE0, 0x2B, 0x00, 0xC0, 0x5F, 0xE0, 0x07, 0x3B, 0xC0,
+  0x17, 0xE0, 0xA3, 0x00, 0x40, 0xC3, 0x40, 0xAF, 0x40, 0x07, 0xE0, 0x0F,
+  0x00, 0x40, 0x1F, 0x40, 0x00, 0x40, 0x1F, 0x40, 0x07, 0xE0, 0x57, 0x00,
+  0x40, 0x67, 0x40, 0x00, 0xE0, 0x13, 0x67, 0xE0, 0x0B, 0x1F, 0xE0, 0x0B,
+  0x13, 0x40, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x2F, 0x00, 0x40, 0x4F, 0x40,
+  0x00, 0xE0, 0x2F, 0x3F, 0xE0, 0x43, 0x00, 0x40, 0x87, 0xE0, 0x13, 0x00,
+  0xC0, 0x6B, 0xE0, 0x0B, 0x23, 0xC0, 0x1B, 0xE0, 0x0F, 0x00, 0x40, 0x33,
+  0xE0, 0x07, 0x1B, 0xC0, 0x13, 0x40, 0x07, 0x40, 0x00, 0xE0, 0x07, 0x1F,
+  0xE0, 0x27, 0x00, 0xE0, 0x3B, 0x43, 0xE0, 0x23, 0x00, 0xE0, 0x07, 0x6F,
+  0x40, 0x0F, 0xE0, 0x2F, 0x00, 0xE0, 0x0B, 0x77, 0x40, 0x4B, 0xE0, 0x0B,
+  0x17, 0xC0, 0x00, 0x40, 0x1F, 0x40, 0x00, 0xC0, 0x0F, 0x40, 0x00, 0x40,
+  0x0F, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x73, 0x00, 0x40, 0x83, 0x40, 0x00,
+  0x40, 0x83, 0x40, 0x07, 0xE0, 0x0F, 0x00, 0x40, 0x1F, 0xE0, 0x07, 0x00,
+  0x40, 0x2B, 0xE0, 0x07, 0x13, 0xE0, 0x2F, 0x00, 0xE0, 0x43, 0x4B, 0xE0,
+  0xD7, 0x00, 0x41, 0x2B, 0xE0, 0x17, 0x00, 0x41, 0x03, 0xC0, 0x23, 0x40,
+  0x0B, 0xE0, 0x1B, 0x00, 0xE0, 0x27, 0x2F, 0xE0, 0xAF, 0x00, 0xC0, 0xE7,
+  0xE0, 0x1B, 0x00, 0x40, 0xE3, 0xC0, 0x27, 0x40, 0x0B, 0xE0, 0x0F, 0x00,
+  0xE0, 0x17, 0x23, 0x40, 0x1F, 0xE0, 0x03, 0x3B, 0xE0, 0x07, 0x0F, 0xE0,
+  0x47, 0x00, 0xE0, 0x1F, 0x5F, 0xE0, 0x03, 0x27, 0x40, 0x0B, 0xE0, 0x07,
+  0x00, 0x40, 0x97, 0xE0, 0x0B, 0x13, 0xE0, 0x13, 0x00, 0xC0, 0x2F, 0x40,
+  0x23, 0xE0, 0x03, 0x0B, 0xE0, 0x13, 0x00, 0x40, 0x27, 0xE0, 0x03, 0x1F,
+  0xE0, 0x07, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0xC0, 0x00, 0xE0, 0x03,
+  0x17, 0xE0, 0x67, 0x00, 0xE0, 0x73, 0x83, 0xC0, 0x7B, 0xE0, 0x03, 0x00,
+  0x40, 0xFF, 0xE0, 0x03, 0x0F, 0xC0, 0x00, 0x40, 0x17, 0xE0, 0x13, 0x00,
+  0xC0, 0x27, 0xE0, 0x03, 0x00, 0xE0, 0x13, 0x2F, 0xE0, 0x0F, 0x00, 0x40,
+  0x3F, 0xE0, 0x0F, 0x1B, 0xE0, 0x17, 0x00, 0x40, 0x3B, 0x40, 0x00, 0xE0,
+  0x17, 0x27, 0xE0, 0x1F, 0x00, 0x40, 0x4B, 0x40, 0x00, 0xE0, 0x13, 0x2F,
+  0xC0, 0x1F, 0x40, 0x07, 0xE0, 0x0F, 0x00, 0xE0, 0x0B, 0x3F, 0xC0, 0x2B,
+  0xE0, 0x03, 0x1B, 0xC0, 0x13, 0xC0, 0x00, 0xE0, 0x03, 0x1B, 0xE0, 0x5F,
+  0x00, 0xE0, 0x27, 0x7B, 0xE0, 0x13, 0x2F, 0xC0, 0x1B, 0xE0, 0x0B, 0x00,
+  0xE0, 0x4B, 0xCF, 0x40, 0x67, 0xE0, 0x03, 0x57, 0xE0, 0x1B, 0x0F, 0x40,
+  0x00, 0xE0, 0x03, 0x33, 0xE0, 0x47, 0x00, 0xE0, 0x57, 0x5F, 0xE0, 0x33,
+  0x00, 0x40, 0x9B, 0xE0, 0x07, 0x00, 0xE0, 0x33, 0x4F, 0xE0, 0x1B, 0x00,
+  0xC0, 0x6F, 0xE0, 0x1B, 0x2B, 0xE0, 0x77, 0x00, 0xC0, 0xAB, 0xC0, 0x00,
+  0xE0, 0x07, 0x8F, 0xE0, 0x03, 0x17, 0xC0, 0x0B, 0xE0, 0x13, 0x00, 0x40,
+  0x3F, 0x40, 0x1F, 0x40, 0x07, 0xE0, 0x07, 0x00, 0x40, 0x17, 0xE0, 0x07,
+  0x00, 0xE0, 0x07, 0x23, 0xE0, 0x5B, 0x00, 0xC0, 0x83, 0xE0, 0x1B, 0x6B,
+  0xC0, 0x2B, 0xC0, 0x00, 0xE0, 0x03, 0x33, 0xC0, 0x13, 0x40, 0x00, 0xE0,
+  0x03, 0x17, 0xE0, 0x43, 0x00, 0x40, 0x5B, 0x40, 0x00, 0xE0, 0x03, 0x53,
+  0xC0, 0x0F, 0x40, 0x07, 0x40, 0x00, 0xE0, 0x07, 0x1B, 0x40, 0x00, 0xE0,
+  0x03, 0x13, 0x40, 0x00, 0x40, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0,
+  0xD7, 0x00, 0xE0, 0x03, 0xEF, 0x40, 0x00, 0xC0, 0xEF, 0xE0, 0x03, 0x0B,
+  0xE0, 0x43, 0x00, 0x40, 0x57, 0xE0, 0x07, 0x00, 0xE0, 0x43, 0x5F, 0xE0,
+  0x4B, 0x00, 0xE0, 0x03, 0xAF, 0xE0, 0x07, 0x5F, 0xE0, 0x03, 0x1B, 0xE0,
+  0x13, 0x00, 0x40, 0x37, 0xE0, 0x07, 0x1F, 0x40, 0x13, 0xC0, 0x00, 0xC0,
+  0x1B, 0x40, 0x0F, 0xC0, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x17, 0xE0, 0x5F,
+  0x00, 0xC0, 0x77, 0xE0, 0x1B, 0x6F, 0xC0, 0x2B, 0xC0, 0x00, 0xE0, 0x07,
+  0x33, 0xE0, 0x0F, 0x17, 0xE0, 0x0B, 0x00, 0x40, 0x2B, 0xE0, 0x07, 0x17,
+  0x40, 0x13, 0x40, 0x00, 0xE0, 0x07, 0x17, 0xE0, 0x07, 0x00, 0x40, 0x23,
+  0xE0, 0x17, 0x00, 0xC0, 0x33, 0x40, 0x27, 0xC0, 0x0B, 0xC0, 0x00, 0x40,
+  0x13, 0xE0, 0x03, 0x00, 0xC0, 0x17, 0xE0, 0x47, 0x00, 0x40, 0x63, 0xE0,
+  0x47, 0x53, 0xE0, 0x3F, 0x00, 0x40, 0x9B, 0x40, 0x00, 0xE0, 0x3F, 0x4F,
+  0xE0, 0x0B, 0x00, 0x40, 0x5F, 0xC0, 0x00, 0xE0, 0x0B, 0x1F, 0xE0, 0x8B,
+  0x00, 0xC0, 0xAF, 0xC0, 0x00, 0xC0, 0xA3, 0xC0, 0x0F, 0xC0, 0x00, 0x40,
+  0x17, 0xC0, 0x0B, 0xE0, 0x0F, 0x00, 0xC0, 0x23, 0x40, 0x07, 0xE0, 0x07,
+  0x00, 0xE0, 0x0F, 0x33, 0x40, 0x00, 0xE0, 0x07, 0x2B, 0xE0, 0x4F, 0x00,
+  0x40, 0x6B, 0x40, 0x00, 0xE0, 0x1B, 0x5F, 0x40, 0x27, 0x40, 0x00, 0x40,
+  0x2B, 0xC0, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x03, 0x00, 0xC0,
+  0x1B, 0x40, 0x13, 0xC0, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x0B, 0x17, 0x40,
+  0x13, 0x40, 0x00, 0xE0, 0x03, 0x27, 0xE0, 0x0B, 0x00, 0x40, 0x23, 0xE0,
+  0x1B, 0x00, 0xE0, 0x0B, 0x3B, 0x40, 0x00, 0xC0, 0x3B, 0x40, 0x0B, 0xE0,
+  0x43, 0x00, 0xE0, 0x07, 0x57, 0x40, 0x0F, 0xC0, 0x5F, 0x40, 0x0B, 0x40,
+  0x00, 0xC0, 0x0F, 0xE0, 0x0F, 0x00, 0x40, 0x23, 0x40, 0x00, 0xE0, 0x0F,
+  0x1F, 0xE0, 0x3F, 0x00, 0x40, 0x63, 0xC0, 0x00, 0xE0, 0x3F, 0x53, 0xE0,
+  0x0B, 0x00, 0xE0, 0x23, 0x63, 0x40, 0x2B, 0xE0, 0x0B, 0x43, 0xE0, 0x5F,
+  0x00, 0x40, 0x7F, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x7B, 0xE0, 0x07, 0x1B,
+  0xE0, 0x0F, 0x00, 0xE0, 0x03, 0x33, 0xE0, 0x0F, 0x00, 0xE0, 0x07, 0x3B,
+  0xE0, 0x03, 0x27, 0x40, 0x1B, 0xE0, 0x03, 0x0F, 0xE0, 0x53, 0x00, 0xE0,
+  0x23, 0x6B, 0xE0, 0x07, 0x2B, 0x40, 0x0F, 0xE0, 0x1F, 0x00, 0xE0, 0x07,
+  0xC3, 0x40, 0x37, 0xE0, 0x07, 0x13, 0xE0, 0x27, 0x00, 0x40, 0x43, 0x40,
+  0x00, 0x40, 0x37, 0xC0, 0x07, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40,
+  0x0B, 0x40, 0x00, 0x40, 0x0B, 0xC0, 0x00, 0xE0, 0x0B, 0x0F, 0xE0, 0x57,
+  0x00, 0xC0, 0x7B, 0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x73, 0x40, 0x23, 0xE0,
+  0x0F, 0x1B, 0xE0, 0x0B, 0x00, 0xE0, 0x27, 0x2F, 0xC0, 0x00, 0x40, 0x37,
+  0xC0, 0x00, 0xC0, 0x13, 0xE0, 0x2F, 0x00, 0x40, 0x47, 0xE0, 0x07, 0x3B,
+  0xE0, 0x0B, 0x13, 0xE0, 0x9F, 0x00, 0x40, 0xBB, 0xC0, 0x00, 0xE0, 0x03,
+  0xB3, 0xC0, 0x13, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x1F, 0xE0, 0x1F, 0x00,
+  0xE0, 0x37, 0x3F, 0xE0, 0x43, 0x00, 0x40, 0x8B, 0xE0, 0x2F, 0x4F, 0x40,
+  0x3B, 0x40, 0x00, 0xE0, 0x03, 0x3F, 0x40, 0x0F, 0xC0, 0x00, 0xE0, 0x07,
+  0x17, 0xE0, 0x03, 0x0F, 0xE0, 0x4F, 0x00, 0xC0, 0x7B, 0x40, 0x00, 0xC0,
+  0x63, 0x40, 0x0B, 0x40, 0x00, 0xC0, 0x0F, 0x40, 0x00, 0x40, 0x0F, 0x40,
+  0x00, 0x40, 0x0B, 0xE0, 0x53, 0x00, 0x40, 0x63, 0xC0, 0x00, 0x40, 0x67,
+  0xC0, 0x0B, 0x40, 0x00, 0x40, 0x0F, 0xE0, 0x33, 0x00, 0x40, 0x43, 0x40,
+  0x00, 0xE0, 0x03, 0x43, 0xE0, 0x07, 0x0F, 0xE0, 0x0B, 0x00, 0x40, 0x23,
+  0xE0, 0x03, 0x00, 0xC0, 0x23, 0x40, 0x13, 0xC0, 0x0B, 0xE0, 0x23, 0x00,
+  0xE0, 0x0B, 0x37, 0x40, 0x13, 0x40, 0x00, 0xE0, 0x1B, 0x47, 0xE0, 0x1F,
+  0x27, 0x40, 0x00, 0x40, 0x2B, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x63, 0x00,
+  0x40, 0x73, 0xC0, 0x00, 0x40, 0x77, 0x40, 0x0B, 0x40, 0x07, 0xE0, 0x23,
+  0x00, 0x40, 0x33, 0xE0, 0x07, 0x00, 0xE0, 0x23, 0x3F, 0xE0, 0x73, 0x00,
+  0x40, 0xB7, 0xE0, 0x07, 0x7F, 0x40, 0x13, 0x40, 0x00, 0xE0, 0x0B, 0x17,
+  0xE0, 0x07, 0x13, 0xE0, 0x57, 0x00, 0x40, 0x87, 0xE0, 0x07, 0x00, 0xC0,
+  0x73, 0xE0, 0x07, 0x17, 0xE0, 0x03, 0x00, 0xC0, 0x23, 0xE0, 0x4F, 0x00,
+  0xE0, 0x03, 0x6B, 0xE0, 0x07, 0x00, 0xE0, 0x13, 0x73, 0x40, 0x2B, 0xE0,
+  0x0B, 0x1F, 0xE0, 0x07, 0x17, 0xE0, 0x07, 0x0F, 0xE0, 0x13, 0x00, 0xC0,
+  0x2B, 0xE0, 0x03, 0x07, 0x40, 0x00, 0xE0, 0x13, 0x33, 0xE0, 0x3F, 0x00,
+  0x40, 0x67, 0x40, 0x00, 0xE0, 0x1F, 0x4F, 0xE0, 0x0F, 0x2B, 0x40, 0x17,
+  0x40, 0x00, 0xC0, 0x47, 0xE0, 0x03, 0x0B, 0xE0, 0x47, 0x00, 0x40, 0x5B,
+  0xE0, 0x17, 0x00, 0xE0, 0x23, 0x73, 0xE0, 0x0B, 0x4B, 0xE0, 0x23, 0x3F,
+  0xE0, 0x03, 0x00, 0x40, 0x4B, 0xE0, 0x03, 0x0F, 0xE0, 0x57, 0x00, 0x40,
+  0x6F, 0x40, 0x00, 0x40, 0x67, 0x40, 0x07, 0x40, 0x00, 0xC0, 0x0B, 0x40,
+  0x07, 0xE0, 0x03, 0x00, 0xC0, 0x1B, 0xE0, 0x03, 0x00, 0x40, 0x13, 0x40,
+  0x00, 0xE0, 0x03, 0x13, 0xE0, 0x3B, 0x00, 0x40, 0x53, 0xE0, 0x0F, 0x00,
+  0xE0, 0x03, 0x5F, 0xE0, 0x0F, 0x23, 0x40, 0x00, 0xE0, 0x03, 0x27, 0xE0,
+  0x17, 0x00, 0xE0, 0x23, 0x2F, 0x40, 0x2B, 0xE0, 0x0F, 0x00, 0xE0, 0x03,
+  0x67, 0xE0, 0x07, 0x23, 0xE0, 0x03, 0x1B, 0xE0, 0x43, 0x00, 0x40, 0x67,
+  0xC0, 0x4F, 0x40, 0x0B, 0xC0, 0x00, 0xC0, 0x13, 0xE0, 0x27, 0x00, 0x40,
+  0x3F, 0xE0, 0x07, 0x33, 0xE0, 0x0B, 0x13, 0xE0, 0x13, 0x00, 0x40, 0x2F,
+  0x40, 0x00, 0xE0, 0x03, 0x23, 0x40, 0x0F, 0xE0, 0x07, 0x00, 0xC0, 0x1F,
+  0xC0, 0x17, 0xC0, 0x0F, 0xE0, 0x57, 0x00, 0xC0, 0x6F, 0x40, 0x00, 0x40,
+  0x6B, 0x40, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x23, 0x00, 0xC0,
+  0x3B, 0xE0, 0x23, 0x33, 0xE0, 0x77, 0x00, 0xC0, 0xB3, 0xE0, 0x07, 0x00,
+  0xE0, 0x03, 0x97, 0xC0, 0x1B, 0x40, 0x13, 0xC0, 0x0B, 0xE0, 0x0F, 0x00,
+  0x40, 0x23, 0xE0, 0x3F, 0x00, 0xE0, 0x07, 0x63, 0x40, 0x57, 0xE0, 0x03,
+  0x13, 0xE0, 0x07, 0x0F, 0xE0, 0x0B, 0x00, 0x40, 0x23, 0xE0, 0x4B, 0x00,
+  0xE0, 0x0B, 0x6B, 0xE0, 0x03, 0x00, 0xE0, 0x57, 0x73, 0xE0, 0x0F, 0x5F,
+  0xE0, 0x03, 0x83, 0x40, 0x00, 0xE0, 0x0F, 0x27, 0xE0, 0x2B, 0x00, 0x40,
+  0x4F, 0x40, 0x00, 0xE0, 0x1F, 0x3B, 0x40, 0x2B, 0xC0, 0x00, 0xE0, 0x07,
+  0x33, 0x40, 0x17, 0xE0, 0x07, 0x13, 0xE0, 0xFF, 0x68, 0x00, 0x41, 0x83,
+  0x40, 0x00, 0x41, 0x77, 0xE0, 0x03, 0x07, 0x40, 0x00, 0x40, 0x13, 0xE0,
+  0x0B, 0x00, 0x40, 0x1B, 0xC0, 0x00, 0x40, 0x1F, 0xC0, 0x0B, 0x40, 0x00,
+  0x40, 0x0F, 0xE0, 0x43, 0x00, 0xE0, 0x0B, 0x53, 0x40, 0x13, 0xE0, 0x0B,
+  0x00, 0xE0, 0x03, 0x77, 0xE0, 0x07, 0x1F, 0xE0, 0x03, 0x1B, 0xE0, 0x3B,
+  0x00, 0xE0, 0x07, 0x5F, 0xE0, 0x0F, 0x00, 0xE0, 0x3B, 0x6B, 0xE0, 0x03,
+  0x00, 0xE0, 0x03, 0x67, 0xE0, 0x03, 0x17, 0xE0, 0x03, 0x00, 0x40, 0x23,
+  0xE0, 0x03, 0x0F, 0xC0, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x1B, 0x00, 0xC0,
+  0x3B, 0x40, 0x07, 0xE0, 0x03, 0x00, 0xE0, 0x1B, 0x3B, 0xC0, 0x00, 0x40,
+  0x37, 0xC0, 0x0B, 0xE0, 0x0B, 0x00, 0xE0, 0x17, 0x1F, 0xE0, 0x6F, 0x00,
+  0x40, 0x97, 0xE0, 0x03, 0x00, 0xE0, 0x47, 0x87, 0xC0, 0x5B, 0xE0, 0x47,
+  0x57, 0xE0, 0x17, 0x00, 0xE0, 0x0F, 0x77, 0xE0, 0x0F, 0x17, 0xC0, 0x00,
+  0xE0, 0x03, 0x1F, 0xC0, 0x0B, 0x40, 0x00, 0xC0, 0x1F, 0xE0, 0x43, 0x00,
+  0xE0, 0x03, 0x57, 0x40, 0x0B, 0xE0, 0x23, 0x00, 0xE0, 0x43, 0x87, 0xE0,
+  0x07, 0x00, 0xE0, 0x1B, 0x87, 0xE0, 0x07, 0x33, 0xE0, 0x3F, 0x00, 0xC0,
+  0x7B, 0xE0, 0x3F, 0x4F, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x5B, 0x40, 0x0B,
+  0xC0, 0x1B, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0xC0, 0x17, 0xE0, 0x17, 0x00,
+  0xC0, 0x33, 0x40, 0x27, 0x40, 0x0B, 0xC0, 0x07, 0xE0, 0x03, 0x00, 0x40,
+  0x13, 0xC0, 0x00, 0x40, 0x17, 0xC0, 0x0B, 0xE0, 0x73, 0x00, 0xE0, 0x07,
+  0x87, 0x40, 0x0F, 0xC0, 0x00, 0xE0, 0x47, 0x97, 0xE0, 0x4F, 0x57, 0xE0,
+  0x13, 0x00, 0xC0, 0x73, 0x40, 0x00, 0xE0, 0x0B, 0x27, 0xE0, 0x0B, 0x17,
+  0xE0, 0x07, 0x13, 0x40, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x0B, 0x4B, 0xE0,
+  0x3B, 0x00, 0xE0, 0x03, 0x67, 0xE0, 0x03, 0x4F, 0x40, 0x17, 0x40, 0x0F,
+  0x40, 0x07, 0xE0, 0x07, 0x00, 0x40, 0x17, 0xE0, 0x1B, 0x00, 0xE0, 0x03,
+  0x37, 0xE0, 0x03, 0x2F, 0x40, 0x17, 0xE0, 0x13, 0x0F, 0x40, 0x00, 0x40,
+  0x23, 0xE0, 0x07, 0x00, 0x40, 0x17, 0xE0, 0x5B, 0x00, 0x40, 0x77, 0xE0,
+  0x17, 0x67, 0x40, 0x23, 0x40, 0x00, 0xE0, 0x17, 0x27, 0x40, 0x00, 0x40,
+  0x27, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x07, 0x00, 0x40, 0x17, 0x40, 0x00,
+  0xE0, 0x07, 0x17, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x23, 0x40, 0x0F, 0x40,
+  0x00, 0xC0, 0x27, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0xC0, 0x17, 0xE0, 0x4F,
+  0x00, 0x40, 0x6B, 0xC0, 0x5B, 0xE0, 0x03, 0x0B, 0xE0, 0x13, 0x00, 0x40,
+  0x27, 0x40, 0x00, 0xE0, 0x0F, 0x23, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x0F,
+  0x1F, 0xE0, 0x07, 0x00, 0xE0, 0x0F, 0x2B, 0xE0, 0x0F, 0x17, 0xE0, 0x47,
+  0x00, 0xE0, 0x07, 0x67, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x23, 0x67, 0x40,
+  0x2F, 0xC0, 0x00, 0xC0, 0x37, 0xC0, 0x0F, 0xE0, 0x03, 0x00, 0xC0, 0x1B,
+  0xE0, 0x5F, 0x00, 0x40, 0x7B, 0xC0, 0x6B, 0xC0, 0x0B, 0x40, 0x07, 0xE0,
+  0x0B, 0x00, 0xC0, 0x27, 0xE0, 0x43, 0x00, 0xE0, 0x5F, 0x67, 0xC0, 0x00,
+  0x40, 0x6F, 0xC0, 0x0B, 0xE0, 0x1B, 0x00, 0x40, 0x2F, 0x40, 0x00, 0xE0,
+  0x1B, 0x2B, 0xC0, 0x00, 0x40, 0x2F, 0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x13,
+  0x00, 0xE0, 0x03, 0x27, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0x33, 0xC0, 0x0B,
+  0xE0, 0x13, 0x00, 0x40, 0x27, 0xE0, 0x53, 0x00, 0x40, 0x7B, 0xE0, 0x23,
+  0x5F, 0x40, 0x2F, 0x40, 0x00, 0xE0, 0x23, 0x33, 0xE0, 0x0B, 0x00, 0xE0,
+  0x3B, 0x43, 0xE0, 0x4F, 0x00, 0xC0, 0x9B, 0x40, 0x07, 0x40, 0x00, 0x40,
+  0x67, 0xC0, 0x07, 0xE0, 0x0F, 0x00, 0x40, 0x1F, 0x40, 0x00, 0xE0, 0x03,
+  0x1F, 0x40, 0x0F, 0xC0, 0x00, 0xE0, 0x03, 0x17, 0xE0, 0x0F, 0x00, 0x40,
+  0x2B, 0xE0, 0x0F, 0x1B, 0xE0, 0x03, 0x00, 0x40, 0x27, 0xC0, 0x00, 0xE0,
+  0x03, 0x17, 0xE0, 0x1F, 0x00, 0xC0, 0x3B, 0xE0, 0x0B, 0x00, 0xE0, 0x1F,
+  0x43, 0xC0, 0x00, 0xC0, 0x43, 0xC0, 0x0F, 0xE0, 0x07, 0x00, 0xC0, 0x1F,
+  0xE0, 0x07, 0x00, 0xE0, 0x03, 0x27, 0x40, 0x1B, 0xE0, 0x03, 0x0F, 0xE0,
+  0x4B, 0x00, 0x40, 0x63, 0xE0, 0x03, 0x00, 0xE0, 0x33, 0x63, 0xE0, 0x03,
+  0x47, 0x40, 0x00, 0xE0, 0x0F, 0x4B, 0x40, 0x1B, 0xE0, 0x1F, 0x00, 0xE0,
+  0x0F, 0x43, 0xE0, 0x57, 0x00, 0x40, 0x9F, 0xE0, 0x0F, 0x63, 0x40, 0x1B,
+  0x40, 0x00, 0xE0, 0x0F, 0x1F, 0x40, 0x00, 0xE0, 0x17, 0x1F, 0xE0, 0x0B,
+  0x00, 0x40, 0x33, 0xC0, 0x00, 0xE0, 0x0B, 0x1F, 0xE0, 0x07, 0x00, 0x40,
+  0x2B, 0xE0, 0x07, 0x13, 0xE0, 0x23, 0x00, 0xE0, 0x1F, 0x3F, 0x40, 0x27,
+  0xC0, 0x00, 0x40, 0x5F, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xC0, 0x13, 0x40,
+  0x00, 0xC0, 0x13, 0xE0, 0x07, 0x00, 0x40, 0x1B, 0xE0, 0x07, 0x00, 0x40,
+  0x23, 0x40, 0x13, 0x40, 0x07, 0xE0, 0x1B, 0x00, 0x40, 0x2B, 0xE0, 0x0B,
+  0x00, 0xE0, 0x1B, 0x3B, 0xE0, 0x13, 0x00, 0xE0, 0x0B, 0x53, 0x40, 0x00,
+  0xE0, 0x13, 0x33, 0xE0, 0x13, 0x00, 0xE0, 0x33, 0x3B, 0x40, 0x00, 0xE0,
+  0x37, 0x3F, 0xE0, 0x1F, 0x00, 0x40, 0x67, 0x40, 0x00, 0x40, 0x2F, 0xE0,
+  0x03, 0x07, 0xC0, 0x00, 0x40, 0x17, 0xE0, 0x1F, 0x00, 0x40, 0x33, 0x40,
+  0x2B, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x17, 0x00, 0xE0, 0x03,
+  0x27, 0x40, 0x0B, 0xE0, 0x07, 0x00, 0xE0, 0x17, 0x3F, 0xE0, 0x4F, 0x00,
+  0x40, 0x87, 0xE0, 0x07, 0x5B, 0x40, 0x13, 0xE0, 0x03, 0x00, 0xE0, 0x03,
+  0x1F, 0xC0, 0x17, 0xE0, 0x03, 0x13, 0xE0, 0x23, 0x00, 0xC0, 0x3F, 0xE0,
+  0x13, 0x00, 0xE0, 0x23, 0x4F, 0xE0, 0x4F, 0x00, 0xE0, 0x03, 0x9F, 0xE0,
+  0x0B, 0x63, 0x40, 0x1F, 0xE0, 0x0B, 0x17, 0xC0, 0x00, 0x40, 0x1F, 0xE0,
+  0x03, 0x00, 0xC0, 0x17, 0xE0, 0x2B, 0x00, 0xE0, 0x03, 0x47, 0x40, 0x00,
+  0xE0, 0x3B, 0x43, 0xC0, 0x00, 0xE0, 0x2B, 0x4B, 0xE0, 0xA3, 0x00, 0x40,
+  0xE7, 0xE0, 0x0B, 0xAF, 0x40, 0x17, 0xE0, 0x03, 0x00, 0x40, 0x23, 0x40,
+  0x0F, 0x40, 0x07, 0xE0, 0x0F, 0x00, 0x40, 0x1F, 0xE0, 0x03, 0x00, 0xE0,
+  0x07, 0x27, 0xE0, 0x03, 0x1B, 0xC0, 0x00, 0x40, 0x23, 0xC0, 0x0B, 0xE0,
+  0x03, 0x00, 0x40, 0x17, 0x40, 0x00, 0x40, 0x13, 0x40, 0x07, 0xE0, 0x7B,
+  0x00, 0x40, 0x8B, 0xE0, 0x03, 0x00, 0xE0, 0x0B, 0x93, 0xE0, 0x03, 0x1F,
+  0x40, 0x00, 0xE0, 0x0B, 0x23, 0xE0, 0x0F, 0x00, 0x40, 0x2F, 0xE0, 0x23,
+  0x00, 0xE0, 0x0F, 0x47, 0xE0, 0x5B, 0x00, 0xE0, 0x07, 0xA7, 0xE0, 0x27,
+  0x73, 0xE0, 0x23, 0x3F, 0xC0, 0x2B, 0x40, 0x63, 0x40, 0x0B, 0xC0, 0x07,
+  0x40, 0x00, 0xE0, 0x07, 0x0B, 0xE0, 0x37, 0x00, 0x40, 0x53, 0xC0, 0x00,
+  0xE0, 0x37, 0x4B, 0xE0, 0x9B, 0x00, 0x40, 0xEB, 0xE0, 0x33, 0xA7, 0xE0,
+  0x03, 0x3F, 0x40, 0x0B, 0xE0, 0x07, 0x00, 0xC0, 0x5B, 0x40, 0x17, 0x40,
+  0x0B, 0xC0, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x0F, 0x00, 0x40, 0x1F,
+  0x40, 0x00, 0x40, 0x1F, 0x40, 0x07, 0xE0, 0x7B, 0x00, 0x40, 0x8B, 0xC0,
+  0x00, 0xE0, 0x13, 0x8F, 0xE0, 0x1B, 0x23, 0xE0, 0x0F, 0x00, 0x40, 0x3B,
+  0xC0, 0x1B, 0xC0, 0x0B, 0x40, 0x07, 0xE0, 0x0B, 0x00, 0xC0, 0x27, 0xE0,
+  0xA7, 0x00, 0xE0, 0x0B, 0xCB, 0xE0, 0x03, 0x00, 0xE0, 0x13, 0xCF, 0x40,
+  0x27, 0xE0, 0x0B, 0x1F, 0xE0, 0x0F, 0x17, 0xE0, 0xFF, 0x58, 0x00, 0x41,
+  0x77, 0x40, 0x00, 0xC1, 0x67, 0xE0, 0x07, 0x0B, 0x40, 0x00, 0xC0, 0x1B,
+  0xE0, 0x03, 0x00, 0x40, 0x17, 0xC0, 0x00, 0xC0, 0x17, 0xE0, 0x17, 0x0F,
+  0xE0, 0x2B, 0x00, 0x40, 0x53, 0xE0, 0x2B, 0x37, 0xE0, 0x0F, 0x00, 0x40,
+  0x4F, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x27, 0xE0, 0x03, 0x17, 0x40, 0x00,
+  0xC0, 0x1B, 0x40, 0x0B, 0xC0, 0x00, 0xC0, 0x13, 0x40, 0x00, 0x40, 0x13,
+  0x40, 0x07, 0xE0, 0x0F, 0x00, 0xE0, 0x17, 0x1F, 0xE0, 0x07, 0x00, 0xE0,
+  0x27, 0x2F, 0xE0, 0x0B, 0x00, 0x40, 0x43, 0xC0, 0x00, 0x40, 0x1F, 0xE0,
+  0x03, 0x0B, 0xE0, 0x33, 0x00, 0xC0, 0x47, 0xE0, 0x03, 0x00, 0xC0, 0x4F,
+  0xE0, 0x03, 0x13, 0x40, 0x00, 0xC0, 0x17, 0xE0, 0xFF, 0x8C, 0x00, 0x41,
+  0x9F, 0xE0, 0x1B, 0x00, 0xC1, 0xBB, 0x40, 0x2B, 0x40, 0x0B, 0x40, 0x07,
+  0x40, 0x00, 0xE0, 0x03, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x17, 0xE0, 0x03,
+  0x00, 0xE0, 0x13, 0x1B, 0xE0, 0x7B, 0x00, 0x40, 0x9F, 0xE0, 0x07, 0x87,
+  0xC0, 0x13, 0x40, 0x07, 0x40, 0x00, 0xE0, 0x03, 0x1F, 0x40, 0x0F, 0xE0,
+  0x03, 0x00, 0xE0, 0x03, 0x1B, 0x40, 0x00, 0x40, 0x1B, 0x40, 0x07, 0xE0,
+  0x13, 0x00, 0x40, 0x23, 0x40, 0x00, 0xE0, 0x13, 0x23, 0xE0, 0x5F, 0x00,
+  0xE0, 0x27, 0x87, 0x40, 0x2F, 0x40, 0x00, 0x40, 0x9F, 0x40, 0x07, 0xC0,
+  0x00, 0xE0, 0x07, 0x0F, 0xC0, 0x00, 0x40, 0x17, 0xE0, 0x03, 0x00, 0x40,
+  0x17, 0xE0, 0x03, 0x0F, 0xE0, 0x1B, 0x00, 0x40, 0x33, 0x40, 0x00, 0xE0,
+  0x23, 0x2B, 0xC0, 0x00, 0xE0, 0x1B, 0x33, 0xE0, 0x4F, 0x00, 0xC0, 0x83,
+  0x40, 0x00, 0xE0, 0x3B, 0x63, 0x40, 0x47, 0x40, 0x00, 0xE0, 0x13, 0x4B,
+  0xE0, 0x17, 0x1F, 0x40, 0x00, 0x40, 0x23, 0xE0, 0x2B, 0x00, 0xE0, 0x1F,
+  0x3B, 0x40, 0x27, 0x40, 0x00, 0x40, 0x63, 0xC0, 0x07, 0xE0, 0x03, 0x00,
+  0x40, 0x13, 0xE0, 0x1F, 0x00, 0x40, 0x37, 0xE0, 0x1F, 0x2B, 0xE0, 0x4F,
+  0x00, 0xE0, 0x0B, 0x83, 0x40, 0x13, 0x40, 0x00, 0xE0, 0x07, 0x73, 0x40,
+  0x13, 0xC0, 0x00, 0xE0, 0x07, 0x1B, 0xC0, 0x00, 0xC0, 0x1F, 0xC0, 0x00,
+  0xC0, 0x17, 0xE0, 0x6B, 0x00, 0x40, 0x83, 0xC0, 0x77, 0xE0, 0x03, 0x0B,
+  0xE0, 0x13, 0x00, 0xE0, 0x13, 0x27, 0xE0, 0x03, 0x1B, 0x40, 0x0B, 0x40,
+  0x00, 0xE0, 0x03, 0x4B, 0xE0, 0x07, 0x0F, 0xE0, 0x1F, 0x00, 0xE0, 0x2F,
+  0x37, 0xE0, 0x73, 0x00, 0x40, 0xB3, 0x40, 0x00, 0xE0, 0x3F, 0x83, 0xE0,
+  0x07, 0x4B, 0x40, 0x0F, 0xC0, 0x00, 0xC0, 0x63, 0x40, 0x0F, 0xC0, 0x0B,
+  0xE0, 0x13, 0x00, 0x40, 0x27, 0xE0, 0x1F, 0x00, 0xE0, 0x13, 0x47, 0xE0,
+  0x03, 0x00, 0xC0, 0x4F, 0xE0, 0x03, 0x13, 0x40, 0x00, 0xE0, 0x0F, 0x17,
+  0xE0, 0x1B, 0x00, 0xC0, 0x3B, 0x40, 0x00, 0xE0, 0x1B, 0x2F, 0xE0, 0x4F,
+  0x00, 0xE0, 0x07, 0x7F, 0x40, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x77, 0xC0,
+  0x0F, 0xC0, 0x0B, 0x40, 0x07, 0xE0, 0x97, 0x00, 0x40, 0xB3, 0xE0, 0x03,
+  0xA3, 0xE0, 0x07, 0x0F, 0xC0, 0x00, 0xE0, 0x0B, 0x17, 0x40, 0x13, 0x40,
+  0x00, 0xC0, 0x23, 0x40, 0x00, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x03, 0x0B,
+  0x40, 0x00, 0xE0, 0x03, 0x0F, 0x40, 0x0B, 0xE0, 0x27, 0x00, 0x40, 0x43,
+  0x40, 0x00, 0xE0, 0x03, 0x37, 0xE0, 0x07, 0x0F, 0xE0, 0x83, 0x00, 0x40,
+  0x9B, 0xE0, 0x03, 0x00, 0xC0, 0x9B, 0x40, 0x13, 0xC0, 0x0B, 0xE0, 0x37,
+  0x00, 0x40, 0x4B, 0xE0, 0x03, 0x00, 0xE0, 0x27, 0x4F, 0xE0, 0x03, 0x3B,
+  0xE0, 0x07, 0x00, 0xE0, 0x27, 0x4B, 0xC0, 0x00, 0xC0, 0x47, 0xC0, 0x0F,
+  0xE0, 0x07, 0x00, 0xC0, 0x1F, 0x40, 0x00, 0xE0, 0x07, 0x1B, 0xE0, 0x0F,
+  0x00, 0x40, 0x2B, 0xC0, 0x00, 0xE0, 0x0F, 0x23, 0xE0, 0x3F, 0x00, 0xC0,
+  0x67, 0xE0, 0x03, 0x00, 0xE0, 0x13, 0x5B, 0xE0, 0x03, 0x27, 0xC0, 0x00,
+  0xC0, 0x2F, 0xC0, 0x0F, 0x40, 0x00, 0xC0, 0x13, 0xE0, 0x3F, 0x00, 0x40,
+  0x53, 0x40, 0x00, 0xE0, 0x3F, 0x4F, 0xC0, 0x00, 0xE0, 0x07, 0x53, 0x40,
+  0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x2B, 0x40, 0x00, 0xE0, 0x07, 0x0F,
+  0xE0, 0x17, 0x00, 0xC0, 0x2F, 0xE0, 0x1B, 0x00, 0xE0, 0x07, 0x4B, 0xE0,
+  0x1B, 0x33, 0xE0, 0x7F, 0x00, 0xE0, 0x03, 0xBB, 0x40, 0x93, 0xE0, 0x07,
+  0x0F, 0xE0, 0x2B, 0x00, 0x40, 0x43, 0x40, 0x37, 0x40, 0x07, 0xE0, 0x03,
+  0x00, 0x40, 0x13, 0xE0, 0x1F, 0x00, 0xE0, 0x03, 0x37, 0xE0, 0x0F, 0x00,
+  0xE0, 0x1F, 0x4B, 0xC0, 0x00, 0xE0, 0x03, 0x47, 0xC0, 0x13, 0xE0, 0x03,
+  0x00, 0xE0, 0x03, 0x1F, 0xE0, 0x03, 0x00, 0xC0, 0x23, 0x40, 0x13, 0xC0,
+  0x0B, 0xE0, 0x07, 0x00, 0x40, 0x1B, 0xC0, 0x00, 0xE0, 0x07, 0x1B, 0xE0,
+  0x07, 0x00, 0x40, 0x27, 0xE0, 0x07, 0x13, 0xE0, 0x5B, 0x00, 0xE0, 0x0F,
+  0x77, 0x40, 0x17, 0x40, 0x00, 0xE0, 0x57, 0x83, 0xE0, 0x53, 0x63, 0xE0,
+  0x03, 0x5B, 0xE0, 0x03, 0x0B, 0x40, 0x00, 0xE0, 0x07, 0x0F, 0x40, 0x00,
+  0x40, 0x13, 0xE0, 0x13, 0x00, 0x40, 0x23, 0xE0, 0x23, 0x00, 0xE0, 0x07,
+  0x4B, 0xE0, 0x07, 0x3B, 0x40, 0x1F, 0xE0, 0x07, 0x13, 0xE0, 0x7B, 0x00,
+  0x40, 0x97, 0xE0, 0x0B, 0x00, 0xE0, 0x0F, 0x9B, 0x40, 0x2B, 0xE0, 0x03,
+  0x1B, 0xE0, 0x07, 0x0F, 0x40, 0x00, 0xC0, 0x13, 0x40, 0x07, 0x40, 0x00,
+  0x40, 0x13, 0xE0, 0x17, 0x00, 0x40, 0x27, 0xE0, 0x33, 0x00, 0xE0, 0x17,
+  0x5F, 0xE0, 0x17, 0x00, 0xE0, 0x17, 0x7B, 0xE0, 0x17, 0x3F, 0x40, 0x00,
+  0xC0, 0x43, 0xE0, 0x03, 0x0B, 0x40, 0x00, 0x40, 0x0F, 0xC0, 0x00, 0x40,
+  0x0F, 0x40, 0x00, 0xC0, 0x0F, 0xE0, 0xFF, 0x70, 0x00, 0x41, 0x83, 0xE0,
+  0x13, 0x00, 0xE1, 0x2B, 0x97, 0xE0, 0x0F, 0x4F, 0xE0, 0x2B, 0x4B, 0xE0,
+  0x5F, 0x00, 0xE0, 0x27, 0xB3, 0xE0, 0x0F, 0x2F, 0xE0, 0x13, 0x00, 0xE0,
+  0x27, 0xCB, 0xE0, 0x13, 0x4B, 0xE0, 0x03, 0x00, 0xE0, 0x27, 0x57, 0xE0,
+  0x17, 0x00, 0xC0, 0x5B, 0x40, 0x27, 0xC0, 0x0B, 0xC0, 0x00, 0x40, 0x13,
+  0xE0, 0x13, 0x00, 0xC0, 0x27, 0xE0, 0x0B, 0x00, 0xE0, 0x13, 0x37, 0xE0,
+  0x63, 0x00, 0x40, 0x9B, 0xE0, 0x63, 0x6F, 0xE0, 0x47, 0x00, 0xE0, 0x3F,
+  0xBF, 0x40, 0x47, 0xE0, 0x03, 0x00, 0x40, 0xA7, 0xE0, 0x03, 0x0F, 0x40,
+  0x00, 0x40, 0x13, 0xE0, 0x2B, 0x00, 0x40, 0x3B, 0xE0, 0x0B, 0x00, 0xE0,
+  0x2B, 0x4B, 0xE0, 0x53, 0x00, 0xE0, 0x07, 0xA3, 0x40, 0x6B, 0x40, 0x13,
+  0xE0, 0x03, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0x40, 0x00, 0x40, 0x13,
+  0x40, 0x07, 0xE0, 0x23, 0x00, 0x40, 0x33, 0xE0, 0x27, 0x00, 0x40, 0x5F,
+  0xE0, 0x03, 0x33, 0x40, 0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x1B, 0xE0,
+  0x43, 0x00, 0x40, 0x63, 0xC0, 0x4F, 0x40, 0x0B, 0x40, 0x00, 0xC0, 0x0F,
+  0xE0, 0x13, 0x00, 0x40, 0x27, 0xE0, 0x0B, 0x00, 0xE0, 0x13, 0x33, 0xE0,
+  0x33, 0x00, 0xE0, 0x07, 0x6B, 0xE0, 0x17, 0x4B, 0xE0, 0x1B, 0x2F, 0xC0,
+  0x23, 0xE0, 0x17, 0x4B, 0xE0, 0x6F, 0x00, 0xE0, 0x07, 0x9F, 0x40, 0x0F,
+  0xE0, 0x0B, 0x8B, 0xE0, 0x07, 0x17, 0x40, 0x0F, 0x40, 0x00, 0xC0, 0x2B,
+  0x40, 0x0B, 0xE0, 0x0F, 0x00, 0xC0, 0x23, 0xE0, 0x2F, 0x00, 0xE0, 0x4F,
+  0x57, 0xE0, 0x47, 0x00, 0xE0, 0x0F, 0xA7, 0x40, 0x00, 0xE0, 0x0F, 0x6B,
+  0x40, 0x1B, 0xE0, 0x2B, 0x00, 0x40, 0x4F, 0xC0, 0x37, 0x40, 0x0B, 0xE0,
+  0x27, 0x00, 0x40, 0x3B, 0xE0, 0x07, 0x33, 0x40, 0x13, 0x40, 0x00, 0xE0,
+  0x07, 0x17, 0xE0, 0x3F, 0x00, 0x40, 0x5B, 0x40, 0x00, 0xE0, 0x03, 0x4F,
+  0xE0, 0x07, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0xE0, 0x13, 0x00, 0xE0,
+  0x03, 0x2B, 0xE0, 0x23, 0x00, 0x40, 0x53, 0xC0, 0x2F, 0xE0, 0x03, 0x0B,
+  0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x03, 0x00, 0x40, 0x23, 0x40,
+  0x00, 0x40, 0x13, 0xC0, 0x07, 0xE0, 0x13, 0x00, 0x40, 0x23, 0x40, 0x00,
+  0xE0, 0x13, 0x23, 0xE0, 0x63, 0x00, 0x40, 0x8B, 0x40, 0x00, 0xE0, 0x03,
+  0x73, 0xE0, 0x07, 0x0F, 0xC0, 0x00, 0xE0, 0x03, 0x17, 0x40, 0x0B, 0xE0,
+  0x27, 0x00, 0xC0, 0x47, 0xE0, 0x0B, 0x00, 0xE0, 0x07, 0x4B, 0xE0, 0x0B,
+  0x23, 0xE0, 0x07, 0x00, 0x40, 0x33, 0xE0, 0x07, 0x13, 0xE0, 0x7B, 0x00,
+  0xE0, 0x07, 0x97, 0x40, 0x0F, 0xC0, 0x00, 0xE0, 0x0F, 0x9F, 0xE0, 0x03,
+  0x1F, 0xC0, 0x0B, 0xE0, 0x23, 0x00, 0xE0, 0x0F, 0x57, 0xE0, 0x0F, 0x00,
+  0xC0, 0x5B, 0xE0, 0x0F, 0x1F, 0x40, 0x00, 0x40, 0x23, 0x40, 0x07, 0xE0,
+  0x53, 0x00, 0x40, 0x63, 0xC0, 0x00, 0xE0, 0x0B, 0x67, 0xC0, 0x1B, 0xE0,
+  0x0B, 0x00, 0xE0, 0x0B, 0x2F, 0xE0, 0x1F, 0x00, 0xC0, 0x4F, 0xE0, 0x13,
+  0x2F, 0xE0, 0x1B, 0x23, 0xE0, 0xB7, 0x00, 0xC0, 0xE3, 0x40, 0x00, 0xE0,
+  0x17, 0xCB, 0xE0, 0x03, 0x23, 0x40, 0x0B, 0xE0, 0x0B, 0x00, 0xE0, 0x03,
+  0x43, 0xE0, 0x03, 0x1F, 0xE0, 0x03, 0x17, 0xE0, 0x3B, 0x00, 0xC0, 0x5B,
+  0xE0, 0x3B, 0x4B, 0xE0, 0x4F, 0x00, 0x40, 0xA3, 0xE0, 0x23, 0x5B, 0xE0,
+  0x03, 0x2F, 0x40, 0x0B, 0xE0, 0x13, 0x00, 0xE0, 0x23, 0x57, 0xE0, 0x0B,
+  0x00, 0xC0, 0x5B, 0xE0, 0x0B, 0x1B, 0xE0, 0x63, 0x00, 0xC0, 0x87, 0xC0,
+  0x00, 0x40, 0x7B, 0x40, 0x0B, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0,
+  0x0B, 0x00, 0x40, 0x1B, 0xE0, 0x37, 0x00, 0x40, 0x57, 0xE0, 0x1B, 0x43,
+  0xE0, 0x03, 0x27, 0x40, 0x0B, 0xE0, 0x07, 0x00, 0xC0, 0x43, 0x40, 0x17,
+  0xC0, 0x0B, 0xE0, 0x23, 0x00, 0xE0, 0x0F, 0x37, 0x40, 0x17, 0xE0, 0x07,
+  0x00, 0xE0, 0x23, 0x57, 0xE0, 0x2F, 0x00, 0x40, 0x73, 0xE0, 0x0B, 0x3B,
+  0xE0, 0x03, 0x17, 0x40, 0x0B, 0xE0, 0x07, 0x00, 0x40, 0x33, 0xE0, 0x07,
+  0x13, 0x40, 0x00, 0x40, 0x17, 0xE0, 0x2B, 0x00, 0x40, 0x3B, 0xE0, 0x03,
+  0x00, 0xE0, 0x03, 0x43, 0x40, 0x17, 0xE0, 0x03, 0x0F, 0xE0, 0x2F, 0x00,
+  0x40, 0x47, 0xC0, 0x00, 0xE0, 0x2F, 0x43, 0xE0, 0x0F, 0x00, 0x40, 0x57,
+  0xE0, 0x0F, 0x1B, 0xE0, 0x03, 0x00, 0xC0, 0x27, 0xC0, 0x07, 0x40, 0x00,
+  0x40, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x0F, 0x40, 0x0B, 0xE0, 0x0F, 0x00,
+  0x40, 0x2F, 0xC0, 0x1B, 0xE0, 0x03, 0x0B, 0xE0, 0x0B, 0x00, 0x40, 0x1F,
+  0x40, 0x00, 0xE0, 0x0B, 0x1B, 0xE0, 0x63, 0x00, 0x40, 0x83, 0xE0, 0x27,
+  0x00, 0xE0, 0x13, 0x9F, 0xC0, 0x4B, 0xE0, 0x13, 0x23, 0xC0, 0x00, 0xE0,
+  0x23, 0x2B, 0xC0, 0x00, 0xC0, 0x33, 0xE0, 0x03, 0x00, 0xC0, 0x1B, 0xE0,
+  0x43, 0x00, 0xE0, 0x03, 0x5F, 0xE0, 0x07, 0x00, 0xE0, 0x43, 0x67, 0xE0,
+  0x23, 0x00, 0xE0, 0x07, 0x87, 0x40, 0x00, 0x40, 0x3F, 0x40, 0x07, 0xE0,
+  0x07, 0x00, 0x40, 0x17, 0xE0, 0x27, 0x00, 0x40, 0x43, 0xE0, 0x03, 0x33,
+  0x40, 0x0F, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x47, 0x00, 0x40, 0x5F,
+  0xE0, 0x03, 0x00, 0xE0, 0x43, 0x5F, 0x40, 0x57, 0xE0, 0x03, 0x4F, 0xE0,
+  0x07, 0x0F, 0xE0, 0x17, 0x00, 0x40, 0x2F, 0x40, 0x00, 0x40, 0x27, 0x40,
+  0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x0F, 0x00, 0xE0, 0x17, 0x1F, 0xE0,
+  0x87, 0x00, 0x40, 0xAF, 0xE0, 0x0F, 0x00, 0x40, 0xAB, 0x40, 0x1B, 0x40,
+  0x07, 0xE0, 0x17, 0x00, 0xE0, 0x1F, 0x27, 0xE0, 0x07, 0x00, 0xE0, 0x0F,
+  0x37, 0xC0, 0x17, 0x40, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x3F, 0xC0, 0x0F,
+  0xE0, 0x03, 0x0B, 0x40, 0x00, 0x40, 0x0F, 0xE0, 0x37, 0x00, 0xE0, 0x07,
+  0x47, 0x40, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x47, 0x63, 0xE0, 0x03, 0x00,
+  0xC0, 0x6B, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x00, 0xC0, 0x1F, 0xE0, 0x0F,
+  0x00, 0xE0, 0x03, 0x2B, 0xE0, 0x27, 0x00, 0xE0, 0x03, 0x53, 0xC0, 0x3B,
+  0x40, 0x13, 0xC0, 0x0B, 0xE0, 0x13, 0x00, 0x40, 0x27, 0x40, 0x00, 0xE0,
+  0x13, 0x23, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x2B, 0x40, 0x0B, 0xE0, 0x07,
+  0x00, 0xE0, 0x03, 0x2B, 0xE0, 0x4F, 0x00, 0x40, 0x73, 0xE0, 0x1B, 0x5B,
+  0x40, 0x27, 0xE0, 0x07, 0x00, 0xE0, 0x0B, 0x37, 0xE0, 0x1B, 0x23, 0xE0,
+  0x8B, 0x00, 0xE0, 0x07, 0xB7, 0x40, 0x00, 0xC0, 0xA7, 0x40, 0x0B, 0x40,
+  0x00, 0xC0, 0x0F, 0xE0, 0x47, 0x00, 0x40, 0x5B, 0x40, 0x00, 0xE0, 0x07,
+  0x57, 0x40, 0x13, 0xE0, 0x17, 0x00, 0xE0, 0x03, 0x33, 0xC0, 0x2B, 0xE0,
+  0x03, 0x13, 0xE0, 0x27, 0x00, 0xC0, 0x43, 0x40, 0x00, 0xE0, 0x07, 0x3B,
+  0x40, 0x13, 0xC0, 0x00, 0xE0, 0x07, 0x1B, 0xE0, 0x23, 0x00, 0xE0, 0x13,
+  0x43, 0xE0, 0x13, 0x1B, 0x40, 0x00, 0xC0, 0x1F, 0xE0, 0x0F, 0x00, 0x40,
+  0x23, 0xE0, 0x33, 0x00, 0xE0, 0x0F, 0x57, 0x40, 0x00, 0xE0, 0x33, 0x57,
+  0xE0, 0x0B, 0x00, 0x40, 0x53, 0xC0, 0x00, 0xE0, 0x0B, 0x1F, 0xE0, 0x5F,
+  0x00, 0x40, 0x83, 0xE0, 0x1B, 0x6B, 0x40, 0x27, 0xE0, 0x03, 0x00, 0xC0,
+  0x33, 0x40, 0x13, 0xE0, 0x03, 0x0B, 0x40, 0x00, 0x40, 0x0F, 0xC0, 0x07,
+  0xE0, 0x9F, 0x00, 0x40, 0xAF, 0xE0, 0x03, 0x00, 0xC0, 0xB7, 0xE0, 0x0B,
+  0x13, 0xE0, 0x03, 0x00, 0x40, 0x1F, 0xE0, 0x03, 0x0F, 0xC0, 0x00, 0xE0,
+  0x0F, 0x17, 0xE0, 0x1B, 0x00, 0x40, 0x3B, 0xC0, 0x00, 0x40, 0x2F, 0xC0,
+  0x0B, 0xE0, 0x07, 0x00, 0x40, 0x1B, 0x40, 0x00, 0xC0, 0x17, 0x40, 0x0B,
+  0xE0, 0x27, 0x00, 0x40, 0x3B, 0xC0, 0x33, 0x40, 0x0B, 0xC0, 0x00, 0xC0,
+  0x13, 0x40, 0x00, 0xC0, 0x13, 0x40, 0x00, 0x40, 0x0F, 0xE0, 0x23, 0x00,
+  0xE0, 0x27, 0x33, 0xE0, 0x1B, 0x2F, 0x40, 0x23, 0xE0, 0x07, 0x00, 0xC0,
+  0x93, 0x40, 0x17, 0xC0, 0x0B, 0xE0, 0x1F, 0x00, 0xC0, 0x33, 0x40, 0x07,
+  0xE0, 0x0F, 0x00, 0xE0, 0x1F, 0x4B, 0xE0, 0x1B, 0x00, 0xE0, 0x07, 0x63,
+  0xE0, 0x1B, 0x33, 0xE0, 0x4F, 0x00, 0x40, 0x8B, 0xE0, 0x1F, 0x5B, 0x40,
+  0x2B, 0xC0, 0x00, 0xE0, 0x0B, 0x33, 0xC0, 0x1B, 0xC0, 0x00, 0xE0, 0x0B,
+  0x23, 0xE0, 0x0B, 0x00, 0x40, 0x2F, 0xE0, 0x0B, 0x17, 0xE0, 0x63, 0x00,
+  0x40, 0x83, 0xE0, 0x0F, 0x00, 0x40, 0x87, 0xE0, 0x0F, 0x1B, 0x40, 0x00,
+  0x40, 0x1F, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0,
+  0x2B, 0x00, 0xC0, 0x43, 0xE0, 0x03, 0x3B, 0xC0, 0x13, 0xE0, 0x13, 0x00,
+  0xE0, 0x03, 0x2F, 0xE0, 0x27, 0x00, 0xE0, 0x07, 0x57, 0xE0, 0x03, 0x3F,
+  0xC0, 0x1B, 0xE0, 0x03, 0x13, 0xE0, 0x5B, 0x00, 0xC0, 0x77, 0x40, 0x00,
+  0xE0, 0x1B, 0x6F, 0x40, 0x27, 0xC0, 0x00, 0xE0, 0x1B, 0x2F, 0xE0, 0x07,
+  0x00, 0xC0, 0x3B, 0xE0, 0x03, 0x00, 0x40, 0x23, 0x40, 0x0F, 0x40, 0x07,
+  0xE0, 0x3F, 0x00, 0xC0, 0x4F, 0x40, 0x07, 0x40, 0x00, 0xE0, 0x1B, 0x57,
+  0xE0, 0x1F, 0x27, 0xE0, 0x23, 0x00, 0x40, 0x53, 0x40, 0x00, 0x40, 0x33,
+  0xC0, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x07, 0x00, 0xC0, 0x1F,
+  0x40, 0x17, 0xC0, 0x0B, 0x40, 0x00, 0x40, 0x0F, 0x40, 0x00, 0x40, 0x0B,
+  0xE0, 0xAB, 0x00, 0x40, 0xBB, 0x40, 0x00, 0x40, 0xBB, 0x40, 0x07, 0xE0,
+  0x0B, 0x00, 0x40, 0x1B, 0xE0, 0x13, 0x00, 0xE0, 0x03, 0x33, 0xC0, 0x27,
+  0x40, 0x13, 0xC0, 0x0B, 0xE0, 0x33, 0x00, 0xC0, 0x47, 0xC0, 0x07, 0xE0,
+  0x07, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x0F, 0x00, 0x40, 0x2F, 0x40, 0x00,
+  0x40, 0x1F, 0x40, 0x07, 0xE0, 0x0F, 0x00, 0xE0, 0x03, 0x1F, 0x40, 0x0B,
+  0xE0, 0x77, 0x00, 0xE0, 0x0B, 0xA7, 0xE0, 0x3F, 0x93, 0xC0, 0x5B, 0x40,
+  0x4F, 0x40, 0x0B, 0x40, 0x07, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x03, 0x00,
+  0xC0, 0x17, 0xE0, 0x23, 0x00, 0xC0, 0x3F, 0xC0, 0x33, 0xC0, 0x0F, 0x40,
+  0x00, 0xC0, 0x13, 0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x43, 0x00,
+  0xE0, 0x17, 0x63, 0x40, 0x1F, 0xC0, 0x00, 0xE0, 0x03, 0x77, 0xE0, 0x0B,
+  0x13, 0xE0, 0x03, 0x00, 0xE0, 0x17, 0x1F, 0xE0, 0x07, 0x00, 0xE0, 0x27,
+  0x2F, 0xE0, 0x3B, 0x00, 0x40, 0x73, 0xE0, 0x17, 0x47, 0x40, 0x23, 0x40,
+  0x00, 0xE0, 0x2B, 0x27, 0x40, 0x37, 0xC0, 0x00, 0xE0, 0x17, 0x3F, 0xE0,
+  0x13, 0x00, 0xE0, 0x03, 0x43, 0x40, 0x0B, 0xE0, 0x07, 0x2B, 0x40, 0x13,
+  0x40, 0x00, 0xE0, 0x07, 0x17, 0xE0, 0x0F, 0x00, 0xE0, 0x07, 0x2B, 0x40,
+  0x0F, 0x40, 0x00, 0xE0, 0x03, 0x2F, 0x40, 0x0F, 0xE0, 0x07, 0x00, 0xE0,
+  0x03, 0x1F, 0xE0, 0x7B, 0x00, 0xC0, 0x9F, 0xE0, 0x0F, 0x8B, 0xE0, 0x17,
+  0x1F, 0xE0, 0x0B, 0x00, 0xC0, 0x33, 0xC0, 0x00, 0x40, 0x23, 0xC0, 0x0B,
+  0xC0, 0x00, 0x40, 0x13, 0xE0, 0x2F, 0x00, 0x40, 0x43, 0xE0, 0x03, 0x3B,
+  0xE0, 0x07, 0x0F, 0xE0, 0x67, 0x00, 0xE0, 0x17, 0x7F, 0x40, 0x1F, 0x40,
+  0x00, 0xC0, 0x97, 0xC0, 0x0B, 0xC0, 0x07, 0xE0, 0x0F, 0x00, 0x40, 0x1F,
+  0x40, 0x00, 0xE0, 0x0F, 0x1F, 0xE0, 0x77, 0x00, 0x40, 0x9B, 0x40, 0x00,
+  0x40, 0x87, 0x40, 0x07, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x03, 0x00, 0x40,
+  0x17, 0xE0, 0x03, 0x0F, 0xE0, 0x0F, 0x00, 0x40, 0x27, 0x40, 0x00, 0xE0,
+  0x2F, 0x1F, 0xC0, 0x00, 0xE0, 0x13, 0x43, 0xE0, 0x63, 0x00, 0x40, 0x87,
+  0x40, 0x00, 0xC0, 0x73, 0xE0, 0x03, 0x0B, 0xE0, 0x5B, 0x00, 0x40, 0x6F,
+  0x40, 0x00, 0xE0, 0x07, 0x6B, 0xE0, 0x03, 0x13, 0x40, 0x0B, 0xC0, 0x00,
+  0xE0, 0x07, 0x27, 0xC0, 0x00, 0x40, 0x1F, 0xC0, 0x0B, 0xE0, 0x0F, 0x00,
+  0xE0, 0x03, 0x23, 0x40, 0x0B, 0xE0, 0x1B, 0x00, 0x40, 0x4B, 0x40, 0x27,
+  0x40, 0x07, 0xC0, 0x00, 0xE0, 0x07, 0x0F, 0xE0, 0x1B, 0x00, 0xE0, 0x0B,
+  0x33, 0x40, 0x13, 0xE0, 0x03, 0x00, 0xE0, 0x1B, 0x47, 0xE0, 0x4B, 0x00,
+  0x40, 0x83, 0xE0, 0x0B, 0x57, 0x40, 0x17, 0x40, 0x00, 0xE0, 0x0B, 0x1B,
+  0x40, 0x00, 0x40, 0x1B, 0xE0, 0x07, 0x00, 0x40, 0x17, 0xE0, 0x0F, 0x00,
+  0x40, 0x2B, 0xE0, 0x0F, 0x1B, 0xE0, 0x4F, 0x00, 0x40, 0x73, 0xE0, 0x1F,
+  0x00, 0xE0, 0x1B, 0x83, 0xC0, 0x4B, 0xE0, 0x0F, 0x2B, 0xC0, 0x1F, 0x40,
+  0x00, 0xE0, 0x0F, 0x23, 0x40, 0x00, 0xE0, 0x13, 0x1F, 0xE0, 0x13, 0x1B,
+  0xE0, 0x47, 0x00, 0xE0, 0x07, 0x6B, 0xE0, 0x07, 0x0F, 0xE0, 0x57, 0x00,
+  0x40, 0x6F, 0xC0, 0x00, 0xE0, 0x03, 0x6B, 0x40, 0x13, 0xC0, 0x0F, 0x40,
+  0x0B, 0xC0, 0x00, 0xC0, 0x13, 0xE0, 0x1F, 0x00, 0x40, 0x37, 0xC0, 0x2B,
+  0xC0, 0x0B, 0x40, 0x07, 0xE0, 0x23, 0x00, 0xE0, 0x03, 0x3F, 0xE0, 0x03,
+  0x00, 0xC0, 0x17, 0xE0, 0x1B, 0x00, 0x40, 0x37, 0xE0, 0x0B, 0x27, 0xE0,
+  0x0F, 0x17, 0xE0, 0x7B, 0x00, 0x40, 0x9B, 0x40, 0x00, 0xE0, 0x0F, 0x8B,
+  0x40, 0x1B, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x2B, 0x40, 0x1F, 0xC0, 0x13,
+  0xE0, 0x0F, 0x0B, 0xE0, 0x43, 0x00, 0xE0, 0x03, 0x63, 0xE0, 0x03, 0x00,
+  0x40, 0x17, 0xE0, 0x0B, 0x00, 0xE0, 0x03, 0x23, 0xE0, 0x2B, 0x00, 0x40,
+  0x53, 0xE0, 0x07, 0x37, 0x40, 0x13, 0xC0, 0x00, 0xE0, 0x07, 0x1B, 0xC0,
+  0x00, 0x40, 0x1F, 0xC0, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x17, 0x40, 0x00,
+  0xE0, 0x03, 0x13, 0xE0, 0x3B, 0x00, 0xE0, 0x4B, 0x53, 0xE0, 0x13, 0x00,
+  0xE0, 0x1F, 0x6F, 0xE0, 0x1F, 0x27, 0x40, 0x00, 0x40, 0x2B, 0x40, 0x00,
+  0x40, 0x0B, 0xE0, 0x33, 0x00, 0x40, 0x43, 0xC0, 0x00, 0x40, 0x47, 0xC0,
+  0x0B, 0xE0, 0x13, 0x00, 0xE0, 0x0F, 0x27, 0x40, 0x17, 0xC0, 0x00, 0x40,
+  0x3F, 0xE0, 0x0B, 0x0B, 0x40, 0x00, 0xE0, 0x03, 0x1B, 0xE0, 0x8F, 0x00,
+  0xE0, 0x03, 0xA3, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x17, 0xB3, 0xE0,
+  0x03, 0x2B, 0xC0, 0x00, 0x40, 0x33, 0xC0, 0x0B, 0x40, 0x00, 0x40, 0x0F,
+  0xE0, 0x6F, 0x00, 0x40, 0x7F, 0xE0, 0x07, 0x00, 0xE0, 0x0F, 0x8B, 0xC0,
+  0x27, 0xE0, 0x0F, 0x1F, 0xC0, 0x00, 0x40, 0x27, 0x40, 0x0B, 0xE0, 0x03,
+  0x07, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x27, 0x00, 0xC0, 0x3F, 0xE0,
+  0x47, 0x00, 0x40, 0x57, 0xC0, 0x00, 0xE0, 0x47, 0x5B, 0xC0, 0x00, 0xC0,
+  0x5F, 0xE0, 0x03, 0x00, 0xC0, 0x1B, 0xE0, 0x3B, 0x00, 0xE0, 0x03, 0x57,
+  0x40, 0x00, 0xE0, 0x1B, 0x53, 0xE0, 0x0B, 0x27, 0x40, 0x13, 0xE0, 0x3B,
+  0x00, 0x40, 0x7F, 0xC0, 0x47, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x17,
+  0xE0, 0x03, 0x0F, 0xE0, 0x4F, 0x00, 0xE0, 0x4F, 0x67, 0x40, 0x57, 0x40,
+  0x00, 0x40, 0xB7, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x07, 0x00,
+  0xE0, 0x07, 0x17, 0xE0, 0x0B, 0x0F, 0x40, 0x00, 0xE0, 0x07, 0x37, 0xC0,
+  0x00, 0xE0, 0x13, 0x1B, 0xE0, 0x47, 0x00, 0x40, 0x6B, 0xE0, 0x07, 0x00,
+  0xE0, 0x0B, 0x63, 0xC0, 0x23, 0xE0, 0x0B, 0x1B, 0xC0, 0x00, 0x40, 0x23,
+  0xC0, 0x0B, 0xC0, 0x00, 0x40, 0x13, 0xE0, 0x07, 0x00, 0xC0, 0x1B, 0xE0,
+  0x7F, 0x00, 0x40, 0x9F, 0xE0, 0x4B, 0x8B, 0xE0, 0x4F, 0x57, 0xE0, 0x07,
+  0x00, 0xC0, 0x67, 0xC0, 0x07, 0xE0, 0x23, 0x00, 0x40, 0x33, 0xE0, 0x3B,
+  0x00, 0xE0, 0x03, 0x73, 0xE0, 0x03, 0x4F, 0xE0, 0x03, 0x17, 0xE0, 0x03,
+  0x00, 0x40, 0x23, 0xE0, 0x03, 0x0F, 0xE0, 0x43, 0x00, 0x40, 0x5B, 0x40,
+  0x00, 0xE0, 0x53, 0x53, 0x40, 0x5F, 0xE0, 0x03, 0x00, 0x40, 0x6B, 0xC0,
+  0x0F, 0x40, 0x0B, 0xE0, 0x37, 0x00, 0x40, 0x4B, 0xE0, 0x37, 0x43, 0xE0,
+  0x0B, 0x00, 0x40, 0x57, 0x40, 0x00, 0x40, 0x1B, 0x40, 0x07, 0xE0, 0x07,
+  0x00, 0xC0, 0x17, 0xE0, 0x03, 0x07, 0x40, 0x00, 0xC0, 0x27, 0x40, 0x0B,
+  0xE0, 0x1F, 0x00, 0xC0, 0x33, 0x40, 0x00, 0x40, 0x33, 0x40, 0x07, 0x40,
+  0x00, 0x40, 0x0B, 0xE0, 0x8F, 0x00, 0x40, 0x9F, 0xC0, 0x00, 0xE0, 0x37,
+  0xA3, 0xE0, 0x3F, 0x47, 0xE0, 0x5B, 0x00, 0x40, 0xAB, 0x40, 0x67, 0x40,
+  0x07, 0x40, 0x00, 0xE0, 0x03, 0x0B, 0xE0, 0x1F, 0x00, 0x40, 0x33, 0xC0,
+  0x00, 0xE0, 0x03, 0x33, 0xC0, 0x13, 0xE0, 0x2F, 0x00, 0x40, 0x4B, 0xE0,
+  0x2F, 0x3B, 0xE0, 0x33, 0x00, 0x40, 0x77, 0x40, 0x00, 0xC0, 0x43, 0xE0,
+  0x07, 0x0B, 0xC0, 0x00, 0x40, 0x1F, 0xE0, 0x03, 0x0B, 0xE0, 0x77, 0x00,
+  0x40, 0x8B, 0xE0, 0x0F, 0x83, 0x40, 0x1B, 0xE0, 0x1B, 0x00, 0xE0, 0x0B,
+  0x3F, 0xE0, 0x03, 0x37, 0xE0, 0x0B, 0x1F, 0xE0, 0x07, 0x00, 0xE0, 0x27,
+  0x2F, 0xE0, 0x7B, 0x00, 0xC0, 0xB3, 0xE0, 0x6B, 0x8B, 0x40, 0x7B, 0xE0,
+  0x1B, 0x77, 0xE0, 0x1F, 0x27, 0xE0, 0x1F, 0x00, 0x40, 0x4F, 0xE0, 0x0F,
+  0x00, 0x40, 0x43, 0xE0, 0x0F, 0x1B, 0xE0, 0x07, 0x00, 0x40, 0x2B, 0xE0,
+  0x03, 0x00, 0xC0, 0x1F, 0xC0, 0x13, 0x40, 0x0F, 0xC0, 0x0B, 0xE0, 0x1B,
+  0x00, 0x40, 0x2F, 0xC0, 0x00, 0xE0, 0x1B, 0x2F, 0xE0, 0x43, 0x00, 0x40,
+  0x77, 0x40, 0x4F, 0xC0, 0x07, 0xC0, 0x00, 0xE0, 0x07, 0x0F, 0xC0, 0x00,
+  0xE0, 0x0F, 0x17, 0x40, 0x00, 0x40, 0x1B, 0xC0, 0x00, 0x40, 0x0F, 0xE0,
+  0x23, 0x00, 0x40, 0x37, 0xE0, 0x23, 0x2F, 0xE0, 0x1F, 0x00, 0x40, 0x57,
+  0xC0, 0x00, 0x40, 0x33, 0xC0, 0x0B, 0x40, 0x00, 0x40, 0x0F, 0xE0, 0x07,
+  0x00, 0x40, 0x17, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x1F, 0xE0, 0x13, 0x00,
+  0xC0, 0x37, 0xE0, 0x13, 0x23, 0xE0, 0x67, 0x00, 0x40, 0x93, 0xE0, 0x67,
+  0x73, 0x40, 0x00, 0xE0, 0x0B, 0x77, 0x40, 0x13, 0xC0, 0x00, 0x40, 0x23,
+  0xE0, 0x17, 0x00, 0x40, 0x2B, 0xE0, 0x17, 0x23, 0xE0, 0x17, 0x00, 0xC0,
+  0x43, 0x40, 0x07, 0xE0, 0x3B, 0x00, 0x40, 0x6F, 0x40, 0x47, 0x40, 0x07,
+  0x40, 0x00, 0xE0, 0x03, 0x0B, 0xE0, 0x27, 0x00, 0x40, 0x3B, 0xE0, 0x07,
+  0x00, 0xE0, 0x27, 0x43, 0xE0, 0x57, 0x00, 0xE0, 0x07, 0x9F, 0x40, 0x00,
+  0xE0, 0x0F, 0x73, 0x40, 0x1B, 0xC0, 0x00, 0xE0, 0x0F, 0x23, 0xE0, 0x67,
+  0x00, 0xC0, 0x8F, 0x40, 0x00, 0xC0, 0x7B, 0xE0, 0x03, 0x0B, 0x40, 0x00,
+  0xE0, 0x07, 0x0F, 0xE0, 0x27, 0x00, 0xE0, 0x2F, 0x3F, 0xE0, 0x2F, 0x37,
+  0xE0, 0x27, 0x00, 0xE0, 0x5F, 0x67, 0xC0, 0x00, 0xE0, 0x0F, 0x6F, 0xE0,
+  0x0F, 0x17, 0xE0, 0x4F, 0x00, 0x40, 0x6F, 0xC0, 0x00, 0x40, 0x63, 0xC0,
+  0x0B, 0x40, 0x00, 0xE0, 0x03, 0x0F, 0xE0, 0x03, 0x0B, 0xE0, 0x0F, 0x00,
+  0x40, 0x23, 0xC0, 0x00, 0xE0, 0x07, 0x23, 0xC0, 0x17, 0xE0, 0x23, 0x00,
+  0xE0, 0x07, 0x43, 0x40, 0x00, 0xE0, 0x23, 0x3F, 0xE0, 0x5B, 0x00, 0x40,
+  0x93, 0xE0, 0x0B, 0x00, 0xE0, 0x0B, 0x7B, 0xC0, 0x27, 0x40, 0x1B, 0x40,
+  0x0B, 0x40, 0x07, 0xE0, 0x73, 0x00, 0x40, 0x83, 0xE0, 0x07, 0x00, 0xE0,
+  0x6F, 0x8F, 0x40, 0x87, 0xE0, 0x03, 0x7B, 0x40, 0x0F, 0x40, 0x00, 0xE0,
+  0x03, 0x13, 0xE0, 0x53, 0x00, 0x40, 0x6B, 0x40, 0x00, 0xE0, 0x53, 0x63,
+  0xE0, 0x17, 0x00, 0x40, 0x7F, 0x40, 0x00, 0xE0, 0x17, 0x27, 0xE0, 0x3F,
+  0x00, 0xC0, 0x6B, 0x40, 0x07, 0xE0, 0x13, 0x00, 0xE0, 0x03, 0x6F, 0xC0,
+  0x27, 0xC0, 0x13, 0xC0, 0x0F, 0xC0, 0x00, 0xE0, 0x17, 0x17, 0xE0, 0x1F,
+  0x00, 0xC0, 0x4F, 0xE0, 0x07, 0x00, 0xC0, 0x3F, 0x40, 0x17, 0xC0, 0x0B,
+  0xE0, 0x6F, 0x00, 0x40, 0x83, 0xE0, 0x0F, 0x00, 0x40, 0x93, 0xC0, 0x1B,
+  0x40, 0x0B, 0x40, 0x00, 0xE0, 0x03, 0x0F, 0x40, 0x0B, 0x40, 0x13, 0xE0,
+  0x77, 0x00, 0x40, 0x87, 0xE0, 0x03, 0x00, 0xE0, 0x77, 0x8F, 0xE0, 0x1F,
+  0x00, 0x40, 0xB3, 0xE0, 0x1F, 0x2B, 0xE0, 0x1B, 0x00, 0xE0, 0x47, 0x4F,
+  0xE0, 0x1F, 0x00, 0x40, 0x77, 0x40, 0x00, 0x40, 0x2F, 0x40, 0x07, 0xC0,
+  0x00, 0x40, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x17, 0xE0, 0x03, 0x0F, 0xE0,
+  0x07, 0x00, 0x40, 0x1F, 0x40, 0x00, 0xE0, 0x07, 0x17, 0xE0, 0x13, 0x00,
+  0xC0, 0x2F, 0x40, 0x07, 0xE0, 0x0B, 0x00, 0xE0, 0x0B, 0x3B, 0xE0, 0x0B,
+  0x27, 0xE0, 0x0B, 0x00, 0xE0, 0x03, 0x3B, 0xC0, 0x1F, 0xE0, 0x03, 0x13,
+  0xE0, 0x03, 0x00, 0x40, 0x1F, 0xE0, 0x03, 0x0F, 0x40, 0x00, 0x40, 0x13,
+  0xE0, 0x07, 0x00, 0x40, 0x17, 0x40, 0x00, 0x40, 0x17, 0x40, 0x07, 0xE0,
+  0x6B, 0x00, 0x40, 0x7B, 0x40, 0x00, 0x40, 0x7B, 0x40, 0x07, 0xE0, 0x23,
+  0x00, 0xC0, 0x33, 0x40, 0x07, 0xE0, 0x83, 0x00, 0xE0, 0x0B, 0xC3, 0xE0,
+  0x3F, 0x9F, 0xC0, 0x5B, 0xE0, 0x2F, 0x4F, 0xE0, 0x0B, 0x3F, 0xC0, 0x13,
+  0x40, 0x00, 0xE0, 0x2F, 0x57, 0xE0, 0x6B, 0x00, 0xE0, 0x07, 0xAF, 0x40,
+  0x0F, 0xE0, 0x1B, 0x00, 0xE0, 0x03, 0xAB, 0xC0, 0x2F, 0xC0, 0x13, 0xE0,
+  0x03, 0x0F, 0x40, 0x0B, 0xC0, 0x17, 0xE0, 0x37, 0x00, 0xE0, 0x0F, 0x4B,
+  0x40, 0x17, 0xE0, 0x17, 0x00, 0xE0, 0x07, 0x7B, 0xC0, 0x2F, 0xE0, 0x07,
+  0x17, 0xC0, 0x00, 0xE0, 0x0F, 0x1F, 0xC0, 0x17, 0xE0, 0x03, 0x00, 0xC0,
+  0x33, 0xE0, 0x6F, 0x00, 0x40, 0x8B, 0xE0, 0x03, 0x7B, 0x40, 0x0F, 0xE0,
+  0x03, 0x00, 0x40, 0x1B, 0xE0, 0x07, 0x0F, 0x40, 0x00, 0xE0, 0x0B, 0x13,
+  0xE0, 0x87, 0x00, 0xE0, 0x03, 0xA3, 0x40, 0x00, 0xE0, 0x87, 0x9F, 0xE0,
+  0xCB, 0x00, 0x41, 0x67, 0xE0, 0x03, 0x00, 0x40, 0xE3, 0xE0, 0x03, 0x0F,
+  0x40, 0x00, 0x40, 0x13, 0xC0, 0x00, 0x40, 0x0F, 0x40, 0x00, 0xC0, 0x0F,
+  0xE0, 0x4F, 0x00, 0xE0, 0x0F, 0x63, 0x40, 0x17, 0xE0, 0x1B, 0x00, 0xE0,
+  0x03, 0x97, 0xC0, 0x2F, 0xE0, 0x03, 0x13, 0x40, 0x00, 0xE0, 0x0F, 0x17,
+  0xE0, 0x07, 0x00, 0xC0, 0x27, 0x40, 0x00, 0xC0, 0x1B, 0x40, 0x0B, 0xC0,
+  0x00, 0xC0, 0x13, 0xE0, 0x3F, 0x00, 0x40, 0x57, 0xE0, 0x1F, 0x4B, 0x40,
+  0x2B, 0xE0, 0x03, 0x00, 0x40, 0x37, 0xE0, 0x07, 0x0F, 0xC0, 0x00, 0xE0,
+  0x0F, 0x17, 0xE0, 0x0F, 0x00, 0x40, 0x2F, 0xE0, 0x0F, 0x1B, 0xE0, 0x2B,
+  0x00, 0xE0, 0x23, 0x4F, 0x40, 0x2B, 0xE0, 0x07, 0x00, 0xE0, 0x2B, 0x73,
+  0xE0, 0x23, 0x00, 0xC0, 0x6F, 0xE0, 0x23, 0x33, 0xE0, 0xB3, 0x00, 0xC0,
+  0xEF, 0xC0, 0x00, 0xE0, 0x03, 0xCB, 0xC0, 0x13, 0xE0, 0x0B, 0x00, 0xE0,
+  0x03, 0x27, 0xE0, 0x4F, 0x00, 0x40, 0x77, 0xE0, 0x03, 0x5B, 0xE0, 0x03,
+  0x0F, 0x40, 0x0B, 0xE0, 0x17, 0x00, 0x40, 0x3B, 0x40, 0x23, 0x40, 0x07,
+  0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x27, 0x00, 0x40,
+  0x37, 0xC0, 0x00, 0x40, 0x3B, 0xC0, 0x0B, 0x40, 0x00, 0x40, 0x0F, 0xE0,
+  0x3F, 0x00, 0xE0, 0x2F, 0x4F, 0x40, 0x37, 0xC0, 0x00, 0xC0, 0x8B, 0x40,
+  0x0F, 0xC0, 0x0B, 0xE0, 0x73, 0x00, 0x40, 0x87, 0x40, 0x00, 0xE0, 0x23,
+  0x83, 0x40, 0x2F, 0xE0, 0x0B, 0x00, 0xE0, 0x07, 0x43, 0xC0, 0x23, 0xE0,
+  0x07, 0x17, 0xE0, 0x2F, 0x00, 0xE0, 0x03, 0x4F, 0x40, 0x0B, 0xE0, 0x2F,
+  0x47, 0xE0, 0x87, 0x00, 0x40, 0xCB, 0xE0, 0x03, 0x00, 0xE0, 0x3F, 0x9F,
+  0xC0, 0x53, 0xE0, 0x3F, 0x4F, 0xC0, 0x00, 0xC0, 0x57, 0x40, 0x00, 0xE0,
+  0x07, 0x13, 0x40, 0x0F, 0x40, 0x17, 0xE0, 0x07, 0x00, 0xE0, 0x0F, 0x17,
+  0xC0, 0x00, 0x40, 0x1F, 0xC0, 0x00, 0x40, 0x13, 0xE0, 0x03, 0x0B, 0xC0,
+  0x00, 0xC0, 0x13, 0xE0, 0x0B, 0x00, 0xC0, 0x23, 0xE0, 0x07, 0x00, 0xE0,
+  0x0B, 0x2B, 0xE0, 0x2B, 0x00, 0xC0, 0x57, 0xE0, 0x23, 0x3B, 0x40, 0x33,
+  0xE0, 0x23, 0x2F, 0xE0, 0xA3, 0x00, 0x40, 0xDB, 0x40, 0x00, 0xE0, 0x13,
+  0xB3, 0x40, 0x1F, 0x40, 0x00, 0xE0, 0x37, 0x23, 0x40, 0x00, 0x40, 0x47,
+  0xC0, 0x00, 0x40, 0x0F, 0xE0, 0xBF, 0x00, 0xC0, 0xD3, 0xE0, 0x03, 0x00,
+  0xE0, 0x3F, 0xDB, 0xC0, 0x53, 0xE0, 0x33, 0x4F, 0x40, 0x43, 0xE0, 0x03,
+  0x3F, 0x40, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0xC0, 0x0F, 0x40, 0x0B,
+  0x40, 0x00, 0xC0, 0x0F, 0xC0, 0x00, 0x40, 0x13, 0x40, 0x00, 0xC0, 0x0F,
+  0x40, 0x00, 0x40, 0x0F, 0xE0, 0x0B, 0x00, 0xE0, 0x07, 0x1B, 0xE0, 0x07,
+  0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x17, 0x1F, 0xE0, 0x3B, 0x00, 0x40, 0x63,
+  0x40, 0x00, 0xE0, 0x3B, 0x4B, 0xE0, 0x1B, 0x00, 0xE0, 0x63, 0x6B, 0xE0,
+  0x1F, 0x00, 0xE0, 0x03, 0x93, 0x40, 0x0B, 0x40, 0x00, 0xE0, 0x0B, 0x3B,
+  0x40, 0x17, 0x40, 0x00, 0xE0, 0x0B, 0x1B, 0xE0, 0x23, 0x00, 0xE0, 0x03,
+  0x43, 0x40, 0x0B, 0xC0, 0x00, 0xE0, 0x23, 0x43, 0xE0, 0x9B, 0x00, 0xE0,
+  0x27, 0xD7, 0x40, 0x2F, 0xE0, 0x07, 0xD7, 0xE0, 0x0B, 0x13, 0xE0, 0x3B,
+  0x00, 0x40, 0x57, 0xE0, 0x17, 0x00, 0x40, 0x67, 0xC0, 0x23, 0x40, 0x0B,
+  0xC0, 0x00, 0xC0, 0x13, 0xE0, 0x0F, 0x00, 0xC0, 0x27, 0xE0, 0x2B, 0x00,
+  0xE0, 0x0B, 0x53, 0xE0, 0x23, 0x47, 0x40, 0x3F, 0xE0, 0x1B, 0x2F, 0x40,
+  0x27, 0xC0, 0x00, 0xE0, 0x03, 0x2F, 0xE0, 0x0B, 0x13, 0xE0, 0x43, 0x00,
+  0x40, 0x5F, 0xE0, 0x43, 0x4F, 0xE0, 0x2B, 0x00, 0xE0, 0x07, 0x83, 0x40,
+  0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x53, 0xE0, 0x13, 0x1B, 0xE0, 0x1F,
+  0x00, 0x40, 0x43, 0x40, 0x2B, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0x40,
+  0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x9B, 0x00, 0x40, 0xAB,
+  0x40, 0x00, 0xC0, 0xAB, 0x40, 0x0B, 0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x0B,
+  0x00, 0xE0, 0x17, 0x1F, 0xE0, 0x03, 0x00, 0xE0, 0x23, 0x2B, 0xE0, 0x33,
+  0x00, 0x40, 0x67, 0xE0, 0x17, 0x00, 0x40, 0x5F, 0x40, 0x23, 0x40, 0x07,
+  0xC0, 0x00, 0x40, 0x0F, 0xC0, 0x00, 0x40, 0x13, 0xC0, 0x0B, 0xE0, 0x03,
+  0x00, 0x40, 0x17, 0xE0, 0x0B, 0x00, 0x40, 0x23, 0xE0, 0x0B, 0x17, 0xE0,
+  0x0B, 0x00, 0xE0, 0x23, 0x2B, 0xE0, 0x13, 0x00, 0x40, 0x47, 0xC0, 0x00,
+  0xE0, 0x03, 0x27, 0xC0, 0x13, 0x40, 0x00, 0xE0, 0x03, 0x17, 0xE0, 0x83,
+  0x00, 0xE0, 0x4F, 0x9B, 0xE0, 0x07, 0x57, 0x40, 0x0F, 0xC0, 0x00, 0xE0,
+  0x4B, 0xFF, 0xE0, 0x0F, 0x5B, 0xC0, 0x17, 0xC0, 0x00, 0xE0, 0x4B, 0x7B,
+  0xE0, 0x47, 0x00, 0xC0, 0xAB, 0xE0, 0x07, 0x00, 0xE0, 0x13, 0x67, 0xE0,
+  0x03, 0x2B, 0xE0, 0x13, 0x27, 0xE0, 0x63, 0x00, 0xC0, 0x93, 0x40, 0x73,
+  0xC0, 0x0B, 0xE0, 0x0B, 0x00, 0x40, 0x1F, 0xE0, 0x0B, 0x00, 0x40, 0x2B,
+  0x40, 0x17, 0x40, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x13, 0x00,
+  0x40, 0x2B, 0xE0, 0x03, 0x1F, 0xE0, 0x07, 0x0F, 0xE0, 0x3F, 0x00, 0x40,
+  0x57, 0xE0, 0x0F, 0x00, 0x40, 0x63, 0xE0, 0x0B, 0x1B, 0x40, 0x17, 0xE0,
+  0x93, 0x00, 0xE0, 0x03, 0xB3, 0xE0, 0x7F, 0xA7, 0x40, 0x93, 0xE0, 0x13,
+  0x8B, 0xE0, 0x13, 0x1F, 0x40, 0x1B, 0xE0, 0x03, 0x00, 0x40, 0x47, 0xC0,
+  0x0F, 0x40, 0x0B, 0xE0, 0x8B, 0x00, 0xC0, 0x9F, 0xE0, 0x0B, 0x00, 0xE0,
+  0x13, 0xAF, 0xC0, 0x2F, 0xE0, 0x13, 0x23, 0xE0, 0x1B, 0x00, 0x40, 0x47,
+  0xE0, 0x07, 0x27, 0xE0, 0x0B, 0x13, 0xE0, 0x13, 0x00, 0x40, 0x2F, 0xE0,
+  0x17, 0x00, 0x40, 0x3F, 0x40, 0x23, 0x40, 0x07, 0xC0, 0x00, 0x40, 0x0F,
+  0x40, 0x00, 0x40, 0x0F, 0xE0, 0x03, 0x07, 0xE0, 0x0B, 0x00, 0x40, 0x23,
+  0xE0, 0x0F, 0x00, 0x40, 0x2F, 0xE0, 0x0F, 0x1B, 0xE0, 0x3B, 0x00, 0x40,
+  0x5F, 0x40, 0x00, 0x40, 0x4B, 0x40, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13,
+  0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x07, 0x00, 0x40, 0x1F, 0xE0, 0xFF,
+  0x00, 0x00, 0xE1, 0x03, 0x1B, 0xE1, 0x47, 0x13, 0x40, 0x5B, 0xE0, 0x47,
+  0x53, 0xE0, 0x53, 0x00, 0x40, 0xAF, 0x40, 0x00, 0x40, 0x63, 0x40, 0x07,
+  0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x17, 0x00, 0x40, 0x2F, 0xE0, 0x17,
+  0x23, 0xE0, 0x33, 0x00, 0xE0, 0x07, 0x5F, 0xE0, 0x07, 0x0F, 0xC0, 0x00,
+  0xE0, 0x03, 0x17, 0x40, 0x0B, 0xE0, 0x0F, 0x00, 0xC0, 0x2F, 0x40, 0x00,
+  0xE0, 0x03, 0x23, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03,
+  0x00, 0x40, 0x1B, 0xE0, 0x13, 0x00, 0x40, 0x2B, 0xE0, 0x13, 0x1F, 0xE0,
+  0x2B, 0x00, 0x40, 0x53, 0xE0, 0x03, 0x00, 0x40, 0x43, 0xE0, 0x03, 0x0F,
+  0x40, 0x00, 0x40, 0x13, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x1B, 0x00, 0xC0,
+  0x2F, 0xE0, 0x33, 0x00, 0x40, 0x67, 0xE0, 0x2B, 0x3F, 0x40, 0x37, 0x40,
+  0x00, 0xE0, 0x17, 0x3B, 0xE0, 0x13, 0x23, 0xE0, 0x13, 0x1B, 0xE0, 0x17,
+  0x00, 0x40, 0x3B, 0xE0, 0x07, 0x00, 0xC0, 0x33, 0x40, 0x17, 0x40, 0x0B,
+  0xC0, 0x07, 0xC0, 0x00, 0x40, 0x0F, 0xC0, 0x00, 0xC0, 0x13, 0xE0, 0x0F,
+  0x00, 0x40, 0x27, 0xE0, 0x0F, 0x1B, 0xE0, 0x87, 0x00, 0x40, 0xAB, 0xC0,
+  0x00, 0xE0, 0x03, 0x9B, 0x40, 0x13, 0xE0, 0x03, 0x0F, 0x40, 0x00, 0x40,
+  0x13, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x43, 0x00, 0x40, 0x53, 0xE0, 0x07,
+  0x00, 0xE0, 0x03, 0x5F, 0xC0, 0x1B, 0xC0, 0x13, 0x40, 0x0F, 0xC0, 0x0B,
+  0xE0, 0x1F, 0x00, 0x40, 0x33, 0xC0, 0x00, 0xE0, 0x07, 0x33, 0xE0, 0x07,
+  0x17, 0xC0, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x37, 0xE0, 0x07, 0x00,
+  0x40, 0x2F, 0xE0, 0x07, 0x13, 0xE0, 0x13, 0x00, 0xE0, 0x1F, 0x2F, 0x40,
+  0x27, 0x40, 0x00, 0x40, 0x4B, 0x40, 0x07, 0xE0, 0x07, 0x00, 0x40, 0x17,
+  0xE0, 0x07, 0x00, 0xE0, 0x07, 0x23, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x2B,
+  0xE0, 0x67, 0x00, 0x40, 0x8B, 0xE0, 0x07, 0x73, 0xE0, 0x1F, 0x13, 0xE0,
+  0x37, 0x00, 0x40, 0x67, 0xE0, 0x17, 0x00, 0x40, 0x63, 0xE0, 0x03, 0x23,
+  0xE0, 0x0B, 0x0F, 0xE0, 0x33, 0x00, 0x40, 0x5B, 0xE0, 0x33, 0x3F, 0xE0,
+  0x2F, 0x00, 0x40, 0x77, 0xE0, 0x03, 0x00, 0x40, 0x47, 0xC0, 0x0F, 0x40,
+  0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x0B, 0x17, 0xE0, 0x0B, 0x13, 0xE0, 0x03,
+  0x00, 0x40, 0x1F, 0xE0, 0x03, 0x0F, 0xC0, 0x00, 0xE0, 0x0F, 0x17, 0xE0,
+  0x07, 0x00, 0x40, 0x27, 0xE0, 0x03, 0x00, 0xE0, 0x13, 0x1F, 0xE0, 0x07,
+  0x1B, 0xC0, 0x00, 0x40, 0x3F, 0xE0, 0x03, 0x0B, 0x40, 0x00, 0xE0, 0x03,
+  0x0F, 0xC0, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x23, 0xC0, 0x00, 0x40, 0x17,
+  0xC0, 0x0B, 0xE0, 0x07, 0x00, 0x40, 0x1B, 0xE0, 0x43, 0x00, 0x40, 0x5F,
+  0xE0, 0x1B, 0x4F, 0xE0, 0x03, 0x27, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x37,
+  0x40, 0x07, 0xE0, 0x07, 0x00, 0x40, 0x17, 0xE0, 0x07, 0x00, 0x40, 0x23,
+  0xE0, 0x07, 0x13, 0xE0, 0x4B, 0x00, 0xE0, 0x03, 0x67, 0xE0, 0x03, 0x0B,
+  0xE0, 0x03, 0x00, 0xE0, 0x07, 0x17, 0x40, 0x0F, 0xC0, 0x00, 0xE0, 0x03,
+  0x27, 0x40, 0x00, 0x40, 0x17, 0x40, 0x07, 0xE0, 0x43, 0x00, 0x40, 0x53,
+  0xE0, 0x17, 0x00, 0xC0, 0x6F, 0x40, 0x27, 0xE0, 0x03, 0x0B, 0x40, 0x00,
+  0xC0, 0x0F, 0xE0, 0x0F, 0x00, 0x40, 0x23, 0x40, 0x00, 0xE0, 0x0F, 0x1F,
+  0x40, 0x00, 0xE0, 0x17, 0x1F, 0xE0, 0x4F, 0x00, 0x40, 0x77, 0xE0, 0x07,
+  0x00, 0x40, 0x6B, 0x40, 0x13, 0x40, 0x07, 0xE0, 0x07, 0x00, 0xE0, 0x0F,
+  0x17, 0x40, 0x00, 0xE0, 0x07, 0x1B, 0x40, 0x0F, 0x40, 0x00, 0x40, 0x1B,
+  0xE0, 0x33, 0x00, 0x40, 0x43, 0xC0, 0x00, 0xE0, 0x0B, 0x47, 0x40, 0x1B,
+  0xE0, 0x0B, 0x17, 0x40, 0x00, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x03, 0x0B,
+  0x40, 0x00, 0xE0, 0x03, 0x0F, 0x40, 0x0B, 0xE0, 0x17, 0x00, 0x40, 0x33,
+  0x40, 0x00, 0x40, 0x27, 0x40, 0x07, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x0B,
+  0x00, 0xE0, 0x17, 0x1F, 0xE0, 0x37, 0x00, 0x40, 0x5F, 0xE0, 0x0B, 0x43,
+  0xE0, 0x03, 0x17, 0x40, 0x0B, 0x40, 0x00, 0xE0, 0x0B, 0x27, 0xE0, 0x87,
+  0x00, 0xE0, 0x03, 0xA7, 0x40, 0x0B, 0xC0, 0x00, 0xE0, 0x07, 0xA7, 0x40,
+  0x17, 0xE0, 0x07, 0x13, 0xE0, 0x3B, 0x00, 0x40, 0x57, 0xE0, 0x13, 0x00,
+  0xC0, 0x63, 0xC0, 0x23, 0x40, 0x0F, 0xE0, 0x03, 0x0B, 0xE0, 0xBF, 0x00,
+  0xE0, 0x0F, 0xD3, 0xC0, 0x17, 0x40, 0x00, 0xE0, 0x0B, 0xEB, 0x40, 0x17,
+  0xE0, 0x07, 0x00, 0xE0, 0x0B, 0x27, 0xE0, 0x17, 0x00, 0x40, 0x43, 0xE0,
+  0x0F, 0x23, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x0F, 0x1F, 0xE0, 0x13, 0x00,
+  0x40, 0x37, 0xE0, 0x0B, 0x00, 0xE0, 0x13, 0x33, 0xE0, 0x17, 0x00, 0xE0,
+  0x07, 0x4F, 0xE0, 0x03, 0x2F, 0xC0, 0x1B, 0xE0, 0x03, 0x13, 0xE0, 0x1B,
+  0x00, 0x40, 0x37, 0xE0, 0x1B, 0x27, 0xE0, 0x07, 0x00, 0x40, 0x37, 0x40,
+  0x00, 0xE0, 0x03, 0x17, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0,
+  0x7F, 0x00, 0x40, 0x97, 0x40, 0x00, 0xC0, 0x8F, 0x40, 0x0B, 0x40, 0x00,
+  0x40, 0x0F, 0x40, 0x07, 0xE0, 0x07, 0x00, 0x40, 0x17, 0xC0, 0x00, 0x40,
+  0x1B, 0x40, 0x0B, 0xC0, 0x07, 0xE0, 0x3F, 0x00, 0x40, 0x4F, 0xE0, 0x0B,
+  0x00, 0xE0, 0x07, 0x5F, 0x40, 0x23, 0x40, 0x13, 0x40, 0x07, 0x40, 0x00,
+  0x40, 0x0B, 0xE0, 0x17, 0x00, 0xE0, 0x1F, 0x27, 0xE0, 0x73, 0x00, 0x40,
+  0xA3, 0xC0, 0x00, 0xE0, 0x03, 0x87, 0xC0, 0x13, 0xC0, 0x00, 0xE0, 0x03,
+  0x1B, 0xE0, 0x07, 0x00, 0xE0, 0x0F, 0x23, 0x40, 0x17, 0xE0, 0x07, 0x2B,
+  0x40, 0x00, 0x40, 0x17, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0xE0, 0x03,
+  0x0B, 0xE0, 0x0B, 0x00, 0x40, 0x1F, 0xC0, 0x00, 0xE0, 0x0B, 0x1F, 0xE0,
+  0x0B, 0x00, 0xC0, 0x2F, 0xE0, 0x0B, 0x00, 0xE0, 0x0B, 0x2F, 0xE0, 0x13,
+  0x00, 0x40, 0x43, 0xC0, 0x1F, 0x40, 0x0B, 0xC0, 0x00, 0xC0, 0x13, 0xC0,
+  0x00, 0x40, 0x17, 0xC0, 0x0B, 0xE0, 0xFF, 0x1C, 0x00, 0x41, 0x2F, 0xE0,
+  0x1B, 0x00, 0xE1, 0x53, 0x4B, 0xE0, 0x13, 0x7F, 0xE0, 0x4F, 0x77, 0x40,
+  0x73, 0xE0, 0x4F, 0x5B, 0xE0, 0x23, 0x00, 0xE0, 0x13, 0x87, 0x40, 0x1B,
+  0xC0, 0x00, 0xE0, 0x0F, 0x53, 0xC0, 0x1F, 0xE0, 0x07, 0x00, 0xE0, 0x0F,
+  0x2F, 0xC0, 0x00, 0x40, 0x2F, 0xC0, 0x0B, 0x40, 0x00, 0xE0, 0x07, 0x0F,
+  0xE0, 0x3B, 0x00, 0x40, 0x53, 0x40, 0x00, 0xE0, 0x03, 0x4B, 0x40, 0x0F,
+  0x40, 0x00, 0x40, 0x13, 0x40, 0x07, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x13,
+  0x00, 0xE0, 0x07, 0x27, 0xE0, 0x07, 0x0F, 0xE0, 0x33, 0x00, 0x40, 0x4B,
+  0xE0, 0x33, 0x3F, 0xE0, 0xA7, 0x00, 0xE0, 0x07, 0xEF, 0x40, 0x0F, 0xC0,
+  0x00, 0xC0, 0xCB, 0xC0, 0x0F, 0xE0, 0x03, 0x00, 0xC0, 0x1B, 0xE0, 0x4B,
+  0x00, 0x40, 0x67, 0x40, 0x57, 0x40, 0x07, 0xE0, 0x0B, 0x00, 0x40, 0x1B,
+  0xE0, 0x0F, 0x00, 0x40, 0x2F, 0xE0, 0x0F, 0x1B, 0xE0, 0x0F, 0x00, 0x40,
+  0x33, 0x40, 0x00, 0xE0, 0x0F, 0x1F, 0xC0, 0x00, 0xE0, 0x1B, 0x23, 0xE0,
+  0x4F, 0x00, 0x40, 0x7B, 0x40, 0x00, 0xC0, 0x5F, 0x40, 0x0B, 0x40, 0x00,
+  0xC0, 0x0F, 0x40, 0x00, 0x40, 0x0F, 0xE0, 0x0B, 0x00, 0x40, 0x1B, 0xE0,
+  0x03, 0x00, 0xC0, 0x23, 0x40, 0x13, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0x40,
+  0x13, 0xE0, 0x03, 0x0B, 0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x33, 0x00, 0xE0,
+  0x43, 0x47, 0xE0, 0x0B, 0x00, 0xE0, 0x07, 0x9B, 0x40, 0x23, 0xE0, 0x07,
+  0x13, 0xE0, 0xFF, 0x08, 0x00, 0x41, 0x23, 0xE0, 0x0F, 0x00, 0xC1, 0x2B,
+  0xC0, 0x1F, 0x40, 0x0F, 0xE0, 0x03, 0x0B, 0xE0, 0x5B, 0x00, 0xE0, 0x0F,
+  0x6F, 0xE0, 0x0B, 0x17, 0x40, 0x13, 0xE0, 0x2B, 0x93, 0xE0, 0x2F, 0x37,
+  0xE0, 0x4B, 0x00, 0x40, 0x8B, 0x40, 0x00, 0xE0, 0x1B, 0x5B, 0x40, 0x27,
+  0x40, 0x00, 0xE0, 0x03, 0x2B, 0xE0, 0x03, 0x0F, 0xE0, 0x03, 0x0B, 0xC0,
+  0x00, 0x40, 0x13, 0x40, 0x00, 0xE0, 0x07, 0x0F, 0xC0, 0x00, 0x40, 0x17,
+  0x40, 0x0B, 0x40, 0x07, 0xE0, 0x47, 0x00, 0xE0, 0x33, 0x57, 0x40, 0x3B,
+  0xE0, 0x17, 0x00, 0xE0, 0x47, 0xAF, 0xE0, 0x13, 0x00, 0xE0, 0x07, 0x8B,
+  0xE0, 0x13, 0x2B, 0xE0, 0x77, 0x00, 0x40, 0xAB, 0xE0, 0x07, 0x83, 0x40,
+  0x13, 0xE0, 0x0B, 0x00, 0x40, 0x27, 0xC0, 0x17, 0x40, 0x0B, 0x40, 0x00,
+  0xC0, 0x0F, 0xC0, 0x00, 0x40, 0x13, 0xE0, 0x1F, 0x00, 0x40, 0x33, 0xE0,
+  0x1F, 0x2B, 0xE0, 0x1F, 0x00, 0x40, 0x53, 0xC0, 0x00, 0xE0, 0x03, 0x33,
+  0x40, 0x13, 0xE0, 0x03, 0x0F, 0xE0, 0x0B, 0x00, 0x40, 0x23, 0x40, 0x00,
+  0xE0, 0x0B, 0x1B, 0xE0, 0x7B, 0x00, 0x40, 0x9B, 0xC0, 0x00, 0xE0, 0x03,
+  0x8F, 0x40, 0x13, 0xE0, 0x03, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0x40,
+  0x00, 0xE0, 0x03, 0x13, 0xE0, 0x0F, 0x00, 0xE0, 0x0F, 0x27, 0x40, 0x17,
+  0x40, 0x00, 0xE0, 0x0F, 0x37, 0xE0, 0x77, 0x00, 0x40, 0x9B, 0xE0, 0x13,
+  0x00, 0xE0, 0x1B, 0x9F, 0x40, 0x3F, 0xC0, 0x27, 0xE0, 0x03, 0x0B, 0xE0,
+  0x27, 0x00, 0x40, 0x3B, 0xE0, 0x13, 0x00, 0xC0, 0x4F, 0x40, 0x23, 0xC0,
+  0x0B, 0xE0, 0x73, 0x00, 0x40, 0x87, 0x40, 0x00, 0xE0, 0x0B, 0x83, 0x40,
+  0x17, 0xE0, 0x0B, 0x00, 0xC0, 0x2B, 0xE0, 0x17, 0x1B, 0xC0, 0x27, 0xE0,
+  0x0F, 0x00, 0x40, 0x3F, 0xE0, 0x0F, 0x1B, 0xE0, 0x2F, 0x00, 0x40, 0x53,
+  0x40, 0x00, 0xE0, 0x07, 0x3F, 0xE0, 0x0B, 0x13, 0xE0, 0xAB, 0x00, 0x40,
+  0xC7, 0x40, 0x00, 0xE0, 0x23, 0xBB, 0x40, 0x2F, 0x40, 0x00, 0xE0, 0x17,
+  0x33, 0xC0, 0x23, 0xE0, 0x07, 0x07, 0x40, 0x00, 0xC0, 0x13, 0xE0, 0x27,
+  0x00, 0xE0, 0x17, 0x37, 0xE0, 0x17, 0x1F, 0xE0, 0x1F, 0x00, 0x40, 0x47,
+  0xE0, 0x03, 0x00, 0xE0, 0x03, 0x37, 0xC0, 0x17, 0xE0, 0x03, 0x13, 0xE0,
+  0x03, 0x00, 0xC0, 0x1F, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x23, 0xE0, 0x2B,
+  0x00, 0x40, 0x4F, 0x40, 0x37, 0x40, 0x07, 0xE0, 0x0F, 0x00, 0x40, 0x1F,
+  0xE0, 0x8F, 0x00, 0xE0, 0x0B, 0xB3, 0xC0, 0xAB, 0xE0, 0x0B, 0x1B, 0xE0,
+  0x07, 0x00, 0xE0, 0x03, 0x2B, 0xC0, 0x0B, 0xE0, 0x07, 0x00, 0xC0, 0x33,
+  0xE0, 0x07, 0x17, 0xE0, 0x1F, 0x00, 0xC0, 0x3F, 0xE0, 0x03, 0x00, 0xE0,
+  0x1F, 0x3B, 0xE0, 0x0F, 0x00, 0x40, 0x4B, 0xE0, 0x0F, 0x1B, 0xE0, 0xCF,
+  0x00, 0xC0, 0xF3, 0x40, 0x07, 0xE0, 0x03, 0x00, 0xE0, 0x3B, 0xEF, 0xE0,
+  0x07, 0x4F, 0x40, 0x0F, 0xC0, 0x57, 0xE0, 0x03, 0x0B, 0xE0, 0x47, 0x00,
+  0x40, 0x5B, 0xE0, 0x03, 0x00, 0xE0, 0x47, 0x5F, 0xE0, 0x23, 0x00, 0x40,
+  0x87, 0xE0, 0x23, 0x2F, 0xE0, 0x7B, 0x00, 0x40, 0xB3, 0xC0, 0x00, 0xE0,
+  0x07, 0x8F, 0xC0, 0x17, 0x40, 0x00, 0xC0, 0x1B, 0x40, 0x0B, 0xC0, 0x00,
+  0xC0, 0x13, 0xE0, 0x17, 0x00, 0x40, 0x2F, 0xE0, 0x17, 0x23, 0xE0, 0x23,
+  0x00, 0xE0, 0x07, 0x4F, 0xE0, 0x07, 0x0F, 0xE0, 0x7F, 0x00, 0xE0, 0x2F,
+  0x97, 0xE0, 0x2F, 0x37, 0xE0, 0x47, 0x00, 0xE0, 0x17, 0x87, 0xE0, 0x17,
+  0x1F, 0xC0, 0x00, 0xE0, 0x1F, 0x27, 0xE0, 0x2F, 0x00, 0xE0, 0x0B, 0x5F,
+  0xE0, 0x0B, 0x13, 0xE0, 0xFF, 0x10, 0x00, 0x41, 0x2B, 0x40, 0x00, 0xE1,
+  0x1F, 0x1F, 0x40, 0x2B, 0x40, 0x00, 0xE0, 0x1F, 0x2F, 0xE0, 0x47, 0x00,
+  0x40, 0x7B, 0x40, 0x00, 0xE0, 0x1B, 0x57, 0xE0, 0x07, 0x27, 0x40, 0x0F,
+  0x40, 0x00, 0xE0, 0x07, 0x3B, 0xE0, 0x0B, 0x13, 0xE0, 0x43, 0x00, 0x40,
+  0x5F, 0xC0, 0x00, 0xE0, 0x13, 0x57, 0x40, 0x23, 0xE0, 0x13, 0x1F, 0xE0,
+  0x37, 0x00, 0xE0, 0x1F, 0x5F, 0x40, 0x27, 0xC0, 0x00, 0xC0, 0x73, 0xE0,
+  0x17, 0x0F, 0xE0, 0x0B, 0x00, 0xE0, 0x07, 0x33, 0xE0, 0x4B, 0x00, 0xC0,
+  0x63, 0x40, 0x00, 0xC0, 0x5F, 0xE0, 0x03, 0x0B, 0xE0, 0x77, 0x00, 0x40,
+  0x8B, 0x40, 0x00, 0xE0, 0x77, 0x87, 0xC0, 0x00, 0xE0, 0x33, 0x8B, 0x40,
+  0x3B, 0xE0, 0x07, 0x00, 0xC0, 0x57, 0xE0, 0xE7, 0x00, 0xC1, 0x07, 0xE0,
+  0x23, 0xF7, 0xE0, 0x0F, 0x33, 0xE0, 0x0F, 0x17, 0xE0, 0x6F, 0x00, 0xE0,
+  0x0B, 0x8F, 0xE0, 0x0B, 0x13, 0xE0, 0x17, 0x00, 0xE0, 0x2B, 0x33, 0xE0,
+  0x27, 0x00, 0xE0, 0x5B, 0x63, 0xE0, 0x2F, 0x00, 0xC0, 0x9B, 0x40, 0x00,
+  0xE0, 0x2F, 0x43, 0xE0, 0x47, 0x00, 0x40, 0x8B, 0x40, 0x00, 0xE0, 0x0B,
+  0x57, 0x40, 0x17, 0x40, 0x00, 0x40, 0x1B, 0x40, 0x07, 0xE0, 0x1B, 0x00,
+  0x40, 0x2B, 0xE0, 0x4B, 0x00, 0x40, 0x7B, 0xC0, 0x57, 0x40, 0x0B, 0x40,
+  0x00, 0xC0, 0x0F, 0xE0, 0x27, 0x00, 0xE0, 0x33, 0x3B, 0xE0, 0x13, 0x00,
+  0x40, 0x57, 0x40, 0x00, 0xE0, 0x0F, 0x23, 0xE0, 0x07, 0x1B, 0x40, 0x0F,
+  0x40, 0x00, 0xE0, 0x07, 0x2F, 0xE0, 0x0B, 0x13, 0xE0, 0x3F, 0x00, 0xE0,
+  0x23, 0x5B, 0x40, 0x2B, 0x40, 0x00, 0xE0, 0x07, 0x7B, 0xE0, 0x0B, 0x13,
+  0xE0, 0x1B, 0x00, 0x40, 0x37, 0x40, 0x00, 0xE0, 0x1B, 0x2B, 0xE0, 0x17,
+  0x00, 0xE0, 0x0B, 0x47, 0x40, 0x13, 0x40, 0x00, 0xE0, 0x17, 0x3B, 0xE0,
+  0x6B, 0x00, 0xE0, 0x0F, 0x97, 0xE0, 0x0F, 0x17, 0xE0, 0x7F, 0x00, 0x40,
+  0x9F, 0xE0, 0x27, 0x00, 0xE0, 0x4B, 0xBB, 0xC0, 0x83, 0xE0, 0x43, 0x5B,
+  0x40, 0x53, 0xE0, 0x57, 0x4F, 0xE0, 0x47, 0x63, 0xE0, 0x5F, 0x00, 0xE0,
+  0x1B, 0xB7, 0x40, 0x23, 0x40, 0x00, 0xE0, 0x0B, 0x93, 0xE0, 0x07, 0x17,
+  0x40, 0x0F, 0xC0, 0x00, 0xE0, 0x0B, 0x2F, 0x40, 0x00, 0xE0, 0x17, 0x1F,
+  0xE0, 0x07, 0x00, 0x40, 0x2F, 0xE0, 0x03, 0x13, 0x40, 0x0F, 0x40, 0x00,
+  0xE0, 0x03, 0x13, 0xE0, 0x7F, 0x00, 0xE0, 0x27, 0x97, 0x40, 0x2F, 0xE0,
+  0x0B, 0x00, 0xE0, 0x63, 0xCF, 0xE0, 0x0B, 0x7F, 0xE0, 0x1B, 0x00, 0xE0,
+  0x23, 0xA3, 0x40, 0x4F, 0xE0, 0x23, 0x2F, 0xE0, 0x0B, 0x00, 0xE0, 0x2F,
+  0x43, 0x40, 0x37, 0x40, 0x00, 0xE0, 0x0B, 0x53, 0xE0, 0x2B, 0x00, 0xE0,
+  0x0B, 0x4B, 0x40, 0x13, 0x40, 0x00, 0xE0, 0x2B, 0x4F, 0xE0, 0x97, 0x00,
+  0x40, 0xD7, 0xC0, 0x00, 0xE0, 0x07, 0xAB, 0x40, 0x17, 0xC0, 0x13, 0x40,
+  0x0B, 0xC0, 0x00, 0xC0, 0x13, 0xE0, 0x0F, 0x00, 0x40, 0x27, 0xE0, 0x0F,
+  0x1B, 0xE0, 0x07, 0x00, 0x40, 0x2B, 0xC0, 0x00, 0x40, 0x1B, 0xE0, 0x03,
+  0x0B, 0xE0, 0x07, 0x00, 0x40, 0x1B, 0xE0, 0x07, 0x13, 0xE0, 0x23, 0x00,
+  0xE0, 0x1F, 0x3F, 0xE0, 0x0F, 0x27, 0xE0, 0x0F, 0x17, 0xC0, 0x00, 0xE0,
+  0x07, 0x1F, 0x40, 0x0F, 0x40, 0x00, 0xC0, 0x1F, 0xC0, 0x00, 0xC0, 0x13,
+  0xC0, 0x07, 0xE0, 0x47, 0x00, 0x40, 0x57, 0xE0, 0x23, 0x00, 0x40, 0x7F,
+  0xE0, 0x07, 0x2F, 0x40, 0x13, 0xE0, 0x1F, 0x00, 0x40, 0x3B, 0xE0, 0x1F,
+  0x2B, 0xE0, 0x43, 0x00, 0x40, 0x77, 0xC0, 0x00, 0xE0, 0x43, 0x57, 0xC0,
+  0x00, 0xC0, 0x5B, 0xE0, 0x03, 0x00, 0xC0, 0x1B, 0xE0, 0xC3, 0x00, 0xC0,
+  0xDF, 0xE0, 0x17, 0xD3, 0xE0, 0x07, 0x27, 0xE0, 0x07, 0x0F, 0xE0, 0x2B,
+  0x00, 0xC0, 0x43, 0xE0, 0x0B, 0x00, 0xC0, 0x4F, 0x40, 0x1B, 0xC0, 0x0B,
+  0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x37, 0x00, 0xE0, 0x0F, 0x57,
+  0xE0, 0x0F, 0x17, 0xE0, 0x0F, 0x00, 0x40, 0x2F, 0x40, 0x00, 0xE0, 0x03,
+  0x1F, 0xE0, 0x07, 0x0F, 0xE0, 0x43, 0x00, 0x40, 0x5B, 0xE0, 0x3B, 0x00,
+  0xE0, 0x43, 0x93, 0xE0, 0x33, 0x00, 0x40, 0xCB, 0xE0, 0x33, 0x3F, 0xE0,
+  0x37, 0x00, 0x40, 0x7F, 0x40, 0x00, 0xE0, 0x0F, 0x47, 0xE0, 0x13, 0x1B,
+  0xE0, 0x03, 0x00, 0x40, 0x27, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x5F,
+  0x00, 0xE0, 0x0B, 0x77, 0xE0, 0x0B, 0x13, 0xE0, 0x6F, 0x00, 0x40, 0x8B,
+  0xE0, 0x13, 0x00, 0x40, 0x97, 0xC0, 0x1F, 0xC0, 0x0B, 0x40, 0x07, 0x40,
+  0x00, 0x40, 0x17, 0x40, 0x07, 0xE0, 0xFF, 0x00, 0x00, 0x41, 0x0F, 0xE0,
+  0x03, 0x00, 0x41, 0x17, 0xE0, 0x03, 0x0F, 0xE0, 0x07, 0x00, 0x40, 0x1F,
+  0x40, 0x00, 0xC0, 0x17, 0x40, 0x0B, 0xE0, 0x83, 0x00, 0x40, 0x97, 0xE0,
+  0x77, 0x8F, 0x40, 0x83, 0xC0, 0x00, 0xE0, 0x07, 0x8B, 0x40, 0x17, 0xE0,
+  0x07, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x1F, 0x40, 0x00, 0x40, 0x13, 0x40,
+  0x07, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x73, 0x00, 0x40, 0x87, 0xE0, 0x6F,
+  0x7F, 0x40, 0x7B, 0x40, 0x00, 0xC0, 0x7F, 0x40, 0x0B, 0xE0, 0x2B, 0x00,
+  0xC0, 0x3F, 0xE0, 0xFF, 0x04, 0x00, 0xE1, 0x03, 0x47, 0xC1, 0x17, 0x40,
+  0x13, 0x40, 0x0B, 0x40, 0x07, 0xE0, 0x07, 0x00, 0x40, 0x17, 0xE0, 0x93,
+  0x00, 0x40, 0xAF, 0x40, 0x9F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0,
+  0x67, 0x00, 0x40, 0x77, 0xC0, 0x00, 0xE0, 0x03, 0x7B, 0xE0, 0x13, 0x13,
+  0xE0, 0x1F, 0x00, 0xE0, 0x03, 0x4F, 0xE0, 0x5B, 0x00, 0xE0, 0x07, 0x97,
+  0xE0, 0x5B, 0x73, 0xE0, 0x0F, 0x00, 0xE0, 0x07, 0x8B, 0xE0, 0x0F, 0x00,
+  0xC0, 0x3F, 0xE0, 0x07, 0x1F, 0xC0, 0x17, 0xE0, 0x13, 0x00, 0x40, 0x33,
+  0xE0, 0x13, 0x1F, 0xE0, 0x7F, 0x00, 0xE0, 0x43, 0xA7, 0x40, 0x4B, 0xE0,
+  0x1B, 0x00, 0xE0, 0x7F, 0xFB, 0xE0, 0x17, 0x00, 0xC0, 0xCB, 0xE0, 0x13,
+  0x27, 0x40, 0x23, 0xE0, 0x13, 0x1F, 0xE0, 0x37, 0x00, 0x40, 0x5F, 0x40,
+  0x00, 0x40, 0x47, 0x40, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xC0, 0x00,
+  0xE0, 0x03, 0x17, 0xE0, 0x1B, 0x00, 0xC0, 0x37, 0xE0, 0x1F, 0x00, 0xC0,
+  0x53, 0xE0, 0x23, 0x2F, 0xC0, 0x2B, 0xC0, 0x3B, 0xE0, 0x07, 0x00, 0xC0,
+  0x1F, 0xE0, 0x67, 0x00, 0xE0, 0x07, 0x87, 0xE0, 0x0F, 0x00, 0xE0, 0x03,
+  0x97, 0xE0, 0x1B, 0x23, 0xC0, 0x00, 0xE0, 0x03, 0x2B, 0x40, 0x13, 0x40,
+  0x0F, 0x40, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0x40, 0x00, 0xE0, 0x03,
+  0x13, 0xE0, 0x8F, 0x00, 0xE0, 0x27, 0xA7, 0x40, 0x2F, 0xE0, 0x0B, 0x00,
+  0x40, 0xDF, 0xC0, 0x17, 0x40, 0x0B, 0xE0, 0x97, 0x00, 0x40, 0xAB, 0xE0,
+  0x17, 0xA3, 0x40, 0x23, 0xE0, 0x03, 0x00, 0xE0, 0x17, 0x2F, 0xE0, 0x2B,
+  0x00, 0xE0, 0x03, 0x5F, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x4B, 0xC0, 0x17,
+  0x40, 0x13, 0xC0, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x17, 0x40, 0x00, 0x40,
+  0x13, 0x40, 0x07, 0xE0, 0x27, 0x00, 0x40, 0x37, 0xE0, 0x03, 0x00, 0xE0,
+  0x17, 0x3F, 0x40, 0x2B, 0xC0, 0x23, 0x40, 0x0B, 0xE0, 0x07, 0x00, 0xC0,
+  0x1B, 0xE0, 0x6F, 0x00, 0x40, 0x8F, 0xC0, 0x7B, 0x40, 0x0B, 0xE0, 0x0F,
+  0x00, 0x40, 0x23, 0xE0, 0x13, 0x1B, 0xE0, 0x0F, 0x00, 0x40, 0x33, 0xC0,
+  0x1B, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0x40, 0x13, 0x40, 0x00, 0xC0, 0x0F,
+  0xE0, 0x0F, 0x00, 0xE0, 0x1B, 0x23, 0xE0, 0x4F, 0x00, 0xE0, 0x2F, 0x7B,
+  0x40, 0x37, 0xE0, 0x07, 0x00, 0xE0, 0x4F, 0xA3, 0xE0, 0x4F, 0x00, 0xC0,
+  0xBF, 0xE0, 0x27, 0x5F, 0x40, 0x37, 0xE0, 0x27, 0x33, 0xE0, 0x0B, 0x00,
+  0xE0, 0x03, 0x47, 0xC0, 0x0B, 0x40, 0x07, 0xC0, 0x00, 0xE0, 0x07, 0x33,
+  0x40, 0x17, 0xC0, 0x13, 0x40, 0x0B, 0xE0, 0x17, 0x00, 0xC0, 0x2B, 0xE0,
+  0x07, 0x00, 0x40, 0x37, 0xE0, 0x07, 0x13, 0xE0, 0x3B, 0x00, 0x40, 0x57,
+  0x40, 0x00, 0xE0, 0x3B, 0x4B, 0xE0, 0x0F, 0x00, 0xE0, 0x33, 0x5F, 0x40,
+  0x3B, 0xE0, 0x1F, 0x00, 0xE0, 0x0F, 0x7F, 0xE0, 0x13, 0x00, 0xC0, 0x5B,
+  0xC0, 0x23, 0xE0, 0x07, 0x0F, 0xE0, 0x8B, 0x00, 0xE0, 0x33, 0xA3, 0xC0,
+  0x3B, 0xC0, 0x00, 0xE0, 0x8B, 0xDF, 0xE0, 0x0F, 0x00, 0xC0, 0xB3, 0x40,
+  0x00, 0xE0, 0x0F, 0x23, 0xE0, 0x57, 0x00, 0xE0, 0x0B, 0x7B, 0x40, 0x13,
+  0xE0, 0x03, 0x00, 0xE0, 0x13, 0x83, 0xE0, 0x03, 0x27, 0xE0, 0x0B, 0x00,
+  0xE0, 0x13, 0x3B, 0xE0, 0x9B, 0x00, 0x40, 0xD3, 0xE0, 0x3B, 0xA7, 0x40,
+  0x47, 0xE0, 0x2B, 0x00, 0x40, 0x7B, 0x40, 0x37, 0x40, 0x07, 0xE0, 0x17,
+  0x00, 0x40, 0x27, 0x40, 0x00, 0xC0, 0x27, 0x40, 0x0B, 0xC0, 0x00, 0xC0,
+  0x13, 0xE0, 0x4F, 0x00, 0x40, 0x67, 0xE0, 0x33, 0x5B, 0xE0, 0x2F, 0x3F,
+  0x40, 0x37, 0x40, 0x00, 0x40, 0x7B, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B,
+  0xE0, 0xD7, 0x00, 0xE0, 0x3F, 0xE7, 0x40, 0x47, 0x40, 0x00, 0xE1, 0x03,
+  0x2F, 0x40, 0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x1B, 0xE0, 0x07, 0x00,
+  0xE0, 0x03, 0x27, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x27, 0xE0, 0x9F, 0x00,
+  0x40, 0xC3, 0xE0, 0x1F, 0xAB, 0x40, 0x2B, 0x40, 0x00, 0xE0, 0x17, 0x2F,
+  0x40, 0x23, 0xE0, 0x1B, 0x00, 0x40, 0x47, 0xE0, 0x07, 0x27, 0x40, 0x13,
+  0xE0, 0x17, 0x00, 0xE0, 0x0F, 0x33, 0xE0, 0x03, 0x17, 0xE0, 0x17, 0x43,
+  0xE0, 0x37, 0x00, 0xC0, 0x6B, 0xE0, 0x2B, 0x47, 0xC0, 0x3B, 0x40, 0x00,
+  0xE0, 0x27, 0x3F, 0xE0, 0x2B, 0x33, 0xE0, 0x77, 0x00, 0xE0, 0x3B, 0xB3,
+  0xE0, 0x3F, 0x43, 0xE0, 0x07, 0x00, 0xE1, 0x03, 0x1B, 0xE0, 0x03, 0x1B,
+  0xE0, 0x03, 0x17, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x23, 0xE0, 0x07, 0x00,
+  0xE0, 0x03, 0x27, 0xE0, 0x6F, 0x00, 0x40, 0x93, 0xE0, 0x1F, 0x7B, 0x40,
+  0x2B, 0x40, 0x00, 0xE0, 0x1F, 0x2F, 0xE0, 0x23, 0x00, 0x40, 0x57, 0xE0,
+  0x0B, 0x00, 0x40, 0x43, 0xE0, 0x07, 0x17, 0x40, 0x13, 0xE0, 0x27, 0x00,
+  0x40, 0x43, 0xE0, 0x27, 0x33, 0xC0, 0x00, 0xE0, 0x03, 0x3B, 0xE0, 0x03,
+  0x0B, 0xE0, 0x5B, 0x00, 0xC0, 0x6F, 0xC0, 0x07, 0xE0, 0x3F, 0x00, 0xE0,
+  0x47, 0x4F, 0xE0, 0xCB, 0x00, 0x41, 0x23, 0xE0, 0x07, 0x00, 0xE0, 0x07,
+  0xE7, 0xC0, 0x1F, 0xE0, 0x0B, 0x17, 0xE0, 0x0B, 0x13, 0xE0, 0x03, 0x00,
+  0xE0, 0x07, 0x1F, 0xE0, 0x6B, 0x00, 0x40, 0x8F, 0xE0, 0x27, 0x77, 0x40,
+  0x33, 0x40, 0x00, 0xE0, 0x1F, 0x37, 0xE0, 0x27, 0x2B, 0x40, 0x00, 0xE0,
+  0x03, 0x5B, 0x40, 0x0F, 0xC0, 0x00, 0xE0, 0x03, 0x17, 0xE0, 0x5B, 0x00,
+  0xE0, 0x07, 0x77, 0xC0, 0x0F, 0x40, 0x00, 0x40, 0x7F, 0x40, 0x07, 0x40,
+  0x00, 0x40, 0x0B, 0xE0, 0x0F, 0x00, 0xE0, 0x0B, 0x1F, 0x40, 0x13, 0x40,
+  0x00, 0xE0, 0x0B, 0x33, 0xC0, 0x17, 0x40, 0x07, 0x40, 0x00, 0xE0, 0x0B,
+  0x23, 0xE0, 0x7F, 0x00, 0x40, 0x9F, 0xC0, 0x00, 0xE0, 0x33, 0x93, 0x40,
+  0x43, 0xE0, 0x0B, 0x3F, 0xE0, 0x07, 0x17, 0xE0, 0x07, 0x0F, 0xE0, 0x47,
+  0x00, 0xE0, 0x07, 0x5F, 0x40, 0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x6F,
+  0xE0, 0x03, 0x17, 0x40, 0x00, 0xE0, 0x03, 0x1B, 0xE0, 0x13, 0x00, 0x40,
+  0x2B, 0x40, 0x00, 0xE0, 0x07, 0x23, 0xE0, 0x0B, 0x13, 0xE0, 0x57, 0x00,
+  0x40, 0x73, 0x40, 0x00, 0xE0, 0x23, 0x67, 0x40, 0x2F, 0x40, 0x00, 0xE0,
+  0x23, 0x33, 0xE0, 0x1F, 0x00, 0xE0, 0x03, 0x57, 0x40, 0x0B, 0xE0, 0x07,
+  0x00, 0xE0, 0x1F, 0x47, 0xE0, 0x2F, 0x00, 0x40, 0x6F, 0xC0, 0x3B, 0x40,
+  0x0B, 0xC0, 0x00, 0xE0, 0x0B, 0x13, 0xC0, 0x00, 0xC0, 0x1B, 0xE0, 0x47,
+  0x00, 0xC0, 0x5F, 0x40, 0x00, 0xE0, 0x0F, 0x5B, 0xE0, 0x13, 0x1B, 0xE0,
+  0x63, 0x00, 0xE0, 0x37, 0x87, 0xE0, 0x37, 0x3F, 0xE0, 0x3F, 0x00, 0xC0,
+  0x87, 0x40, 0x07, 0xE0, 0x0B, 0x00, 0xE0, 0x3F, 0x67, 0xE0, 0x57, 0x00,
+  0x40, 0xBB, 0xE0, 0x57, 0x63, 0xE0, 0x3B, 0x00, 0x40, 0xA7, 0xE0, 0x03,
+  0x00, 0xC0, 0x53, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x00, 0xC0, 0x1F, 0xE0,
+  0x5B, 0x00, 0xE0, 0x17, 0x77, 0xC0, 0x1F, 0xE0, 0x57, 0x8B, 0x40, 0x67,
+  0xE0, 0x0B, 0x63, 0x40, 0x17, 0x40, 0x00, 0xE0, 0x0B, 0x1B, 0xE0, 0xA7,
+  0x00, 0xE0, 0x0B, 0xC7, 0xE0, 0x0B, 0x13, 0xE0, 0x3F, 0x00, 0xE0, 0x17,
+  0x5B, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x00, 0xE0, 0x33, 0x7B, 0xE0, 0x03,
+  0x43, 0x40, 0x0B, 0xE0, 0x33, 0x4B, 0xE0, 0x93, 0x00, 0xE0, 0x43, 0xDB,
+  0x40, 0x4B, 0xE0, 0x07, 0x00, 0xE0, 0x3F, 0xFB, 0x40, 0x57, 0xE0, 0x1B,
+  0x4B, 0x40, 0x27, 0x40, 0x00, 0xE0, 0x0F, 0x2B, 0x40, 0x1B, 0x40, 0x00,
+  0xC0, 0x1F, 0xE0, 0x03, 0x0B, 0xE0, 0x3F, 0x00, 0x40, 0x53, 0xE0, 0x03,
+  0x00, 0xE0, 0x3F, 0x57, 0xE0, 0x3F, 0x00, 0xC0, 0x9B, 0xE0, 0x33, 0x4F,
+  0x40, 0x43, 0xE0, 0x33, 0x3F, 0xE0, 0x27, 0x00, 0xE0, 0x0F, 0x6F, 0xC0,
+  0x17, 0x40, 0x07, 0xE0, 0x0B, 0x00, 0xE0, 0x27, 0x67, 0x40, 0x00, 0xE0,
+  0x03, 0x47, 0xE0, 0x03, 0x0F, 0x40, 0x0B, 0xE0, 0x4F, 0x00, 0x40, 0x73,
+  0xE0, 0x2B, 0x5B, 0xE0, 0x17, 0x37, 0xE0, 0x0F, 0x1F, 0x40, 0x17, 0xC0,
+  0x00, 0xE0, 0x2B, 0x77, 0xE0, 0x0F, 0x00, 0xC0, 0x53, 0x40, 0x00, 0xE0,
+  0x13, 0x23, 0xE0, 0x0F, 0x1B, 0xE0, 0x0F, 0x00, 0xE0, 0x03, 0x4F, 0x40,
+  0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x2F, 0xC0, 0x13, 0x40, 0x00, 0xE0, 0x03,
+  0x17, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0xE0, 0x0B, 0x00, 0xE0, 0x03, 0x23,
+  0xE0, 0x37, 0x00, 0xE0, 0x07, 0x5F, 0xE0, 0x37, 0x4F, 0xE0, 0x47, 0x00,
+  0x40, 0x9F, 0xE0, 0x47, 0x53, 0xE0, 0x0F, 0x00, 0x40, 0x6B, 0xC0, 0x00,
+  0xE0, 0x0F, 0x23, 0xE0, 0x0B, 0x00, 0xE0, 0x0F, 0x33, 0xC0, 0x17, 0xE0,
+  0x03, 0x00, 0x40, 0x3F, 0xE0, 0x03, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x1B,
+  0xC0, 0x00, 0x40, 0x17, 0xC0, 0x0B, 0xE0, 0x0F, 0x00, 0x40, 0x23, 0xE0,
+  0x17, 0x00, 0xE0, 0x0F, 0x3B, 0x40, 0x00, 0x40, 0x3B, 0x40, 0x07, 0xE0,
+  0x0F, 0x00, 0xE0, 0x17, 0x1F, 0x40, 0x00, 0xE0, 0x1F, 0x23, 0xC0, 0x00,
+  0x40, 0x33, 0xE0, 0x07, 0x00, 0xC0, 0x1B, 0xE0, 0x03, 0x00, 0xE0, 0x03,
+  0x23, 0xC0, 0x17, 0xE0, 0x03, 0x13, 0xE0, 0x3B, 0x00, 0xE0, 0x17, 0x57,
+  0x40, 0x1F, 0xE0, 0x2B, 0x67, 0xC0, 0x37, 0x40, 0x07, 0xE0, 0x03, 0x00,
+  0xE0, 0x27, 0x4B, 0xE0, 0x03, 0x3B, 0xC0, 0x00, 0xE0, 0x27, 0x43, 0xE0,
+  0x1B, 0x00, 0xC0, 0x5B, 0x40, 0x00, 0xE0, 0x1B, 0x2F, 0xC0, 0x00, 0xE0,
+  0x27, 0x2F, 0xE0, 0xCB, 0x00, 0x41, 0x03, 0xC0, 0x00, 0xE0, 0x07, 0xDF,
+  0xE0, 0x07, 0x17, 0xC0, 0x0F, 0xE0, 0x13, 0x00, 0xE0, 0x07, 0x43, 0xE0,
+  0x13, 0x00, 0xE0, 0x0F, 0x47, 0xE0, 0x13, 0x33, 0xE0, 0x1B, 0x00, 0x40,
+  0x57, 0xE0, 0x1B, 0x27, 0xC0, 0x00, 0xE0, 0x1B, 0x2F, 0x40, 0x23, 0x40,
+  0x00, 0x40, 0x33, 0xC0, 0x07, 0x40, 0x00, 0xC0, 0x0B, 0x40, 0x07, 0xE0,
+  0x03, 0x00, 0x40, 0x1B, 0xE0, 0x0B, 0x00, 0x40, 0x23, 0xE0, 0x03, 0x17,
+  0xE0, 0x07, 0x0F, 0xE0, 0x43, 0x00, 0xE0, 0x03, 0x5B, 0x40, 0x0B, 0xC0,
+  0x00, 0xE0, 0x23, 0x63, 0xC0, 0x33, 0x40, 0x00, 0x40, 0x37, 0x40, 0x07,
+  0x40, 0x00, 0x40, 0x0B, 0xE0, 0x1B, 0x00, 0x40, 0x2B, 0xC0, 0x00, 0xE0,
+  0x1B, 0x2F, 0xE0, 0x2B, 0x00, 0xC0, 0x5F, 0xC0, 0x00, 0x40, 0x43, 0xE0,
+  0x03, 0x0B, 0xE0, 0x0B, 0x00, 0xE0, 0x17, 0x1F, 0xE0, 0xE3, 0x00, 0xE1,
+  0x13, 0x0B, 0xC0, 0x1B, 0xE0, 0x1B, 0x00, 0x41, 0x33, 0x40, 0x27, 0x40,
+  0x07, 0xE0, 0x23, 0x00, 0x40, 0x33, 0xE0, 0x03, 0x00, 0x40, 0x3B, 0x40,
+  0x0F, 0x40, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xC0, 0x00, 0xE0, 0x03,
+  0x17, 0xE0, 0x07, 0x00, 0x40, 0x23, 0xE0, 0x07, 0x13, 0xE0, 0x37, 0x00,
+  0x40, 0x53, 0x40, 0x00, 0x40, 0x47, 0xE0, 0x03, 0x07, 0xC0, 0x00, 0x40,
+  0x17, 0xE0, 0x67, 0x00, 0xC0, 0x7B, 0x40, 0x00, 0xE0, 0x4F, 0x7B, 0x40,
+  0x5B, 0xC0, 0x00, 0xC0, 0x63, 0x40, 0x0F, 0xC0, 0x0B, 0xE0, 0x13, 0x00,
+  0x40, 0x27, 0xC0, 0x00, 0xE0, 0x13, 0x27, 0xE0, 0xFF, 0x60, 0x00, 0x41,
+  0x8B, 0xE1, 0x07, 0x6B, 0x40, 0x13, 0xC0, 0x00, 0xC0, 0x1B, 0xC0, 0x0F,
+  0xE0, 0x07, 0x00, 0x40, 0x1F, 0xE0, 0x03, 0x13, 0xE0, 0x0F, 0x0F, 0x40,
+  0x17, 0xE0, 0x23, 0x00, 0xE0, 0x03, 0x53, 0x40, 0x00, 0xE0, 0x17, 0x3B,
+  0xE0, 0x1B, 0x23, 0xE0, 0x0B, 0x00, 0xE0, 0x07, 0x37, 0xE0, 0x07, 0x0F,
+  0xE0, 0x0B, 0x00, 0x40, 0x23, 0x40, 0x00, 0xE0, 0x0B, 0x1B, 0xC0, 0x00,
+  0xE0, 0x07, 0x1F, 0xE0, 0x07, 0x0F, 0x40, 0x00, 0xE0, 0x0B, 0x13, 0xE0,
+  0x33, 0x00, 0x40, 0x4F, 0xE0, 0x03, 0x00, 0xE0, 0x33, 0x4B, 0xE0, 0x13,
+  0x00, 0xC0, 0x63, 0xE0, 0x0F, 0x23, 0x40, 0x1F, 0xE0, 0x0B, 0x1B, 0x40,
+  0x17, 0xE0, 0x07, 0x00, 0xE0, 0x0B, 0x27, 0xE0, 0x77, 0x00, 0xC0, 0xA3,
+  0xE0, 0x77, 0x87, 0xE0, 0x2B, 0x00, 0xC0, 0xBB, 0x40, 0x00, 0xE0, 0x07,
+  0x3F, 0xE0, 0x0F, 0x13, 0xE0, 0x13, 0x00, 0xC0, 0x43, 0xE0, 0x0B, 0x23,
+  0xC0, 0x1B, 0x40, 0x00, 0xE0, 0x03, 0x1F, 0x40, 0x0F, 0xE0, 0x23, 0x00,
+  0xC0, 0x3B, 0xC0, 0x33, 0xE0, 0x07, 0x0F, 0xE0, 0x1B, 0x00, 0xE0, 0x0B,
+  0x33, 0xC0, 0x13, 0x40, 0x00, 0xE0, 0x0F, 0x43, 0x40, 0x1B, 0x40, 0x00,
+  0xE0, 0x0F, 0x1F, 0xE0, 0x07, 0x00, 0x40, 0x2B, 0x40, 0x00, 0xE0, 0x07,
+  0x17, 0xE0, 0x2F, 0x00, 0xE0, 0x43, 0x4B, 0xC0, 0x00, 0xE0, 0x03, 0x53,
+  0xE0, 0x03, 0x0B, 0x40, 0x00, 0xE0, 0x17, 0x0F, 0xC0, 0x00, 0xE0, 0x07,
+  0x27, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0x40,
+  0x0F, 0x40, 0x07, 0xE0, 0x1B, 0x00, 0x40, 0x2B, 0xC0, 0x00, 0xE0, 0x1B,
+  0x2F, 0xE0, 0x23, 0x00, 0x40, 0x57, 0xE0, 0x23, 0x2F, 0xE0, 0x4F, 0x00,
+  0xE0, 0x1F, 0x87, 0xE0, 0x1F, 0x27, 0xE0, 0x27, 0x00, 0x40, 0x57, 0xE0,
+  0x3B, 0x00, 0xC0, 0x77, 0xE0, 0x0F, 0x4B, 0xE0, 0x23, 0x1F, 0xC0, 0x2B,
+  0x40, 0x00, 0xC0, 0x4F, 0xE0, 0x07, 0x0B, 0xE0, 0x0F, 0x00, 0x40, 0x2F,
+  0xE0, 0x0F, 0x1B, 0x40, 0x00, 0xE0, 0x17, 0x1F, 0xE0, 0x0F, 0x00, 0x40,
+  0x37, 0x40, 0x00, 0xE0, 0x0F, 0x1F, 0xE0, 0x03, 0x00, 0x40, 0x27, 0xC0,
+  0x00, 0xE0, 0x03, 0x17, 0xE0, 0x77, 0x00, 0x40, 0x93, 0xE0, 0x03, 0x83,
+  0x40, 0x0F, 0x40, 0x00, 0xE0, 0x0B, 0x13, 0xC0, 0x00, 0xE0, 0x03, 0x1B,
+  0xE0, 0x07, 0x00, 0xE0, 0x23, 0x23, 0xC0, 0x00, 0xE0, 0x03, 0x43, 0x40,
+  0x13, 0xE0, 0x03, 0x0F, 0xE0, 0x17, 0x00, 0xE0, 0x1F, 0x2F, 0x40, 0x27,
+  0x40, 0x00, 0xE0, 0x0F, 0x4F, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x0F, 0x1F,
+  0xE0, 0x3F, 0x00, 0xE0, 0x1B, 0x63, 0xE0, 0x07, 0x23, 0xE0, 0x07, 0x0F,
+  0xC0, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x3F, 0x00, 0x40, 0x5F, 0x40, 0x00,
+  0x40, 0x4F, 0x40, 0x07, 0xE0, 0x07, 0x00, 0x40, 0x17, 0x40, 0x00, 0xE0,
+  0x07, 0x17, 0x40, 0x00, 0x40, 0x17, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x0B,
+  0x00, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x0B, 0x1B, 0xE0, 0x03, 0x00, 0x40,
+  0x23, 0xE0, 0x03, 0x00, 0xC0, 0x1B, 0xE0, 0x1F, 0x13, 0x40, 0x00, 0xE0,
+  0x03, 0x2B, 0xE0, 0x43, 0x00, 0x40, 0x5B, 0x40, 0x00, 0xE0, 0x1B, 0x53,
+  0x40, 0x27, 0xC0, 0x00, 0xE0, 0x1B, 0x2F, 0xE0, 0x53, 0x00, 0x40, 0x87,
+  0xC0, 0x5F, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0x13, 0xC0, 0x0B, 0x40, 0x00,
+  0x40, 0x0F, 0xE0, 0x3B, 0x00, 0xE0, 0x07, 0x4B, 0xE0, 0x07, 0x0F, 0xC0,
+  0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x3F, 0x00, 0xE0, 0x57, 0x5F, 0xC0, 0x00,
+  0xE0, 0x07, 0x67, 0xE0, 0x07, 0x0F, 0xE0, 0x9F, 0x00, 0xE0, 0x03, 0xB7,
+  0x40, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x0B, 0xC3, 0xE0, 0x03, 0x1F, 0x40,
+  0x00, 0xE0, 0x03, 0x23, 0x40, 0x0F, 0xE0, 0x0B, 0x00, 0x40, 0x23, 0xE0,
+  0x0B, 0x17, 0xC0, 0x00, 0x40, 0x1F, 0xE0, 0x07, 0x00, 0x40, 0x1B, 0xE0,
+  0x03, 0x13, 0xE0, 0x07, 0x0F, 0xC0, 0x00, 0x40, 0x17, 0x40, 0x00, 0xC0,
+  0x0F, 0xE0, 0x47, 0x00, 0xE0, 0x1F, 0x5B, 0xC0, 0x27, 0xC0, 0x07, 0xE0,
+  0x1F, 0x00, 0x40, 0x2F, 0xC0, 0x00, 0xE0, 0x1F, 0x33, 0xE0, 0x27, 0x00,
+  0xC0, 0x5F, 0xE0, 0x0F, 0x00, 0xE0, 0x27, 0x4F, 0xE0, 0x0B, 0x00, 0x40,
+  0x5B, 0xE0, 0x0B, 0x17, 0xE0, 0x23, 0x00, 0x40, 0x43, 0x40, 0x00, 0x40,
+  0x33, 0xC0, 0x07, 0xE0, 0x63, 0x00, 0xE0, 0x1F, 0x73, 0x40, 0x27, 0x40,
+  0x00, 0xE0, 0x03, 0x9B, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0,
+  0x07, 0x00, 0x40, 0x1F, 0x40, 0x00, 0xE0, 0x07, 0x17, 0xE0, 0xA3, 0x00,
+  0x40, 0xBF, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0xBB, 0xE0, 0x03, 0x17, 0xE0,
+  0x2B, 0x00, 0xE0, 0x07, 0x4B, 0xC0, 0x0F, 0xC0, 0x4B, 0xC0, 0x0F, 0xE0,
+  0x03, 0x00, 0x40, 0x1B, 0xC0, 0x0F, 0xE0, 0x07, 0x0B, 0x40, 0x00, 0xC0,
+  0x1B, 0xE0, 0x3B, 0x00, 0x40, 0x4F, 0x40, 0x00, 0xE0, 0x07, 0x4B, 0xE0,
+  0x0B, 0x13, 0x40, 0x00, 0x40, 0x17, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x13,
+  0x00, 0x40, 0x23, 0x40, 0x00, 0xE0, 0x13, 0x23, 0xE0, 0x1F, 0x00, 0xE0,
+  0x0B, 0x47, 0x40, 0x13, 0xE0, 0x0F, 0x00, 0xE0, 0x1F, 0x57, 0xE0, 0x1F,
+  0x00, 0x40, 0x67, 0xE0, 0x1F, 0x2B, 0xE0, 0x57, 0x00, 0x40, 0x8B, 0xE0,
+  0x03, 0x00, 0xE0, 0x13, 0x6F, 0xC0, 0x27, 0xE0, 0x13, 0x23, 0xE0, 0x13,
+  0x00, 0x40, 0x3F, 0xE0, 0x13, 0x1F, 0x40, 0x00, 0x40, 0x23, 0x40, 0x00,
+  0x40, 0x0B, 0xE0, 0xAF, 0x00, 0x40, 0xBF, 0x40, 0x00, 0x40, 0xBF, 0x40,
+  0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x23,
+  0x00, 0xE0, 0x03, 0x3B, 0xC0, 0x00, 0x40, 0x3F, 0xC0, 0x0B, 0x40, 0x00,
+  0x40, 0x0F, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x13, 0x40,
+  0x00, 0xE0, 0x0B, 0x13, 0x40, 0x00, 0xE0, 0x03, 0x17, 0xE0, 0x0B, 0x00,
+  0xE0, 0x17, 0x23, 0xE0, 0x03, 0x1F, 0x40, 0x0B, 0x40, 0x00, 0xE0, 0x0B,
+  0x47, 0xE0, 0x07, 0x00, 0x40, 0x27, 0x40, 0x00, 0xE0, 0x07, 0x17, 0xC0,
+  0x00, 0x40, 0x1B, 0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x0B, 0x00, 0xE0, 0x17,
+  0x1F, 0xE0, 0x07, 0x00, 0x40, 0x2F, 0x40, 0x00, 0xE0, 0x0F, 0x17, 0xC0,
+  0x00, 0xE0, 0x07, 0x1F, 0xE0, 0x43, 0x00, 0x40, 0x63, 0xE0, 0x17, 0x4F,
+  0xE0, 0x07, 0x23, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x17, 0x37, 0xE0, 0x27,
+  0x00, 0x40, 0x53, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x3F, 0x40, 0x1B, 0xE0,
+  0x03, 0x13, 0xE0, 0x07, 0x0F, 0xE0, 0x23, 0x00, 0xE0, 0x13, 0x3B, 0x40,
+  0x1B, 0x40, 0x00, 0xE0, 0x23, 0x4F, 0xE0, 0x1B, 0x00, 0x40, 0x53, 0x40,
+  0x00, 0xE0, 0x1B, 0x2B, 0xE0, 0x1B, 0x00, 0xE0, 0x17, 0x4B, 0x40, 0x1F,
+  0xC0, 0x00, 0xC0, 0x4F, 0xE0, 0x07, 0x0F, 0x40, 0x00, 0xC0, 0x13, 0x40,
+  0x00, 0x40, 0x0F, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x13,
+  0x40, 0x00, 0x40, 0x13, 0x40, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0x40,
+  0x00, 0xE0, 0x17, 0x13, 0xE0, 0x0F, 0x00, 0x40, 0x3B, 0x40, 0x00, 0xE0,
+  0x2F, 0x1F, 0xE0, 0x03, 0x00, 0x40, 0x47, 0x40, 0x00, 0xE0, 0x03, 0x13,
+  0xE0, 0x37, 0x00, 0x40, 0x4F, 0xC0, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const BakedTexture cloudsBakedTexture = { 256, 256, 4, 262144, 29072, cloudsBakedTextureData };
+
+static const unsigned char fontBakedTextureData[10159] = {
+  0x21, 0x00, 0x00, 0xE0, 0x19, 0x01, 0x00, 0xFF, 0xE0, 0x0E, 0x00, 0xC0,
+  0x39, 0xE0, 0x0E, 0x1E, 0xE0, 0x08, 0x1F, 0x40, 0x2F, 0x20, 0x16, 0x60,
+  0x00, 0x40, 0x0B, 0xE0, 0x07, 0x00, 0x40, 0x18, 0xE0, 0x07, 0x13, 0xC0,
+  0x00, 0x40, 0x1B, 0xC0, 0x00, 0xC0, 0x13, 0xE0, 0x07, 0x00, 0x40, 0x1F,
+  0xE0, 0x07, 0x13, 0xE0, 0x17, 0x00, 0x40, 0x33, 0xE0, 0x13, 0x00, 0xE0,
+  0x47, 0x3F, 0xE0, 0x07, 0x6B, 0xC0, 0x5F, 0xE0, 0x0F, 0x17, 0xC0, 0x00,
+  0xE0, 0x07, 0x1F, 0xC0, 0x00, 0x40, 0x1F, 0xC0, 0x0B, 0xE0, 0x0F, 0x00,
+  0x40, 0x23, 0x40, 0x00, 0xC0, 0x1F, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0F,
+  0x40, 0x07, 0xE0, 0x13, 0x00, 0xE0, 0x13, 0x23, 0x40, 0x1B, 0xE0, 0x33,
+  0x00, 0xE0, 0x03, 0x77, 0xE0, 0x03, 0x47, 0xE0, 0x03, 0x17, 0x40, 0x00,
+  0xE0, 0x03, 0x1B, 0xC0, 0x00, 0x40, 0x17, 0xE0, 0x07, 0x00, 0x40, 0x1B,
+  0xE0, 0x07, 0x13, 0xE0, 0x17, 0x00, 0x40, 0x33, 0xE0, 0x13, 0x00, 0xC0,
+  0x3F, 0xE0, 0x07, 0x23, 0xE0, 0x07, 0x17, 0xC0, 0x0F, 0xC0, 0x00, 0xC0,
+  0x2F, 0xC0, 0x0F, 0xE0, 0x03, 0x00, 0xC0, 0x1B, 0x40, 0x00, 0x40, 0x17,
+  0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00,
+  0x40, 0x0B, 0xC0, 0x00, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x0B, 0x0F, 0x40,
+  0x17, 0x40, 0x00, 0xC0, 0x1B, 0x40, 0x00, 0x40, 0x0F, 0x40, 0x00, 0xC0,
+  0x0B, 0xC0, 0x07, 0x40, 0x00, 0xC0, 0x0B, 0x40, 0x07, 0xE0, 0x17, 0x00,
+  0xE0, 0x0B, 0x2F, 0xE0, 0x03, 0x13, 0xC0, 0x00, 0x40, 0x47, 0xE0, 0x0B,
+  0x0B, 0xE0, 0x13, 0x00, 0x40, 0x33, 0x40, 0x00, 0xE0, 0x0B, 0x23, 0x40,
+  0x17, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x23, 0xE0, 0x03, 0x17, 0xC0, 0x00,
+  0xE0, 0x17, 0x1F, 0x40, 0x00, 0xC0, 0x23, 0x40, 0x0B, 0xC0, 0x00, 0xC0,
+  0x13, 0x40, 0x00, 0xE0, 0x0F, 0x13, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x07,
+  0x1F, 0x40, 0x0F, 0xE0, 0x0F, 0x17, 0x40, 0x00, 0xE0, 0x03, 0x1B, 0xC0,
+  0x00, 0x40, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x17, 0xC0, 0x0F, 0x40, 0x0B,
+  0x40, 0x00, 0xE0, 0x07, 0x0F, 0x40, 0x00, 0xC0, 0x13, 0xE0, 0x07, 0x00,
+  0xE0, 0x13, 0x1B, 0x40, 0x00, 0x40, 0x1F, 0x40, 0x00, 0x40, 0x0B, 0xE0,
+  0x03, 0x00, 0x40, 0x13, 0xE0, 0x1B, 0x00, 0x40, 0x33, 0xE0, 0x0F, 0x27,
+  0x40, 0x1B, 0xE0, 0x33, 0x00, 0x40, 0x57, 0xE0, 0x13, 0x3F, 0xE0, 0x1B,
+  0x1F, 0x40, 0x00, 0xE0, 0x0B, 0x43, 0x40, 0x17, 0xE0, 0x03, 0x00, 0xE0,
+  0x07, 0x23, 0xC0, 0x1B, 0xC0, 0x17, 0xC0, 0x0F, 0xC0, 0x00, 0xE0, 0x03,
+  0x17, 0x40, 0x0B, 0xC0, 0x17, 0xC0, 0x00, 0xC0, 0x13, 0xE0, 0x03, 0x07,
+  0xE0, 0x03, 0x00, 0x40, 0x27, 0x40, 0x0F, 0xC0, 0x07, 0xE0, 0x07, 0x00,
+  0xC0, 0x17, 0xC0, 0x07, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B,
+  0x40, 0x00, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0x0F, 0x40, 0x00, 0xC0, 0x0F,
+  0xE0, 0x03, 0x00, 0x40, 0x17, 0x40, 0x00, 0xE0, 0x0B, 0x13, 0xE0, 0x03,
+  0x00, 0xC0, 0x1F, 0xE0, 0x0B, 0x13, 0xE0, 0x0F, 0x00, 0x40, 0x2B, 0x40,
+  0x1B, 0x40, 0x07, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x13, 0x40, 0x0F, 0xE0,
+  0x03, 0x00, 0xC0, 0x2B, 0x40, 0x13, 0xC0, 0x0B, 0xE0, 0x03, 0x00, 0x40,
+  0x17, 0xC0, 0x00, 0xE0, 0x03, 0x17, 0xC0, 0x00, 0xE0, 0x13, 0x1B, 0xC0,
+  0x00, 0x40, 0x23, 0xC0, 0x0B, 0xE0, 0x0B, 0x00, 0x40, 0x1F, 0xC0, 0x00,
+  0xE0, 0x07, 0x1F, 0xE0, 0x07, 0x17, 0xC0, 0x0F, 0xC0, 0x00, 0xC0, 0x2F,
+  0x40, 0x0F, 0x40, 0x0B, 0x40, 0x07, 0xE0, 0x03, 0x00, 0xC0, 0x13, 0xE0,
+  0x03, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x2B, 0xE0, 0x07, 0x0F, 0x40, 0x00,
+  0xC0, 0x13, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0xC0, 0x17, 0xC0, 0x00, 0xE0,
+  0x03, 0x1B, 0x40, 0x00, 0xE0, 0x0F, 0x17, 0x40, 0x00, 0xE0, 0x0B, 0x1B,
+  0xC0, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x2B, 0x40, 0x00, 0xE0, 0x0B, 0x13,
+  0xE0, 0x0F, 0x00, 0x40, 0x2B, 0xC0, 0x1B, 0x40, 0x0B, 0x40, 0x00, 0xE0,
+  0x07, 0x0F, 0xC0, 0x00, 0xE0, 0x0B, 0x17, 0xE0, 0x13, 0x13, 0xE0, 0x03,
+  0x00, 0xC0, 0x43, 0x40, 0x00, 0xE0, 0x03, 0x17, 0x40, 0x00, 0x40, 0x13,
+  0xE0, 0x07, 0x00, 0x40, 0x17, 0xC0, 0x00, 0xE0, 0x07, 0x1B, 0x40, 0x00,
+  0xC0, 0x1B, 0xE0, 0x03, 0x00, 0x40, 0x17, 0x40, 0x00, 0xE0, 0x0B, 0x13,
+  0x40, 0x00, 0xC0, 0x17, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0x13, 0xE0, 0x03,
+  0x0B, 0x40, 0x00, 0xE0, 0x03, 0x0F, 0x40, 0x0B, 0x40, 0x13, 0x40, 0x00,
+  0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0xC0, 0x00,
+  0x40, 0x0F, 0x40, 0x00, 0xE0, 0x07, 0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x0F,
+  0x1B, 0xC0, 0x17, 0x40, 0x00, 0xE0, 0x03, 0x2F, 0xC0, 0x00, 0x40, 0x17,
+  0x40, 0x00, 0xE0, 0x07, 0x0F, 0x40, 0x00, 0xE0, 0x0B, 0x13, 0x40, 0x00,
+  0xC0, 0x17, 0xE0, 0x17, 0x00, 0xE0, 0x13, 0x2B, 0x40, 0x1B, 0xE0, 0x17,
+  0x00, 0xE0, 0x03, 0x5F, 0x40, 0x2B, 0xE0, 0x03, 0x0F, 0xE0, 0x07, 0x00,
+  0xE0, 0x13, 0x1F, 0x40, 0x1B, 0xC0, 0x00, 0xE0, 0x07, 0x37, 0x40, 0x00,
+  0xC0, 0x1B, 0x40, 0x00, 0x40, 0x0F, 0xE0, 0x1F, 0x00, 0x40, 0x2F, 0xE0,
+  0x13, 0x00, 0xC0, 0x47, 0xE0, 0x07, 0x23, 0xE0, 0x07, 0x17, 0xC0, 0x0F,
+  0xC0, 0x00, 0xE0, 0x23, 0x2F, 0xE0, 0x07, 0x2B, 0xC0, 0x00, 0x40, 0x4B,
+  0xC0, 0x0B, 0xC0, 0x00, 0x40, 0x13, 0xE0, 0x03, 0x00, 0xC0, 0x17, 0x40,
+  0x00, 0xC0, 0x17, 0x40, 0x0B, 0x40, 0x00, 0xE0, 0x03, 0x0F, 0x40, 0x0B,
+  0x40, 0x13, 0x40, 0x00, 0xC0, 0x0B, 0x40, 0x07, 0xE0, 0x1B, 0x00, 0x40,
+  0x33, 0xE0, 0x0B, 0x00, 0xC0, 0x3B, 0xE0, 0x0B, 0x1B, 0x40, 0x00, 0xC0,
+  0x1F, 0xE0, 0x37, 0x00, 0x40, 0x4B, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x53,
+  0xE0, 0x07, 0x1B, 0x40, 0x00, 0xE0, 0x03, 0x1F, 0xE0, 0x13, 0x00, 0x40,
+  0x2B, 0xE0, 0x13, 0x00, 0xE0, 0x13, 0x3B, 0x40, 0x00, 0xE0, 0x13, 0x3B,
+  0x40, 0x00, 0xE0, 0x0B, 0x23, 0x40, 0x13, 0xE0, 0x0B, 0x00, 0x40, 0x2F,
+  0x40, 0x00, 0xE0, 0x03, 0x1B, 0x40, 0x0F, 0xC0, 0x00, 0xE0, 0x03, 0x17,
+  0xC0, 0x00, 0xE0, 0x13, 0x1B, 0x40, 0x00, 0x40, 0x1F, 0x40, 0x07, 0x40,
+  0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40,
+  0x00, 0x40, 0x0B, 0xE0, 0x27, 0x00, 0xE0, 0x0B, 0x37, 0x40, 0x13, 0x40,
+  0x00, 0xE0, 0x07, 0x4B, 0x40, 0x13, 0x40, 0x00, 0xC0, 0x17, 0x40, 0x0B,
+  0x40, 0x00, 0xE0, 0x07, 0x0F, 0xE0, 0x0B, 0x00, 0xE0, 0x13, 0x23, 0x40,
+  0x1B, 0xE0, 0x03, 0x33, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x0F, 0x13, 0x40,
+  0x1B, 0x40, 0x00, 0x40, 0x1F, 0x40, 0x07, 0xE0, 0x07, 0x00, 0x40, 0x17,
+  0x40, 0x00, 0xE0, 0x07, 0x17, 0xC0, 0x00, 0x40, 0x1B, 0x40, 0x00, 0xC0,
+  0x0F, 0xE0, 0xBB, 0x00, 0x40, 0xCF, 0xC0, 0x00, 0xE0, 0x1B, 0xCF, 0xC0,
+  0x2B, 0x40, 0x00, 0xE0, 0x03, 0x2F, 0x40, 0x0F, 0xE0, 0x03, 0x00, 0xE0,
+  0x0B, 0x1B, 0xC0, 0x13, 0xC0, 0x27, 0x40, 0x0F, 0xE0, 0x27, 0x0B, 0xC0,
+  0x00, 0xC0, 0x37, 0x40, 0x00, 0xC0, 0x13, 0xE0, 0x07, 0x00, 0xE0, 0x03,
+  0x1B, 0xE0, 0x0F, 0x0B, 0xC0, 0x00, 0x40, 0x1F, 0xE0, 0x03, 0x00, 0xC0,
+  0x17, 0xE0, 0x03, 0x00, 0xC0, 0x1F, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x00,
+  0xE0, 0x13, 0x1F, 0xE0, 0x13, 0x1B, 0xE0, 0x1B, 0x00, 0x40, 0x3F, 0xC0,
+  0x27, 0xE0, 0x03, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x17, 0x40, 0x00, 0xE0,
+  0x0B, 0x13, 0xE0, 0x23, 0x00, 0xE0, 0x03, 0x3F, 0xC0, 0x00, 0xE0, 0x0B,
+  0x3F, 0xE0, 0x13, 0x1B, 0x40, 0x00, 0xE0, 0x07, 0x1F, 0xE0, 0x0B, 0x0F,
+  0x40, 0x27, 0x40, 0x00, 0x40, 0x1B, 0x40, 0x07, 0x40, 0x00, 0xE0, 0x07,
+  0x0B, 0x40, 0x00, 0x40, 0x17, 0xC0, 0x00, 0x40, 0x0F, 0xC0, 0x00, 0x40,
+  0x13, 0xC0, 0x0B, 0xE0, 0x07, 0x00, 0x40, 0x1B, 0xE0, 0x03, 0x00, 0xC0,
+  0x1F, 0xE0, 0x07, 0x13, 0xE0, 0x03, 0x0F, 0xE0, 0x03, 0x00, 0xC0, 0x2F,
+  0xC0, 0x00, 0xC0, 0x1B, 0xC0, 0x0F, 0xE0, 0x0B, 0x00, 0xE0, 0x0B, 0x23,
+  0xE0, 0x0B, 0x13, 0xC0, 0x00, 0xE0, 0x13, 0x1B, 0xC0, 0x00, 0xE0, 0x07,
+  0x23, 0xE0, 0x07, 0x0F, 0x40, 0x00, 0xC0, 0x13, 0xC0, 0x00, 0x40, 0x13,
+  0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x2B, 0x00, 0xE0, 0x17, 0x3F, 0x40, 0x1F,
+  0xE0, 0x03, 0x00, 0xC0, 0x63, 0xE0, 0x03, 0x13, 0x40, 0x00, 0xE0, 0x07,
+  0x17, 0xE0, 0x0F, 0x0F, 0xC0, 0x00, 0xE0, 0x07, 0x33, 0xE0, 0x0F, 0x17,
+  0xE0, 0x47, 0x00, 0xE0, 0x03, 0x67, 0xE0, 0x0B, 0x00, 0xE0, 0x0B, 0x1F,
+  0xC0, 0x13, 0xE0, 0x0B, 0x00, 0x40, 0x43, 0xE0, 0x0B, 0x17, 0xC0, 0x00,
+  0xE0, 0x03, 0x1F, 0x40, 0x0B, 0xE0, 0x0B, 0x00, 0xC0, 0x2B, 0xE0, 0x0F,
+  0x00, 0x40, 0x33, 0xE0, 0x13, 0x1B, 0x40, 0x00, 0xE0, 0x13, 0x1F, 0xE0,
+  0x0B, 0x1B, 0x40, 0x33, 0xE0, 0x07, 0x00, 0xE0, 0x1B, 0x27, 0xC0, 0x23,
+  0xE0, 0x0F, 0x3B, 0xC0, 0x17, 0xE0, 0x1B, 0x27, 0xE0, 0x03, 0x23, 0xE0,
+  0x0F, 0x0B, 0xE0, 0x47, 0x00, 0xE0, 0x03, 0x67, 0xE0, 0x03, 0x00, 0xC0,
+  0x17, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x23, 0xC0, 0x00, 0xC0, 0x23, 0xC0,
+  0x0F, 0x40, 0x00, 0xE0, 0x0B, 0x13, 0xC0, 0x00, 0xE0, 0x13, 0x1B, 0xC0,
+  0x00, 0xE0, 0x07, 0x23, 0xE0, 0x03, 0x0F, 0xC0, 0x0B, 0xE0, 0x0F, 0x00,
+  0xE0, 0x07, 0x43, 0xC0, 0x00, 0xE0, 0x0B, 0x17, 0xC0, 0x13, 0xE0, 0x13,
+  0x00, 0xC0, 0x3F, 0x40, 0x00, 0xC0, 0x27, 0x40, 0x0B, 0xE0, 0x0B, 0x00,
+  0xC0, 0x1F, 0xE0, 0x1F, 0x00, 0xC0, 0x43, 0x40, 0x2F, 0xE0, 0x03, 0x0B,
+  0x40, 0x00, 0xC0, 0x0F, 0x40, 0x00, 0x40, 0x0F, 0xC0, 0x00, 0xE0, 0x07,
+  0x0F, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0xE0, 0x03, 0x00, 0xC0, 0x1B, 0xE0,
+  0x0B, 0x13, 0x40, 0x00, 0xC0, 0x17, 0x40, 0x0B, 0xE0, 0x07, 0x00, 0xC0,
+  0x1B, 0xC0, 0x00, 0xE0, 0x07, 0x1F, 0x40, 0x00, 0xE0, 0x2B, 0x1B, 0xC0,
+  0x33, 0xE0, 0x0B, 0x00, 0x40, 0x53, 0xC0, 0x00, 0x40, 0x1F, 0xE0, 0x0F,
+  0x0B, 0xE0, 0x13, 0x00, 0xC0, 0x33, 0x40, 0x00, 0xC0, 0x27, 0x40, 0x0B,
+  0xC0, 0x00, 0x40, 0x13, 0xC0, 0x0B, 0xE0, 0x23, 0x00, 0xE0, 0x07, 0x37,
+  0x40, 0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x4B, 0xC0, 0x17, 0xC0, 0x13,
+  0xE0, 0x07, 0x0F, 0xC0, 0x00, 0xE0, 0x03, 0x17, 0xC0, 0x0B, 0xC0, 0x00,
+  0xE0, 0x0B, 0x23, 0x40, 0x00, 0x40, 0x1F, 0x40, 0x07, 0xE0, 0x0B, 0x00,
+  0xE0, 0x03, 0x1B, 0xE0, 0x0F, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x23, 0x40,
+  0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0x40, 0x00, 0xE0,
+  0x03, 0x13, 0xE0, 0xFF, 0x04, 0x00, 0x41, 0x1B, 0x40, 0x00, 0xE1, 0x47,
+  0x13, 0x40, 0x53, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x5F, 0xE0, 0x0B, 0x17,
+  0xE0, 0x0F, 0x13, 0xC0, 0x37, 0x40, 0x1F, 0xC0, 0x0B, 0xE0, 0xFF, 0x18,
+  0x00, 0xE1, 0x1B, 0x2B, 0xC0, 0x23, 0xC0, 0x07, 0xE0, 0x07, 0x00, 0xC0,
+  0x17, 0xC0, 0x07, 0xE0, 0x0B, 0x00, 0xE0, 0x13, 0x1B, 0xE0, 0x1B, 0x00,
+  0x40, 0x3F, 0x40, 0x00, 0xE0, 0x0B, 0x2B, 0xE0, 0x0F, 0x17, 0xE0, 0x03,
+  0x00, 0x40, 0x23, 0x40, 0x00, 0xE0, 0x03, 0x13, 0x40, 0x00, 0x40, 0x13,
+  0x40, 0x00, 0x40, 0x0B, 0xE0, 0xBB, 0x00, 0xE0, 0x27, 0xCB, 0xE0, 0x1B,
+  0x2F, 0xC0, 0x23, 0xC0, 0x07, 0xE0, 0x07, 0x00, 0xC0, 0x17, 0xC0, 0x07,
+  0xE0, 0x07, 0x00, 0x40, 0x17, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x1F, 0x40,
+  0x17, 0xE0, 0x03, 0x0F, 0x40, 0x00, 0xE0, 0x07, 0x13, 0xE0, 0x03, 0x0F,
+  0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x0B, 0x13, 0xE0, 0x03, 0x00, 0xE0,
+  0x17, 0x1F, 0x40, 0x00, 0xE0, 0x13, 0x23, 0xE0, 0x07, 0x1B, 0xE0, 0x07,
+  0x0F, 0x40, 0x00, 0xE0, 0x0B, 0x13, 0xE0, 0x67, 0x00, 0xE0, 0x2B, 0x83,
+  0xE0, 0x17, 0x33, 0xC0, 0x1F, 0xC0, 0x07, 0xE0, 0x07, 0x00, 0x40, 0x17,
+  0xE0, 0x07, 0x00, 0xE0, 0x03, 0x23, 0x40, 0x1B, 0xE0, 0x03, 0x0F, 0xE0,
+  0x07, 0x00, 0xE0, 0x07, 0x1F, 0xE0, 0x07, 0x0F, 0xC0, 0x00, 0x40, 0x17,
+  0x40, 0x00, 0xC0, 0x0F, 0xC0, 0x00, 0xE0, 0x0B, 0x13, 0xE0, 0x03, 0x00,
+  0xE0, 0x17, 0x1F, 0xE0, 0x03, 0x00, 0xE0, 0x13, 0x2B, 0xC0, 0x1B, 0xC0,
+  0x07, 0xE0, 0x07, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x63, 0x00, 0xE0, 0x2B,
+  0x83, 0xE0, 0x2B, 0x33, 0xE0, 0x07, 0x00, 0xC0, 0x43, 0xC0, 0x07, 0xE0,
+  0x07, 0x00, 0x40, 0x17, 0xC0, 0x00, 0xE0, 0x07, 0x1B, 0xE0, 0x03, 0x00,
+  0x40, 0x23, 0xE0, 0x03, 0x0F, 0xC0, 0x00, 0x40, 0x17, 0xC0, 0x00, 0x40,
+  0x13, 0x40, 0x0B, 0x40, 0x07, 0xE0, 0x1B, 0x00, 0xE0, 0x37, 0x2B, 0x40,
+  0x3F, 0xE0, 0x0F, 0x00, 0x40, 0x7F, 0xE0, 0x0B, 0x1B, 0x40, 0x17, 0xE0,
+  0x1F, 0x00, 0xE0, 0x37, 0x3F, 0xC0, 0x00, 0x40, 0x47, 0xC0, 0x0B, 0xE0,
+  0x23, 0x00, 0xE0, 0x2F, 0x37, 0xC0, 0x00, 0x40, 0x3F, 0xE0, 0x07, 0x00,
+  0xC0, 0x1B, 0xE0, 0x0B, 0x00, 0x40, 0x2B, 0xE0, 0x2F, 0x17, 0x40, 0x3B,
+  0x40, 0x00, 0xE0, 0x0B, 0x3F, 0xE0, 0x0F, 0x00, 0xE0, 0x23, 0x2F, 0xE0,
+  0x13, 0x2B, 0xC0, 0x1B, 0xC0, 0x07, 0xE0, 0x07, 0x00, 0xE0, 0x0F, 0x17,
+  0xE0, 0x5B, 0x00, 0xE0, 0x73, 0x7B, 0x40, 0x00, 0xC0, 0x7F, 0xC0, 0x07,
+  0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x1B, 0xC0,
+  0x00, 0x40, 0x1F, 0xC0, 0x0B, 0x40, 0x00, 0xE0, 0x03, 0x0F, 0xE0, 0x03,
+  0x0B, 0x40, 0x00, 0xE0, 0x07, 0x0F, 0xE0, 0x1B, 0x00, 0xE0, 0x1B, 0x33,
+  0xE0, 0x13, 0x23, 0xE0, 0x07, 0x1B, 0xE0, 0x07, 0x0F, 0x40, 0x00, 0xE0,
+  0x0B, 0x13, 0x40, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x1F, 0x00, 0xE0, 0x1B,
+  0x3F, 0xE0, 0x1B, 0x23, 0xE0, 0x0F, 0x00, 0xE0, 0x33, 0x3B, 0xC0, 0x00,
+  0xC0, 0x43, 0xC0, 0x07, 0xE0, 0x0B, 0x00, 0xE0, 0x0F, 0x1B, 0xE0, 0x0B,
+  0x17, 0xE0, 0x07, 0x13, 0x40, 0x0F, 0xC0, 0x00, 0x40, 0x5B, 0x40, 0x0B,
+  0x40, 0x07, 0xE0, 0x23, 0x00, 0x40, 0x33, 0x40, 0x00, 0xE0, 0x07, 0x33,
+  0x40, 0x13, 0x40, 0x00, 0xE0, 0x07, 0x17, 0xE0, 0x3F, 0x00, 0xE0, 0x37,
+  0x5B, 0xE0, 0x17, 0x3F, 0xE0, 0x17, 0x1F, 0xE0, 0xFF, 0x78, 0x00, 0xE1,
+  0x7B, 0x9F, 0x40, 0x83, 0xC0, 0x00, 0xE2, 0x0F, 0x0F, 0x40, 0x1F, 0xE0,
+  0x13, 0x1B, 0xC0, 0x00, 0xE0, 0x0B, 0x23, 0xC0, 0x1B, 0x40, 0x00, 0xE0,
+  0x0B, 0x1F, 0xC0, 0x00, 0x40, 0x1F, 0x40, 0x00, 0xC0, 0x0F, 0x40, 0x00,
+  0x40, 0x0F, 0xE0, 0x07, 0x00, 0x40, 0x17, 0xE0, 0x07, 0x00, 0xC0, 0x23,
+  0xE0, 0x0F, 0x17, 0xE0, 0x03, 0x00, 0xE0, 0x13, 0x23, 0xE0, 0x07, 0x1B,
+  0x40, 0x00, 0xE0, 0x13, 0x3B, 0xE0, 0x43, 0x00, 0x40, 0x67, 0xE0, 0x27,
+  0x4F, 0xE0, 0x1B, 0x33, 0x40, 0x23, 0xC0, 0x00, 0xE0, 0x07, 0x5F, 0x40,
+  0x17, 0xE0, 0x03, 0x13, 0xE0, 0x07, 0x0F, 0x40, 0x00, 0x40, 0x13, 0x40,
+  0x00, 0x40, 0x0B, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x17, 0xE0, 0x27, 0x0F,
+  0xC0, 0x00, 0xC0, 0x37, 0xC0, 0x07, 0xC0, 0x00, 0xE0, 0x07, 0x0F, 0xE0,
+  0x0B, 0x00, 0xE0, 0x13, 0x23, 0xE0, 0x07, 0x1B, 0xE0, 0x57, 0x0F, 0xE0,
+  0x07, 0x00, 0xE0, 0x07, 0x6F, 0xE0, 0x0F, 0x00, 0xE0, 0x1F, 0x27, 0xE0,
+  0x0B, 0x00, 0xE0, 0x13, 0x3B, 0xE0, 0x07, 0x1B, 0xE0, 0x13, 0x0F, 0x40,
+  0x1B, 0x40, 0x00, 0xE0, 0x27, 0x63, 0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x3F,
+  0xC0, 0x00, 0xE0, 0x0B, 0x1F, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x0B, 0x40,
+  0x00, 0x40, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x03, 0x00, 0x40,
+  0x1B, 0xE0, 0x03, 0x0F, 0xE0, 0x17, 0x00, 0xE0, 0x07, 0x2F, 0xE0, 0x47,
+  0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x5F, 0xE0, 0x0B, 0x00, 0xE0, 0x13,
+  0x23, 0x40, 0x1B, 0xE0, 0x07, 0x00, 0xE0, 0x27, 0x43, 0xE0, 0x03, 0x00,
+  0x40, 0x4B, 0xE0, 0x0B, 0x0F, 0xC0, 0x17, 0xC0, 0x07, 0xE0, 0x07, 0x00,
+  0xE0, 0x0F, 0x17, 0xC0, 0x00, 0x40, 0x1F, 0x40, 0x00, 0xC0, 0x0F, 0xE0,
+  0x07, 0x00, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x0B, 0x17, 0xE0, 0x03, 0x13,
+  0xE0, 0x0B, 0x23, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x1F, 0x40, 0x0F, 0xE0,
+  0x03, 0x00, 0xE0, 0x03, 0x2B, 0xE0, 0x07, 0x00, 0x40, 0x27, 0xE0, 0x07,
+  0x13, 0x40, 0x00, 0x40, 0x17, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x07, 0x00,
+  0xC0, 0x1B, 0xC0, 0x00, 0xE0, 0x07, 0x1F, 0xE0, 0x33, 0x00, 0x40, 0x53,
+  0xE0, 0x33, 0x3F, 0xE0, 0x03, 0x00, 0xE0, 0x17, 0x4B, 0xE0, 0x0B, 0x1F,
+  0x40, 0x13, 0x40, 0x00, 0xC0, 0x47, 0xE0, 0x03, 0x0B, 0xE0, 0x03, 0x00,
+  0xE0, 0x0F, 0x17, 0x40, 0x00, 0xE0, 0x13, 0x1B, 0xE0, 0x07, 0x00, 0xE0,
+  0x07, 0x2B, 0x40, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x33, 0xE0, 0x03,
+  0x00, 0x40, 0x2B, 0xE0, 0x23, 0x0F, 0xC0, 0x00, 0xE0, 0x07, 0x37, 0xC0,
+  0x00, 0xE0, 0x07, 0x17, 0xE0, 0x07, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x17,
+  0x1F, 0xE0, 0x2B, 0x00, 0xE0, 0x3B, 0x53, 0xE0, 0x17, 0x43, 0xE0, 0x0F,
+  0x1F, 0xE0, 0x07, 0x17, 0xE0, 0x07, 0x0F, 0xC0, 0x00, 0xE0, 0x1F, 0x17,
+  0xE0, 0x07, 0x27, 0xE0, 0x17, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x17, 0x2F,
+  0xE0, 0x27, 0x1F, 0xC0, 0x00, 0xE0, 0x07, 0x37, 0xC0, 0x00, 0xE0, 0x07,
+  0x17, 0xE0, 0x07, 0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x0B, 0x1B, 0xE0, 0x0B,
+  0x13, 0xE0, 0x03, 0x00, 0xE0, 0x17, 0x1F, 0xC0, 0x00, 0xE0, 0x0F, 0x27,
+  0x40, 0x17, 0xE0, 0x07, 0x00, 0xC0, 0x33, 0xC0, 0x00, 0x40, 0x1F, 0xC0,
+  0x0B, 0xE0, 0x2B, 0x00, 0x40, 0x3F, 0xC0, 0x00, 0xE0, 0x07, 0x3F, 0xC0,
+  0x17, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x23, 0xE0, 0x03, 0x17, 0xC0, 0x00,
+  0xE0, 0x03, 0x1F, 0x40, 0x00, 0xC0, 0x17, 0x40, 0x00, 0x40, 0x0F, 0xE0,
+  0x13, 0x00, 0xE0, 0x0B, 0x23, 0x40, 0x13, 0xC0, 0x00, 0xE0, 0x0B, 0x3B,
+  0xC0, 0x1B, 0x40, 0x00, 0xE0, 0x0B, 0x1F, 0x40, 0x00, 0xE0, 0x17, 0x1B,
+  0xC0, 0x00, 0x40, 0x2B, 0xE0, 0x07, 0x00, 0xE0, 0x17, 0x1B, 0xE0, 0x07,
+  0x2F, 0xE0, 0x03, 0x00, 0x40, 0x3B, 0xE0, 0x03, 0x0F, 0xE0, 0x13, 0x00,
+  0xE0, 0x23, 0x2B, 0xC0, 0x00, 0xE0, 0x1F, 0x33, 0xE0, 0x1F, 0x27, 0xE0,
+  0xFF, 0x48, 0x00, 0xE1, 0x9B, 0x77, 0x40, 0xA3, 0xE0, 0x03, 0x00, 0xE2,
+  0x07, 0x03, 0xE0, 0x1F, 0x1B, 0x40, 0x00, 0xE0, 0x07, 0x3B, 0x40, 0x00,
+  0x40, 0x17, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x03, 0x00, 0xC0, 0x17, 0xC0,
+  0x00, 0xE0, 0x03, 0x1B, 0x40, 0x00, 0xC0, 0x17, 0xE0, 0x03, 0x00, 0x40,
+  0x17, 0xC0, 0x00, 0xE0, 0x03, 0x17, 0xC0, 0x00, 0xC0, 0x1B, 0xC0, 0x00,
+  0xC0, 0x17, 0xC0, 0x00, 0xC0, 0x17, 0x40, 0x00, 0x40, 0x13, 0x40, 0x07,
+  0xC0, 0x00, 0xE0, 0x0B, 0x0F, 0xC0, 0x00, 0xC0, 0x23, 0xE0, 0x13, 0x00,
+  0x40, 0x2B, 0xE0, 0x03, 0x1F, 0xE0, 0x27, 0x0F, 0xE0, 0x07, 0x00, 0xE0,
+  0x27, 0x3F, 0xE0, 0x07, 0x2F, 0x40, 0x00, 0x40, 0x13, 0xC0, 0x00, 0x40,
+  0x0F, 0xE0, 0x03, 0x00, 0x40, 0x17, 0xE0, 0x03, 0x0F, 0x40, 0x00, 0xE0,
+  0x03, 0x13, 0xE0, 0x03, 0x0B, 0x40, 0x00, 0xE0, 0x77, 0x0F, 0xE0, 0x07,
+  0x00, 0xE0, 0x07, 0x8F, 0xE0, 0x07, 0x00, 0xE0, 0x27, 0x1F, 0xE0, 0x0B,
+  0x2F, 0xE0, 0x0B, 0x13, 0xE0, 0x0F, 0x00, 0xE0, 0x07, 0x2B, 0xE0, 0x03,
+  0x0F, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x0B, 0x13, 0xE0, 0x03, 0x00,
+  0x40, 0x1F, 0x40, 0x00, 0x40, 0x13, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B,
+  0xC0, 0x00, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x03, 0x0F, 0xC0, 0x0B, 0x40,
+  0x00, 0xE0, 0x03, 0x1B, 0x40, 0x00, 0xE0, 0x0F, 0x0F, 0x40, 0x17, 0x40,
+  0x00, 0xE0, 0x07, 0x23, 0x40, 0x13, 0xE0, 0x07, 0x00, 0x40, 0x23, 0xC0,
+  0x00, 0xE0, 0x13, 0x1B, 0x40, 0x00, 0x40, 0x1F, 0x40, 0x07, 0xE0, 0x0F,
+  0x00, 0xE0, 0x07, 0x1F, 0xE0, 0x0B, 0x0F, 0xC0, 0x00, 0xE0, 0x0B, 0x43,
+  0xC0, 0x1B, 0x40, 0x00, 0xE0, 0x0F, 0x1F, 0xC0, 0x17, 0x40, 0x23, 0x40,
+  0x00, 0xC0, 0x0F, 0x40, 0x00, 0x40, 0x0F, 0xE0, 0x07, 0x00, 0x40, 0x17,
+  0xE0, 0x03, 0x00, 0x40, 0x1F, 0xE0, 0x03, 0x0F, 0xE0, 0x13, 0x00, 0xE0,
+  0x07, 0x2B, 0x40, 0x0F, 0xC0, 0x00, 0xE0, 0x0B, 0x37, 0x40, 0x1B, 0xE0,
+  0x0B, 0x17, 0xC0, 0x00, 0xC0, 0x1F, 0xE0, 0x07, 0x07, 0xC0, 0x00, 0xE0,
+  0x07, 0x17, 0xC0, 0x0F, 0xC0, 0x00, 0xE0, 0x1F, 0x0F, 0x40, 0x27, 0x40,
+  0x00, 0x40, 0x37, 0xC0, 0x07, 0x40, 0x00, 0xE0, 0x03, 0x0B, 0x40, 0x00,
+  0xE0, 0x37, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x27, 0x4F, 0xE0, 0x07, 0x00,
+  0xE0, 0x07, 0x3F, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x1F, 0xE0, 0x27, 0x0F,
+  0x40, 0x00, 0xE0, 0x07, 0x33, 0xE0, 0x13, 0x00, 0xE0, 0x07, 0x2B, 0xE0,
+  0x03, 0x0F, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x0B, 0x13, 0xE0, 0x03,
+  0x00, 0xE0, 0x07, 0x1F, 0xE0, 0x13, 0x0F, 0x40, 0x1B, 0x40, 0x00, 0xE0,
+  0x2B, 0x3F, 0x40, 0x37, 0xE0, 0x03, 0x00, 0xC0, 0x43, 0x40, 0x13, 0xC0,
+  0x0B, 0x40, 0x00, 0xE0, 0x37, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x27, 0x4F,
+  0xE0, 0x07, 0x00, 0xE0, 0x07, 0x3F, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x1F,
+  0xE0, 0x27, 0x0F, 0x40, 0x00, 0xE0, 0x07, 0x33, 0xE0, 0x13, 0x00, 0xE0,
+  0x07, 0x2B, 0xE0, 0x27, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x27, 0x3F, 0xE0,
+  0x37, 0x2F, 0xE0, 0x07, 0x00, 0xE0, 0x37, 0x4F, 0xE0, 0x47, 0x3F, 0xE0,
+  0x07, 0x00, 0xE0, 0x07, 0x5F, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x1F, 0xE0,
+  0x27, 0x0F, 0x40, 0x00, 0xE0, 0x07, 0x33, 0xE0, 0x03, 0x00, 0xE0, 0x07,
+  0x1B, 0xE0, 0x37, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x37, 0x4F, 0xE0, 0x17,
+  0x3F, 0x40, 0x00, 0x40, 0x23, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xC0, 0x00,
+  0x40, 0x17, 0xC0, 0x0B, 0x40, 0x00, 0xE0, 0x0B, 0x0F, 0xE0, 0x03, 0x00,
+  0x40, 0x23, 0xE0, 0x07, 0x00, 0xE0, 0x13, 0x1F, 0xE0, 0x03, 0x1B, 0x40,
+  0x00, 0xE0, 0x13, 0x3B, 0xC0, 0x00, 0xE0, 0x03, 0x23, 0x40, 0x13, 0xE0,
+  0x03, 0x0F, 0xE0, 0x0B, 0x00, 0x40, 0x23, 0xC0, 0x00, 0xE0, 0x07, 0x1F,
+  0x40, 0x17, 0xE0, 0x03, 0x13, 0xE0, 0x0B, 0x0F, 0xC0, 0x00, 0xE0, 0x03,
+  0x27, 0xE0, 0x03, 0x00, 0xC0, 0x1F, 0x40, 0x00, 0xE0, 0x03, 0x17, 0x40,
+  0x00, 0xE0, 0x07, 0x13, 0xE0, 0x0B, 0x0F, 0xE0, 0x07, 0x00, 0x40, 0x37,
+  0xC0, 0x00, 0x40, 0x1B, 0xC0, 0x0B, 0x40, 0x00, 0xE0, 0x27, 0x0F, 0x40,
+  0x00, 0x40, 0x33, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0xFF, 0xFF, 0x05, 0x00,
+  0xC2, 0x17, 0xC0, 0x00, 0xE2, 0x0B, 0x1B, 0xC0, 0x1B, 0x40, 0x00, 0xE0,
+  0x07, 0x1F, 0x40, 0x13, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x1F, 0x40, 0x00,
+  0xE0, 0x03, 0x1F, 0x40, 0x00, 0x40, 0x13, 0xC0, 0x00, 0x40, 0x0F, 0xE0,
+  0x07, 0x00, 0xC0, 0x1B, 0x40, 0x00, 0x40, 0x1B, 0x40, 0x07, 0xC0, 0x00,
+  0xE0, 0x8B, 0x0F, 0xE0, 0x07, 0x00, 0xC0, 0xAB, 0x40, 0x00, 0xE0, 0x03,
+  0x1B, 0x40, 0x0F, 0xE0, 0x07, 0x00, 0x40, 0x1F, 0xE0, 0x07, 0x13, 0xE0,
+  0x03, 0x00, 0x40, 0x1F, 0xC0, 0x00, 0xE0, 0x03, 0x17, 0xE0, 0x07, 0x00,
+  0x40, 0x23, 0xE0, 0x07, 0x13, 0xE0, 0x1B, 0x00, 0xE0, 0x07, 0x37, 0xE0,
+  0x57, 0x0F, 0xE0, 0x0F, 0x00, 0xE0, 0x07, 0x77, 0xC0, 0x00, 0xE0, 0x07,
+  0x17, 0xE0, 0x47, 0x0F, 0x40, 0x00, 0xC0, 0x53, 0xC0, 0x07, 0xE0, 0x07,
+  0x00, 0xC0, 0x17, 0xC0, 0x07, 0xE0, 0x13, 0x00, 0xE0, 0x07, 0x23, 0xE0,
+  0x07, 0x0F, 0xE0, 0x0B, 0x00, 0xE0, 0x37, 0x23, 0xC0, 0x3F, 0xC0, 0x07,
+  0xE0, 0x23, 0x00, 0x40, 0x33, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x3B, 0x40,
+  0x1B, 0xE0, 0x03, 0x13, 0xE0, 0x0B, 0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x03,
+  0x2B, 0xC0, 0x00, 0xE0, 0x17, 0x1F, 0x40, 0x00, 0x40, 0x23, 0x40, 0x07,
+  0xE0, 0x07, 0x00, 0xE0, 0x07, 0x17, 0xE0, 0x47, 0x0F, 0xC0, 0x00, 0xE0,
+  0x07, 0x57, 0xE0, 0x07, 0x00, 0xE0, 0x17, 0x1F, 0x40, 0x00, 0xE0, 0x0B,
+  0x23, 0xE0, 0x0B, 0x13, 0xE0, 0x07, 0x00, 0xE0, 0x33, 0x23, 0xE0, 0x07,
+  0x3B, 0xE0, 0x07, 0x0F, 0xE0, 0x17, 0x00, 0xE0, 0x17, 0x2F, 0xE0, 0x07,
+  0x1F, 0xE0, 0x27, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x3F, 0xC0, 0x00,
+  0xE0, 0x1F, 0x17, 0xE0, 0x07, 0x27, 0xE0, 0x37, 0x0F, 0x40, 0x00, 0xC0,
+  0x43, 0xC0, 0x07, 0xE0, 0x0B, 0x00, 0xE0, 0x13, 0x1B, 0x40, 0x00, 0xE0,
+  0x0F, 0x1F, 0xE0, 0x0F, 0x17, 0xE0, 0x07, 0x00, 0xE0, 0x17, 0x27, 0xE0,
+  0x17, 0x1F, 0xE0, 0x2F, 0x00, 0xE0, 0x17, 0x57, 0xE0, 0x07, 0x1F, 0xE0,
+  0x27, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x3F, 0xC0, 0x00, 0xE0, 0x1F,
+  0x17, 0xE0, 0x0B, 0x27, 0xC0, 0x13, 0xC0, 0x07, 0xE0, 0x03, 0x00, 0xC0,
+  0x13, 0xE0, 0x07, 0x07, 0xC0, 0x00, 0xC0, 0x17, 0xC0, 0x00, 0xE0, 0x07,
+  0x0F, 0xC0, 0x00, 0xE0, 0x0F, 0x17, 0x40, 0x00, 0xE0, 0x2F, 0x1B, 0xE0,
+  0x07, 0x00, 0xE0, 0x3F, 0x47, 0xE0, 0x23, 0x00, 0xE0, 0x13, 0x73, 0x40,
+  0x00, 0xE0, 0x03, 0x1F, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x07, 0x13,
+  0xE0, 0x27, 0x0F, 0xC0, 0x00, 0xE0, 0x07, 0x37, 0xC0, 0x00, 0xE0, 0x07,
+  0x17, 0xE0, 0x07, 0x0F, 0x40, 0x00, 0xC0, 0x13, 0xC0, 0x07, 0xE0, 0x03,
+  0x00, 0x40, 0x13, 0x40, 0x00, 0x40, 0x13, 0x40, 0x07, 0x40, 0x00, 0x40,
+  0x0B, 0xC0, 0x00, 0xE0, 0x17, 0x0F, 0xC0, 0x00, 0xE0, 0x07, 0x27, 0xC0,
+  0x00, 0xE0, 0x0F, 0x17, 0xC0, 0x00, 0xE0, 0x17, 0x1F, 0xE0, 0x03, 0x00,
+  0xE0, 0x13, 0x2B, 0xE0, 0x13, 0x1B, 0xE0, 0x33, 0x00, 0xE0, 0x1B, 0x57,
+  0x40, 0x23, 0x40, 0x00, 0x40, 0x67, 0xC0, 0x07, 0xC0, 0x00, 0xE0, 0x17,
+  0x0F, 0x40, 0x00, 0x40, 0x23, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x0B, 0x00,
+  0x40, 0x1F, 0xE0, 0x0B, 0x17, 0x40, 0x00, 0x40, 0x1B, 0xC0, 0x00, 0x40,
+  0x0F, 0xE0, 0x0B, 0x00, 0x40, 0x1F, 0xE0, 0x1B, 0x17, 0xE0, 0x07, 0x27,
+  0xE0, 0x17, 0x0F, 0xC0, 0x00, 0xE0, 0x07, 0x27, 0xC0, 0x00, 0x40, 0x17,
+  0xE0, 0x07, 0x00, 0xC0, 0x1B, 0x40, 0x00, 0xE0, 0x03, 0x1B, 0x40, 0x0F,
+  0xE0, 0x17, 0x00, 0x40, 0x2F, 0xE0, 0x03, 0x23, 0x40, 0x0F, 0xC0, 0x00,
+  0xE0, 0x03, 0x17, 0xE0, 0xFF, 0xFF, 0x21, 0x00, 0xC2, 0x3B, 0xE0, 0x03,
+  0x00, 0xE2, 0x03, 0x3B, 0x40, 0x17, 0xE0, 0x03, 0x0F, 0xE0, 0x27, 0x00,
+  0xE0, 0x37, 0x3F, 0xE0, 0x07, 0x00, 0xE0, 0x2F, 0x4F, 0x40, 0x37, 0x40,
+  0x00, 0xE0, 0x07, 0x4F, 0xE0, 0x17, 0x00, 0xE0, 0x17, 0x33, 0xE0, 0x17,
+  0x1F, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x2F, 0xE0, 0x07, 0x0F, 0xE0, 0x07,
+  0x00, 0xE0, 0x17, 0x1F, 0xE0, 0x57, 0x00, 0xE0, 0x37, 0x7F, 0xE0, 0x37,
+  0x3F, 0xE0, 0x07, 0x00, 0xE0, 0x2B, 0x4F, 0xE0, 0x2B, 0x33, 0xC0, 0x00,
+  0xE0, 0x33, 0x3B, 0xE0, 0x1B, 0x00, 0xE0, 0x17, 0x5F, 0xE0, 0x17, 0x1F,
+  0xE0, 0x5B, 0x00, 0xE0, 0x17, 0x83, 0x40, 0x1F, 0xC0, 0x00, 0xE0, 0x07,
+  0x8F, 0x40, 0x17, 0x40, 0x13, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0,
+  0x07, 0x00, 0x40, 0x17, 0xC0, 0x00, 0xE0, 0x07, 0x1B, 0x40, 0x00, 0xE0,
+  0x03, 0x1B, 0x40, 0x0B, 0x40, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xC0,
+  0x00, 0xE0, 0x03, 0x17, 0x40, 0x00, 0xC0, 0x17, 0xC0, 0x00, 0x40, 0x13,
+  0xE0, 0x07, 0x00, 0xC0, 0x1B, 0xC0, 0x00, 0xE0, 0x03, 0x1F, 0x40, 0x13,
+  0x40, 0x0F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0xE0,
+  0x0B, 0x13, 0xE0, 0x13, 0x00, 0xE0, 0x07, 0x2F, 0xE0, 0x03, 0x0F, 0xE0,
+  0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x0B, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x1F,
+  0x40, 0x00, 0x40, 0x13, 0xC0, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0,
+  0x03, 0x00, 0xE0, 0x03, 0x1B, 0xC0, 0x00, 0xE0, 0x17, 0x1F, 0xE0, 0x23,
+  0x00, 0x40, 0x4B, 0xE0, 0x03, 0x2F, 0x40, 0x0F, 0x40, 0x00, 0xC0, 0x13,
+  0xE0, 0x03, 0x0B, 0x40, 0x00, 0xE0, 0x23, 0x0F, 0x40, 0x2B, 0x40, 0x00,
+  0x40, 0x37, 0xC0, 0x00, 0xE0, 0x17, 0x0F, 0x40, 0x00, 0xE0, 0x07, 0x23,
+  0xE0, 0x03, 0x00, 0xE0, 0x07, 0x1B, 0xE0, 0x0B, 0x0F, 0x40, 0x00, 0xC0,
+  0x33, 0xE0, 0x03, 0x0B, 0x40, 0x00, 0xE0, 0x07, 0x0F, 0xE0, 0x17, 0x00,
+  0xE0, 0x07, 0x2F, 0xC0, 0x0F, 0xC0, 0x07, 0xE0, 0x07, 0x00, 0xE0, 0x0F,
+  0x17, 0xC0, 0x00, 0xC0, 0x1F, 0xE0, 0x07, 0x07, 0xC0, 0x00, 0xC0, 0x17,
+  0xC0, 0x00, 0xE0, 0x27, 0x0F, 0xE0, 0x1B, 0x00, 0x40, 0x53, 0xE0, 0x03,
+  0x00, 0xE0, 0x03, 0x33, 0x40, 0x17, 0xE0, 0x23, 0x0F, 0xE0, 0x07, 0x00,
+  0xE0, 0x1B, 0x3F, 0xE0, 0x07, 0x00, 0xE0, 0x17, 0x43, 0xE0, 0x03, 0x00,
+  0x40, 0x3B, 0xE0, 0x43, 0x0F, 0xE0, 0x17, 0x00, 0xE0, 0x0B, 0x6F, 0x40,
+  0x00, 0xE0, 0x0F, 0x37, 0xE0, 0x13, 0x1B, 0x40, 0x00, 0xC0, 0x1F, 0xE0,
+  0x07, 0x07, 0xC0, 0x00, 0xC0, 0x17, 0xC0, 0x00, 0xE0, 0x27, 0x0F, 0xE0,
+  0x17, 0x00, 0xE0, 0x27, 0x4F, 0xE0, 0x57, 0x2F, 0xE0, 0x0B, 0x00, 0xE0,
+  0x07, 0x73, 0xE0, 0x07, 0x00, 0x40, 0x1F, 0xE0, 0x03, 0x00, 0xE0, 0x03,
+  0x1F, 0x40, 0x17, 0xE0, 0x23, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x1F, 0x3F,
+  0xE0, 0x07, 0x27, 0xC0, 0x00, 0xE0, 0x0F, 0x17, 0xC0, 0x00, 0xE0, 0x07,
+  0x1F, 0xE0, 0x47, 0x0F, 0xE0, 0x1B, 0x00, 0x40, 0x73, 0xE0, 0x03, 0x00,
+  0xE0, 0x03, 0x33, 0xE0, 0x03, 0x17, 0x40, 0x00, 0xE0, 0x03, 0x1B, 0xC0,
+  0x00, 0x40, 0x17, 0xC0, 0x00, 0xC0, 0x13, 0xE0, 0x03, 0x00, 0xC0, 0x1B,
+  0xC0, 0x00, 0xE0, 0x03, 0x1B, 0x40, 0x00, 0xC0, 0x17, 0xC0, 0x00, 0x40,
+  0x13, 0xE0, 0x03, 0x00, 0x40, 0x17, 0xE0, 0x03, 0x0F, 0xE0, 0x13, 0x00,
+  0xE0, 0x07, 0x2B, 0xE0, 0x27, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x23, 0x3F,
+  0xE0, 0x07, 0x2B, 0xC0, 0x00, 0xE0, 0x0F, 0x17, 0x40, 0x00, 0xE0, 0x07,
+  0x1B, 0xE0, 0x27, 0x0F, 0x40, 0x00, 0x40, 0x33, 0xC0, 0x00, 0x40, 0x0F,
+  0xE0, 0xE3, 0x00, 0xC0, 0xF7, 0xC0, 0x00, 0xE0, 0x4B, 0xFB, 0xC0, 0x5B,
+  0x40, 0x00, 0xE0, 0x4B, 0x5F, 0xE0, 0xD7, 0x00, 0xE1, 0xDB, 0x37, 0x40,
+  0xE3, 0x40, 0x00, 0xE1, 0x07, 0xCB, 0xE0, 0x0B, 0x13, 0xE0, 0x03, 0x00,
+  0x40, 0x1F, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x07, 0x00, 0x40, 0x1F,
+  0x40, 0x00, 0xC0, 0x17, 0xE0, 0x03, 0x0B, 0xE0, 0x9B, 0x00, 0xE0, 0xA7,
+  0xAF, 0xE0, 0x27, 0x00, 0xE0, 0x13, 0xDF, 0xE0, 0x13, 0x1B, 0xE0, 0x03,
+  0x00, 0xE0, 0x0F, 0x27, 0xE0, 0x03, 0x17, 0x40, 0x0B, 0x40, 0x00, 0xE0,
+  0x03, 0x37, 0xE0, 0x17, 0x00, 0xC0, 0x2F, 0x40, 0x07, 0x40, 0x00, 0xE0,
+  0x0B, 0x2F, 0x40, 0x17, 0x40, 0x00, 0x40, 0x1B, 0xC0, 0x07, 0xC0, 0x00,
+  0xC0, 0x0F, 0x40, 0x07, 0x40, 0x00, 0xC0, 0x17, 0xE0, 0x03, 0x00, 0x40,
+  0x17, 0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x1B, 0xE0, 0x03, 0x17, 0xC0, 0x00,
+  0x40, 0x37, 0xC0, 0x0B, 0x40, 0x00, 0xE0, 0x8B, 0x0F, 0xE0, 0x07, 0x00,
+  0x40, 0xA7, 0xE0, 0x03, 0x00, 0x40, 0x1F, 0xE0, 0x03, 0x0F, 0xE0, 0x03,
+  0x00, 0xE0, 0x13, 0x1B, 0xE0, 0x03, 0x00, 0xE0, 0x1F, 0x27, 0xE0, 0x0F,
+  0x00, 0xE0, 0x0F, 0x3F, 0x40, 0x17, 0x40, 0x00, 0xC0, 0x37, 0xE0, 0x03,
+  0x0B, 0x40, 0x00, 0xE0, 0x03, 0x0F, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x17,
+  0xC0, 0x00, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x03, 0x0F, 0xC0, 0x0B, 0x40,
+  0x00, 0xE0, 0x03, 0x1B, 0xE0, 0x0F, 0x00, 0xE0, 0x13, 0x23, 0xE0, 0x07,
+  0x1B, 0xE0, 0x47, 0x0F, 0x40, 0x00, 0xC0, 0x53, 0xC0, 0x07, 0xE0, 0x03,
+  0x00, 0xE0, 0x07, 0x13, 0xE0, 0x07, 0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x0B,
+  0x1B, 0xE0, 0x0B, 0x13, 0xE0, 0x2F, 0x00, 0xE0, 0x2F, 0x4B, 0xC0, 0x37,
+  0xC0, 0x07, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x13, 0xE0, 0x37, 0x0F, 0xE0,
+  0x0B, 0x00, 0x40, 0x53, 0xC0, 0x00, 0xE0, 0x0F, 0x1F, 0xE0, 0x0B, 0x17,
+  0x40, 0x00, 0x40, 0x37, 0x40, 0x07, 0xC0, 0x00, 0xE0, 0x2F, 0x0F, 0xC0,
+  0x37, 0xC0, 0x07, 0xE0, 0x07, 0x00, 0xE0, 0x1F, 0x17, 0xE0, 0x1F, 0x27,
+  0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x33, 0x40, 0x00, 0xE0, 0x13, 0x1B, 0xE0,
+  0x03, 0x00, 0xE0, 0x1F, 0x27, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x37, 0xE0,
+  0x0B, 0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x3F, 0x40, 0x00, 0xE0, 0x03,
+  0x1F, 0x40, 0x00, 0x40, 0x13, 0xC0, 0x00, 0xE0, 0x07, 0x0F, 0xE0, 0x17,
+  0x00, 0xE0, 0x0B, 0x2F, 0xE0, 0x0B, 0x13, 0xC0, 0x00, 0xE0, 0x07, 0x1B,
+  0xE0, 0x07, 0x0F, 0x40, 0x00, 0xC0, 0x13, 0xC0, 0x07, 0xE0, 0x03, 0x00,
+  0xC0, 0x13, 0xE0, 0x07, 0x07, 0xE0, 0x03, 0x00, 0xE0, 0x13, 0x1B, 0x40,
+  0x00, 0x40, 0x1F, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x03, 0x00, 0x40,
+  0x1B, 0xE0, 0x03, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x13, 0x1F, 0xE0, 0x13,
+  0x1B, 0xE0, 0x03, 0x00, 0xE0, 0x1F, 0x27, 0xE0, 0x07, 0x00, 0xE0, 0x07,
+  0x37, 0xE0, 0x17, 0x0F, 0xE0, 0x17, 0x00, 0xE0, 0x27, 0x3F, 0x40, 0x2F,
+  0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x5F, 0x40, 0x23, 0xE0, 0x13, 0x1B, 0xE0,
+  0x03, 0x00, 0xE0, 0x0B, 0x27, 0x40, 0x1F, 0xE0, 0x0B, 0x17, 0x40, 0x00,
+  0x40, 0x1B, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xC0, 0x00, 0x40, 0x17, 0xC0,
+  0x0B, 0x40, 0x00, 0xE0, 0x07, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x1F,
+  0x40, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x33, 0x40, 0x00, 0xC0, 0x23,
+  0x40, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x17, 0xE0, 0x03, 0x0F, 0xE0, 0x07,
+  0x00, 0x40, 0x1F, 0x40, 0x00, 0xE0, 0x07, 0x17, 0xE0, 0x1F, 0x00, 0x40,
+  0x3B, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x3B, 0x40, 0x1B, 0xE0, 0x03, 0x0F,
+  0xE0, 0x17, 0x00, 0xE0, 0x27, 0x2F, 0xE0, 0xB7, 0x00, 0x40, 0xEF, 0xE0,
+  0x03, 0x00, 0xE0, 0xB7, 0xCF, 0xE0, 0x0B, 0x00, 0xE0, 0x03, 0xDF, 0x40,
+  0x00, 0xE0, 0x0B, 0x23, 0xE0, 0x1B, 0x00, 0x40, 0x3B, 0xC0, 0x00, 0xE0,
+  0x03, 0x2F, 0xC0, 0x13, 0xE0, 0x07, 0x00, 0x40, 0x23, 0xC0, 0x13, 0x40,
+  0x0B, 0x40, 0x00, 0xE0, 0x0F, 0x0F, 0x40, 0x00, 0x40, 0x1F, 0xE0, 0x0F,
+  0x00, 0x40, 0x1F, 0x40, 0x00, 0xE0, 0x0F, 0x1F, 0xE0, 0x13, 0x00, 0x40,
+  0x37, 0xE0, 0x0B, 0x00, 0x40, 0x33, 0xC0, 0x17, 0x40, 0x0B, 0x40, 0x00,
+  0xE0, 0x0F, 0x0F, 0x40, 0x00, 0x40, 0x1F, 0xE0, 0x07, 0x00, 0x40, 0x17,
+  0x40, 0x00, 0xC0, 0x17, 0x40, 0x0B, 0x40, 0x00, 0xC0, 0x0F, 0x40, 0x00,
+  0x40, 0x0F, 0xE0, 0x07, 0x00, 0x40, 0x17, 0x40, 0x00, 0xE0, 0x03, 0x17,
+  0x40, 0x0F, 0xE0, 0x07, 0x00, 0xC0, 0x1F, 0xE0, 0x03, 0x17, 0xE0, 0x1F,
+  0x13, 0x40, 0x00, 0xE0, 0x07, 0x2B, 0xE0, 0x27, 0x0F, 0xE0, 0x17, 0x00,
+  0xE0, 0x07, 0x4F, 0xC0, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x2F, 0x00, 0xE0,
+  0x2F, 0x4F, 0xE0, 0x0F, 0x37, 0xE0, 0x0F, 0x17, 0xE0, 0x47, 0x00, 0xE0,
+  0x0B, 0x67, 0xE0, 0x0B, 0x13, 0xE0, 0x17, 0x00, 0xC0, 0x33, 0x40, 0x00,
+  0xE0, 0x0B, 0x2B, 0x40, 0x17, 0x40, 0x00, 0xE0, 0x07, 0x1B, 0x40, 0x13,
+  0x40, 0x00, 0xE0, 0x07, 0x17, 0xE0, 0x23, 0x00, 0x40, 0x3F, 0xE0, 0x03,
+  0x00, 0xE0, 0x0B, 0x3B, 0xE0, 0x03, 0x1F, 0x40, 0x00, 0xE0, 0x03, 0x23,
+  0x40, 0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x1B, 0x40, 0x00, 0xE0, 0x03,
+  0x1B, 0x40, 0x00, 0x40, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x03,
+  0x00, 0xE0, 0x03, 0x1B, 0x40, 0x00, 0xE0, 0x03, 0x1B, 0x40, 0x00, 0x40,
+  0x13, 0xE0, 0x07, 0x00, 0x40, 0x17, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x1F,
+  0xE0, 0x03, 0x17, 0x40, 0x00, 0xE0, 0x03, 0x1B, 0x40, 0x00, 0x40, 0x13,
+  0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x03, 0x00, 0xE0, 0x13, 0x1B, 0xC0,
+  0x00, 0xE0, 0x13, 0x23, 0xE0, 0x13, 0x1B, 0x40, 0x00, 0xC0, 0x1F, 0xE0,
+  0x07, 0x0B, 0xE0, 0x1B, 0x00, 0xE0, 0x03, 0x3B, 0x40, 0x00, 0xE0, 0x47,
+  0x0F, 0xE0, 0x0B, 0x00, 0xE0, 0x07, 0x63, 0xE0, 0x03, 0x00, 0xE0, 0x13,
+  0x1B, 0x40, 0x00, 0xE0, 0x27, 0x1F, 0xE0, 0x17, 0x2F, 0x40, 0x00, 0xE0,
+  0x07, 0x23, 0xE0, 0x03, 0x0F, 0xE0, 0x03, 0x0B, 0x40, 0x00, 0xE0, 0x27,
+  0x0F, 0xC0, 0x00, 0xE0, 0x07, 0x37, 0xE0, 0x0B, 0x00, 0xE0, 0x13, 0x23,
+  0xE0, 0x0F, 0x1B, 0xE0, 0x0B, 0x17, 0xE0, 0x07, 0x13, 0xC0, 0x0F, 0xC0,
+  0x00, 0xE0, 0x07, 0x7B, 0xC0, 0x17, 0xC0, 0x00, 0xE0, 0x03, 0x1F, 0xE0,
+  0x07, 0x13, 0xE0, 0x0F, 0x0F, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x43, 0x40,
+  0x00, 0xE0, 0x07, 0x1F, 0x40, 0x00, 0x40, 0x17, 0x40, 0x00, 0x40, 0x0B,
+  0xE0, 0x07, 0x00, 0x40, 0x17, 0xC0, 0x00, 0xE0, 0x07, 0x1B, 0x40, 0x00,
+  0xC0, 0x1B, 0x40, 0x00, 0x40, 0x0F, 0xE0, 0x07, 0x00, 0x40, 0x17, 0x40,
+  0x00, 0xC0, 0x17, 0x40, 0x0B, 0xE0, 0x0F, 0x00, 0xC0, 0x23, 0xE0, 0x07,
+  0x00, 0x40, 0x2F, 0xE0, 0x07, 0x13, 0xC0, 0x00, 0x40, 0x1B, 0x40, 0x00,
+  0xC0, 0x0F, 0xE0, 0x07, 0x00, 0x40, 0x1B, 0xE0, 0x03, 0x00, 0xC0, 0x1F,
+  0xE0, 0x03, 0x13, 0xE0, 0x07, 0x00, 0xE0, 0x13, 0x23, 0xE0, 0x0F, 0x1B,
+  0xC0, 0x17, 0xE0, 0x0B, 0x00, 0x40, 0x5F, 0xC0, 0x17, 0x40, 0x0B, 0x40,
+  0x00, 0xE0, 0x07, 0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x0B, 0x1B, 0xE0, 0x07,
+  0x13, 0xE0, 0x17, 0x0F, 0xE0, 0x0B, 0x00, 0xE0, 0x13, 0x33, 0xE0, 0x13,
+  0x1B, 0x40, 0x00, 0xE0, 0x37, 0x1F, 0x40, 0x00, 0xC0, 0x43, 0xC0, 0x00,
+  0x40, 0x13, 0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x17, 0x40, 0x00, 0xE0, 0x13,
+  0x1B, 0x40, 0x00, 0xE0, 0x17, 0x1F, 0xC0, 0x00, 0xE0, 0x1B, 0x27, 0xE0,
+  0x13, 0x23, 0xE0, 0x0F, 0x1B, 0xE0, 0x0B, 0x17, 0xE0, 0x03, 0x13, 0xC0,
+  0x0B, 0xE0, 0x07, 0x00, 0xC0, 0x97, 0xE0, 0x07, 0x00, 0xC0, 0x27, 0xE0,
+  0x03, 0x17, 0xC0, 0x13, 0xE0, 0x07, 0x00, 0xC0, 0x23, 0xE0, 0x0F, 0x17,
+  0xE0, 0x03, 0x00, 0xE0, 0x07, 0x23, 0xC0, 0x00, 0x40, 0x23, 0xC0, 0x0B,
+  0xE0, 0x07, 0x00, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x07, 0x17, 0xC0, 0x00,
+  0x40, 0x1B, 0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x07, 0x00, 0x40, 0x1B, 0xE0,
+  0x07, 0x00, 0xC0, 0x23, 0xE0, 0x0F, 0x17, 0xC0, 0x00, 0xE0, 0x03, 0x1F,
+  0xC0, 0x13, 0xC0, 0x00, 0xE0, 0x03, 0x1B, 0x40, 0x00, 0xC0, 0x17, 0xC0,
+  0x00, 0x40, 0x13, 0xE0, 0x03, 0x00, 0xC0, 0x17, 0xC0, 0x00, 0xE0, 0x03,
+  0x1B, 0xC0, 0x00, 0xC0, 0x1B, 0xC0, 0x00, 0xC0, 0x17, 0x40, 0x00, 0xC0,
+  0x13, 0xC0, 0x00, 0x40, 0x13, 0xC0, 0x00, 0xE0, 0x17, 0x13, 0xE0, 0x07,
+  0x1F, 0xE0, 0x07, 0x0F, 0x40, 0x00, 0xC0, 0x13, 0xC0, 0x00, 0x40, 0x13,
+  0xE0, 0xC7, 0x00, 0xC0, 0xDB, 0x40, 0x00, 0xE0, 0xC7, 0xDB, 0xE0, 0x3F,
+  0x00, 0x41, 0x1B, 0xC0, 0x00, 0xE0, 0x27, 0x53, 0xC0, 0x37, 0xE0, 0x03,
+  0x00, 0xC0, 0x43, 0xE0, 0x03, 0x13, 0x40, 0x00, 0xC0, 0x17, 0xE0, 0x3F,
+  0x00, 0x40, 0x53, 0xE0, 0x03, 0x00, 0xE0, 0x3F, 0x57, 0x40, 0x00, 0xC0,
+  0x57, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0xC0, 0x17, 0xC0, 0x00, 0xC0, 0x1B,
+  0xE0, 0x07, 0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x1B, 0x1B, 0x40, 0x00, 0xE0,
+  0x13, 0x33, 0x40, 0x1F, 0x40, 0x00, 0xC0, 0x23, 0x40, 0x0B, 0xE0, 0x07,
+  0x00, 0xC0, 0x1B, 0xE0, 0x0B, 0x00, 0xE0, 0x03, 0x2B, 0xE0, 0x0B, 0x1F,
+  0xE0, 0x2B, 0x00, 0xC0, 0x53, 0x40, 0x3B, 0xE0, 0x03, 0x0B, 0x40, 0x00,
+  0xE0, 0x3F, 0x0F, 0x40, 0x00, 0x40, 0x4F, 0xE0, 0x07, 0x00, 0x40, 0x17,
+  0x40, 0x00, 0xC0, 0x17, 0x40, 0x0B, 0x40, 0x00, 0xE0, 0x07, 0x0F, 0x40,
+  0x00, 0xC0, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x17, 0x40, 0x00, 0xC0, 0x13,
+  0x40, 0x0B, 0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x17, 0x40,
+  0x00, 0xE0, 0x03, 0x13, 0xE0, 0x23, 0x00, 0x40, 0x3B, 0x40, 0x00, 0xE0,
+  0x07, 0x33, 0x40, 0x13, 0x40, 0x00, 0x40, 0x17, 0x40, 0x07, 0x40, 0x00,
+  0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00,
+  0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00,
+  0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x07,
+  0x00, 0x40, 0x17, 0x40, 0x00, 0x40, 0x17, 0x40, 0x07, 0xE0, 0x13, 0x00,
+  0x40, 0x23, 0xC0, 0x00, 0xE0, 0x13, 0x27, 0xC0, 0x00, 0xE0, 0x07, 0x2B,
+  0xC0, 0x0F, 0xE0, 0xBF, 0x00, 0xC0, 0xE7, 0xC0, 0x00, 0xC0, 0xD7, 0xE0,
+  0x17, 0x0F, 0x40, 0x00, 0xC0, 0x23, 0xE0, 0x07, 0x00, 0x40, 0x1B, 0x40,
+  0x00, 0xC0, 0x17, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0F, 0x40, 0x07, 0xC0,
+  0x00, 0x40, 0x0F, 0xE0, 0x03, 0x00, 0xC0, 0x17, 0x40, 0x00, 0xC0, 0x17,
+  0x40, 0x0B, 0x40, 0x00, 0xE0, 0x07, 0x0F, 0xE0, 0x03, 0x00, 0xE0, 0x0F,
+  0x1B, 0xE0, 0x0F, 0x17, 0xE0, 0x0B, 0x00, 0xE0, 0x07, 0x2B, 0xC0, 0x0F,
+  0xE0, 0x0B, 0x00, 0xC0, 0x3F, 0xE0, 0x07, 0x1B, 0xC0, 0x17, 0xC0, 0x00,
+  0xE0, 0x33, 0x1F, 0xC0, 0x3B, 0xE0, 0x07, 0x4B, 0xE0, 0x3F, 0x0F, 0x40,
+  0x00, 0xE0, 0x13, 0x63, 0xE0, 0x13, 0x1B, 0x40, 0x00, 0xE0, 0x07, 0x1F,
+  0xE0, 0x07, 0x00, 0xC0, 0x1F, 0xC0, 0x00, 0xE0, 0x17, 0x1F, 0xC0, 0x00,
+  0xC0, 0x27, 0xC0, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0x40, 0x0F, 0x40,
+  0x07, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x03, 0x00, 0xC0, 0x17, 0x40, 0x00,
+  0xE0, 0x03, 0x17, 0x40, 0x00, 0x40, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x13,
+  0xE0, 0x17, 0x00, 0xC0, 0x2F, 0xC0, 0x27, 0xE0, 0xBF, 0x0F, 0x40, 0x00,
+  0xE0, 0x13, 0xD3, 0xE0, 0x13, 0x1B, 0x40, 0x00, 0xE0, 0x07, 0x1F, 0xE0,
+  0x0B, 0x00, 0xE0, 0x33, 0x23, 0xE0, 0x0B, 0x3B, 0xE0, 0x0B, 0x13, 0x40,
+  0x00, 0xE0, 0x27, 0x17, 0x40, 0x00, 0xE0, 0x07, 0x33, 0xE0, 0xC7, 0x0F,
+  0x40, 0x00, 0xC0, 0xD3, 0xE0, 0x03, 0x00, 0x40, 0x17, 0xE0, 0x03, 0x00,
+  0xE0, 0x03, 0x1B, 0x40, 0x00, 0xC0, 0x1B, 0x40, 0x0B, 0x40, 0x00, 0xE0,
+  0x0F, 0x0F, 0x40, 0x00, 0x40, 0x1F, 0xE0, 0x0B, 0x00, 0xE0, 0x07, 0x1B,
+  0x40, 0x0F, 0x40, 0x00, 0xC0, 0x2B, 0xE0, 0x03, 0x0B, 0xE0, 0x07, 0x00,
+  0x40, 0x1B, 0x40, 0x00, 0xC0, 0x17, 0x40, 0x0B, 0x40, 0x00, 0xC0, 0x0F,
+  0xC0, 0x00, 0x40, 0x13, 0xC0, 0x00, 0xE0, 0x13, 0x13, 0xE0, 0x07, 0x00,
+  0xC0, 0x33, 0x40, 0x00, 0xE0, 0x07, 0x1B, 0xE0, 0x0B, 0x00, 0x40, 0x27,
+  0x40, 0x00, 0xE0, 0x03, 0x1B, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x03, 0x13,
+  0x40, 0x00, 0x40, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x03, 0x00,
+  0xE0, 0x03, 0x1B, 0x40, 0x00, 0xE0, 0x03, 0x1B, 0x40, 0x00, 0x40, 0x13,
+  0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x0B, 0x00, 0xC0, 0x23, 0xE0, 0x0B,
+  0x1B, 0x40, 0x00, 0xC0, 0x1F, 0xE0, 0x03, 0x00, 0x40, 0x17, 0x40, 0x00,
+  0xE0, 0x03, 0x13, 0xC0, 0x00, 0x40, 0x17, 0x40, 0x00, 0xC0, 0x0F, 0xC0,
+  0x00, 0x40, 0x13, 0xE0, 0x03, 0x00, 0xC0, 0x17, 0xE0, 0x07, 0x00, 0xC0,
+  0x23, 0xE0, 0x03, 0x17, 0xC0, 0x13, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x23,
+  0x40, 0x00, 0xC0, 0x1F, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x0B, 0x17,
+  0xE0, 0x03, 0x13, 0xE0, 0x0F, 0x0B, 0xE0, 0xFF, 0x00, 0x00, 0xC1, 0x1F,
+  0xE0, 0x03, 0x00, 0xE1, 0x4F, 0x1B, 0xC0, 0x63, 0xE0, 0x2B, 0x5F, 0xE0,
+  0x0F, 0x3B, 0xE0, 0x0B, 0x17, 0xC0, 0x13, 0x40, 0x00, 0x40, 0x6B, 0x40,
+  0x07, 0xC0, 0x00, 0x40, 0x0F, 0xE0, 0x0F, 0x00, 0xC0, 0x23, 0x40, 0x00,
+  0xE0, 0x07, 0x23, 0x40, 0x13, 0xC0, 0x00, 0xE0, 0x07, 0x1B, 0xE0, 0x53,
+  0x00, 0xC0, 0x73, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x73, 0xE0, 0x23, 0x1F,
+  0xE0, 0x07, 0x3B, 0x40, 0x00, 0xC0, 0x3F, 0x40, 0x0B, 0xE0, 0x43, 0x00,
+  0xE0, 0x0F, 0x57, 0xC0, 0x17, 0xC0, 0x00, 0xE0, 0x07, 0x73, 0xE0, 0x0B,
+  0x17, 0xE0, 0x0B, 0x13, 0xE0, 0x83, 0x00, 0xC0, 0x9F, 0x40, 0x00, 0xE0,
+  0x0B, 0x97, 0x40, 0x17, 0xC0, 0x00, 0xC0, 0x1F, 0xC0, 0x0F, 0xE0, 0x03,
+  0x00, 0xC0, 0x1B, 0xE0, 0x1F, 0x00, 0xC0, 0x3B, 0x40, 0x2F, 0xE0, 0x03,
+  0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x0B, 0xE0, 0x5B, 0x00,
+  0xE0, 0x0B, 0x6F, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0,
+  0x0B, 0x13, 0x40, 0x00, 0xE0, 0x0F, 0x17, 0x40, 0x00, 0xE0, 0x07, 0x1B,
+  0xC0, 0x0F, 0xC0, 0x00, 0x40, 0x23, 0x40, 0x00, 0xE0, 0x07, 0x0F, 0x40,
+  0x00, 0xC0, 0x13, 0xC0, 0x00, 0x40, 0x13, 0xE0, 0x03, 0x00, 0xC0, 0x17,
+  0x40, 0x00, 0xE0, 0x03, 0x17, 0xE0, 0x5B, 0x00, 0x40, 0x73, 0x40, 0x00,
+  0xC0, 0x6B, 0x40, 0x0B, 0x40, 0x00, 0xC0, 0x0F, 0x40, 0x00, 0x40, 0x0F,
+  0x40, 0x00, 0xE0, 0x07, 0x0B, 0xC0, 0x00, 0x40, 0x1B, 0x40, 0x00, 0x40,
+  0x0F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x13,
+  0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x3B, 0x00, 0x40, 0x53, 0x40, 0x00,
+  0xC0, 0x4B, 0x40, 0x0B, 0x40, 0x00, 0xE0, 0x1F, 0x0F, 0xE0, 0x1B, 0x00,
+  0x40, 0x4F, 0x40, 0x00, 0xC0, 0x2B, 0x40, 0x0B, 0x40, 0x00, 0xE0, 0x1F,
+  0x0F, 0xE0, 0x03, 0x00, 0x40, 0x37, 0x40, 0x00, 0xE0, 0x03, 0x13, 0x40,
+  0x00, 0x40, 0x13, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x07, 0x00, 0x40, 0x17,
+  0xE0, 0x03, 0x00, 0xE0, 0x03, 0x1F, 0xC0, 0x17, 0xC0, 0x13, 0xE0, 0x0F,
+  0x0F, 0xE0, 0x03, 0x00, 0xC0, 0x2B, 0x40, 0x00, 0xE0, 0x07, 0x17, 0xC0,
+  0x0F, 0x40, 0x1B, 0xE0, 0x03, 0x00, 0xC0, 0x17, 0xE0, 0x03, 0x00, 0xE0,
+  0x0F, 0x1F, 0xE0, 0x03, 0x17, 0x40, 0x00, 0xC0, 0x33, 0x40, 0x0B, 0xE0,
+  0x07, 0x00, 0xC0, 0x1B, 0xE0, 0x07, 0x00, 0xC0, 0x27, 0xE0, 0x07, 0x17,
+  0xC0, 0x00, 0xE0, 0x07, 0x1F, 0x40, 0x0F, 0xC0, 0x1B, 0xC0, 0x00, 0xE0,
+  0x03, 0x13, 0xE0, 0x13, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x37, 0xC0, 0x00,
+  0xE0, 0x07, 0x13, 0xE0, 0x07, 0x0F, 0xC0, 0x00, 0xE0, 0x07, 0x17, 0xE0,
+  0x03, 0x0F, 0xC0, 0x0B, 0xE0, 0x03, 0x00, 0xC0, 0x37, 0xC0, 0x00, 0xC0,
+  0x1B, 0xC0, 0x0F, 0xC0, 0x00, 0xE0, 0x07, 0x17, 0xE0, 0x4F, 0x0F, 0xE0,
+  0x07, 0x00, 0xC0, 0x7F, 0xE0, 0x37, 0x00, 0xC0, 0x57, 0xE0, 0x0F, 0x47,
+  0xE0, 0x17, 0x1F, 0xE0, 0x07, 0x00, 0xE0, 0x0F, 0x2F, 0xE0, 0x07, 0x17,
+  0xE0, 0x13, 0x0F, 0xC0, 0x1B, 0x40, 0x00, 0xE0, 0x03, 0x5F, 0x40, 0x0F,
+  0x40, 0x00, 0xE0, 0x03, 0x13, 0x40, 0x00, 0x40, 0x13, 0x40, 0x00, 0x40,
+  0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40,
+  0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0xE0,
+  0x07, 0x0B, 0x40, 0x00, 0x40, 0x17, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x03,
+  0x00, 0x40, 0x13, 0x40, 0x00, 0xE0, 0x03, 0x13, 0x40, 0x00, 0x40, 0x13,
+  0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B,
+  0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B,
+  0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B,
+  0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B,
+  0x40, 0x00, 0xE0, 0x03, 0x0B, 0x40, 0x00, 0x40, 0x0F, 0xC0, 0x00, 0x40,
+  0x0F, 0xE0, 0x0B, 0x00, 0xE0, 0x13, 0x1F, 0xE0, 0x07, 0x1B, 0xE0, 0x1F,
+  0x0F, 0xE0, 0x17, 0x00, 0xC0, 0x87, 0xE0, 0x03, 0x27, 0xE0, 0x07, 0x13,
+  0xE0, 0x13, 0x0F, 0xC0, 0x1B, 0xC0, 0x00, 0xE0, 0x13, 0x47, 0xE0, 0x03,
+  0x00, 0xE0, 0x07, 0x2F, 0xC0, 0x0F, 0xC0, 0x00, 0xC0, 0x2B, 0xE0, 0x07,
+  0x0F, 0x40, 0x00, 0xC0, 0x13, 0xE0, 0x07, 0x00, 0x40, 0x1B, 0x40, 0x00,
+  0xE0, 0x0F, 0x17, 0xC0, 0x00, 0xE0, 0x27, 0x1F, 0xC0, 0x00, 0x40, 0x3F,
+  0xE0, 0x03, 0x0B, 0x40, 0x00, 0xE0, 0x27, 0x0F, 0xE0, 0x3B, 0x00, 0xC0,
+  0x73, 0xC0, 0x00, 0xE0, 0x3B, 0x53, 0xC0, 0x00, 0xE0, 0x07, 0x53, 0xE0,
+  0x1F, 0x0F, 0xC0, 0x00, 0xC0, 0x47, 0x40, 0x00, 0xE0, 0x0B, 0x13, 0xE0,
+  0xFF, 0xA8, 0x00, 0xC1, 0xC3, 0xC0, 0x00, 0xE1, 0x0F, 0xBF, 0xE0, 0x17,
+  0x1F, 0xE0, 0x47, 0x00, 0x40, 0x6F, 0xE0, 0x03, 0x53, 0xE0, 0x03, 0x0F,
+  0xC0, 0x0B, 0xE0, 0x0B, 0x07, 0xC0, 0x00, 0x40, 0x3B, 0xE0, 0x0F, 0x0B,
+  0xC0, 0x00, 0xE0, 0x03, 0x1F, 0xE0, 0x0B, 0x00, 0xE0, 0x33, 0x1F, 0xE0,
+  0x03, 0x3B, 0xE0, 0x03, 0x0B, 0xE0, 0x3F, 0x00, 0xE0, 0x03, 0x53, 0xE0,
+  0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x0B, 0xE0, 0x1F,
+  0x00, 0xE0, 0x03, 0x33, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x13,
+  0xE0, 0x03, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x13, 0x00,
+  0x40, 0x33, 0xE0, 0x03, 0x1F, 0xE0, 0x0F, 0x0F, 0xC0, 0x17, 0xE0, 0x07,
+  0x07, 0x40, 0x00, 0x40, 0x13, 0xC0, 0x00, 0xE0, 0x0B, 0x0F, 0xC0, 0x00,
+  0xE0, 0x03, 0x23, 0xE0, 0x0B, 0x00, 0xE0, 0x33, 0x1F, 0xE0, 0x03, 0x3B,
+  0xE0, 0x03, 0x0B, 0xE0, 0x3F, 0x00, 0xE0, 0x03, 0x53, 0xE0, 0x03, 0x0B,
+  0xC0, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x0B, 0xE0, 0x1F, 0x00, 0xE0,
+  0x03, 0x33, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03,
+  0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x1B, 0x00, 0x40, 0x3B,
+  0xE0, 0x03, 0x27, 0xE0, 0x03, 0x0F, 0xC0, 0x0B, 0xE0, 0x0B, 0x07, 0xC0,
+  0x00, 0x40, 0x3B, 0xE0, 0x0F, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x1F, 0xE0,
+  0x0B, 0x00, 0xE0, 0x0B, 0x1F, 0xC0, 0x13, 0xE0, 0x03, 0x00, 0xE0, 0x17,
+  0x3B, 0xC0, 0x2B, 0xE0, 0x0B, 0x27, 0xE0, 0x07, 0x00, 0xC0, 0x2B, 0xE0,
+  0x03, 0x00, 0xE0, 0x03, 0x23, 0xE0, 0x03, 0x17, 0x40, 0x00, 0x40, 0x1B,
+  0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0x0F, 0x40, 0x00,
+  0x40, 0x0F, 0x40, 0x07, 0x40, 0x00, 0xE0, 0x03, 0x0B, 0xE0, 0x0B, 0x00,
+  0xE0, 0x0B, 0x1F, 0xE0, 0x03, 0x13, 0x40, 0x0B, 0xC0, 0x00, 0xC0, 0x3F,
+  0x40, 0x0F, 0xE0, 0x0B, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x23, 0xE0, 0x1F,
+  0x00, 0x40, 0x37, 0xE0, 0x03, 0x2B, 0xE0, 0x0F, 0x0F, 0xC0, 0x17, 0xE0,
+  0x0B, 0x07, 0xC0, 0x00, 0x40, 0x47, 0xC0, 0x0B, 0x40, 0x00, 0x40, 0x0F,
+  0xE0, 0x03, 0x00, 0x40, 0x13, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03,
+  0x00, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x00, 0x40,
+  0x1B, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xC0, 0x00, 0x40, 0x17, 0x40, 0x00,
+  0x40, 0x0F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x23, 0x00, 0x40,
+  0x33, 0x40, 0x00, 0xE0, 0x17, 0x33, 0x40, 0x23, 0x40, 0x00, 0xE0, 0x03,
+  0x27, 0x40, 0x0F, 0x40, 0x00, 0x40, 0x13, 0x40, 0x07, 0x40, 0x00, 0x40,
+  0x0B, 0xE0, 0x0B, 0x00, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x0B, 0x1B, 0x40,
+  0x00, 0x40, 0x1B, 0x40, 0x00, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0x0F, 0x40,
+  0x00, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x03, 0x00,
+  0x40, 0x13, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x1F, 0x00, 0xE0, 0x07,
+  0x37, 0xE0, 0x03, 0x0F, 0xC0, 0x0B, 0xE0, 0x0B, 0x07, 0xC0, 0x00, 0x40,
+  0x67, 0xE0, 0x0F, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x1F, 0xC0, 0x00, 0xC0,
+  0x13, 0xE0, 0x03, 0x00, 0xC0, 0x1B, 0x40, 0x00, 0xE0, 0x03, 0x17, 0xC0,
+  0x00, 0x40, 0x17, 0xC0, 0x00, 0xC0, 0x13, 0xC0, 0x00, 0x40, 0x17, 0xE0,
+  0x0B, 0x0B, 0xE0, 0x0B, 0x00, 0xE0, 0x03, 0x2B, 0xE0, 0x03, 0x00, 0x40,
+  0x17, 0xC0, 0x00, 0xE0, 0x03, 0x17, 0x40, 0x00, 0x40, 0x17, 0x40, 0x07,
+  0x40, 0x00, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0x0F, 0x40, 0x00, 0x40, 0x0F,
+  0x40, 0x07, 0x40, 0x00, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x13,
+  0xE0, 0x03, 0x0B, 0xE0, 0x0B, 0x00, 0xE0, 0x2F, 0x1F, 0x40, 0x37, 0xC0,
+  0x00, 0xE0, 0x0F, 0x57, 0xC0, 0x00, 0x40, 0x1F, 0xC0, 0x0B, 0x40, 0x00,
+  0xE0, 0x0F, 0x0F, 0xC0, 0x17, 0xE0, 0x07, 0x07, 0x40, 0x00, 0x40, 0x13,
+  0xC0, 0x00, 0xE0, 0x0B, 0x0F, 0xC0, 0x00, 0xE0, 0x03, 0x23, 0xE0, 0x0B,
+  0x00, 0xE0, 0x33, 0x1F, 0xE0, 0x03, 0x3B, 0xE0, 0x03, 0x0B, 0xC0, 0x00,
+  0xE0, 0x03, 0x13, 0xE0, 0x03, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x17,
+  0x40, 0x00, 0xE0, 0x03, 0x1B, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x03,
+  0x13, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x0B,
+  0xE0, 0x63, 0x00, 0xE0, 0x13, 0x77, 0x40, 0x1B, 0xE0, 0x03, 0x8B, 0xE0,
+  0x03, 0x0F, 0xC0, 0x0B, 0xE0, 0x0B, 0x07, 0xC0, 0x00, 0x40, 0x3B, 0xE0,
+  0x0F, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x1F, 0xE0, 0x0B, 0x00, 0xE0, 0x33,
+  0x1F, 0xE0, 0x03, 0x3B, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x13,
+  0xE0, 0x03, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x17, 0x40, 0x00, 0xE0,
+  0x03, 0x1B, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03,
+  0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x0B, 0xE0, 0x63, 0x00,
+  0xE0, 0x0B, 0x77, 0x40, 0x13, 0xE0, 0x03, 0x83, 0xE0, 0x0F, 0x0F, 0xC0,
+  0x17, 0xE0, 0x0B, 0x07, 0xC0, 0x00, 0x40, 0x47, 0xC0, 0x0B, 0x40, 0x00,
+  0x40, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x13, 0x40, 0x00, 0xE0, 0x03, 0x13,
+  0xE0, 0x03, 0x00, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03,
+  0x00, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xC0, 0x00, 0x40, 0x17,
+  0x40, 0x00, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xC0, 0x00,
+  0x40, 0x0F, 0x40, 0x00, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B,
+  0xE0, 0x03, 0x00, 0x40, 0x13, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xC0, 0x00,
+  0x40, 0x17, 0x40, 0x00, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B,
+  0xC0, 0x00, 0x40, 0x0F, 0x40, 0x00, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x00,
+  0x40, 0x0B, 0xC0, 0x00, 0x40, 0x0F, 0x40, 0x00, 0x40, 0x0F, 0x40, 0x07,
+  0x40, 0x00, 0x40, 0x0B, 0xE0, 0x63, 0x00, 0x40, 0x73, 0x40, 0x00, 0xE0,
+  0x0F, 0x73, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x2F, 0x1F, 0xE0, 0x17, 0x00,
+  0x40, 0x5B, 0x40, 0x00, 0xE0, 0x17, 0x27, 0xE0, 0x0F, 0x00, 0x40, 0x3B,
+  0x40, 0x00, 0xE0, 0x2B, 0x1F, 0x40, 0x37, 0x40, 0x00, 0x40, 0x3B, 0x40,
+  0x07, 0x40, 0x00, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0x0F, 0x40, 0x00, 0x40,
+  0x0F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x1F, 0x00, 0x40, 0x2F,
+  0x40, 0x00, 0x40, 0x2F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x1F,
+  0x00, 0x40, 0x2F, 0x40, 0x00, 0x40, 0x2F, 0x40, 0x07, 0x40, 0x00, 0x40,
+  0x0B, 0xE0, 0x1F, 0x00, 0x40, 0x2F, 0x40, 0x00, 0x40, 0x2F, 0x40, 0x07,
+  0x40, 0x00, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x13, 0x40, 0x00, 0xE0,
+  0x03, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x03, 0x13,
+  0xE0, 0x03, 0x00, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x23,
+  0x00, 0x40, 0x3B, 0x40, 0x00, 0xE0, 0x23, 0x33, 0xE0, 0x03, 0x00, 0x40,
+  0x3B, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0x40,
+  0x00, 0xE0, 0x03, 0x13, 0xC0, 0x00, 0x40, 0x17, 0x40, 0x00, 0x40, 0x0F,
+  0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0x0F, 0x40, 0x00,
+  0x40, 0x0F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x1F, 0x00, 0x40,
+  0x2F, 0x40, 0x00, 0x40, 0x2F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0,
+  0x1F, 0x00, 0x40, 0x2F, 0x40, 0x00, 0x40, 0x2F, 0x40, 0x07, 0x40, 0x00,
+  0x40, 0x0B, 0xE0, 0x1F, 0x00, 0x40, 0x2F, 0x40, 0x00, 0x40, 0x2F, 0x40,
+  0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x13, 0x40, 0x00,
+  0xE0, 0x03, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x03,
+  0x13, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0,
+  0x23, 0x00, 0x40, 0x3B, 0x40, 0x00, 0xE0, 0x23, 0x33, 0xE0, 0x03, 0x00,
+  0x40, 0x3B, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x1B,
+  0xE0, 0x07, 0x00, 0xC0, 0x1F, 0xC0, 0x17, 0x40, 0x0F, 0xE0, 0x03, 0x0B,
+  0xC0, 0x00, 0xE0, 0x03, 0x13, 0xC0, 0x0B, 0x40, 0x00, 0xE0, 0x07, 0x1F,
+  0xE0, 0x17, 0x00, 0x40, 0x2F, 0xE0, 0x17, 0x23, 0xE0, 0x03, 0x00, 0x40,
+  0x2F, 0x40, 0x00, 0xC0, 0x13, 0xE0, 0x03, 0x0B, 0xE0, 0x2B, 0x00, 0xE0,
+  0x27, 0x3F, 0x40, 0x2F, 0xC0, 0x00, 0xC0, 0x6F, 0xC0, 0x0F, 0xE0, 0x07,
+  0x00, 0xE0, 0x17, 0x1F, 0xE0, 0x17, 0x00, 0xE0, 0x57, 0x3F, 0xE0, 0x13,
+  0x5F, 0xE0, 0x03, 0x1B, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x0B, 0x13,
+  0xE0, 0x03, 0x00, 0xE0, 0x17, 0x1F, 0xE0, 0x37, 0x00, 0xE0, 0x57, 0x5F,
+  0xE0, 0x1B, 0x00, 0xC0, 0x83, 0xE0, 0x43, 0x00, 0xE0, 0x03, 0x77, 0xE0,
+  0x43, 0x57, 0xC0, 0x00, 0xE0, 0x17, 0x5F, 0xC0, 0x1F, 0xE0, 0x03, 0x2F,
+  0xC0, 0x0B, 0x40, 0x00, 0xE0, 0x07, 0x1F, 0xE0, 0x07, 0x00, 0xE0, 0x07,
+  0x1F, 0x40, 0x0F, 0xE0, 0x07, 0x23, 0xE0, 0x23, 0x00, 0xE0, 0x07, 0x3F,
+  0x40, 0x0F, 0x40, 0x00, 0xC0, 0x43, 0xE0, 0x03, 0x0B, 0xE0, 0x2B, 0x00,
+  0xE0, 0x27, 0x3F, 0x40, 0x2F, 0xE0, 0x3F, 0x00, 0xC0, 0xAF, 0xE0, 0x0F,
+  0x4F, 0xE0, 0x17, 0x1F, 0xE0, 0x17, 0x00, 0xE0, 0x17, 0x3F, 0xE0, 0x13,
+  0x1F, 0xE0, 0x03, 0x1B, 0xE0, 0x03, 0x0B, 0xE0, 0x1F, 0x00, 0xE0, 0x03,
+  0x33, 0xE0, 0x03, 0x0B, 0xE0, 0x1F, 0x00, 0xE0, 0x03, 0x33, 0xE0, 0x03,
+  0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x0B, 0xE0, 0x1F, 0x00,
+  0xE0, 0x03, 0x33, 0xE0, 0x03, 0x0B, 0xE0, 0x63, 0x00, 0xE0, 0x17, 0x77,
+  0xE0, 0x17, 0x1F, 0xE0, 0x17, 0x00, 0xE0, 0x17, 0x3F, 0xE0, 0x13, 0x1F,
+  0xE0, 0x03, 0x1B, 0xE0, 0x03, 0x0B, 0xE0, 0x1F, 0x00, 0xE0, 0x03, 0x33,
+  0xE0, 0x03, 0x0B, 0xE0, 0x1F, 0x00, 0xE0, 0x03, 0x33, 0xE0, 0x03, 0x0B,
+  0xC0, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x0B, 0xE0, 0x1F, 0x00, 0xE0,
+  0x03, 0x33, 0xE0, 0x03, 0x0B, 0xE0, 0x63, 0x00, 0xE0, 0x17, 0x77, 0xE0,
+  0x17, 0x1F, 0xE0, 0x17, 0x00, 0xE0, 0x17, 0x3F, 0xE0, 0x13, 0x1F, 0xE0,
+  0x03, 0x1B, 0xE0, 0x03, 0x0B, 0xE0, 0x1F, 0x00, 0xE0, 0x03, 0x33, 0xE0,
+  0x03, 0x0B, 0xE0, 0x1F, 0x00, 0xE0, 0x03, 0x33, 0xE0, 0x03, 0x0B, 0xC0,
+  0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x0B, 0xE0, 0x1F, 0x00, 0xE0, 0x03,
+  0x33, 0xE0, 0x03, 0x0B, 0xE0, 0x1F, 0x00, 0xE0, 0x03, 0x33, 0xE0, 0x03,
+  0x0B, 0xE0, 0x3F, 0x00, 0xE0, 0x03, 0x53, 0xE0, 0x03, 0x0B, 0xE0, 0x03,
+  0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x3B, 0x00, 0xE0, 0x03, 0x5B, 0xE0, 0x03,
+  0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x17, 0xC0, 0x00, 0xE0, 0x17, 0x1F,
+  0xE0, 0x0B, 0x00, 0xC0, 0x33, 0xE0, 0x0F, 0x00, 0xE0, 0x0B, 0x33, 0xE0,
+  0x03, 0x00, 0xE0, 0x07, 0x37, 0xE0, 0x03, 0x1B, 0xE0, 0x0B, 0x00, 0xE0,
+  0x07, 0x2F, 0xE0, 0x17, 0x00, 0xC0, 0x43, 0xC0, 0x27, 0x40, 0x0F, 0xE0,
+  0x03, 0x0B, 0xE0, 0x3F, 0x00, 0xE0, 0x03, 0x53, 0xE0, 0x03, 0x0B, 0xE0,
+  0x03, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x3B, 0x00, 0xE0, 0x03, 0x5B, 0xE0,
+  0x03, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x17, 0xC0, 0x00, 0xE0, 0x17,
+  0x1F, 0xE0, 0x0B, 0x00, 0xC0, 0x33, 0xE0, 0x0F, 0x00, 0xE0, 0x0B, 0x33,
+  0xE0, 0x03, 0x00, 0xE0, 0x07, 0x37, 0xE0, 0x03, 0x1B, 0xE0, 0x0B, 0x00,
+  0xE0, 0x07, 0x2F, 0xE0, 0x17, 0x00, 0xC0, 0x43, 0xC0, 0x27, 0x40, 0x0F,
+  0xE0, 0x0B, 0x0B, 0xE0, 0x0F, 0x00, 0x40, 0x2F, 0xE0, 0x1B, 0x00, 0xC0,
+  0x3F, 0x40, 0x2B, 0xE0, 0x03, 0x0B, 0xE0, 0x03, 0x00, 0xC0, 0x17, 0xE0,
+  0x03, 0x00, 0xE0, 0x23, 0x1F, 0xE0, 0x13, 0x00, 0xC0, 0x53, 0x40, 0x23,
+  0xE0, 0x0B, 0x0B, 0xE0, 0x0F, 0x00, 0x40, 0x2F, 0xC0, 0x00, 0xC0, 0x23,
+  0xC0, 0x0F, 0xE0, 0x1B, 0x00, 0xC0, 0x33, 0xE0, 0x0F, 0x00, 0xE0, 0x17,
+  0x43, 0xE0, 0x07, 0x37, 0xE0, 0x27, 0x2F, 0xE0, 0x17, 0x00, 0xC0, 0x4F,
+  0xC0, 0x27, 0x40, 0x0F, 0xE0, 0x03, 0x0B, 0xE0, 0x3F, 0x00, 0xE0, 0x03,
+  0x53, 0xE0, 0x03, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x17, 0xC0, 0x00,
+  0xE0, 0x17, 0x1F, 0xE0, 0x13, 0x00, 0xE0, 0x03, 0x3B, 0xE0, 0x03, 0x0B,
+  0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x17, 0xC0, 0x00, 0xE0, 0x17, 0x1F, 0xE0,
+  0x0B, 0x00, 0xC0, 0x33, 0xE0, 0x0F, 0x00, 0xE0, 0x0B, 0x33, 0xE0, 0x03,
+  0x00, 0xE0, 0x07, 0x37, 0xE0, 0x03, 0x1B, 0xE0, 0x0B, 0x00, 0xE0, 0x07,
+  0x2F, 0xE0, 0x77, 0x00, 0xC0, 0xA3, 0xE0, 0x0F, 0x87, 0xC0, 0x1F, 0x40,
+  0x00, 0xE0, 0x0B, 0x23, 0x40, 0x17, 0xC0, 0x00, 0xE0, 0x13, 0x1F, 0xE0,
+  0x0B, 0x1B, 0xE0, 0x4F, 0x00, 0xC0, 0x8F, 0xE0, 0x07, 0x00, 0xE0, 0x4F,
+  0x6F, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x73, 0xE0, 0x07, 0x00, 0xE0, 0x03,
+  0x2B, 0x40, 0x00, 0xE0, 0x07, 0x1F, 0xE0, 0x33, 0x00, 0x40, 0x4F, 0x40,
+  0x00, 0xE0, 0x0B, 0x43, 0x40, 0x17, 0x40, 0x00, 0x40, 0x1B, 0x40, 0x07,
+  0x40, 0x00, 0x40, 0x0B, 0xE0, 0x43, 0x00, 0x40, 0x53, 0x40, 0x00, 0xE0,
+  0x0B, 0x53, 0x40, 0x17, 0x40, 0x00, 0x40, 0x1B, 0x40, 0x07, 0x40, 0x00,
+  0x40, 0x0B, 0xC0, 0x00, 0x40, 0x0F, 0x40, 0x00, 0x40, 0x0F, 0x40, 0x07,
+  0x40, 0x00, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x13, 0x40, 0x00, 0xE0,
+  0x03, 0x13, 0xE0, 0x23, 0x00, 0x40, 0x3B, 0x40, 0x00, 0xE0, 0x03, 0x33,
+  0x40, 0x0F, 0xE0, 0x43, 0x00, 0xE0, 0x03, 0x5B, 0xE0, 0x0B, 0x00, 0xE0,
+  0x07, 0x6B, 0xE0, 0x0B, 0x23, 0xE0, 0x2F, 0x00, 0xC0, 0x5B, 0xE0, 0x0B,
+  0x3F, 0xE0, 0x03, 0x1B, 0xE0, 0x03, 0x0B, 0xE0, 0x43, 0x00, 0xE0, 0x13,
+  0x57, 0xE0, 0x03, 0x1B, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x13,
+  0xE0, 0x03, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x1F, 0x00,
+  0xE0, 0x0B, 0x3F, 0xC0, 0x13, 0xE0, 0x3F, 0x00, 0xE0, 0x17, 0x8B, 0xE0,
+  0x07, 0x67, 0xE0, 0x17, 0x2F, 0xE0, 0x23, 0x00, 0xC0, 0x5B, 0xE0, 0x0B,
+  0x33, 0xE0, 0x03, 0x1B, 0xE0, 0x03, 0x0B, 0xE0, 0x43, 0x00, 0xE0, 0x13,
+  0x57, 0xE0, 0x03, 0x1B, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x13,
+  0xE0, 0x03, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x0F, 0x17, 0xE0, 0x1F, 0x00,
+  0xE0, 0x0B, 0x3F, 0xC0, 0x13, 0xE0, 0x3F, 0x00, 0xE0, 0x17, 0x8B, 0xE0,
+  0x07, 0x67, 0xE0, 0x17, 0x2F, 0xE0, 0x77, 0x00, 0xE0, 0x07, 0xAF, 0xC0,
+  0x00, 0xE0, 0x5F, 0x97, 0xC0, 0x6F, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x7F,
+  0xE0, 0x03, 0x1F, 0xE0, 0x07, 0x1B, 0x40, 0x00, 0xE0, 0x17, 0x1F, 0x40,
+  0x00, 0xE0, 0x1B, 0x23, 0xE0, 0x1B, 0x00, 0xC0, 0x47, 0xE0, 0x03, 0x2B,
+  0xC0, 0x13, 0x40, 0x00, 0xE0, 0x03, 0x17, 0x40, 0x00, 0x40, 0x13, 0xE0,
+  0x03, 0x00, 0x40, 0x13, 0xE0, 0x23, 0x00, 0xE0, 0x03, 0x3B, 0x40, 0x00,
+  0xE0, 0x03, 0x3B, 0x40, 0x0F, 0xE0, 0x0B, 0x00, 0xC0, 0x23, 0xE0, 0x0B,
+  0x1B, 0xC0, 0x00, 0x40, 0x23, 0xE0, 0x03, 0x0B, 0x40, 0x00, 0xE0, 0x07,
+  0x0F, 0xE0, 0x1B, 0x00, 0xE0, 0x07, 0x33, 0xE0, 0x0F, 0x0F, 0x40, 0x00,
+  0x40, 0x4F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0x0F,
+  0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x17, 0x40, 0x00, 0x40,
+  0x13, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xC0, 0x00, 0x40, 0x0F, 0x40,
+  0x00, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x03, 0x00,
+  0x40, 0x13, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x2B, 0x00, 0x40, 0x43,
+  0x40, 0x00, 0xE0, 0x03, 0x3B, 0x40, 0x0F, 0x40, 0x00, 0xE0, 0x03, 0x13,
+  0xC0, 0x00, 0x40, 0x17, 0x40, 0x00, 0xE0, 0x0F, 0x0F, 0x40, 0x00, 0x40,
+  0x1F, 0xC0, 0x00, 0xE0, 0x03, 0x0F, 0xE0, 0x07, 0x0B, 0x40, 0x00, 0xE0,
+  0x03, 0x27, 0x40, 0x00, 0xE0, 0x17, 0x0F, 0x40, 0x00, 0xE0, 0x03, 0x23,
+  0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x0B, 0x13, 0xE0, 0x03, 0x00, 0xC0,
+  0x1F, 0xE0, 0x07, 0x00, 0xC0, 0x23, 0xC0, 0x17, 0xE0, 0x0B, 0x0F, 0xE0,
+  0x03, 0x1B, 0xC0, 0x0B, 0x40, 0x00, 0xC0, 0x2B, 0x40, 0x00, 0x40, 0x0F,
+  0xE0, 0x03, 0x00, 0x40, 0x13, 0xC0, 0x00, 0xC0, 0x17, 0xC0, 0x0F, 0x40,
+  0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x0B, 0x13,
+  0x40, 0x00, 0xE0, 0x17, 0x17, 0xE0, 0x07, 0x00, 0x40, 0x33, 0x40, 0x00,
+  0xE0, 0x07, 0x17, 0xC0, 0x00, 0xE0, 0x03, 0x1B, 0x40, 0x0B, 0xE0, 0x0B,
+  0x00, 0xE0, 0x03, 0x2B, 0x40, 0x00, 0xE0, 0x13, 0x0F, 0xC0, 0x1B, 0x40,
+  0x00, 0x40, 0x2B, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x07, 0x00, 0x40, 0x17,
+  0xC0, 0x00, 0xC0, 0x1B, 0xC0, 0x0F, 0xE0, 0x0B, 0x00, 0xE0, 0x03, 0x23,
+  0xE0, 0x03, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x1B, 0x17, 0xE0, 0x1B, 0x23,
+  0x40, 0x00, 0xE0, 0x1F, 0x27, 0x40, 0x00, 0xE0, 0x07, 0x2B, 0xE0, 0x0F,
+  0x0F, 0xE0, 0x0B, 0x00, 0xE0, 0x0B, 0x3F, 0x40, 0x00, 0xC0, 0x2B, 0x40,
+  0x0B, 0x40, 0x00, 0xC0, 0x0F, 0xE0, 0x03, 0x00, 0x40, 0x17, 0x40, 0x00,
+  0xC0, 0x13, 0xE0, 0x0F, 0x0B, 0xC0, 0x00, 0xE0, 0x17, 0x1F, 0xE0, 0x03,
+  0x00, 0x40, 0x2B, 0xC0, 0x00, 0xC0, 0x17, 0xE0, 0x23, 0x0F, 0xC0, 0x2B,
+  0x40, 0x00, 0xE0, 0x27, 0x3F, 0xE0, 0x0B, 0x00, 0xE0, 0x03, 0x43, 0xE0,
+  0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x0B, 0x13, 0xC0, 0x00, 0xE0, 0x03, 0x1B,
+  0xE0, 0x03, 0x0B, 0xE0, 0x03, 0x00, 0xE0, 0x07, 0x17, 0xE0, 0x07, 0x0F,
+  0xC0, 0x00, 0xE0, 0x0B, 0x17, 0xE0, 0x07, 0x13, 0xE0, 0x17, 0x0F, 0x40,
+  0x00, 0xE0, 0x13, 0x23, 0xE0, 0x13, 0x1B, 0x40, 0x00, 0xE0, 0x13, 0x1F,
+  0xE0, 0x03, 0x1B, 0xC0, 0x0B, 0xC0, 0x00, 0xE0, 0x07, 0x3B, 0xC0, 0x17,
+  0xC0, 0x00, 0x40, 0x1F, 0xE0, 0x0B, 0x00, 0xE0, 0x07, 0x1F, 0xE0, 0x13,
+  0x0F, 0xC0, 0x1B, 0x40, 0x00, 0xC0, 0x4B, 0x40, 0x0B, 0xE0, 0x07, 0x00,
+  0xC0, 0x1B, 0x40, 0x00, 0xC0, 0x1B, 0x40, 0x0B, 0xE0, 0x0F, 0x00, 0xE0,
+  0x03, 0x23, 0xE0, 0x03, 0x0B, 0x40, 0x00, 0xE0, 0x23, 0x0F, 0xE0, 0x07,
+  0x2B, 0xC0, 0x00, 0xC0, 0x17, 0xE0, 0x03, 0x00, 0xC0, 0x1B, 0xE0, 0x03,
+  0x00, 0xC0, 0x1F, 0xE0, 0x03, 0x13, 0x40, 0x00, 0xC0, 0x17, 0xC0, 0x00,
+  0x40, 0x13, 0xE0, 0x03, 0x00, 0xE0, 0x03, 0x17, 0xE0, 0x03, 0x0B, 0xC0,
+  0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x0B, 0x40, 0x00, 0xE0, 0x17, 0x0F,
+  0x40, 0x00, 0xC0, 0x23, 0xE0, 0x07, 0x00, 0x40, 0x1B, 0x40, 0x00, 0xE0,
+  0x07, 0x17, 0xC0, 0x00, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x07, 0x0F, 0xE0,
+  0x03, 0x00, 0xE0, 0x07, 0x1B, 0xE0, 0x07, 0x0F, 0x40, 0x00, 0xC0, 0x13,
+  0x40, 0x00, 0xE0, 0x03, 0x0F, 0xE0, 0x07, 0x0B, 0xE0, 0x0B, 0x00, 0x40,
+  0x33, 0x40, 0x00, 0xE0, 0x0B, 0x1B, 0xC0, 0x00, 0x40, 0x1F, 0x40, 0x00,
+  0x40, 0x0F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B,
+  0xE0, 0x0B, 0x00, 0x40, 0x1B, 0xC0, 0x00, 0xE0, 0x03, 0x1F, 0xC0, 0x13,
+  0xE0, 0x03, 0x00, 0xC0, 0x1F, 0xE0, 0x03, 0x13, 0xE0, 0x0B, 0x00, 0xE0,
+  0x13, 0x27, 0xE0, 0x13, 0x1B, 0x40, 0x00, 0xC0, 0x1F, 0x40, 0x00, 0x40,
+  0x0F, 0xC0, 0x00, 0x40, 0x0F, 0xC0, 0x00, 0x40, 0x13, 0xC0, 0x0B, 0x40,
+  0x00, 0x40, 0x0F, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0x40, 0x13,
+  0xE0, 0x23, 0x00, 0xC0, 0x3B, 0xE0, 0x13, 0x33, 0xC0, 0x23, 0x40, 0x00,
+  0xE0, 0x03, 0x27, 0x40, 0x0F, 0x40, 0x00, 0xC0, 0x13, 0x40, 0x0B, 0x40,
+  0x00, 0xC0, 0x0F, 0xE0, 0x17, 0x00, 0x40, 0x2B, 0x40, 0x00, 0xE0, 0x17,
+  0x27, 0xE0, 0x6F, 0x00, 0x40, 0x9B, 0x40, 0x00, 0xE0, 0x2F, 0x7F, 0x40,
+  0x3B, 0xE0, 0x0B, 0x00, 0xE0, 0x2F, 0x4F, 0xE0, 0x47, 0x00, 0xC0, 0x9B,
+  0xE0, 0x47, 0x57, 0xE0, 0x27, 0x00, 0xE0, 0x13, 0x87, 0xE0, 0x13, 0x1B,
+  0xE0, 0x03, 0x00, 0xE0, 0x1B, 0x27, 0xC0, 0x23, 0x40, 0x00, 0xE0, 0x03,
+  0x3B, 0x40, 0x00, 0x40, 0x13, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x07, 0x00,
+  0x40, 0x17, 0x40, 0x00, 0xE0, 0x07, 0x17, 0xE0, 0x1F, 0x00, 0x40, 0x3B,
+  0xC0, 0x00, 0xE0, 0x1F, 0x33, 0xE0, 0x2B, 0x00, 0xC0, 0x63, 0xC0, 0x00,
+  0x40, 0x43, 0xC0, 0x0B, 0xC0, 0x00, 0x40, 0x13, 0xE0, 0x03, 0x00, 0xC0,
+  0x17, 0x40, 0x00, 0xE0, 0x03, 0x17, 0xE0, 0x3B, 0x00, 0x40, 0x53, 0xE0,
+  0x0B, 0x00, 0xE0, 0x07, 0x5B, 0xC0, 0x23, 0xE0, 0x07, 0x17, 0xC0, 0x00,
+  0xE0, 0x37, 0x1F, 0x40, 0x00, 0xE0, 0x03, 0x43, 0xE0, 0x03, 0x0B, 0xC0,
+  0x00, 0xE0, 0x0B, 0x13, 0xC0, 0x00, 0xE0, 0x1B, 0x1B, 0x40, 0x00, 0x40,
+  0x2F, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x40, 0x0B, 0x40,
+  0x00, 0xE0, 0x07, 0x0B, 0xE0, 0x4B, 0x00, 0x40, 0x67, 0x40, 0x00, 0xE0,
+  0x03, 0x5B, 0x40, 0x0F, 0x40, 0x00, 0x40, 0x13, 0x40, 0x07, 0x40, 0x00,
+  0x40, 0x0B, 0xE0, 0x07, 0x00, 0x40, 0x17, 0x40, 0x00, 0xE0, 0x07, 0x17,
+  0xE0, 0x53, 0x00, 0x40, 0x6F, 0xE0, 0x0B, 0x00, 0xE0, 0x0B, 0x73, 0xC0,
+  0x27, 0xE0, 0x07, 0x1B, 0xE0, 0x0F, 0x17, 0xE0, 0x07, 0x00, 0xE0, 0x03,
+  0x27, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x0B, 0x13, 0xE0, 0x17, 0x00,
+  0xE0, 0x03, 0x33, 0xC0, 0x0B, 0x40, 0x00, 0xE0, 0x03, 0x37, 0x40, 0x0F,
+  0x40, 0x00, 0x40, 0x13, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x4B,
+  0x00, 0x40, 0x5B, 0x40, 0x00, 0xE0, 0x03, 0x5B, 0x40, 0x0F, 0x40, 0x00,
+  0x40, 0x13, 0x40, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x03, 0x00, 0x40,
+  0x13, 0x40, 0x00, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x00, 0x40, 0x1B, 0xE0,
+  0x03, 0x00, 0xE0, 0x03, 0x1B, 0xE0, 0x13, 0x00, 0xE0, 0x03, 0x33, 0xE0,
+  0x03, 0x00, 0xE0, 0x07, 0x33, 0xC0, 0x1B, 0xE0, 0x07, 0x17, 0xC0, 0x00,
+  0xE0, 0x37, 0x1F, 0x40, 0x00, 0xE0, 0x2B, 0x43, 0xC0, 0x33, 0xE0, 0x07,
+  0x00, 0x40, 0x4F, 0xE0, 0x23, 0x00, 0xE0, 0x03, 0x3F, 0xE0, 0x0F, 0x37,
+  0xC0, 0x23, 0xE0, 0x0F, 0x1F, 0xE0, 0x1B, 0x00, 0xE0, 0x0B, 0x43, 0xE0,
+  0x03, 0x13, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x0B, 0x13, 0xE0, 0x07,
+  0x00, 0xC0, 0x23, 0xC0, 0x00, 0xE0, 0x07, 0x1F, 0xE0, 0x37, 0x00, 0xE0,
+  0x13, 0x57, 0xE0, 0x13, 0x1B, 0xE0, 0x03, 0x00, 0xE0, 0x17, 0x27, 0xE0,
+  0x37, 0x1F, 0xE0, 0x0F, 0x00, 0xC0, 0x57, 0x40, 0x00, 0x40, 0x23, 0x40,
+  0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x23, 0x00, 0x40, 0x33, 0x40, 0x00,
+  0xE0, 0x0F, 0x33, 0x40, 0x1B, 0x40, 0x00, 0xE0, 0x03, 0x1F, 0x40, 0x0F,
+  0xC0, 0x00, 0x40, 0x17, 0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xE0, 0x03, 0x13,
+  0xE0, 0x03, 0x0B, 0xC0, 0x00, 0xC0, 0x13, 0xC0, 0x00, 0xC0, 0x17, 0xE0,
+  0x03, 0x00, 0xC0, 0x1B, 0xC0, 0x00, 0xE0, 0x03, 0x1B, 0xE0, 0x13, 0x00,
+  0xC0, 0x2F, 0xE0, 0x07, 0x00, 0xE0, 0x13, 0x33, 0xE0, 0x4F, 0x00, 0xC0,
+  0x83, 0xE0, 0x03, 0x5F, 0xE0, 0x03, 0x13, 0xE0, 0x03, 0x0B, 0xE0, 0x07,
+  0x00, 0xE0, 0x0F, 0x1B, 0xE0, 0x03, 0x17, 0xC0, 0x0B, 0x40, 0x00, 0xE0,
+  0x07, 0x3F, 0xE0, 0x53, 0x00, 0x40, 0x6F, 0x40, 0x00, 0x40, 0x63, 0x40,
+  0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x43, 0x00, 0x40, 0x53, 0xE0, 0x03,
+  0x00, 0xE0, 0x3F, 0x5B, 0xE0, 0x03, 0x53, 0xE0, 0x03, 0x00, 0xC0, 0x5F,
+  0xE0, 0x03, 0x13, 0xE0, 0x03, 0x00, 0xE0, 0x1F, 0x1F, 0xE0, 0x03, 0x00,
+  0xC0, 0x3F, 0xE0, 0x0F, 0x13, 0xE0, 0x0B, 0x1F, 0xC0, 0x00, 0xE0, 0x13,
+  0x1B, 0xE0, 0x7B, 0x00, 0xC0, 0x9F, 0xC0, 0x00, 0xE0, 0x7B, 0x93, 0xE0,
+  0x87, 0x00, 0xE1, 0x0F, 0x1B, 0xC0, 0x17, 0x40, 0x00, 0xE0, 0x87, 0xB3,
+  0xE0, 0x23, 0x00, 0x40, 0xBF, 0xC0, 0x00, 0xE0, 0x23, 0x37, 0xE0, 0x4E,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const BakedTexture fontBakedTexture = { 128, 128, 4, 65536, 10159, fontBakedTextureData };
+
+static const unsigned char interfaceBakedTextureData[24977] = {
+  0x23, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xFF, 0xD0, 0x03, 0x04, 0x00,
+  0xFF, 0xFF, 0xFF, 0xD2, 0xE0, 0x33, 0x03, 0x20, 0x42, 0xE0, 0x98, 0x00,
+  0x06, 0xB9, 0x85, 0x5C, 0xFF, 0x96, 0x6C, 0x4A, 0x60, 0x03, 0x02, 0x79,
+  0x55, 0x3A, 0x60, 0x03, 0xE0, 0x0B, 0x13, 0x02, 0x59, 0x3D, 0x29, 0x60,
+  0x1B, 0x40, 0x23, 0x40, 0x1F, 0xC0, 0x07, 0x20, 0xE0, 0x03, 0xFF, 0xCE,
+  0xCE, 0xCE, 0x60, 0x03, 0x02, 0xAB, 0xAB, 0xAB, 0x60, 0x03, 0x02, 0x93,
+  0x93, 0x93, 0x60, 0x03, 0x40, 0x0F, 0xC0, 0x0B, 0xE0, 0xFF, 0xFF, 0xA1,
+  0x07, 0x02, 0x6D, 0x6D, 0x6D, 0x62, 0xD3, 0x22, 0xD7, 0xE3, 0xDC, 0xFF,
+  0x43, 0xC7, 0x43, 0xFF, 0xE3, 0x03, 0xDF, 0x40, 0x0F, 0x02, 0x87, 0x87,
+  0x87, 0xE0, 0x00, 0x13, 0x43, 0xEF, 0x40, 0x13, 0x40, 0x2B, 0x40, 0x03,
+  0x40, 0x0B, 0x40, 0x2F, 0x40, 0x03, 0x41, 0x26, 0x43, 0xE7, 0x02, 0x5D,
+  0x5D, 0x5D, 0xE0, 0x00, 0x03, 0x02, 0x67, 0x67, 0x67, 0xE0, 0x00, 0x0B,
+  0x06, 0x62, 0x62, 0x62, 0xFF, 0x5A, 0x5A, 0x5A, 0x60, 0x0F, 0xE0, 0x07,
+  0x07, 0x40, 0x27, 0xE0, 0x03, 0x1F, 0x02, 0x70, 0x70, 0x70, 0x60, 0x27,
+  0x02, 0x7E, 0x7E, 0x7E, 0x60, 0x07, 0xC0, 0x2F, 0xC0, 0x5B, 0x02, 0x66,
+  0x66, 0x66, 0xE0, 0x00, 0x0B, 0xC0, 0x1B, 0x02, 0x60, 0x60, 0x60, 0xE0,
+  0x00, 0x13, 0x40, 0x27, 0x02, 0x6B, 0x6B, 0x6B, 0x60, 0x07, 0x40, 0x0B,
+  0x02, 0x77, 0x77, 0x77, 0x60, 0x5F, 0xC0, 0x4F, 0x40, 0x13, 0x40, 0x6F,
+  0x40, 0x07, 0x40, 0x4B, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x07,
+  0x40, 0x8F, 0xC0, 0x4F, 0x40, 0x0F, 0x40, 0x17, 0xE0, 0x03, 0x03, 0xE0,
+  0x07, 0x9F, 0xC0, 0x1B, 0xC0, 0x8B, 0xC0, 0x0F, 0x40, 0x07, 0xC0, 0x47,
+  0x40, 0x0B, 0x40, 0x03, 0x02, 0x56, 0x56, 0x56, 0x60, 0x07, 0xE0, 0x03,
+  0x57, 0xC0, 0x4F, 0x02, 0x80, 0x80, 0x80, 0xE0, 0x00, 0x43, 0xE0, 0x07,
+  0x4B, 0x40, 0xCF, 0xE0, 0x07, 0x13, 0xE0, 0x07, 0x0F, 0xC0, 0x53, 0xC0,
+  0x4F, 0xE0, 0x03, 0xEF, 0x40, 0x7B, 0xE0, 0x03, 0x8B, 0xC0, 0x23, 0x40,
+  0x17, 0xC0, 0x03, 0xE0, 0x07, 0x4F, 0xC0, 0x17, 0x41, 0x0F, 0x41, 0x27,
+  0x02, 0x7C, 0x7C, 0x7C, 0xE0, 0x10, 0x23, 0xC0, 0x3B, 0xC0, 0x83, 0xC0,
+  0x3B, 0xE0, 0x0B, 0x07, 0xC0, 0x7B, 0xE0, 0x07, 0x9F, 0xC0, 0x2B, 0xC0,
+  0x4B, 0xC0, 0x0F, 0xC0, 0x07, 0x40, 0x83, 0x40, 0x0B, 0xC0, 0x63, 0x40,
+  0x27, 0x40, 0xD3, 0xC0, 0x17, 0x02, 0x7A, 0x7A, 0x7A, 0xE0, 0x00, 0x0B,
+  0x40, 0x27, 0xE0, 0x03, 0x03, 0x40, 0x27, 0x40, 0xC7, 0x40, 0x03, 0xE0,
+  0x03, 0x17, 0xC0, 0x4B, 0xE0, 0x03, 0x13, 0x40, 0x9F, 0x02, 0x47, 0x47,
+  0x47, 0x62, 0xD3, 0x22, 0xD7, 0xE3, 0xDC, 0xFF, 0x43, 0xDB, 0x43, 0xD3,
+  0x40, 0x03, 0x43, 0xCF, 0xE0, 0x03, 0x0F, 0x40, 0x13, 0xE0, 0x07, 0x0F,
+  0x40, 0x23, 0x40, 0x03, 0xC0, 0x17, 0x41, 0x26, 0x43, 0xFF, 0x41, 0x8B,
+  0x03, 0x04, 0x04, 0x04, 0xBA, 0xE0, 0x13, 0x03, 0x01, 0x0B, 0x0B, 0x80,
+  0x1F, 0x01, 0x08, 0x09, 0x80, 0x07, 0xE0, 0x07, 0x2B, 0x02, 0x73, 0x73,
+  0x73, 0x61, 0xAF, 0x42, 0x1F, 0x41, 0xE3, 0x40, 0x1F, 0x01, 0x0D, 0x0E,
+  0xE0, 0x09, 0x27, 0x40, 0x17, 0xE0, 0x0F, 0x03, 0xC0, 0x5B, 0x03, 0x06,
+  0x06, 0x04, 0xBA, 0x43, 0x57, 0x41, 0xDF, 0x40, 0x4F, 0x40, 0x07, 0x40,
+  0x33, 0x40, 0x17, 0x40, 0x07, 0x40, 0x03, 0xC0, 0x2B, 0x40, 0x0B, 0x40,
+  0x03, 0xE0, 0x07, 0x1B, 0xE0, 0x03, 0x0F, 0x40, 0x0B, 0x40, 0x47, 0x42,
+  0x47, 0x40, 0x07, 0xC0, 0x4F, 0x40, 0x37, 0xE0, 0x0B, 0x03, 0x40, 0x2F,
+  0xE0, 0x0B, 0x17, 0xE0, 0x03, 0x13, 0xC0, 0x47, 0x40, 0x07, 0x42, 0x8F,
+  0xE0, 0x03, 0x1B, 0xE0, 0x07, 0x0B, 0x01, 0x0F, 0x10, 0xE0, 0x15, 0x53,
+  0x40, 0x6F, 0x40, 0x47, 0x44, 0x2F, 0x40, 0x07, 0xC0, 0x9F, 0x40, 0x17,
+  0xC0, 0x4B, 0x40, 0x0B, 0x40, 0x47, 0xC0, 0x0F, 0xE0, 0x03, 0x07, 0xE1,
+  0x07, 0x0B, 0x40, 0x1B, 0x40, 0x47, 0x41, 0x87, 0x40, 0x07, 0xE0, 0x0B,
+  0x4F, 0xC1, 0xCF, 0x40, 0x2B, 0xE0, 0x0B, 0x03, 0x40, 0x6F, 0xE0, 0x03,
+  0x17, 0xC0, 0x47, 0xC0, 0x07, 0xE0, 0x03, 0x1B, 0xE0, 0x07, 0x2B, 0xE0,
+  0x0B, 0x8F, 0xE0, 0x03, 0x2F, 0x40, 0x1F, 0xC0, 0x47, 0x41, 0xE7, 0xE1,
+  0x0B, 0x3F, 0xE0, 0x07, 0x53, 0x40, 0x3F, 0x40, 0xB3, 0x40, 0x3B, 0xE0,
+  0x0B, 0x1B, 0x40, 0x4F, 0xE3, 0x8F, 0xFF, 0x2C, 0x87, 0x43, 0x6B, 0xE0,
+  0x48, 0x00, 0x47, 0xCB, 0x02, 0x6C, 0x6C, 0x6C, 0xE3, 0x00, 0xCF, 0x40,
+  0x0F, 0x43, 0xDF, 0xC3, 0xFB, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x0F, 0xC0,
+  0x07, 0x43, 0xFB, 0xC0, 0x0B, 0x20, 0x90, 0x6B, 0xDB, 0x45, 0x67, 0x41,
+  0x5F, 0x06, 0x1B, 0x1D, 0x04, 0xBA, 0x27, 0x25, 0x05, 0x60, 0x03, 0x01,
+  0x19, 0x1A, 0xA0, 0x0B, 0x05, 0x24, 0x06, 0xBA, 0x2E, 0x2A, 0x0B, 0x60,
+  0x07, 0x60, 0x1B, 0x20, 0x0F, 0x01, 0x16, 0x18, 0xA0, 0x1B, 0xA0, 0x2B,
+  0x40, 0x07, 0x41, 0x7F, 0x47, 0x27, 0x40, 0x07, 0xC1, 0xCF, 0x60, 0x37,
+  0xE0, 0x02, 0x23, 0xE0, 0x07, 0x0B, 0x0A, 0x25, 0x24, 0x04, 0xBA, 0x2C,
+  0x28, 0x08, 0xBA, 0x2A, 0x26, 0x07, 0xE0, 0x00, 0x7B, 0x02, 0x20, 0x22,
+  0x05, 0x60, 0x0F, 0x02, 0x84, 0x84, 0x84, 0x62, 0xB7, 0x40, 0x4F, 0xC2,
+  0xBF, 0xE0, 0x07, 0x3F, 0x40, 0x0F, 0x02, 0x2A, 0x25, 0x07, 0x60, 0x07,
+  0x40, 0x97, 0x40, 0x0F, 0xC0, 0x03, 0x40, 0x5B, 0x40, 0xCF, 0x00, 0x22,
+  0x20, 0x4F, 0x40, 0x53, 0x42, 0x67, 0x40, 0x47, 0x47, 0x0F, 0x40, 0x07,
+  0x40, 0xEF, 0x40, 0x2B, 0x40, 0x27, 0x40, 0x07, 0x02, 0x2E, 0x2B, 0x0A,
+  0x60, 0x07, 0xC0, 0x33, 0x40, 0x13, 0xC0, 0x03, 0xE1, 0x00, 0x0B, 0xC0,
+  0xCB, 0x21, 0x03, 0xC0, 0x97, 0x40, 0x07, 0x43, 0x67, 0xE0, 0x07, 0x4F,
+  0x40, 0x77, 0x40, 0x5B, 0x40, 0x4F, 0x40, 0x37, 0xC0, 0x0F, 0x40, 0x0B,
+  0xC0, 0x4F, 0x02, 0x30, 0x2D, 0x0E, 0xE0, 0x00, 0x17, 0x40, 0x47, 0x40,
+  0x97, 0x47, 0x0F, 0xC1, 0x3F, 0x40, 0x2B, 0x01, 0x1D, 0x20, 0x80, 0x07,
+  0x40, 0x0B, 0x41, 0x27, 0x40, 0x07, 0xE0, 0x03, 0x03, 0x40, 0x4B, 0x40,
+  0xDF, 0x40, 0x13, 0x40, 0xC3, 0xC0, 0x6F, 0x45, 0x8F, 0x40, 0x4F, 0xC0,
+  0x57, 0x40, 0x9F, 0xE0, 0x03, 0x4B, 0x40, 0x2F, 0xE0, 0x04, 0x03, 0x20,
+  0xD3, 0x41, 0x8B, 0xC0, 0x4B, 0x60, 0x07, 0x20, 0x13, 0xC0, 0x73, 0x40,
+  0x47, 0x42, 0x27, 0x40, 0x07, 0x40, 0x57, 0x43, 0x83, 0xC0, 0x3F, 0x40,
+  0xE7, 0x40, 0x03, 0x40, 0x0F, 0xC0, 0x07, 0x40, 0x0B, 0xE0, 0x03, 0x03,
+  0x40, 0x17, 0x40, 0x03, 0x40, 0xA3, 0x40, 0x17, 0x49, 0xDF, 0x40, 0x47,
+  0xC0, 0x4F, 0x40, 0x9F, 0x41, 0x23, 0x40, 0x1B, 0x40, 0x27, 0xC0, 0x0B,
+  0x40, 0x0F, 0xC0, 0x83, 0xE0, 0x03, 0x8F, 0x41, 0x3B, 0x40, 0x1B, 0x01,
+  0x30, 0x2C, 0x80, 0x07, 0x40, 0x47, 0xE3, 0xEB, 0xFF, 0xC3, 0xDB, 0x43,
+  0xD7, 0x43, 0xFB, 0xC3, 0xDB, 0xC0, 0x17, 0x40, 0x13, 0x40, 0x0B, 0x44,
+  0x27, 0x40, 0x07, 0x40, 0x1F, 0xC0, 0x13, 0x43, 0xFF, 0x47, 0xFF, 0x41,
+  0x87, 0x41, 0x7F, 0x41, 0x4F, 0xE0, 0x03, 0x03, 0x41, 0x87, 0xE0, 0x07,
+  0x0F, 0x40, 0x13, 0xE1, 0x00, 0x8F, 0xE3, 0x0E, 0x0F, 0xE0, 0x03, 0x4F,
+  0x40, 0x2F, 0xC0, 0x27, 0xE0, 0x03, 0x0B, 0xC0, 0x13, 0x41, 0xBF, 0x63,
+  0xC3, 0x22, 0x6B, 0x40, 0x13, 0x42, 0x1F, 0x42, 0xC3, 0x41, 0xCF, 0x40,
+  0x47, 0xC0, 0x07, 0x42, 0x6F, 0x42, 0xEB, 0x40, 0x23, 0xC0, 0x03, 0x62,
+  0xA3, 0xC0, 0x83, 0xE0, 0x06, 0x07, 0x40, 0x6B, 0xE2, 0x03, 0x43, 0x42,
+  0x6F, 0x43, 0x57, 0x40, 0x4F, 0xE3, 0x03, 0xAF, 0xC0, 0x37, 0x42, 0xFB,
+  0xC0, 0x0B, 0x40, 0x07, 0xC0, 0x5B, 0x40, 0x8F, 0x40, 0x0F, 0xE0, 0x07,
+  0x03, 0x02, 0x85, 0x85, 0x85, 0xE0, 0x04, 0x9F, 0x48, 0xEB, 0x40, 0x23,
+  0x40, 0xBB, 0x40, 0x7B, 0x40, 0xD7, 0x40, 0x0F, 0x60, 0x03, 0xA0, 0xDB,
+  0x40, 0x0B, 0xE0, 0x07, 0x4F, 0xC5, 0x4B, 0xC4, 0x9F, 0x40, 0x9F, 0x40,
+  0xF7, 0xE1, 0x03, 0x8F, 0x40, 0x9B, 0x02, 0x33, 0x2E, 0x10, 0xE0, 0x04,
+  0xCF, 0x40, 0x4B, 0xC0, 0x03, 0x40, 0x6F, 0xC0, 0x0B, 0x40, 0x7F, 0x41,
+  0x27, 0x44, 0x47, 0x43, 0xAF, 0x45, 0x47, 0x40, 0x07, 0xC0, 0x4F, 0x40,
+  0x4B, 0xE1, 0x07, 0xBF, 0x61, 0x7F, 0xA1, 0x3F, 0xC4, 0x23, 0xE0, 0x07,
+  0xA7, 0x40, 0x97, 0x40, 0x47, 0x40, 0x07, 0xE0, 0x07, 0x9F, 0x40, 0x3B,
+  0xC0, 0x83, 0x40, 0x7F, 0x40, 0xAB, 0x40, 0x13, 0x40, 0xF7, 0x40, 0x0F,
+  0xE1, 0x03, 0x87, 0x60, 0x17, 0x20, 0x6B, 0x40, 0x47, 0x41, 0x87, 0x40,
+  0x07, 0x40, 0x57, 0xC0, 0x9F, 0x40, 0x47, 0xE0, 0x00, 0x2F, 0x21, 0x37,
+  0x40, 0xAF, 0x40, 0x43, 0x40, 0x07, 0xE0, 0x03, 0xB7, 0x41, 0x9F, 0xE0,
+  0x03, 0x13, 0x40, 0x47, 0xE3, 0xE7, 0xFF, 0x43, 0xCF, 0x43, 0xCB, 0x43,
+  0xD3, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x13, 0xC0, 0x03, 0x40,
+  0x13, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x07, 0xC0, 0x03, 0x44, 0x2F, 0x43,
+  0xFF, 0x00, 0x93, 0x33, 0xEF, 0x4B, 0x17, 0xC1, 0x7F, 0x41, 0x53, 0x41,
+  0x9F, 0x42, 0x43, 0x40, 0x07, 0x41, 0x8F, 0x40, 0x03, 0x40, 0x0B, 0x41,
+  0x7F, 0xC0, 0x1F, 0x40, 0x0F, 0x40, 0x03, 0xC0, 0x0F, 0x41, 0x7F, 0xC1,
+  0xCF, 0x42, 0x1F, 0x49, 0xA7, 0x40, 0x1F, 0x40, 0x03, 0x40, 0x37, 0x40,
+  0x07, 0xE0, 0x08, 0x03, 0x21, 0xDF, 0xE0, 0x08, 0x13, 0x22, 0x1B, 0x40,
+  0x03, 0xE0, 0x07, 0x4F, 0xC0, 0x9F, 0xC0, 0x33, 0xE0, 0x03, 0x53, 0xC2,
+  0xBF, 0xC0, 0x13, 0x42, 0x2F, 0x40, 0x43, 0x40, 0x07, 0x68, 0x83, 0x20,
+  0x67, 0xE3, 0x07, 0x5F, 0x44, 0x4F, 0x40, 0x23, 0x60, 0x03, 0x20, 0x1F,
+  0x60, 0x07, 0x20, 0x7B, 0x40, 0xEB, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x03,
+  0xE3, 0x07, 0x07, 0x40, 0x13, 0x42, 0x9F, 0x40, 0x9F, 0x40, 0xE7, 0x44,
+  0x07, 0x44, 0x57, 0x40, 0x9F, 0x60, 0x37, 0x20, 0x4B, 0xE0, 0x00, 0x33,
+  0x20, 0x0B, 0x40, 0x2F, 0xC3, 0x53, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x97,
+  0x40, 0x07, 0x40, 0x03, 0xC1, 0x3F, 0x47, 0xAF, 0x4D, 0x87, 0xC0, 0x57,
+  0x40, 0x4F, 0xE0, 0x03, 0x27, 0x40, 0x2B, 0xE0, 0x07, 0x03, 0xC0, 0xEF,
+  0x40, 0x17, 0xE4, 0x04, 0x6F, 0x20, 0xC7, 0x43, 0xFF, 0x40, 0x97, 0x40,
+  0x9F, 0x40, 0xA7, 0x40, 0x4F, 0x40, 0x17, 0x40, 0xBB, 0x40, 0x07, 0x40,
+  0x03, 0xE0, 0x03, 0x3F, 0xC0, 0xA3, 0x61, 0xF7, 0x20, 0xB7, 0x61, 0x53,
+  0x20, 0x07, 0x43, 0x67, 0x40, 0x2B, 0xC9, 0x37, 0xE0, 0x13, 0x9F, 0x41,
+  0x6B, 0x60, 0x37, 0x20, 0x7F, 0xE0, 0x07, 0x03, 0x40, 0xCB, 0x41, 0x17,
+  0x40, 0x03, 0x40, 0x1B, 0xC0, 0x47, 0xC0, 0x07, 0xC0, 0x9F, 0xC0, 0x87,
+  0x40, 0x7B, 0xC0, 0x9F, 0x40, 0x33, 0x40, 0x87, 0x40, 0x03, 0x40, 0x3B,
+  0x40, 0x4B, 0x40, 0x07, 0x60, 0x0F, 0x20, 0xA3, 0x40, 0x73, 0x40, 0x47,
+  0xE3, 0xE7, 0xFF, 0x43, 0xC3, 0xE3, 0x03, 0xD7, 0x53, 0xF7, 0xE3, 0x03,
+  0xDF, 0x40, 0x1F, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x03, 0x40, 0x0B, 0x44,
+  0x1F, 0xC0, 0x07, 0xC3, 0xFF, 0xC2, 0x1F, 0x42, 0x8B, 0x41, 0x6B, 0x41,
+  0x5B, 0xC1, 0x63, 0x40, 0x0B, 0xC0, 0x03, 0x41, 0x6F, 0x41, 0xE3, 0xC0,
+  0x0F, 0x40, 0x07, 0xC0, 0x2F, 0x41, 0x7F, 0x40, 0x47, 0x40, 0x07, 0xE5,
+  0x03, 0xCF, 0x41, 0x9F, 0x40, 0x4B, 0xC2, 0x77, 0x41, 0xAB, 0x40, 0x37,
+  0x40, 0x03, 0xC1, 0xDF, 0x40, 0x23, 0x40, 0x0F, 0xC0, 0x03, 0x43, 0x47,
+  0x40, 0x47, 0xC0, 0x4F, 0x42, 0xC7, 0xC2, 0x1F, 0xE0, 0x03, 0x3F, 0xC0,
+  0x2F, 0x40, 0x07, 0xC2, 0x37, 0x40, 0x8F, 0x40, 0x6F, 0x40, 0x13, 0x40,
+  0x03, 0x40, 0xB3, 0x40, 0xD7, 0xE3, 0x07, 0xFF, 0x40, 0x4F, 0x40, 0x67,
+  0x40, 0x03, 0x40, 0x27, 0xC7, 0x87, 0x40, 0x3F, 0xC0, 0x8F, 0x40, 0x3B,
+  0x40, 0x1B, 0xC0, 0x03, 0x40, 0x57, 0xC0, 0x67, 0xE0, 0x03, 0x9F, 0x40,
+  0xEF, 0xE4, 0x03, 0x4F, 0xC0, 0x37, 0x40, 0x07, 0xC0, 0xF7, 0xC0, 0x43,
+  0xC0, 0x07, 0x40, 0x4B, 0xC0, 0x7B, 0x40, 0x13, 0xE0, 0x03, 0x4F, 0x40,
+  0xF7, 0x40, 0x9F, 0x40, 0x23, 0x40, 0x97, 0x60, 0x27, 0x22, 0xE7, 0x40,
+  0x27, 0x40, 0x13, 0x02, 0x33, 0x2E, 0x11, 0xE0, 0x00, 0x0F, 0x40, 0x13,
+  0x40, 0x67, 0x41, 0x17, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x13, 0x47, 0xF7,
+  0x40, 0x47, 0xC0, 0x57, 0x40, 0x9F, 0x60, 0x47, 0x23, 0x9B, 0x41, 0x77,
+  0xC0, 0x0B, 0x40, 0x0F, 0xC0, 0x5B, 0x40, 0x3F, 0x60, 0x0F, 0x20, 0x23,
+  0x40, 0x03, 0x01, 0x33, 0x2F, 0xE0, 0x01, 0x67, 0xC0, 0x4F, 0x44, 0xA7,
+  0x57, 0x67, 0x40, 0x4F, 0x40, 0x23, 0x4B, 0x87, 0xC1, 0x13, 0x40, 0x0F,
+  0x41, 0x3F, 0x40, 0x03, 0x40, 0xF7, 0xE0, 0x04, 0x63, 0xA0, 0x53, 0xC0,
+  0x07, 0x40, 0x97, 0x41, 0xD7, 0x40, 0x07, 0x40, 0xA7, 0x40, 0xEF, 0xC4,
+  0xC3, 0x40, 0xF3, 0xC0, 0x93, 0xC0, 0x2F, 0xC0, 0x07, 0x41, 0xCB, 0xC0,
+  0x0B, 0xC0, 0xEB, 0x40, 0x0F, 0x41, 0xDF, 0xE3, 0x7F, 0xFF, 0x2F, 0xEE,
+  0xE0, 0x18, 0x00, 0x23, 0x7B, 0xE0, 0x38, 0x00, 0xC3, 0xD3, 0x40, 0x07,
+  0x40, 0x03, 0x43, 0xDB, 0x40, 0x03, 0x43, 0xDF, 0x40, 0x03, 0x40, 0x0B,
+  0x44, 0x1F, 0x40, 0x07, 0x40, 0x03, 0x40, 0x13, 0x40, 0x03, 0x40, 0x0B,
+  0x40, 0x03, 0x20, 0x80, 0x67, 0xFF, 0xC1, 0x7F, 0x41, 0x47, 0x42, 0x1B,
+  0x40, 0x07, 0xE3, 0x07, 0xE7, 0x40, 0x13, 0xE0, 0x0F, 0x03, 0x41, 0xFF,
+  0xC1, 0xC7, 0xC0, 0x07, 0x41, 0xCF, 0xE0, 0x03, 0x2F, 0xE1, 0x03, 0xAB,
+  0xE0, 0x03, 0x17, 0x40, 0x6F, 0x42, 0x2F, 0xC0, 0x13, 0xC0, 0x0B, 0x41,
+  0xCF, 0x40, 0x97, 0xE0, 0x03, 0x4F, 0xE2, 0x07, 0x9F, 0x62, 0x5F, 0xA3,
+  0x17, 0x40, 0x3F, 0xC0, 0x3B, 0x40, 0x0B, 0x40, 0x03, 0xE0, 0x03, 0xC3,
+  0x40, 0x47, 0xE7, 0x03, 0x5F, 0xC2, 0xBF, 0x60, 0x27, 0xAF, 0xFB, 0x40,
+  0x0B, 0x43, 0x5F, 0x40, 0x07, 0xE0, 0x07, 0x03, 0x42, 0x93, 0x42, 0x7B,
+  0x42, 0xD7, 0x40, 0xB3, 0x4C, 0x4F, 0xC0, 0x9F, 0x42, 0xC7, 0xC0, 0xEF,
+  0x40, 0xE7, 0xC0, 0x43, 0x40, 0x57, 0x40, 0x33, 0xE0, 0x04, 0x4B, 0x20,
+  0xAF, 0xC0, 0x1F, 0xC0, 0x17, 0x40, 0xA7, 0x43, 0x5F, 0xE0, 0x03, 0x9F,
+  0xC0, 0x4F, 0x40, 0x23, 0x40, 0x47, 0x40, 0x07, 0x60, 0xEF, 0xA3, 0x47,
+  0x67, 0xA7, 0xA0, 0x0B, 0xE0, 0x04, 0x07, 0x20, 0x5F, 0x40, 0x1B, 0x47,
+  0xFF, 0x40, 0x9F, 0x02, 0x8B, 0x8B, 0x8B, 0x60, 0x07, 0xE0, 0x03, 0xEF,
+  0x40, 0x47, 0x40, 0xA7, 0x40, 0x37, 0xE0, 0x03, 0x8B, 0x40, 0x17, 0x40,
+  0x13, 0x40, 0x43, 0x40, 0x07, 0xC0, 0x77, 0x40, 0xEF, 0x41, 0x3F, 0x40,
+  0xE7, 0x40, 0x07, 0x40, 0x57, 0xE0, 0x03, 0x9F, 0x40, 0x2B, 0x60, 0x03,
+  0x20, 0x7B, 0x40, 0x07, 0x41, 0x2B, 0x40, 0x07, 0xE0, 0x03, 0x5B, 0x40,
+  0x0F, 0xE0, 0x00, 0x5F, 0x20, 0xB7, 0xC0, 0x47, 0xC0, 0x07, 0xC0, 0x4F,
+  0x40, 0xBB, 0x40, 0x03, 0x40, 0x23, 0xC0, 0x03, 0x41, 0x1F, 0xC0, 0x0B,
+  0xE0, 0x0F, 0x07, 0x40, 0x47, 0xE3, 0x7F, 0xFF, 0xE0, 0x07, 0x00, 0x44,
+  0x0C, 0xE0, 0x07, 0x13, 0xE0, 0x3B, 0x00, 0x43, 0xC3, 0x43, 0xCF, 0x40,
+  0x03, 0xC0, 0x0B, 0xC0, 0x07, 0x43, 0xF7, 0xC0, 0x17, 0xC0, 0x13, 0x40,
+  0x0F, 0x40, 0x03, 0xC0, 0x1B, 0x20, 0x83, 0xE3, 0x08, 0xFF, 0x61, 0x5F,
+  0xA1, 0xC7, 0x40, 0x0B, 0x43, 0xDB, 0x40, 0x07, 0xE1, 0x07, 0xCB, 0xC3,
+  0x8B, 0xC1, 0xEB, 0x41, 0x7F, 0x47, 0x07, 0xC2, 0x77, 0xE2, 0x00, 0x6F,
+  0xE0, 0x02, 0x4B, 0x45, 0xDF, 0x40, 0x47, 0xE1, 0x03, 0xDF, 0x43, 0x4F,
+  0x40, 0x5F, 0xE0, 0x07, 0x67, 0x40, 0x4F, 0x42, 0x67, 0xC0, 0x07, 0xC2,
+  0x1F, 0x40, 0x2B, 0x60, 0x03, 0x20, 0x57, 0x42, 0xC3, 0xC2, 0xA3, 0xE2,
+  0x00, 0x5B, 0x20, 0x17, 0x40, 0x1F, 0x40, 0x6B, 0x40, 0x07, 0xC0, 0x03,
+  0x40, 0x47, 0xEC, 0x03, 0x9F, 0x40, 0x4F, 0xC3, 0x9B, 0x40, 0xCB, 0x40,
+  0x4B, 0x42, 0xE7, 0x40, 0x3F, 0x40, 0x07, 0x40, 0x1B, 0x40, 0x07, 0x40,
+  0x9F, 0x40, 0xB3, 0x40, 0x07, 0x40, 0x4B, 0x40, 0x27, 0x4E, 0xDF, 0x40,
+  0x4F, 0x02, 0x4D, 0x4D, 0x4D, 0x60, 0x9F, 0x40, 0x57, 0xE0, 0x00, 0xEF,
+  0x22, 0xDB, 0xE0, 0x03, 0x03, 0x40, 0x5B, 0xE0, 0x03, 0x0F, 0x40, 0x5F,
+  0xE0, 0x03, 0x0F, 0x40, 0x4F, 0x40, 0x0F, 0x41, 0x37, 0x41, 0x3F, 0xEB,
+  0x07, 0xAF, 0x40, 0x1B, 0xE0, 0x07, 0x03, 0x40, 0x33, 0x40, 0x03, 0xC0,
+  0x17, 0x40, 0x9B, 0x40, 0xA3, 0x40, 0x0F, 0xC0, 0x6F, 0x40, 0x9F, 0x44,
+  0x4F, 0x5B, 0x17, 0x41, 0x47, 0x40, 0xEF, 0x40, 0x1F, 0xC0, 0x03, 0x61,
+  0x2F, 0x41, 0x2B, 0x20, 0x03, 0x40, 0xEB, 0xC0, 0x17, 0x40, 0x4B, 0x40,
+  0x43, 0xE0, 0x03, 0x13, 0x41, 0x63, 0x40, 0x4F, 0x40, 0x47, 0x47, 0xFF,
+  0x44, 0x07, 0x40, 0x4F, 0xC0, 0x73, 0xC0, 0x8B, 0x48, 0x0B, 0x60, 0x57,
+  0x21, 0x03, 0x40, 0x33, 0x40, 0x0B, 0x40, 0x23, 0x40, 0x53, 0x40, 0x13,
+  0x40, 0x0B, 0xC3, 0xCB, 0x40, 0xEF, 0x40, 0x4F, 0xC5, 0xE7, 0x4E, 0x2F,
+  0xE0, 0x07, 0x73, 0xC2, 0x27, 0x40, 0x37, 0x40, 0x4B, 0x40, 0x43, 0xE0,
+  0x03, 0x03, 0xE0, 0x03, 0x2F, 0x45, 0x8F, 0xE3, 0xEB, 0xFF, 0x43, 0xDB,
+  0xC3, 0xCF, 0xC3, 0xDB, 0xE0, 0x03, 0x0F, 0x40, 0x13, 0xC0, 0x03, 0x48,
+  0x23, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x37, 0xC3, 0xFF, 0x42, 0x77, 0x41,
+  0xCF, 0x41, 0x5B, 0x42, 0xF3, 0x41, 0x6F, 0x40, 0x0B, 0x60, 0x03, 0x22,
+  0x1F, 0xC1, 0xDF, 0x41, 0xBB, 0xC1, 0xCB, 0x40, 0x1B, 0x41, 0x93, 0x40,
+  0x13, 0x40, 0x0B, 0x42, 0x1F, 0x42, 0x17, 0x40, 0x07, 0x41, 0xD7, 0x41,
+  0xCF, 0xC0, 0x37, 0x40, 0x4F, 0x40, 0x2B, 0x40, 0x27, 0xE0, 0x03, 0x03,
+  0x40, 0x17, 0x40, 0x0F, 0xE1, 0x03, 0xC7, 0x40, 0x27, 0xC3, 0x5F, 0x40,
+  0x47, 0xE0, 0x0B, 0x4F, 0x40, 0x83, 0x40, 0x27, 0x40, 0x3B, 0xC4, 0x37,
+  0x40, 0x0B, 0x60, 0x03, 0x20, 0xAF, 0x60, 0x07, 0x22, 0x83, 0xE0, 0x03,
+  0x03, 0xC0, 0x47, 0xC0, 0x07, 0x40, 0xEF, 0x40, 0x9F, 0x40, 0x47, 0x40,
+  0x4F, 0x40, 0x0B, 0xC0, 0x8F, 0xE0, 0x03, 0x37, 0xC0, 0x0B, 0x43, 0x13,
+  0xC0, 0x0B, 0x40, 0x63, 0xC0, 0x47, 0x42, 0xBF, 0xC1, 0x3F, 0x60, 0x8B,
+  0xE0, 0x06, 0x7F, 0x41, 0x4F, 0xE0, 0x00, 0x37, 0xA0, 0x93, 0x40, 0xDF,
+  0x60, 0x0B, 0x20, 0x2B, 0x43, 0x27, 0x40, 0x0B, 0xCF, 0x5F, 0x40, 0x4F,
+  0x44, 0x4F, 0x5A, 0xEB, 0x40, 0x17, 0x40, 0x97, 0xC1, 0x63, 0x40, 0x0F,
+  0x40, 0x03, 0x60, 0x33, 0x20, 0x3B, 0x40, 0x0B, 0x40, 0x03, 0x60, 0x77,
+  0xA0, 0x5B, 0x45, 0x8F, 0x4B, 0xB7, 0x40, 0x9F, 0x43, 0xFF, 0x40, 0x07,
+  0x41, 0x47, 0x40, 0xEF, 0xC0, 0x23, 0x40, 0x07, 0xE0, 0x00, 0xEB, 0xE0,
+  0x02, 0x47, 0x40, 0x17, 0xE0, 0x0F, 0x03, 0xC3, 0xAF, 0xE0, 0x0B, 0x4F,
+  0x40, 0x7F, 0x40, 0xA7, 0x60, 0x3B, 0xE0, 0x0F, 0x4F, 0x20, 0x17, 0x41,
+  0x6B, 0x60, 0xBB, 0x20, 0xAB, 0x40, 0x47, 0x40, 0xE7, 0x40, 0x07, 0x40,
+  0x9F, 0xE5, 0x00, 0x3F, 0x20, 0x27, 0x41, 0x6B, 0x40, 0x2B, 0x41, 0x3B,
+  0xC0, 0xA7, 0xC0, 0x5F, 0x40, 0x1B, 0xE2, 0x03, 0x2F, 0x40, 0x4B, 0x40,
+  0x03, 0x40, 0x47, 0xE3, 0xEF, 0xFF, 0x43, 0xCF, 0x43, 0xD7, 0x40, 0x03,
+  0xC0, 0x0B, 0x43, 0xDF, 0x44, 0x07, 0x40, 0x13, 0x40, 0x03, 0x40, 0x17,
+  0x40, 0x13, 0x40, 0x03, 0xD0, 0x27, 0xC3, 0xFF, 0x41, 0x7F, 0x42, 0x1F,
+  0x41, 0xC7, 0x41, 0x7F, 0x41, 0x4F, 0xC1, 0x67, 0x41, 0x87, 0x40, 0x03,
+  0x40, 0x13, 0xC0, 0x03, 0xC1, 0x93, 0x40, 0x0F, 0xC0, 0x1B, 0xCA, 0x67,
+  0x46, 0x1F, 0xC0, 0x4F, 0x40, 0x1F, 0xE0, 0x03, 0x03, 0xC0, 0x2B, 0x40,
+  0x67, 0xC0, 0x0B, 0x40, 0x6F, 0xC2, 0x13, 0xC5, 0xEF, 0x40, 0x1B, 0x41,
+  0xCF, 0x40, 0x47, 0x02, 0x89, 0x89, 0x89, 0x60, 0x07, 0x40, 0x9F, 0x60,
+  0x77, 0x22, 0x1F, 0x40, 0x1F, 0xE0, 0x03, 0x57, 0x42, 0x27, 0x46, 0x7B,
+  0xC0, 0x13, 0xE0, 0x07, 0x1F, 0x43, 0xDF, 0xC3, 0x5F, 0xC0, 0x57, 0x40,
+  0x4F, 0x40, 0x27, 0x40, 0x3B, 0x6F, 0x4F, 0x22, 0x93, 0x40, 0x5F, 0x40,
+  0x0F, 0x40, 0x0B, 0xE0, 0x08, 0x03, 0x20, 0x77, 0x40, 0x1F, 0xC0, 0x17,
+  0x43, 0x0F, 0x55, 0x37, 0x40, 0x57, 0x48, 0x07, 0xE2, 0x00, 0xBF, 0x20,
+  0x47, 0x40, 0x57, 0xC0, 0x2B, 0x40, 0x0B, 0x40, 0x13, 0xC0, 0x03, 0x42,
+  0xBB, 0x40, 0x13, 0xC2, 0xCF, 0x40, 0x07, 0x41, 0x6B, 0xEB, 0x0B, 0xFF,
+  0xC0, 0x43, 0xC0, 0x3B, 0xE0, 0x03, 0x07, 0x40, 0x47, 0xC0, 0x0F, 0x40,
+  0x3F, 0x40, 0x9F, 0x40, 0xE7, 0x40, 0x13, 0x40, 0x1B, 0xC0, 0xE7, 0x40,
+  0x9F, 0x41, 0x47, 0x60, 0x9F, 0x20, 0xC3, 0x40, 0x1F, 0x44, 0x1F, 0x44,
+  0x83, 0xC0, 0x5F, 0x40, 0x37, 0x40, 0x33, 0x40, 0x1B, 0xE0, 0x0B, 0x03,
+  0x40, 0x1F, 0xC0, 0x4F, 0x40, 0xF7, 0x40, 0x4F, 0x41, 0x3F, 0x60, 0x2B,
+  0x20, 0x53, 0x40, 0xCF, 0x40, 0x07, 0x40, 0x0F, 0x41, 0xDB, 0xC0, 0x57,
+  0x41, 0x4B, 0x44, 0x8F, 0x40, 0x17, 0xE0, 0x03, 0x03, 0x40, 0xAF, 0xC0,
+  0x4F, 0x40, 0x07, 0x5E, 0x37, 0xE0, 0x00, 0x4F, 0x21, 0x3F, 0xC0, 0x03,
+  0x40, 0x4B, 0xC0, 0x0B, 0xE0, 0x03, 0x07, 0xE0, 0x03, 0x6F, 0xC2, 0x33,
+  0x40, 0x47, 0xE3, 0xEB, 0xFF, 0x43, 0xD7, 0x40, 0x03, 0x43, 0xD7, 0x40,
+  0x03, 0xE3, 0x03, 0xEB, 0x5B, 0xF3, 0x40, 0x13, 0x40, 0x03, 0x40, 0x23,
+  0x44, 0x0F, 0xE0, 0x03, 0x0B, 0xE3, 0x07, 0xFF, 0x41, 0x97, 0xE1, 0x03,
+  0x67, 0xC1, 0xC7, 0x43, 0x9F, 0x61, 0x73, 0xE1, 0x02, 0x9B, 0x62, 0x2F,
+  0x21, 0xFB, 0x40, 0x13, 0x40, 0x1F, 0xC3, 0xF7, 0xC2, 0x1F, 0x01, 0x0F,
+  0x10, 0xE1, 0x01, 0xBB, 0x42, 0xE3, 0x40, 0x27, 0x40, 0x03, 0xC6, 0xCB,
+  0x60, 0x6B, 0x20, 0x3F, 0x40, 0x63, 0x40, 0x5B, 0x40, 0x43, 0x40, 0x1F,
+  0xC0, 0x03, 0x41, 0xCF, 0x42, 0x67, 0x40, 0x07, 0x02, 0x6B, 0x6B, 0x6B,
+  0x62, 0x1F, 0x40, 0x2B, 0xC0, 0x1F, 0x40, 0x33, 0x42, 0x97, 0x40, 0x13,
+  0x40, 0x03, 0xE0, 0x03, 0x63, 0x40, 0x23, 0x40, 0x13, 0x40, 0x07, 0x40,
+  0x27, 0x40, 0x07, 0x40, 0x47, 0x40, 0x4F, 0x47, 0x5F, 0x40, 0x07, 0x48,
+  0x9F, 0xE2, 0x03, 0x5F, 0xC0, 0x2F, 0x40, 0x2B, 0x40, 0x97, 0x60, 0x9F,
+  0xE0, 0x02, 0xEF, 0xC0, 0xB7, 0x40, 0x4F, 0x40, 0x6B, 0x43, 0xAF, 0x40,
+  0x47, 0x4B, 0xAF, 0x48, 0xF7, 0xE2, 0x00, 0xBF, 0x20, 0xD3, 0x40, 0x37,
+  0x40, 0x27, 0x40, 0x07, 0x40, 0x03, 0xC0, 0x3B, 0x40, 0x0B, 0x40, 0xB3,
+  0x40, 0x5B, 0x40, 0x1F, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x17, 0xC0, 0x9F,
+  0xC0, 0x57, 0x40, 0x4F, 0x41, 0x13, 0x43, 0x43, 0x01, 0x14, 0x15, 0x20,
+  0x4B, 0x20, 0x57, 0xC2, 0xEB, 0x40, 0x2F, 0xC0, 0x03, 0x40, 0xB7, 0x40,
+  0x27, 0x40, 0xCB, 0x40, 0x97, 0x40, 0x2F, 0x40, 0x0F, 0x40, 0xE7, 0x41,
+  0x37, 0x40, 0x9F, 0x40, 0xA7, 0x40, 0x4F, 0x40, 0x1F, 0x40, 0x2F, 0xC0,
+  0x3B, 0x40, 0x07, 0x41, 0xC7, 0x40, 0x8B, 0x40, 0x0B, 0xC0, 0x03, 0x40,
+  0x0F, 0xC0, 0x97, 0x40, 0x13, 0x40, 0x37, 0xC0, 0x9F, 0xC1, 0xE7, 0x44,
+  0x4F, 0x40, 0xC7, 0xE0, 0x03, 0x4F, 0x40, 0x37, 0x40, 0x2F, 0xCD, 0x7B,
+  0xC0, 0x43, 0xC4, 0x03, 0x40, 0x47, 0x40, 0x1F, 0x40, 0x03, 0xC2, 0x27,
+  0x40, 0x57, 0x48, 0x07, 0x40, 0x9F, 0xE0, 0x03, 0x4B, 0x40, 0x23, 0xC0,
+  0x2F, 0x40, 0x57, 0xE0, 0x0B, 0xFB, 0x40, 0x23, 0xC0, 0x03, 0x40, 0x47,
+  0xE3, 0x8F, 0xFF, 0xE0, 0x4F, 0x00, 0xE3, 0x07, 0xD3, 0x43, 0xDB, 0x40,
+  0x03, 0xC4, 0x03, 0x40, 0x1F, 0xE0, 0x0B, 0x03, 0x40, 0x1F, 0x40, 0x03,
+  0x20, 0x97, 0x6F, 0xFF, 0x4A, 0x27, 0x41, 0xCF, 0xC1, 0x4B, 0x41, 0x87,
+  0x41, 0xDB, 0xC0, 0x0F, 0xC0, 0x07, 0x42, 0x5B, 0xC0, 0x0B, 0x40, 0x07,
+  0xE1, 0x00, 0x93, 0x22, 0x9B, 0x41, 0x7F, 0x41, 0xC7, 0x40, 0x07, 0xC2,
+  0x6F, 0x40, 0x23, 0xE0, 0x07, 0x03, 0xC0, 0x43, 0xC1, 0xDB, 0x40, 0x3B,
+  0x40, 0x03, 0x42, 0x87, 0xC2, 0xC3, 0x42, 0x37, 0xE2, 0x03, 0x1F, 0xE0,
+  0x07, 0x4F, 0x40, 0x77, 0x40, 0x47, 0xC0, 0x43, 0x40, 0x2F, 0x42, 0xF3,
+  0x40, 0x6B, 0x42, 0x2B, 0x40, 0x07, 0xC0, 0x03, 0x40, 0xCB, 0x40, 0x0B,
+  0x40, 0x4F, 0x40, 0x9F, 0x47, 0x0F, 0x40, 0x07, 0xE0, 0x03, 0xEF, 0x40,
+  0x1F, 0x40, 0x03, 0xC0, 0x3B, 0xC0, 0x4B, 0x40, 0x13, 0xE0, 0x0F, 0x03,
+  0x40, 0xE7, 0x40, 0x47, 0x40, 0x07, 0xE0, 0x03, 0x9F, 0x40, 0x93, 0x40,
+  0x47, 0xC1, 0x3F, 0x40, 0xD3, 0x40, 0x43, 0x40, 0xDF, 0x40, 0x1B, 0x40,
+  0x0B, 0x40, 0x07, 0x40, 0x1F, 0xC4, 0x17, 0x40, 0x0B, 0x40, 0x47, 0x4C,
+  0x47, 0xC0, 0x07, 0x44, 0x9F, 0x40, 0x2B, 0x40, 0x8B, 0x40, 0xDF, 0x40,
+  0x0B, 0xE0, 0x17, 0x03, 0xC0, 0xEB, 0x40, 0x27, 0x40, 0x47, 0x40, 0x97,
+  0xC0, 0x07, 0xE3, 0x0B, 0x5F, 0x40, 0x93, 0x40, 0x2B, 0xE0, 0x0B, 0x03,
+  0x40, 0xA3, 0xE0, 0x03, 0x17, 0x40, 0x47, 0x42, 0x27, 0x40, 0x07, 0x40,
+  0x57, 0x40, 0x4F, 0x60, 0x1F, 0x21, 0xFB, 0xE0, 0x0B, 0x47, 0x41, 0x9F,
+  0x60, 0x1F, 0xA5, 0x43, 0xE0, 0x07, 0x0F, 0x40, 0x47, 0xC1, 0x3F, 0x40,
+  0xF7, 0xC1, 0x8F, 0xE0, 0x07, 0x27, 0x40, 0xFB, 0x61, 0x27, 0x20, 0x67,
+  0x60, 0x4B, 0xA0, 0x07, 0x41, 0x17, 0x40, 0x0F, 0xC0, 0xA7, 0x40, 0x4F,
+  0xE3, 0xEB, 0xFF, 0x43, 0xEF, 0xC3, 0xE3, 0x02, 0x74, 0x58, 0x44, 0x60,
+  0x0B, 0x40, 0x13, 0x40, 0x03, 0x40, 0x17, 0x47, 0xF3, 0x43, 0xEB, 0x40,
+  0x07, 0x40, 0x0F, 0x40, 0x0B, 0x40, 0x1B, 0x40, 0x03, 0xC3, 0xFF, 0x4A,
+  0xC7, 0xC1, 0x7F, 0x41, 0x53, 0x40, 0x03, 0x41, 0x87, 0x42, 0x97, 0x40,
+  0x0B, 0x60, 0x03, 0xA1, 0x77, 0xE2, 0x00, 0x63, 0x20, 0x0F, 0x41, 0xF7,
+  0x43, 0x8B, 0x40, 0x1F, 0x41, 0x7F, 0x42, 0x17, 0xE6, 0x03, 0x1F, 0x40,
+  0x17, 0xE0, 0x04, 0x43, 0xA2, 0x0B, 0x01, 0x12, 0x13, 0x87, 0xF3, 0x40,
+  0x0F, 0x40, 0x67, 0x40, 0x07, 0x40, 0x4F, 0x40, 0x2B, 0xC6, 0x2B, 0xD2,
+  0xB7, 0xC0, 0x57, 0x42, 0x6F, 0x43, 0x57, 0x40, 0x2B, 0x42, 0x13, 0x40,
+  0x07, 0x40, 0x3B, 0xE0, 0x00, 0x8F, 0xA0, 0x5B, 0xE0, 0x03, 0x07, 0xC0,
+  0x2F, 0x40, 0x13, 0x40, 0x47, 0xC2, 0x6F, 0xE7, 0x03, 0xAF, 0x40, 0x73,
+  0x40, 0x47, 0x40, 0x07, 0x40, 0x27, 0x40, 0x03, 0x40, 0x0F, 0xC3, 0xB7,
+  0x40, 0x0F, 0x40, 0x03, 0xC2, 0x67, 0x40, 0x0B, 0x40, 0xAB, 0x40, 0x4F,
+  0x40, 0xEF, 0x40, 0x07, 0x40, 0x57, 0x40, 0x9F, 0x60, 0x1B, 0xA0, 0x87,
+  0x41, 0x17, 0x40, 0xA7, 0x40, 0x9F, 0xE0, 0x03, 0x87, 0x40, 0x3B, 0xC0,
+  0x23, 0xE0, 0x03, 0x07, 0x40, 0x47, 0xC0, 0x4F, 0x02, 0x54, 0x54, 0x54,
+  0xE0, 0x00, 0x4F, 0xE0, 0x00, 0x3B, 0x21, 0x6F, 0x60, 0x03, 0x40, 0x5F,
+  0x40, 0x0B, 0x40, 0x07, 0xE0, 0x02, 0x03, 0x40, 0xB3, 0x4D, 0x03, 0x40,
+  0x2F, 0x40, 0x03, 0xE0, 0x03, 0x4F, 0x40, 0x57, 0xE1, 0x07, 0xDF, 0xE0,
+  0x03, 0x3B, 0x40, 0x0B, 0x40, 0xA7, 0x40, 0x07, 0xE1, 0x00, 0x07, 0x20,
+  0x63, 0xE0, 0x03, 0xF3, 0x40, 0x4F, 0x41, 0x37, 0x40, 0x07, 0x40, 0x4F,
+  0xC0, 0xEF, 0x43, 0x9B, 0x40, 0x6F, 0x40, 0x3B, 0xC0, 0x03, 0x42, 0x17,
+  0xE0, 0x00, 0x47, 0xE0, 0x02, 0xA3, 0x40, 0x0B, 0xC0, 0x17, 0xC0, 0x47,
+  0x40, 0x07, 0xE3, 0x07, 0xFF, 0x43, 0xDB, 0xC0, 0x27, 0x40, 0x33, 0xE0,
+  0x0C, 0x03, 0x20, 0x9F, 0x40, 0x17, 0x40, 0xB7, 0x40, 0x6F, 0x40, 0x47,
+  0xE3, 0xE7, 0xFF, 0x43, 0xC3, 0x43, 0xD3, 0x43, 0xDB, 0x43, 0xD7, 0xC0,
+  0x0B, 0xE0, 0x03, 0x07, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x23, 0x40, 0x07,
+  0x40, 0x03, 0x40, 0x37, 0x40, 0x03, 0xC3, 0xFF, 0xC1, 0xCF, 0x41, 0x77,
+  0x41, 0x53, 0xC2, 0xFB, 0x41, 0x5B, 0x40, 0x0F, 0xE1, 0x03, 0xDF, 0x42,
+  0x13, 0x42, 0x6B, 0x40, 0x13, 0x40, 0x1F, 0x40, 0x0F, 0x40, 0x23, 0xC7,
+  0x5F, 0xC3, 0xFF, 0xC2, 0x1F, 0x40, 0x1B, 0x41, 0xAB, 0x40, 0x33, 0x40,
+  0x0B, 0x40, 0x33, 0x40, 0x07, 0xE0, 0x17, 0x03, 0x41, 0xCF, 0x40, 0x97,
+  0xEB, 0x03, 0x0F, 0xE0, 0x0C, 0x33, 0x22, 0x07, 0x43, 0x6B, 0xC0, 0x1B,
+  0xC0, 0x8F, 0xC0, 0x0F, 0x40, 0x07, 0x40, 0x7B, 0x40, 0x4F, 0x43, 0xA7,
+  0x40, 0x07, 0x40, 0x57, 0xE0, 0x03, 0x9F, 0x42, 0x3F, 0x40, 0x43, 0x42,
+  0xCB, 0x40, 0x2F, 0x40, 0x53, 0x60, 0x07, 0x22, 0xBB, 0xC2, 0x87, 0x43,
+  0x5B, 0xC1, 0x17, 0x40, 0x17, 0xC0, 0x47, 0x48, 0x4F, 0xC0, 0x4F, 0x40,
+  0x47, 0x40, 0x1B, 0x40, 0x03, 0x40, 0x73, 0x40, 0x07, 0xE0, 0x03, 0x03,
+  0xE0, 0x0B, 0x9B, 0x41, 0x47, 0x40, 0x6F, 0x41, 0x3F, 0x40, 0x47, 0xEB,
+  0x03, 0xAF, 0x60, 0x1B, 0x20, 0x83, 0xC0, 0x03, 0xE1, 0x07, 0x3B, 0x40,
+  0x4F, 0x40, 0x97, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0xC3, 0x4B, 0xFF, 0x40,
+  0x4F, 0xC0, 0xA7, 0xE0, 0x03, 0xEF, 0x41, 0xE7, 0xE0, 0x07, 0x4B, 0xE0,
+  0x07, 0x0F, 0x40, 0x4B, 0xE0, 0x03, 0x03, 0xC0, 0x97, 0xE0, 0x03, 0xEF,
+  0x41, 0x1B, 0xC0, 0xA3, 0x40, 0x07, 0x41, 0x43, 0x60, 0x33, 0x21, 0x93,
+  0x44, 0xFB, 0xC0, 0x0B, 0x60, 0x07, 0xA0, 0xC7, 0x40, 0x33, 0x40, 0x0B,
+  0xC0, 0x97, 0xC0, 0x07, 0xC0, 0x9F, 0x40, 0xD3, 0x40, 0x1F, 0x60, 0x8F,
+  0x20, 0x47, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x5F, 0x40, 0x07, 0xC0, 0x03,
+  0xC0, 0x47, 0x40, 0x17, 0x40, 0x03, 0x40, 0x47, 0xE3, 0xEF, 0xFF, 0x43,
+  0xFB, 0x43, 0xCF, 0x40, 0x03, 0x43, 0xDF, 0x53, 0xDF, 0x40, 0x0B, 0xC0,
+  0x03, 0x40, 0x13, 0x40, 0x03, 0xE0, 0x03, 0x0F, 0x44, 0x0F, 0xE3, 0x07,
+  0xFF, 0x41, 0x5B, 0x42, 0x1B, 0x40, 0x07, 0xC2, 0xBF, 0x41, 0x5B, 0x40,
+  0x0F, 0x40, 0x03, 0xC0, 0x13, 0x40, 0x0B, 0xE0, 0x07, 0x03, 0x41, 0x7F,
+  0x48, 0x47, 0x42, 0x27, 0x46, 0x27, 0x61, 0xCF, 0xE1, 0x02, 0xBF, 0xE0,
+  0x03, 0x3B, 0x41, 0xDB, 0xC2, 0xA7, 0xC2, 0x33, 0xE0, 0x03, 0x67, 0x40,
+  0x0B, 0x40, 0x4F, 0x42, 0xBF, 0x53, 0xFF, 0x48, 0x0B, 0x60, 0x4F, 0xA2,
+  0x43, 0xE0, 0x03, 0x3F, 0x40, 0x63, 0xE2, 0x00, 0x6B, 0x20, 0x1F, 0x42,
+  0x3F, 0x43, 0xA7, 0x40, 0x43, 0x40, 0x27, 0x40, 0x1F, 0x40, 0x17, 0x44,
+  0x47, 0xEA, 0x0B, 0xBF, 0x40, 0x2F, 0xC0, 0x23, 0x40, 0xFB, 0xC2, 0x57,
+  0x40, 0x33, 0x40, 0x17, 0x40, 0x47, 0x40, 0x03, 0x40, 0x0B, 0x60, 0x13,
+  0x20, 0x63, 0x40, 0x03, 0xC0, 0x9F, 0x5A, 0x77, 0x40, 0xA7, 0xE0, 0x03,
+  0x9F, 0x40, 0x1F, 0x40, 0x03, 0x40, 0x37, 0xC0, 0xF7, 0xE4, 0x03, 0x1B,
+  0x60, 0x97, 0xA0, 0x47, 0x40, 0x73, 0x40, 0xBF, 0xC0, 0x4F, 0xC3, 0xB7,
+  0x40, 0x4F, 0x40, 0x3F, 0x60, 0x27, 0x21, 0x47, 0xC0, 0x47, 0x60, 0x13,
+  0x20, 0x0F, 0x40, 0x43, 0x4F, 0x67, 0xC0, 0x17, 0x60, 0x27, 0xA0, 0x53,
+  0x40, 0x1F, 0xC0, 0x97, 0x41, 0x8F, 0xC0, 0x9F, 0x41, 0x6B, 0x40, 0x3F,
+  0x53, 0xFF, 0xE0, 0x00, 0x2B, 0xC0, 0x33, 0x20, 0x07, 0x40, 0x1B, 0x61,
+  0x0F, 0x20, 0x0B, 0x40, 0x07, 0xC1, 0xA3, 0x40, 0x0F, 0xC0, 0x9F, 0xC0,
+  0x07, 0x40, 0x9F, 0x40, 0x17, 0xC0, 0x03, 0x40, 0x2F, 0x40, 0x3F, 0xE0,
+  0x08, 0x8F, 0x20, 0xAB, 0xE1, 0x04, 0x53, 0x20, 0x5B, 0x40, 0x03, 0x40,
+  0x47, 0x42, 0x27, 0xE0, 0x03, 0xEF, 0x40, 0x17, 0xE0, 0x0F, 0x03, 0xE1,
+  0x03, 0x3F, 0xC0, 0x23, 0x40, 0x13, 0x41, 0x07, 0x40, 0x0F, 0x40, 0x4F,
+  0xE3, 0x03, 0xFF, 0xE0, 0xFF, 0x1F, 0x00, 0x6F, 0xFF, 0xC2, 0x1F, 0x41,
+  0x47, 0xE0, 0x17, 0x03, 0x42, 0x73, 0xE0, 0x08, 0x23, 0x21, 0xE3, 0x41,
+  0x7F, 0x40, 0x47, 0xC0, 0x07, 0x42, 0x1F, 0x42, 0x13, 0xC0, 0x2B, 0x40,
+  0x0B, 0xC1, 0xAB, 0x40, 0x2F, 0x40, 0x17, 0xE2, 0x07, 0x17, 0x42, 0x3F,
+  0x40, 0x17, 0x40, 0x03, 0xC2, 0x17, 0x42, 0xBF, 0x44, 0x57, 0x40, 0x4F,
+  0xE0, 0x03, 0x1F, 0x43, 0x37, 0x40, 0x27, 0xC0, 0x03, 0xE0, 0x00, 0x5B,
+  0xA2, 0x5F, 0x40, 0x1F, 0x42, 0x8B, 0x44, 0x0B, 0x43, 0x5F, 0xC0, 0x4F,
+  0xE0, 0x03, 0x9F, 0x40, 0x2B, 0xE0, 0x03, 0x53, 0x40, 0x0B, 0x40, 0x03,
+  0x40, 0x17, 0x57, 0x1F, 0x40, 0x07, 0x60, 0x03, 0x20, 0xDF, 0x40, 0x47,
+  0x60, 0x0B, 0xA0, 0x5F, 0x47, 0x07, 0x4A, 0xB7, 0x44, 0x9B, 0x48, 0x57,
+  0x01, 0x0D, 0x0E, 0x23, 0x57, 0x00, 0x2E, 0xE3, 0x06, 0x57, 0x20, 0x37,
+  0x40, 0x2F, 0x40, 0x53, 0x40, 0x3F, 0x41, 0x03, 0x40, 0x03, 0xC0, 0xAB,
+  0x40, 0x0B, 0x40, 0xA3, 0x40, 0x1F, 0xE0, 0x0F, 0x9F, 0x40, 0x3F, 0x40,
+  0xBF, 0x40, 0x07, 0xC0, 0x03, 0x40, 0x37, 0xC0, 0x0B, 0xC0, 0x07, 0xE0,
+  0x03, 0x23, 0x41, 0x57, 0xC0, 0xE7, 0x40, 0xA7, 0x41, 0x97, 0x41, 0x3F,
+  0x40, 0x2B, 0x40, 0x87, 0x43, 0x37, 0x40, 0x0B, 0xC0, 0x03, 0xE0, 0x00,
+  0x0F, 0x20, 0xAF, 0x40, 0x3B, 0xC0, 0x17, 0xE0, 0x03, 0x07, 0xC0, 0x4F,
+  0xC0, 0x07, 0x40, 0x4F, 0xC0, 0xC7, 0xC0, 0x27, 0x40, 0x83, 0x40, 0x03,
+  0xC0, 0x0F, 0x40, 0x4F, 0x40, 0x0B, 0x40, 0xDF, 0xE2, 0x03, 0x37, 0x40,
+  0x6F, 0xC0, 0x47, 0xC0, 0x07, 0x40, 0x4F, 0x40, 0x2B, 0x40, 0x03, 0x40,
+  0x2F, 0x44, 0xAB, 0x40, 0x3F, 0xC0, 0x4F, 0x40, 0x6B, 0x40, 0x37, 0x40,
+  0x13, 0x40, 0x23, 0x40, 0x03, 0x40, 0xCB, 0x41, 0xE7, 0x40, 0x0B, 0x40,
+  0x47, 0xE3, 0xFF, 0x40, 0xFF, 0x41, 0x7B, 0x41, 0x83, 0x41, 0x57, 0x41,
+  0x77, 0x40, 0x07, 0xE1, 0x03, 0x77, 0x6F, 0xA3, 0x22, 0x2B, 0x60, 0x17,
+  0xA3, 0x0F, 0xE2, 0x07, 0xBF, 0xEE, 0x0B, 0x6F, 0xC1, 0xCB, 0xC0, 0x5B,
+  0xC0, 0x3B, 0xE1, 0x03, 0xC7, 0xC0, 0x13, 0x41, 0xCF, 0x42, 0xB7, 0xC0,
+  0x07, 0x42, 0x1F, 0x43, 0x93, 0x61, 0xEF, 0xE0, 0x02, 0x7B, 0xE0, 0x03,
+  0x4B, 0xE0, 0x00, 0xAB, 0xA0, 0x93, 0xC0, 0x07, 0x43, 0x2F, 0x40, 0x9F,
+  0x43, 0xA7, 0xE0, 0x03, 0x4F, 0x40, 0x8F, 0x40, 0x33, 0x42, 0x57, 0x40,
+  0x07, 0x43, 0x8B, 0x40, 0x33, 0x60, 0x63, 0xA0, 0x43, 0x41, 0x0B, 0x40,
+  0x0B, 0x40, 0x1F, 0x40, 0x7F, 0x40, 0x33, 0x40, 0x0F, 0x4C, 0xE7, 0x43,
+  0xFF, 0x40, 0x07, 0x40, 0xA7, 0x40, 0x9F, 0x40, 0xC7, 0x40, 0x1B, 0xE0,
+  0x03, 0x93, 0xC0, 0x4B, 0xE3, 0x03, 0x57, 0x40, 0x4B, 0x40, 0x27, 0x40,
+  0x77, 0x40, 0x07, 0x40, 0x03, 0xC7, 0xAF, 0xE0, 0x03, 0x4F, 0x40, 0x17,
+  0x40, 0x2B, 0xC0, 0x73, 0xC0, 0x9F, 0x60, 0x5F, 0x21, 0x03, 0xC0, 0x53,
+  0x40, 0x1F, 0x40, 0x13, 0x40, 0x1F, 0x60, 0x6F, 0x20, 0x1B, 0x40, 0xE7,
+  0x40, 0x9F, 0xC0, 0xF7, 0x40, 0x9F, 0x40, 0x4F, 0xC0, 0x03, 0x47, 0xDB,
+  0x40, 0x5B, 0xC0, 0x0F, 0x40, 0xE7, 0x40, 0x47, 0x41, 0x2B, 0xC0, 0x13,
+  0x40, 0x07, 0x4C, 0x5F, 0x40, 0x67, 0x40, 0x4F, 0x40, 0xE7, 0xC0, 0x07,
+  0xE1, 0x03, 0xDF, 0xE0, 0x03, 0x37, 0x40, 0x87, 0x60, 0x43, 0x20, 0x83,
+  0x60, 0x03, 0xA1, 0x47, 0x40, 0x23, 0xC0, 0x0B, 0x40, 0x77, 0xC4, 0x97,
+  0x4C, 0xF7, 0x49, 0x97, 0xE0, 0x00, 0x9F, 0x20, 0x37, 0xC1, 0x17, 0x40,
+  0x27, 0x60, 0xCF, 0x20, 0x43, 0x40, 0x0B, 0x40, 0x07, 0x40, 0x03, 0x40,
+  0xE7, 0x40, 0x63, 0x40, 0x97, 0x40, 0x0F, 0x40, 0x0B, 0x40, 0x97, 0xE3,
+  0xFF, 0x30, 0xFF, 0x46, 0xC3, 0x41, 0x3F, 0xE0, 0x17, 0x03, 0x4B, 0x8B,
+  0x4B, 0x47, 0xC0, 0x27, 0x40, 0x37, 0x40, 0x13, 0x42, 0x63, 0x40, 0x13,
+  0xC2, 0x1F, 0x5A, 0x77, 0x40, 0x0F, 0x41, 0xDB, 0x40, 0x07, 0x40, 0x33,
+  0xC0, 0x0B, 0xC0, 0x07, 0x41, 0xFF, 0x40, 0x1B, 0x40, 0x03, 0x47, 0xE3,
+  0x40, 0x07, 0x40, 0x03, 0x40, 0x4B, 0x40, 0x03, 0x40, 0x0B, 0x4A, 0x1F,
+  0x40, 0x07, 0x40, 0x67, 0x40, 0x07, 0x40, 0x47, 0x40, 0x07, 0x40, 0x03,
+  0xC0, 0x0B, 0xC0, 0x3B, 0xE0, 0x03, 0x4F, 0x40, 0x1F, 0x43, 0x47, 0x40,
+  0x47, 0x40, 0x1F, 0x40, 0x1B, 0xE3, 0x03, 0x5F, 0x40, 0x9F, 0xC0, 0x13,
+  0x40, 0x2B, 0xE0, 0x0F, 0x03, 0x40, 0x3F, 0x40, 0x1B, 0x40, 0x6B, 0x40,
+  0x03, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x3B, 0x40, 0x17, 0xC0, 0xEF, 0x40,
+  0x6B, 0x40, 0x0F, 0xC0, 0x03, 0x40, 0x23, 0x40, 0x0B, 0x40, 0xEB, 0x40,
+  0x03, 0x40, 0x0B, 0xC0, 0x03, 0xC0, 0x8F, 0xC0, 0x0F, 0x40, 0x07, 0xC0,
+  0x23, 0xE0, 0x07, 0x4F, 0xC0, 0x17, 0x40, 0x23, 0xC0, 0x03, 0xC0, 0x5B,
+  0x40, 0x0F, 0x40, 0x77, 0x40, 0xD7, 0x40, 0x13, 0x40, 0x03, 0x40, 0x13,
+  0x40, 0x07, 0x40, 0xAB, 0x40, 0x0B, 0x44, 0xEF, 0x40, 0x1F, 0xC1, 0x3F,
+  0x40, 0x13, 0xC0, 0xBB, 0x40, 0x0B, 0xC0, 0x03, 0x02, 0x90, 0x90, 0x90,
+  0xE0, 0x00, 0x0B, 0x40, 0x53, 0xC0, 0x17, 0xC0, 0x07, 0x40, 0x33, 0x40,
+  0x03, 0x40, 0x9F, 0x40, 0x93, 0x40, 0x03, 0x40, 0x33, 0x40, 0x07, 0xC0,
+  0x23, 0xE0, 0x0F, 0x07, 0xC0, 0x4F, 0xC0, 0x93, 0x40, 0x9F, 0xC0, 0x2B,
+  0x40, 0x4F, 0x40, 0x57, 0xE0, 0x03, 0x9F, 0xC0, 0x1B, 0x40, 0x07, 0x40,
+  0x1B, 0xE0, 0x07, 0x07, 0x40, 0xCF, 0xC0, 0x53, 0x40, 0x1B, 0x40, 0x03,
+  0xC0, 0x53, 0xE3, 0xFF, 0x30, 0xFF, 0x4B, 0x5F, 0x41, 0x8B, 0x40, 0x03,
+  0x46, 0x33, 0x40, 0x07, 0x40, 0x03, 0x43, 0x7F, 0x40, 0x03, 0x40, 0x0B,
+  0x42, 0x4B, 0x40, 0x07, 0xE0, 0x03, 0x2B, 0x45, 0xB7, 0x40, 0x13, 0xE0,
+  0x03, 0x03, 0x02, 0x6D, 0x6D, 0x6D, 0x60, 0x43, 0xC0, 0x1B, 0xC0, 0x37,
+  0xC0, 0x47, 0xE0, 0x03, 0x5F, 0xC0, 0x1B, 0xE0, 0x03, 0x3F, 0x40, 0x0B,
+  0x00, 0x56, 0xBF, 0xFF, 0x27, 0x70, 0x40, 0x0B, 0x42, 0x1B, 0x40, 0x07,
+  0xE0, 0x03, 0x03, 0x40, 0x4B, 0x40, 0x03, 0xE0, 0x03, 0x4B, 0x40, 0x1F,
+  0xE0, 0x07, 0x0F, 0x40, 0x13, 0xE0, 0x07, 0x63, 0xE0, 0x0B, 0x4F, 0x40,
+  0x27, 0x40, 0x4F, 0x40, 0x03, 0x40, 0x0B, 0xC0, 0x03, 0xC0, 0xC3, 0x40,
+  0x0F, 0x40, 0x47, 0x40, 0x1F, 0x40, 0x03, 0xE0, 0x0B, 0x9F, 0x40, 0x17,
+  0x40, 0x27, 0xC0, 0x03, 0x40, 0x8B, 0x40, 0x33, 0x40, 0x03, 0xC0, 0x13,
+  0x40, 0x07, 0xE0, 0x03, 0x53, 0x40, 0x23, 0x40, 0x13, 0xC0, 0x07, 0x40,
+  0x0B, 0xC0, 0x9F, 0x40, 0x27, 0xC0, 0x17, 0xE0, 0x07, 0x5B, 0x40, 0x27,
+  0x40, 0x03, 0x40, 0x17, 0xE0, 0x03, 0x8B, 0xC0, 0x2F, 0xE0, 0x03, 0x07,
+  0xC1, 0xAF, 0xC0, 0x13, 0x40, 0x2F, 0xC0, 0x0B, 0xE0, 0x07, 0x9B, 0x40,
+  0x53, 0xC0, 0x1B, 0x40, 0x0B, 0xE0, 0x03, 0x1F, 0x40, 0x0B, 0x40, 0x03,
+  0x45, 0x3B, 0x40, 0x1B, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x0B,
+  0xE0, 0x07, 0x03, 0xE0, 0x03, 0x47, 0x40, 0x73, 0xE0, 0x03, 0x1F, 0x40,
+  0xB7, 0xC0, 0x0F, 0x42, 0x2F, 0xC0, 0x0B, 0x40, 0x07, 0xE0, 0x03, 0x37,
+  0x40, 0x0F, 0xC0, 0x03, 0xE0, 0x0F, 0x67, 0xC0, 0x1F, 0x40, 0x37, 0xE3,
+  0xFF, 0x2C, 0xFF, 0x31, 0x27, 0xE0, 0xFF, 0xFF, 0xCD, 0x03, 0xE0, 0xFF,
+  0x20, 0x00, 0xE3, 0x57, 0xFB, 0xE0, 0xFF, 0xFF, 0xFF, 0x97, 0x00, 0x31,
+  0x73, 0x01, 0xAE, 0xFF, 0x20, 0x00, 0x16, 0xFD, 0xFD, 0xFD, 0xFF, 0xF6,
+  0xF6, 0xF6, 0xFF, 0xF7, 0xF9, 0xF7, 0xFF, 0xDD, 0xF0, 0xD8, 0xFF, 0xFC,
+  0xFE, 0xFC, 0xFF, 0xD5, 0xE8, 0xD0, 0x60, 0x03, 0x06, 0xCE, 0xE1, 0xC9,
+  0xFF, 0xD4, 0xE7, 0xCF, 0x60, 0x0B, 0x02, 0xDA, 0xED, 0xD5, 0x60, 0x07,
+  0x40, 0x1B, 0x02, 0xD8, 0xEB, 0xD3, 0x60, 0x07, 0x02, 0xCD, 0xE0, 0xC8,
+  0x60, 0x07, 0x40, 0x13, 0xC0, 0x03, 0x02, 0xA1, 0xB2, 0x9D, 0x51, 0xCF,
+  0x00, 0xAE, 0xE3, 0x5A, 0xFC, 0xE4, 0x53, 0xBF, 0xE0, 0xFF, 0xFF, 0xDA,
+  0x00, 0x43, 0xFF, 0x02, 0xFC, 0xFC, 0xFC, 0x63, 0xAF, 0x43, 0xB3, 0x40,
+  0x03, 0x02, 0x9B, 0xAC, 0x97, 0x60, 0x07, 0x40, 0x0B, 0x40, 0x03, 0x0A,
+  0xA0, 0xB1, 0x9C, 0xFF, 0xAE, 0xBF, 0xAA, 0xFF, 0x9A, 0xAB, 0x96, 0x60,
+  0x0F, 0x06, 0x90, 0xA1, 0x8C, 0xFF, 0xA2, 0xB3, 0x9E, 0xE0, 0x00, 0x0F,
+  0xC0, 0x17, 0x40, 0x2B, 0x02, 0xAA, 0xBB, 0xA6, 0x60, 0x07, 0x02, 0x5E,
+  0x6C, 0x5B, 0xE3, 0x5C, 0xFF, 0x01, 0x93, 0x93, 0xFF, 0x49, 0xFF, 0x3C,
+  0x9C, 0x4E, 0x8F, 0x23, 0xF8, 0x40, 0x03, 0xE0, 0xFF, 0xFF, 0xDA, 0x00,
+  0x43, 0xFF, 0x47, 0xF3, 0x43, 0xBB, 0x0A, 0x61, 0x6F, 0x5E, 0xFF, 0x5F,
+  0x6D, 0x5C, 0xFF, 0x58, 0x66, 0x55, 0x60, 0x07, 0x02, 0x59, 0x67, 0x56,
+  0x63, 0xC7, 0x40, 0x13, 0xC0, 0x03, 0x02, 0x62, 0x70, 0x5F, 0x60, 0x0B,
+  0x06, 0x60, 0x6E, 0x5D, 0xFF, 0x5B, 0x69, 0x58, 0x60, 0x0B, 0x02, 0x5D,
+  0x6B, 0x5A, 0x60, 0x07, 0x40, 0x23, 0x06, 0xA8, 0xB9, 0xA4, 0xFF, 0xA5,
+  0xB6, 0xA1, 0x60, 0x0B, 0x40, 0x5B, 0xE3, 0x03, 0x40, 0x03, 0xAA, 0xAA,
+  0xAA, 0x99, 0xE0, 0x07, 0x03, 0x02, 0xA7, 0xA7, 0xA7, 0x60, 0x03, 0xE0,
+  0x07, 0x17, 0xE0, 0x03, 0x0F, 0x02, 0xAB, 0xAB, 0xAB, 0xE0, 0x00, 0x0F,
+  0x03, 0x6F, 0x6F, 0x6F, 0x99, 0xE0, 0x03, 0x53, 0x53, 0x23, 0x51, 0xFF,
+  0x56, 0x87, 0xC0, 0x0B, 0x40, 0x0F, 0xE0, 0x03, 0x03, 0x52, 0x17, 0x53,
+  0x03, 0x40, 0x03, 0xE0, 0x03, 0x17, 0xF2, 0x03, 0x83, 0xC0, 0x17, 0x53,
+  0x7B, 0xF2, 0xFF, 0x2B, 0x43, 0xE0, 0xFF, 0xB1, 0x00, 0x43, 0xA3, 0x2B,
+  0xFE, 0x00, 0xFF, 0x43, 0xFF, 0x43, 0xBF, 0xE1, 0x37, 0xC8, 0x02, 0xD1,
+  0xE4, 0xCC, 0xE0, 0x00, 0x4B, 0x40, 0x5B, 0xE0, 0x03, 0x4F, 0x43, 0xD3,
+  0x43, 0xBF, 0xE0, 0x0B, 0x03, 0x0A, 0x6E, 0x6E, 0x6E, 0x99, 0x6C, 0x6C,
+  0x6C, 0x99, 0x71, 0x71, 0x71, 0x60, 0x07, 0xE0, 0x07, 0x23, 0x40, 0x1B,
+  0x06, 0x68, 0x68, 0x68, 0x99, 0x52, 0x52, 0x52, 0xE3, 0x04, 0xFF, 0x59,
+  0xFB, 0x43, 0xBB, 0x59, 0xFF, 0x43, 0xCF, 0x03, 0x83, 0x83, 0x83, 0xEA,
+  0xE0, 0x07, 0x03, 0x20, 0x1B, 0xE0, 0x04, 0x13, 0x01, 0x84, 0x84, 0x80,
+  0x03, 0xE0, 0x07, 0x27, 0x36, 0xA3, 0x00, 0xEA, 0x40, 0x4F, 0xE3, 0xFF,
+  0xFF, 0xE9, 0xFF, 0x4F, 0xB3, 0x02, 0xAC, 0xBD, 0xA8, 0xE3, 0x3C, 0xFF,
+  0x02, 0xE2, 0xF5, 0xDD, 0x63, 0xFF, 0x02, 0x66, 0x74, 0x63, 0xE3, 0x0C,
+  0xFF, 0x43, 0xE7, 0x3A, 0x3F, 0xE3, 0x04, 0xDF, 0x2B, 0x6F, 0x63, 0xF7,
+  0x00, 0x6F, 0x27, 0xDB, 0xE0, 0x03, 0x03, 0x27, 0x8B, 0x03, 0x99, 0x74,
+  0x74, 0x74, 0xE0, 0x00, 0x13, 0x44, 0x03, 0x02, 0x55, 0x55, 0x55, 0xE3,
+  0x04, 0xFF, 0x5E, 0x0B, 0x43, 0xFF, 0x43, 0xB7, 0x40, 0x07, 0x43, 0xD3,
+  0x04, 0x5D, 0x5D, 0x56, 0xEA, 0x5E, 0x20, 0x03, 0x40, 0x07, 0x40, 0x03,
+  0x80, 0x0B, 0x0A, 0x55, 0xEA, 0x5D, 0x5B, 0x54, 0xEA, 0x5F, 0x5F, 0x57,
+  0xEA, 0x5B, 0x40, 0x07, 0x00, 0x5E, 0x80, 0x17, 0x02, 0x60, 0x5F, 0x58,
+  0x60, 0x0F, 0x06, 0x5B, 0x5A, 0x53, 0xEA, 0x48, 0x47, 0x40, 0xE3, 0xFF,
+  0xFF, 0xF2, 0xFF, 0xE7, 0x3F, 0xFF, 0x44, 0x4B, 0x40, 0x4B, 0x02, 0x65,
+  0x73, 0x62, 0xE3, 0x08, 0xFF, 0x02, 0xA8, 0xA8, 0xA8, 0x63, 0xCB, 0x43,
+  0xD7, 0x43, 0xCB, 0x44, 0x0B, 0x43, 0xEF, 0x47, 0xF3, 0x40, 0x07, 0xE0,
+  0x03, 0x03, 0x44, 0x13, 0xC0, 0x23, 0x40, 0x07, 0x40, 0x0F, 0x06, 0x69,
+  0x69, 0x69, 0x99, 0x54, 0x54, 0x54, 0xE3, 0x04, 0xFF, 0x43, 0xF7, 0x5E,
+  0x17, 0x40, 0x07, 0x4B, 0xE7, 0x83, 0xFF, 0x02, 0x55, 0xEA, 0x5A, 0x23,
+  0xCF, 0xC3, 0xFB, 0x05, 0x5C, 0x5C, 0x54, 0xEA, 0x61, 0x60, 0x23, 0xE7,
+  0x01, 0x5C, 0x56, 0x23, 0xF7, 0x00, 0x57, 0x20, 0x03, 0x83, 0xFB, 0x04,
+  0x62, 0x61, 0x5A, 0xEA, 0x5C, 0x24, 0x27, 0x40, 0x13, 0x44, 0x1B, 0x02,
+  0x4A, 0x4A, 0x42, 0xE3, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0x4C, 0x4B, 0xEB,
+  0x0F, 0xFF, 0x43, 0xFF, 0x43, 0xF3, 0xC8, 0x07, 0x40, 0x0B, 0x43, 0xFB,
+  0x43, 0xE3, 0x02, 0x6A, 0x6A, 0x6A, 0xE4, 0x00, 0x17, 0x40, 0x13, 0x40,
+  0x03, 0x02, 0x73, 0x73, 0x73, 0x60, 0x1B, 0x44, 0x2F, 0x02, 0x59, 0x59,
+  0x59, 0xE3, 0x08, 0xFF, 0x47, 0xF7, 0x43, 0xFF, 0x40, 0x07, 0x02, 0x81,
+  0x81, 0x81, 0x67, 0xEF, 0x43, 0xD7, 0x47, 0xE7, 0x02, 0x5D, 0x5C, 0x55,
+  0x67, 0xE3, 0x48, 0x03, 0x00, 0x60, 0x27, 0xFB, 0x40, 0x17, 0x60, 0x03,
+  0x24, 0x13, 0x02, 0x5A, 0x5B, 0x55, 0x60, 0x23, 0x40, 0x27, 0x05, 0x59,
+  0x59, 0x51, 0xEA, 0x4A, 0x49, 0xE3, 0xFF, 0xFF, 0xEF, 0xFF, 0x02, 0xCA,
+  0xDD, 0xC5, 0x67, 0xB3, 0x43, 0xB3, 0xEF, 0x03, 0xAF, 0xE0, 0x2B, 0x00,
+  0xC7, 0xFF, 0x40, 0x4B, 0xE3, 0x07, 0xFF, 0x02, 0xA6, 0xA6, 0xA6, 0x63,
+  0xC3, 0x43, 0xD3, 0xE0, 0x03, 0x03, 0xC3, 0xFF, 0x44, 0x0F, 0x43, 0xE3,
+  0xE0, 0x03, 0x1B, 0x40, 0x0B, 0x40, 0x13, 0x40, 0x03, 0x44, 0x1F, 0x2F,
+  0xA3, 0xE3, 0x08, 0xFF, 0x4F, 0xF7, 0xC3, 0xFF, 0x47, 0xFF, 0x4B, 0xD3,
+  0x00, 0x5E, 0x27, 0xE7, 0x01, 0x5B, 0x5C, 0x20, 0x03, 0x28, 0x07, 0x4B,
+  0xF3, 0x43, 0xFF, 0x63, 0xF3, 0x01, 0x5A, 0x52, 0x28, 0x17, 0x00, 0x55,
+  0x67, 0xF3, 0x40, 0x13, 0x02, 0x61, 0x60, 0x59, 0x63, 0xFF, 0x40, 0x13,
+  0x02, 0x4D, 0x4D, 0x45, 0x50, 0x2B, 0xEF, 0xFF, 0xFF, 0xEE, 0xFF, 0x4B,
+  0xB3, 0x43, 0xB3, 0xE3, 0x2B, 0xF3, 0xE0, 0x03, 0x00, 0x43, 0xFF, 0x02,
+  0xA9, 0xBA, 0xA5, 0x60, 0x4B, 0xE3, 0x07, 0xFF, 0x53, 0xFF, 0x43, 0xC7,
+  0x4B, 0xCF, 0x43, 0xD7, 0x43, 0xF7, 0x47, 0xDB, 0x40, 0x03, 0x48, 0x13,
+  0x40, 0x03, 0x02, 0x75, 0x75, 0x75, 0x60, 0x1B, 0x40, 0x23, 0x40, 0x2B,
+  0x40, 0x27, 0x40, 0x03, 0x43, 0xFB, 0x40, 0x07, 0xE3, 0x0B, 0xFF, 0x47,
+  0xF7, 0xE3, 0x03, 0xFF, 0x43, 0xCB, 0x02, 0x58, 0x59, 0x53, 0x23, 0xD7,
+  0x2B, 0xDB, 0x27, 0xF3, 0x43, 0xE3, 0x44, 0x0F, 0x4C, 0x03, 0x02, 0x62,
+  0x62, 0x5A, 0x63, 0xF7, 0x47, 0xF3, 0x43, 0xFF, 0x40, 0x03, 0x44, 0x17,
+  0x40, 0x07, 0x02, 0x4B, 0x4A, 0x43, 0xEB, 0xFF, 0xFF, 0xEE, 0xFF, 0x02,
+  0xD6, 0xE9, 0xD1, 0xE3, 0x00, 0xB3, 0xE3, 0x03, 0xCB, 0xE0, 0x2B, 0x00,
+  0x02, 0xD8, 0xEB, 0xD3, 0x64, 0x4B, 0x02, 0x56, 0x64, 0x53, 0xE3, 0x0C,
+  0xFF, 0xC3, 0xD7, 0x43, 0xCF, 0x4F, 0xCF, 0xE3, 0x03, 0xE3, 0x43, 0xDF,
+  0x44, 0x03, 0x44, 0x0F, 0x40, 0x0B, 0x40, 0x23, 0x40, 0x2F, 0x40, 0x03,
+  0x40, 0x0B, 0x40, 0x13, 0xE3, 0x07, 0xFF, 0x5B, 0xF7, 0x43, 0xFF, 0x37,
+  0xE3, 0x60, 0x07, 0x57, 0xDB, 0x00, 0x5D, 0x2B, 0xDB, 0x02, 0x85, 0x85,
+  0x85, 0x7F, 0xFF, 0x13, 0x68, 0x00, 0x5B, 0x27, 0xEF, 0x44, 0x07, 0x43,
+  0xDF, 0xC0, 0x13, 0x64, 0x0F, 0x2F, 0xF7, 0x44, 0x03, 0xC0, 0x13, 0x40,
+  0x0F, 0x43, 0xFF, 0x54, 0x4F, 0xF7, 0xFF, 0xFF, 0xED, 0xFF, 0xE7, 0x3F,
+  0xFF, 0x02, 0xDE, 0xF1, 0xD9, 0x60, 0x4B, 0x02, 0x68, 0x76, 0x65, 0xE3,
+  0x08, 0xFF, 0x5F, 0xC7, 0x43, 0xC3, 0xC0, 0x03, 0x43, 0xFB, 0x43, 0xEF,
+  0xC0, 0x0F, 0xE0, 0x03, 0x07, 0x40, 0x17, 0x57, 0xFB, 0x40, 0x07, 0xC0,
+  0x17, 0x44, 0x2F, 0x02, 0x4F, 0x4F, 0x4F, 0xEB, 0x08, 0xFF, 0xD3, 0xFF,
+  0x44, 0x07, 0x43, 0xFF, 0x43, 0xD3, 0x06, 0xFC, 0xFC, 0xFC, 0xFF, 0xD9,
+  0xD9, 0xD9, 0x64, 0x03, 0x53, 0xEF, 0xE0, 0x07, 0x13, 0x00, 0x60, 0x2C,
+  0x1F, 0xE0, 0x07, 0x13, 0x02, 0x45, 0x45, 0x3D, 0xE7, 0xFF, 0xFF, 0xEE,
+  0xFF, 0x02, 0xDA, 0xED, 0xD5, 0x63, 0xB3, 0x02, 0x5B, 0x69, 0x58, 0xE7,
+  0x38, 0xFF, 0x4B, 0xFF, 0x44, 0x4B, 0x02, 0x5A, 0x68, 0x57, 0xE3, 0x08,
+  0xFF, 0xCB, 0xFF, 0x43, 0xD3, 0x27, 0x67, 0xEB, 0x00, 0xFF, 0x02, 0x76,
+  0x76, 0x76, 0x60, 0x13, 0xC3, 0xE7, 0xC7, 0xEB, 0x4C, 0x1F, 0x40, 0x2B,
+  0x48, 0x0F, 0x40, 0x13, 0x48, 0x07, 0xE7, 0x07, 0xFF, 0xCB, 0xF7, 0x40,
+  0x07, 0x20, 0x1B, 0x6F, 0xFF, 0x43, 0xD7, 0x43, 0xFB, 0x02, 0xC3, 0xC3,
+  0xC3, 0x63, 0xFF, 0x00, 0x5C, 0x37, 0xF7, 0xE0, 0x07, 0x13, 0x4C, 0x0F,
+  0xE0, 0x07, 0x13, 0xE3, 0xFF, 0xFF, 0xF1, 0xFF, 0x43, 0xB3, 0x06, 0xA3,
+  0xB4, 0x9F, 0xFF, 0x55, 0x63, 0x52, 0xE3, 0x40, 0xFF, 0x50, 0x4B, 0xEF,
+  0x0B, 0xFF, 0xC3, 0xE3, 0xC0, 0x07, 0x43, 0xDF, 0x40, 0x0B, 0x43, 0xDB,
+  0x40, 0x03, 0x48, 0x13, 0x40, 0x0F, 0x43, 0xEF, 0x02, 0x66, 0x66, 0x66,
+  0x60, 0x13, 0x40, 0x0F, 0x40, 0x27, 0x48, 0x0F, 0x02, 0x58, 0x58, 0x58,
+  0xE7, 0x04, 0xFF, 0xCB, 0xFF, 0x43, 0xFF, 0x48, 0x07, 0x53, 0xFF, 0x57,
+  0xD7, 0x43, 0xDB, 0x40, 0x03, 0x4F, 0xFF, 0x02, 0x62, 0x62, 0x5B, 0x6F,
+  0xFF, 0x40, 0x0F, 0x40, 0x03, 0xCF, 0xEF, 0xC4, 0x03, 0x40, 0x13, 0x4C,
+  0x0B, 0x4B, 0xFF, 0x40, 0x47, 0xEB, 0xFF, 0xFF, 0xE9, 0xFF, 0x02, 0xDC,
+  0xEF, 0xD7, 0x67, 0xB3, 0x02, 0x67, 0x75, 0x64, 0xE3, 0x64, 0xFF, 0xC7,
+  0xDF, 0x43, 0xDB, 0x43, 0xE3, 0x43, 0xF3, 0x4B, 0xE3, 0x40, 0x03, 0x40,
+  0x0B, 0x40, 0x03, 0x02, 0x65, 0x65, 0x65, 0x7F, 0xFF, 0x07, 0xF8, 0xC0,
+  0x1F, 0xEB, 0x13, 0xFF, 0xDF, 0xFF, 0x00, 0x00, 0x4F, 0xCB, 0x4B, 0xF3,
+  0x40, 0x07, 0xC0, 0x03, 0x01, 0x5A, 0x5A, 0x53, 0xE3, 0x00, 0x55, 0x30,
+  0x1B, 0x00, 0x55, 0x60, 0x13, 0x44, 0x03, 0x43, 0xF3, 0x5C, 0x13, 0x44,
+  0x07, 0x06, 0x60, 0x61, 0x5A, 0xEA, 0x4C, 0x4C, 0x44, 0xE3, 0xFF, 0xFF,
+  0xEE, 0xFF, 0x47, 0xFF, 0x4B, 0xB3, 0x02, 0x6D, 0x7B, 0x6A, 0xE3, 0x3C,
+  0xFF, 0x02, 0x9C, 0xAD, 0x98, 0x7F, 0xFF, 0x10, 0x44, 0xE7, 0x0B, 0xFF,
+  0x43, 0xF3, 0x43, 0xCB, 0x40, 0x03, 0x43, 0xDF, 0x5B, 0xF3, 0xE0, 0x07,
+  0x13, 0xC8, 0x03, 0xE0, 0x03, 0x17, 0x44, 0x13, 0x40, 0x17, 0x2B, 0xE3,
+  0xE7, 0x04, 0xFF, 0x47, 0xAF, 0x4F, 0xF7, 0x40, 0x07, 0xE3, 0x07, 0xFF,
+  0x43, 0xDB, 0xDC, 0x0B, 0x44, 0x07, 0x43, 0xF3, 0x5F, 0xE7, 0x40, 0x03,
+  0x40, 0x0B, 0x06, 0x56, 0x56, 0x4E, 0xEA, 0x58, 0x58, 0x51, 0x60, 0x1B,
+  0x44, 0x1F, 0x02, 0x47, 0x46, 0x3E, 0xE3, 0xFF, 0xFF, 0xEE, 0xFF, 0x47,
+  0xFF, 0x02, 0x9D, 0xAE, 0x99, 0x7F, 0xFF, 0x14, 0x00, 0xF7, 0x2B, 0xF3,
+  0xE0, 0x03, 0x00, 0xC4, 0x4B, 0x01, 0x60, 0x6E, 0x7F, 0xFF, 0x2F, 0x10,
+  0xFF, 0x08, 0xFF, 0x10, 0x00, 0x4F, 0xCB, 0x5B, 0xE3, 0xC7, 0xF3, 0xC4,
+  0x07, 0x40, 0x07, 0xE0, 0x07, 0x03, 0x43, 0xEF, 0x40, 0x2F, 0x40, 0x03,
+  0x44, 0x0B, 0x40, 0x03, 0xE3, 0x13, 0xFF, 0x44, 0x07, 0x4B, 0xFF, 0x57,
+  0xDF, 0x00, 0x61, 0x27, 0xCF, 0x47, 0xD7, 0x00, 0x5B, 0x2F, 0xFB, 0x43,
+  0xEB, 0x43, 0xFF, 0x40, 0x03, 0xDF, 0xFF, 0x08, 0x14, 0x40, 0x0B, 0x40,
+  0x27, 0x02, 0x62, 0x60, 0x59, 0x7C, 0x23, 0x4C, 0x27, 0x00, 0x4A, 0xFB,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xDF, 0xFF, 0x04, 0x00, 0x02, 0x54, 0x62, 0x51,
+  0xE3, 0x38, 0xFF, 0x06, 0xCF, 0xE2, 0xCA, 0xFF, 0xA4, 0xB5, 0xA0, 0xFF,
+  0x0C, 0xFF, 0x0C, 0x00, 0x53, 0xFF, 0xE3, 0x03, 0xE3, 0x43, 0xCF, 0xE0,
+  0x03, 0x0F, 0x40, 0x0B, 0x43, 0xF3, 0x40, 0x07, 0x48, 0x1B, 0x47, 0xF3,
+  0x40, 0x07, 0x40, 0x0F, 0x44, 0x2F, 0x4F, 0xFF, 0x02, 0x57, 0x57, 0x57,
+  0xE7, 0x08, 0xFF, 0x01, 0x62, 0x62, 0xFF, 0x01, 0xFF, 0x3A, 0x44, 0x43,
+  0xFF, 0x43, 0xDB, 0xC0, 0x03, 0x43, 0xD7, 0xC0, 0x0B, 0xE0, 0x03, 0x07,
+  0x44, 0x13, 0x40, 0x03, 0x40, 0x13, 0x48, 0x27, 0x05, 0x5F, 0x5F, 0x59,
+  0xEA, 0x4B, 0x4B, 0xEB, 0xFF, 0xFF, 0xEF, 0xFF, 0x06, 0xD3, 0xE6, 0xCE,
+  0xFF, 0x95, 0xA6, 0x91, 0x77, 0xB3, 0xE7, 0x03, 0xCB, 0xE0, 0x2B, 0x00,
+  0x02, 0xD7, 0xEA, 0xD2, 0x6C, 0x4B, 0xF3, 0x0B, 0xFF, 0xDF, 0xFF, 0x10,
+  0x00, 0x43, 0xD3, 0x40, 0x03, 0x43, 0xD7, 0x43, 0xEF, 0x53, 0xF7, 0x4F,
+  0xE7, 0x40, 0x07, 0x40, 0x13, 0xC7, 0xEF, 0x40, 0x23, 0x40, 0x13, 0x44,
+  0x27, 0x48, 0x33, 0x40, 0x07, 0xFF, 0x20, 0xFF, 0x0C, 0x00, 0x00, 0x5C,
+  0x83, 0xDF, 0x01, 0x5B, 0x5B, 0x9F, 0xE7, 0x02, 0x55, 0x55, 0x4E, 0x20,
+  0x0B, 0x20, 0x0F, 0x28, 0x0F, 0x00, 0x62, 0x28, 0x1B, 0x44, 0x17, 0x40,
+  0x0F, 0x40, 0x07, 0x4F, 0xFB, 0x48, 0x0B, 0x02, 0x4D, 0x4D, 0x45, 0xEB,
+  0xFF, 0xFF, 0xEE, 0xFF, 0x4B, 0xB3, 0x06, 0x9F, 0xB0, 0x9B, 0xFF, 0x5C,
+  0x6A, 0x59, 0xE3, 0x38, 0xFF, 0x02, 0xF8, 0xFA, 0xF8, 0x60, 0x4B, 0x58,
+  0x4B, 0xEF, 0x07, 0xFF, 0x43, 0xD7, 0x4B, 0xBF, 0x40, 0x03, 0x06, 0x54,
+  0x54, 0x54, 0x99, 0x50, 0x50, 0x50, 0x60, 0x0B, 0x40, 0x0F, 0x02, 0x53,
+  0x53, 0x53, 0x60, 0x13, 0x40, 0x07, 0x40, 0x03, 0x02, 0x4C, 0x4C, 0x4C,
+  0x60, 0x07, 0x40, 0x1B, 0xE0, 0x07, 0x03, 0xE4, 0x03, 0x97, 0x01, 0x7C,
+  0x7C, 0xFF, 0x01, 0xFF, 0x36, 0x94, 0x38, 0x2F, 0x00, 0xFF, 0x24, 0x1F,
+  0x00, 0xEA, 0x57, 0xC7, 0x80, 0x03, 0x02, 0x42, 0xEA, 0x46, 0x2F, 0xD3,
+  0x02, 0x48, 0x48, 0x43, 0x2B, 0xDB, 0x04, 0x42, 0xEA, 0x49, 0x49, 0x41,
+  0x20, 0x0F, 0x00, 0x40, 0x20, 0x0F, 0x0A, 0x40, 0xEA, 0x43, 0x43, 0x3B,
+  0xEA, 0x4C, 0x4B, 0x43, 0xEA, 0x49, 0x2B, 0xF3, 0x00, 0x4C, 0x20, 0x03,
+  0x40, 0x2F, 0x40, 0x0B, 0x50, 0x47, 0xF7, 0xFF, 0xFF, 0xE9, 0xFF, 0x02,
+  0xD6, 0xE9, 0xD1, 0x67, 0xB3, 0x03, 0xD0, 0xE3, 0xCB, 0xFF, 0x48, 0x0B,
+  0x44, 0x0F, 0x40, 0x03, 0x03, 0xD8, 0xEB, 0xD3, 0xFF, 0x4B, 0xCF, 0x02,
+  0xD1, 0xE4, 0xCC, 0x60, 0x0F, 0x02, 0xD2, 0xE5, 0xCD, 0x60, 0x07, 0x40,
+  0x1B, 0xE0, 0x07, 0x03, 0x02, 0xDA, 0xED, 0xD5, 0x7F, 0xFF, 0x2C, 0x3C,
+  0xDF, 0xFF, 0x24, 0x4C, 0xE7, 0x0B, 0xFF, 0x47, 0xCF, 0xC3, 0xCB, 0x3B,
+  0xAB, 0x03, 0x99, 0x5E, 0x5E, 0x5E, 0x7B, 0xCF, 0x40, 0x13, 0x02, 0x55,
+  0x55, 0x55, 0x63, 0xEF, 0x40, 0x07, 0x00, 0x54, 0x24, 0x1B, 0x40, 0x13,
+  0x40, 0x03, 0x40, 0x0B, 0x4B, 0xF3, 0x00, 0x58, 0x3B, 0xF7, 0x40, 0x0F,
+  0xFF, 0x0F, 0xFF, 0x20, 0x00, 0x44, 0x07, 0x2C, 0x23, 0x74, 0x07, 0x43,
+  0xC3, 0xE0, 0x03, 0x03, 0x40, 0x1B, 0x40, 0x0F, 0xE0, 0x03, 0x07, 0x01,
+  0x77, 0x77, 0xFF, 0xFF, 0x45, 0xFF, 0x3A, 0x44, 0xE0, 0xFF, 0xB1, 0x00,
+  0x47, 0xA3, 0x43, 0xCB, 0x57, 0xFF, 0x40, 0x03, 0x02, 0xAB, 0xBC, 0xA7,
+  0x7F, 0xFF, 0x2B, 0xD0, 0x02, 0xA2, 0xB3, 0x9E, 0x60, 0x0F, 0x40, 0x13,
+  0x02, 0x99, 0xAA, 0x95, 0x60, 0x17, 0x40, 0x0B, 0x54, 0x27, 0x40, 0x07,
+  0xC0, 0x03, 0x02, 0x9E, 0xAF, 0x9A, 0x60, 0x0B, 0xC0, 0x07, 0x48, 0x47,
+  0x02, 0xA0, 0xB1, 0x9C, 0xE3, 0x0C, 0xFF, 0xE0, 0x4B, 0x00, 0x53, 0xF3,
+  0x40, 0x03, 0x24, 0x5B, 0x60, 0x07, 0x40, 0x0B, 0x40, 0x03, 0x58, 0x0B,
+  0x40, 0x07, 0xE0, 0x07, 0x03, 0x24, 0x77, 0xE0, 0x08, 0x13, 0xE0, 0x03,
+  0x23, 0x40, 0x37, 0xE7, 0xFF, 0xFF, 0xE9, 0xFF, 0x43, 0xCB, 0x47, 0xAF,
+  0x40, 0x03, 0x02, 0x64, 0x72, 0x61, 0x60, 0x03, 0x02, 0x59, 0x67, 0x56,
+  0x6C, 0x0F, 0x40, 0x13, 0x40, 0x03, 0x02, 0x66, 0x74, 0x63, 0x7F, 0xFF,
+  0x00, 0x20, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0x02, 0x5E, 0x6C, 0x5B, 0x60,
+  0x1B, 0x40, 0x13, 0x02, 0x6E, 0x7C, 0x6B, 0x60, 0x07, 0x02, 0x56, 0x64,
+  0x53, 0xF7, 0x0C, 0xFF, 0xE0, 0x4E, 0x00, 0x4C, 0xB3, 0xE0, 0x4F, 0x03,
+  0xE0, 0xFF, 0xFF, 0xDD, 0x00, 0xE3, 0x4F, 0x3B, 0xC0, 0x57, 0xE0, 0xFF,
+  0xFF, 0xFF, 0x9A, 0x00, 0xC3, 0xA7, 0xE0, 0xFF, 0xFF, 0xFF, 0x12, 0x07,
+  0xE0, 0xD7, 0x00, 0x03, 0xFF, 0x2B, 0x2B, 0x2B, 0x60, 0x03, 0x0E, 0x29,
+  0x29, 0x29, 0xFF, 0x2C, 0x2C, 0x2C, 0xFF, 0x2D, 0x2D, 0x2D, 0xFF, 0x2E,
+  0x2E, 0x2E, 0x60, 0x03, 0x40, 0x0F, 0x40, 0x03, 0x02, 0x2F, 0x2F, 0x2F,
+  0x60, 0x07, 0x40, 0x23, 0x40, 0x2F, 0x40, 0x13, 0xE0, 0x0F, 0x03, 0x40,
+  0x3B, 0xC0, 0x1B, 0x06, 0x2A, 0x2A, 0x2A, 0xFF, 0x26, 0x26, 0x26, 0x60,
+  0x07, 0xC0, 0x13, 0x40, 0x07, 0x40, 0x17, 0x40, 0x07, 0x40, 0x03, 0x40,
+  0x0B, 0x02, 0x25, 0x25, 0x25, 0x60, 0x5B, 0x02, 0x28, 0x28, 0x28, 0x60,
+  0x0F, 0x40, 0x17, 0x40, 0x03, 0x40, 0x8B, 0x40, 0x7B, 0x40, 0x07, 0x40,
+  0x0F, 0xE0, 0x0F, 0x03, 0x40, 0x23, 0x02, 0x33, 0x33, 0x33, 0xE0, 0x04,
+  0x7B, 0xC0, 0xA7, 0x40, 0x3B, 0x40, 0x93, 0x40, 0x23, 0xC0, 0x3F, 0x40,
+  0x13, 0xC0, 0x0F, 0x40, 0xD3, 0x40, 0x0F, 0x40, 0x87, 0xE0, 0x03, 0xAB,
+  0xC0, 0x1F, 0xE0, 0x03, 0x33, 0x02, 0x31, 0x31, 0x31, 0x60, 0x4B, 0xC0,
+  0x13, 0xE0, 0x07, 0x07, 0x40, 0x47, 0x02, 0x30, 0x30, 0x30, 0x60, 0x23,
+  0x40, 0x3F, 0x40, 0x0F, 0x40, 0x03, 0xC0, 0x27, 0xC0, 0x63, 0x40, 0x67,
+  0x40, 0x93, 0x40, 0x1B, 0x40, 0x03, 0xC0, 0x1F, 0xE0, 0x0B, 0x07, 0xC0,
+  0x1F, 0x40, 0x2F, 0x40, 0x1F, 0x40, 0x43, 0x40, 0x03, 0x40, 0xB7, 0x40,
+  0xE3, 0x40, 0x03, 0x40, 0x17, 0xE0, 0x03, 0x03, 0x40, 0x7B, 0xC0, 0x0F,
+  0x40, 0x3F, 0x40, 0x93, 0x41, 0x1F, 0x40, 0x0B, 0xC0, 0x17, 0xC0, 0x07,
+  0xE0, 0x03, 0x13, 0x40, 0x57, 0xC0, 0x17, 0xE0, 0x03, 0x07, 0xE0, 0x03,
+  0x23, 0xE0, 0x03, 0x17, 0xE0, 0x07, 0x0B, 0x40, 0x77, 0x40, 0x2B, 0x40,
+  0x9B, 0x40, 0x4B, 0x40, 0x03, 0xC0, 0x9F, 0x40, 0x17, 0x40, 0x2F, 0xC0,
+  0xC7, 0xE0, 0x07, 0x0B, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x27, 0x40, 0x23,
+  0xC0, 0x07, 0x40, 0x13, 0xE0, 0x0F, 0x03, 0x40, 0x23, 0x40, 0x03, 0x40,
+  0x77, 0xE0, 0x0F, 0x23, 0xC0, 0x17, 0x40, 0x27, 0x40, 0x57, 0xC0, 0x0F,
+  0xE0, 0x03, 0x07, 0x40, 0xA3, 0xC0, 0xB3, 0xC0, 0x17, 0x23, 0xF8, 0x40,
+  0x03, 0xE0, 0xD7, 0x00, 0xE0, 0x00, 0xEF, 0xC0, 0xF7, 0xE0, 0x03, 0x07,
+  0x41, 0x17, 0x41, 0xC3, 0x41, 0x3B, 0x40, 0x07, 0xE0, 0x03, 0x1B, 0xC0,
+  0x0B, 0x40, 0x1B, 0xC0, 0x0B, 0x40, 0x07, 0x40, 0x27, 0x40, 0x03, 0xC3,
+  0xCB, 0xC0, 0x43, 0x41, 0x7B, 0x40, 0x2B, 0x40, 0x1B, 0x40, 0x27, 0xC0,
+  0x03, 0xE0, 0x03, 0x17, 0x40, 0x2B, 0x40, 0x03, 0x41, 0x8B, 0x40, 0x07,
+  0xC0, 0x23, 0x40, 0x0B, 0x40, 0x13, 0xC0, 0x53, 0xC0, 0x17, 0x40, 0x07,
+  0xE0, 0x03, 0x4F, 0x40, 0x5F, 0x40, 0x13, 0xC0, 0x2F, 0x42, 0xF7, 0xC0,
+  0x13, 0x40, 0x17, 0x40, 0x03, 0xE2, 0x03, 0x2B, 0x40, 0x27, 0x40, 0x3F,
+  0x40, 0x83, 0x40, 0x1B, 0xC0, 0x03, 0x40, 0x13, 0xE0, 0x13, 0x0B, 0x40,
+  0x1F, 0xE0, 0x03, 0x8B, 0x40, 0x67, 0xC0, 0x57, 0x40, 0x1B, 0x40, 0x03,
+  0x40, 0xAF, 0xE0, 0x03, 0x43, 0xE0, 0x03, 0x2F, 0x40, 0x17, 0xE0, 0x03,
+  0x97, 0xC0, 0x7F, 0x40, 0x33, 0x40, 0x3B, 0x40, 0x1F, 0xE0, 0x0F, 0x03,
+  0xE0, 0x03, 0x1F, 0x40, 0x37, 0x40, 0x57, 0x40, 0xC7, 0x40, 0x0B, 0xE0,
+  0x03, 0x33, 0x40, 0x27, 0x40, 0x03, 0x40, 0x53, 0x40, 0x03, 0x40, 0x1B,
+  0xC0, 0xA3, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x17, 0x40, 0x3B, 0x40, 0x0B,
+  0xC0, 0x8F, 0xE0, 0x07, 0x47, 0x40, 0x1B, 0xE0, 0x03, 0x03, 0x40, 0x33,
+  0x40, 0x57, 0x40, 0x03, 0x40, 0x17, 0xC0, 0x53, 0x40, 0x3F, 0x45, 0x1F,
+  0x40, 0x07, 0x40, 0x17, 0x40, 0x03, 0x40, 0x4B, 0x40, 0x0F, 0x40, 0x03,
+  0x40, 0x0F, 0xC0, 0x33, 0x40, 0x0B, 0x40, 0x77, 0x40, 0x03, 0x41, 0x3B,
+  0x40, 0x0F, 0x40, 0xC7, 0x40, 0x07, 0xE0, 0x07, 0x03, 0x40, 0x3B, 0x40,
+  0x27, 0xC0, 0x17, 0x40, 0x53, 0xC0, 0x0B, 0xC0, 0x07, 0x40, 0x13, 0x40,
+  0x03, 0xC0, 0x0F, 0x40, 0x07, 0x40, 0x33, 0x40, 0x9B, 0xC0, 0x5F, 0x40,
+  0x13, 0xE0, 0x0F, 0x03, 0x40, 0x63, 0x40, 0x2B, 0x40, 0x9F, 0x45, 0x9B,
+  0x40, 0x03, 0x23, 0xF8, 0x40, 0x03, 0xE0, 0xD7, 0x00, 0x61, 0x27, 0x41,
+  0x2B, 0x41, 0xD7, 0xE1, 0x03, 0x1F, 0x41, 0x0B, 0xE1, 0x07, 0x53, 0xC0,
+  0x1F, 0x41, 0x2B, 0x40, 0x0B, 0x40, 0x23, 0x41, 0xB7, 0x40, 0x07, 0x40,
+  0x0F, 0x40, 0x03, 0xC0, 0x33, 0x41, 0x53, 0x40, 0x0F, 0xE0, 0x1F, 0x03,
+  0x40, 0x83, 0x40, 0x03, 0x40, 0x87, 0x02, 0x27, 0x27, 0x27, 0x60, 0x57,
+  0xC0, 0x43, 0x40, 0x5F, 0x40, 0x67, 0xC0, 0x0F, 0xE0, 0x0B, 0x53, 0x40,
+  0x1B, 0xC1, 0xEB, 0x40, 0x2F, 0x40, 0x47, 0x40, 0x33, 0xE0, 0x03, 0x07,
+  0x40, 0x5F, 0xC0, 0x3B, 0x40, 0x23, 0x40, 0x1F, 0xE0, 0x03, 0x13, 0xC0,
+  0x1B, 0x40, 0x07, 0x40, 0xC7, 0x40, 0x23, 0x40, 0x07, 0x40, 0x0F, 0x40,
+  0x03, 0x40, 0x63, 0xC0, 0xFB, 0xC0, 0x0F, 0x42, 0xF3, 0x40, 0x0B, 0x40,
+  0x4B, 0x40, 0x2F, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x0B, 0x42, 0x47, 0x40,
+  0x07, 0x40, 0x63, 0xC0, 0x07, 0x40, 0x1B, 0x40, 0x0F, 0x40, 0x97, 0x40,
+  0x03, 0x40, 0x0F, 0x40, 0x63, 0x40, 0x5B, 0x40, 0x03, 0x40, 0x0F, 0x40,
+  0x03, 0x40, 0x57, 0x40, 0x03, 0x40, 0x13, 0x40, 0x3B, 0xE0, 0x07, 0x5F,
+  0x40, 0x23, 0x40, 0x47, 0x40, 0x1F, 0x40, 0x0B, 0x40, 0x23, 0x40, 0x4F,
+  0x40, 0x0F, 0xE0, 0x03, 0xA3, 0x40, 0x1B, 0xE0, 0x0F, 0x03, 0x40, 0x3F,
+  0x40, 0x33, 0x40, 0x07, 0x40, 0x23, 0xE0, 0x07, 0x37, 0x40, 0x17, 0x40,
+  0x57, 0x40, 0x53, 0x40, 0x1F, 0x40, 0x07, 0x40, 0x23, 0x40, 0x07, 0x40,
+  0x17, 0x41, 0xA7, 0x40, 0x07, 0x40, 0x1B, 0xC0, 0x03, 0x40, 0x0F, 0xC0,
+  0xF7, 0x40, 0x0B, 0x40, 0x2B, 0xE0, 0x03, 0x33, 0xC0, 0xC7, 0xE0, 0x03,
+  0x77, 0x40, 0x27, 0x40, 0x3F, 0x40, 0x2B, 0x40, 0x07, 0x40, 0x03, 0xC0,
+  0x13, 0x40, 0x0B, 0x41, 0x1F, 0x40, 0x07, 0xE0, 0x03, 0x33, 0x40, 0x0F,
+  0xE0, 0x03, 0x2F, 0x40, 0x0F, 0x40, 0x03, 0xC1, 0x33, 0x40, 0x0B, 0xE0,
+  0x17, 0x03, 0xE0, 0x0B, 0x3F, 0x40, 0x63, 0x40, 0x03, 0x23, 0xF8, 0x40,
+  0x03, 0xE0, 0xD7, 0x00, 0xE1, 0x04, 0x23, 0x41, 0x73, 0x41, 0xF3, 0x41,
+  0x37, 0xE1, 0x0B, 0x1B, 0x40, 0x1F, 0x40, 0x03, 0x40, 0x23, 0x41, 0x23,
+  0xC1, 0xE7, 0x40, 0x2F, 0x40, 0x17, 0xC1, 0xDB, 0x40, 0x0B, 0x40, 0x1B,
+  0x40, 0x0F, 0x40, 0x2B, 0x40, 0x1F, 0xC1, 0xC3, 0x40, 0x0B, 0xE0, 0x07,
+  0x03, 0x40, 0x23, 0x40, 0x33, 0x42, 0x27, 0xE0, 0x07, 0x1B, 0x40, 0x0F,
+  0xC0, 0x3B, 0x40, 0x73, 0x40, 0x2B, 0x40, 0x13, 0x40, 0x03, 0x40, 0x33,
+  0x40, 0x03, 0x40, 0x6B, 0x40, 0x07, 0xC0, 0x13, 0x40, 0x77, 0xC0, 0x0F,
+  0xC0, 0x2F, 0x40, 0x07, 0x40, 0x13, 0x40, 0x07, 0x40, 0x27, 0xE0, 0x03,
+  0x03, 0x40, 0x17, 0x40, 0x33, 0x40, 0x1B, 0x40, 0xF7, 0x40, 0x0F, 0x40,
+  0x03, 0xC0, 0x23, 0x40, 0x97, 0x44, 0x5B, 0x40, 0x07, 0x40, 0x13, 0x40,
+  0x2B, 0xC0, 0x1F, 0x40, 0x2F, 0xC0, 0x17, 0x40, 0x13, 0x40, 0x43, 0x40,
+  0x03, 0x40, 0xAB, 0xE0, 0x03, 0x27, 0x40, 0x37, 0x40, 0x17, 0x40, 0x07,
+  0xC0, 0x03, 0x40, 0x0F, 0x40, 0x27, 0x40, 0x07, 0xC0, 0x13, 0xE0, 0x03,
+  0x07, 0xC0, 0x4F, 0xE0, 0x03, 0x13, 0x40, 0x0B, 0xC0, 0x6F, 0xC0, 0x0B,
+  0x40, 0x83, 0xC1, 0x23, 0x40, 0x13, 0x40, 0x03, 0x40, 0x3B, 0x40, 0x07,
+  0x40, 0x17, 0x40, 0x0B, 0xC0, 0x03, 0xE0, 0x0F, 0x6B, 0x40, 0x2B, 0xC0,
+  0x03, 0xE0, 0x03, 0x33, 0x40, 0xC3, 0x40, 0x17, 0x40, 0x63, 0x40, 0x07,
+  0xE0, 0x07, 0x03, 0x40, 0x17, 0xE0, 0x03, 0x8F, 0x40, 0x1F, 0x40, 0x6B,
+  0x40, 0x07, 0xC0, 0x03, 0x40, 0x1F, 0x40, 0x53, 0x40, 0x7B, 0x40, 0x4F,
+  0xE0, 0x07, 0x1F, 0x40, 0x27, 0x40, 0x13, 0x41, 0xC7, 0xE0, 0x03, 0x1F,
+  0x40, 0x33, 0xC0, 0x1B, 0x40, 0x3B, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x73,
+  0x40, 0x07, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x5F, 0x40, 0x1F, 0x40, 0x43,
+  0xC0, 0x13, 0x40, 0x17, 0xC1, 0x5B, 0x40, 0x1B, 0x40, 0x4B, 0xC0, 0x03,
+  0x40, 0x27, 0x40, 0x13, 0x02, 0x32, 0x32, 0x32, 0x60, 0x27, 0x40, 0x2B,
+  0x40, 0x43, 0x40, 0x17, 0x40, 0x7F, 0x40, 0x03, 0x23, 0xF8, 0x40, 0x03,
+  0xE0, 0xD7, 0x00, 0x61, 0x2F, 0x41, 0x33, 0x40, 0x03, 0x41, 0x1F, 0x41,
+  0x33, 0xC0, 0x0B, 0x40, 0x07, 0xC1, 0x13, 0x41, 0x2F, 0x40, 0x0F, 0xC0,
+  0x03, 0x40, 0x2B, 0x40, 0x03, 0x40, 0x0F, 0x41, 0x3F, 0x40, 0x07, 0xE0,
+  0x0B, 0x03, 0x40, 0x3F, 0x40, 0x17, 0x40, 0x23, 0x40, 0x0B, 0x40, 0x03,
+  0x41, 0x5F, 0xC0, 0x03, 0x40, 0x1B, 0x41, 0x7B, 0x40, 0x4B, 0xE5, 0x07,
+  0xBB, 0x40, 0x73, 0x40, 0x2F, 0x40, 0x23, 0x40, 0x03, 0xC0, 0x0B, 0x40,
+  0x07, 0x42, 0x2B, 0x40, 0x07, 0x40, 0x03, 0x40, 0x4B, 0x40, 0xB7, 0xC0,
+  0x2F, 0xC0, 0x1B, 0x40, 0x33, 0x40, 0x77, 0x40, 0x07, 0xE0, 0x07, 0x03,
+  0x40, 0x73, 0x40, 0x13, 0x40, 0x3F, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x03,
+  0xC0, 0x43, 0x40, 0x8F, 0x40, 0x3B, 0x40, 0x07, 0x4F, 0x3B, 0x40, 0x07,
+  0x40, 0x1F, 0x40, 0x03, 0xC0, 0x2F, 0x40, 0x1F, 0x40, 0x0F, 0xC0, 0x03,
+  0x40, 0x3B, 0x40, 0x87, 0x40, 0x03, 0x40, 0x0B, 0xC0, 0x17, 0x40, 0x07,
+  0xE0, 0x0B, 0x13, 0x40, 0x17, 0x40, 0x27, 0x40, 0xBF, 0x40, 0x03, 0xC0,
+  0x57, 0x40, 0x17, 0x40, 0x0B, 0xC0, 0xA3, 0x40, 0x23, 0x40, 0x13, 0x40,
+  0x83, 0x40, 0x73, 0x44, 0x8B, 0x40, 0x07, 0x40, 0x17, 0x40, 0x37, 0x40,
+  0x03, 0x40, 0x5F, 0x40, 0x23, 0xE0, 0x03, 0x03, 0x40, 0x1F, 0x40, 0x17,
+  0x40, 0x4B, 0x40, 0x17, 0x40, 0x33, 0x40, 0x43, 0x40, 0x03, 0x40, 0x0F,
+  0xC0, 0x03, 0xC0, 0x1F, 0x40, 0x07, 0x40, 0x4B, 0x40, 0x07, 0x40, 0x3B,
+  0xC0, 0x1F, 0xC0, 0x2F, 0x40, 0x13, 0x40, 0x03, 0x40, 0x1F, 0xC0, 0x1B,
+  0xC0, 0x07, 0x40, 0x13, 0xE1, 0x03, 0x77, 0xC0, 0x17, 0x40, 0x07, 0x40,
+  0x1B, 0x40, 0x07, 0xC0, 0x47, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0x40, 0x1F,
+  0x40, 0x57, 0xE0, 0x03, 0x13, 0xE0, 0x0B, 0x0B, 0x40, 0x23, 0x40, 0xC3,
+  0x40, 0x1B, 0xC0, 0xD7, 0xC8, 0x83, 0x40, 0x1B, 0x40, 0x47, 0x40, 0x03,
+  0xC0, 0x1B, 0xC0, 0x07, 0x40, 0x13, 0x40, 0x1F, 0x40, 0x37, 0xC0, 0x03,
+  0x40, 0x1B, 0xC0, 0x13, 0x40, 0x07, 0x40, 0x0F, 0xC0, 0x27, 0x40, 0x0F,
+  0x23, 0xF8, 0x40, 0x03, 0xE0, 0xD7, 0x00, 0x60, 0xEB, 0x40, 0xEF, 0xC1,
+  0x17, 0xC0, 0x07, 0xE1, 0x03, 0x67, 0xE0, 0x0B, 0x1F, 0x40, 0x13, 0x41,
+  0x33, 0xC0, 0x2F, 0xC0, 0x07, 0x40, 0x17, 0x41, 0x47, 0xC0, 0x3F, 0x40,
+  0x17, 0x40, 0x27, 0x42, 0x1B, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x1B, 0x40,
+  0x03, 0x40, 0x0B, 0xC0, 0x03, 0x40, 0x0F, 0x42, 0xEF, 0x40, 0x07, 0x40,
+  0x03, 0x40, 0x0B, 0x40, 0x1B, 0x40, 0x33, 0x40, 0x53, 0x40, 0x0B, 0xE0,
+  0x03, 0x03, 0x40, 0x23, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x6F, 0x40, 0x0B,
+  0xC0, 0x33, 0x40, 0x0B, 0x42, 0x6B, 0x40, 0x3B, 0x40, 0x03, 0xC0, 0x1F,
+  0x40, 0x17, 0x40, 0x03, 0x40, 0x4F, 0x42, 0xE7, 0x40, 0x93, 0xE0, 0x07,
+  0x1B, 0x40, 0x1F, 0x40, 0x03, 0xC0, 0x17, 0xE0, 0x03, 0x53, 0x40, 0x17,
+  0xC0, 0x0F, 0x40, 0x57, 0x40, 0x0F, 0x40, 0x4B, 0x40, 0x07, 0x40, 0x03,
+  0x40, 0x8B, 0x40, 0x1F, 0x40, 0x07, 0x40, 0x3F, 0x40, 0x03, 0x40, 0x27,
+  0xE0, 0x03, 0x23, 0x40, 0x27, 0x40, 0x03, 0x40, 0x1B, 0x40, 0x07, 0x40,
+  0x03, 0x40, 0x23, 0x40, 0x8F, 0xC0, 0x13, 0x40, 0x3F, 0xC0, 0x47, 0x40,
+  0x1F, 0x40, 0x03, 0x40, 0x1B, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x4F, 0x40,
+  0x33, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x13, 0x40, 0x03, 0x40, 0x1F, 0x40,
+  0x0F, 0x40, 0x07, 0x40, 0x03, 0x40, 0x13, 0xE0, 0x1B, 0x03, 0x41, 0x2B,
+  0xC0, 0x27, 0x40, 0x7B, 0x40, 0x0B, 0x40, 0x3F, 0x40, 0x93, 0x40, 0x4F,
+  0x40, 0x13, 0x45, 0x9B, 0x40, 0x93, 0x40, 0x03, 0xC0, 0x1F, 0x40, 0x7F,
+  0xC0, 0x0B, 0x40, 0x07, 0xC0, 0x03, 0x40, 0x37, 0xC0, 0x0B, 0xC0, 0x47,
+  0x40, 0x2B, 0x40, 0x4B, 0x40, 0x0F, 0x55, 0xEF, 0x40, 0x23, 0x40, 0x0B,
+  0xC0, 0x07, 0x40, 0x1B, 0x40, 0x23, 0xC0, 0x0F, 0xC0, 0x3F, 0x40, 0x07,
+  0x40, 0x1B, 0x40, 0x07, 0xE0, 0x03, 0x03, 0xC0, 0x3B, 0x40, 0x33, 0xE1,
+  0x07, 0xC7, 0x40, 0x1B, 0xC0, 0x2B, 0x40, 0xDB, 0x40, 0x23, 0xE0, 0x03,
+  0x13, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x6B, 0xC0, 0x5B, 0x40, 0x0F, 0x40,
+  0x0B, 0x40, 0x07, 0x40, 0x03, 0x23, 0xF8, 0x40, 0x03, 0xE0, 0xD7, 0x00,
+  0x60, 0xF3, 0x40, 0xF7, 0x41, 0x23, 0x41, 0x33, 0x41, 0xEB, 0x41, 0x33,
+  0x40, 0x03, 0x40, 0x0F, 0x40, 0x03, 0xC1, 0xF3, 0x40, 0x23, 0x40, 0x2B,
+  0x40, 0x13, 0xE0, 0x0F, 0x03, 0xE0, 0x03, 0x37, 0x41, 0x47, 0xE1, 0x07,
+  0x9B, 0x40, 0x37, 0x40, 0x17, 0x40, 0x07, 0x40, 0x03, 0x40, 0x0B, 0x42,
+  0x0F, 0x40, 0x5B, 0x41, 0x8F, 0x40, 0x0F, 0x40, 0x17, 0x40, 0x03, 0x40,
+  0x8B, 0x40, 0x7B, 0x40, 0x07, 0x40, 0x0F, 0xE0, 0x0F, 0x03, 0x40, 0x23,
+  0xE7, 0x07, 0xA3, 0xC0, 0xA7, 0x40, 0x3B, 0x40, 0x93, 0x40, 0x23, 0xC0,
+  0x3F, 0x40, 0x13, 0xC0, 0x0F, 0x40, 0x77, 0x40, 0x0F, 0x40, 0x77, 0xE0,
+  0x03, 0xAB, 0xC0, 0x1F, 0xE0, 0x03, 0x33, 0x43, 0x03, 0x40, 0x4B, 0xC0,
+  0x13, 0xE0, 0x07, 0x07, 0x40, 0x47, 0x47, 0x9B, 0x40, 0x23, 0x40, 0x3F,
+  0x40, 0x0F, 0x40, 0x03, 0xC0, 0x27, 0xC0, 0x63, 0x40, 0x67, 0x40, 0x23,
+  0x40, 0x1B, 0x40, 0x03, 0xC0, 0x1F, 0xE0, 0x0B, 0x07, 0xC0, 0x1F, 0x40,
+  0x2F, 0x40, 0x1F, 0x40, 0x43, 0x40, 0x03, 0x40, 0xB7, 0x40, 0xE3, 0x40,
+  0x03, 0x40, 0x17, 0xE0, 0x03, 0x03, 0x40, 0x7B, 0xC0, 0x0F, 0x40, 0x3F,
+  0x40, 0x93, 0x41, 0x1F, 0x40, 0x0B, 0xC0, 0x17, 0xC0, 0x07, 0xE0, 0x03,
+  0x13, 0x40, 0x57, 0xC0, 0x17, 0xE0, 0x03, 0x07, 0xE0, 0x03, 0x23, 0xE0,
+  0x03, 0x17, 0xE0, 0x07, 0x0B, 0x40, 0x77, 0x40, 0x2B, 0x40, 0x9B, 0x40,
+  0x4B, 0x40, 0x03, 0xC0, 0x9F, 0x40, 0x17, 0x40, 0x2F, 0xC0, 0xC7, 0xE0,
+  0x07, 0x0B, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x27, 0x40, 0x23, 0xC0, 0x07,
+  0x40, 0x13, 0xE0, 0x0F, 0x03, 0x40, 0x23, 0x40, 0x03, 0x40, 0x77, 0xE0,
+  0x0F, 0x23, 0xC0, 0x17, 0x40, 0x27, 0x40, 0x57, 0xC0, 0x0F, 0xE0, 0x03,
+  0x07, 0x40, 0xA3, 0xC0, 0xB3, 0xC0, 0x17, 0x23, 0xF8, 0x40, 0x03, 0xE0,
+  0xD7, 0x00, 0x61, 0xA3, 0xC1, 0xA7, 0x40, 0x07, 0x43, 0x83, 0x41, 0x0F,
+  0xC1, 0x07, 0xC0, 0x07, 0xC1, 0x3B, 0x40, 0x23, 0xC1, 0x2B, 0xE0, 0x0B,
+  0x27, 0xC0, 0x2F, 0x40, 0x07, 0x40, 0x2B, 0xC0, 0x07, 0xC0, 0x2B, 0x40,
+  0x07, 0xC0, 0x3F, 0xC0, 0x1F, 0x41, 0x9B, 0x43, 0x5B, 0x40, 0x2B, 0x40,
+  0x1B, 0x40, 0x07, 0xC0, 0x6F, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x0F, 0x40,
+  0x3B, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x37, 0x40, 0x07, 0x40,
+  0xB3, 0xC0, 0x4B, 0x40, 0x1B, 0x40, 0x17, 0x40, 0x07, 0x40, 0x13, 0x40,
+  0x1F, 0x42, 0x1F, 0xC0, 0x13, 0x40, 0x17, 0x40, 0x03, 0x40, 0x17, 0xC0,
+  0x1F, 0x40, 0x0F, 0xC0, 0x03, 0x40, 0x17, 0x40, 0x83, 0xC0, 0x53, 0x40,
+  0x23, 0xC0, 0x0B, 0xC0, 0x23, 0xE0, 0x0B, 0x07, 0xE0, 0x07, 0x5F, 0xE0,
+  0x07, 0x23, 0x40, 0x47, 0xC0, 0x03, 0xC0, 0x1B, 0x40, 0x33, 0x40, 0xD7,
+  0xC0, 0x0F, 0x40, 0x77, 0x40, 0x23, 0x40, 0x07, 0x40, 0x87, 0x40, 0x0B,
+  0x44, 0x2B, 0x40, 0x0F, 0x40, 0x83, 0x40, 0x27, 0xE0, 0x03, 0x2F, 0x40,
+  0x0F, 0xC0, 0xDB, 0x40, 0x2B, 0xC0, 0x03, 0x40, 0x17, 0x40, 0x0B, 0x40,
+  0x33, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x03, 0xE0, 0x03, 0x6F, 0xC0, 0x5F,
+  0x40, 0x17, 0x40, 0x2F, 0x40, 0x57, 0x40, 0x1F, 0x40, 0x4F, 0x40, 0x0F,
+  0xE0, 0x13, 0x03, 0x4B, 0x73, 0x40, 0x3F, 0x40, 0x33, 0x40, 0x03, 0x40,
+  0x37, 0xE0, 0x07, 0x2F, 0xE0, 0x03, 0x57, 0xE0, 0x07, 0x1B, 0xE0, 0x07,
+  0x0F, 0xC0, 0xA3, 0x40, 0x53, 0x40, 0xEB, 0x40, 0x07, 0xC0, 0x23, 0x40,
+  0x0B, 0x40, 0x13, 0x40, 0x03, 0xC0, 0x13, 0x40, 0x07, 0xC0, 0x5F, 0x40,
+  0x07, 0x46, 0x3F, 0x41, 0x27, 0x40, 0x0B, 0x40, 0x2F, 0x40, 0x8F, 0xE2,
+  0x03, 0x4F, 0x40, 0x13, 0x40, 0x33, 0xC0, 0x03, 0x40, 0x1F, 0x40, 0x13,
+  0x40, 0x07, 0x45, 0x1B, 0x40, 0x17, 0xC0, 0x83, 0x40, 0x0B, 0x40, 0x03,
+  0x23, 0xF8, 0x40, 0x03, 0xE0, 0xD7, 0x00, 0x60, 0xEB, 0x40, 0xEF, 0xC0,
+  0x03, 0x41, 0x17, 0xC0, 0x0B, 0xE0, 0x0B, 0x07, 0xE2, 0x0B, 0x1F, 0x40,
+  0x33, 0xC1, 0x9F, 0x41, 0x53, 0x40, 0x37, 0x41, 0x8B, 0xC1, 0x53, 0xC2,
+  0x23, 0x41, 0x6B, 0xE0, 0x03, 0x3F, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x33,
+  0xC0, 0x03, 0x40, 0x23, 0x41, 0xBB, 0xC0, 0x0F, 0x40, 0x57, 0x40, 0x4B,
+  0xC0, 0x03, 0x40, 0x4B, 0x40, 0x5F, 0x40, 0x07, 0x02, 0x34, 0x34, 0x34,
+  0x60, 0x2B, 0x40, 0x43, 0x40, 0x13, 0xC0, 0x23, 0x40, 0x0B, 0x40, 0x93,
+  0x40, 0x17, 0xC0, 0x47, 0x40, 0x0B, 0x40, 0x17, 0xC0, 0x03, 0x40, 0x1F,
+  0xC0, 0x2F, 0x40, 0x63, 0x40, 0x03, 0x40, 0x0F, 0xC0, 0x1F, 0xC0, 0x37,
+  0xC0, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0x23, 0xC0, 0x13, 0xE0, 0x07, 0x07,
+  0x40, 0x5B, 0x40, 0x4F, 0x40, 0x03, 0xE0, 0x07, 0x1B, 0x40, 0x3F, 0xC2,
+  0xAB, 0xC0, 0x1B, 0x40, 0xCB, 0xC0, 0x0B, 0xE0, 0x0B, 0x07, 0x40, 0x47,
+  0xC1, 0x4B, 0x40, 0x3F, 0x40, 0x23, 0xC0, 0x07, 0x40, 0x3B, 0xE0, 0x07,
+  0xDB, 0x40, 0x1B, 0x40, 0x63, 0x40, 0x27, 0x41, 0x4F, 0x40, 0xCB, 0x40,
+  0x0B, 0x40, 0x03, 0x40, 0x0B, 0xE8, 0x07, 0x0B, 0xE0, 0x03, 0x3F, 0x40,
+  0x3B, 0xC0, 0x03, 0x40, 0x2B, 0x40, 0x33, 0x40, 0x03, 0x40, 0x67, 0x40,
+  0x07, 0xE0, 0x03, 0x03, 0xE0, 0x03, 0x1F, 0xE0, 0x03, 0x17, 0x40, 0xFF,
+  0x40, 0x43, 0x40, 0x07, 0xC0, 0x17, 0xC0, 0x63, 0x40, 0x17, 0x40, 0xCF,
+  0xE0, 0x03, 0x17, 0x40, 0x1B, 0x40, 0x03, 0x40, 0x63, 0x40, 0x53, 0xC1,
+  0xFF, 0xC0, 0x23, 0xE0, 0x07, 0x07, 0x40, 0x57, 0x40, 0x43, 0x40, 0x07,
+  0xC0, 0x1B, 0x40, 0x0B, 0x40, 0x3B, 0xC0, 0x0F, 0x40, 0x67, 0x40, 0x0B,
+  0x40, 0x07, 0xC1, 0x3B, 0x40, 0x0F, 0x40, 0x23, 0xE0, 0x13, 0x5F, 0x44,
+  0xDB, 0x40, 0x03, 0x23, 0xF8, 0x40, 0x03, 0xE0, 0xD7, 0x00, 0x61, 0x37,
+  0xC1, 0x3B, 0xC1, 0x17, 0x41, 0x87, 0x40, 0x0B, 0x41, 0x2F, 0xC0, 0x03,
+  0x41, 0x47, 0x40, 0x0B, 0x41, 0x3F, 0x40, 0x03, 0x40, 0x23, 0x40, 0x13,
+  0x40, 0x0B, 0x40, 0x2B, 0x40, 0x07, 0x40, 0x1F, 0xE0, 0x03, 0x03, 0x40,
+  0x1F, 0x41, 0xA7, 0xE0, 0x03, 0x1B, 0x40, 0x6B, 0xC0, 0x23, 0x40, 0x1F,
+  0xC0, 0x0B, 0x40, 0x07, 0xE0, 0x03, 0x27, 0xE0, 0x07, 0x1B, 0xC0, 0x1F,
+  0x40, 0x3F, 0xE0, 0x07, 0x53, 0x40, 0x1B, 0x42, 0x3F, 0x40, 0x07, 0xC0,
+  0x03, 0x40, 0x4B, 0x40, 0x97, 0x40, 0x0F, 0x43, 0x0B, 0xE0, 0x0B, 0x4F,
+  0x40, 0x1B, 0xE0, 0x03, 0x17, 0xC0, 0x33, 0x40, 0x07, 0x40, 0x1B, 0xC0,
+  0x03, 0x40, 0x23, 0x40, 0x77, 0x40, 0x07, 0x40, 0x13, 0x40, 0x57, 0x40,
+  0x6F, 0x40, 0x07, 0x00, 0x34, 0x24, 0x83, 0x40, 0x0B, 0x40, 0x17, 0x40,
+  0x03, 0x40, 0x3B, 0x40, 0x17, 0x40, 0x07, 0x40, 0x0F, 0xE0, 0x13, 0x03,
+  0x40, 0x53, 0x40, 0xCB, 0x40, 0x23, 0xE3, 0x03, 0xA7, 0x40, 0x3B, 0x40,
+  0x53, 0x41, 0x63, 0x40, 0x1B, 0xC0, 0x77, 0xC0, 0x2F, 0x40, 0x0F, 0x40,
+  0x03, 0x40, 0x0F, 0x40, 0x1F, 0x40, 0x03, 0x40, 0x2B, 0x40, 0x0F, 0x42,
+  0xEB, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x17, 0x40, 0x0B, 0xE0, 0x03, 0x2B,
+  0xE0, 0x07, 0x57, 0x40, 0x7F, 0x40, 0x6F, 0x40, 0x27, 0x40, 0x2F, 0xC0,
+  0x03, 0xE0, 0x03, 0x0F, 0x40, 0x1F, 0x40, 0x43, 0x40, 0x3B, 0x40, 0x0B,
+  0x40, 0x23, 0xC0, 0x07, 0xE0, 0x07, 0x0B, 0x40, 0x0F, 0x40, 0x03, 0x40,
+  0x3F, 0x40, 0x33, 0xC0, 0x87, 0x40, 0x13, 0x40, 0x0F, 0x47, 0xAB, 0x40,
+  0x07, 0x40, 0x03, 0xC1, 0x97, 0xE0, 0x03, 0x4B, 0x40, 0x2F, 0x40, 0x93,
+  0x40, 0x1F, 0x40, 0x07, 0x40, 0x37, 0xC0, 0x1F, 0x40, 0x13, 0x40, 0x0F,
+  0xE0, 0x03, 0x03, 0xC0, 0x13, 0x40, 0x07, 0xC0, 0x5B, 0x40, 0x7B, 0x40,
+  0x3B, 0x40, 0x07, 0xE0, 0x03, 0x2B, 0xE0, 0x07, 0x0B, 0x40, 0x6B, 0xC0,
+  0x13, 0x40, 0x3F, 0x40, 0x03, 0x40, 0x37, 0x40, 0x03, 0x23, 0xF8, 0x40,
+  0x03, 0xE0, 0xD7, 0x00, 0xE0, 0x00, 0xFF, 0xC1, 0x07, 0x40, 0x07, 0xE1,
+  0x03, 0x6F, 0x41, 0x0B, 0xC1, 0x47, 0x41, 0x1F, 0x41, 0xB3, 0x40, 0x13,
+  0x40, 0x27, 0x40, 0x03, 0x40, 0x13, 0x42, 0x73, 0x40, 0x07, 0x40, 0x37,
+  0xE1, 0x03, 0x53, 0xC0, 0x0B, 0xC0, 0x3F, 0x40, 0x2F, 0x43, 0x1B, 0xD9,
+  0x77, 0x40, 0x0F, 0xC0, 0x33, 0xC0, 0x07, 0x40, 0x13, 0xE0, 0x0F, 0x03,
+  0x40, 0x63, 0x40, 0x1B, 0x40, 0x2B, 0x40, 0x07, 0xE0, 0x1F, 0x03, 0xE0,
+  0x0B, 0x2F, 0xC0, 0x13, 0xC0, 0x53, 0xC0, 0xAB, 0x40, 0x53, 0xE0, 0x03,
+  0x0B, 0xC0, 0x27, 0x40, 0x17, 0x40, 0x03, 0xC0, 0x0F, 0x40, 0xD3, 0x41,
+  0x07, 0x40, 0xFB, 0x40, 0x0B, 0x40, 0x1B, 0x40, 0x4B, 0x40, 0x13, 0x40,
+  0x0B, 0x40, 0x43, 0x40, 0x2B, 0x43, 0x33, 0x40, 0x17, 0x40, 0x03, 0x40,
+  0x17, 0x40, 0x03, 0x40, 0x1B, 0x40, 0x17, 0x40, 0x1F, 0x40, 0x0F, 0xE0,
+  0x13, 0x03, 0x40, 0x37, 0xC0, 0x5F, 0xC0, 0x33, 0x40, 0x37, 0x40, 0x67,
+  0x40, 0x1B, 0x40, 0x13, 0xE0, 0x03, 0x3F, 0x40, 0x13, 0x40, 0x93, 0x40,
+  0x07, 0x40, 0x03, 0x40, 0x3B, 0x40, 0x2B, 0x40, 0x13, 0x40, 0x0B, 0x40,
+  0x2B, 0x40, 0x0F, 0xC0, 0x07, 0x40, 0x0B, 0xC0, 0x17, 0x40, 0x2F, 0x40,
+  0x17, 0xE0, 0x0F, 0x03, 0x40, 0x77, 0xC0, 0x1B, 0x40, 0x0B, 0x40, 0x53,
+  0x40, 0x3F, 0xC0, 0x13, 0xC0, 0x07, 0x40, 0x4F, 0x40, 0x17, 0x40, 0x07,
+  0x40, 0x03, 0xC0, 0x57, 0x40, 0xF7, 0x40, 0x33, 0x40, 0xB3, 0xC0, 0x13,
+  0x40, 0x47, 0xC0, 0x0B, 0xC0, 0x3F, 0xE0, 0x07, 0x0F, 0x40, 0x23, 0x40,
+  0x1B, 0x40, 0x07, 0x40, 0x03, 0x40, 0x3F, 0x40, 0x0F, 0x40, 0x27, 0x40,
+  0x67, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x0B, 0xC0, 0x03, 0xC0,
+  0x0F, 0x40, 0x07, 0x40, 0x87, 0x40, 0x2B, 0x40, 0x07, 0x40, 0x03, 0x40,
+  0x23, 0x40, 0x8F, 0x40, 0x4F, 0x40, 0x1F, 0xC0, 0x03, 0x40, 0x5B, 0x40,
+  0x03, 0x23, 0xF8, 0x40, 0x03, 0xE0, 0xD7, 0x00, 0xE0, 0x00, 0xF7, 0xC0,
+  0xFF, 0xE1, 0x07, 0x0F, 0x41, 0x27, 0x41, 0xB3, 0x40, 0x03, 0x40, 0x0B,
+  0x40, 0x03, 0x44, 0x03, 0x40, 0x03, 0x40, 0x33, 0x41, 0x2B, 0x40, 0x07,
+  0x40, 0x17, 0x41, 0x4F, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0xE0, 0x03, 0x37,
+  0xC0, 0x17, 0xC0, 0x33, 0x41, 0x87, 0x41, 0x93, 0x40, 0x3B, 0x40, 0x03,
+  0xC0, 0x1F, 0xE0, 0x27, 0x07, 0xC0, 0xB3, 0xC0, 0x57, 0xE0, 0x0B, 0x3F,
+  0x40, 0x23, 0x44, 0x77, 0x40, 0xA3, 0x40, 0x27, 0x40, 0x0F, 0xC0, 0x03,
+  0x40, 0x13, 0xE0, 0x03, 0x33, 0xC0, 0x0F, 0x40, 0x07, 0xC0, 0x23, 0x40,
+  0x1F, 0x40, 0xA3, 0x40, 0xB3, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x47, 0x40,
+  0x23, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x1F, 0x40, 0x2F, 0x40, 0x0B, 0x40,
+  0x03, 0x40, 0xDB, 0x40, 0x07, 0x40, 0x17, 0x40, 0x07, 0x40, 0x03, 0xE0,
+  0x03, 0x2B, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x1F, 0x41, 0x4F, 0x40, 0x5B,
+  0x40, 0x1F, 0x41, 0x33, 0xC0, 0x03, 0x40, 0x1B, 0x40, 0x23, 0x40, 0x17,
+  0x40, 0x07, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x2B, 0x40, 0x5F, 0x40, 0x07,
+  0x40, 0x13, 0x40, 0x27, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x1F, 0x40, 0x07,
+  0xE0, 0x03, 0x03, 0x40, 0x13, 0xE0, 0x03, 0x9B, 0xE0, 0x03, 0x0B, 0x40,
+  0x37, 0xC0, 0x0F, 0x40, 0x07, 0xE0, 0x03, 0x57, 0x40, 0x43, 0xE0, 0x0B,
+  0x63, 0x40, 0x17, 0x40, 0x03, 0x40, 0x3B, 0x40, 0xAB, 0x40, 0x37, 0x40,
+  0x03, 0x41, 0x13, 0x45, 0xE3, 0x40, 0x07, 0xC0, 0x1F, 0x40, 0xDB, 0x40,
+  0x27, 0x40, 0x0F, 0x40, 0x03, 0xC0, 0x0B, 0x40, 0x2F, 0x4C, 0x8B, 0x40,
+  0x2B, 0x40, 0x0B, 0x40, 0x07, 0x40, 0x03, 0x40, 0xAB, 0x40, 0x27, 0x40,
+  0x13, 0x40, 0x07, 0x40, 0x03, 0x40, 0x83, 0xE0, 0x03, 0x97, 0x40, 0x43,
+  0x40, 0x77, 0x40, 0x17, 0x40, 0x1F, 0xE0, 0x03, 0x2B, 0x40, 0x0F, 0xC0,
+  0x03, 0x40, 0x1F, 0xC0, 0x2B, 0x40, 0x07, 0x40, 0x17, 0x40, 0x07, 0xE0,
+  0x03, 0x4B, 0xE0, 0x03, 0x3B, 0x40, 0x1B, 0x40, 0x03, 0x23, 0xF8, 0x40,
+  0x03, 0xE0, 0xD7, 0x00, 0x60, 0xFB, 0xE0, 0x07, 0xFF, 0x41, 0x1B, 0xE0,
+  0x07, 0x13, 0x41, 0x47, 0x41, 0x3B, 0xE0, 0x03, 0x17, 0x40, 0x0F, 0x41,
+  0x2B, 0x40, 0x2F, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x03, 0xC1, 0xBF, 0x40,
+  0x0B, 0x40, 0x03, 0x40, 0x33, 0x41, 0xAB, 0x40, 0x27, 0x40, 0x0F, 0x40,
+  0x4B, 0xC0, 0x2F, 0xC0, 0x2B, 0x40, 0x23, 0xC0, 0x1B, 0x40, 0x1F, 0x4B,
+  0x0F, 0x40, 0x33, 0x40, 0x27, 0x40, 0x37, 0x40, 0x03, 0x40, 0x1F, 0x40,
+  0x0F, 0x40, 0x07, 0x40, 0x03, 0xC0, 0x33, 0x40, 0x13, 0xC0, 0x2B, 0x40,
+  0x17, 0x40, 0x03, 0x40, 0x43, 0x40, 0x33, 0x40, 0x03, 0x40, 0x0B, 0x40,
+  0x13, 0x40, 0x03, 0x40, 0x2B, 0xE0, 0x07, 0x13, 0x40, 0x17, 0xE0, 0x07,
+  0x03, 0xC0, 0x27, 0xE0, 0x07, 0x17, 0xE0, 0x0B, 0x0F, 0x40, 0x2B, 0xE0,
+  0x0F, 0x7F, 0x40, 0x1B, 0x40, 0x33, 0x40, 0x1F, 0xCA, 0x9F, 0x40, 0x0F,
+  0x42, 0xE7, 0xC0, 0xBF, 0x40, 0x0F, 0xC0, 0x0B, 0x40, 0x07, 0xE0, 0x03,
+  0xAF, 0x40, 0x1B, 0xE0, 0x03, 0x03, 0x40, 0x4F, 0x4E, 0x9F, 0xE0, 0x03,
+  0x07, 0x40, 0x33, 0xE0, 0x03, 0x23, 0xC0, 0x0B, 0xE1, 0x03, 0x5B, 0x40,
+  0x6F, 0xC0, 0x17, 0xC0, 0x07, 0x40, 0x67, 0x40, 0x47, 0x40, 0x3F, 0x40,
+  0x07, 0x40, 0xA3, 0x41, 0x1B, 0xE0, 0x03, 0xA7, 0xC0, 0x2B, 0xC0, 0x07,
+  0xC0, 0x53, 0x40, 0x0F, 0xC0, 0x3F, 0x40, 0x3B, 0x40, 0x37, 0x40, 0x07,
+  0x40, 0x4B, 0x43, 0xFF, 0x40, 0x07, 0x40, 0x23, 0x40, 0x03, 0xE0, 0x0B,
+  0x33, 0xC0, 0x13, 0x40, 0x37, 0xC0, 0x47, 0x40, 0x0B, 0x40, 0x43, 0xC0,
+  0x03, 0x40, 0x0F, 0x40, 0x3F, 0xC0, 0x07, 0x40, 0x17, 0x40, 0x2B, 0x40,
+  0x13, 0x40, 0x03, 0xC0, 0x0F, 0x40, 0x6B, 0x45, 0xDB, 0x40, 0x07, 0x40,
+  0x03, 0xC0, 0xEB, 0xC0, 0x2B, 0x40, 0x27, 0x02, 0x24, 0x24, 0x24, 0x60,
+  0xDF, 0xE0, 0x03, 0x13, 0x40, 0x57, 0x40, 0x1B, 0x40, 0x07, 0x44, 0xA3,
+  0x40, 0xFF, 0x40, 0x1F, 0x40, 0x03, 0x23, 0xF8, 0x40, 0x03, 0xE0, 0xD7,
+  0x00, 0x61, 0x87, 0x41, 0x8B, 0xC1, 0x33, 0x41, 0x57, 0x40, 0x03, 0x41,
+  0x17, 0x40, 0x07, 0xE0, 0x07, 0x03, 0x41, 0x1B, 0x40, 0x2F, 0x40, 0x03,
+  0xE0, 0x07, 0x1B, 0x40, 0x0F, 0x40, 0x1F, 0x40, 0x07, 0xE0, 0x0B, 0x03,
+  0x41, 0x9B, 0x40, 0x17, 0xE0, 0x03, 0x5B, 0x41, 0x7B, 0xE0, 0x07, 0x33,
+  0x40, 0x1F, 0x42, 0x83, 0xE0, 0x0B, 0x1B, 0x40, 0x3F, 0xE0, 0x03, 0x03,
+  0x40, 0x2B, 0xE0, 0x03, 0x0F, 0x40, 0x0B, 0x40, 0x4F, 0x40, 0x17, 0xC0,
+  0x6F, 0x40, 0x13, 0x40, 0x03, 0x40, 0x17, 0x40, 0x53, 0x40, 0x1B, 0x40,
+  0x03, 0x40, 0x13, 0xE0, 0x0B, 0x03, 0xC1, 0x0B, 0x40, 0x23, 0x40, 0x03,
+  0x40, 0x33, 0x40, 0x13, 0xE0, 0x03, 0x4F, 0x40, 0x17, 0x42, 0x2F, 0x40,
+  0x3F, 0xE1, 0x0F, 0x0B, 0x40, 0x17, 0x40, 0x33, 0x40, 0x03, 0x40, 0x27,
+  0x40, 0x03, 0x40, 0x13, 0x40, 0x07, 0x40, 0x8B, 0x40, 0x07, 0x40, 0x47,
+  0xC0, 0x07, 0x42, 0x83, 0x40, 0x0B, 0x43, 0x3F, 0x40, 0x6F, 0x40, 0x0B,
+  0xC0, 0x03, 0x40, 0x43, 0x42, 0xE3, 0x40, 0x3F, 0xC0, 0x1B, 0x40, 0x43,
+  0x40, 0x83, 0x40, 0x03, 0x40, 0x47, 0x40, 0x3F, 0x40, 0x03, 0x40, 0xAF,
+  0x40, 0x37, 0x40, 0x33, 0xC0, 0x2B, 0x40, 0x0F, 0xC0, 0x03, 0x40, 0x13,
+  0x40, 0x03, 0x40, 0x0F, 0xC0, 0x3B, 0x40, 0x33, 0x40, 0x4F, 0x40, 0x33,
+  0x40, 0x4B, 0x40, 0x0F, 0x40, 0x0B, 0x40, 0x23, 0x40, 0x0B, 0x40, 0x1B,
+  0x40, 0x0B, 0xE0, 0x03, 0x03, 0x40, 0x17, 0x40, 0x2B, 0x40, 0x13, 0x40,
+  0x07, 0xC0, 0x4B, 0x40, 0x0F, 0xC0, 0x03, 0x40, 0x37, 0x40, 0x1B, 0xC0,
+  0x0F, 0xC0, 0x07, 0xC0, 0x17, 0x40, 0xCF, 0x40, 0x03, 0x48, 0x07, 0x40,
+  0xDF, 0xE0, 0x03, 0x1F, 0xC0, 0x5F, 0x40, 0x1F, 0xC0, 0x17, 0xC0, 0x07,
+  0xC0, 0xBF, 0x40, 0x0F, 0x40, 0x1F, 0xC0, 0x63, 0x40, 0xB3, 0x40, 0x5B,
+  0xC0, 0x8B, 0x40, 0x17, 0x40, 0x03, 0x40, 0x13, 0x40, 0x07, 0xC0, 0x17,
+  0x40, 0x37, 0x40, 0x03, 0x40, 0x13, 0x40, 0x33, 0x41, 0x73, 0x40, 0x07,
+  0xC0, 0x03, 0x23, 0xF8, 0x40, 0x03, 0xE0, 0xD7, 0x00, 0x61, 0x03, 0x41,
+  0x07, 0xC0, 0x03, 0x40, 0xFF, 0xC0, 0x0B, 0xC0, 0x07, 0x41, 0x3B, 0x40,
+  0x0B, 0x41, 0x2B, 0xE1, 0x07, 0x3F, 0x40, 0x1B, 0x41, 0xA7, 0x40, 0x07,
+  0x40, 0x23, 0x41, 0x8B, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x2F, 0x40, 0x0F,
+  0x40, 0x53, 0x41, 0x5F, 0x40, 0x0B, 0x40, 0x1B, 0x40, 0x17, 0x40, 0x1F,
+  0x40, 0x0B, 0xC0, 0x03, 0x40, 0x13, 0xE0, 0x07, 0x5B, 0x40, 0x1B, 0x40,
+  0x17, 0x40, 0x07, 0x40, 0x43, 0x48, 0x13, 0x40, 0x07, 0x41, 0xFB, 0x40,
+  0x4B, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x1F, 0x40, 0x27, 0xE0, 0x0B, 0x3F,
+  0x40, 0x27, 0x40, 0x1F, 0xC0, 0x27, 0x40, 0x0B, 0x40, 0x3F, 0x40, 0x07,
+  0xE0, 0x03, 0x13, 0xE0, 0x03, 0x0B, 0x40, 0x4B, 0xE0, 0x07, 0x1F, 0x40,
+  0x0F, 0x40, 0x03, 0x40, 0x1B, 0xC0, 0xBB, 0x40, 0x0B, 0x40, 0x73, 0x40,
+  0x17, 0xC0, 0x67, 0xC0, 0x0B, 0x40, 0x0F, 0x41, 0x17, 0x40, 0x23, 0x40,
+  0x2F, 0xC0, 0x07, 0x40, 0x0B, 0x40, 0x23, 0xC0, 0x07, 0x40, 0x0B, 0x40,
+  0x1B, 0x40, 0x07, 0x40, 0x03, 0xC3, 0xBF, 0x40, 0x57, 0x40, 0x17, 0xE0,
+  0x03, 0x97, 0x40, 0x1F, 0x40, 0x03, 0x40, 0x17, 0x40, 0x07, 0x40, 0x03,
+  0x40, 0xCB, 0x40, 0x6B, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x2F, 0xE0, 0x03,
+  0x0F, 0x40, 0x13, 0x40, 0x03, 0x40, 0x17, 0x40, 0x07, 0x40, 0x77, 0xC0,
+  0x97, 0x40, 0x47, 0x40, 0x6F, 0x48, 0x4F, 0xE0, 0x03, 0x33, 0xC0, 0x2B,
+  0x40, 0x2F, 0x40, 0x03, 0xC0, 0x0F, 0x40, 0x2F, 0x40, 0x0F, 0xC0, 0x03,
+  0xC0, 0x4B, 0x40, 0x07, 0x40, 0x1B, 0x40, 0x57, 0x40, 0x1B, 0xE0, 0x07,
+  0x4B, 0x41, 0xFB, 0x40, 0x17, 0x40, 0x23, 0x40, 0x07, 0xE0, 0x07, 0x03,
+  0xC0, 0x2F, 0x40, 0x3F, 0x40, 0x4B, 0xE0, 0x07, 0x1F, 0x40, 0x37, 0x40,
+  0x03, 0xC1, 0x13, 0x40, 0x1F, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x33, 0x40,
+  0x03, 0x40, 0x37, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x17, 0x40, 0x03, 0x40,
+  0x57, 0xC2, 0x33, 0xC0, 0x33, 0x40, 0x07, 0x40, 0xCF, 0x40, 0x93, 0x41,
+  0x3B, 0x40, 0x0B, 0x40, 0x13, 0xC0, 0x03, 0x40, 0x13, 0x40, 0x03, 0x23,
+  0xF8, 0x40, 0x03, 0xE0, 0xD7, 0x00, 0xE0, 0x00, 0xF7, 0x41, 0x2F, 0x40,
+  0x03, 0x41, 0x07, 0x41, 0x47, 0x40, 0x0B, 0x47, 0x83, 0x40, 0x07, 0x40,
+  0x13, 0x41, 0x4B, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x03, 0x41, 0x37, 0x00,
+  0x34, 0x36, 0xFB, 0x40, 0x07, 0x40, 0x1F, 0x40, 0x13, 0x41, 0x9F, 0x40,
+  0x0B, 0x41, 0x3F, 0x40, 0x07, 0x40, 0x13, 0x40, 0x07, 0x40, 0x0F, 0x40,
+  0x27, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x1B, 0x42, 0x77, 0x40,
+  0x33, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x17, 0x42, 0x8F, 0xC0, 0x0B, 0x40,
+  0x07, 0xC0, 0x1F, 0x40, 0x1B, 0xC0, 0x03, 0x40, 0x9F, 0x40, 0x17, 0xC9,
+  0xD3, 0x40, 0x97, 0x40, 0x1B, 0xC0, 0x2F, 0x40, 0x1F, 0x40, 0x13, 0xC1,
+  0xFB, 0x40, 0x0B, 0x40, 0x1F, 0xE0, 0x07, 0x03, 0xE0, 0x0B, 0x17, 0x40,
+  0xA7, 0xE0, 0x03, 0x27, 0x40, 0xB3, 0x40, 0x13, 0x40, 0x5B, 0x40, 0x03,
+  0x42, 0x5F, 0x40, 0x5F, 0x40, 0x13, 0x40, 0x1B, 0x40, 0x2B, 0xC0, 0x17,
+  0x40, 0x13, 0x40, 0x0F, 0xC0, 0x03, 0x40, 0x1F, 0x40, 0x03, 0xC0, 0x0F,
+  0xE0, 0x07, 0x1F, 0xC0, 0x17, 0xE0, 0x03, 0x23, 0xC0, 0x13, 0x40, 0x53,
+  0xC0, 0x0B, 0xC0, 0x07, 0xE0, 0x03, 0xAF, 0x40, 0x33, 0x40, 0x03, 0xC0,
+  0x1B, 0xE0, 0x07, 0x2F, 0x40, 0xA3, 0x40, 0x13, 0xE1, 0x03, 0x4F, 0xC0,
+  0x2B, 0xE0, 0x03, 0x37, 0x40, 0x13, 0xE0, 0x03, 0x97, 0x40, 0x37, 0x40,
+  0xE3, 0x40, 0x17, 0xE0, 0x0B, 0x03, 0xE0, 0x03, 0x2B, 0x40, 0x0B, 0xC3,
+  0x47, 0xC0, 0x9B, 0x40, 0x3B, 0x40, 0x43, 0xC0, 0x3B, 0xE0, 0x03, 0x0B,
+  0xC0, 0x13, 0x40, 0x97, 0x40, 0x27, 0xC0, 0x0F, 0x40, 0x0B, 0x41, 0xCF,
+  0xC0, 0x2B, 0x40, 0x57, 0xC0, 0x1B, 0x40, 0x2B, 0xC0, 0x0B, 0x40, 0x27,
+  0x40, 0x0F, 0x40, 0x03, 0x40, 0x2F, 0x40, 0x07, 0xC0, 0x1B, 0x40, 0x33,
+  0x40, 0x3F, 0x40, 0x13, 0x40, 0xDF, 0x40, 0x0F, 0x40, 0x1B, 0x40, 0x13,
+  0xC0, 0x37, 0xE0, 0x07, 0x33, 0x40, 0x1F, 0xE0, 0x03, 0x03, 0xC0, 0x37,
+  0x40, 0x3B, 0x23, 0xF8, 0x40, 0x03, 0xE0, 0xD7, 0x00, 0x61, 0x1F, 0xC1,
+  0x23, 0x41, 0x0B, 0x40, 0xFB, 0x41, 0xCB, 0x40, 0x03, 0x40, 0x0F, 0x40,
+  0x03, 0x41, 0x17, 0x40, 0x07, 0x41, 0x47, 0x40, 0x2B, 0x40, 0x0B, 0xE0,
+  0x0F, 0x03, 0xE0, 0x03, 0x37, 0x41, 0x8B, 0xE2, 0x0B, 0x7F, 0x40, 0x17,
+  0xC0, 0x3F, 0x40, 0x0B, 0x44, 0x67, 0x40, 0x5B, 0xE1, 0x07, 0x9F, 0x40,
+  0x8B, 0x40, 0x7B, 0x40, 0x07, 0xC0, 0x2F, 0xE0, 0x0B, 0x07, 0x40, 0x23,
+  0x4A, 0x3F, 0xE0, 0x03, 0x7B, 0xC0, 0xA7, 0x40, 0x3B, 0x40, 0x17, 0x40,
+  0x23, 0xC0, 0x3B, 0x40, 0x13, 0xC0, 0x0F, 0x40, 0x77, 0x40, 0x0F, 0x40,
+  0x87, 0xE0, 0x03, 0xAB, 0xC0, 0x1F, 0xE0, 0x03, 0x33, 0x42, 0xEB, 0x40,
+  0x4B, 0xC0, 0x13, 0xE0, 0x07, 0x07, 0x40, 0x47, 0x44, 0x73, 0x40, 0x23,
+  0x40, 0x3F, 0x40, 0x0F, 0x40, 0x03, 0xC0, 0x27, 0xC0, 0x63, 0x40, 0x67,
+  0x40, 0x23, 0x40, 0x1B, 0x40, 0x03, 0xC0, 0x1F, 0xE0, 0x0B, 0x07, 0xC0,
+  0x1F, 0x40, 0x2F, 0x40, 0x1F, 0x40, 0x43, 0x40, 0x03, 0x40, 0xB7, 0x40,
+  0xE3, 0x40, 0x03, 0x40, 0x17, 0xE0, 0x03, 0x03, 0x40, 0x7B, 0xC0, 0x0F,
+  0x40, 0x3F, 0x40, 0x93, 0x41, 0x1F, 0x40, 0x0B, 0xC0, 0x17, 0xC0, 0x07,
+  0xE0, 0x03, 0x13, 0x40, 0x57, 0xC0, 0x17, 0xE0, 0x03, 0x07, 0xE0, 0x03,
+  0x23, 0xE0, 0x03, 0x17, 0xE0, 0x07, 0x0B, 0x40, 0x77, 0x40, 0x2B, 0x40,
+  0x9B, 0x40, 0x4B, 0x40, 0x03, 0xC0, 0x9F, 0x40, 0x17, 0x40, 0x2F, 0xC0,
+  0xC7, 0xE0, 0x07, 0x0B, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x27, 0x40, 0x23,
+  0xC0, 0x07, 0x40, 0x13, 0xE0, 0x0F, 0x03, 0x40, 0x23, 0x40, 0x03, 0x40,
+  0x77, 0xE0, 0x0F, 0x23, 0xC0, 0x17, 0x40, 0x27, 0x40, 0x57, 0xC0, 0x0F,
+  0xE0, 0x03, 0x07, 0x40, 0xA3, 0xC0, 0xB3, 0xC0, 0x17, 0x23, 0xF8, 0x40,
+  0x03, 0xE0, 0xD7, 0x00, 0x61, 0xA3, 0xC1, 0xA7, 0x40, 0x07, 0x43, 0x83,
+  0x41, 0x0F, 0xC1, 0x07, 0xC0, 0x07, 0xC1, 0x3B, 0x40, 0x23, 0xC1, 0x2B,
+  0xE0, 0x0B, 0x27, 0xC0, 0x2F, 0x40, 0x07, 0x40, 0x2B, 0xC0, 0x07, 0xC0,
+  0x2B, 0x40, 0x07, 0xC0, 0x3F, 0xC0, 0x1F, 0x41, 0x9B, 0x43, 0x5B, 0x40,
+  0x2B, 0x40, 0x1B, 0x40, 0x07, 0xC0, 0x6F, 0x40, 0x0B, 0x40, 0x03, 0x40,
+  0x0F, 0x40, 0x3B, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x37, 0x40,
+  0x07, 0x40, 0xB3, 0xC0, 0x4B, 0x40, 0x1B, 0x40, 0x17, 0x40, 0x07, 0x40,
+  0x13, 0x40, 0x1F, 0x42, 0x1F, 0xC0, 0x13, 0x40, 0x17, 0x40, 0x03, 0x40,
+  0x17, 0xC0, 0x1F, 0x40, 0x0F, 0xC0, 0x03, 0x40, 0x17, 0x40, 0x83, 0xC0,
+  0x53, 0x40, 0x23, 0xC0, 0x0B, 0xC0, 0x23, 0xE0, 0x0B, 0x07, 0xE0, 0x07,
+  0x5F, 0xE0, 0x07, 0x23, 0x40, 0x47, 0xC0, 0x03, 0xC0, 0x1B, 0x40, 0x33,
+  0x40, 0xD7, 0xC0, 0x0F, 0x40, 0x77, 0x40, 0x23, 0x40, 0x07, 0x40, 0x87,
+  0x40, 0x0B, 0x44, 0x2B, 0x40, 0x0F, 0x40, 0x83, 0x40, 0x27, 0xE0, 0x03,
+  0x2F, 0x40, 0x0F, 0xC0, 0xDB, 0x40, 0x2B, 0xC0, 0x03, 0x40, 0x17, 0x40,
+  0x0B, 0x40, 0x33, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x03, 0xE0, 0x03, 0x6F,
+  0xC0, 0x5F, 0x40, 0x17, 0x40, 0x2F, 0x40, 0x57, 0x40, 0x1F, 0x40, 0x4F,
+  0x40, 0x0F, 0xE0, 0x13, 0x03, 0x49, 0xB7, 0x40, 0x3F, 0x40, 0x33, 0x40,
+  0x03, 0x40, 0x37, 0xE0, 0x07, 0x2F, 0xE0, 0x03, 0x57, 0xE0, 0x07, 0x1B,
+  0xE0, 0x07, 0x0F, 0xC0, 0xA3, 0x40, 0x53, 0x40, 0xEB, 0x40, 0x07, 0xC0,
+  0x23, 0x40, 0x0B, 0x40, 0x13, 0x40, 0x03, 0xC0, 0x13, 0x40, 0x07, 0xC0,
+  0x5F, 0x40, 0x07, 0x46, 0x3F, 0x41, 0x27, 0x40, 0x0B, 0x40, 0x2F, 0x40,
+  0x8F, 0xE2, 0x03, 0x4F, 0x40, 0x13, 0x40, 0x33, 0xC0, 0x03, 0x40, 0x1F,
+  0x40, 0x13, 0x40, 0x07, 0x45, 0x1B, 0x40, 0x17, 0xC0, 0x83, 0x40, 0x0B,
+  0x40, 0x03, 0x23, 0xF8, 0x40, 0x03, 0xE0, 0xD7, 0x00, 0x40, 0xE3, 0xE0,
+  0xFF, 0xFF, 0xFF, 0x16, 0x03, 0xE0, 0xD7, 0x00, 0xE3, 0xFF, 0xFF, 0xFF,
+  0x16, 0xFB, 0x43, 0x1B, 0xE0, 0xD7, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0xAA,
+  0xE0, 0x08, 0x03, 0x02, 0xA7, 0xA7, 0xA7, 0x60, 0x03, 0xE0, 0x0B, 0x1B,
+  0xC0, 0x13, 0x02, 0xAB, 0xAB, 0xAB, 0xE0, 0x00, 0x0B, 0xE0, 0x07, 0x13,
+  0xC0, 0x1B, 0x02, 0xA8, 0xA8, 0xA8, 0x60, 0x47, 0x40, 0x07, 0x40, 0x03,
+  0xC0, 0x27, 0xE0, 0x03, 0x0B, 0x40, 0x13, 0xE0, 0x07, 0x0F, 0x40, 0x13,
+  0xC0, 0x03, 0xC0, 0x1B, 0x40, 0x07, 0x40, 0x03, 0xC0, 0x17, 0xE0, 0x13,
+  0x07, 0x02, 0xAC, 0xAC, 0xAC, 0xE0, 0x08, 0x1F, 0x40, 0xD3, 0x40, 0x3F,
+  0x40, 0x03, 0xE0, 0x07, 0x3B, 0x40, 0x1B, 0xE0, 0x03, 0x13, 0xE0, 0x0B,
+  0x3F, 0x40, 0x1F, 0x40, 0x17, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x33, 0x02,
+  0xA6, 0xA6, 0xA6, 0xE0, 0x00, 0x4F, 0x40, 0x0F, 0xE0, 0x07, 0x5B, 0xC0,
+  0x13, 0x40, 0x17, 0x40, 0x03, 0x40, 0x37, 0xC0, 0x07, 0x40, 0x0B, 0xE0,
+  0x13, 0x03, 0xC1, 0x43, 0xE0, 0x13, 0x23, 0xC0, 0x1B, 0x40, 0x53, 0x40,
+  0x03, 0xC0, 0x0F, 0x40, 0x07, 0xC0, 0x7B, 0x40, 0x0B, 0x40, 0x1B, 0xC0,
+  0x0F, 0x40, 0x0B, 0x40, 0xC3, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x1F, 0xE0,
+  0x03, 0x0B, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x7F, 0xC0, 0x33, 0x40, 0x0F,
+  0x40, 0x2B, 0x40, 0x0F, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x0F, 0x40, 0xFF,
+  0x40, 0x13, 0x40, 0x03, 0x02, 0xA4, 0xA4, 0xA4, 0x60, 0x13, 0x40, 0x1B,
+  0x40, 0x03, 0x40, 0x1F, 0x40, 0x07, 0xC0, 0x03, 0xE0, 0x03, 0x0F, 0x40,
+  0x5B, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x1F, 0x40, 0x07, 0xC0, 0x4B, 0x40,
+  0x0F, 0xE0, 0x03, 0x03, 0x40, 0x5B, 0xE0, 0x03, 0x0F, 0xE0, 0x03, 0x0B,
+  0x40, 0xB7, 0x40, 0x0F, 0x40, 0x4F, 0x40, 0x07, 0xE0, 0x0B, 0x03, 0xC0,
+  0x5B, 0xC0, 0x1B, 0x40, 0x67, 0x40, 0x13, 0xC0, 0x0F, 0xE0, 0x0B, 0x07,
+  0x02, 0x6F, 0x6F, 0x6F, 0x43, 0xFB, 0x40, 0x03, 0xE0, 0xD7, 0x00, 0x60,
+  0xFF, 0x40, 0xEF, 0xE0, 0x0B, 0x03, 0x02, 0x6E, 0x6E, 0x6E, 0x7F, 0xFF,
+  0xC0, 0x44, 0x02, 0x71, 0x71, 0x71, 0x60, 0x07, 0xE0, 0x0B, 0x23, 0x40,
+  0x1B, 0xE0, 0x03, 0x17, 0x02, 0x6C, 0x6C, 0x6C, 0x60, 0x03, 0x02, 0x69,
+  0x69, 0x69, 0x7F, 0xFF, 0x43, 0x98, 0x40, 0x43, 0x02, 0x6D, 0x6D, 0x6D,
+  0x60, 0x27, 0x40, 0x2B, 0x40, 0x1F, 0xE0, 0x03, 0x2F, 0x02, 0x73, 0x73,
+  0x73, 0xE0, 0x00, 0x17, 0x40, 0x2B, 0x40, 0x03, 0x02, 0x6B, 0x6B, 0x6B,
+  0x60, 0x07, 0xC0, 0x27, 0xC0, 0x13, 0xC0, 0x53, 0xC0, 0x17, 0x40, 0x07,
+  0x40, 0x5B, 0x40, 0x07, 0x40, 0x03, 0x02, 0x70, 0x70, 0x70, 0x60, 0x07,
+  0xC0, 0x2F, 0x02, 0x75, 0x75, 0x75, 0x60, 0x5B, 0x40, 0x1B, 0x40, 0x03,
+  0x40, 0x1F, 0x02, 0x74, 0x74, 0x74, 0x60, 0x07, 0x40, 0x0F, 0x40, 0x27,
+  0x40, 0x8F, 0x40, 0x97, 0x40, 0x1B, 0x40, 0x03, 0x40, 0x17, 0x40, 0x13,
+  0x40, 0x07, 0x40, 0x03, 0xE0, 0x03, 0x5F, 0xC0, 0x0B, 0x40, 0x07, 0x40,
+  0x8B, 0x40, 0x27, 0x40, 0x33, 0x40, 0x67, 0x40, 0x03, 0x40, 0x2F, 0x40,
+  0x13, 0x40, 0x1F, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x1F, 0x40, 0x0F, 0x02,
+  0x6A, 0x6A, 0x6A, 0xE0, 0x00, 0x13, 0x40, 0x17, 0x40, 0x73, 0x40, 0x07,
+  0x40, 0x03, 0x40, 0x0B, 0x40, 0x27, 0x40, 0xF7, 0x40, 0x2B, 0x40, 0x13,
+  0xE0, 0x0F, 0x03, 0xC0, 0x1F, 0x40, 0x2F, 0x41, 0x3B, 0x40, 0x57, 0x40,
+  0xC7, 0x40, 0x43, 0xE0, 0x03, 0x33, 0x40, 0x27, 0x40, 0x03, 0x40, 0x87,
+  0x40, 0x57, 0x40, 0x1B, 0xE0, 0x03, 0xFB, 0x40, 0x0F, 0x40, 0x17, 0x40,
+  0x3B, 0x40, 0x0B, 0x40, 0x3F, 0x40, 0x53, 0x40, 0x07, 0x40, 0x0F, 0xE0,
+  0x07, 0x03, 0x40, 0x1B, 0x40, 0x13, 0x40, 0x4F, 0x40, 0x57, 0x40, 0x03,
+  0x40, 0x0F, 0xC0, 0x53, 0x40, 0x1F, 0x02, 0x76, 0x76, 0x76, 0xE0, 0x04,
+  0x3F, 0x40, 0x9F, 0x40, 0x17, 0xC0, 0x53, 0xC0, 0x33, 0x40, 0x37, 0x40,
+  0x77, 0x40, 0x03, 0xC1, 0x37, 0x00, 0x6A, 0x21, 0x1F, 0x40, 0x17, 0xE0,
+  0x03, 0x03, 0x40, 0x3B, 0x40, 0x03, 0x40, 0x27, 0xC0, 0x17, 0x40, 0x53,
+  0xC0, 0x0B, 0xC0, 0x07, 0x40, 0x13, 0x40, 0x03, 0xC0, 0x0F, 0x40, 0x07,
+  0x40, 0x33, 0x40, 0x9B, 0x40, 0x5F, 0x40, 0x43, 0x40, 0x13, 0xE0, 0x03,
+  0x03, 0xC0, 0x13, 0x40, 0x07, 0x40, 0x03, 0x40, 0x27, 0x40, 0xDB, 0x05,
+  0x68, 0x68, 0x68, 0xFF, 0x52, 0x52, 0x7F, 0xFF, 0x67, 0x0C, 0xE3, 0xE0,
+  0xFF, 0x41, 0x2B, 0x42, 0x0B, 0xE1, 0x03, 0x1F, 0x41, 0xAB, 0xC1, 0xB7,
+  0xE0, 0x03, 0x17, 0x41, 0x2B, 0x41, 0x57, 0x40, 0x13, 0x40, 0x23, 0x43,
+  0x07, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x1B, 0xC1, 0x87, 0xE0, 0x0B, 0x3B,
+  0x40, 0x23, 0xE0, 0x03, 0x03, 0x40, 0x2F, 0xC0, 0x0F, 0x40, 0x83, 0x40,
+  0x03, 0x40, 0x87, 0x40, 0x53, 0x42, 0x0F, 0xC0, 0x43, 0x40, 0x5F, 0xE0,
+  0x03, 0x0F, 0xC0, 0x33, 0xE0, 0x03, 0x07, 0x40, 0x4B, 0x41, 0xC3, 0x40,
+  0x13, 0x40, 0x2F, 0xC0, 0x47, 0x40, 0x07, 0x40, 0x3B, 0x40, 0x07, 0x40,
+  0x5F, 0x40, 0x1F, 0x40, 0x03, 0x40, 0x23, 0x40, 0x67, 0xE0, 0x03, 0x13,
+  0x40, 0x17, 0x40, 0x03, 0x40, 0x4B, 0x40, 0xC7, 0x42, 0x0F, 0x40, 0x07,
+  0x40, 0x0F, 0x40, 0x17, 0x40, 0x8F, 0x40, 0x63, 0xE0, 0x03, 0x0F, 0x02,
+  0x78, 0x78, 0x78, 0x60, 0x1B, 0x40, 0x63, 0x40, 0x53, 0x40, 0x27, 0x40,
+  0x03, 0x40, 0x0B, 0x42, 0x4B, 0x40, 0x07, 0x40, 0x63, 0x40, 0x4B, 0x40,
+  0x07, 0x40, 0x1B, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x0F, 0xC0,
+  0x63, 0x40, 0x5F, 0x40, 0x0F, 0x40, 0x5F, 0x02, 0x77, 0x77, 0x77, 0x63,
+  0x4F, 0x40, 0x0B, 0x40, 0x43, 0xE0, 0x07, 0x5F, 0x40, 0x17, 0x40, 0x47,
+  0xC0, 0x33, 0x40, 0x23, 0x40, 0xE3, 0x40, 0x0F, 0x40, 0xA3, 0x40, 0x47,
+  0xE0, 0x17, 0x03, 0x40, 0x3F, 0x40, 0x83, 0x40, 0x07, 0x40, 0x4F, 0x41,
+  0xD7, 0x40, 0x07, 0xC0, 0x37, 0x40, 0x17, 0x40, 0x57, 0x40, 0x53, 0x40,
+  0x13, 0x40, 0x1B, 0x40, 0x5B, 0x40, 0x0F, 0x40, 0x17, 0x41, 0x3F, 0x40,
+  0x07, 0x40, 0x17, 0x40, 0x1F, 0x40, 0x03, 0x40, 0x0F, 0x40, 0xF7, 0x40,
+  0x57, 0x40, 0x0B, 0x40, 0x2B, 0x40, 0x33, 0x40, 0x23, 0x40, 0x0F, 0x40,
+  0xC7, 0x40, 0x1B, 0x40, 0x03, 0x40, 0x5F, 0xC0, 0x33, 0x40, 0x07, 0x40,
+  0x2B, 0x40, 0x07, 0x40, 0x03, 0x40, 0x2B, 0x40, 0x07, 0x40, 0x37, 0x41,
+  0x1F, 0x40, 0x0B, 0x40, 0xDF, 0xC0, 0x33, 0x40, 0x0F, 0xE0, 0x03, 0x2F,
+  0x40, 0x0F, 0x40, 0x2B, 0xE4, 0x07, 0x83, 0x40, 0x17, 0xE0, 0x0F, 0x03,
+  0xE0, 0x07, 0x3F, 0x40, 0x27, 0x40, 0x97, 0x02, 0x55, 0x55, 0x55, 0x43,
+  0xFB, 0x40, 0x03, 0xE0, 0xD7, 0x00, 0x69, 0x0B, 0x40, 0xF7, 0x41, 0x3B,
+  0x40, 0xFB, 0xC1, 0x5F, 0xE1, 0x0B, 0x1B, 0x41, 0x93, 0xC0, 0x23, 0x40,
+  0x07, 0x02, 0x65, 0x65, 0x65, 0x60, 0x07, 0x40, 0x3F, 0x40, 0x1B, 0x41,
+  0xDB, 0x40, 0x07, 0x40, 0x03, 0x02, 0x66, 0x66, 0x66, 0x62, 0x1F, 0x40,
+  0x4F, 0x40, 0x5B, 0x41, 0xC3, 0x40, 0x07, 0x40, 0x2B, 0xE0, 0x07, 0x03,
+  0x40, 0x23, 0x40, 0x33, 0xE2, 0x07, 0x7F, 0xC0, 0x27, 0xC0, 0x8B, 0xE1,
+  0x07, 0xFF, 0x40, 0x33, 0x40, 0x87, 0x42, 0x6F, 0x40, 0x0B, 0x40, 0x2F,
+  0x40, 0x07, 0x42, 0x97, 0x40, 0x17, 0x40, 0x0F, 0x40, 0x5B, 0xC0, 0x07,
+  0x40, 0x13, 0xC0, 0x0F, 0x40, 0x13, 0xC0, 0x03, 0x40, 0x33, 0x40, 0xBB,
+  0x40, 0x1B, 0x40, 0xA3, 0x40, 0x0F, 0x40, 0x2B, 0xC0, 0x1F, 0x40, 0x97,
+  0x42, 0xC3, 0x40, 0x03, 0x40, 0x13, 0x40, 0x2B, 0x40, 0x23, 0x40, 0x0B,
+  0x40, 0x9B, 0x40, 0x1F, 0x40, 0x0B, 0x40, 0x33, 0x40, 0x43, 0x40, 0x03,
+  0x40, 0xAB, 0x40, 0x87, 0xC0, 0x27, 0x40, 0x1F, 0x40, 0x17, 0x40, 0x07,
+  0xC0, 0x03, 0x40, 0x0F, 0x40, 0x27, 0x40, 0x07, 0xC0, 0x13, 0xE0, 0x03,
+  0x07, 0xC0, 0x4F, 0xE0, 0x03, 0x13, 0x40, 0x9F, 0x40, 0x6F, 0x40, 0x07,
+  0x40, 0x03, 0x40, 0x0B, 0x40, 0x83, 0xE1, 0x07, 0x5F, 0xC0, 0x77, 0x40,
+  0x1B, 0x40, 0x47, 0x40, 0x0F, 0x40, 0x07, 0xE0, 0x0F, 0x6B, 0xE0, 0x03,
+  0x63, 0x40, 0x4B, 0x40, 0x2F, 0x40, 0x03, 0x40, 0xEB, 0x40, 0x1B, 0x40,
+  0x47, 0x40, 0x07, 0xE0, 0x07, 0x03, 0x40, 0x17, 0x40, 0x83, 0x40, 0x8B,
+  0xC0, 0x1B, 0x40, 0x37, 0xC0, 0x0B, 0x40, 0x17, 0x40, 0x1F, 0x40, 0x27,
+  0x40, 0x7B, 0x40, 0x4F, 0xE0, 0x03, 0x1F, 0xC0, 0x27, 0x40, 0x13, 0xC2,
+  0x33, 0x40, 0x0B, 0x40, 0x17, 0x40, 0x87, 0x40, 0x07, 0xE0, 0x07, 0xB7,
+  0x40, 0x4B, 0x40, 0x17, 0x40, 0x03, 0x40, 0x5F, 0x41, 0x97, 0x40, 0x5B,
+  0xC0, 0x37, 0x40, 0x13, 0x40, 0x23, 0xC1, 0x5B, 0x40, 0x1B, 0x40, 0x0F,
+  0x40, 0x4F, 0x40, 0x07, 0xC0, 0x4F, 0x45, 0xBB, 0x40, 0x0F, 0x40, 0x03,
+  0x40, 0x43, 0x40, 0x3F, 0x41, 0xB3, 0x02, 0x54, 0x54, 0x54, 0x43, 0xFB,
+  0x40, 0x03, 0xE0, 0xD7, 0x00, 0xEB, 0x00, 0xFF, 0xE1, 0x03, 0x33, 0x41,
+  0x57, 0x41, 0x13, 0x40, 0x07, 0x41, 0x13, 0x41, 0xB3, 0x41, 0x43, 0x40,
+  0x0F, 0xC0, 0x03, 0xC1, 0x4B, 0xC0, 0x37, 0xC0, 0x17, 0xE0, 0x07, 0x07,
+  0x40, 0x3F, 0x40, 0x13, 0x40, 0x4F, 0x41, 0x77, 0x40, 0x03, 0x40, 0x4F,
+  0xC0, 0x03, 0x40, 0x3F, 0x41, 0x7B, 0x40, 0x1F, 0x45, 0xBB, 0x40, 0x0F,
+  0x40, 0x2F, 0x40, 0x03, 0x40, 0x73, 0x40, 0x2F, 0x40, 0x0B, 0x40, 0x03,
+  0xC0, 0x4B, 0x40, 0x07, 0xC3, 0xF3, 0x40, 0x0B, 0x41, 0xB3, 0xC1, 0xEB,
+  0x40, 0x2F, 0x40, 0x1B, 0x40, 0x07, 0x40, 0x33, 0x40, 0x57, 0x40, 0x07,
+  0xE0, 0x03, 0x03, 0x40, 0x63, 0x42, 0x93, 0x40, 0x13, 0x40, 0x3F, 0xC0,
+  0x2B, 0x40, 0x0F, 0x40, 0x73, 0x40, 0x13, 0x40, 0xDF, 0x40, 0x27, 0x40,
+  0x07, 0x02, 0x7B, 0x7B, 0x7B, 0x60, 0x07, 0x40, 0x1F, 0x40, 0x03, 0x40,
+  0x1F, 0x40, 0x07, 0x40, 0x1F, 0x40, 0x07, 0xC0, 0x03, 0x40, 0x3B, 0x40,
+  0x87, 0x40, 0x4F, 0x40, 0x0B, 0xC0, 0x17, 0x40, 0x07, 0x40, 0x17, 0xE0,
+  0x07, 0x13, 0x40, 0x17, 0x40, 0x13, 0xC1, 0x0B, 0xC0, 0x57, 0x40, 0x17,
+  0x40, 0x43, 0xC0, 0xA3, 0x40, 0x23, 0x40, 0x13, 0x40, 0x8B, 0x40, 0xCF,
+  0xC1, 0x2F, 0x40, 0x17, 0x40, 0xFB, 0x40, 0x03, 0x40, 0x2F, 0x40, 0x23,
+  0xE0, 0x03, 0x03, 0x40, 0x1F, 0x40, 0x77, 0xC0, 0x1B, 0x40, 0xAF, 0xC0,
+  0x43, 0xE0, 0x03, 0x27, 0xC0, 0x77, 0x40, 0x07, 0x40, 0x4B, 0x40, 0x07,
+  0x40, 0x3B, 0xC0, 0x23, 0x40, 0x33, 0x40, 0x0B, 0x40, 0x13, 0x40, 0x03,
+  0xC0, 0x4F, 0x40, 0x13, 0xC0, 0x03, 0x40, 0x33, 0xE1, 0x03, 0x77, 0xC0,
+  0x17, 0x40, 0x07, 0x40, 0x1B, 0x40, 0x07, 0x40, 0x47, 0x40, 0x83, 0x40,
+  0x0B, 0xC0, 0x03, 0x40, 0x0F, 0x40, 0x1F, 0x40, 0x57, 0xC0, 0x13, 0xE0,
+  0x0F, 0x07, 0x40, 0x23, 0x40, 0x2F, 0x40, 0x1F, 0xC0, 0xD7, 0x40, 0xAF,
+  0x40, 0x8F, 0x40, 0x1B, 0x40, 0x47, 0x40, 0x03, 0x40, 0x1B, 0x40, 0x07,
+  0x40, 0x17, 0xC0, 0x07, 0x40, 0x1F, 0x40, 0x37, 0xC0, 0x03, 0x40, 0x23,
+  0xC0, 0x13, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x2B, 0x40, 0x0B, 0x01, 0x59,
+  0x59, 0x7F, 0xFF, 0x5B, 0x0C, 0xE3, 0xDC, 0xFF, 0x51, 0x0F, 0x40, 0xF3,
+  0xC1, 0x17, 0xC0, 0x07, 0x42, 0x67, 0x40, 0x0B, 0x41, 0x17, 0xE0, 0x0B,
+  0x1F, 0x40, 0x13, 0x40, 0x1B, 0x40, 0x23, 0xE0, 0x03, 0x03, 0x40, 0x17,
+  0x41, 0x47, 0xC0, 0x3F, 0x40, 0x1B, 0x41, 0x87, 0x42, 0x1B, 0xC0, 0x2F,
+  0x40, 0x1B, 0x40, 0x03, 0x40, 0x1B, 0x40, 0x03, 0x41, 0xD3, 0x40, 0x03,
+  0x42, 0xEF, 0x40, 0x07, 0x40, 0x1B, 0x40, 0x0B, 0x40, 0x1B, 0x40, 0x33,
+  0x40, 0x53, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0x40, 0x23, 0x40, 0x2B, 0x40,
+  0x03, 0x40, 0x6F, 0x40, 0x1B, 0xC0, 0x33, 0x40, 0x0B, 0x40, 0x1F, 0x40,
+  0x3B, 0x40, 0x03, 0xC0, 0x1F, 0x40, 0x17, 0x40, 0x03, 0x40, 0x4F, 0x43,
+  0x73, 0x48, 0xBF, 0xE0, 0x07, 0x1B, 0x40, 0x4F, 0x40, 0x23, 0x40, 0x17,
+  0x40, 0x0B, 0x40, 0x53, 0x40, 0x07, 0x40, 0x13, 0x40, 0x07, 0x40, 0x0F,
+  0x40, 0x0B, 0x40, 0xD3, 0x40, 0x07, 0x40, 0x4B, 0x40, 0x07, 0x40, 0x03,
+  0x40, 0x1F, 0xC3, 0x9B, 0x40, 0x3F, 0x40, 0x03, 0x40, 0x27, 0xE0, 0x03,
+  0x23, 0x40, 0x27, 0x40, 0x03, 0x40, 0x1B, 0x40, 0x07, 0x40, 0x03, 0x40,
+  0x23, 0x42, 0xC7, 0xC0, 0x13, 0xC0, 0x47, 0x40, 0x07, 0x40, 0x1F, 0x40,
+  0x03, 0x40, 0x23, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x4F, 0x40, 0xD7, 0x40,
+  0x0F, 0x40, 0x0B, 0x40, 0x13, 0x40, 0x03, 0x40, 0x3F, 0x40, 0x0F, 0x40,
+  0x07, 0x40, 0x1B, 0x40, 0x13, 0xE0, 0x17, 0x03, 0x40, 0x63, 0x43, 0x97,
+  0x40, 0x27, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x43, 0x41, 0x23,
+  0x40, 0x4F, 0x40, 0x13, 0x45, 0x9B, 0x40, 0xDB, 0x40, 0xFF, 0x40, 0x0F,
+  0x40, 0x1F, 0x40, 0x83, 0xC0, 0x2B, 0x40, 0x07, 0xC0, 0x03, 0x40, 0x37,
+  0xC0, 0x0B, 0x40, 0x27, 0x40, 0xDB, 0x40, 0x2B, 0x40, 0x4B, 0x40, 0x97,
+  0x02, 0x64, 0x64, 0x64, 0x60, 0x23, 0x40, 0x1B, 0x40, 0x2B, 0x40, 0x07,
+  0x40, 0x1B, 0x40, 0x23, 0xC0, 0x0F, 0xC0, 0x3F, 0x40, 0x07, 0x40, 0x1B,
+  0x40, 0x07, 0xE0, 0x03, 0x03, 0x40, 0x33, 0x40, 0x2B, 0x40, 0x33, 0x42,
+  0x5B, 0x40, 0x0F, 0xC0, 0x1F, 0xC0, 0x0B, 0x40, 0xA7, 0x40, 0xDB, 0x40,
+  0x23, 0xC0, 0x13, 0x40, 0x23, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x97, 0xC0,
+  0x5B, 0x40, 0x0F, 0x40, 0x0B, 0x40, 0x07, 0x02, 0x56, 0x56, 0x56, 0x43,
+  0xFB, 0x40, 0x03, 0xE0, 0xD7, 0x00, 0x67, 0xFF, 0x40, 0xF7, 0x41, 0x97,
+  0x41, 0x1B, 0x43, 0x37, 0x41, 0x33, 0x40, 0x03, 0x41, 0x3F, 0x40, 0x03,
+  0x41, 0xF7, 0x40, 0x1B, 0x40, 0x23, 0x40, 0x2B, 0x40, 0x0B, 0xE0, 0x0F,
+  0x03, 0x40, 0x3F, 0xC0, 0x1B, 0x41, 0x4B, 0xE1, 0x07, 0x9B, 0x40, 0x4F,
+  0x40, 0x17, 0xC0, 0x23, 0x40, 0x53, 0x43, 0x87, 0x41, 0xA3, 0x41, 0xCF,
+  0xE0, 0x03, 0x1B, 0x40, 0x2B, 0x40, 0x7B, 0x40, 0x07, 0xC0, 0x2F, 0xE0,
+  0x07, 0x07, 0x40, 0x1B, 0x40, 0x23, 0x02, 0x79, 0x79, 0x79, 0x60, 0xB3,
+  0xC0, 0x1F, 0xC0, 0xA7, 0x40, 0x8F, 0x40, 0xCB, 0xC2, 0xB7, 0x40, 0x1F,
+  0x40, 0x33, 0x40, 0x0F, 0x40, 0x0B, 0x40, 0x7F, 0x40, 0x23, 0x40, 0x77,
+  0x4A, 0x7F, 0x40, 0x0F, 0xC0, 0x1F, 0x40, 0x07, 0x40, 0x23, 0x40, 0x03,
+  0x40, 0x0B, 0x43, 0x03, 0x40, 0x4B, 0x40, 0x0F, 0xE0, 0x0B, 0x03, 0x40,
+  0x23, 0x40, 0x8B, 0x40, 0x4F, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x03, 0xC0,
+  0x2B, 0x40, 0x63, 0x41, 0x0F, 0x40, 0x03, 0x40, 0x23, 0xC0, 0x03, 0xC0,
+  0x1F, 0xE0, 0x0B, 0x07, 0x40, 0x23, 0x40, 0x43, 0xC0, 0x77, 0x40, 0x43,
+  0x40, 0x03, 0x41, 0x2F, 0x40, 0xE3, 0x40, 0x03, 0xE0, 0x03, 0x37, 0x40,
+  0x2B, 0x40, 0xDB, 0x40, 0x07, 0x40, 0x17, 0x40, 0x3F, 0x40, 0x8B, 0x48,
+  0xC3, 0x40, 0x0B, 0x40, 0x13, 0xE0, 0x03, 0x03, 0xE0, 0x03, 0x13, 0x40,
+  0x57, 0xE0, 0x03, 0x1B, 0xC0, 0x0B, 0xE0, 0x03, 0x23, 0xC0, 0x13, 0xE0,
+  0x07, 0x07, 0x40, 0x6F, 0x40, 0x77, 0x40, 0x2B, 0x41, 0x43, 0x40, 0x4B,
+  0x40, 0x07, 0xC0, 0x9F, 0x40, 0x17, 0x40, 0x33, 0xC0, 0x07, 0x40, 0x0B,
+  0x40, 0xD3, 0x40, 0x37, 0x40, 0x0B, 0xC0, 0x03, 0x40, 0x0F, 0xC0, 0x17,
+  0x40, 0x07, 0xC0, 0x17, 0x40, 0x07, 0x40, 0x1B, 0x40, 0x03, 0x40, 0x0B,
+  0x40, 0x03, 0x40, 0x0B, 0x40, 0x4F, 0x40, 0x77, 0x40, 0x0B, 0x40, 0x13,
+  0xE0, 0x0F, 0x03, 0x40, 0x1F, 0xE0, 0x07, 0x4F, 0xC0, 0x2B, 0x40, 0xA3,
+  0x41, 0x4F, 0x40, 0xB3, 0x40, 0x13, 0xE3, 0xE7, 0xFF, 0xC1, 0xA7, 0x40,
+  0xFF, 0xE5, 0x03, 0x13, 0x41, 0x0B, 0x40, 0x03, 0xE1, 0x03, 0x3B, 0x40,
+  0x23, 0x40, 0x2F, 0x40, 0x03, 0x41, 0x37, 0x40, 0x1F, 0xE0, 0x0F, 0x03,
+  0x40, 0x2B, 0x40, 0x1B, 0xE0, 0x03, 0x2B, 0x40, 0x33, 0xC1, 0x6B, 0xC0,
+  0x1F, 0x41, 0xC3, 0x43, 0x5B, 0x40, 0x67, 0x40, 0x2B, 0x40, 0x33, 0x40,
+  0x13, 0x40, 0x07, 0x40, 0x03, 0x40, 0x17, 0x41, 0xBB, 0x40, 0x3B, 0x40,
+  0x0F, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x23, 0x40, 0x07, 0xE4, 0x07, 0x37,
+  0x40, 0x17, 0x40, 0x23, 0x40, 0x5F, 0x40, 0x1F, 0x42, 0xFF, 0x40, 0x43,
+  0x40, 0x13, 0xC0, 0x03, 0x40, 0x17, 0x40, 0x6B, 0x40, 0x07, 0xC0, 0x13,
+  0x40, 0x07, 0x40, 0x0F, 0x40, 0x9F, 0x41, 0x07, 0x40, 0x3F, 0x40, 0x03,
+  0xE0, 0x07, 0x5F, 0x40, 0x27, 0xE0, 0x07, 0x03, 0xC0, 0x73, 0xE0, 0x07,
+  0x17, 0xC0, 0x0F, 0x40, 0x6B, 0x40, 0x03, 0x40, 0x4F, 0xC0, 0x13, 0x40,
+  0x33, 0x40, 0x03, 0xC0, 0x9B, 0x40, 0x1F, 0xC0, 0x03, 0x40, 0x87, 0x40,
+  0x0B, 0x44, 0x93, 0xC0, 0x8F, 0x40, 0x37, 0x41, 0x07, 0xC0, 0x2F, 0x40,
+  0x07, 0x42, 0xFB, 0x40, 0x43, 0x40, 0x2B, 0x40, 0x5B, 0x40, 0x03, 0x40,
+  0x27, 0x40, 0x07, 0x40, 0xC3, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x03, 0x40,
+  0x27, 0x40, 0x03, 0x40, 0x1F, 0x40, 0x5F, 0x40, 0x13, 0x40, 0x03, 0x40,
+  0x0F, 0x40, 0x57, 0x40, 0x1B, 0x40, 0x4F, 0x40, 0x57, 0x40, 0x13, 0xE0,
+  0x0F, 0x03, 0x40, 0x53, 0x40, 0x3F, 0xC0, 0x33, 0xE0, 0x0B, 0x2F, 0xE0,
+  0x03, 0x57, 0xE0, 0x0B, 0x1F, 0xE0, 0x03, 0x5B, 0xC1, 0x5F, 0x40, 0x53,
+  0x40, 0xC7, 0x40, 0x07, 0xC0, 0x1F, 0x40, 0x0B, 0x40, 0x13, 0x40, 0x03,
+  0xC0, 0x13, 0x40, 0x07, 0xC0, 0x5F, 0x40, 0x17, 0x46, 0x3F, 0x45, 0x53,
+  0x40, 0x13, 0x40, 0x2F, 0x40, 0x6F, 0x55, 0x3F, 0x40, 0x07, 0x40, 0x1F,
+  0x40, 0x13, 0x40, 0x33, 0xC0, 0x03, 0x40, 0xE7, 0x40, 0x13, 0x40, 0x07,
+  0x42, 0x1B, 0x40, 0x17, 0xC0, 0x83, 0x40, 0x0B, 0xE3, 0xE3, 0xFF, 0x5D,
+  0x3B, 0x40, 0xF3, 0xC0, 0x03, 0x41, 0x17, 0x41, 0x37, 0xC0, 0x0F, 0xE0,
+  0x03, 0x07, 0x40, 0x17, 0xE2, 0x0B, 0x1F, 0x40, 0x33, 0x41, 0x67, 0x40,
+  0x2B, 0x40, 0x23, 0x40, 0x07, 0x41, 0x8B, 0x42, 0x27, 0x40, 0x17, 0x41,
+  0x67, 0x40, 0x03, 0x41, 0x6B, 0x40, 0x3F, 0x40, 0x1F, 0x40, 0x03, 0x40,
+  0x0B, 0x40, 0x13, 0x40, 0x1B, 0xC0, 0x03, 0x40, 0x0F, 0xF1, 0x03, 0x97,
+  0x42, 0xFB, 0x40, 0x4B, 0x40, 0x47, 0x40, 0x03, 0x40, 0x27, 0x40, 0x63,
+  0x42, 0x7B, 0x46, 0xD3, 0x40, 0x2B, 0x40, 0x33, 0x40, 0x13, 0x40, 0x1F,
+  0x40, 0x03, 0x40, 0x5B, 0x40, 0x93, 0x40, 0x5F, 0x40, 0x17, 0x40, 0x33,
+  0x40, 0x0B, 0x40, 0x17, 0xC0, 0x03, 0x40, 0x1F, 0x40, 0x2B, 0x40, 0x5B,
+  0x40, 0x63, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x2F, 0x40, 0x23, 0x40, 0x33,
+  0xC0, 0x0B, 0x40, 0x0F, 0xC0, 0x03, 0x40, 0x2F, 0xC0, 0x0B, 0xE0, 0x0F,
+  0x07, 0x40, 0x5B, 0x40, 0x53, 0x40, 0x03, 0xE0, 0x07, 0x23, 0x40, 0x3F,
+  0x42, 0xAB, 0x40, 0x6B, 0xC0, 0x1B, 0x40, 0xCB, 0xC0, 0x0B, 0xE0, 0x0B,
+  0x07, 0x40, 0x2B, 0xC1, 0x4B, 0x40, 0x0B, 0x40, 0x23, 0xC0, 0x07, 0x40,
+  0xA7, 0xC0, 0xFF, 0x40, 0x17, 0x40, 0x03, 0xC0, 0x63, 0x40, 0x0B, 0xE0,
+  0x07, 0x1B, 0x40, 0x2F, 0x49, 0x2B, 0x40, 0x07, 0x40, 0x1F, 0x40, 0xE3,
+  0x41, 0x1B, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x3B, 0x40, 0x5B, 0x40, 0x03,
+  0xC0, 0x13, 0x40, 0x17, 0x40, 0x2F, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x0F,
+  0x40, 0x03, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0x40,
+  0xFF, 0x40, 0x3F, 0x40, 0x07, 0x40, 0x17, 0x40, 0x23, 0xC0, 0x63, 0x40,
+  0x5F, 0xC1, 0x17, 0x40, 0x17, 0x40, 0x9F, 0xC0, 0x03, 0x41, 0x07, 0x40,
+  0x67, 0x43, 0xBB, 0x40, 0x07, 0x40, 0x3B, 0xE0, 0x0B, 0x03, 0x40, 0x57,
+  0xE0, 0x03, 0x5F, 0x40, 0x23, 0x40, 0x13, 0x40, 0x4F, 0x40, 0x0B, 0x40,
+  0x03, 0x40, 0x67, 0xC0, 0x07, 0xE3, 0x03, 0xDB, 0x40, 0x23, 0xC6, 0x6B,
+  0x40, 0x1F, 0xE0, 0x07, 0x03, 0x41, 0x67, 0x02, 0x4F, 0x4F, 0x4F, 0x4B,
+  0xFB, 0x40, 0x03, 0xE0, 0xD7, 0x00, 0xEB, 0x00, 0xFF, 0x41, 0x17, 0xC1,
+  0x77, 0x41, 0x87, 0xE1, 0x07, 0x23, 0xC1, 0x4F, 0x41, 0x97, 0x40, 0x2B,
+  0x40, 0x23, 0x40, 0x13, 0x40, 0x0F, 0xE0, 0x07, 0x2B, 0xC1, 0x53, 0x40,
+  0x1F, 0x41, 0xEB, 0x40, 0x23, 0xC0, 0x13, 0x41, 0xA7, 0xC0, 0x0B, 0x40,
+  0x1F, 0xC0, 0x0B, 0x40, 0x07, 0x40, 0x57, 0x40, 0x07, 0x40, 0x03, 0xE0,
+  0x07, 0x1B, 0x40, 0x13, 0x40, 0x47, 0x40, 0x3F, 0xC0, 0x53, 0xC0, 0x2F,
+  0x40, 0x07, 0x42, 0x43, 0x40, 0x07, 0x40, 0x27, 0x40, 0x03, 0x40, 0x0B,
+  0x40, 0x97, 0x40, 0x0B, 0x43, 0x6F, 0xE0, 0x0B, 0x4F, 0x40, 0x1B, 0xE0,
+  0x03, 0x17, 0xC0, 0x33, 0x40, 0x07, 0x40, 0x1B, 0xC0, 0x03, 0x40, 0x23,
+  0x40, 0x77, 0x40, 0x07, 0x40, 0x1B, 0x40, 0x57, 0x40, 0x6F, 0x44, 0x7B,
+  0x44, 0x83, 0x40, 0x0B, 0xC0, 0x2B, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x13,
+  0xE0, 0x0F, 0x07, 0x40, 0x53, 0x40, 0xCB, 0x40, 0x1F, 0x40, 0x43, 0xC0,
+  0x33, 0x40, 0x07, 0x40, 0x0F, 0x40, 0xEF, 0x40, 0x1B, 0x40, 0x77, 0x40,
+  0x07, 0x40, 0x2F, 0x42, 0xF7, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x0F, 0x40,
+  0x17, 0x40, 0x03, 0x41, 0x8F, 0x40, 0x0F, 0x42, 0xBF, 0x40, 0x07, 0xC0,
+  0x3B, 0x40, 0x0B, 0x40, 0x33, 0x40, 0x07, 0x40, 0x27, 0x40, 0x57, 0x40,
+  0x2B, 0x40, 0x0B, 0x40, 0x43, 0x40, 0x1B, 0x40, 0x2B, 0xC0, 0x1F, 0x40,
+  0x17, 0x40, 0x03, 0xE0, 0x03, 0x0F, 0x40, 0x8F, 0x40, 0x27, 0x40, 0x3B,
+  0x40, 0x0B, 0x40, 0x1F, 0x40, 0x33, 0x40, 0x07, 0x40, 0x03, 0xE0, 0x03,
+  0x0B, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x3F, 0x40, 0x5F, 0xE0, 0x03, 0x1B,
+  0x40, 0x43, 0x47, 0xAB, 0x40, 0x07, 0x40, 0x1B, 0xC1, 0x97, 0xC0, 0x23,
+  0x40, 0x5B, 0x40, 0x9B, 0xC0, 0x1F, 0x40, 0x07, 0x40, 0x4B, 0xC0, 0x1F,
+  0x40, 0x33, 0x40, 0x0F, 0xE0, 0x03, 0x03, 0xC0, 0x13, 0x40, 0x2B, 0xC0,
+  0x5B, 0x40, 0x7B, 0x40, 0x0F, 0x40, 0x07, 0xE0, 0x03, 0x2B, 0xE0, 0x07,
+  0x0B, 0x40, 0x6B, 0xC0, 0x13, 0x40, 0x47, 0x40, 0x03, 0x40, 0x37, 0xE7,
+  0xE3, 0xFF, 0x01, 0xAA, 0xAA, 0xFF, 0x09, 0xFF, 0x04, 0x00, 0x41, 0x87,
+  0x41, 0x17, 0x41, 0x0B, 0x40, 0x03, 0xC1, 0x47, 0x41, 0x1F, 0x4A, 0x8F,
+  0x40, 0x13, 0x40, 0x1F, 0x40, 0x03, 0x40, 0x13, 0x42, 0x73, 0x40, 0x13,
+  0x41, 0xA7, 0x40, 0x03, 0x40, 0x17, 0x40, 0x03, 0xC0, 0x0B, 0xC0, 0x3F,
+  0x40, 0x57, 0x43, 0x3B, 0xE6, 0x07, 0x7F, 0x41, 0x87, 0x40, 0x1B, 0x40,
+  0x07, 0x40, 0x37, 0xE0, 0x0F, 0x03, 0x40, 0x6B, 0x40, 0x1B, 0xC0, 0x57,
+  0x40, 0x0B, 0xE0, 0x1B, 0x03, 0xE0, 0x0B, 0x2F, 0xC0, 0x13, 0xE0, 0x07,
+  0x53, 0xC0, 0x87, 0x40, 0x07, 0x40, 0x5B, 0xC0, 0x07, 0x40, 0x0B, 0x40,
+  0x03, 0xC0, 0x0F, 0x40, 0xD3, 0x43, 0xBB, 0x46, 0x5B, 0x40, 0x0B, 0x40,
+  0x1B, 0x40, 0x4B, 0x40, 0x13, 0x40, 0x0B, 0x40, 0xCB, 0x40, 0x63, 0x43,
+  0x33, 0x41, 0x1B, 0x40, 0x1B, 0x40, 0x17, 0x40, 0x03, 0x40, 0x17, 0x47,
+  0x0F, 0x40, 0x07, 0x40, 0x0F, 0xE0, 0x13, 0x03, 0x40, 0x37, 0xC0, 0x5F,
+  0x40, 0x4B, 0x40, 0x33, 0x40, 0x03, 0x40, 0x53, 0x40, 0x03, 0x40, 0x47,
+  0xC0, 0x93, 0x40, 0x47, 0x40, 0x2F, 0x41, 0x8F, 0x40, 0x07, 0x40, 0x03,
+  0x40, 0x3B, 0x40, 0x93, 0x40, 0x13, 0x40, 0x0B, 0x40, 0x2B, 0x40, 0x0F,
+  0x40, 0x2B, 0x40, 0x3F, 0x40, 0x0B, 0x40, 0x17, 0x40, 0x0F, 0x40, 0x2F,
+  0x40, 0x07, 0xE0, 0x0F, 0x03, 0x40, 0x77, 0xC0, 0x1B, 0x40, 0x0B, 0x40,
+  0x53, 0x40, 0x43, 0xC0, 0x13, 0xC0, 0x07, 0x40, 0x4F, 0x40, 0x17, 0x40,
+  0x07, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x1B, 0xC0, 0x33, 0x40, 0xC7, 0xC0,
+  0x6B, 0x40, 0x13, 0xC0, 0x1F, 0x40, 0x23, 0x40, 0x03, 0xC0, 0x1B, 0x40,
+  0x0B, 0x40, 0x03, 0x40, 0x23, 0x40, 0xB7, 0x40, 0x07, 0x40, 0x03, 0x40,
+  0x3F, 0x40, 0x0F, 0x40, 0x27, 0x40, 0xBF, 0xE0, 0x03, 0x3F, 0x40, 0x0B,
+  0x40, 0x03, 0x40, 0x1B, 0x40, 0x3B, 0xC0, 0x07, 0xC0, 0x87, 0x40, 0x07,
+  0x40, 0x03, 0x40, 0x17, 0x41, 0xA3, 0x40, 0x47, 0x40, 0x27, 0x40, 0x03,
+  0x40, 0x0B, 0x41, 0x4F, 0x01, 0x58, 0x58, 0x7F, 0xFF, 0x8F, 0x0C, 0xE7,
+  0xE0, 0xFF, 0x40, 0xFB, 0xC0, 0x03, 0x41, 0x5F, 0x41, 0x07, 0x40, 0x03,
+  0x40, 0x13, 0x41, 0x27, 0x41, 0xE7, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x03,
+  0x45, 0x67, 0x45, 0xBB, 0x40, 0x1F, 0xE1, 0x03, 0x8B, 0x40, 0x3B, 0x40,
+  0x13, 0xE0, 0x03, 0x03, 0x01, 0x6A, 0x6A, 0x93, 0xD3, 0x40, 0x37, 0x40,
+  0x17, 0x40, 0x57, 0x41, 0x63, 0x40, 0x07, 0x41, 0x87, 0x41, 0xBF, 0x40,
+  0x1B, 0x40, 0x03, 0x40, 0x1F, 0xE0, 0x23, 0x03, 0x40, 0x43, 0x40, 0x03,
+  0xC0, 0x77, 0xC0, 0x57, 0xE0, 0x0B, 0x43, 0x40, 0x23, 0x44, 0x77, 0x41,
+  0xF3, 0xC0, 0x27, 0xC0, 0x3B, 0x40, 0x1B, 0xE0, 0x03, 0x33, 0xC0, 0x0F,
+  0x40, 0x2B, 0x40, 0x23, 0x40, 0x03, 0x40, 0x1F, 0x42, 0x57, 0x40, 0xB3,
+  0x40, 0x0B, 0x40, 0x13, 0x40, 0xFB, 0x40, 0x23, 0xC0, 0x2F, 0x40, 0xC3,
+  0x40, 0x0B, 0x40, 0x1B, 0x40, 0x23, 0x40, 0x2F, 0xE0, 0x03, 0x07, 0x40,
+  0x17, 0x40, 0x2F, 0xE0, 0x03, 0x13, 0xC0, 0x0B, 0x45, 0x57, 0x40, 0x5B,
+  0x40, 0x3F, 0x41, 0x6B, 0x40, 0x03, 0xC1, 0x3B, 0x40, 0x23, 0x40, 0x17,
+  0x40, 0x07, 0x40, 0x03, 0x40, 0x43, 0x40, 0x2B, 0x41, 0x3B, 0x40, 0x07,
+  0x40, 0x13, 0x40, 0x7B, 0xC0, 0x6F, 0xE0, 0x03, 0x2B, 0x40, 0x1B, 0x40,
+  0x03, 0x40, 0x33, 0x40, 0x7F, 0x40, 0x0B, 0x40, 0x03, 0xE0, 0x03, 0x23,
+  0x40, 0x3B, 0x40, 0x0F, 0x40, 0x1F, 0x40, 0x03, 0x40, 0x47, 0xC0, 0x57,
+  0x40, 0x2B, 0xC0, 0x0B, 0x40, 0x17, 0x40, 0x2B, 0x40, 0x13, 0xC0, 0x03,
+  0x40, 0x0F, 0x40, 0xA7, 0xC0, 0x3F, 0x41, 0x5B, 0x45, 0xE3, 0x40, 0x07,
+  0x40, 0x23, 0x40, 0x33, 0x42, 0x2F, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x03,
+  0x40, 0x33, 0x40, 0x07, 0x40, 0x33, 0x41, 0x93, 0x40, 0x2B, 0x40, 0x77,
+  0x41, 0x4F, 0x40, 0x03, 0x40, 0xAB, 0xC0, 0x1F, 0x40, 0x07, 0x40, 0x03,
+  0x40, 0x83, 0x40, 0x43, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x43, 0x40, 0x77,
+  0xC0, 0x0F, 0x40, 0x3F, 0x40, 0x17, 0xE0, 0x07, 0x03, 0x40, 0x1F, 0x40,
+  0x2B, 0x41, 0x4F, 0x40, 0x07, 0x40, 0x1F, 0x40, 0x07, 0xE0, 0x03, 0x4B,
+  0xE0, 0x03, 0x3B, 0x40, 0x1B, 0xEB, 0xE7, 0xFF, 0x41, 0x87, 0x41, 0x17,
+  0x40, 0x03, 0x40, 0xFF, 0x42, 0x57, 0xE0, 0x07, 0x13, 0x41, 0x47, 0x40,
+  0x1F, 0xE0, 0x03, 0x17, 0x40, 0x0F, 0xC0, 0x2F, 0x40, 0x07, 0x40, 0x0F,
+  0x40, 0x03, 0x41, 0xBF, 0x41, 0x53, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x07,
+  0x41, 0xAB, 0x41, 0x73, 0x40, 0x0B, 0x40, 0x4B, 0xC0, 0x2F, 0x40, 0x4F,
+  0x40, 0x13, 0x40, 0x03, 0x40, 0x2B, 0x40, 0x1B, 0x40, 0x03, 0x42, 0x07,
+  0xC0, 0x33, 0x40, 0x8F, 0x40, 0x03, 0x40, 0x1F, 0xC0, 0x37, 0x40, 0x0B,
+  0x40, 0x3B, 0x40, 0x07, 0x40, 0x13, 0xE1, 0x03, 0xDF, 0x40, 0x13, 0x40,
+  0x43, 0x40, 0x6F, 0x40, 0x37, 0x40, 0x0B, 0x40, 0x13, 0x40, 0x03, 0xE0,
+  0x0B, 0x13, 0x40, 0x17, 0xE0, 0x07, 0x03, 0x40, 0x53, 0x40, 0x3B, 0xE0,
+  0x07, 0x17, 0xE0, 0x0B, 0x0F, 0x40, 0x2B, 0xE0, 0x0B, 0x7F, 0x40, 0x3F,
+  0x40, 0x1B, 0x40, 0x33, 0x00, 0x6A, 0x25, 0x07, 0xC3, 0x07, 0x40, 0xEB,
+  0x40, 0xDF, 0x40, 0x07, 0x40, 0x1B, 0x40, 0x03, 0x40, 0xCB, 0x40, 0x0F,
+  0x40, 0x03, 0xE0, 0x03, 0xAF, 0x40, 0x0F, 0x40, 0x1F, 0xC0, 0x03, 0x40,
+  0x4F, 0xC0, 0x6B, 0xC0, 0x07, 0x40, 0x3B, 0xC0, 0x1F, 0xC0, 0x07, 0x40,
+  0x37, 0xE1, 0x03, 0x87, 0x40, 0x6F, 0xC0, 0x1B, 0xC0, 0x07, 0x40, 0x67,
+  0x40, 0x4F, 0x40, 0x2B, 0x41, 0x17, 0x40, 0x4F, 0x40, 0xB3, 0x5B, 0x9F,
+  0x40, 0x0F, 0xC0, 0x27, 0xC0, 0x07, 0x40, 0x27, 0xC0, 0x53, 0x40, 0x13,
+  0x40, 0x3F, 0x40, 0x27, 0x40, 0x43, 0x40, 0x37, 0x40, 0x07, 0x40, 0x8B,
+  0xCE, 0x47, 0x40, 0x23, 0x40, 0x03, 0x40, 0x13, 0x40, 0x07, 0x40, 0x03,
+  0x40, 0x33, 0xC0, 0x27, 0x40, 0x0F, 0x40, 0x37, 0xC0, 0x13, 0x40, 0x0B,
+  0x40, 0x1B, 0xC0, 0x03, 0x40, 0x5B, 0xC0, 0x23, 0x40, 0x07, 0x40, 0x0F,
+  0x40, 0x2B, 0x40, 0x0B, 0x40, 0x03, 0xC0, 0x0F, 0x40, 0x5F, 0x4D, 0x8B,
+  0x40, 0x07, 0x40, 0xA3, 0x40, 0xEB, 0x40, 0x07, 0x40, 0x2B, 0x40, 0x07,
+  0x40, 0x27, 0x02, 0x63, 0x63, 0x63, 0x60, 0xDF, 0x40, 0x13, 0x40, 0x3B,
+  0x40, 0x63, 0xC0, 0x6F, 0x40, 0x07, 0x41, 0x9B, 0x40, 0xFF, 0x40, 0x1F,
+  0xEB, 0xE7, 0xFF, 0x41, 0xD3, 0xC1, 0x33, 0x41, 0x1B, 0x40, 0x03, 0x41,
+  0x1F, 0x40, 0x07, 0xE0, 0x07, 0x03, 0x41, 0x1F, 0x40, 0x2F, 0x40, 0x03,
+  0xE0, 0x07, 0x1B, 0x40, 0x0F, 0x40, 0x1F, 0x40, 0x07, 0xE0, 0x0B, 0x03,
+  0x41, 0x9F, 0x40, 0x17, 0x41, 0x8F, 0x40, 0x07, 0x40, 0x03, 0x40, 0x0B,
+  0xE0, 0x07, 0x33, 0x40, 0x13, 0x42, 0x83, 0x41, 0x97, 0xE0, 0x07, 0x1B,
+  0x40, 0x33, 0xE0, 0x03, 0x03, 0xE0, 0x0B, 0xA7, 0x40, 0x33, 0x40, 0x43,
+  0xC0, 0x6F, 0xC0, 0x2F, 0x40, 0x17, 0x40, 0x53, 0x40, 0x33, 0x40, 0x1F,
+  0xC0, 0x17, 0xE0, 0x03, 0x07, 0x42, 0x2F, 0x46, 0x8F, 0x40, 0x13, 0x40,
+  0x27, 0x40, 0x03, 0x40, 0x33, 0xE1, 0x07, 0x1F, 0x40, 0x3F, 0x42, 0x2F,
+  0x40, 0x27, 0x41, 0x0B, 0x40, 0x37, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0xC0,
+  0x17, 0xE0, 0x03, 0x87, 0xC0, 0x0B, 0x40, 0x8B, 0x40, 0x33, 0x40, 0x5F,
+  0x40, 0x33, 0x40, 0x07, 0xC9, 0x53, 0x43, 0x3F, 0xE0, 0x07, 0x6F, 0x40,
+  0x37, 0x47, 0x2B, 0x40, 0x53, 0x40, 0x9F, 0x40, 0x3B, 0x40, 0x43, 0x44,
+  0x57, 0x40, 0x87, 0x40, 0x8F, 0x40, 0x3F, 0x48, 0x47, 0x40, 0x0B, 0x40,
+  0x1F, 0x40, 0x33, 0xC0, 0x2B, 0x40, 0x63, 0x40, 0x03, 0x40, 0x17, 0x40,
+  0x5B, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x3F, 0x40, 0x2F, 0x40, 0xE3, 0x40,
+  0x4F, 0x40, 0x33, 0x40, 0x8B, 0x40, 0x13, 0x40, 0x2B, 0x40, 0x23, 0x40,
+  0x0B, 0x40, 0x1B, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0x40, 0x17, 0x40, 0x2B,
+  0x40, 0x13, 0x40, 0x07, 0x00, 0x6A, 0x24, 0xE3, 0x40, 0x07, 0x40, 0x0F,
+  0xC0, 0x03, 0x40, 0x37, 0xE0, 0x07, 0x13, 0x40, 0x1B, 0x40, 0x17, 0x40,
+  0x3F, 0x40, 0x6F, 0x40, 0x03, 0x40, 0xDB, 0x43, 0xC3, 0x40, 0x1B, 0x40,
+  0x03, 0x40, 0x1F, 0x40, 0x93, 0xC0, 0x23, 0x40, 0x13, 0xE0, 0x03, 0x03,
+  0xC0, 0xD7, 0x40, 0xA3, 0x40, 0x3F, 0xC0, 0x63, 0x40, 0x0B, 0x40, 0x3B,
+  0x41, 0x13, 0x40, 0x13, 0x40, 0x03, 0x40, 0x43, 0x40, 0x13, 0x40, 0x0B,
+  0xE0, 0x07, 0xA3, 0x40, 0x13, 0x40, 0x43, 0x41, 0x73, 0x40, 0x3B, 0x40,
+  0x03, 0xE3, 0xE7, 0xFF, 0xE1, 0x03, 0x57, 0x40, 0xFF, 0xE0, 0x03, 0x0F,
+  0x40, 0x0B, 0x41, 0x3B, 0x40, 0x07, 0x41, 0x2B, 0xC1, 0x57, 0x40, 0x0F,
+  0x40, 0x03, 0x40, 0x1B, 0xC1, 0x5F, 0x41, 0x47, 0x42, 0x9F, 0xC0, 0x17,
+  0x40, 0x2F, 0x40, 0x4F, 0x40, 0x03, 0x4A, 0x13, 0x40, 0x1B, 0x40, 0x23,
+  0xC0, 0x2F, 0x40, 0x27, 0xC0, 0x03, 0x40, 0x2B, 0x40, 0x5B, 0x40, 0x1B,
+  0xC0, 0x13, 0x40, 0x07, 0x40, 0x17, 0x40, 0x07, 0x40, 0x37, 0x42, 0xB3,
+  0x40, 0x4B, 0x41, 0xFB, 0x40, 0x07, 0xC0, 0x03, 0x40, 0x1F, 0x40, 0x27,
+  0xE1, 0x07, 0xDB, 0x40, 0x33, 0xC0, 0x73, 0x40, 0x2B, 0x40, 0x27, 0x40,
+  0x03, 0x40, 0x47, 0x40, 0x07, 0x40, 0x1F, 0x40, 0x07, 0x40, 0x03, 0xE0,
+  0x03, 0x1F, 0x40, 0x4B, 0xE0, 0x07, 0x13, 0x40, 0x0F, 0x40, 0x2F, 0x40,
+  0x1B, 0x40, 0xF3, 0x40, 0x0F, 0x40, 0x0B, 0x40, 0x73, 0x40, 0x0B, 0xC0,
+  0x67, 0x40, 0x0B, 0x40, 0x4B, 0x40, 0x03, 0x42, 0xBF, 0x40, 0x23, 0x40,
+  0x2F, 0x40, 0xD7, 0x40, 0x07, 0x40, 0x03, 0x40, 0x23, 0xC0, 0x07, 0x40,
+  0x0B, 0x40, 0x23, 0x40, 0x07, 0x40, 0x03, 0x43, 0xC3, 0x40, 0x2B, 0x41,
+  0x0B, 0x40, 0x17, 0x40, 0x73, 0x40, 0x17, 0xE0, 0x03, 0x03, 0x40, 0x17,
+  0x40, 0x0F, 0x40, 0x1B, 0x40, 0xCB, 0x40, 0x6B, 0x40, 0x0F, 0x40, 0x03,
+  0x40, 0x0B, 0x40, 0x03, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0x40, 0x13, 0x40,
+  0x2F, 0x40, 0x77, 0xC0, 0x97, 0x40, 0x47, 0xC6, 0xF7, 0xE0, 0x07, 0xBF,
+  0xE0, 0x07, 0x3B, 0x40, 0x0F, 0x40, 0x2F, 0x40, 0x07, 0xC0, 0x03, 0xC0,
+  0x4B, 0x40, 0x07, 0x40, 0x1B, 0x40, 0x57, 0x40, 0x1B, 0xE0, 0x03, 0x4B,
+  0x40, 0x73, 0x41, 0xFB, 0x40, 0x07, 0x40, 0x23, 0x40, 0x1F, 0x40, 0x03,
+  0x40, 0x0F, 0x40, 0x07, 0x40, 0x03, 0x40, 0x2F, 0x40, 0x07, 0x40, 0xF7,
+  0x40, 0x4B, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0x40, 0x37, 0x40, 0x03, 0x41,
+  0x13, 0x40, 0x23, 0x40, 0x1B, 0x40, 0x0F, 0x40, 0x0B, 0x40, 0x73, 0x40,
+  0x03, 0x40, 0x37, 0x40, 0x03, 0x40, 0x13, 0xC0, 0x1B, 0x40, 0x57, 0xC1,
+  0x1F, 0x40, 0x6F, 0x40, 0x17, 0x40, 0x3B, 0x40, 0x0B, 0x40, 0x93, 0xC0,
+  0x1B, 0x40, 0x13, 0x40, 0x03, 0x40, 0x17, 0x42, 0x5B, 0x01, 0x57, 0x57,
+  0x7F, 0xFF, 0x87, 0x0C, 0xEF, 0xDC, 0xFF, 0x01, 0xA8, 0xA8, 0x9F, 0xFF,
+  0x10, 0x00, 0x41, 0x1B, 0x40, 0x03, 0x41, 0x07, 0xC1, 0x47, 0x42, 0x1B,
+  0x41, 0x4F, 0x40, 0x13, 0x41, 0x4B, 0x42, 0x43, 0x40, 0x23, 0x40, 0x13,
+  0x40, 0x0B, 0x56, 0xFB, 0x40, 0x07, 0x40, 0x1F, 0x40, 0x17, 0x41, 0x9F,
+  0x40, 0x0B, 0x41, 0x57, 0x41, 0x4B, 0x40, 0x13, 0x40, 0x0F, 0x41, 0x53,
+  0x40, 0x27, 0xC0, 0x17, 0x40, 0x13, 0x40, 0x1B, 0x40, 0x2F, 0x00, 0x6A,
+  0xA6, 0x33, 0x40, 0x53, 0x40, 0x17, 0x42, 0xFF, 0x40, 0x1B, 0x40, 0x0B,
+  0x40, 0x07, 0xC0, 0x1F, 0x40, 0x0F, 0xC0, 0x03, 0x40, 0x9F, 0x40, 0x3B,
+  0x49, 0xD3, 0x40, 0x1F, 0x40, 0x9B, 0xC0, 0x6F, 0x40, 0x0F, 0x40, 0x1F,
+  0x40, 0x13, 0x40, 0x6F, 0x40, 0x77, 0x40, 0x03, 0xC0, 0x3B, 0xC0, 0x07,
+  0x40, 0x2F, 0x40, 0x23, 0x40, 0x07, 0xC0, 0x13, 0x40, 0x07, 0xE0, 0x03,
+  0x2B, 0x40, 0x1B, 0xC0, 0xBB, 0x40, 0x8B, 0x40, 0x03, 0x40, 0xA7, 0x40,
+  0x5F, 0x40, 0x1B, 0x40, 0x5F, 0x40, 0x33, 0x40, 0x17, 0x42, 0x83, 0xE0,
+  0x0B, 0x3B, 0x40, 0x3F, 0x40, 0x2B, 0x40, 0x27, 0xE0, 0x03, 0x1F, 0x40,
+  0x0F, 0x40, 0x03, 0x40, 0x1B, 0xE0, 0x03, 0x23, 0x40, 0x13, 0x40, 0x03,
+  0x40, 0x53, 0x40, 0x07, 0xC0, 0x03, 0x40, 0x27, 0xC0, 0xAF, 0x40, 0x0B,
+  0x40, 0x7B, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x23, 0xE0, 0x07, 0x2F, 0x40,
+  0xA3, 0x40, 0x13, 0xE1, 0x03, 0x4F, 0x40, 0x27, 0x40, 0x2F, 0xE0, 0x07,
+  0x6F, 0x40, 0x13, 0x40, 0x1B, 0x40, 0x03, 0x40, 0x37, 0x40, 0xE3, 0x40,
+  0x0B, 0xE0, 0x0B, 0x03, 0xE0, 0x03, 0xC3, 0x40, 0x37, 0x43, 0x47, 0x40,
+  0x4F, 0x40, 0x9B, 0x40, 0x2F, 0x41, 0x07, 0x40, 0x43, 0x40, 0x0B, 0x40,
+  0x03, 0xE0, 0x03, 0x0B, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x97, 0x40, 0x27,
+  0x40, 0x0B, 0x40, 0x03, 0x40, 0x6F, 0xC1, 0xB7, 0x40, 0x0F, 0xE0, 0x03,
+  0x63, 0x40, 0x2B, 0x40, 0x67, 0x40, 0x17, 0x40, 0x33, 0x40, 0x2B, 0x40,
+  0x13, 0x40, 0x2F, 0x40, 0x07, 0x40, 0x17, 0x40, 0x03, 0x40, 0x23, 0x40,
+  0x6B, 0x40, 0x1F, 0x40, 0x8F, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x13, 0xC0,
+  0x37, 0x40, 0x33, 0x40, 0x1F, 0x40, 0x2F, 0xE0, 0x07, 0x03, 0x40, 0x2B,
+  0x41, 0x4F, 0x40, 0x7B, 0xFF, 0xE3, 0xFF, 0x0C, 0x00, 0x41, 0xB7, 0x48,
+  0xEF, 0x40, 0x03, 0x06, 0x54, 0x54, 0x54, 0xFF, 0x50, 0x50, 0x50, 0x60,
+  0x0B, 0x40, 0x0F, 0x02, 0x53, 0x53, 0x53, 0x60, 0x13, 0x40, 0x07, 0x40,
+  0x03, 0x02, 0x4C, 0x4C, 0x4C, 0x60, 0x07, 0x40, 0x1B, 0xE0, 0x1B, 0x03,
+  0x01, 0x5A, 0x5A, 0x9F, 0xFF, 0xDA, 0x20, 0x40, 0x53, 0x40, 0x3F, 0xC0,
+  0x33, 0x40, 0x67, 0x51, 0x63, 0xC0, 0x03, 0x40, 0x1B, 0x02, 0x5C, 0x5C,
+  0x5C, 0x7F, 0xFF, 0x7F, 0x80, 0x40, 0x33, 0xC0, 0x27, 0x40, 0x07, 0x41,
+  0x8B, 0x55, 0x8F, 0x40, 0x0B, 0x40, 0x37, 0x40, 0x07, 0xE0, 0x03, 0x03,
+  0x06, 0x55, 0x55, 0x55, 0xFF, 0x51, 0x51, 0x51, 0x60, 0x1B, 0xE0, 0x0B,
+  0x1F, 0x40, 0x5B, 0x40, 0x03, 0xC0, 0x33, 0x40, 0x4B, 0x40, 0x33, 0x40,
+  0x7B, 0x40, 0x07, 0x40, 0x5F, 0x40, 0x73, 0x45, 0xF3, 0x40, 0x23, 0x40,
+  0x13, 0x40, 0x0B, 0xE0, 0x03, 0x13, 0x40, 0x17, 0x40, 0x03, 0x40, 0x1B,
+  0x40, 0x4B, 0x40, 0x07, 0xC0, 0x23, 0xC0, 0x73, 0x40, 0x47, 0x40, 0x23,
+  0x40, 0x0F, 0x40, 0xEF, 0x40, 0x07, 0x40, 0x6B, 0x40, 0x47, 0x40, 0x6B,
+  0xC0, 0x13, 0x40, 0x23, 0x40, 0x2B, 0x40, 0x17, 0x40, 0x43, 0x40, 0x0F,
+  0x40, 0x53, 0x40, 0x23, 0x40, 0x2F, 0xC0, 0x13, 0x40, 0x17, 0xE0, 0x03,
+  0x03, 0x40, 0x1B, 0x40, 0x03, 0x40, 0x13, 0x40, 0x7F, 0x40, 0x4F, 0x40,
+  0x03, 0x40, 0x13, 0x41, 0x3B, 0x40, 0x37, 0x40, 0x03, 0x40, 0x57, 0x40,
+  0x13, 0x40, 0x03, 0x40, 0x57, 0x40, 0x03, 0x40, 0x33, 0x40, 0x03, 0x40,
+  0x37, 0x40, 0x1F, 0x40, 0x03, 0x02, 0x5B, 0x5B, 0x5B, 0x60, 0x87, 0x40,
+  0x17, 0xC0, 0x03, 0x40, 0xB3, 0x40, 0x03, 0x02, 0x52, 0x52, 0x52, 0x60,
+  0x2B, 0x40, 0x43, 0x02, 0x5D, 0x5D, 0x5D, 0x60, 0x07, 0x40, 0x17, 0x40,
+  0x6F, 0x40, 0x07, 0x40, 0xBF, 0x40, 0x1B, 0xC0, 0x07, 0xC0, 0x3F, 0x40,
+  0x5F, 0xC1, 0x8B, 0x40, 0x8B, 0x01, 0x60, 0x60, 0xE1, 0x01, 0xCF, 0x40,
+  0x1B, 0x40, 0x8B, 0x40, 0x07, 0x40, 0x2F, 0x40, 0x47, 0x40, 0xF3, 0x40,
+  0x13, 0x40, 0x03, 0x40, 0x17, 0x40, 0x07, 0x40, 0x03, 0x40, 0x1F, 0x40,
+  0x3F, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x03, 0xC0, 0x2B, 0x40, 0x13, 0xE0,
+  0x07, 0x03, 0x40, 0x8B, 0xE0, 0x03, 0x13, 0xC0, 0x4B, 0x40, 0x13, 0x40,
+  0x1B, 0x40, 0x03, 0x40, 0xC7, 0x40, 0xF7, 0x40, 0x57, 0x40, 0x0F, 0x40,
+  0x1B, 0xE0, 0x13, 0x03, 0x3F, 0xF8, 0x40, 0x03, 0xE0, 0xD7, 0x00, 0x65,
+  0x43, 0xC1, 0x07, 0x41, 0x1F, 0x02, 0x5E, 0x5E, 0x5E, 0xE1, 0x00, 0x1F,
+  0xC1, 0x47, 0x40, 0x07, 0x41, 0xAF, 0xC0, 0x27, 0x40, 0x0B, 0x41, 0x47,
+  0x40, 0x0F, 0xE1, 0x0B, 0x4B, 0xC1, 0xAF, 0x40, 0x27, 0x40, 0x53, 0x40,
+  0x27, 0x42, 0x17, 0x40, 0x47, 0x40, 0x0B, 0x40, 0x3B, 0x40, 0x23, 0x42,
+  0x3F, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x27, 0x40, 0x2F, 0x42, 0x63, 0x40,
+  0x03, 0xC0, 0x2B, 0x40, 0x2F, 0xE0, 0x13, 0x03, 0x40, 0x33, 0x42, 0xAF,
+  0xC0, 0x4B, 0xC0, 0x2B, 0x40, 0x53, 0x40, 0x9B, 0x40, 0x67, 0x40, 0x1F,
+  0x40, 0x0B, 0x40, 0x2B, 0x02, 0x4D, 0x4D, 0x4D, 0x60, 0x13, 0x40, 0x0B,
+  0x42, 0x53, 0x40, 0x1B, 0x40, 0x33, 0x40, 0x6F, 0x40, 0xA3, 0x40, 0x2F,
+  0x40, 0x0F, 0x40, 0x03, 0x40, 0x43, 0x40, 0x97, 0x40, 0x3B, 0x40, 0x0F,
+  0xC0, 0x1B, 0x40, 0x6B, 0x40, 0x0F, 0xE0, 0x03, 0x03, 0xE0, 0x03, 0x13,
+  0x40, 0x4B, 0x40, 0x1B, 0x40, 0x5F, 0xC0, 0x33, 0x40, 0x07, 0xC0, 0x5F,
+  0x40, 0x73, 0xC0, 0x23, 0x40, 0x17, 0x40, 0x93, 0x40, 0x2F, 0xE0, 0x03,
+  0x03, 0xC0, 0x73, 0xE0, 0x03, 0x13, 0x40, 0x2B, 0x40, 0x0F, 0x40, 0x93,
+  0x40, 0x07, 0xC0, 0x0F, 0x40, 0x4B, 0x40, 0x5B, 0x40, 0x07, 0x40, 0x17,
+  0x40, 0xDB, 0x40, 0x07, 0xE0, 0x0F, 0x03, 0x40, 0xD7, 0xE0, 0x03, 0x5F,
+  0x40, 0x0F, 0x44, 0x0F, 0x40, 0x07, 0xC0, 0x33, 0x40, 0x0B, 0x40, 0x4F,
+  0x41, 0x8B, 0x40, 0x67, 0x40, 0x0B, 0x40, 0x57, 0x40, 0x7B, 0x40, 0x1B,
+  0x40, 0x27, 0x40, 0x43, 0x40, 0x77, 0x40, 0x17, 0xC0, 0x0F, 0x40, 0x1B,
+  0x40, 0x23, 0x41, 0x0F, 0x43, 0x73, 0x40, 0x23, 0x40, 0x1B, 0xC0, 0x03,
+  0xC0, 0x1F, 0x40, 0x07, 0x40, 0x53, 0x41, 0x0B, 0x40, 0x1B, 0x40, 0x33,
+  0xC0, 0x2B, 0x40, 0x17, 0x40, 0x77, 0x40, 0x5B, 0x40, 0x13, 0x40, 0x03,
+  0x40, 0x2F, 0x40, 0x07, 0x40, 0x13, 0x40, 0x8F, 0x41, 0x5B, 0x40, 0x3B,
+  0x40, 0x0B, 0x40, 0x3F, 0xE0, 0x0F, 0x03, 0x40, 0x9B, 0x40, 0x4F, 0xE0,
+  0x0F, 0x27, 0x40, 0x53, 0xC0, 0x3B, 0xC0, 0x0B, 0x40, 0x57, 0x23, 0xF8,
+  0x40, 0x03, 0xE0, 0xD7, 0x00, 0x40, 0xE3, 0xE0, 0xFF, 0xFF, 0xFF, 0x16,
+  0x03, 0xE0, 0xD4, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x19, 0x00,
+  0xE3, 0xD4, 0xFC, 0x20, 0x00, 0x43, 0xFE, 0x02, 0xAF, 0xAF, 0xAF, 0xE0,
+  0x08, 0x03, 0x02, 0xAD, 0xAD, 0xAD, 0x60, 0x03, 0xE0, 0x0B, 0x1B, 0xC0,
+  0x13, 0x02, 0xB0, 0xB0, 0xB0, 0xE0, 0x00, 0x0B, 0xE0, 0x07, 0x13, 0xC0,
+  0x1B, 0x02, 0xAE, 0xAE, 0xAE, 0x60, 0x47, 0x40, 0x07, 0x40, 0x03, 0xC0,
+  0x27, 0xE0, 0x03, 0x0B, 0x40, 0x13, 0xE0, 0x07, 0x0F, 0x40, 0x13, 0xC0,
+  0x03, 0xC0, 0x1B, 0x40, 0x07, 0x40, 0x03, 0xC0, 0x17, 0xE0, 0x13, 0x07,
+  0x02, 0xB1, 0xB1, 0xB1, 0xE0, 0x08, 0x1F, 0x40, 0xD3, 0x40, 0x3F, 0x40,
+  0x03, 0xE0, 0x07, 0x3B, 0x40, 0x1B, 0xE0, 0x03, 0x13, 0xE0, 0x0B, 0x3F,
+  0x40, 0x1F, 0x40, 0x17, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x33, 0x02, 0xAC,
+  0xAC, 0xAC, 0xE0, 0x00, 0x4F, 0x40, 0x0F, 0xE0, 0x07, 0x5B, 0xC0, 0x13,
+  0x40, 0x17, 0x40, 0x03, 0x40, 0x37, 0xC0, 0x07, 0x40, 0x0B, 0xE0, 0x13,
+  0x03, 0xC1, 0x43, 0xE0, 0x13, 0x23, 0xC0, 0x1B, 0x40, 0x53, 0x40, 0x03,
+  0xC0, 0x0F, 0x40, 0x07, 0xC0, 0x7B, 0x40, 0x0B, 0x40, 0x1B, 0xC0, 0x0F,
+  0x40, 0x0B, 0x40, 0xC3, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x1F, 0xE0, 0x03,
+  0x0B, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x7F, 0xC0, 0x33, 0x40, 0x0F, 0x40,
+  0x2B, 0x40, 0x0F, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x0F, 0x40, 0xFF, 0x40,
+  0x13, 0x40, 0x03, 0x02, 0xAA, 0xAA, 0xAA, 0x60, 0x13, 0x40, 0x1B, 0x40,
+  0x03, 0x40, 0x1F, 0x40, 0x07, 0xC0, 0x03, 0xE0, 0x03, 0x0F, 0x40, 0x5B,
+  0x40, 0x0F, 0x40, 0x03, 0x40, 0x1F, 0x40, 0x07, 0xC0, 0x4B, 0x40, 0x0F,
+  0xE0, 0x03, 0x03, 0x40, 0x5B, 0xE0, 0x03, 0x0F, 0xE0, 0x03, 0x0B, 0x40,
+  0xB7, 0x40, 0x0F, 0x40, 0x4F, 0x40, 0x07, 0xE0, 0x0B, 0x03, 0xC0, 0x5B,
+  0xC0, 0x1B, 0x40, 0x67, 0x40, 0x13, 0xC0, 0x0F, 0xE0, 0x0B, 0x07, 0x54,
+  0x07, 0x40, 0x00, 0x23, 0x22, 0xE0, 0xD4, 0x00, 0x40, 0xE3, 0x40, 0xFF,
+  0x40, 0xEF, 0xE0, 0x0B, 0x03, 0x55, 0x47, 0x02, 0x72, 0x72, 0x72, 0x7D,
+  0x1B, 0x40, 0x07, 0xE0, 0x0B, 0x23, 0x5D, 0x37, 0xE0, 0x03, 0x17, 0x40,
+  0x27, 0x40, 0x03, 0x55, 0x5F, 0x54, 0x5B, 0x40, 0x43, 0x40, 0x07, 0x40,
+  0x27, 0x40, 0x03, 0x40, 0x1B, 0xE0, 0x03, 0x2F, 0x5D, 0xF7, 0xC0, 0x17,
+  0x40, 0x2B, 0x40, 0x03, 0x55, 0x83, 0x40, 0x07, 0xC0, 0x27, 0x40, 0x0B,
+  0x40, 0x13, 0xC0, 0x53, 0xC0, 0x17, 0x40, 0x07, 0x40, 0x5B, 0x40, 0x07,
+  0x40, 0x03, 0x56, 0x8B, 0x40, 0x07, 0xC0, 0x2F, 0x58, 0x9F, 0x40, 0x5B,
+  0x40, 0x13, 0x40, 0x03, 0x40, 0x1F, 0x02, 0x7A, 0x7A, 0x7A, 0x60, 0x07,
+  0x40, 0x0F, 0x40, 0x27, 0x40, 0x8F, 0x40, 0x23, 0x40, 0x1B, 0x40, 0x03,
+  0x40, 0x17, 0x40, 0x13, 0x40, 0x07, 0x40, 0x03, 0xE0, 0x03, 0x5F, 0xC0,
+  0x0B, 0x40, 0x07, 0x40, 0x8B, 0x40, 0x27, 0x40, 0x33, 0x40, 0x67, 0x40,
+  0x03, 0x40, 0x2F, 0x40, 0x13, 0x40, 0x1F, 0x40, 0x07, 0x40, 0x0F, 0x40,
+  0x1F, 0x40, 0x0F, 0x56, 0x5F, 0xC0, 0x13, 0x40, 0x17, 0x40, 0x73, 0x40,
+  0x07, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x27, 0x40, 0xE3, 0x40, 0x2B, 0x40,
+  0x13, 0xE0, 0x0F, 0x03, 0xC0, 0x1F, 0x40, 0x2F, 0x41, 0x3B, 0x40, 0x57,
+  0x40, 0xC7, 0x40, 0x43, 0xE0, 0x03, 0x33, 0x40, 0x27, 0x40, 0x03, 0x40,
+  0x73, 0x40, 0x57, 0x40, 0x1B, 0xE0, 0x03, 0xFB, 0x40, 0x0F, 0x40, 0x17,
+  0x40, 0x3B, 0x40, 0x0B, 0x40, 0x3F, 0x40, 0x53, 0x40, 0x07, 0x40, 0x0F,
+  0xE0, 0x07, 0x03, 0x40, 0x1B, 0x40, 0x13, 0x40, 0x4F, 0x40, 0x57, 0x40,
+  0x03, 0x40, 0x0F, 0xC0, 0x53, 0x40, 0x1F, 0x01, 0x7C, 0x7C, 0x9F, 0xFF,
+  0x99, 0x5C, 0x40, 0x17, 0x40, 0x03, 0x40, 0x9F, 0x40, 0x17, 0xC0, 0x53,
+  0xC0, 0x33, 0x40, 0x1B, 0x40, 0x77, 0x40, 0x03, 0xC1, 0x37, 0x40, 0xC7,
+  0x40, 0x17, 0xE0, 0x03, 0x03, 0x40, 0x3B, 0x40, 0x03, 0x40, 0x27, 0xC0,
+  0x17, 0x40, 0x53, 0xC0, 0x0B, 0xC0, 0x07, 0x40, 0x13, 0x40, 0x03, 0xC0,
+  0x0F, 0x40, 0x07, 0x40, 0x33, 0x40, 0x9B, 0x40, 0x5F, 0x40, 0x43, 0x40,
+  0x13, 0xE0, 0x03, 0x03, 0xC0, 0x13, 0x40, 0x07, 0x40, 0x03, 0x40, 0x27,
+  0x40, 0xDB, 0x58, 0x2F, 0x50, 0x6B, 0x40, 0x00, 0xE3, 0xD4, 0xFC, 0x20,
+  0x00, 0x40, 0xE3, 0x43, 0xFF, 0x41, 0x2B, 0x42, 0x0B, 0xE1, 0x03, 0x1F,
+  0x41, 0xAB, 0xC1, 0xB7, 0xE0, 0x03, 0x17, 0x41, 0x2B, 0x41, 0x57, 0x40,
+  0x13, 0x40, 0x23, 0x43, 0x07, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x1B, 0xC1,
+  0x87, 0xE0, 0x0B, 0x3B, 0x40, 0x23, 0xE0, 0x03, 0x03, 0x40, 0x2F, 0xC0,
+  0x0F, 0x40, 0x83, 0x40, 0x03, 0x40, 0x87, 0x40, 0x53, 0x42, 0x0F, 0xC0,
+  0x43, 0x40, 0x5F, 0xE0, 0x03, 0x0F, 0xC0, 0x33, 0xE0, 0x03, 0x07, 0x40,
+  0x4B, 0x41, 0xC3, 0x40, 0x13, 0x40, 0x2F, 0xC0, 0x47, 0x40, 0x07, 0x40,
+  0x3B, 0x40, 0x07, 0x40, 0x5F, 0x40, 0x1F, 0x40, 0x03, 0x40, 0x23, 0x40,
+  0x67, 0xE0, 0x03, 0x13, 0x40, 0x17, 0x40, 0x03, 0x40, 0x4B, 0x40, 0xC7,
+  0x42, 0x0F, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x17, 0x40, 0x8F, 0x40, 0x63,
+  0xE0, 0x03, 0x0F, 0x02, 0x7E, 0x7E, 0x7E, 0x60, 0x1B, 0x40, 0x63, 0x40,
+  0x53, 0x40, 0x27, 0x40, 0x03, 0x40, 0x0B, 0x42, 0x4B, 0x40, 0x07, 0x40,
+  0x63, 0x40, 0x4B, 0x40, 0x07, 0x40, 0x1B, 0x40, 0x07, 0x40, 0x0F, 0x40,
+  0x03, 0x40, 0x0F, 0xC0, 0x63, 0x40, 0x5F, 0x40, 0x0F, 0x40, 0x5F, 0x02,
+  0x7D, 0x7D, 0x7D, 0x63, 0x4F, 0x40, 0x0B, 0x40, 0x43, 0xE0, 0x07, 0x5F,
+  0x40, 0x17, 0x40, 0x47, 0xC0, 0x33, 0x40, 0x23, 0x40, 0xE3, 0x40, 0x0F,
+  0x40, 0xA3, 0x40, 0x47, 0xE0, 0x17, 0x03, 0x40, 0x3F, 0x40, 0x83, 0x40,
+  0x07, 0x40, 0x4F, 0x41, 0xD7, 0x40, 0x07, 0xC0, 0x37, 0x40, 0x17, 0x40,
+  0x57, 0x40, 0x53, 0x40, 0x13, 0x40, 0x1B, 0x40, 0x5B, 0x40, 0x0F, 0x40,
+  0x17, 0x41, 0x3F, 0x40, 0x07, 0x40, 0x17, 0x40, 0x1F, 0x40, 0x03, 0x40,
+  0x0F, 0x40, 0xF7, 0x40, 0x57, 0x40, 0x0B, 0x40, 0x2B, 0x40, 0x33, 0x40,
+  0x23, 0x40, 0x0F, 0x40, 0xC7, 0x40, 0x1B, 0x40, 0x03, 0x40, 0x5F, 0xC0,
+  0x33, 0x40, 0x07, 0x40, 0x2B, 0x40, 0x07, 0x40, 0x03, 0x40, 0x2B, 0x40,
+  0x07, 0x40, 0x37, 0x41, 0x1F, 0x40, 0x0B, 0x40, 0xDF, 0xC0, 0x33, 0x40,
+  0x0F, 0xE0, 0x03, 0x2F, 0x40, 0x0F, 0x40, 0x2B, 0xE4, 0x07, 0x83, 0x40,
+  0x17, 0xE0, 0x0F, 0x03, 0xE0, 0x07, 0x3F, 0x40, 0x27, 0x40, 0x97, 0x55,
+  0x0B, 0x40, 0x00, 0x23, 0x22, 0xE0, 0xD4, 0x00, 0x40, 0xE3, 0x49, 0x0B,
+  0x40, 0xF7, 0x41, 0x3B, 0x40, 0xFB, 0xC1, 0x5F, 0xE1, 0x0B, 0x1B, 0x41,
+  0x93, 0xC0, 0x23, 0x40, 0x07, 0x5D, 0x57, 0x40, 0x07, 0x40, 0x3F, 0x40,
+  0x1B, 0x41, 0xDB, 0x40, 0x07, 0x40, 0x03, 0xDD, 0x67, 0x40, 0x4F, 0x40,
+  0x5B, 0x41, 0xC3, 0x40, 0x07, 0x40, 0x2B, 0xE0, 0x07, 0x03, 0x40, 0x23,
+  0x40, 0x33, 0xE2, 0x07, 0x7F, 0xC0, 0x27, 0xC0, 0x8B, 0xE1, 0x07, 0xFF,
+  0x40, 0x33, 0x40, 0x7F, 0x42, 0x6F, 0x40, 0x0B, 0x40, 0x2F, 0x40, 0x07,
+  0x42, 0x97, 0x40, 0x17, 0x40, 0x0F, 0x40, 0x5B, 0xC0, 0x07, 0x40, 0x13,
+  0xC0, 0x0F, 0x40, 0x13, 0xC0, 0x03, 0x40, 0x33, 0x40, 0xBB, 0x40, 0x1B,
+  0x40, 0xA3, 0x40, 0x0F, 0x40, 0x2B, 0xC0, 0x1F, 0x40, 0x97, 0x42, 0xC3,
+  0x40, 0x03, 0x40, 0x13, 0x40, 0x2B, 0x40, 0x23, 0x40, 0x0B, 0x40, 0x9B,
+  0x40, 0x1F, 0x40, 0x0B, 0x40, 0x33, 0x40, 0x43, 0x40, 0x03, 0x40, 0xAB,
+  0x40, 0x87, 0xC0, 0x27, 0x40, 0x1F, 0x40, 0x17, 0x40, 0x07, 0xC0, 0x03,
+  0x40, 0x0F, 0x40, 0x27, 0x40, 0x07, 0xC0, 0x13, 0xE0, 0x03, 0x07, 0xC0,
+  0x4F, 0xE0, 0x03, 0x13, 0x40, 0x9F, 0x40, 0x6F, 0x40, 0x07, 0x40, 0x03,
+  0x40, 0x0B, 0x40, 0x83, 0xE1, 0x07, 0x5F, 0xC0, 0x77, 0x40, 0x1B, 0x40,
+  0x47, 0x40, 0x0F, 0x40, 0x07, 0xE0, 0x0F, 0x6B, 0xE0, 0x03, 0x63, 0x40,
+  0x4B, 0x40, 0x2F, 0x40, 0x03, 0x40, 0xEB, 0x40, 0x1B, 0x40, 0x47, 0x40,
+  0x07, 0xE0, 0x07, 0x03, 0x40, 0x17, 0x40, 0x83, 0x40, 0x8B, 0xC0, 0x1B,
+  0x40, 0x37, 0xC0, 0x0B, 0x40, 0x17, 0x40, 0x1F, 0x40, 0x27, 0x40, 0x7B,
+  0x40, 0x4F, 0xE0, 0x03, 0x1F, 0xC0, 0x27, 0x40, 0x13, 0xC2, 0x33, 0x40,
+  0x0B, 0x40, 0x17, 0x40, 0x87, 0x40, 0x07, 0xE0, 0x07, 0xB7, 0x40, 0x4B,
+  0x40, 0x17, 0x40, 0x03, 0x40, 0x5F, 0x41, 0x97, 0x40, 0x5B, 0xC0, 0x37,
+  0x40, 0x13, 0x40, 0x23, 0xC1, 0x5B, 0x40, 0x1B, 0x40, 0x0F, 0x40, 0x4F,
+  0x40, 0x07, 0xC0, 0x4F, 0x45, 0xBB, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x43,
+  0x40, 0x3F, 0x41, 0xB3, 0x58, 0xBB, 0x40, 0x00, 0xE3, 0xD4, 0xFC, 0x20,
+  0x00, 0x40, 0xE3, 0x47, 0xFF, 0xC1, 0x47, 0x41, 0x07, 0x41, 0x33, 0x40,
+  0x0F, 0x40, 0x0B, 0x40, 0x07, 0x41, 0x13, 0x41, 0xB3, 0x41, 0x43, 0x40,
+  0x0F, 0xC0, 0x03, 0xC1, 0x4B, 0xC1, 0x6B, 0xC0, 0x17, 0xE0, 0x07, 0x07,
+  0x40, 0x3F, 0x40, 0x13, 0x40, 0x4F, 0x41, 0x77, 0x40, 0x03, 0x40, 0x4F,
+  0xC0, 0x03, 0x40, 0x3F, 0x41, 0x7B, 0x40, 0x1F, 0x45, 0xBB, 0x40, 0x0F,
+  0x40, 0x2F, 0x40, 0x03, 0x40, 0x73, 0x40, 0x2F, 0x40, 0x0B, 0x40, 0x03,
+  0xC0, 0x4B, 0x40, 0x07, 0xC3, 0xF3, 0x40, 0x0B, 0x41, 0xB3, 0x40, 0xB7,
+  0xC0, 0x2F, 0x40, 0x1B, 0xC0, 0x37, 0x40, 0x57, 0x40, 0x3B, 0xE0, 0x03,
+  0x03, 0x40, 0x63, 0x42, 0x93, 0x40, 0x13, 0x40, 0x3F, 0xC0, 0x2B, 0x40,
+  0x0F, 0x40, 0x43, 0x40, 0x13, 0x40, 0xDF, 0x40, 0x27, 0x40, 0x07, 0x02,
+  0x81, 0x81, 0x81, 0x60, 0x07, 0x40, 0x1F, 0x40, 0x03, 0x40, 0x1F, 0x40,
+  0x07, 0x40, 0x1F, 0x40, 0x07, 0xC0, 0x03, 0x40, 0x3B, 0x40, 0x87, 0x40,
+  0x4F, 0x40, 0x0B, 0xC0, 0x17, 0x40, 0x07, 0x40, 0x17, 0xE0, 0x07, 0x13,
+  0x40, 0x17, 0x40, 0x13, 0xC1, 0x0B, 0xC0, 0x57, 0x40, 0x17, 0x40, 0x43,
+  0xC0, 0xA3, 0x40, 0x23, 0x40, 0x13, 0x40, 0x8B, 0x40, 0xCF, 0xC1, 0x2F,
+  0x40, 0x17, 0x40, 0xFB, 0x40, 0x03, 0x40, 0x2F, 0x40, 0x23, 0xE0, 0x03,
+  0x03, 0x40, 0x1F, 0x40, 0x77, 0xC0, 0x1B, 0x40, 0xAF, 0xC0, 0x43, 0xE0,
+  0x03, 0x27, 0xC0, 0x77, 0x40, 0x07, 0x40, 0x4B, 0x40, 0x07, 0x40, 0x3B,
+  0xC0, 0x23, 0x40, 0x33, 0x40, 0x0B, 0x40, 0x13, 0x40, 0x03, 0xC0, 0x4F,
+  0x40, 0x13, 0xC0, 0x03, 0x40, 0x33, 0xE1, 0x03, 0x77, 0xC0, 0x17, 0x40,
+  0x07, 0x40, 0x1B, 0x40, 0x07, 0x40, 0x47, 0x40, 0x83, 0x40, 0x0B, 0xC0,
+  0x03, 0x40, 0x0F, 0x40, 0x1F, 0x40, 0x57, 0xC0, 0x13, 0xE0, 0x0F, 0x07,
+  0x40, 0x23, 0x40, 0x2F, 0x40, 0x1F, 0xC0, 0xD7, 0x40, 0xAF, 0x40, 0x8F,
+  0x40, 0x1B, 0x40, 0x47, 0x40, 0x03, 0x40, 0x1B, 0x40, 0x07, 0x40, 0x17,
+  0xC0, 0x07, 0x40, 0x1F, 0x40, 0x37, 0xC0, 0x03, 0x40, 0x23, 0xC0, 0x13,
+  0x40, 0x07, 0x40, 0x0F, 0x40, 0x2B, 0x40, 0x0B, 0x02, 0x5F, 0x5F, 0x5F,
+  0x43, 0x1A, 0xE3, 0xDC, 0xFF, 0x51, 0x0F, 0x40, 0xF3, 0xC1, 0x17, 0xC0,
+  0x07, 0x42, 0x67, 0x40, 0x0B, 0x41, 0x17, 0xE0, 0x0B, 0x1F, 0x40, 0x13,
+  0x40, 0x1B, 0x40, 0x23, 0xE0, 0x03, 0x03, 0x40, 0x17, 0x41, 0x47, 0xC0,
+  0x3F, 0x40, 0x1B, 0x41, 0x87, 0x42, 0x1B, 0xC0, 0x2F, 0x40, 0x1B, 0x40,
+  0x03, 0x40, 0x1B, 0x40, 0x03, 0x41, 0xD3, 0x40, 0x03, 0x42, 0xEF, 0x40,
+  0x07, 0x40, 0x1B, 0x40, 0x0B, 0x40, 0x1B, 0x40, 0x33, 0x40, 0x53, 0x40,
+  0x0B, 0xE0, 0x03, 0x03, 0x40, 0x23, 0x40, 0x2B, 0x40, 0x03, 0x40, 0x6F,
+  0x40, 0x1B, 0xC0, 0x33, 0x40, 0x0B, 0x40, 0x1F, 0x40, 0x3B, 0x40, 0x03,
+  0xC0, 0x1F, 0x40, 0x17, 0x40, 0x03, 0x40, 0x4F, 0x43, 0x73, 0x48, 0xBF,
+  0xE0, 0x07, 0x1B, 0x40, 0x4F, 0x40, 0x23, 0x40, 0x17, 0x40, 0x0B, 0x40,
+  0x53, 0x40, 0x07, 0x40, 0x13, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x0B, 0x40,
+  0xD3, 0x40, 0x07, 0x40, 0x4B, 0x40, 0x07, 0x40, 0x03, 0x40, 0x1F, 0xC3,
+  0x9B, 0x40, 0x3F, 0x40, 0x03, 0x40, 0x27, 0xE0, 0x03, 0x23, 0x40, 0x27,
+  0x40, 0x03, 0x40, 0x1B, 0x40, 0x07, 0x40, 0x03, 0x40, 0x23, 0x42, 0xC7,
+  0xC0, 0x13, 0xC0, 0x47, 0x40, 0x07, 0x40, 0x1F, 0x40, 0x03, 0x40, 0x23,
+  0x40, 0x03, 0x40, 0x0B, 0x40, 0x4F, 0x40, 0xD7, 0x40, 0x0F, 0x40, 0x0B,
+  0x40, 0x13, 0x40, 0x03, 0x40, 0x3F, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x1B,
+  0x40, 0x13, 0xE0, 0x17, 0x03, 0x40, 0x63, 0x43, 0x97, 0x40, 0x27, 0x40,
+  0x0B, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x43, 0x41, 0x23, 0x40, 0x4F, 0x40,
+  0x13, 0x45, 0x9B, 0x40, 0xDB, 0x40, 0xFF, 0x40, 0x0F, 0x40, 0x1F, 0x40,
+  0x83, 0xC0, 0x2B, 0x40, 0x07, 0xC0, 0x03, 0x40, 0x37, 0xC0, 0x0B, 0x40,
+  0x27, 0x40, 0xDB, 0x40, 0x2B, 0x40, 0x4B, 0x40, 0x97, 0x01, 0x6A, 0x6A,
+  0x9F, 0xFF, 0x35, 0xF8, 0x40, 0x1B, 0x40, 0x2B, 0x40, 0x07, 0x40, 0x1B,
+  0x40, 0x23, 0xC0, 0x0F, 0xC0, 0x3F, 0x40, 0x07, 0x40, 0x1B, 0x40, 0x07,
+  0xE0, 0x03, 0x03, 0x40, 0x33, 0x40, 0x2B, 0x40, 0x33, 0x42, 0x5B, 0x40,
+  0x0F, 0xC0, 0x1F, 0xC0, 0x0B, 0x40, 0xA7, 0x40, 0xDB, 0x40, 0x23, 0xC0,
+  0x13, 0x40, 0x23, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x97, 0xC0, 0x5B, 0x40,
+  0x0F, 0x40, 0x0B, 0x40, 0x07, 0x02, 0x5C, 0x5C, 0x5C, 0x23, 0xFD, 0xE3,
+  0xDD, 0xFF, 0x47, 0xFF, 0x40, 0xF7, 0x41, 0x97, 0x41, 0x1B, 0x43, 0x37,
+  0x41, 0x33, 0x40, 0x03, 0x41, 0x3F, 0x40, 0x03, 0x41, 0xF7, 0x40, 0x1B,
+  0x40, 0x23, 0x40, 0x2B, 0x40, 0x0B, 0xE0, 0x0F, 0x03, 0x40, 0x3F, 0xC0,
+  0x1B, 0x41, 0x4B, 0xE1, 0x07, 0x9B, 0x40, 0x4F, 0x40, 0x17, 0xC0, 0x23,
+  0x40, 0x53, 0x43, 0x87, 0x41, 0xA3, 0x41, 0xCF, 0xE0, 0x03, 0x1B, 0x40,
+  0x2B, 0x40, 0x7B, 0x40, 0x07, 0xC0, 0x2F, 0xE0, 0x07, 0x07, 0x40, 0x1B,
+  0x40, 0x23, 0x02, 0x7F, 0x7F, 0x7F, 0x60, 0xB3, 0xC0, 0x1F, 0xC0, 0xA7,
+  0x40, 0x8F, 0x40, 0xCB, 0xC2, 0xB7, 0x40, 0x1F, 0x40, 0x33, 0x40, 0x0F,
+  0x40, 0x0B, 0x40, 0x7F, 0x40, 0x23, 0x40, 0x77, 0x4A, 0x7F, 0x40, 0x0F,
+  0xC0, 0x1F, 0x40, 0x07, 0x40, 0x23, 0x40, 0x03, 0x40, 0x0B, 0x43, 0x03,
+  0x40, 0x4B, 0x40, 0x0F, 0xE0, 0x0B, 0x03, 0x40, 0x23, 0x40, 0x8B, 0x40,
+  0x4F, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x03, 0xC0, 0x2B, 0x40, 0x63, 0x41,
+  0x0F, 0x40, 0x03, 0x40, 0x23, 0xC0, 0x03, 0xC0, 0x1F, 0xE0, 0x0B, 0x07,
+  0x40, 0x23, 0x40, 0x43, 0xC0, 0x77, 0x40, 0x43, 0x40, 0x03, 0x41, 0x2F,
+  0x40, 0xE3, 0x40, 0x03, 0xE0, 0x03, 0x37, 0x40, 0x2B, 0x40, 0xDB, 0x40,
+  0x07, 0x40, 0x17, 0x40, 0x3F, 0x40, 0x8B, 0x48, 0xC3, 0x40, 0x0B, 0x40,
+  0x13, 0xE0, 0x03, 0x03, 0xE0, 0x03, 0x13, 0x40, 0x57, 0xE0, 0x03, 0x1B,
+  0xC0, 0x0B, 0xE0, 0x03, 0x23, 0xC0, 0x13, 0xE0, 0x07, 0x07, 0x40, 0x6F,
+  0x40, 0x77, 0x40, 0x2B, 0x41, 0x43, 0x40, 0x4B, 0x40, 0x07, 0xC0, 0x9F,
+  0x40, 0x17, 0x40, 0x33, 0xC0, 0x07, 0x40, 0x0B, 0x40, 0xD3, 0x40, 0x37,
+  0x40, 0x0B, 0xC0, 0x03, 0x40, 0x0F, 0xC0, 0x17, 0x40, 0x07, 0xC0, 0x17,
+  0x40, 0x07, 0x40, 0x1B, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x0B,
+  0x40, 0x4F, 0x40, 0x77, 0x40, 0x0B, 0x40, 0x13, 0xE0, 0x0F, 0x03, 0x40,
+  0x1F, 0xE0, 0x07, 0x4F, 0xC0, 0x2B, 0x40, 0xA3, 0x41, 0x4F, 0x40, 0xB3,
+  0x40, 0x13, 0xE3, 0xE7, 0xFF, 0xC1, 0xA7, 0x40, 0xFF, 0xE5, 0x03, 0x13,
+  0x41, 0x0B, 0x40, 0x03, 0xE1, 0x03, 0x3B, 0x40, 0x23, 0x40, 0x2F, 0x40,
+  0x03, 0x41, 0x37, 0x40, 0x1F, 0xE0, 0x0F, 0x03, 0x40, 0x2B, 0x40, 0x1B,
+  0xE0, 0x03, 0x2B, 0x40, 0x33, 0xC1, 0x6B, 0xC0, 0x1F, 0x41, 0xC3, 0x43,
+  0x5B, 0x40, 0x67, 0x40, 0x2B, 0x40, 0x33, 0x40, 0x13, 0x40, 0x07, 0x40,
+  0x03, 0x40, 0x17, 0x41, 0xBB, 0x40, 0x3B, 0x40, 0x0F, 0x40, 0x03, 0x40,
+  0x0B, 0x40, 0x23, 0x40, 0x07, 0xE4, 0x07, 0x37, 0x40, 0x17, 0x40, 0x23,
+  0x40, 0x5F, 0x40, 0x1F, 0x42, 0xFF, 0x40, 0x43, 0x40, 0x13, 0xC0, 0x03,
+  0x40, 0x17, 0x40, 0x6B, 0x40, 0x07, 0xC0, 0x13, 0x40, 0x07, 0x40, 0x0F,
+  0x40, 0x9F, 0x41, 0x07, 0x40, 0x3F, 0x40, 0x03, 0xE0, 0x07, 0x5F, 0x40,
+  0x27, 0xE0, 0x07, 0x03, 0xC0, 0x73, 0xE0, 0x07, 0x17, 0xC0, 0x0F, 0x40,
+  0x6B, 0x40, 0x03, 0x40, 0x4F, 0xC0, 0x13, 0x40, 0x33, 0x40, 0x03, 0xC0,
+  0x9B, 0x40, 0x1F, 0xC0, 0x03, 0x40, 0x87, 0x40, 0x0B, 0x44, 0x93, 0xC0,
+  0x8F, 0x40, 0x37, 0x41, 0x07, 0xC0, 0x2F, 0x40, 0x07, 0x42, 0xFB, 0x40,
+  0x43, 0x40, 0x2B, 0x40, 0x5B, 0x40, 0x03, 0x40, 0x27, 0x40, 0x07, 0x40,
+  0xC3, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x27, 0x40, 0x03, 0x40,
+  0x1F, 0x40, 0x5F, 0x40, 0x13, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x57, 0x40,
+  0x1B, 0x40, 0x4F, 0x40, 0x57, 0x40, 0x13, 0xE0, 0x0F, 0x03, 0x40, 0x53,
+  0x40, 0x3F, 0xC0, 0x33, 0xE0, 0x0B, 0x2F, 0xE0, 0x03, 0x57, 0xE0, 0x0B,
+  0x1F, 0xE0, 0x03, 0x5B, 0xC1, 0x5F, 0x40, 0x53, 0x40, 0xC7, 0x40, 0x07,
+  0xC0, 0x1F, 0x40, 0x0B, 0x40, 0x13, 0x40, 0x03, 0xC0, 0x13, 0x40, 0x07,
+  0xC0, 0x5F, 0x40, 0x17, 0x46, 0x3F, 0x45, 0x53, 0x40, 0x13, 0x40, 0x2F,
+  0x40, 0x6F, 0x55, 0x3F, 0x40, 0x07, 0x40, 0x1F, 0x40, 0x13, 0x40, 0x33,
+  0xC0, 0x03, 0x40, 0xE7, 0x40, 0x13, 0x40, 0x07, 0x42, 0x1B, 0x40, 0x17,
+  0xC0, 0x83, 0x40, 0x0B, 0xE3, 0xE3, 0xFF, 0x5D, 0x3B, 0x40, 0xF3, 0xC0,
+  0x03, 0x41, 0x17, 0x41, 0x37, 0xC0, 0x0F, 0xE0, 0x03, 0x07, 0x40, 0x17,
+  0xE2, 0x0B, 0x1F, 0x40, 0x33, 0x41, 0x67, 0x40, 0x2B, 0x40, 0x23, 0x40,
+  0x07, 0x41, 0x8B, 0x42, 0x27, 0x40, 0x17, 0x41, 0x67, 0x40, 0x03, 0x41,
+  0x6B, 0x40, 0x3F, 0x40, 0x1F, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x13, 0x40,
+  0x1B, 0xC0, 0x03, 0x40, 0x0F, 0xF1, 0x03, 0x97, 0x42, 0xFB, 0x40, 0x4B,
+  0x40, 0x47, 0x40, 0x03, 0x40, 0x27, 0x40, 0x63, 0x42, 0x7B, 0x46, 0xD3,
+  0x40, 0x2B, 0x40, 0x33, 0x40, 0x13, 0x40, 0x1F, 0x40, 0x03, 0x40, 0x5B,
+  0x40, 0x93, 0x40, 0x5F, 0x40, 0x17, 0x40, 0x33, 0x40, 0x0B, 0x40, 0x17,
+  0xC0, 0x03, 0x40, 0x1F, 0x40, 0x2B, 0x40, 0x5B, 0x40, 0x63, 0x40, 0x0B,
+  0x40, 0x03, 0x40, 0x2F, 0x40, 0x23, 0x40, 0x33, 0xC0, 0x0B, 0x40, 0x0F,
+  0xC0, 0x03, 0x40, 0x2F, 0xC0, 0x0B, 0xE0, 0x0F, 0x07, 0x40, 0x5B, 0x40,
+  0x53, 0x40, 0x03, 0xE0, 0x07, 0x23, 0x40, 0x3F, 0x42, 0xAB, 0x40, 0x6B,
+  0xC0, 0x1B, 0x40, 0xCB, 0xC0, 0x0B, 0xE0, 0x0B, 0x07, 0x40, 0x2B, 0xC1,
+  0x4B, 0x40, 0x0B, 0x40, 0x23, 0xC0, 0x07, 0x40, 0xA7, 0xC0, 0xFF, 0x40,
+  0x17, 0x40, 0x03, 0xC0, 0x63, 0x40, 0x0B, 0xE0, 0x07, 0x1B, 0x40, 0x2F,
+  0x49, 0x2B, 0x40, 0x07, 0x40, 0x1F, 0x40, 0xE3, 0x41, 0x1B, 0x40, 0x07,
+  0x40, 0x0F, 0x40, 0x3B, 0x40, 0x5B, 0x40, 0x03, 0xC0, 0x13, 0x40, 0x17,
+  0x40, 0x2F, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x0B,
+  0x40, 0x03, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0x40, 0xFF, 0x40, 0x3F, 0x40,
+  0x07, 0x40, 0x17, 0x40, 0x23, 0xC0, 0x63, 0x40, 0x5F, 0xC1, 0x17, 0x40,
+  0x17, 0x40, 0x9F, 0xC0, 0x03, 0x41, 0x07, 0x40, 0x67, 0x43, 0xBB, 0x40,
+  0x07, 0x40, 0x3B, 0xE0, 0x0B, 0x03, 0x40, 0x57, 0xE0, 0x03, 0x5F, 0x40,
+  0x23, 0x40, 0x13, 0x40, 0x4F, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x67, 0xC0,
+  0x07, 0xE3, 0x03, 0xDB, 0x40, 0x23, 0xC6, 0x6B, 0x40, 0x1F, 0xE0, 0x07,
+  0x03, 0x41, 0x67, 0x02, 0x54, 0x54, 0x54, 0x2B, 0xFD, 0xEB, 0xE5, 0xFF,
+  0x41, 0x17, 0xC1, 0x77, 0x41, 0x87, 0xE1, 0x07, 0x23, 0xC1, 0x4F, 0x41,
+  0x97, 0x40, 0x2B, 0x40, 0x23, 0x40, 0x13, 0x40, 0x0F, 0xE0, 0x07, 0x2B,
+  0xC1, 0x53, 0x40, 0x1F, 0x41, 0xEB, 0x40, 0x23, 0xC0, 0x13, 0x41, 0xA7,
+  0xC0, 0x0B, 0x40, 0x1F, 0xC0, 0x0B, 0x40, 0x07, 0x40, 0x57, 0x40, 0x07,
+  0x40, 0x03, 0xE0, 0x07, 0x1B, 0x40, 0x13, 0x40, 0x47, 0x40, 0x3F, 0xC0,
+  0x53, 0xC0, 0x2F, 0x40, 0x07, 0x42, 0x43, 0x40, 0x07, 0x40, 0x27, 0x40,
+  0x03, 0x40, 0x0B, 0x40, 0x97, 0x40, 0x0B, 0x43, 0x6F, 0xE0, 0x0B, 0x4F,
+  0x40, 0x1B, 0xE0, 0x03, 0x17, 0xC0, 0x33, 0x40, 0x07, 0x40, 0x1B, 0xC0,
+  0x03, 0x40, 0x23, 0x40, 0x77, 0x40, 0x07, 0x40, 0x1B, 0x40, 0x57, 0x40,
+  0x6F, 0x44, 0x7B, 0x44, 0x83, 0x40, 0x0B, 0xC0, 0x2B, 0xC0, 0x1F, 0x40,
+  0x07, 0xC0, 0x13, 0xE0, 0x0F, 0x07, 0x40, 0x53, 0x40, 0xCB, 0x40, 0x1F,
+  0x40, 0x43, 0xC0, 0x33, 0x40, 0x07, 0x40, 0x0F, 0x40, 0xEF, 0x40, 0x1B,
+  0x40, 0x77, 0x40, 0x07, 0x40, 0x2F, 0x42, 0xF7, 0x40, 0x0F, 0x40, 0x03,
+  0x40, 0x0F, 0x40, 0x17, 0x40, 0x03, 0x41, 0x8F, 0x40, 0x0F, 0x42, 0xBF,
+  0x40, 0x07, 0xC0, 0x3B, 0x40, 0x0B, 0x40, 0x33, 0x40, 0x07, 0x40, 0x27,
+  0x40, 0x57, 0x40, 0x2B, 0x40, 0x0B, 0x40, 0x43, 0x40, 0x1B, 0x40, 0x2B,
+  0xC0, 0x1F, 0x40, 0x17, 0x40, 0x03, 0xE0, 0x03, 0x0F, 0x40, 0x8F, 0x40,
+  0x27, 0x40, 0x3B, 0x40, 0x0B, 0x40, 0x1F, 0x40, 0x33, 0x40, 0x07, 0x40,
+  0x03, 0xE0, 0x03, 0x0B, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x3F, 0x40, 0x5F,
+  0xE0, 0x03, 0x1B, 0x40, 0x43, 0x47, 0xAB, 0x40, 0x07, 0x40, 0x1B, 0xC1,
+  0x97, 0xC0, 0x23, 0x40, 0x5B, 0x40, 0x9B, 0xC0, 0x1F, 0x40, 0x07, 0x40,
+  0x4B, 0xC0, 0x1F, 0x40, 0x33, 0x40, 0x0F, 0xE0, 0x03, 0x03, 0xC0, 0x13,
+  0x40, 0x2B, 0xC0, 0x5B, 0x40, 0x7B, 0x40, 0x0F, 0x40, 0x07, 0xE0, 0x03,
+  0x2B, 0xE0, 0x07, 0x0B, 0x40, 0x6B, 0xC0, 0x13, 0x40, 0x47, 0x40, 0x03,
+  0x40, 0x37, 0xE7, 0xE3, 0xFF, 0x4F, 0xFF, 0xC1, 0x03, 0xC0, 0x07, 0x41,
+  0x87, 0x40, 0x0B, 0x41, 0x0B, 0x40, 0x03, 0xC1, 0x47, 0x41, 0x1F, 0x4A,
+  0x8F, 0x40, 0x13, 0x40, 0x1F, 0x40, 0x03, 0x40, 0x13, 0x42, 0x73, 0x40,
+  0x13, 0x41, 0xA7, 0x40, 0x03, 0x40, 0x17, 0x40, 0x03, 0xC0, 0x0B, 0xC0,
+  0x3F, 0x40, 0x57, 0x43, 0x3B, 0xE6, 0x07, 0x7F, 0x41, 0x87, 0x40, 0x1B,
+  0x40, 0x07, 0x40, 0x37, 0xE0, 0x0F, 0x03, 0x40, 0x6B, 0x40, 0x1B, 0xC0,
+  0x57, 0x40, 0x0B, 0xE0, 0x1B, 0x03, 0xE0, 0x0B, 0x2F, 0xC0, 0x13, 0xE0,
+  0x07, 0x53, 0xC0, 0x87, 0x40, 0x07, 0x40, 0x5B, 0xC0, 0x07, 0x40, 0x0B,
+  0x40, 0x03, 0xC0, 0x0F, 0x40, 0xD3, 0x43, 0xBB, 0x46, 0x5B, 0x40, 0x0B,
+  0x40, 0x1B, 0x40, 0x4B, 0x40, 0x13, 0x40, 0x0B, 0x40, 0xCB, 0x40, 0x63,
+  0x43, 0x33, 0x41, 0x1B, 0x40, 0x1B, 0x40, 0x17, 0x40, 0x03, 0x40, 0x17,
+  0x47, 0x0F, 0x40, 0x07, 0x40, 0x0F, 0xE0, 0x13, 0x03, 0x40, 0x37, 0xC0,
+  0x5F, 0x40, 0x4B, 0x40, 0x33, 0x40, 0x03, 0x40, 0x53, 0x40, 0x03, 0x40,
+  0x47, 0xC0, 0x93, 0x40, 0x47, 0x40, 0x2F, 0x41, 0x8F, 0x40, 0x07, 0x40,
+  0x03, 0x40, 0x3B, 0x40, 0x93, 0x40, 0x13, 0x40, 0x0B, 0x40, 0x2B, 0x40,
+  0x0F, 0x40, 0x2B, 0x40, 0x3F, 0x40, 0x0B, 0x40, 0x17, 0x40, 0x0F, 0x40,
+  0x2F, 0x40, 0x07, 0xE0, 0x0F, 0x03, 0x40, 0x77, 0xC0, 0x1B, 0x40, 0x0B,
+  0x40, 0x53, 0x40, 0x43, 0xC0, 0x13, 0xC0, 0x07, 0x40, 0x4F, 0x40, 0x17,
+  0x40, 0x07, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x1B, 0xC0, 0x33, 0x40, 0xC7,
+  0xC0, 0x6B, 0x40, 0x13, 0xC0, 0x1F, 0x40, 0x23, 0x40, 0x03, 0xC0, 0x1B,
+  0x40, 0x0B, 0x40, 0x03, 0x40, 0x23, 0x40, 0xB7, 0x40, 0x07, 0x40, 0x03,
+  0x40, 0x3F, 0x40, 0x0F, 0x40, 0x27, 0x40, 0xBF, 0xE0, 0x03, 0x3F, 0x40,
+  0x0B, 0x40, 0x03, 0x40, 0x1B, 0x40, 0x3B, 0xC0, 0x07, 0xC0, 0x87, 0x40,
+  0x07, 0x40, 0x03, 0x40, 0x17, 0x41, 0xA3, 0x40, 0x47, 0x40, 0x27, 0x40,
+  0x03, 0x40, 0x0B, 0x41, 0x4F, 0x02, 0x5E, 0x5E, 0x5E, 0x27, 0xFD, 0xE7,
+  0xE1, 0xFF, 0x40, 0xFB, 0xC0, 0x03, 0x41, 0x5F, 0x41, 0x07, 0x40, 0x03,
+  0x40, 0x13, 0x41, 0x27, 0x41, 0xE7, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x03,
+  0x45, 0x67, 0x45, 0xBB, 0x40, 0x1F, 0xE1, 0x03, 0x8B, 0x40, 0x3B, 0x40,
+  0x13, 0xE0, 0x03, 0x03, 0x43, 0x1F, 0x40, 0x33, 0x40, 0x03, 0x40, 0x17,
+  0x40, 0x57, 0x41, 0x63, 0x40, 0x07, 0x41, 0x87, 0x41, 0xBF, 0x40, 0x1B,
+  0x40, 0x03, 0x40, 0x1F, 0xE0, 0x23, 0x03, 0x40, 0x43, 0x40, 0x03, 0xC0,
+  0x77, 0xC0, 0x57, 0xE0, 0x0B, 0x43, 0x40, 0x23, 0x44, 0x77, 0x41, 0xF3,
+  0xC0, 0x27, 0xC0, 0x3B, 0x40, 0x1B, 0xE0, 0x03, 0x33, 0xC0, 0x0F, 0x40,
+  0x2B, 0x40, 0x23, 0x40, 0x03, 0x40, 0x1F, 0x42, 0x57, 0x40, 0xB3, 0x40,
+  0x0B, 0x40, 0x13, 0x40, 0xFB, 0x40, 0x23, 0xC0, 0x2F, 0x40, 0xC3, 0x40,
+  0x0B, 0x40, 0x1B, 0x40, 0x23, 0x40, 0x2F, 0xE0, 0x03, 0x07, 0x40, 0x17,
+  0x40, 0x2F, 0xE0, 0x03, 0x13, 0xC0, 0x0B, 0x45, 0x57, 0x40, 0x5B, 0x40,
+  0x3F, 0x41, 0x6B, 0x40, 0x03, 0xC1, 0x3B, 0x40, 0x23, 0x40, 0x17, 0x40,
+  0x07, 0x40, 0x03, 0x40, 0x43, 0x40, 0x2B, 0x41, 0x3B, 0x40, 0x07, 0x40,
+  0x13, 0x40, 0x7B, 0xC0, 0x6F, 0xE0, 0x03, 0x2B, 0x40, 0x1B, 0x40, 0x03,
+  0x40, 0x33, 0x40, 0x7F, 0x40, 0x0B, 0x40, 0x03, 0xE0, 0x03, 0x23, 0x40,
+  0x3B, 0x40, 0x0F, 0x40, 0x1F, 0x40, 0x03, 0x40, 0x47, 0xC0, 0x57, 0x40,
+  0x2B, 0xC0, 0x0B, 0x40, 0x17, 0x40, 0x2B, 0x40, 0x13, 0xC0, 0x03, 0x40,
+  0x0F, 0x40, 0xA7, 0xC0, 0x3F, 0x41, 0x5B, 0x45, 0xE3, 0x40, 0x07, 0x40,
+  0x23, 0x40, 0x33, 0x42, 0x2F, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x03, 0x40,
+  0x33, 0x40, 0x07, 0x40, 0x33, 0x41, 0x93, 0x40, 0x2B, 0x40, 0x77, 0x41,
+  0x4F, 0x40, 0x03, 0x40, 0xAB, 0xC0, 0x1F, 0x40, 0x07, 0x40, 0x03, 0x40,
+  0x83, 0x40, 0x43, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x43, 0x40, 0x77, 0xC0,
+  0x0F, 0x40, 0x3F, 0x40, 0x17, 0xE0, 0x07, 0x03, 0x40, 0x1F, 0x40, 0x2B,
+  0x41, 0x4F, 0x40, 0x07, 0x40, 0x1F, 0x40, 0x07, 0xE0, 0x03, 0x4B, 0xE0,
+  0x03, 0x3B, 0x40, 0x1B, 0xEB, 0xE7, 0xFF, 0x41, 0x87, 0x41, 0x17, 0x40,
+  0x03, 0x40, 0xFF, 0x42, 0x57, 0xE0, 0x07, 0x13, 0x41, 0x47, 0x40, 0x1F,
+  0xE0, 0x03, 0x17, 0x40, 0x0F, 0xC0, 0x2F, 0x40, 0x07, 0x40, 0x0F, 0x40,
+  0x03, 0x41, 0xBF, 0x41, 0x53, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x07, 0x41,
+  0xAB, 0x41, 0x73, 0x40, 0x0B, 0x40, 0x4B, 0xC0, 0x2F, 0x40, 0x4F, 0x40,
+  0x13, 0x40, 0x03, 0x40, 0x2B, 0x40, 0x1B, 0x40, 0x03, 0x42, 0x07, 0xC0,
+  0x33, 0x40, 0x8F, 0x40, 0x03, 0x40, 0x1F, 0xC0, 0x37, 0x40, 0x0B, 0x40,
+  0x3B, 0x40, 0x07, 0x40, 0x13, 0xE1, 0x03, 0xDF, 0x40, 0x13, 0x40, 0x43,
+  0x40, 0x6F, 0x40, 0x37, 0x40, 0x0B, 0x40, 0x13, 0x40, 0x03, 0xE0, 0x0B,
+  0x13, 0x40, 0x17, 0xE0, 0x07, 0x03, 0x40, 0x53, 0x40, 0x3B, 0xE0, 0x07,
+  0x17, 0xE0, 0x0B, 0x0F, 0x40, 0x2B, 0xE0, 0x0B, 0x7F, 0x40, 0x3F, 0x40,
+  0x1B, 0x40, 0x33, 0x40, 0xCB, 0xC3, 0x07, 0x40, 0xEB, 0x40, 0xDF, 0x40,
+  0x07, 0x40, 0x1B, 0x40, 0x03, 0x40, 0xCB, 0x40, 0x0F, 0x40, 0x03, 0xE0,
+  0x03, 0xAF, 0x40, 0x0F, 0x40, 0x1F, 0xC0, 0x03, 0x40, 0x4F, 0xC0, 0x6B,
+  0xC0, 0x07, 0x40, 0x3B, 0xC0, 0x1F, 0xC0, 0x07, 0x40, 0x37, 0xE1, 0x03,
+  0x87, 0x40, 0x6F, 0xC0, 0x1B, 0xC0, 0x07, 0x40, 0x67, 0x40, 0x4F, 0x40,
+  0x2B, 0x41, 0x17, 0x40, 0x4F, 0x40, 0xB3, 0x5B, 0x9F, 0x40, 0x0F, 0xC0,
+  0x27, 0xC0, 0x07, 0x40, 0x27, 0xC0, 0x53, 0x40, 0x13, 0x40, 0x3F, 0x40,
+  0x27, 0x40, 0x43, 0x40, 0x37, 0x40, 0x07, 0x40, 0x8B, 0xCE, 0x47, 0x40,
+  0x23, 0x40, 0x03, 0x40, 0x13, 0x40, 0x07, 0x40, 0x03, 0x40, 0x33, 0xC0,
+  0x27, 0x40, 0x0F, 0x40, 0x37, 0xC0, 0x13, 0x40, 0x0B, 0x40, 0x1B, 0xC0,
+  0x03, 0x40, 0x5B, 0xC0, 0x23, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x2B, 0x40,
+  0x0B, 0x40, 0x03, 0xC0, 0x0F, 0x40, 0x5F, 0x4D, 0x8B, 0x40, 0x07, 0x40,
+  0xA3, 0x40, 0xEB, 0x40, 0x07, 0x40, 0x2B, 0x40, 0x07, 0x40, 0x27, 0x01,
+  0x69, 0x69, 0x9F, 0xFF, 0x26, 0x9C, 0x40, 0x13, 0x40, 0x3B, 0x40, 0x63,
+  0xC0, 0x6F, 0x40, 0x07, 0x41, 0x9B, 0x40, 0xFF, 0x40, 0x1F, 0xEB, 0xE7,
+  0xFF, 0x41, 0xD3, 0xC1, 0x33, 0x41, 0x1B, 0x40, 0x03, 0x41, 0x1F, 0x40,
+  0x07, 0xE0, 0x07, 0x03, 0x41, 0x1F, 0x40, 0x2F, 0x40, 0x03, 0xE0, 0x07,
+  0x1B, 0x40, 0x0F, 0x40, 0x1F, 0x40, 0x07, 0xE0, 0x0B, 0x03, 0x41, 0x9F,
+  0x40, 0x17, 0x41, 0x8F, 0x40, 0x07, 0x40, 0x03, 0x40, 0x0B, 0xE0, 0x07,
+  0x33, 0x40, 0x13, 0x42, 0x83, 0x41, 0x97, 0xE0, 0x07, 0x1B, 0x40, 0x33,
+  0xE0, 0x03, 0x03, 0xE0, 0x0B, 0xA7, 0x40, 0x33, 0x40, 0x43, 0xC0, 0x6F,
+  0xC0, 0x2F, 0x40, 0x17, 0x40, 0x53, 0x40, 0x33, 0x40, 0x1F, 0xC0, 0x17,
+  0xE0, 0x03, 0x07, 0x42, 0x2F, 0x46, 0x8F, 0x40, 0x13, 0x40, 0x27, 0x40,
+  0x03, 0x40, 0x33, 0xE1, 0x07, 0x1F, 0x40, 0x3F, 0x42, 0x2F, 0x40, 0x27,
+  0x41, 0x0B, 0x40, 0x37, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0xC0, 0x17, 0xE0,
+  0x03, 0x87, 0xC0, 0x0B, 0x40, 0x8B, 0x40, 0x33, 0x40, 0x5F, 0x40, 0x33,
+  0x40, 0x07, 0xC9, 0x53, 0x43, 0x3F, 0xE0, 0x07, 0x6F, 0x40, 0x37, 0x47,
+  0x2B, 0x40, 0x53, 0x40, 0x9F, 0x40, 0x3B, 0x40, 0x43, 0x44, 0x57, 0x40,
+  0x87, 0x40, 0x8F, 0x40, 0x3F, 0x48, 0x47, 0x40, 0x0B, 0x40, 0x1F, 0x40,
+  0x33, 0xC0, 0x2B, 0x40, 0x63, 0x40, 0x03, 0x40, 0x17, 0x40, 0x5B, 0x40,
+  0x03, 0x40, 0x0F, 0x40, 0x3F, 0x40, 0x2F, 0x40, 0xE3, 0x40, 0x4F, 0x40,
+  0x33, 0x40, 0x8B, 0x40, 0x13, 0x40, 0x2B, 0x40, 0x23, 0x40, 0x0B, 0x40,
+  0x1B, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0x40, 0x17, 0x40, 0x2B, 0x40, 0x13,
+  0x40, 0x07, 0x40, 0x4B, 0x40, 0x07, 0x40, 0x0F, 0xC0, 0x03, 0x40, 0x37,
+  0xE0, 0x07, 0x13, 0x40, 0x1B, 0x40, 0x17, 0x40, 0x3F, 0x40, 0x6F, 0x40,
+  0x03, 0x40, 0xDB, 0x43, 0xC3, 0x40, 0x1B, 0x40, 0x03, 0x40, 0x1F, 0x40,
+  0x93, 0xC0, 0x23, 0x40, 0x13, 0xE0, 0x03, 0x03, 0xC0, 0xD7, 0x40, 0xA3,
+  0x40, 0x3F, 0xC0, 0x63, 0x40, 0x0B, 0x40, 0x3B, 0x41, 0x13, 0x40, 0x13,
+  0x40, 0x03, 0x40, 0x43, 0x40, 0x13, 0x40, 0x0B, 0xE0, 0x07, 0xA3, 0x40,
+  0x13, 0x40, 0x43, 0x41, 0x73, 0x40, 0x3B, 0x40, 0x03, 0xE3, 0xE7, 0xFF,
+  0xE1, 0x03, 0x57, 0x40, 0xFF, 0xE0, 0x03, 0x0F, 0x40, 0x0B, 0x41, 0x3B,
+  0x40, 0x07, 0x41, 0x2B, 0xC1, 0x57, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x1B,
+  0xC1, 0x5F, 0x41, 0x47, 0x42, 0x9F, 0xC0, 0x17, 0x40, 0x2F, 0x40, 0x4F,
+  0x40, 0x03, 0x4A, 0x13, 0x40, 0x1B, 0x40, 0x23, 0xC0, 0x2F, 0x40, 0x27,
+  0xC0, 0x03, 0x40, 0x2B, 0x40, 0x5B, 0x40, 0x1B, 0xC0, 0x13, 0x40, 0x07,
+  0x40, 0x17, 0x40, 0x07, 0x40, 0x37, 0x42, 0xB3, 0x40, 0x4B, 0x41, 0xFB,
+  0x40, 0x07, 0xC0, 0x03, 0x40, 0x1F, 0x40, 0x27, 0xE1, 0x07, 0xDB, 0x40,
+  0x33, 0xC0, 0x73, 0x40, 0x2B, 0x40, 0x27, 0x40, 0x03, 0x40, 0x47, 0x40,
+  0x07, 0x40, 0x1F, 0x40, 0x07, 0x40, 0x03, 0xE0, 0x03, 0x1F, 0x40, 0x4B,
+  0xE0, 0x07, 0x13, 0x40, 0x0F, 0x40, 0x2F, 0x40, 0x1B, 0x40, 0xF3, 0x40,
+  0x0F, 0x40, 0x0B, 0x40, 0x73, 0x40, 0x0B, 0xC0, 0x67, 0x40, 0x0B, 0x40,
+  0x4B, 0x40, 0x03, 0x42, 0xBF, 0x40, 0x23, 0x40, 0x2F, 0x40, 0xD7, 0x40,
+  0x07, 0x40, 0x03, 0x40, 0x23, 0xC0, 0x07, 0x40, 0x0B, 0x40, 0x23, 0x40,
+  0x07, 0x40, 0x03, 0x43, 0xC3, 0x40, 0x2B, 0x41, 0x0B, 0x40, 0x17, 0x40,
+  0x73, 0x40, 0x17, 0xE0, 0x03, 0x03, 0x40, 0x17, 0x40, 0x0F, 0x40, 0x1B,
+  0x40, 0xCB, 0x40, 0x6B, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x03,
+  0x40, 0x0B, 0xE0, 0x03, 0x03, 0x40, 0x13, 0x40, 0x2F, 0x40, 0x77, 0xC0,
+  0x97, 0x40, 0x47, 0xC6, 0xF7, 0xE0, 0x07, 0xBF, 0xE0, 0x07, 0x3B, 0x40,
+  0x0F, 0x40, 0x2F, 0x40, 0x07, 0xC0, 0x03, 0xC0, 0x4B, 0x40, 0x07, 0x40,
+  0x1B, 0x40, 0x57, 0x40, 0x1B, 0xE0, 0x03, 0x4B, 0x40, 0x73, 0x41, 0xFB,
+  0x40, 0x07, 0x40, 0x23, 0x40, 0x1F, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x07,
+  0x40, 0x03, 0x40, 0x2F, 0x40, 0x07, 0x40, 0xF7, 0x40, 0x4B, 0x40, 0x0B,
+  0xE0, 0x03, 0x03, 0x40, 0x37, 0x40, 0x03, 0x41, 0x13, 0x40, 0x23, 0x40,
+  0x1B, 0x40, 0x0F, 0x40, 0x0B, 0x40, 0x73, 0x40, 0x03, 0x40, 0x37, 0x40,
+  0x03, 0x40, 0x13, 0xC0, 0x1B, 0x40, 0x57, 0xC1, 0x1F, 0x40, 0x6F, 0x40,
+  0x17, 0x40, 0x3B, 0x40, 0x0B, 0x40, 0x93, 0xC0, 0x1B, 0x40, 0x13, 0x40,
+  0x03, 0x40, 0x17, 0x42, 0x5B, 0x02, 0x5D, 0x5D, 0x5D, 0x2F, 0xFD, 0xEF,
+  0xDD, 0xFF, 0xDF, 0xFF, 0x10, 0x00, 0x41, 0x1B, 0x40, 0x03, 0x41, 0x07,
+  0xC1, 0x47, 0x42, 0x1B, 0x41, 0x4F, 0x40, 0x13, 0x41, 0x4B, 0x42, 0x43,
+  0x40, 0x23, 0x40, 0x13, 0x40, 0x0B, 0x56, 0xFB, 0x40, 0x07, 0x40, 0x1F,
+  0x40, 0x17, 0x41, 0x9F, 0x40, 0x0B, 0x41, 0x57, 0x41, 0x4B, 0x40, 0x13,
+  0x40, 0x0F, 0x41, 0x53, 0x40, 0x27, 0xC0, 0x17, 0x40, 0x13, 0x40, 0x1B,
+  0x40, 0x2F, 0x43, 0x3F, 0x40, 0x0B, 0x40, 0x53, 0x40, 0x17, 0x42, 0xFF,
+  0x40, 0x0F, 0x40, 0x0B, 0x40, 0x07, 0xC0, 0x1F, 0x40, 0x0F, 0xC0, 0x03,
+  0x40, 0x9F, 0x40, 0x3B, 0x49, 0xD3, 0x40, 0x1F, 0x40, 0x9B, 0xC0, 0x6F,
+  0x40, 0x0F, 0x40, 0x1F, 0x40, 0x13, 0x40, 0x6F, 0x40, 0x77, 0x40, 0x03,
+  0xC0, 0x3B, 0xC0, 0x07, 0x40, 0x2F, 0x40, 0x23, 0x40, 0x07, 0xC0, 0x13,
+  0x40, 0x07, 0xE0, 0x03, 0x2B, 0x40, 0x1B, 0xC0, 0xBB, 0x40, 0x8B, 0x40,
+  0x03, 0x40, 0xA7, 0x40, 0x5F, 0x40, 0x1B, 0x40, 0x5F, 0x40, 0x33, 0x40,
+  0x17, 0x42, 0x83, 0xE0, 0x0B, 0x3B, 0x40, 0x3F, 0x40, 0x2B, 0x40, 0x27,
+  0xE0, 0x03, 0x1F, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x1B, 0xE0, 0x03, 0x23,
+  0x40, 0x13, 0x40, 0x03, 0x40, 0x53, 0x40, 0x07, 0xC0, 0x03, 0x40, 0x27,
+  0xC0, 0xAF, 0x40, 0x0B, 0x40, 0x7B, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x23,
+  0xE0, 0x07, 0x2F, 0x40, 0xA3, 0x40, 0x13, 0xE1, 0x03, 0x4F, 0x40, 0x27,
+  0x40, 0x2F, 0xE0, 0x07, 0x6F, 0x40, 0x13, 0x40, 0x1B, 0x40, 0x03, 0x40,
+  0x37, 0x40, 0xE3, 0x40, 0x0B, 0xE0, 0x0B, 0x03, 0xE0, 0x03, 0xC3, 0x40,
+  0x37, 0x43, 0x47, 0x40, 0x4F, 0x40, 0x9B, 0x40, 0x2F, 0x41, 0x07, 0x40,
+  0x43, 0x40, 0x0B, 0x40, 0x03, 0xE0, 0x03, 0x0B, 0x40, 0x0F, 0x40, 0x03,
+  0x40, 0x97, 0x40, 0x27, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x6F, 0xC1, 0xB7,
+  0x40, 0x0F, 0xE0, 0x03, 0x63, 0x40, 0x2B, 0x40, 0x67, 0x40, 0x17, 0x40,
+  0x33, 0x40, 0x2B, 0x40, 0x13, 0x40, 0x2F, 0x40, 0x07, 0x40, 0x17, 0x40,
+  0x03, 0x40, 0x23, 0x40, 0x6B, 0x40, 0x1F, 0x40, 0x8F, 0x40, 0x0F, 0x40,
+  0x03, 0x40, 0x13, 0xC0, 0x37, 0x40, 0x33, 0x40, 0x1F, 0x40, 0x2F, 0xE0,
+  0x07, 0x03, 0x40, 0x2B, 0x41, 0x4F, 0x40, 0x7B, 0xFF, 0xE3, 0xFF, 0x0C,
+  0x00, 0x41, 0xB7, 0x48, 0xEF, 0x40, 0x03, 0x02, 0x59, 0x59, 0x59, 0x7F,
+  0xFF, 0x29, 0x2C, 0x40, 0x0B, 0x40, 0x03, 0x01, 0x58, 0x58, 0xFF, 0x01,
+  0xFF, 0x2D, 0xE4, 0x40, 0x0B, 0x01, 0x51, 0x51, 0x9F, 0xFF, 0x29, 0x90,
+  0x40, 0x1B, 0xE0, 0x1B, 0x03, 0x02, 0x60, 0x60, 0x60, 0x60, 0x03, 0x01,
+  0x55, 0x55, 0x9F, 0xFF, 0x2E, 0x4C, 0xC0, 0x33, 0x40, 0x67, 0x51, 0x63,
+  0xC0, 0x03, 0x40, 0x5B, 0x06, 0x62, 0x62, 0x62, 0xFF, 0x66, 0x66, 0x66,
+  0x60, 0x2F, 0xC0, 0x27, 0x40, 0x07, 0x41, 0x8B, 0x55, 0x8F, 0x40, 0x0B,
+  0x40, 0x37, 0x40, 0x07, 0xE0, 0x03, 0x03, 0x02, 0x5B, 0x5B, 0x5B, 0x7F,
+  0xFF, 0x29, 0xC0, 0x40, 0x1B, 0x40, 0x03, 0xE0, 0x03, 0x1B, 0x40, 0x0B,
+  0x40, 0x5B, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x4B, 0x40, 0x33,
+  0x40, 0x7B, 0x40, 0x07, 0x40, 0x5F, 0x40, 0xA7, 0x45, 0xF3, 0x40, 0x1F,
+  0x40, 0x13, 0x40, 0x0B, 0xE0, 0x03, 0x13, 0x40, 0x17, 0x40, 0x03, 0x40,
+  0x1B, 0x40, 0x4B, 0x40, 0x07, 0xC0, 0x23, 0xC0, 0x73, 0x40, 0x47, 0x40,
+  0x23, 0x40, 0x0F, 0x40, 0xEF, 0x40, 0x07, 0x40, 0x6B, 0x40, 0x47, 0x40,
+  0x6B, 0xC0, 0x13, 0x40, 0x23, 0x40, 0x2B, 0x40, 0x17, 0x40, 0x43, 0x40,
+  0x0F, 0x40, 0x53, 0x40, 0x23, 0x40, 0x2F, 0xC0, 0x13, 0x40, 0x17, 0xE0,
+  0x03, 0x03, 0x40, 0x1B, 0x40, 0x03, 0x40, 0x13, 0x40, 0x7F, 0x40, 0x4F,
+  0x40, 0x03, 0x40, 0x13, 0x41, 0x3B, 0x40, 0x37, 0x40, 0x03, 0x40, 0x57,
+  0x40, 0x13, 0x40, 0x03, 0x40, 0x57, 0x40, 0x03, 0x40, 0x33, 0x40, 0x03,
+  0x40, 0x37, 0x40, 0x1F, 0x40, 0x03, 0x02, 0x61, 0x61, 0x61, 0x60, 0x87,
+  0x40, 0x17, 0xC0, 0x03, 0x40, 0xB3, 0x40, 0x03, 0x01, 0x57, 0x57, 0x9F,
+  0xFF, 0x2C, 0x10, 0x40, 0x43, 0x02, 0x63, 0x63, 0x63, 0x60, 0x07, 0x40,
+  0x17, 0x40, 0x6F, 0x40, 0x07, 0x40, 0xBF, 0x40, 0x1B, 0xC0, 0x07, 0xC0,
+  0x3F, 0x40, 0x5F, 0x01, 0x56, 0x56, 0x81, 0x8B, 0x40, 0x8B, 0xE1, 0x03,
+  0xCF, 0x40, 0x1B, 0x40, 0x8B, 0x40, 0x07, 0x40, 0x2F, 0x40, 0x47, 0x40,
+  0xF3, 0x40, 0x13, 0x40, 0x03, 0x40, 0x17, 0x40, 0x07, 0x40, 0x03, 0x40,
+  0x1F, 0x40, 0x3F, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x03, 0xC0, 0x2B, 0x40,
+  0x13, 0xE0, 0x07, 0x03, 0x40, 0x8B, 0xE0, 0x03, 0x13, 0xC0, 0x4B, 0x40,
+  0x13, 0x40, 0x1B, 0x40, 0x03, 0x40, 0xC7, 0x40, 0xF7, 0x40, 0x57, 0x40,
+  0x0F, 0x40, 0x1B, 0xE0, 0x13, 0x03, 0x40, 0x00, 0x00, 0x00, 0xE0, 0xD6,
+  0x00, 0x40, 0xE3, 0x45, 0x43, 0xC1, 0x07, 0x41, 0x1F, 0x02, 0x64, 0x64,
+  0x64, 0xE1, 0x00, 0x1F, 0xC1, 0x47, 0x40, 0x07, 0x41, 0xAF, 0xC0, 0x27,
+  0x40, 0x0B, 0x41, 0x47, 0x40, 0x0F, 0xE1, 0x0B, 0x4B, 0xC1, 0xAF, 0x40,
+  0x27, 0x40, 0x53, 0x40, 0x27, 0x42, 0x17, 0x40, 0x47, 0x40, 0x0B, 0x40,
+  0x3B, 0x40, 0x23, 0x42, 0x3F, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x27, 0x40,
+  0x2F, 0x42, 0x63, 0x40, 0x03, 0xC0, 0x2B, 0x40, 0x2F, 0xE0, 0x13, 0x03,
+  0x40, 0x33, 0x42, 0xAF, 0xC0, 0x4B, 0xC0, 0x2B, 0x40, 0x53, 0x40, 0x9B,
+  0x40, 0x67, 0x40, 0x1F, 0x40, 0x0B, 0x40, 0x2B, 0x01, 0x52, 0x52, 0x9F,
+  0xFF, 0x30, 0x0C, 0x40, 0x0B, 0x42, 0x53, 0x40, 0x1B, 0x40, 0x33, 0x40,
+  0x6F, 0x40, 0xA3, 0x40, 0x2F, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x43, 0x40,
+  0x97, 0x40, 0x3B, 0x40, 0x0F, 0xC0, 0x1B, 0x40, 0x6B, 0x40, 0x0F, 0xE0,
+  0x03, 0x03, 0xE0, 0x03, 0x13, 0x40, 0x4B, 0x40, 0x1B, 0x40, 0x5F, 0xC0,
+  0x33, 0x40, 0x07, 0xC0, 0x5F, 0x40, 0x73, 0xC0, 0x23, 0x40, 0x17, 0x40,
+  0x93, 0x40, 0x2F, 0xE0, 0x03, 0x03, 0xC0, 0x73, 0xE0, 0x03, 0x13, 0x40,
+  0x2B, 0x40, 0x0F, 0x40, 0x93, 0x40, 0x07, 0xC0, 0x0F, 0x40, 0x4B, 0x40,
+  0x5B, 0x40, 0x07, 0x40, 0x17, 0x40, 0xDB, 0x40, 0x07, 0xE0, 0x0F, 0x03,
+  0x40, 0xD7, 0xE0, 0x03, 0x5F, 0x40, 0x0F, 0x44, 0x0F, 0x40, 0x07, 0xC0,
+  0x33, 0x40, 0x0B, 0x40, 0x4F, 0x41, 0x8B, 0x40, 0x67, 0x40, 0x0B, 0x40,
+  0x57, 0x40, 0x7B, 0x40, 0x1B, 0x40, 0x27, 0x40, 0x43, 0x40, 0x77, 0x40,
+  0x17, 0xC0, 0x0F, 0x40, 0x1B, 0x40, 0x23, 0x41, 0x0F, 0x43, 0x73, 0x40,
+  0x23, 0x40, 0x1B, 0xC0, 0x03, 0xC0, 0x1F, 0x40, 0x07, 0x40, 0x53, 0x41,
+  0x0B, 0x40, 0x1B, 0x40, 0x33, 0xC0, 0x2B, 0x40, 0x17, 0x40, 0x77, 0x40,
+  0x5B, 0x40, 0x13, 0x40, 0x03, 0x40, 0x2F, 0x40, 0x07, 0x40, 0x13, 0x40,
+  0x8F, 0x41, 0x5B, 0x40, 0x3B, 0x40, 0x0B, 0x40, 0x3F, 0xE0, 0x0F, 0x03,
+  0x40, 0x9B, 0x40, 0x4F, 0xE0, 0x0F, 0x27, 0x40, 0x53, 0xC0, 0x3B, 0xC0,
+  0x0B, 0x40, 0x57, 0x40, 0x00, 0xE3, 0xD6, 0xFE, 0x63, 0xFF, 0xE0, 0xFF,
+  0xFF, 0xFF, 0x16, 0x00, 0x23, 0x22, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3,
+  0x00, 0x44, 0xEB, 0xE0, 0xFF, 0xFF, 0xFF, 0x12, 0x03, 0xE0, 0xD7, 0x00,
+  0xEC, 0xFF, 0xFF, 0xFF, 0x16, 0x02, 0xC7, 0x13, 0xE0, 0xCF, 0x00, 0x20,
+  0xE1, 0xE0, 0xFF, 0xFF, 0xFF, 0x18, 0x00, 0x02, 0xC6, 0xC6, 0xC6, 0xE4,
+  0xD3, 0x03, 0xE3, 0x04, 0xFC, 0x40, 0xEB, 0xE0, 0xFF, 0xFF, 0xFF, 0x0A,
+  0x03, 0x58, 0x87, 0x40, 0x03, 0x28, 0x00, 0x40, 0x03, 0xE0, 0xC7, 0x00,
+  0xE3, 0x00, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x0A, 0xF7, 0xC3, 0x0F, 0x43,
+  0xFB, 0x40, 0x03, 0x23, 0xF8, 0x40, 0x03, 0xE0, 0xC7, 0x00, 0xE3, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0xFF, 0x28, 0xE8, 0xE0,
+  0xFF, 0xFF, 0xEA, 0x03, 0x02, 0x8B, 0x8B, 0x8B, 0xEB, 0x00, 0xF7, 0xEB,
+  0xF7, 0xFF, 0x43, 0xFF, 0x03, 0x28, 0x28, 0x28, 0xEB, 0xE0, 0xFF, 0xFF,
+  0xE5, 0x03, 0x4F, 0x0C, 0xC3, 0xF7, 0xC0, 0x07, 0x4F, 0xFB, 0x40, 0x03,
+  0x43, 0x0F, 0x20, 0x03, 0xE0, 0xC7, 0x00, 0x40, 0xF2, 0x60, 0x00, 0xC0,
+  0xEF, 0xC0, 0x07, 0x20, 0xE8, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0x03, 0x55, 0x55, 0x55, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xED, 0x00, 0x02, 0xC6, 0xC6, 0xC6, 0xE0, 0x04, 0x03, 0x43,
+  0x07, 0x40, 0x03, 0x02, 0x00, 0x00, 0x00, 0x40, 0x03, 0xE0, 0xC7, 0x00,
+  0xE3, 0x00, 0xE2, 0xE0, 0x07, 0xF7, 0xE0, 0xFF, 0xFF, 0xFF, 0x02, 0x0F,
+  0x43, 0xFB, 0x40, 0x03, 0x23, 0xF8, 0x40, 0x03, 0xE0, 0xC7, 0x00, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
+  0xFF, 0x4B, 0xF7, 0xC0, 0x03, 0x2B, 0xF8, 0x40, 0x03, 0xE0, 0xCB, 0x00,
+  0x6F, 0xEB, 0xC0, 0xE7, 0xE0, 0xFF, 0xFF, 0xFF, 0x12, 0x07, 0x23, 0xF8,
+  0x40, 0x03, 0xE0, 0xCF, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0x13, 0xF7, 0x47,
+  0x0F, 0x23, 0xF4, 0x40, 0x03, 0xE0, 0xD7, 0x00, 0x40, 0xE3, 0xE0, 0xFF,
+  0xFF, 0xFF, 0x12, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const BakedTexture interfaceBakedTexture = { 256, 256, 4, 262144, 24977, interfaceBakedTextureData };
+
+static const unsigned char playerBakedTextureData[2537] = {
+  0x21, 0x00, 0x00, 0xE0, 0x15, 0x01, 0x03, 0x2A, 0x1D, 0x0D, 0xFF, 0x40,
+  0x03, 0x02, 0x24, 0x18, 0x08, 0x60, 0x07, 0xC0, 0x0B, 0x40, 0x0F, 0x06,
+  0x1F, 0x10, 0x0B, 0xFF, 0x75, 0x47, 0x2F, 0xE0, 0x14, 0x03, 0xE0, 0x15,
+  0x5D, 0xE0, 0x99, 0x00, 0xC0, 0xEF, 0x02, 0x2F, 0x1F, 0x0F, 0x60, 0x03,
+  0xC0, 0x0F, 0x40, 0xFF, 0x40, 0x03, 0x40, 0xFF, 0x06, 0x6A, 0x40, 0x30,
+  0xFF, 0x86, 0x53, 0x34, 0xE0, 0x00, 0x07, 0x40, 0x0B, 0x40, 0x17, 0x40,
+  0x03, 0xE0, 0x99, 0xE1, 0xE0, 0x15, 0x00, 0x40, 0xEF, 0xC0, 0xFB, 0x02,
+  0x26, 0x1A, 0x0A, 0xE0, 0x10, 0xFF, 0x02, 0x23, 0x23, 0x23, 0xE0, 0x04,
+  0x03, 0x41, 0x13, 0xE0, 0xBB, 0xFF, 0x41, 0xE3, 0x40, 0xFF, 0x41, 0x07,
+  0x40, 0x0B, 0x40, 0x07, 0x40, 0x03, 0xC0, 0x13, 0x40, 0xE3, 0x40, 0xEB,
+  0xE0, 0xCF, 0xFF, 0xE0, 0x03, 0xEB, 0x41, 0xFF, 0x40, 0x03, 0x40, 0xFB,
+  0x40, 0x03, 0x40, 0x1B, 0xE0, 0xDB, 0xFF, 0x40, 0xE7, 0x40, 0xF7, 0x40,
+  0x03, 0x40, 0xF7, 0xC0, 0x03, 0x40, 0x17, 0xE0, 0x0F, 0xFF, 0x02, 0x52,
+  0x28, 0x26, 0x60, 0x1B, 0xE3, 0x15, 0x5D, 0xE0, 0x99, 0x00, 0x40, 0xE3,
+  0xC0, 0xF7, 0x02, 0x29, 0x1C, 0x0C, 0x60, 0x0B, 0x45, 0xF7, 0x41, 0x03,
+  0x40, 0x1B, 0xC0, 0xFF, 0x43, 0x03, 0xE0, 0x07, 0x03, 0x40, 0x1B, 0xE0,
+  0x99, 0xE1, 0xE0, 0x15, 0x00, 0x40, 0xE3, 0xC0, 0xF7, 0x41, 0x07, 0xC0,
+  0x03, 0x40, 0x17, 0x40, 0x03, 0x40, 0xE3, 0xE0, 0x13, 0x03, 0xE0, 0x15,
+  0x5D, 0xE0, 0x79, 0x00, 0x03, 0x28, 0x1B, 0x0A, 0xFF, 0x40, 0x03, 0x40,
+  0xD7, 0x02, 0x27, 0x1B, 0x0B, 0x60, 0xEB, 0x05, 0x32, 0x23, 0x10, 0xFF,
+  0x2D, 0x20, 0x80, 0x03, 0x05, 0x2F, 0x20, 0x0D, 0xFF, 0x2B, 0x1E, 0x84,
+  0xEF, 0x02, 0x28, 0x1C, 0x0B, 0x65, 0x03, 0x40, 0x2B, 0x40, 0x13, 0x40,
+  0xFF, 0xC0, 0x27, 0x40, 0x33, 0x41, 0x27, 0x40, 0x43, 0x40, 0x1F, 0x40,
+  0x53, 0x40, 0x03, 0x40, 0x23, 0x40, 0x03, 0xE5, 0x03, 0x3B, 0x40, 0x0B,
+  0x40, 0x03, 0x42, 0x47, 0xE1, 0x77, 0x01, 0x40, 0xA3, 0x40, 0x03, 0x40,
+  0xB3, 0x40, 0x03, 0x02, 0x2C, 0x1E, 0x0E, 0x60, 0xC7, 0x40, 0xDF, 0x02,
+  0x33, 0x24, 0x11, 0x60, 0x07, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x0F, 0x06,
+  0x42, 0x2A, 0x12, 0xFF, 0x3F, 0x2A, 0x15, 0x60, 0x27, 0x00, 0x28, 0x21,
+  0x0F, 0x40, 0x13, 0x40, 0x1B, 0x40, 0xFB, 0x40, 0x3B, 0x40, 0x43, 0x40,
+  0x03, 0x40, 0x53, 0x40, 0x03, 0xC0, 0xFB, 0x43, 0x2F, 0x40, 0x03, 0xC0,
+  0x0F, 0x40, 0xFF, 0x40, 0x03, 0xE0, 0x77, 0xFF, 0x60, 0xB3, 0x00, 0x18,
+  0x81, 0xB3, 0x40, 0xC3, 0x00, 0x2B, 0x20, 0xFF, 0x00, 0x28, 0x22, 0x07,
+  0x01, 0x24, 0x18, 0xC0, 0x0F, 0x10, 0x0D, 0xFF, 0xB6, 0x89, 0x6C, 0xFF,
+  0xBD, 0x8E, 0x72, 0xFF, 0xC6, 0x96, 0x80, 0xFF, 0xBD, 0x8B, 0x72, 0x20,
+  0x0B, 0x08, 0x74, 0xFF, 0xAC, 0x76, 0x5A, 0xFF, 0x34, 0x25, 0x12, 0x60,
+  0x33, 0x40, 0x2B, 0x40, 0x33, 0x40, 0x3B, 0x40, 0x43, 0x40, 0xFF, 0x40,
+  0x53, 0x40, 0x5B, 0x40, 0xEF, 0x40, 0xF7, 0x40, 0x03, 0x40, 0x17, 0x40,
+  0x0F, 0x40, 0xF7, 0xC0, 0x03, 0xE0, 0x77, 0xFF, 0x41, 0xA3, 0x01, 0x28,
+  0x1A, 0x22, 0xC7, 0x01, 0x1D, 0x0E, 0x60, 0xAF, 0x40, 0x0F, 0x42, 0xC3,
+  0x40, 0xBB, 0x0A, 0x2F, 0x22, 0x11, 0xFF, 0xAA, 0x7D, 0x66, 0xFF, 0xB4,
+  0x84, 0x6D, 0x60, 0x07, 0x0E, 0xAD, 0x80, 0x6D, 0xFF, 0x9C, 0x72, 0x5C,
+  0xFF, 0xBB, 0x89, 0x72, 0xFF, 0x9C, 0x69, 0x4C, 0x60, 0x03, 0x40, 0x23,
+  0x40, 0x2B, 0x40, 0x33, 0x40, 0x3B, 0x40, 0x0B, 0x40, 0x4B, 0x40, 0x53,
+  0x40, 0x0F, 0x40, 0xE7, 0x40, 0xFB, 0xC0, 0xF7, 0x40, 0x07, 0x40, 0x03,
+  0xC0, 0x13, 0xE0, 0x7C, 0xFF, 0xE4, 0x00, 0x03, 0x10, 0x0C, 0xFF, 0x23,
+  0x17, 0x09, 0xFF, 0x87, 0x58, 0x3A, 0xFF, 0x9C, 0x63, 0x45, 0xFF, 0x3A,
+  0x28, 0x14, 0x60, 0xFB, 0x40, 0x00, 0x06, 0x52, 0x3D, 0x89, 0xFF, 0xB5,
+  0x7B, 0x67, 0x60, 0xFB, 0x40, 0x0B, 0x40, 0x00, 0x41, 0x1B, 0x40, 0x23,
+  0x40, 0x2B, 0x40, 0x33, 0x40, 0x3B, 0x40, 0x43, 0xC0, 0x4F, 0x40, 0x07,
+  0xE0, 0x03, 0xEB, 0x41, 0xFF, 0x40, 0x03, 0x40, 0xFB, 0x40, 0x03, 0x40,
+  0x1B, 0xE0, 0x80, 0xFF, 0x22, 0x03, 0x00, 0x26, 0x23, 0x07, 0x0E, 0x2C,
+  0x1E, 0x11, 0xFF, 0x84, 0x52, 0x31, 0xFF, 0x96, 0x5F, 0x41, 0xFF, 0x88,
+  0x5A, 0x39, 0x20, 0xDB, 0x08, 0x46, 0xFF, 0xB3, 0x7B, 0x62, 0xFF, 0xB7,
+  0x82, 0x72, 0xE6, 0x00, 0xDF, 0x08, 0xBE, 0x88, 0x6C, 0xFF, 0xA2, 0x6A,
+  0x47, 0xFF, 0x80, 0x2B, 0xF3, 0x40, 0x23, 0x40, 0x2B, 0x40, 0x33, 0x40,
+  0x3B, 0x40, 0x43, 0x40, 0x4B, 0x40, 0xFB, 0x40, 0x03, 0x40, 0xE3, 0x40,
+  0x03, 0x40, 0xF7, 0x40, 0x03, 0x40, 0xF7, 0xC0, 0x03, 0x40, 0x17, 0xE0,
+  0x77, 0xFF, 0x42, 0xAF, 0x40, 0xA7, 0x42, 0xB3, 0x0A, 0x62, 0x43, 0x2F,
+  0xFF, 0x9D, 0x6A, 0x4F, 0xFF, 0x9A, 0x63, 0x44, 0xEC, 0x00, 0xC3, 0x02,
+  0x90, 0x5E, 0x43, 0x20, 0xDF, 0x04, 0x40, 0xFF, 0x77, 0x42, 0x35, 0xE0,
+  0x04, 0x03, 0x06, 0x8F, 0x5E, 0x3E, 0xFF, 0x81, 0x53, 0x39, 0x66, 0xFB,
+  0x4C, 0xEF, 0x40, 0x33, 0x40, 0x3B, 0x40, 0x43, 0x40, 0x4B, 0x40, 0x53,
+  0x40, 0x5B, 0x40, 0xE3, 0xC0, 0xF7, 0xC4, 0x1B, 0x45, 0xF7, 0x41, 0x03,
+  0x40, 0x1B, 0xE0, 0x77, 0xFF, 0x40, 0xBB, 0x40, 0x03, 0x40, 0xBF, 0x40,
+  0x07, 0x02, 0x9C, 0x67, 0x48, 0x20, 0xEF, 0x10, 0x41, 0xFF, 0x8A, 0x59,
+  0x3B, 0xFF, 0x74, 0x48, 0x2F, 0xFF, 0x6F, 0x45, 0x2C, 0xFF, 0x6D, 0x43,
+  0x2A, 0x60, 0xEB, 0x40, 0xEF, 0x06, 0x7A, 0x4E, 0x33, 0xFF, 0x83, 0x55,
+  0x3B, 0x60, 0x03, 0x40, 0x0B, 0x40, 0x23, 0x40, 0x2B, 0x02, 0x9F, 0x68,
+  0x49, 0x60, 0x3B, 0x02, 0x9A, 0x64, 0x4A, 0x80, 0x07, 0xA1, 0x43, 0x40,
+  0x53, 0x48, 0x1F, 0x41, 0x03, 0xE0, 0x03, 0x03, 0x40, 0x13, 0x40, 0x1B,
+  0xE0, 0x77, 0xFF, 0xE0, 0x07, 0x00, 0x03, 0x56, 0x49, 0xCC, 0xFF, 0xE0,
+  0x03, 0x03, 0x02, 0x28, 0x28, 0x28, 0xE0, 0x04, 0x03, 0xE0, 0x07, 0x2F,
+  0xE0, 0x08, 0x00, 0x01, 0xCC, 0xCC, 0x60, 0xDB, 0x40, 0xDF, 0xE0, 0x07,
+  0x03, 0x40, 0x1B, 0x02, 0x00, 0x60, 0x60, 0xE0, 0x15, 0x03, 0xE0, 0x17,
+  0x00, 0x01, 0xA8, 0xA8, 0x80, 0x47, 0x20, 0x67, 0x40, 0x0B, 0x4A, 0x73,
+  0x02, 0x51, 0x31, 0x25, 0xE0, 0x00, 0x07, 0xE0, 0x17, 0x3E, 0xE0, 0x17,
+  0x00, 0xE0, 0x03, 0xFB, 0x40, 0x0B, 0xE0, 0x2B, 0xFF, 0x40, 0x93, 0xE0,
+  0x0B, 0x03, 0x60, 0xB3, 0xE0, 0x37, 0xFF, 0x40, 0xF7, 0xE0, 0x02, 0x03,
+  0x40, 0x67, 0xE0, 0xF0, 0xFF, 0x22, 0x0B, 0xE0, 0x03, 0xFB, 0x41, 0x0B,
+  0xE1, 0x17, 0xDF, 0xE0, 0x17, 0x00, 0x41, 0xF3, 0xE0, 0x03, 0x03, 0xE1,
+  0x2B, 0xFF, 0xE2, 0x07, 0xF7, 0xC0, 0x0F, 0x61, 0xB7, 0xE1, 0x37, 0xFF,
+  0x20, 0xF3, 0x60, 0x47, 0x42, 0x03, 0x20, 0x0B, 0xE0, 0x37, 0xFF, 0x03,
+  0x30, 0x28, 0x72, 0xFF, 0x40, 0x03, 0x02, 0x26, 0x21, 0x5B, 0x60, 0x07,
+  0x02, 0x46, 0x3A, 0xA5, 0xE0, 0x04, 0x03, 0xE0, 0x03, 0x1B, 0x40, 0x0B,
+  0xE0, 0x03, 0x1F, 0x06, 0x3A, 0x31, 0x89, 0xFF, 0x00, 0x7F, 0x7F, 0xE0,
+  0x01, 0x03, 0x09, 0x5B, 0x5B, 0xFF, 0x00, 0x99, 0x99, 0xFF, 0x00, 0x9E,
+  0x9E, 0x65, 0x2B, 0x47, 0x23, 0x45, 0x33, 0x40, 0x03, 0x40, 0x13, 0x60,
+  0x03, 0xE0, 0x03, 0x2F, 0x40, 0x0B, 0x20, 0x2B, 0x40, 0xC7, 0xE0, 0x00,
+  0x03, 0x01, 0xAF, 0xAF, 0x80, 0x03, 0x20, 0xDB, 0x60, 0x03, 0x40, 0x23,
+  0xE0, 0x03, 0x03, 0xC0, 0x2F, 0x40, 0x27, 0x40, 0x23, 0xE0, 0x03, 0x1B,
+  0x40, 0x0B, 0x40, 0x17, 0xE0, 0x03, 0x03, 0xE0, 0x16, 0x00, 0x40, 0xD3,
+  0x40, 0xFB, 0x40, 0x03, 0x40, 0x0B, 0xE0, 0x03, 0xDF, 0x40, 0x0B, 0x40,
+  0x13, 0xC0, 0x1B, 0x40, 0x0B, 0x40, 0x13, 0xE0, 0x03, 0x03, 0x60, 0x73,
+  0x01, 0x68, 0x68, 0x80, 0x03, 0x40, 0x7F, 0x40, 0x93, 0x40, 0x03, 0x20,
+  0xA7, 0x40, 0xF7, 0x40, 0x03, 0x40, 0x0B, 0xE0, 0x00, 0x93, 0x40, 0x23,
+  0xC0, 0x2F, 0x40, 0x07, 0x40, 0x2B, 0xE0, 0x03, 0xAF, 0xC0, 0x0B, 0x40,
+  0x17, 0x40, 0x03, 0x40, 0x23, 0xC0, 0x03, 0x40, 0x3B, 0x40, 0x1F, 0x40,
+  0x17, 0x40, 0x07, 0x20, 0x63, 0x60, 0x13, 0xE0, 0x07, 0x1F, 0x40, 0x1B,
+  0xC0, 0x03, 0xE0, 0x16, 0x00, 0x40, 0xD3, 0xE0, 0x13, 0xDF, 0xE0, 0x17,
+  0x1F, 0xE0, 0x00, 0x7B, 0x40, 0x83, 0xC0, 0x9F, 0x40, 0x7B, 0x40, 0xA3,
+  0x40, 0x9F, 0x42, 0x0F, 0x40, 0x0B, 0x40, 0x13, 0x40, 0x03, 0x40, 0x27,
+  0xE0, 0x03, 0x03, 0x40, 0x13, 0xE0, 0x0F, 0x03, 0x40, 0x37, 0x40, 0x53,
+  0xC0, 0x2F, 0x40, 0x0B, 0x40, 0x13, 0xE0, 0x03, 0x2F, 0x40, 0x13, 0xE0,
+  0x03, 0x1F, 0xE0, 0x03, 0x1B, 0x40, 0x0B, 0xE0, 0x16, 0x00, 0xE0, 0x17,
+  0xDF, 0xE0, 0x17, 0x1F, 0x62, 0xF3, 0xC0, 0x7F, 0x42, 0xFF, 0x40, 0x73,
+  0xC0, 0x03, 0xC0, 0xFF, 0xC0, 0x0F, 0x40, 0x07, 0x40, 0x23, 0xE0, 0x0B,
+  0x2F, 0x41, 0x27, 0x40, 0x1F, 0x40, 0xDF, 0xE0, 0x03, 0x0B, 0xE0, 0x07,
+  0xDF, 0x40, 0x53, 0x40, 0x27, 0x40, 0x03, 0x40, 0x0B, 0xE0, 0x07, 0x1F,
+  0x40, 0x17, 0xE0, 0x03, 0x03, 0xE0, 0x16, 0x00, 0xE0, 0x17, 0xDF, 0x40,
+  0x1F, 0x40, 0x03, 0xC2, 0x23, 0x43, 0xF3, 0xE0, 0x03, 0x03, 0x60, 0xCB,
+  0x40, 0xD3, 0xC0, 0x03, 0x40, 0xBB, 0x40, 0x03, 0xC0, 0x83, 0xC0, 0x0B,
+  0x40, 0x07, 0x40, 0x03, 0xC0, 0x27, 0xC0, 0x07, 0x40, 0x27, 0xE0, 0x07,
+  0xF3, 0x40, 0x27, 0x40, 0x17, 0x20, 0x03, 0x49, 0x8B, 0xC0, 0x03, 0x00,
+  0x87, 0x29, 0x77, 0x4C, 0x73, 0xE0, 0x03, 0x03, 0x40, 0x13, 0xC0, 0x1F,
+  0x40, 0x07, 0xE0, 0x03, 0x1B, 0x40, 0x0B, 0xE0, 0x16, 0xFE, 0xE0, 0x0C,
+  0xFF, 0xC0, 0xDF, 0x43, 0xE7, 0xC0, 0xFB, 0xE0, 0x10, 0xFF, 0xC0, 0xC7,
+  0x40, 0x07, 0x41, 0xD7, 0x40, 0xBB, 0x40, 0x03, 0x20, 0xBB, 0xE0, 0x0C,
+  0xD7, 0x40, 0x23, 0x40, 0x2B, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x27, 0x40,
+  0x2F, 0x40, 0x03, 0x40, 0x0B, 0xC1, 0x0B, 0x40, 0x07, 0x20, 0x0F, 0x40,
+  0xD3, 0xC0, 0x03, 0x40, 0xEB, 0x40, 0xD3, 0x02, 0x96, 0x6F, 0x5B, 0x60,
+  0x07, 0x60, 0x0B, 0x2A, 0xAB, 0x40, 0x17, 0x40, 0x07, 0x40, 0x03, 0x40,
+  0x13, 0xE0, 0x03, 0x03, 0x20, 0xE2, 0xE0, 0x14, 0x00, 0xC0, 0xDF, 0x40,
+  0x07, 0x40, 0x03, 0x40, 0xF3, 0xE0, 0x03, 0x03, 0x40, 0x13, 0xC0, 0xFB,
+  0x40, 0x0B, 0xE0, 0x03, 0x1B, 0x40, 0x0B, 0x60, 0xC3, 0x40, 0xCB, 0x40,
+  0x03, 0x40, 0xCF, 0xC0, 0xC7, 0x20, 0xBB, 0x60, 0x0B, 0xA0, 0xC7, 0x60,
+  0x07, 0x40, 0x1B, 0x40, 0x23, 0xC0, 0x2B, 0x40, 0x0B, 0x40, 0x27, 0x40,
+  0x23, 0x40, 0x1B, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x0B, 0x40, 0x03, 0x20,
+  0x0B, 0xE0, 0x03, 0xDB, 0x40, 0x0B, 0x40, 0xDB, 0xC0, 0xFF, 0x40, 0x07,
+  0x40, 0xF3, 0x40, 0x17, 0x40, 0x07, 0x40, 0x03, 0xC0, 0x1F, 0x40, 0x1B,
+  0x40, 0x0B, 0xE0, 0x14, 0xFC, 0x20, 0x00, 0x40, 0xD3, 0xE0, 0x03, 0x03,
+  0x40, 0xD3, 0xE0, 0x03, 0x03, 0x40, 0x1B, 0xE0, 0x14, 0xFF, 0xE3, 0x07,
+  0x7F, 0xA0, 0xB7, 0x40, 0xBB, 0x60, 0x0B, 0xC0, 0xD3, 0x40, 0x07, 0x40,
+  0x1B, 0xE0, 0x03, 0x2F, 0xC0, 0xFF, 0x20, 0xE7, 0x60, 0x1B, 0x40, 0x23,
+  0xC0, 0x0B, 0x40, 0x2B, 0x20, 0x0B, 0xE0, 0x03, 0xDB, 0xC0, 0xDF, 0x40,
+  0xD7, 0x40, 0x03, 0x40, 0xE3, 0x40, 0x13, 0xC0, 0x23, 0x40, 0x07, 0x40,
+  0x17, 0xE0, 0x03, 0x03, 0x20, 0xE2, 0xE0, 0x14, 0x00, 0x40, 0xDF, 0xE0,
+  0x03, 0x03, 0xE0, 0x03, 0xFB, 0x40, 0x0B, 0xE0, 0x03, 0x1B, 0x40, 0x0B,
+  0x40, 0x13, 0xE0, 0x03, 0x03, 0xE0, 0x04, 0xCF, 0x40, 0xDB, 0x20, 0xB3,
+  0xE0, 0x00, 0x03, 0x40, 0xC3, 0xC0, 0xD3, 0x40, 0x17, 0x40, 0x0F, 0x40,
+  0x23, 0x40, 0xF7, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x17, 0xE0, 0x12, 0x03,
+  0x40, 0xD3, 0xE0, 0x03, 0xE3, 0xE0, 0x03, 0xDB, 0xC0, 0xFF, 0x40, 0x1F,
+  0x40, 0x03, 0x40, 0x2B, 0xE0, 0x03, 0x1F, 0x40, 0x0B, 0xE0, 0x14, 0xFC,
+  0x20, 0x00, 0x03, 0x3F, 0x3F, 0x3F, 0xFF, 0x40, 0x03, 0x40, 0xDB, 0x40,
+  0x03, 0xE0, 0x03, 0xDB, 0x40, 0x0B, 0x40, 0x13, 0x40, 0x03, 0x40, 0x23,
+  0x40, 0x03, 0x02, 0x6B, 0x6B, 0x6B, 0xE0, 0x04, 0x03, 0x60, 0xC3, 0xC0,
+  0xCB, 0x40, 0xCF, 0x40, 0xE3, 0xC0, 0x03, 0xC0, 0xFB, 0xC0, 0x07, 0x40,
+  0x17, 0x40, 0x23, 0x40, 0x2F, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x13, 0xC0,
+  0x03, 0x41, 0x07, 0xE0, 0x03, 0x0B, 0x20, 0x37, 0x40, 0xD7, 0x40, 0x03,
+  0x40, 0xDB, 0x40, 0x07, 0x40, 0xD3, 0xE0, 0x03, 0x03, 0x40, 0x13, 0xE0,
+  0x03, 0x03, 0x40, 0x1B, 0x41, 0x17, 0xC0, 0x07, 0x20, 0xE2, 0xE0, 0x14,
+  0x00, 0x40, 0xD3, 0xE0, 0x03, 0x03, 0xE0, 0x07, 0xDF, 0xE0, 0x03, 0x1B,
+  0x40, 0x0B, 0xE0, 0x07, 0x1F, 0x41, 0x1B, 0xC3, 0x1F, 0x40, 0x07, 0x41,
+  0x33, 0xE0, 0x07, 0x03, 0x45, 0x4F, 0xE0, 0x00, 0xDB, 0x20, 0xF3, 0x40,
+  0x27, 0x40, 0x03, 0x40, 0x3B, 0x40, 0x2B, 0x40, 0x1F, 0x40, 0x03, 0x40,
+  0xEF, 0xC0, 0xFF, 0x40, 0x0F, 0x40, 0x1B, 0xC0, 0xDB, 0xE0, 0x07, 0xFF,
+  0xC0, 0xE3, 0xC0, 0x17, 0xC0, 0x07, 0xC0, 0xF7, 0xC0, 0x07, 0xE0, 0x14,
+  0xFC, 0x20, 0x00, 0x40, 0xD3, 0xE0, 0x03, 0x03, 0xE0, 0x07, 0xDF, 0xE0,
+  0x03, 0x1B, 0x40, 0x0B, 0xE0, 0x07, 0x1F, 0x40, 0xC3, 0xC0, 0xCB, 0x40,
+  0x0B, 0x40, 0xB3, 0xE0, 0x0B, 0x03, 0x40, 0xCF, 0x40, 0xDB, 0x40, 0x23,
+  0xE0, 0x0F, 0x2F, 0xC0, 0x23, 0xE0, 0x03, 0x3F, 0xC0, 0xFF, 0xE0, 0x00,
+  0x07, 0xA5, 0xFB, 0x40, 0x07, 0x40, 0x03, 0xC0, 0xF7, 0xC0, 0x1F, 0xC0,
+  0xF7, 0xC0, 0x07, 0x20, 0xE2, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x00,
+  0xFD, 0x03, 0x3B, 0x40, 0x0B, 0xFD, 0x28, 0x3F, 0x32, 0xF3, 0x7C, 0xDB,
+  0xFC, 0x3E, 0xDF, 0xE0, 0x67, 0x00, 0x40, 0xF3, 0xE0, 0x03, 0x03, 0xE0,
+  0x28, 0xFF, 0x40, 0xF7, 0xE0, 0x02, 0x03, 0xFD, 0x37, 0xDF, 0xE0, 0x67,
+  0x00, 0xE0, 0x03, 0xFB, 0x40, 0x0B, 0xE0, 0x28, 0xFF, 0xE1, 0x03, 0xFF,
+  0x21, 0x07, 0x5F, 0xD3, 0xE1, 0x03, 0x03, 0xE0, 0x67, 0xCF, 0xE0, 0x27,
+  0x00, 0x40, 0xF3, 0xE0, 0x03, 0x03, 0xE0, 0x34, 0xFF, 0x21, 0x0B, 0xE0,
+  0x97, 0xFF, 0x54, 0xCF, 0x40, 0x03, 0xD4, 0xD3, 0xF4, 0x03, 0xBB, 0x40,
+  0x0B, 0xE0, 0x03, 0x1B, 0x40, 0x0B, 0x54, 0xE3, 0x40, 0x17, 0xC0, 0x03,
+  0x56, 0x0F, 0xE0, 0x04, 0x03, 0x20, 0xF3, 0x76, 0x2B, 0x40, 0x07, 0xDC,
+  0xDF, 0x36, 0x33, 0xE0, 0x00, 0x03, 0x57, 0x23, 0xE0, 0x03, 0x03, 0xE0,
+  0x76, 0x00, 0x40, 0xD3, 0x40, 0x03, 0xE0, 0x17, 0xFF, 0xE0, 0x0F, 0x1F,
+  0x60, 0xD7, 0x58, 0x0B, 0x40, 0x03, 0x40, 0xE7, 0x40, 0xF3, 0x40, 0xDF,
+  0x40, 0xFF, 0x40, 0x07, 0x40, 0x13, 0x40, 0x1B, 0xC0, 0x03, 0x40, 0x13,
+  0xE0, 0x03, 0x03, 0xE0, 0x76, 0x00, 0x40, 0xFB, 0x40, 0x03, 0xE0, 0x0F,
+  0xDF, 0x40, 0x1B, 0x40, 0x03, 0xE0, 0x0F, 0x1F, 0xE0, 0x04, 0xDF, 0x40,
+  0xEB, 0xE0, 0x03, 0xDB, 0x41, 0x03, 0x40, 0x13, 0xC0, 0xFB, 0x40, 0x0B,
+  0xE0, 0x03, 0x1F, 0x40, 0x0B, 0xE0, 0x76, 0x00, 0x40, 0xDB, 0x40, 0x03,
+  0xE0, 0x0F, 0xDF, 0x40, 0x1B, 0x40, 0x03, 0xE0, 0x0F, 0x1F, 0x60, 0xD3,
+  0xE0, 0x03, 0xDF, 0xC1, 0xFF, 0x40, 0xDB, 0x40, 0x0B, 0x40, 0xF3, 0xE0,
+  0x03, 0x1F, 0x40, 0x17, 0xE0, 0x03, 0x03, 0xE0, 0x76, 0x00, 0xE0, 0x03,
+  0xDB, 0x40, 0x0B, 0xC3, 0xD7, 0xC0, 0x07, 0x40, 0x13, 0x40, 0x03, 0xC0,
+  0xFF, 0x43, 0xFF, 0xE0, 0x03, 0x03, 0xD8, 0xB7, 0x40, 0x07, 0x58, 0xCB,
+  0x58, 0xB7, 0xE0, 0x03, 0x03, 0x40, 0x13, 0x40, 0x1B, 0xC0, 0x03, 0xE0,
+  0x03, 0x1B, 0x40, 0x0B, 0xE0, 0x76, 0xFE, 0xE0, 0x00, 0xFF, 0xC0, 0xDF,
+  0x40, 0xF7, 0xC0, 0xDF, 0x40, 0x0B, 0x40, 0xFB, 0x40, 0x03, 0xC0, 0x1F,
+  0xC0, 0x1B, 0xC0, 0x07, 0xC0, 0xD7, 0xC0, 0xE7, 0x40, 0xD3, 0x40, 0x03,
+  0x59, 0xDB, 0x40, 0x07, 0xC0, 0x17, 0xC0, 0x27, 0x40, 0x13, 0xE0, 0x03,
+  0x03, 0x20, 0x82, 0xE0, 0x74, 0x00, 0x40, 0xDB, 0x40, 0x03, 0xC0, 0xDF,
+  0x40, 0xF3, 0xE0, 0x03, 0x03, 0x40, 0x1B, 0x40, 0x03, 0xE0, 0x0F, 0x1F,
+  0xC0, 0xD7, 0xE0, 0x00, 0xE7, 0xFA, 0x02, 0xDF, 0x40, 0xE7, 0xE0, 0x00,
+  0x17, 0xBF, 0xFF, 0x00, 0xE8, 0x40, 0x13, 0x40, 0x23, 0x40, 0x03, 0x40,
+  0x0B, 0xE0, 0x74, 0xFC, 0x20, 0x00, 0x40, 0xDB, 0x40, 0x03, 0xE0, 0x0F,
+  0xDF, 0x40, 0x1B, 0xE0, 0x03, 0x03, 0xE1, 0x03, 0x1B, 0x40, 0x0B, 0xC0,
+  0xDF, 0xC0, 0x07, 0xC0, 0xD7, 0x40, 0xDB, 0x40, 0x03, 0x40, 0xF7, 0xC0,
+  0x03, 0x40, 0x23, 0x40, 0x13, 0xE0, 0x03, 0x03, 0x20, 0x82, 0xE0, 0x74,
+  0x00, 0xE0, 0x03, 0xDB, 0x40, 0x0B, 0x40, 0xD3, 0xE0, 0x03, 0x03, 0x40,
+  0x13, 0xE0, 0x03, 0x03, 0xE0, 0x03, 0x1B, 0x40, 0x0B, 0x40, 0xD3, 0xC0,
+  0xDF, 0x60, 0x07, 0xA1, 0xFF, 0xC0, 0xE3, 0x40, 0x13, 0xC0, 0x23, 0x40,
+  0x07, 0xC0, 0x17, 0xC0, 0x07, 0xE0, 0x74, 0xFC, 0x20, 0x00, 0x5E, 0x13,
+  0x40, 0x03, 0xC0, 0xE3, 0x40, 0xD3, 0xE0, 0x03, 0x03, 0xC0, 0x17, 0x40,
+  0x23, 0x40, 0x03, 0xFE, 0x07, 0x3F, 0x40, 0xDF, 0xE0, 0x03, 0x03, 0xC0,
+  0xD7, 0xC0, 0x07, 0x40, 0x1B, 0x40, 0xF7, 0x40, 0x07, 0x60, 0x03, 0xA1,
+  0x1F, 0xC0, 0x07, 0x20, 0x82, 0xE0, 0x74, 0x00, 0x40, 0xD3, 0xE0, 0x03,
+  0x03, 0xE0, 0x07, 0xDF, 0xE0, 0x03, 0x1B, 0x40, 0x0B, 0xE0, 0x07, 0x1F,
+  0x40, 0xD3, 0xC0, 0xDF, 0x40, 0x07, 0x40, 0xF7, 0xC0, 0xDB, 0x60, 0x0B,
+  0xA3, 0xF7, 0x40, 0x07, 0x60, 0x03, 0xE0, 0xCA, 0xFF, 0x60, 0xD7, 0xC0,
+  0xE7, 0x20, 0xDF, 0x40, 0x03, 0x60, 0xFB, 0x40, 0x0B, 0x20, 0x17, 0xE0,
+  0x04, 0x03, 0x20, 0x13, 0xC0, 0x1B, 0x40, 0x07, 0xE1, 0x32, 0xFC, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const BakedTexture playerBakedTexture = { 64, 64, 4, 16384, 2537, playerBakedTextureData };
+
+static const unsigned char terrainBakedTextureData[36787] = {
+  0x2E, 0x74, 0xB4, 0x4A, 0xFF, 0x76, 0xB6, 0x4C, 0xFF, 0x73, 0xB3, 0x49,
+  0xFF, 0x66, 0xA6, 0x3C, 0x60, 0x03, 0x0E, 0x6F, 0xAF, 0x45, 0xFF, 0x5F,
+  0x9F, 0x35, 0xFF, 0x6C, 0xAC, 0x42, 0xFF, 0x7E, 0xBE, 0x54, 0x60, 0x1F,
+  0x1E, 0x6A, 0xAA, 0x40, 0xFF, 0x67, 0xA7, 0x3D, 0xFF, 0x69, 0xA9, 0x3F,
+  0xFF, 0x61, 0xA1, 0x37, 0xFF, 0x50, 0x90, 0x26, 0xFF, 0x6D, 0xAD, 0x43,
+  0xFF, 0x7F, 0x7F, 0x7F, 0xFF, 0x74, 0x74, 0x74, 0xE0, 0x04, 0x03, 0x40,
+  0x13, 0x02, 0x8F, 0x8F, 0x8F, 0x60, 0x03, 0x02, 0x68, 0x68, 0x68, 0x60,
+  0x07, 0x40, 0x13, 0xE0, 0x0B, 0x27, 0x06, 0xB9, 0x85, 0x5C, 0xFF, 0x96,
+  0x6C, 0x4A, 0x60, 0x03, 0x02, 0x79, 0x55, 0x3A, 0x60, 0x03, 0xE0, 0x0B,
+  0x13, 0x02, 0x59, 0x3D, 0x29, 0x60, 0x1B, 0x40, 0x23, 0x40, 0x1F, 0xC0,
+  0x07, 0xE0, 0x37, 0xBF, 0x06, 0xBC, 0x98, 0x62, 0xFF, 0x9F, 0x84, 0x4D,
+  0xE0, 0x04, 0x03, 0x40, 0x13, 0x40, 0x03, 0x02, 0xB4, 0x90, 0x5A, 0x60,
+  0x17, 0x40, 0x0B, 0xE0, 0x0B, 0x03, 0x40, 0x37, 0x06, 0xC8, 0xC8, 0xC8,
+  0xFF, 0xC5, 0xC5, 0xC5, 0xE0, 0x04, 0x03, 0x40, 0x13, 0x02, 0xCD, 0xCD,
+  0xCD, 0x60, 0x03, 0x02, 0xC1, 0xC1, 0xC1, 0x60, 0x07, 0x40, 0x13, 0xE0,
+  0x07, 0x27, 0x0A, 0xA8, 0xA8, 0xA8, 0xFF, 0x87, 0x87, 0x87, 0xFF, 0x80,
+  0x80, 0x80, 0xE0, 0x04, 0x03, 0x40, 0x13, 0x02, 0x92, 0x92, 0x92, 0x60,
+  0x03, 0x02, 0x78, 0x78, 0x78, 0x60, 0x07, 0x40, 0x13, 0xE0, 0x0B, 0x27,
+  0x06, 0xDB, 0x44, 0x1A, 0xFF, 0xDF, 0x3A, 0x16, 0x60, 0x07, 0x02, 0xD1,
+  0xCD, 0xD4, 0x60, 0x07, 0x0A, 0xDF, 0x42, 0x24, 0xFF, 0xDB, 0x3B, 0x15,
+  0xFF, 0xE2, 0x4A, 0x15, 0x60, 0x0F, 0x0A, 0xE3, 0x4E, 0x24, 0xFF, 0xD1,
+  0x3D, 0x16, 0xFF, 0xD3, 0xD3, 0xD3, 0x60, 0x0F, 0x02, 0xE0, 0x4B, 0x1C,
+  0x60, 0x07, 0x40, 0x3B, 0x40, 0x03, 0x0A, 0xC9, 0x3E, 0x17, 0xFF, 0xB7,
+  0x38, 0x15, 0xFF, 0xA7, 0x34, 0x13, 0xE0, 0x2C, 0x0F, 0x40, 0x43, 0x40,
+  0x03, 0x02, 0xA8, 0x34, 0x14, 0x60, 0x07, 0x40, 0x0B, 0x40, 0x03, 0xE0,
+  0x5B, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xE0, 0x12, 0x00, 0xE0, 0x13, 0x1F,
+  0xE0, 0x13, 0x1B, 0xE0, 0x5F, 0x00, 0x07, 0x3D, 0x6D, 0xFF, 0x92, 0x26,
+  0x5C, 0xFF, 0x87, 0x40, 0x03, 0x01, 0x1F, 0x55, 0xE0, 0x01, 0x03, 0x40,
+  0x0F, 0xE0, 0x0B, 0x03, 0x40, 0x2F, 0xE0, 0x03, 0x03, 0xE0, 0x37, 0xA7,
+  0x02, 0x75, 0xB5, 0x4B, 0x63, 0xE7, 0x16, 0x8A, 0xB9, 0x5A, 0xFF, 0x81,
+  0xB0, 0x51, 0xFF, 0x83, 0xB2, 0x53, 0xFF, 0x60, 0xA0, 0x36, 0xFF, 0x68,
+  0xA8, 0x3E, 0xFF, 0x62, 0xA2, 0x38, 0x64, 0x07, 0x06, 0x93, 0xC2, 0x63,
+  0xFF, 0x90, 0xBF, 0x60, 0x64, 0x23, 0x43, 0xFB, 0x44, 0x17, 0x00, 0x67,
+  0x24, 0x0B, 0x02, 0x6B, 0xAB, 0x41, 0x63, 0xD7, 0x43, 0xDB, 0xC3, 0xEF,
+  0xE0, 0x07, 0x07, 0x43, 0xF3, 0xE0, 0x03, 0x13, 0x44, 0x0F, 0x40, 0x2F,
+  0x40, 0x03, 0x40, 0x1B, 0x43, 0xC7, 0x43, 0xFF, 0xE3, 0x03, 0xDF, 0x40,
+  0x0F, 0x42, 0xEF, 0xC0, 0x13, 0x43, 0xEF, 0x40, 0x13, 0x40, 0x2B, 0x40,
+  0x03, 0x40, 0x0B, 0x40, 0x1B, 0x40, 0x03, 0xE0, 0x0B, 0xBF, 0x40, 0x17,
+  0xE0, 0x1F, 0xBF, 0xC3, 0xD7, 0x43, 0xEB, 0x02, 0x73, 0x5E, 0x39, 0x60,
+  0x07, 0x40, 0x0B, 0x43, 0xDB, 0xE0, 0x07, 0x03, 0xC0, 0x17, 0x40, 0x07,
+  0x40, 0x37, 0x40, 0x1F, 0x43, 0xD7, 0x43, 0xC7, 0x02, 0xB0, 0xB0, 0xB0,
+  0xE0, 0x0C, 0x03, 0x02, 0xA3, 0xA3, 0xA3, 0xE0, 0x04, 0x17, 0x02, 0x9D,
+  0x9D, 0x9D, 0x60, 0x2F, 0x40, 0x33, 0x43, 0xCF, 0x40, 0xE7, 0x40, 0x0B,
+  0xE0, 0x2F, 0x3F, 0x02, 0xB5, 0x3A, 0x15, 0x60, 0x03, 0x0A, 0xC0, 0x3E,
+  0x1C, 0xFF, 0xDE, 0xE3, 0xD9, 0xFF, 0xE3, 0x54, 0x24, 0x60, 0x0F, 0x06,
+  0xB0, 0x31, 0x16, 0xFF, 0xAE, 0x2A, 0x1D, 0x60, 0x0B, 0x0A, 0xAC, 0x38,
+  0x1A, 0xFF, 0xC1, 0x3D, 0x12, 0xFF, 0xD8, 0xD0, 0xDC, 0x63, 0x97, 0x02,
+  0xB9, 0x3B, 0x14, 0x60, 0x17, 0x02, 0xB6, 0x3C, 0x11, 0x60, 0x0F, 0x02,
+  0xC1, 0x3C, 0x17, 0x63, 0xAB, 0x01, 0x91, 0x2D, 0xE0, 0x2D, 0x0F, 0x02,
+  0x8E, 0x8E, 0x8E, 0x60, 0x03, 0xC0, 0x3F, 0xE0, 0x63, 0x0F, 0x00, 0x00,
+  0x20, 0x00, 0xE3, 0x13, 0xC7, 0x40, 0x1B, 0xC0, 0x00, 0x20, 0x2A, 0xE0,
+  0x00, 0x00, 0x40, 0x13, 0xE0, 0x00, 0x0C, 0xE0, 0x72, 0x00, 0x43, 0xF3,
+  0x43, 0xE7, 0xE3, 0x03, 0xD3, 0xE0, 0x0F, 0x0B, 0x40, 0x27, 0xC0, 0x03,
+  0x40, 0x37, 0x40, 0x03, 0xE0, 0x23, 0xBA, 0x02, 0x3C, 0xBF, 0x18, 0xE0,
+  0x08, 0xF3, 0x0E, 0x8D, 0xBC, 0x5D, 0xFF, 0xA3, 0xD2, 0x73, 0xFF, 0x9C,
+  0xCB, 0x6C, 0xFF, 0x64, 0xA4, 0x3A, 0x67, 0xDF, 0x43, 0x3B, 0x02, 0x70,
+  0xB0, 0x46, 0x60, 0x03, 0x47, 0x5F, 0x0A, 0x7F, 0xBF, 0x55, 0xFF, 0x92,
+  0xC1, 0x62, 0xFF, 0x97, 0xC6, 0x67, 0x63, 0xF7, 0x02, 0x57, 0x97, 0x2D,
+  0x64, 0x23, 0x02, 0xA0, 0xCF, 0x70, 0x63, 0xC7, 0x43, 0xD3, 0x43, 0xCB,
+  0x40, 0x03, 0xE0, 0x03, 0x0B, 0x40, 0x0F, 0x43, 0xFB, 0x40, 0x07, 0x43,
+  0xEF, 0xC0, 0x03, 0x40, 0x13, 0xC0, 0x0B, 0x43, 0xDB, 0x43, 0xD3, 0x40,
+  0x03, 0x43, 0xB7, 0xE0, 0x03, 0x0F, 0x40, 0x13, 0xE0, 0x07, 0x0F, 0x40,
+  0x23, 0x40, 0x03, 0xC0, 0x17, 0x40, 0xBF, 0x40, 0x0F, 0xE0, 0x03, 0xBF,
+  0x40, 0x0F, 0x40, 0xBF, 0x40, 0x07, 0xE0, 0x07, 0xBF, 0x40, 0x13, 0xC0,
+  0xBF, 0x40, 0x0B, 0x43, 0xC7, 0x40, 0x03, 0x43, 0xCB, 0xE0, 0x03, 0x03,
+  0x43, 0xE3, 0x40, 0x03, 0x40, 0x1B, 0xC0, 0x03, 0x40, 0x0F, 0x44, 0x23,
+  0xC0, 0x0F, 0x40, 0x2F, 0x43, 0xFF, 0x43, 0xD3, 0x43, 0xE7, 0x40, 0x03,
+  0xE0, 0x03, 0x0B, 0x40, 0x0F, 0x43, 0xD7, 0x40, 0x07, 0x43, 0xE3, 0xC0,
+  0x03, 0x40, 0x13, 0x40, 0x0B, 0x43, 0xFB, 0x40, 0x03, 0xE0, 0x03, 0x33,
+  0xE0, 0x03, 0x0B, 0x40, 0x37, 0x40, 0x2B, 0x40, 0x07, 0x40, 0x2F, 0xC0,
+  0x03, 0x40, 0x13, 0x40, 0x0B, 0x40, 0x3B, 0x43, 0xFF, 0x06, 0xBC, 0x43,
+  0x22, 0xFF, 0xAE, 0x30, 0x0E, 0xE7, 0x00, 0xDF, 0x01, 0xAB, 0x40, 0x83,
+  0xF7, 0x02, 0xAA, 0x38, 0x13, 0x60, 0x1F, 0x40, 0x23, 0x40, 0x03, 0x47,
+  0xFF, 0x06, 0xD3, 0x33, 0x0C, 0xFF, 0xC2, 0x46, 0x1B, 0x60, 0x0F, 0x01,
+  0xBE, 0x46, 0x87, 0xEF, 0xE3, 0x3B, 0xFF, 0x02, 0x56, 0x56, 0x56, 0xE3,
+  0x04, 0xFF, 0x40, 0x0F, 0x22, 0x9B, 0x60, 0x03, 0x40, 0x0B, 0x44, 0x13,
+  0xC4, 0x1F, 0xE0, 0x07, 0x0F, 0x40, 0x1B, 0x40, 0x03, 0xC0, 0x1F, 0x40,
+  0x0B, 0x40, 0x03, 0xE0, 0x1B, 0x0F, 0x20, 0x63, 0x60, 0x00, 0x43, 0xCF,
+  0xE0, 0x03, 0x00, 0x60, 0x14, 0x20, 0x00, 0x40, 0x13, 0x20, 0x06, 0x60,
+  0x00, 0x40, 0x0B, 0xC0, 0x00, 0x60, 0x10, 0xE0, 0x7A, 0x00, 0x43, 0xC3,
+  0x40, 0x03, 0xC3, 0xD7, 0x40, 0x07, 0x43, 0xFF, 0x40, 0x07, 0xE0, 0x03,
+  0x03, 0x40, 0x23, 0x40, 0x17, 0x40, 0x03, 0x40, 0x0B, 0xC0, 0x03, 0xE0,
+  0x07, 0xC2, 0x43, 0xE3, 0x40, 0x03, 0xE0, 0x0B, 0x17, 0x02, 0x16, 0x87,
+  0x00, 0x60, 0x03, 0xE0, 0x03, 0x1B, 0x06, 0x56, 0x96, 0x2C, 0xFF, 0x65,
+  0xA5, 0x3B, 0x6B, 0xDF, 0x12, 0x77, 0xB7, 0x4D, 0xFF, 0x71, 0xB1, 0x47,
+  0xFF, 0x79, 0xB9, 0x4F, 0xFF, 0x5D, 0x9D, 0x33, 0xFF, 0x5B, 0x9B, 0x31,
+  0x67, 0xFF, 0x02, 0x63, 0xA3, 0x39, 0x6B, 0xEB, 0x40, 0x1F, 0x4C, 0x1B,
+  0x00, 0x6B, 0x27, 0xF7, 0x02, 0x6E, 0xAE, 0x44, 0x60, 0x23, 0x43, 0xC7,
+  0xE3, 0x03, 0xCF, 0x40, 0x0F, 0x44, 0x03, 0x40, 0x07, 0xE0, 0x03, 0x17,
+  0x44, 0x03, 0xE0, 0x07, 0x03, 0x40, 0x23, 0x47, 0xCB, 0x02, 0x6C, 0x6C,
+  0x6C, 0xE3, 0x00, 0xCF, 0x40, 0x0F, 0x43, 0x97, 0xC3, 0xFB, 0x40, 0x0F,
+  0x40, 0x03, 0x40, 0x0F, 0xC0, 0x07, 0x43, 0xFB, 0xC0, 0x0B, 0x40, 0x2B,
+  0x40, 0x3F, 0x40, 0x07, 0x40, 0x03, 0x40, 0xBF, 0x40, 0x07, 0xC0, 0x03,
+  0x4C, 0xC7, 0x40, 0x0B, 0x4C, 0xAB, 0x40, 0x07, 0x40, 0x47, 0x40, 0x07,
+  0x40, 0x03, 0x40, 0x0B, 0x02, 0x69, 0x54, 0x33, 0xE0, 0x00, 0x03, 0x43,
+  0xDB, 0xE0, 0x0F, 0x03, 0xE0, 0x03, 0x27, 0x40, 0x0B, 0xC0, 0x27, 0x43,
+  0xFF, 0xC3, 0x8F, 0x43, 0x93, 0x40, 0x03, 0x43, 0xC3, 0x40, 0x07, 0xE0,
+  0x03, 0x17, 0x43, 0xC3, 0xE0, 0x07, 0x03, 0x43, 0xBF, 0x40, 0x03, 0xE0,
+  0x03, 0x27, 0x40, 0x37, 0xE0, 0x23, 0x3F, 0x16, 0xC2, 0xB9, 0xAF, 0xFF,
+  0xC2, 0xB6, 0xAA, 0xFF, 0xBC, 0xAE, 0xAE, 0xFF, 0xD2, 0xD8, 0xD7, 0xFF,
+  0xBE, 0xB1, 0xAF, 0xFF, 0xBF, 0xB1, 0xAB, 0x60, 0x03, 0x02, 0xBC, 0xAF,
+  0xA5, 0x60, 0x07, 0x0A, 0xC4, 0xB7, 0xAC, 0xFF, 0xC9, 0xAB, 0xAC, 0xFF,
+  0xD6, 0xE0, 0xE3, 0x60, 0x0F, 0x40, 0x1F, 0x06, 0xB9, 0xAD, 0xAC, 0xFF,
+  0xCC, 0xBC, 0xB3, 0xE7, 0x38, 0xFF, 0x4B, 0xE3, 0x43, 0xA7, 0x40, 0x03,
+  0x43, 0xD7, 0xC0, 0x0F, 0x40, 0x0B, 0xC0, 0x13, 0x22, 0x6F, 0x60, 0x0B,
+  0xC0, 0x0F, 0x40, 0x07, 0xC0, 0x03, 0xC0, 0x2F, 0xE0, 0x2F, 0x0F, 0x20,
+  0x5B, 0xE0, 0x00, 0x00, 0x43, 0xDB, 0xC0, 0x0C, 0x40, 0x0B, 0xC0, 0x00,
+  0xC0, 0x13, 0x40, 0x00, 0xE0, 0x0B, 0x13, 0xE0, 0x73, 0x00, 0x43, 0xC7,
+  0x43, 0xD3, 0x40, 0x03, 0xC3, 0xEF, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0x40,
+  0x23, 0xE0, 0x07, 0x03, 0xC0, 0x2B, 0xE0, 0x07, 0xBB, 0x43, 0xFB, 0x43,
+  0xE7, 0x40, 0x17, 0x40, 0x0B, 0x40, 0x03, 0xC0, 0x0F, 0x40, 0x07, 0x02,
+  0x9A, 0x6A, 0x2E, 0x60, 0x1B, 0xC0, 0x00, 0x02, 0x82, 0xC2, 0x58, 0x63,
+  0xDF, 0x47, 0xDB, 0x43, 0xE7, 0x0A, 0x96, 0xC5, 0x66, 0xFF, 0x98, 0xC7,
+  0x68, 0xFF, 0x72, 0xA1, 0x42, 0x60, 0x0B, 0x06, 0xA4, 0xD3, 0x74, 0xFF,
+  0x55, 0x95, 0x2B, 0x67, 0xEF, 0x0A, 0x91, 0xC0, 0x61, 0xFF, 0x95, 0xC4,
+  0x65, 0xFF, 0x5E, 0x9E, 0x34, 0x68, 0x23, 0x43, 0x53, 0x43, 0xC3, 0x43,
+  0xE7, 0x40, 0x03, 0xE3, 0x07, 0xDF, 0xE0, 0x03, 0x0F, 0x40, 0x1F, 0xE0,
+  0x07, 0x03, 0x44, 0x27, 0xC3, 0xC7, 0x40, 0x07, 0x43, 0xD7, 0x43, 0x97,
+  0x40, 0x0B, 0x43, 0x9B, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x13, 0x40, 0x0B,
+  0x43, 0xE7, 0x40, 0x07, 0xE0, 0x03, 0x13, 0x40, 0x0B, 0xC0, 0x13, 0xE0,
+  0x0B, 0x3F, 0x40, 0x3B, 0xC0, 0x03, 0xE0, 0x0B, 0x3F, 0x47, 0xCB, 0x47,
+  0xC7, 0xE0, 0x03, 0x03, 0x40, 0x13, 0x40, 0x03, 0x40, 0x13, 0xC0, 0x07,
+  0x40, 0x0B, 0x43, 0xF3, 0x48, 0x03, 0xC0, 0x03, 0x40, 0x1B, 0xC3, 0xFF,
+  0x43, 0xC3, 0xE3, 0x07, 0xDF, 0xE0, 0x03, 0x0F, 0x40, 0x1F, 0xE0, 0x07,
+  0x03, 0x4F, 0xDB, 0xC3, 0xFF, 0x40, 0x1B, 0xE0, 0x03, 0x2F, 0xE0, 0x07,
+  0x0B, 0x40, 0x1F, 0xE0, 0x07, 0x03, 0x40, 0x3F, 0x01, 0xD2, 0x38, 0x8F,
+  0xFB, 0x4F, 0x6F, 0xC0, 0x03, 0x01, 0xD9, 0x3E, 0x87, 0xD7, 0x47, 0xEF,
+  0x0A, 0xE0, 0x4A, 0x22, 0xFF, 0xDB, 0x4D, 0x1F, 0xFF, 0xE4, 0x42, 0x1E,
+  0xE0, 0x00, 0x1F, 0xC0, 0x27, 0x02, 0xD2, 0xD2, 0xCC, 0x60, 0x0B, 0xE7,
+  0x37, 0xFF, 0xC0, 0x4F, 0x43, 0xCB, 0x43, 0xF7, 0x40, 0x0F, 0x40, 0x07,
+  0xE0, 0x03, 0x0F, 0x22, 0x6F, 0x60, 0x03, 0x40, 0x17, 0x40, 0x1F, 0x40,
+  0x03, 0x40, 0x1F, 0x40, 0x07, 0xC0, 0x03, 0xE0, 0x2B, 0x0F, 0x20, 0x57,
+  0xE0, 0x00, 0x00, 0xE3, 0x07, 0xDB, 0x40, 0x0F, 0x40, 0x1C, 0xE0, 0x07,
+  0x07, 0x40, 0x00, 0xC0, 0x13, 0xE0, 0x77, 0x00, 0xE3, 0x17, 0xE7, 0x43,
+  0xF7, 0x40, 0x23, 0xC3, 0xEF, 0x40, 0x07, 0x40, 0x13, 0xC0, 0x07, 0xE0,
+  0x03, 0xBF, 0x43, 0xEB, 0x43, 0xDF, 0x43, 0xE7, 0x40, 0x03, 0x40, 0x1B,
+  0x40, 0x07, 0x40, 0x03, 0x02, 0x7A, 0x53, 0x25, 0x60, 0x1B, 0xC0, 0x1F,
+  0x40, 0x1B, 0x40, 0x00, 0x00, 0x79, 0x27, 0xEB, 0x06, 0x78, 0xB8, 0x4E,
+  0xFF, 0x58, 0x98, 0x2E, 0x6F, 0xE3, 0x4F, 0xDF, 0x00, 0x76, 0x34, 0x0F,
+  0x4F, 0x57, 0x02, 0x85, 0xB4, 0x55, 0x6B, 0xEF, 0x40, 0x0B, 0x4C, 0x13,
+  0x44, 0x1F, 0x40, 0x27, 0x40, 0x0B, 0x47, 0xFF, 0x4B, 0x5B, 0xC3, 0xE3,
+  0x44, 0x07, 0xC0, 0x03, 0xC0, 0x13, 0x40, 0x07, 0x40, 0x13, 0x43, 0xE7,
+  0x40, 0x07, 0x40, 0x03, 0x40, 0x13, 0x40, 0x03, 0xC0, 0x13, 0x43, 0xBB,
+  0x43, 0x9F, 0x43, 0xC7, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x13,
+  0xC0, 0x03, 0x40, 0x13, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x07, 0xC0, 0x03,
+  0x43, 0xEF, 0x40, 0x0B, 0x40, 0x17, 0x40, 0x33, 0x40, 0x03, 0x40, 0x0F,
+  0x40, 0x07, 0x40, 0x13, 0xC0, 0x03, 0x40, 0x13, 0x40, 0x03, 0x40, 0x0F,
+  0x40, 0x07, 0xC0, 0x03, 0x40, 0x3F, 0x43, 0xD7, 0x40, 0x03, 0xE3, 0x0B,
+  0xDB, 0x40, 0x17, 0xC3, 0xEB, 0xC0, 0x07, 0x40, 0x13, 0xE0, 0x03, 0x03,
+  0x53, 0xD3, 0x43, 0xAB, 0x47, 0xB7, 0xC0, 0x03, 0x40, 0x0F, 0xC0, 0x03,
+  0x40, 0x13, 0xC7, 0xCF, 0x40, 0x0B, 0xC0, 0x17, 0x40, 0x13, 0x43, 0xFB,
+  0x00, 0x80, 0x33, 0xFB, 0x40, 0x13, 0x40, 0x1B, 0xC0, 0x03, 0x40, 0x0F,
+  0xC0, 0x03, 0x40, 0x13, 0x40, 0x2B, 0x40, 0x07, 0x40, 0x03, 0xC0, 0x17,
+  0x40, 0x13, 0x40, 0x3F, 0x43, 0x3B, 0x4B, 0xDB, 0x02, 0xC3, 0x4C, 0x26,
+  0x60, 0x07, 0x02, 0xAB, 0x30, 0x0C, 0x60, 0x07, 0x02, 0xB9, 0x36, 0x12,
+  0x63, 0xFF, 0xC0, 0x1F, 0x02, 0xB1, 0x34, 0x11, 0x60, 0x17, 0x02, 0xAE,
+  0x32, 0x08, 0x60, 0x07, 0x40, 0x33, 0x06, 0xCD, 0xDB, 0xD7, 0xFF, 0xDB,
+  0xDB, 0xDB, 0xE0, 0x00, 0x03, 0x02, 0xCE, 0xCE, 0xCE, 0xE0, 0x00, 0x0B,
+  0xC0, 0x17, 0xE0, 0x03, 0x13, 0x40, 0x0B, 0x40, 0x03, 0xE0, 0x04, 0x1B,
+  0x34, 0x7F, 0x4B, 0xAB, 0x40, 0x03, 0x47, 0xC3, 0x40, 0x0F, 0x22, 0x57,
+  0x60, 0x03, 0x40, 0x0F, 0x43, 0xEF, 0x40, 0x1B, 0x40, 0x07, 0x40, 0x03,
+  0x40, 0x1B, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x1F, 0x40, 0x2F, 0x40, 0x0B,
+  0x40, 0x03, 0xE0, 0x2B, 0x0F, 0x20, 0x4F, 0x60, 0x00, 0xE3, 0x03, 0xCF,
+  0xC0, 0x0B, 0xC0, 0x07, 0x40, 0x00, 0xE0, 0x03, 0x0B, 0x40, 0x00, 0xE0,
+  0x07, 0x0F, 0xE0, 0x0B, 0x00, 0x03, 0xF7, 0x07, 0x0F, 0xFF, 0x40, 0x03,
+  0xE0, 0x0B, 0x1B, 0xE0, 0x3F, 0x00, 0xE3, 0x03, 0xDB, 0xC3, 0xD7, 0x43,
+  0xDB, 0xC0, 0x03, 0x40, 0x1F, 0x40, 0x17, 0xE0, 0x03, 0x03, 0xE0, 0x03,
+  0x13, 0xE0, 0x03, 0x87, 0xC3, 0xE7, 0x40, 0x07, 0x40, 0x03, 0x40, 0x1B,
+  0x40, 0x07, 0x43, 0xF3, 0x40, 0x03, 0x44, 0x03, 0x40, 0x03, 0x40, 0x0B,
+  0x40, 0x1B, 0x40, 0x00, 0x47, 0xCB, 0x07, 0x86, 0xB5, 0x56, 0xFF, 0x8F,
+  0xBE, 0x5F, 0xFF, 0x4F, 0x33, 0x02, 0x72, 0xB2, 0x48, 0x63, 0xE7, 0x57,
+  0xEF, 0x4B, 0x3B, 0x50, 0x13, 0x53, 0xEB, 0x02, 0x9F, 0xCE, 0x6F, 0x68,
+  0x0F, 0x4B, 0x5F, 0x48, 0x07, 0x4C, 0x0B, 0x02, 0x79, 0xA8, 0x49, 0xE7,
+  0x00, 0xD3, 0x43, 0xDB, 0x42, 0xCB, 0x40, 0x07, 0x43, 0xDF, 0xC7, 0xEB,
+  0x40, 0x0F, 0xE0, 0x03, 0x03, 0xC0, 0x17, 0x40, 0x07, 0x44, 0x03, 0x43,
+  0x83, 0xE3, 0x03, 0x97, 0x42, 0xD3, 0xE3, 0x03, 0x9F, 0x40, 0x1F, 0x40,
+  0x0F, 0x40, 0x07, 0x40, 0x03, 0x40, 0x0B, 0x43, 0xDF, 0xC0, 0x07, 0x40,
+  0x13, 0xE0, 0x33, 0x3F, 0x47, 0xC3, 0xC0, 0x03, 0x43, 0xE3, 0xC0, 0x0B,
+  0x40, 0x07, 0xE3, 0x03, 0xE7, 0x44, 0x1F, 0x40, 0x13, 0xE0, 0x07, 0x03,
+  0x57, 0xE7, 0x47, 0x97, 0x43, 0x9B, 0xC0, 0x03, 0x43, 0xA3, 0x40, 0x13,
+  0x40, 0x03, 0xC0, 0x13, 0xC0, 0x07, 0x40, 0x13, 0xC0, 0x03, 0x00, 0x78,
+  0xB7, 0xDB, 0x40, 0x0F, 0xC0, 0x1F, 0x40, 0x07, 0xE0, 0x23, 0x3F, 0x43,
+  0x3F, 0x0A, 0xA8, 0x2D, 0x00, 0xFF, 0xBA, 0x41, 0x1F, 0xFF, 0xB2, 0x32,
+  0x07, 0x63, 0xD7, 0x02, 0xB1, 0x29, 0x0F, 0x60, 0x07, 0x10, 0xD1, 0xE2,
+  0xDF, 0xFF, 0xDD, 0x4F, 0x1F, 0xFF, 0xAC, 0x34, 0x0C, 0xFF, 0xB8, 0x40,
+  0x1A, 0xFF, 0xAF, 0x37, 0xE3, 0x43, 0xF7, 0xC0, 0x03, 0x02, 0xD6, 0xD1,
+  0xD3, 0xE3, 0x00, 0xCF, 0x22, 0x0B, 0xE0, 0x00, 0x03, 0x43, 0xE3, 0x40,
+  0x0F, 0x40, 0x07, 0x43, 0xEB, 0xC0, 0x0B, 0x40, 0x07, 0xC0, 0x03, 0x40,
+  0x17, 0x60, 0x1F, 0xA3, 0xFF, 0x43, 0xDB, 0x40, 0x03, 0xC0, 0x0F, 0x40,
+  0x27, 0x40, 0x0F, 0xE0, 0x07, 0x07, 0xC0, 0x13, 0xE3, 0x2F, 0xEF, 0xC0,
+  0x5F, 0xC0, 0x3F, 0x20, 0x5F, 0x60, 0x00, 0xC3, 0xCF, 0xE0, 0x03, 0x07,
+  0x40, 0x00, 0x40, 0x1C, 0xE0, 0x07, 0x07, 0x40, 0x00, 0xC0, 0x13, 0xE0,
+  0x0F, 0x00, 0x43, 0xF7, 0x0A, 0x91, 0x02, 0x05, 0xFF, 0xD1, 0x06, 0x09,
+  0xFF, 0xBA, 0x05, 0x0B, 0x60, 0x07, 0xE0, 0x0F, 0x2B, 0xE0, 0x33, 0x00,
+  0xC3, 0xE7, 0xE3, 0x03, 0xDF, 0xC0, 0x0B, 0xE3, 0x03, 0xE7, 0x40, 0x13,
+  0xC0, 0x2B, 0x40, 0x17, 0xC0, 0x03, 0xE0, 0x0B, 0x7B, 0xC3, 0xE3, 0xC0,
+  0x07, 0x00, 0x9A, 0x2B, 0xF3, 0x40, 0x0B, 0x44, 0x0B, 0x40, 0x2F, 0x48,
+  0x27, 0xC0, 0x0B, 0x4F, 0xCF, 0x43, 0xDF, 0x02, 0x87, 0xB6, 0x57, 0x6F,
+  0xD7, 0x44, 0x03, 0x06, 0x5C, 0x9C, 0x32, 0xFF, 0x84, 0xC4, 0x5A, 0x63,
+  0xFB, 0x43, 0xE7, 0x4C, 0x1B, 0x40, 0x23, 0x48, 0x1B, 0x40, 0x2F, 0x58,
+  0x2B, 0x44, 0x1B, 0x58, 0x17, 0x00, 0x7F, 0x3B, 0xFF, 0xC0, 0x03, 0x43,
+  0xF7, 0xE0, 0x0B, 0x03, 0x43, 0xE7, 0xE0, 0x07, 0x17, 0xC0, 0x33, 0x43,
+  0xBF, 0x43, 0xCB, 0x40, 0x07, 0x40, 0x03, 0x43, 0xDB, 0x40, 0x03, 0x40,
+  0x13, 0x40, 0x03, 0x40, 0x0B, 0x43, 0xDF, 0x40, 0x07, 0x40, 0x03, 0x40,
+  0x13, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x33, 0x40, 0x0F, 0x40,
+  0x07, 0x40, 0x03, 0x40, 0x13, 0x40, 0x03, 0x40, 0x13, 0x40, 0x03, 0x40,
+  0x0B, 0xE0, 0x13, 0x3F, 0x43, 0xD7, 0x40, 0x03, 0x4F, 0xD3, 0xE0, 0x07,
+  0x03, 0x40, 0x17, 0xC0, 0x03, 0xE0, 0x0F, 0x1B, 0x43, 0xAF, 0x44, 0xB3,
+  0x40, 0x03, 0x44, 0xFF, 0xE0, 0x0B, 0x03, 0x43, 0xE7, 0xE0, 0x07, 0x17,
+  0x40, 0x2F, 0xC0, 0x03, 0x40, 0x43, 0x40, 0x03, 0x43, 0xF7, 0xE0, 0x0B,
+  0x03, 0x00, 0x9D, 0x38, 0x33, 0xE0, 0x07, 0x17, 0x40, 0x2F, 0x40, 0x3F,
+  0x00, 0xBF, 0xAF, 0xEB, 0x40, 0x07, 0x00, 0xB9, 0x20, 0x0B, 0x06, 0xBD,
+  0xB0, 0xAD, 0xFF, 0xC8, 0xB5, 0xAE, 0x60, 0x0F, 0x50, 0x0F, 0x40, 0x17,
+  0x60, 0x03, 0x00, 0xAA, 0xA0, 0x07, 0x20, 0x23, 0x40, 0x03, 0x02, 0xC1,
+  0xB1, 0xA7, 0x60, 0x1F, 0x43, 0xC3, 0xC0, 0x03, 0x22, 0x1B, 0xE0, 0x04,
+  0x0B, 0xC0, 0x0F, 0xC0, 0x07, 0x40, 0x27, 0xE0, 0x03, 0x0B, 0x40, 0x0F,
+  0x4B, 0xB3, 0x47, 0xB7, 0xC0, 0x03, 0xC3, 0xDF, 0x40, 0x27, 0xE0, 0x03,
+  0x03, 0x40, 0x17, 0x40, 0x23, 0x40, 0x2F, 0x40, 0x17, 0x40, 0x0B, 0x40,
+  0x03, 0x40, 0x0F, 0x40, 0x07, 0xC0, 0x03, 0xE0, 0x27, 0x0F, 0xE0, 0x1B,
+  0x00, 0x20, 0x6F, 0xE0, 0x00, 0x00, 0x40, 0x2F, 0xC0, 0x0C, 0xE0, 0x03,
+  0x0B, 0xE0, 0x03, 0x00, 0x43, 0xF3, 0xC0, 0x03, 0xC4, 0x07, 0xE0, 0x03,
+  0x1F, 0xE0, 0x43, 0x00, 0xC3, 0xD7, 0xC3, 0xCF, 0x40, 0x07, 0xC3, 0xE7,
+  0x40, 0x07, 0xC0, 0x1F, 0x40, 0x0B, 0x40, 0x1B, 0x40, 0x03, 0x40, 0x0B,
+  0x40, 0x03, 0x40, 0x1B, 0xE0, 0x03, 0x8B, 0xE3, 0x03, 0xD7, 0x43, 0xEF,
+  0x43, 0xF7, 0x40, 0x13, 0x40, 0x03, 0xC0, 0x27, 0x40, 0x0B, 0x43, 0xFB,
+  0x40, 0x03, 0x40, 0x13, 0x43, 0xD3, 0x4B, 0xE7, 0x57, 0xCB, 0x02, 0x94,
+  0xC3, 0x64, 0x67, 0xE3, 0x40, 0x13, 0x43, 0xF3, 0x48, 0x17, 0x02, 0x9D,
+  0xCC, 0x6D, 0x60, 0x17, 0x5C, 0x0B, 0x48, 0x1B, 0x54, 0x2B, 0x02, 0x7D,
+  0xAC, 0x4D, 0x70, 0x03, 0x48, 0x3B, 0x43, 0xC7, 0x47, 0xCB, 0x40, 0x03,
+  0x43, 0xE7, 0x40, 0x07, 0x43, 0xEB, 0x40, 0x17, 0xC0, 0x03, 0x40, 0x13,
+  0xE0, 0x0F, 0x03, 0x43, 0x9F, 0x43, 0xA7, 0x40, 0x03, 0xC0, 0x0B, 0xC0,
+  0x07, 0x43, 0xB7, 0xC0, 0x17, 0xC0, 0x13, 0x40, 0x0F, 0x40, 0x03, 0xE0,
+  0x03, 0x1B, 0x40, 0x0F, 0x40, 0x03, 0xC0, 0x23, 0xC0, 0x07, 0xE0, 0x03,
+  0x23, 0xC0, 0x13, 0x40, 0x27, 0x40, 0x03, 0xC0, 0x1B, 0xE7, 0x07, 0xCF,
+  0x40, 0x0F, 0x43, 0xF3, 0x47, 0xFB, 0x40, 0x0B, 0x40, 0x03, 0x48, 0x17,
+  0xC0, 0x03, 0x40, 0x0F, 0xC0, 0x03, 0x40, 0x23, 0x4F, 0xFF, 0x48, 0x03,
+  0x40, 0x03, 0xDF, 0xEB, 0x4C, 0x13, 0x40, 0x17, 0xC0, 0x03, 0x40, 0x1B,
+  0xE0, 0x0B, 0x03, 0x47, 0xF7, 0x43, 0xC3, 0x40, 0x07, 0x40, 0x03, 0x43,
+  0xE7, 0x40, 0x07, 0x43, 0xEB, 0x43, 0xDF, 0xC0, 0x03, 0x40, 0x13, 0xE0,
+  0x0B, 0x03, 0x05, 0x92, 0x92, 0x92, 0xFF, 0xE1, 0x44, 0xEF, 0x01, 0xD7,
+  0x4F, 0xEF, 0x01, 0xDC, 0x42, 0x8F, 0x53, 0x09, 0xDC, 0x49, 0x1F, 0xFF,
+  0xF0, 0x58, 0x22, 0xFF, 0xE0, 0x44, 0x2F, 0xFF, 0x27, 0xA3, 0x40, 0x03,
+  0x40, 0x1F, 0x40, 0x07, 0x40, 0x03, 0x06, 0xEB, 0x57, 0x13, 0xFF, 0xC8,
+  0x35, 0x04, 0x63, 0xC3, 0x43, 0xC7, 0x40, 0x03, 0x22, 0x0F, 0x60, 0x07,
+  0xE0, 0x03, 0x0B, 0x40, 0x13, 0x40, 0x03, 0x40, 0x13, 0x40, 0x03, 0xE0,
+  0x03, 0x0B, 0x40, 0x0F, 0x40, 0x4B, 0xC0, 0x03, 0x43, 0xBB, 0xC0, 0x0B,
+  0x40, 0x27, 0xC0, 0x03, 0x43, 0xFB, 0x40, 0x17, 0x40, 0x07, 0x40, 0x03,
+  0x40, 0x17, 0x40, 0x0F, 0xE0, 0x03, 0x2F, 0xE0, 0x2F, 0x0F, 0x20, 0x4B,
+  0x60, 0x00, 0xC3, 0xCB, 0xC0, 0x07, 0x40, 0x00, 0x40, 0x0B, 0xE0, 0x17,
+  0x00, 0x40, 0x27, 0xE0, 0x0B, 0x00, 0x43, 0xF7, 0x47, 0xF7, 0x48, 0x03,
+  0x40, 0x03, 0x44, 0x0F, 0xE0, 0x0B, 0x27, 0xE0, 0x0B, 0x00, 0x06, 0xCC,
+  0xD3, 0x02, 0xFF, 0xF1, 0xF9, 0x02, 0x60, 0x2F, 0x40, 0x07, 0x02, 0xB6,
+  0xBC, 0x01, 0xE0, 0x00, 0x0F, 0xE0, 0x07, 0x00, 0x43, 0xC7, 0x40, 0x03,
+  0xE3, 0x03, 0xD7, 0x40, 0x0F, 0xE0, 0x03, 0x03, 0x43, 0xE7, 0xE0, 0x0F,
+  0x03, 0xE0, 0x03, 0x4F, 0xC3, 0xD3, 0x43, 0xF7, 0xC0, 0x03, 0x40, 0x13,
+  0xC0, 0x03, 0x44, 0x13, 0x40, 0x2F, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x00,
+  0x47, 0xDF, 0x43, 0xDB, 0x02, 0xA1, 0xD0, 0x71, 0x73, 0xCF, 0x06, 0x6C,
+  0xAC, 0x42, 0xFF, 0x82, 0xB1, 0x52, 0x63, 0xF3, 0x02, 0x60, 0xA0, 0x36,
+  0x67, 0xF7, 0x4B, 0xF3, 0x43, 0xFB, 0x02, 0x89, 0xC9, 0x5F, 0x6F, 0xF7,
+  0x44, 0x13, 0x48, 0x07, 0x44, 0x27, 0x43, 0xE3, 0x43, 0xEF, 0xE0, 0x0B,
+  0x03, 0x40, 0x1B, 0x44, 0x13, 0x40, 0x07, 0x40, 0x03, 0xE0, 0x03, 0x23,
+  0x44, 0x0F, 0x40, 0x13, 0x43, 0x97, 0x40, 0x03, 0xC3, 0x8F, 0xC3, 0x9B,
+  0xE0, 0x03, 0x0F, 0x40, 0x13, 0xC0, 0x03, 0x47, 0xE3, 0x40, 0x03, 0x40,
+  0x0F, 0x40, 0x37, 0xC0, 0x03, 0xE0, 0x03, 0x2F, 0x40, 0x0B, 0x40, 0x03,
+  0x40, 0x23, 0xE0, 0x07, 0x03, 0x40, 0x3B, 0x40, 0x03, 0x40, 0x17, 0x40,
+  0x3B, 0x43, 0xC3, 0xE0, 0x07, 0x03, 0x43, 0xDF, 0xC3, 0xEF, 0xE0, 0x03,
+  0x1B, 0x44, 0x17, 0x40, 0x1B, 0xE0, 0x03, 0x13, 0x43, 0xE3, 0x43, 0xAF,
+  0xE0, 0x0B, 0x03, 0x43, 0xBF, 0x00, 0x9D, 0x27, 0xBB, 0x40, 0x07, 0x40,
+  0x03, 0xE0, 0x03, 0x23, 0x43, 0xCF, 0x43, 0xFB, 0x40, 0x03, 0xE0, 0x03,
+  0x17, 0xE0, 0x03, 0x0B, 0x40, 0x33, 0xE0, 0x17, 0x3F, 0xCB, 0xCB, 0x40,
+  0x07, 0x00, 0xCA, 0x2B, 0xCF, 0x02, 0xE0, 0x3A, 0x22, 0x60, 0x0B, 0x02,
+  0xB3, 0x3B, 0x18, 0x60, 0x07, 0x0E, 0xBB, 0x41, 0x18, 0xFF, 0xB8, 0x47,
+  0x11, 0xFF, 0xBB, 0x35, 0x16, 0xFF, 0xD1, 0xCC, 0xCF, 0x63, 0x67, 0x02,
+  0xBD, 0x3F, 0x20, 0x60, 0x1B, 0x40, 0x33, 0x43, 0xC3, 0x02, 0xAF, 0xAF,
+  0xAF, 0x60, 0x03, 0x22, 0x0F, 0xE0, 0x00, 0x0F, 0xC0, 0x0B, 0x40, 0x1F,
+  0xE0, 0x07, 0x0B, 0xC0, 0x2F, 0x40, 0x1B, 0x43, 0xB7, 0x4B, 0x8B, 0x43,
+  0xD7, 0x40, 0x03, 0x40, 0x2B, 0xE0, 0x0B, 0x03, 0x40, 0x23, 0x47, 0xE3,
+  0x40, 0x1B, 0x40, 0x27, 0xC0, 0x0F, 0xC0, 0x3F, 0xE0, 0x2F, 0x0F, 0x20,
+  0x4F, 0x60, 0x00, 0x43, 0xE7, 0x60, 0x08, 0x20, 0x00, 0x40, 0x0B, 0xC0,
+  0x00, 0x20, 0x0E, 0x60, 0x0F, 0x20, 0x06, 0x60, 0x00, 0x40, 0x17, 0x60,
+  0x08, 0x20, 0x00, 0xE0, 0x03, 0x0B, 0xE0, 0x07, 0x00, 0x43, 0xEF, 0x43,
+  0x27, 0x01, 0x10, 0x63, 0x60, 0xCF, 0xE0, 0x28, 0x00, 0x44, 0x03, 0x40,
+  0x03, 0x43, 0xFF, 0x01, 0x8E, 0x93, 0xE0, 0x11, 0x43, 0xE3, 0x0F, 0xD7,
+  0x44, 0x0F, 0xE0, 0x03, 0x03, 0x44, 0x0F, 0xC0, 0x0F, 0x40, 0x0B, 0xC0,
+  0x03, 0xE0, 0x07, 0x98, 0x40, 0xB3, 0x43, 0xFB, 0x43, 0xEB, 0x40, 0x07,
+  0x40, 0x03, 0xC0, 0x13, 0x40, 0x0B, 0xC0, 0x03, 0x48, 0x07, 0x40, 0x3B,
+  0x06, 0x7B, 0xBB, 0x51, 0xFF, 0x88, 0xB7, 0x58, 0x6B, 0xE7, 0x50, 0x03,
+  0x44, 0x0B, 0x48, 0x0B, 0x53, 0xDF, 0x47, 0xE7, 0x0A, 0xAA, 0xD9, 0x7A,
+  0xFF, 0x59, 0x99, 0x2F, 0xFF, 0x87, 0xC7, 0x5D, 0x70, 0x17, 0x43, 0xF7,
+  0x53, 0xFF, 0x01, 0x66, 0xA6, 0x9F, 0xFF, 0x08, 0x28, 0x43, 0xC3, 0x40,
+  0x03, 0x43, 0xCF, 0xC3, 0xDF, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x0F, 0x43,
+  0xFF, 0x40, 0x07, 0x40, 0x0F, 0xC0, 0x03, 0x40, 0x2F, 0xC0, 0x03, 0x43,
+  0x83, 0x40, 0x03, 0x43, 0x8F, 0x43, 0x97, 0x40, 0x03, 0xC0, 0x0B, 0x40,
+  0x17, 0x43, 0xC7, 0x40, 0x13, 0x40, 0x03, 0x40, 0x17, 0x40, 0x13, 0x40,
+  0x03, 0x43, 0x37, 0xE0, 0x03, 0x0F, 0x40, 0x0B, 0x40, 0x23, 0x40, 0x03,
+  0xC0, 0x0B, 0x40, 0x27, 0xE0, 0x17, 0x3F, 0x43, 0xCF, 0xC3, 0xEB, 0x40,
+  0x07, 0x40, 0x0F, 0x40, 0x03, 0xE3, 0x03, 0xE3, 0x40, 0x0B, 0x40, 0x1B,
+  0xE0, 0x07, 0x03, 0x40, 0x17, 0x43, 0xFF, 0x43, 0xA7, 0x43, 0xCF, 0xC3,
+  0xBB, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x0F, 0x00, 0x9D, 0x23, 0xFF, 0x40,
+  0x07, 0x40, 0x0F, 0xC0, 0x03, 0x40, 0x2F, 0x40, 0x03, 0x40, 0xC3, 0x40,
+  0x03, 0x40, 0x0B, 0x40, 0x1B, 0x40, 0x27, 0x40, 0x03, 0x40, 0x0B, 0x40,
+  0x03, 0x40, 0x0B, 0xE0, 0x17, 0x3F, 0x01, 0xB3, 0x47, 0xBF, 0xCB, 0x2F,
+  0xDF, 0x02, 0xDA, 0xE0, 0xE0, 0x63, 0x4F, 0x43, 0xD7, 0x02, 0xB2, 0x1F,
+  0x17, 0x60, 0x07, 0x06, 0xB7, 0x2C, 0x09, 0xFF, 0xB4, 0x3F, 0x21, 0x60,
+  0x0B, 0x02, 0xCC, 0xD3, 0xD5, 0xE0, 0x00, 0x1F, 0x01, 0xB7, 0x42, 0x80,
+  0x27, 0xE3, 0x03, 0xCB, 0xE0, 0x0B, 0x0B, 0x40, 0x13, 0x43, 0xE7, 0x40,
+  0x07, 0x40, 0x03, 0xE0, 0x03, 0x0B, 0x40, 0x0F, 0xE3, 0x0B, 0xBF, 0x22,
+  0x57, 0xE0, 0x04, 0x03, 0x43, 0xDB, 0x43, 0xF3, 0xC3, 0xFF, 0x40, 0x0F,
+  0x40, 0x03, 0x40, 0x0F, 0xE0, 0x0B, 0x3F, 0x40, 0x1B, 0x40, 0x03, 0xE0,
+  0x1B, 0x1F, 0x20, 0x6B, 0x60, 0x00, 0xE3, 0x03, 0xCB, 0xC0, 0x0B, 0xC0,
+  0x07, 0x40, 0x00, 0xC0, 0x0B, 0xE0, 0x07, 0x07, 0xE0, 0x13, 0x00, 0x02,
+  0x5B, 0x45, 0x36, 0xE0, 0x00, 0x5F, 0xE0, 0x23, 0x00, 0x43, 0xF3, 0x40,
+  0x03, 0x47, 0xF7, 0x43, 0xFB, 0x40, 0x03, 0x44, 0x0B, 0xE0, 0x0B, 0x43,
+  0x43, 0xFF, 0x43, 0xCB, 0xC3, 0xDB, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x03,
+  0x40, 0x0B, 0x40, 0x03, 0x40, 0x23, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x17,
+  0x40, 0x0B, 0xC0, 0x03, 0xE0, 0x03, 0x53, 0x43, 0xD3, 0x43, 0xEB, 0x43,
+  0xFB, 0x40, 0x17, 0xE0, 0x03, 0x0F, 0x40, 0x13, 0xC0, 0x0F, 0x40, 0x1B,
+  0x40, 0x27, 0x40, 0x03, 0x53, 0xDF, 0x4B, 0xEB, 0x43, 0xCF, 0x02, 0x8D,
+  0xBC, 0x5D, 0x64, 0x07, 0x40, 0x13, 0x47, 0xEF, 0x02, 0x69, 0xA9, 0x3F,
+  0x60, 0x0F, 0x40, 0x0B, 0x48, 0x17, 0xDF, 0xFF, 0x00, 0x10, 0x4F, 0xFB,
+  0x02, 0x5D, 0x9D, 0x33, 0x74, 0x23, 0x43, 0xDF, 0xC3, 0xCB, 0x40, 0x07,
+  0x43, 0xEB, 0x40, 0x07, 0xC0, 0x03, 0xE3, 0x0B, 0xF3, 0xC0, 0x13, 0x40,
+  0x3B, 0x43, 0xA3, 0x43, 0xAF, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x03, 0xC3,
+  0xC3, 0x40, 0x0B, 0x5B, 0xB3, 0x40, 0x07, 0x40, 0x03, 0x40, 0x23, 0x43,
+  0xCF, 0xE0, 0x0B, 0x0B, 0x40, 0x1B, 0x40, 0x17, 0x40, 0x03, 0xE0, 0x23,
+  0x3F, 0x47, 0xD3, 0x4F, 0xDB, 0x40, 0x07, 0x40, 0x03, 0x40, 0x0B, 0xC0,
+  0x03, 0x40, 0x0F, 0xE0, 0x07, 0x03, 0xC0, 0x1B, 0x40, 0x07, 0x40, 0x1B,
+  0x4B, 0xF3, 0x43, 0xBF, 0xC0, 0x03, 0x43, 0xB3, 0xC0, 0x0B, 0x40, 0x07,
+  0x43, 0xC7, 0x40, 0x03, 0x40, 0x0B, 0xC0, 0x03, 0x40, 0x0F, 0x40, 0x03,
+  0x50, 0x17, 0x40, 0x03, 0xC0, 0x17, 0x40, 0x07, 0xE0, 0x27, 0x3F, 0x4F,
+  0xCB, 0x40, 0x03, 0x02, 0xB6, 0xA8, 0xA9, 0x6F, 0xCF, 0x40, 0x0B, 0xE0,
+  0x0B, 0x03, 0x00, 0xBB, 0x27, 0xE3, 0x00, 0xD2, 0x37, 0xEB, 0x10, 0xC3,
+  0xAE, 0xA9, 0xFF, 0xC3, 0xB8, 0xB2, 0xFF, 0xB8, 0xB1, 0xA6, 0xFF, 0xB9,
+  0xB4, 0xA7, 0xFF, 0xB6, 0x34, 0x13, 0x0A, 0xA0, 0x31, 0x13, 0xFF, 0x8B,
+  0x2B, 0x10, 0xFF, 0x78, 0x25, 0x0E, 0xE0, 0x28, 0x0F, 0x4B, 0xC3, 0x43,
+  0xA7, 0xC0, 0x03, 0x22, 0x5B, 0x60, 0x0B, 0xE0, 0x03, 0x07, 0xE3, 0x03,
+  0xFB, 0xC0, 0x0B, 0xC0, 0x2F, 0xE0, 0x07, 0x3F, 0xE0, 0x27, 0x0F, 0x20,
+  0x67, 0xE0, 0x00, 0x00, 0x43, 0xDB, 0xC0, 0x00, 0x40, 0x14, 0x40, 0x0B,
+  0xC0, 0x07, 0xC0, 0x00, 0x40, 0x0F, 0x40, 0x00, 0x40, 0x0F, 0x40, 0x07,
+  0xE0, 0x0F, 0x00, 0x43, 0xFB, 0x43, 0x1F, 0xE0, 0x0F, 0x1F, 0xE0, 0x1B,
+  0x00, 0x40, 0x3F, 0x40, 0x03, 0xE0, 0x13, 0x2B, 0xC3, 0xC7, 0xE0, 0x2F,
+  0x07, 0xC0, 0x5B, 0xC3, 0xDB, 0x40, 0x6F, 0x40, 0x03, 0x40, 0x17, 0x40,
+  0x07, 0x40, 0x03, 0x47, 0xF3, 0x43, 0xFF, 0x40, 0x13, 0xE0, 0x03, 0x00,
+  0x40, 0x1B, 0x5F, 0xDF, 0x4C, 0x03, 0x4B, 0xCB, 0x57, 0xF3, 0x00, 0x79,
+  0x3C, 0x0F, 0x4B, 0xEF, 0x4F, 0xE7, 0x06, 0x5A, 0x9A, 0x30, 0xFF, 0x46,
+  0x86, 0x1C, 0x60, 0x0F, 0x40, 0x1B, 0x43, 0xF3, 0x02, 0x89, 0xB8, 0x59,
+  0x68, 0x27, 0x48, 0x13, 0x40, 0x23, 0x43, 0xE7, 0x43, 0xF3, 0xE0, 0x0F,
+  0x03, 0xC3, 0xEB, 0xE0, 0x0B, 0x1F, 0x40, 0x3B, 0x43, 0xB7, 0xE3, 0x03,
+  0xD3, 0x43, 0xBF, 0x40, 0x03, 0xC3, 0xC3, 0x40, 0x1F, 0xE0, 0x0B, 0x03,
+  0x40, 0x1F, 0x40, 0x03, 0x40, 0x1B, 0xE0, 0x33, 0x3F, 0x47, 0xEB, 0xE0,
+  0x07, 0x03, 0x47, 0xD7, 0x40, 0x13, 0x40, 0x07, 0xE0, 0x07, 0x03, 0x48,
+  0x03, 0x43, 0xF7, 0x40, 0x1F, 0x40, 0x03, 0x47, 0xFF, 0x43, 0xB3, 0xE0,
+  0x0F, 0x03, 0x43, 0xE7, 0x40, 0x03, 0xE0, 0x0B, 0x1F, 0x47, 0xFB, 0x40,
+  0x03, 0xE0, 0x0B, 0x1B, 0xC0, 0x13, 0x40, 0x3B, 0x40, 0x03, 0xC0, 0x0F,
+  0xE0, 0x03, 0x07, 0x40, 0x3B, 0x0A, 0xCC, 0x4E, 0x19, 0xFF, 0xDA, 0x46,
+  0x21, 0xFF, 0xE3, 0x4E, 0x21, 0x67, 0x4B, 0x47, 0x4F, 0x40, 0x03, 0x0E,
+  0xD1, 0x42, 0x12, 0xFF, 0xC9, 0xCD, 0xD1, 0xFF, 0xDB, 0x40, 0x0C, 0xFF,
+  0xDF, 0x59, 0x23, 0x60, 0x13, 0x40, 0x17, 0x00, 0xDA, 0x38, 0x27, 0x40,
+  0x07, 0x06, 0xDF, 0x44, 0x1C, 0xFF, 0xE0, 0xE2, 0xE2, 0x60, 0x0B, 0xFF,
+  0x3F, 0xFF, 0x00, 0x00, 0x43, 0xDB, 0x40, 0x5B, 0x40, 0x03, 0x40, 0x0B,
+  0x43, 0xCB, 0x40, 0x07, 0x22, 0x73, 0x60, 0x03, 0x40, 0x0B, 0x40, 0x03,
+  0x40, 0x1F, 0x40, 0x03, 0x40, 0x1F, 0x40, 0x07, 0xC0, 0x03, 0xE0, 0x2B,
+  0x0F, 0x20, 0x5B, 0xE0, 0x00, 0x00, 0x43, 0xD3, 0x40, 0x00, 0x40, 0x10,
+  0x40, 0x07, 0xC0, 0x00, 0x40, 0x0F, 0xC0, 0x00, 0xE0, 0x0B, 0x13, 0xE0,
+  0x0F, 0x00, 0x4B, 0xFB, 0x43, 0x23, 0xE0, 0x0F, 0x1F, 0xE0, 0x17, 0x00,
+  0x40, 0x3B, 0xC0, 0x43, 0x40, 0x07, 0xE0, 0x0B, 0x2F, 0x47, 0xD3, 0xE0,
+  0x13, 0x03, 0x47, 0xEF, 0xE0, 0x03, 0x03, 0xE4, 0x07, 0x27, 0xC0, 0x53,
+  0x40, 0x6B, 0x40, 0x03, 0x40, 0x0F, 0xC0, 0x07, 0x43, 0xF3, 0x43, 0xFB,
+  0x44, 0x1B, 0x40, 0x03, 0x40, 0x1B, 0xE0, 0x07, 0x00, 0x4F, 0xF7, 0x06,
+  0x92, 0xC1, 0x62, 0xFF, 0x56, 0x96, 0x2C, 0x7F, 0xFF, 0x03, 0xE8, 0x43,
+  0xE3, 0x4F, 0xF7, 0x44, 0x0F, 0x0A, 0xAD, 0xDC, 0x7D, 0xFF, 0x8B, 0xBA,
+  0x5B, 0xFF, 0xB0, 0xDF, 0x80, 0x60, 0x23, 0x4C, 0x2B, 0x02, 0x80, 0xC0,
+  0x56, 0x6B, 0xFF, 0x40, 0x33, 0x01, 0x98, 0xC7, 0x87, 0xFB, 0x43, 0xE3,
+  0x43, 0xDF, 0x40, 0x07, 0x47, 0xD3, 0x43, 0xD7, 0x40, 0x03, 0x40, 0x13,
+  0xC0, 0x03, 0x40, 0x17, 0x40, 0x0B, 0x40, 0x17, 0x40, 0x03, 0x40, 0x2B,
+  0x40, 0x03, 0x43, 0xBF, 0x43, 0xEF, 0x40, 0x07, 0x40, 0x03, 0x02, 0x74,
+  0x58, 0x44, 0x60, 0x07, 0x40, 0x13, 0x40, 0x03, 0x40, 0x13, 0x43, 0xDF,
+  0x43, 0xEB, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x0B, 0x40, 0x1B, 0x40, 0x03,
+  0x40, 0x0F, 0xC0, 0x07, 0x40, 0x0B, 0xC0, 0x23, 0x40, 0x13, 0x40, 0x03,
+  0xC0, 0x13, 0x40, 0x33, 0xC0, 0x1B, 0x40, 0x0B, 0x40, 0x1B, 0x40, 0x03,
+  0x43, 0xCF, 0x43, 0xE3, 0xE3, 0x03, 0xD3, 0x43, 0xD7, 0x40, 0x03, 0x40,
+  0x17, 0x40, 0x07, 0x40, 0x23, 0x40, 0x03, 0x40, 0x0F, 0xE0, 0x03, 0x03,
+  0x40, 0x13, 0x43, 0xFF, 0xC3, 0x9F, 0x40, 0x07, 0x4B, 0xAF, 0x47, 0xC7,
+  0x40, 0x03, 0xE3, 0x03, 0xAB, 0x40, 0x17, 0x40, 0x0F, 0x40, 0x17, 0x40,
+  0x03, 0x40, 0x2B, 0x53, 0xBF, 0x43, 0xC3, 0x40, 0x0B, 0x40, 0x1B, 0x40,
+  0x07, 0x40, 0x27, 0x40, 0x1F, 0x40, 0x03, 0x40, 0x13, 0xC0, 0x03, 0x40,
+  0x17, 0x40, 0x0B, 0x40, 0x17, 0x40, 0x03, 0x40, 0x2B, 0x40, 0x3F, 0x43,
+  0x3B, 0x4B, 0xEF, 0x05, 0xAB, 0x3B, 0x1F, 0xFF, 0xB0, 0x3C, 0x8F, 0xD3,
+  0x40, 0x0F, 0x06, 0xAC, 0x2E, 0x15, 0xFF, 0xC6, 0xCF, 0xCE, 0x60, 0x1F,
+  0x01, 0xBF, 0x33, 0x80, 0x13, 0x40, 0x17, 0x40, 0x03, 0x06, 0xB6, 0x3B,
+  0x13, 0xFF, 0xB9, 0x3B, 0x1B, 0xF4, 0x00, 0x0F, 0xE3, 0x37, 0xFF, 0x4B,
+  0xAB, 0x43, 0xD7, 0x47, 0xD3, 0x40, 0x8F, 0x40, 0x0F, 0x40, 0x03, 0xC0,
+  0x0F, 0x40, 0x1B, 0xE0, 0x13, 0x0F, 0x40, 0x1B, 0x40, 0x03, 0xC0, 0x2F,
+  0x40, 0x0B, 0x40, 0x03, 0xE0, 0x1B, 0x0F, 0xC2, 0xCF, 0x43, 0xD7, 0xE0,
+  0x03, 0x0B, 0x40, 0x00, 0xC0, 0x0F, 0x40, 0x00, 0x40, 0x0F, 0xE0, 0x03,
+  0x00, 0x40, 0x13, 0xE0, 0x1B, 0x00, 0x43, 0x4B, 0x48, 0x0B, 0xE0, 0x1B,
+  0x2B, 0xC0, 0x00, 0x43, 0xEB, 0x40, 0x37, 0x40, 0x03, 0x40, 0x0B, 0x40,
+  0x03, 0xC0, 0x1B, 0xE0, 0x07, 0x00, 0xE3, 0x07, 0xCF, 0x40, 0x0F, 0xC3,
+  0xEF, 0xE4, 0x0F, 0x17, 0xC0, 0x1F, 0x40, 0x2B, 0xE0, 0x07, 0x4F, 0xE0,
+  0x03, 0x00, 0x43, 0xFB, 0x40, 0x03, 0x44, 0x07, 0x40, 0x8B, 0xE0, 0x03,
+  0x1B, 0xC0, 0x00, 0x00, 0x8D, 0x2B, 0xF3, 0x43, 0xE3, 0x4B, 0xEB, 0x4B,
+  0xDF, 0x53, 0xDB, 0x05, 0x95, 0xC4, 0x65, 0xFF, 0x74, 0xB4, 0x3B, 0x1B,
+  0x01, 0xB3, 0x49, 0x77, 0xE3, 0x02, 0x75, 0xB5, 0x4B, 0x60, 0x03, 0x5C,
+  0x03, 0x5B, 0xF3, 0xDC, 0x2B, 0x5C, 0x07, 0x43, 0xCB, 0xC0, 0x03, 0x43,
+  0xDF, 0xE0, 0x07, 0x03, 0xC0, 0x1B, 0x43, 0xEB, 0x40, 0x03, 0x40, 0x0F,
+  0xC0, 0x23, 0x40, 0x0B, 0x43, 0x83, 0xE3, 0x03, 0xA3, 0xC0, 0x0B, 0xE0,
+  0x03, 0x07, 0x40, 0x0B, 0x40, 0x03, 0xC3, 0xBF, 0x40, 0x0B, 0x40, 0x37,
+  0xC0, 0x03, 0x40, 0x0F, 0x40, 0x1B, 0x43, 0xD7, 0xC0, 0x0B, 0xE0, 0x03,
+  0x07, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x23, 0x40, 0x07, 0x40, 0x03, 0xC0,
+  0x3B, 0x43, 0xDF, 0x40, 0x03, 0xE3, 0x03, 0xD7, 0x40, 0x0F, 0x40, 0x03,
+  0x40, 0x13, 0x40, 0x07, 0x40, 0x03, 0x40, 0x0B, 0x43, 0xEF, 0x40, 0x0B,
+  0xE0, 0x03, 0x03, 0x43, 0xFF, 0x43, 0x8F, 0x40, 0x03, 0x43, 0x9F, 0xE0,
+  0x07, 0x03, 0x40, 0x17, 0x40, 0x03, 0x43, 0xAF, 0x40, 0x03, 0x40, 0x0B,
+  0xC0, 0x23, 0x43, 0xFB, 0x40, 0x03, 0x40, 0x13, 0x40, 0x03, 0xC0, 0x17,
+  0xE0, 0x03, 0x07, 0x40, 0x17, 0x40, 0x03, 0x40, 0x3B, 0x40, 0x03, 0x40,
+  0x0B, 0xC0, 0x1F, 0x40, 0x3B, 0x43, 0x6F, 0x06, 0xA8, 0x21, 0x00, 0xFF,
+  0xBB, 0x3F, 0x23, 0x63, 0xDB, 0x43, 0xDF, 0xC0, 0x03, 0x02, 0xD3, 0xD5,
+  0xD6, 0x60, 0x1F, 0xC0, 0x0F, 0x40, 0x07, 0x02, 0xB8, 0x3B, 0x29, 0x60,
+  0x07, 0x02, 0xB1, 0x41, 0x17, 0xE3, 0x44, 0xFF, 0xE3, 0x1F, 0xAF, 0x40,
+  0xAF, 0x40, 0x2B, 0x40, 0x03, 0xE3, 0x1B, 0xDF, 0xE0, 0x17, 0x2F, 0x42,
+  0xC7, 0x43, 0xD7, 0x40, 0x07, 0xE0, 0x03, 0x00, 0x40, 0x13, 0xE0, 0x03,
+  0x00, 0xE0, 0x03, 0x1B, 0x40, 0x00, 0x40, 0x1B, 0x40, 0x07, 0xE0, 0x13,
+  0x00, 0x43, 0xF7, 0xE3, 0x13, 0xBB, 0xE0, 0x13, 0x00, 0x40, 0x37, 0x43,
+  0x73, 0x40, 0x07, 0xE0, 0x13, 0x27, 0xC3, 0xCB, 0xE3, 0x07, 0xEB, 0x43,
+  0xDB, 0xE0, 0x03, 0x03, 0xC0, 0x27, 0xC0, 0x07, 0xC0, 0x2F, 0xE0, 0x13,
+  0x5B, 0x43, 0xFB, 0x40, 0x03, 0x43, 0xFF, 0xE0, 0x0F, 0x27, 0x4B, 0xC3,
+  0x02, 0x76, 0xB6, 0x4C, 0x67, 0xD3, 0x03, 0x50, 0x90, 0x26, 0xFF, 0x5F,
+  0xF7, 0x02, 0x78, 0xB8, 0x4E, 0x63, 0xFF, 0x02, 0xA2, 0xD1, 0x72, 0x74,
+  0x07, 0x02, 0xA9, 0xD8, 0x79, 0x7F, 0xFF, 0x00, 0x14, 0x48, 0x13, 0x50,
+  0x1B, 0x02, 0x70, 0xB0, 0x46, 0x60, 0x2F, 0x02, 0x7E, 0xBE, 0x54, 0xE3,
+  0x00, 0xCB, 0xC3, 0xD3, 0x47, 0xE7, 0x43, 0xE7, 0x40, 0x03, 0x00, 0x7F,
+  0xFF, 0x02, 0xFF, 0x00, 0x1C, 0x40, 0x0B, 0xC0, 0x23, 0x40, 0x07, 0x40,
+  0x0F, 0x40, 0x03, 0x43, 0x87, 0x43, 0x8F, 0x43, 0xBB, 0x40, 0x0B, 0x40,
+  0x03, 0x40, 0x0F, 0x42, 0xDB, 0x40, 0x0B, 0xC0, 0x03, 0x40, 0x13, 0x40,
+  0x03, 0xE0, 0x03, 0x0F, 0x43, 0xCF, 0x40, 0x0F, 0x40, 0x17, 0xE0, 0x2F,
+  0x3F, 0x47, 0xF7, 0xC0, 0x03, 0x02, 0x7C, 0x62, 0x3E, 0x6F, 0xD7, 0x02,
+  0x69, 0x54, 0x33, 0xE0, 0x00, 0x0B, 0xC0, 0x1B, 0x40, 0x07, 0x40, 0x17,
+  0x02, 0x4C, 0x3D, 0x26, 0x60, 0x07, 0x40, 0x0B, 0x40, 0x13, 0x43, 0x8B,
+  0x01, 0x80, 0x80, 0xFF, 0x01, 0xF7, 0x4F, 0xCF, 0x47, 0x97, 0x40, 0x03,
+  0x40, 0xC3, 0xE0, 0x03, 0x03, 0xE0, 0x03, 0x27, 0xC0, 0x17, 0xE0, 0x03,
+  0x13, 0x40, 0x0B, 0xE0, 0x27, 0x3F, 0x00, 0xBF, 0x3F, 0xCF, 0x02, 0xC0,
+  0xB0, 0xA5, 0x2F, 0xFF, 0x04, 0xA2, 0xFF, 0xC0, 0xB4, 0xB1, 0x60, 0x0F,
+  0x02, 0xBD, 0xB6, 0xB2, 0x60, 0x07, 0x06, 0xD2, 0xD8, 0xD7, 0xFF, 0xC3,
+  0xB9, 0xA7, 0x60, 0x0B, 0x02, 0xBB, 0xAD, 0xAA, 0x60, 0x07, 0x02, 0xC5,
+  0xB6, 0xAD, 0x60, 0x07, 0x40, 0x37, 0x09, 0xC6, 0xD2, 0xD2, 0xFF, 0xC4,
+  0x3C, 0x17, 0xFF, 0xB2, 0x37, 0x90, 0x03, 0x43, 0x8F, 0xE0, 0x27, 0x0F,
+  0x01, 0xA8, 0x34, 0xEF, 0x05, 0xFF, 0xE0, 0x67, 0x0F, 0x40, 0x00, 0xE2,
+  0x0B, 0xDB, 0xE0, 0x0F, 0x17, 0xE0, 0x03, 0x00, 0xE0, 0x1B, 0x23, 0xE3,
+  0x17, 0xBF, 0xE0, 0x13, 0x00, 0xE3, 0x1B, 0xFF, 0xE3, 0x03, 0xE3, 0xE0,
+  0x03, 0x0B, 0x43, 0xDF, 0xE0, 0x03, 0x0F, 0xE0, 0x0F, 0x0B, 0xE0, 0x13,
+  0x7F, 0x43, 0xF7, 0xE3, 0x17, 0xFF, 0x03, 0xB1, 0xB1, 0xB1, 0xFF, 0xC0,
+  0x03, 0x06, 0xA6, 0xA6, 0xA6, 0xFF, 0x94, 0x94, 0x94, 0x63, 0x97, 0x06,
+  0x60, 0x60, 0x60, 0xFF, 0x5C, 0x5C, 0x5C, 0x60, 0x03, 0xC0, 0x1F, 0x40,
+  0x07, 0x02, 0x81, 0x81, 0x81, 0x60, 0x13, 0x03, 0xB4, 0xB4, 0xB4, 0xFF,
+  0x43, 0xE3, 0x06, 0x57, 0x57, 0x57, 0xFF, 0x33, 0x33, 0x33, 0xE0, 0x04,
+  0x03, 0x40, 0x13, 0x02, 0x97, 0x97, 0x97, 0x60, 0x03, 0x02, 0x07, 0x07,
+  0x07, 0x60, 0x07, 0x40, 0x13, 0xE0, 0x0B, 0x27, 0x1F, 0x9A, 0x94, 0x5C,
+  0xFF, 0xDD, 0xD7, 0xA0, 0xFF, 0xDC, 0xD6, 0x9E, 0xFF, 0xDB, 0xD5, 0x9C,
+  0xFF, 0xD6, 0xD0, 0x97, 0xFF, 0xDA, 0xD4, 0x9C, 0xFF, 0xD2, 0xCC, 0x94,
+  0xFF, 0xD8, 0xD2, 0x9A, 0xFF, 0x02, 0xE2, 0xDC, 0xA5, 0x60, 0x1F, 0x02,
+  0xD8, 0xD0, 0x9B, 0x20, 0x1B, 0x1F, 0x98, 0xFF, 0xD0, 0xC8, 0x91, 0xFF,
+  0xD3, 0xCC, 0x95, 0xFF, 0xCA, 0xC4, 0x8D, 0xFF, 0xD9, 0xD2, 0x9B, 0xFF,
+  0x5F, 0x53, 0x4E, 0xFF, 0xBF, 0xBC, 0xBC, 0xFF, 0x6A, 0x5F, 0x60, 0xFF,
+  0x9D, 0x84, 0x00, 0x82, 0x60, 0x03, 0x06, 0x96, 0x82, 0x88, 0xFF, 0x9D,
+  0x87, 0x8C, 0x60, 0x13, 0x02, 0x7D, 0x7C, 0x7E, 0x60, 0x07, 0x19, 0x9A,
+  0x8C, 0x8E, 0xFF, 0x9A, 0x8D, 0x8C, 0xFF, 0x89, 0x80, 0x7F, 0xFF, 0xA4,
+  0x98, 0x92, 0xFF, 0x74, 0x6A, 0x6C, 0xFF, 0x9A, 0x87, 0x87, 0xFF, 0x46,
+  0x39, 0x83, 0xCF, 0x1F, 0x6C, 0x57, 0x36, 0xFF, 0x9B, 0x7B, 0x4C, 0xFF,
+  0x3D, 0x30, 0x1D, 0xFF, 0x6D, 0x58, 0x37, 0xFF, 0x95, 0x75, 0x46, 0xFF,
+  0x41, 0x34, 0x21, 0xFF, 0x66, 0x51, 0x30, 0xFF, 0x68, 0x53, 0x32, 0xFF,
+  0x02, 0x67, 0x52, 0x31, 0x64, 0x13, 0x40, 0x1B, 0xC4, 0x27, 0x06, 0x9C,
+  0x7C, 0x4D, 0xFF, 0x6A, 0x55, 0x34, 0x64, 0x0B, 0x02, 0x3C, 0x2F, 0x1C,
+  0x60, 0x07, 0x44, 0x17, 0x40, 0x2B, 0x40, 0x0F, 0xC0, 0x03, 0x40, 0x13,
+  0x40, 0x27, 0x40, 0x0F, 0x02, 0x6E, 0x59, 0x38, 0x60, 0x0F, 0x40, 0x6F,
+  0x40, 0x4B, 0x02, 0x49, 0xD2, 0x30, 0x62, 0xBF, 0x0A, 0x53, 0xF3, 0x33,
+  0xFF, 0x45, 0xE5, 0x25, 0xFF, 0x1F, 0x83, 0x1F, 0x60, 0x0F, 0xC0, 0x00,
+  0x01, 0x31, 0xBA, 0xED, 0x09, 0xB7, 0x02, 0x1B, 0x7F, 0x1B, 0x60, 0x23,
+  0x12, 0x51, 0xF1, 0x31, 0xFF, 0xAA, 0xAA, 0xAA, 0xFF, 0xA7, 0xA7, 0xA7,
+  0xFF, 0xAD, 0xAD, 0xAD, 0xFF, 0xB9, 0xB9, 0xB9, 0x7F, 0xFF, 0x00, 0x7C,
+  0x08, 0xD0, 0xD0, 0xD0, 0xFF, 0xD4, 0xD4, 0xD4, 0xFF, 0xD2, 0x23, 0xDF,
+  0x02, 0xD1, 0xD1, 0xD1, 0x60, 0x0F, 0x1F, 0xD5, 0xD5, 0xD5, 0xFF, 0xD8,
+  0xD8, 0xD8, 0xFF, 0xDA, 0xDA, 0xDA, 0xFF, 0xDC, 0xDC, 0xDC, 0xFF, 0xDD,
+  0xDD, 0xDD, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xC5, 0x8B, 0x20, 0xFF, 0xC4,
+  0x87, 0x1F, 0xFF, 0x1D, 0xC9, 0x90, 0x1F, 0xFF, 0xD5, 0xA4, 0x23, 0xFF,
+  0xDD, 0xB8, 0x2C, 0xFF, 0xE6, 0xC9, 0x38, 0xFF, 0xEA, 0xD0, 0x3A, 0xFF,
+  0xEA, 0xCD, 0x38, 0xFF, 0xEB, 0xC9, 0x37, 0xFF, 0xEC, 0xC7, 0x20, 0x07,
+  0x19, 0xD2, 0x40, 0xFF, 0xEA, 0xD6, 0x44, 0xFF, 0xED, 0xD9, 0x49, 0xFF,
+  0xEF, 0xDC, 0x4E, 0xFF, 0xF0, 0xDD, 0x52, 0xFF, 0xF8, 0xE3, 0x5A, 0xFF,
+  0x6B, 0x3F, 0x7F, 0xE0, 0xB4, 0x03, 0xC1, 0x67, 0xE0, 0x6F, 0x00, 0x05,
+  0xCD, 0x00, 0x00, 0xFF, 0xFC, 0xA1, 0xA0, 0x03, 0x00, 0x57, 0x20, 0x07,
+  0x20, 0x0F, 0x40, 0x13, 0xC0, 0x03, 0x40, 0x0F, 0x60, 0x03, 0xA0, 0x1B,
+  0x40, 0x0B, 0xC0, 0x1B, 0x40, 0x07, 0x4B, 0xA7, 0x47, 0xBF, 0x4B, 0xAB,
+  0x57, 0xC3, 0x40, 0x03, 0x5B, 0xA3, 0x00, 0x5F, 0xFF, 0x1E, 0xFF, 0x23,
+  0xC0, 0x43, 0xD3, 0x40, 0x03, 0x47, 0xB7, 0x47, 0x8F, 0x02, 0x2C, 0x2C,
+  0x2C, 0x63, 0xDF, 0x40, 0x13, 0x40, 0x03, 0x44, 0x03, 0x40, 0x17, 0x02,
+  0x88, 0x88, 0x88, 0x60, 0x07, 0x0A, 0x90, 0x90, 0x90, 0xFF, 0x3A, 0x3A,
+  0x3A, 0xFF, 0x6F, 0x6F, 0x6F, 0x6E, 0x93, 0x43, 0xD7, 0x40, 0x03, 0xC3,
+  0xEF, 0xE0, 0x07, 0x07, 0x43, 0xF3, 0xE0, 0x03, 0x13, 0x44, 0x0F, 0x40,
+  0x2F, 0x40, 0x03, 0x40, 0x1B, 0x02, 0xDE, 0xD7, 0xA1, 0x63, 0xE7, 0x05,
+  0xE0, 0xD5, 0xAA, 0xFF, 0xE7, 0xDB, 0x26, 0xBF, 0x01, 0xB4, 0x88, 0x63,
+  0xFB, 0x02, 0xD0, 0xCA, 0x92, 0x63, 0xE7, 0x06, 0xC0, 0xBA, 0x82, 0xFF,
+  0xE6, 0xDA, 0xAF, 0x25, 0xAA, 0x00, 0xDF, 0x64, 0x23, 0x43, 0xFB, 0x44,
+  0x17, 0x44, 0x0B, 0x0A, 0xE9, 0xE3, 0xAB, 0xFF, 0x8F, 0x78, 0x75, 0xFF,
+  0x9A, 0x82, 0x85, 0x63, 0xF7, 0x00, 0xB9, 0x23, 0x0B, 0x0A, 0x8F, 0x7F,
+  0x85, 0xFF, 0xA6, 0x9B, 0xA0, 0xFF, 0x9A, 0x96, 0x9D, 0x63, 0xF7, 0x02,
+  0xB0, 0xAB, 0xAC, 0x60, 0x03, 0x0C, 0x6F, 0x61, 0x5D, 0xFF, 0x94, 0x8E,
+  0x89, 0xFF, 0x50, 0x49, 0x48, 0xFF, 0xA2, 0x23, 0xFF, 0x16, 0x80, 0x6D,
+  0x72, 0xFF, 0x9A, 0x89, 0x89, 0xFF, 0x3F, 0x32, 0x1F, 0xFF, 0x65, 0x50,
+  0x2F, 0xFF, 0x6F, 0x5A, 0x39, 0xFF, 0x38, 0x2B, 0x18, 0x60, 0x0F, 0x02,
+  0x98, 0x78, 0x49, 0xE3, 0x00, 0xFB, 0x02, 0x99, 0x79, 0x4A, 0x64, 0x13,
+  0x44, 0x03, 0x02, 0x9A, 0x7A, 0x4B, 0x67, 0xFF, 0x43, 0xFF, 0x48, 0x07,
+  0x44, 0x23, 0x00, 0x69, 0x28, 0x2B, 0x4C, 0x17, 0x02, 0xB1, 0x8D, 0x57,
+  0x60, 0x07, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0x02, 0xAE, 0x8A, 0x54, 0xE0,
+  0x04, 0x1B, 0x06, 0xB9, 0x95, 0x5F, 0xFF, 0xBA, 0x96, 0x60, 0x60, 0x23,
+  0x06, 0x64, 0x4F, 0x2E, 0xFF, 0x39, 0xC2, 0x20, 0x62, 0x83, 0x06, 0x62,
+  0xFF, 0x42, 0xFF, 0x4B, 0xD4, 0x32, 0x60, 0x0B, 0x02, 0x19, 0x7D, 0x19,
+  0x60, 0x07, 0x40, 0x00, 0x43, 0xEB, 0x02, 0x13, 0x77, 0x13, 0x60, 0x0F,
+  0x0A, 0x59, 0xF9, 0x39, 0xFF, 0x5A, 0xFA, 0x3A, 0xFF, 0x15, 0x79, 0x15,
+  0x60, 0x0F, 0x40, 0x27, 0x43, 0xDF, 0x02, 0xE8, 0xE8, 0xE8, 0x60, 0x03,
+  0x0A, 0xEA, 0xEA, 0xEA, 0xFF, 0xED, 0xED, 0xED, 0xFF, 0xEE, 0xEE, 0xEE,
+  0x60, 0x07, 0x40, 0x0B, 0x02, 0xEC, 0xEC, 0xEC, 0x60, 0x03, 0x40, 0x0B,
+  0x40, 0x03, 0x40, 0x0F, 0x02, 0xEB, 0xEB, 0xEB, 0x60, 0x03, 0x44, 0x1F,
+  0x16, 0xE7, 0xC8, 0x45, 0xFF, 0xFD, 0xEA, 0x64, 0xFF, 0xFE, 0xEA, 0x5F,
+  0xFF, 0xFF, 0xEE, 0x5B, 0xFF, 0xFE, 0xF5, 0x5A, 0xFF, 0xFE, 0xF7, 0x59,
+  0x20, 0x03, 0x10, 0x57, 0xFF, 0xFE, 0xF6, 0x58, 0xFF, 0xFE, 0xF4, 0x58,
+  0xFF, 0xFF, 0xF3, 0x5A, 0xFF, 0xFF, 0xF6, 0x59, 0x20, 0x03, 0x04, 0x57,
+  0xFF, 0xFF, 0xF5, 0x55, 0x20, 0x0F, 0x00, 0x51, 0x20, 0x03, 0x04, 0x4E,
+  0xFF, 0xEA, 0xCC, 0x39, 0x63, 0xFB, 0x02, 0xD6, 0x7F, 0xFF, 0xE0, 0x30,
+  0x03, 0x44, 0x3F, 0xE0, 0x73, 0x3F, 0x41, 0x63, 0xE0, 0x73, 0x00, 0x63,
+  0xD7, 0x00, 0xFC, 0x23, 0xD7, 0x40, 0x03, 0xE3, 0x06, 0xE3, 0x43, 0xEB,
+  0x60, 0x03, 0x40, 0x17, 0xE0, 0x0A, 0x1F, 0x43, 0xFF, 0x4F, 0x9B, 0x5B,
+  0x9B, 0x4F, 0x8B, 0x02, 0x81, 0xB0, 0x51, 0xFF, 0x28, 0xFF, 0x23, 0xC0,
+  0x01, 0x5A, 0x5A, 0xEF, 0x01, 0xC3, 0x06, 0x2F, 0x2F, 0x2F, 0xFF, 0x5B,
+  0x5B, 0x5B, 0x63, 0xF7, 0x43, 0xFB, 0x02, 0x83, 0x83, 0x83, 0x63, 0xA3,
+  0x06, 0x26, 0x26, 0x26, 0xFF, 0x8B, 0x8B, 0x8B, 0x63, 0xFF, 0x02, 0x38,
+  0x38, 0x38, 0x64, 0x13, 0x44, 0x17, 0x02, 0x84, 0x84, 0x84, 0x63, 0xC7,
+  0x43, 0xD3, 0x43, 0xCB, 0x40, 0x03, 0xE0, 0x03, 0x0B, 0x40, 0x0F, 0x43,
+  0xFB, 0x40, 0x07, 0x43, 0xEF, 0xC0, 0x03, 0x40, 0x13, 0xC0, 0x0B, 0x0E,
+  0xE2, 0xD6, 0xAA, 0xFF, 0xEE, 0xE2, 0xB6, 0xFF, 0xF9, 0xEE, 0xC2, 0xFF,
+  0xD6, 0xCF, 0x98, 0x27, 0xE7, 0x00, 0x99, 0x63, 0xDB, 0x02, 0xDB, 0xD5,
+  0x9D, 0x60, 0x03, 0x48, 0x17, 0x48, 0x03, 0x00, 0xE6, 0x24, 0x03, 0x0A,
+  0xE8, 0xDC, 0xB1, 0xFF, 0xC7, 0xC1, 0x89, 0xFF, 0xCF, 0xC8, 0x90, 0x64,
+  0x23, 0x0A, 0xF8, 0xEC, 0xC1, 0xFF, 0x89, 0x70, 0x6F, 0xFF, 0x74, 0x66,
+  0x68, 0x63, 0xEB, 0x09, 0xB4, 0xA5, 0xA1, 0xFF, 0xB4, 0xA6, 0xA5, 0xFF,
+  0x8F, 0x82, 0x4B, 0x17, 0x04, 0xB7, 0xFF, 0x87, 0x7C, 0x7D, 0x60, 0x17,
+  0x01, 0x50, 0x49, 0x38, 0xBF, 0x05, 0x69, 0x69, 0xFF, 0xC1, 0xBE, 0xBD,
+  0x60, 0x03, 0x02, 0x85, 0x77, 0x6E, 0x60, 0x17, 0x48, 0x33, 0x06, 0x3A,
+  0x2D, 0x1A, 0xFF, 0x5E, 0x4B, 0x2F, 0x63, 0x8B, 0x47, 0xEF, 0x43, 0xE7,
+  0x43, 0xF3, 0x02, 0x3E, 0x31, 0x1E, 0x67, 0xC7, 0x44, 0x0B, 0x00, 0x3C,
+  0x27, 0xDB, 0x47, 0xD3, 0xC3, 0xF7, 0xC0, 0x07, 0x40, 0x27, 0x40, 0x1B,
+  0x0A, 0xB6, 0x92, 0x5C, 0xFF, 0x9D, 0x82, 0x4B, 0xFF, 0x9E, 0x83, 0x4C,
+  0x70, 0x27, 0x02, 0x97, 0x7C, 0x45, 0x60, 0x07, 0x06, 0x9B, 0x80, 0x49,
+  0xFF, 0xA7, 0x8C, 0x55, 0x60, 0x0B, 0x00, 0x9F, 0xFF, 0x02, 0xFF, 0x28,
+  0x64, 0x05, 0xA2, 0x87, 0x50, 0xFF, 0xB5, 0x91, 0x31, 0x73, 0x24, 0x3B,
+  0xC2, 0x7B, 0x02, 0x41, 0xCA, 0x28, 0x60, 0x0B, 0x09, 0x25, 0x70, 0x25,
+  0xFF, 0x55, 0xF5, 0x35, 0xFF, 0x48, 0xE8, 0x80, 0x0F, 0x12, 0x44, 0xE4,
+  0x24, 0xFF, 0x50, 0xF0, 0x30, 0xFF, 0x24, 0x88, 0x24, 0xFF, 0x57, 0xF7,
+  0x37, 0xFF, 0x46, 0xCF, 0x2D, 0x60, 0x27, 0x03, 0x56, 0xF6, 0x36, 0xFF,
+  0x47, 0xFF, 0x47, 0xD7, 0x43, 0xEF, 0xC0, 0x03, 0x02, 0xEF, 0xEF, 0xEF,
+  0xE0, 0x00, 0x0B, 0xC0, 0x13, 0xE0, 0x03, 0x07, 0x43, 0xFB, 0x06, 0xE9,
+  0xE9, 0xE9, 0xFF, 0xE7, 0xE7, 0xE7, 0x63, 0xFF, 0x06, 0xE8, 0xD0, 0x45,
+  0xFF, 0xFF, 0xF8, 0x60, 0x20, 0x03, 0x03, 0x5C, 0xFF, 0xFF, 0xF9, 0x23,
+  0xF3, 0x01, 0xFC, 0x55, 0x22, 0x6B, 0x02, 0x54, 0xFF, 0xFB, 0x20, 0x07,
+  0x09, 0xFB, 0xFB, 0x56, 0xFF, 0xFB, 0xFA, 0x58, 0xFF, 0xFC, 0xF8, 0x24,
+  0x0F, 0x00, 0xFA, 0x23, 0xF7, 0x01, 0xF9, 0x4F, 0x24, 0x13, 0x0C, 0x49,
+  0xFF, 0xFB, 0xF3, 0x42, 0xFF, 0xFA, 0xF1, 0x3B, 0xFF, 0xEA, 0xCE, 0x2F,
+  0xE3, 0x78, 0xBF, 0xE4, 0x37, 0x3F, 0xC1, 0x7F, 0xE0, 0x6F, 0x00, 0x63,
+  0xDB, 0x00, 0xA1, 0x23, 0xE7, 0xA3, 0xDF, 0x43, 0xD3, 0x63, 0xF3, 0x28,
+  0x07, 0x60, 0x1B, 0xC0, 0x07, 0x40, 0x1F, 0x20, 0x27, 0xE0, 0x04, 0x1F,
+  0x20, 0x1B, 0x53, 0xBF, 0xFF, 0x33, 0xFF, 0x23, 0xC0, 0x0A, 0x71, 0x71,
+  0x71, 0xFF, 0x48, 0x48, 0x48, 0xFF, 0x32, 0x32, 0x32, 0x63, 0xD3, 0x06,
+  0xB8, 0xB8, 0xB8, 0xFF, 0x67, 0x67, 0x67, 0xEC, 0x00, 0x07, 0x43, 0xEF,
+  0x44, 0x13, 0x40, 0x07, 0x02, 0x3D, 0x3D, 0x3D, 0x60, 0x23, 0x06, 0xA9,
+  0xA9, 0xA9, 0xFF, 0xB7, 0xB7, 0xB7, 0x60, 0x17, 0x43, 0xC7, 0xE3, 0x03,
+  0xCF, 0x40, 0x0F, 0x44, 0x03, 0x40, 0x07, 0xE0, 0x03, 0x17, 0x44, 0x03,
+  0xE0, 0x07, 0x03, 0x40, 0x23, 0x05, 0xCC, 0xC7, 0x8F, 0xFF, 0xD6, 0xCE,
+  0x43, 0xF7, 0x00, 0x9B, 0x6B, 0xE7, 0x12, 0xD0, 0xC9, 0x93, 0xFF, 0xDF,
+  0xD9, 0xA1, 0xFF, 0xD1, 0xCA, 0x93, 0xFF, 0xCF, 0xC9, 0x91, 0xFF, 0xD2,
+  0xCC, 0x94, 0x24, 0x17, 0x00, 0x97, 0x6B, 0xEB, 0x44, 0x07, 0x00, 0xDA,
+  0x2C, 0x1B, 0x47, 0xFF, 0x40, 0x07, 0x08, 0xBF, 0xB8, 0x81, 0xFF, 0x89,
+  0x82, 0x82, 0xFF, 0x7B, 0x2B, 0xE3, 0x4C, 0x03, 0x06, 0xB0, 0xA5, 0xAB,
+  0xFF, 0x9F, 0x8C, 0x87, 0x6B, 0xD7, 0x02, 0x80, 0x79, 0x7B, 0x63, 0xDF,
+  0x0E, 0x88, 0x8A, 0x8F, 0xFF, 0x8E, 0x8D, 0x8F, 0xFF, 0x9D, 0x90, 0x8F,
+  0xFF, 0x77, 0x69, 0x6A, 0x80, 0x03, 0x09, 0x6A, 0x69, 0xFF, 0xB0, 0xA6,
+  0xA0, 0xFF, 0xA2, 0x96, 0x90, 0x6B, 0x83, 0x0A, 0x45, 0x38, 0x25, 0xFF,
+  0x63, 0x4E, 0x2D, 0xFF, 0x40, 0x33, 0x20, 0x63, 0xDB, 0x43, 0xDF, 0x43,
+  0xFF, 0x44, 0x0B, 0xC3, 0xFF, 0xC0, 0x0B, 0x4C, 0x1F, 0x4B, 0xF7, 0x02,
+  0x42, 0x35, 0x22, 0x60, 0x27, 0x43, 0xC3, 0x47, 0xEF, 0x06, 0xA3, 0x88,
+  0x51, 0xFF, 0xB7, 0x93, 0x5D, 0xF4, 0x04, 0x1B, 0x01, 0xBC, 0x98, 0x80,
+  0x03, 0x02, 0xB8, 0x94, 0x5E, 0x60, 0x0B, 0x00, 0xB9, 0x27, 0xFB, 0x02,
+  0xBD, 0x99, 0x63, 0x64, 0x0B, 0x40, 0x33, 0x44, 0x3B, 0xE2, 0x0B, 0x77,
+  0x4C, 0x0B, 0x02, 0x3C, 0xC5, 0x23, 0x60, 0x1B, 0x43, 0xE3, 0x07, 0x4C,
+  0xD5, 0x33, 0xFF, 0x14, 0x78, 0x14, 0xFF, 0x44, 0x17, 0x02, 0x3D, 0xC6,
+  0x24, 0x60, 0x17, 0x40, 0x23, 0x40, 0x17, 0x02, 0xD6, 0xD6, 0xD6, 0x63,
+  0xF3, 0xE3, 0x03, 0xF7, 0x40, 0x0B, 0x06, 0xF1, 0xF1, 0xF1, 0xFF, 0xF0,
+  0xF0, 0xF0, 0x60, 0x0B, 0x43, 0xFF, 0x01, 0xED, 0xED, 0xE7, 0x01, 0xFF,
+  0x48, 0x03, 0x40, 0x03, 0x00, 0xD2, 0x2C, 0x1F, 0x01, 0xEA, 0xD2, 0x23,
+  0xFF, 0x00, 0xFB, 0x27, 0xD7, 0x23, 0xEF, 0x02, 0xFD, 0xFC, 0x52, 0x22,
+  0x67, 0x0B, 0x50, 0xFF, 0xFD, 0xFD, 0x51, 0xFF, 0xFE, 0xFF, 0x53, 0xFF,
+  0xFE, 0xFD, 0x20, 0x13, 0x00, 0xFB, 0x23, 0xFF, 0x00, 0xF9, 0x28, 0x07,
+  0x01, 0xF8, 0x4E, 0x24, 0x23, 0x04, 0x48, 0xFF, 0xFF, 0xF7, 0x47, 0x20,
+  0x07, 0x20, 0x33, 0x05, 0xF8, 0x43, 0xFF, 0xE9, 0xCF, 0x32, 0xE3, 0x38,
+  0x7F, 0xE3, 0x37, 0xBF, 0xE0, 0x37, 0x3F, 0xE1, 0x0B, 0x7F, 0xE0, 0x63,
+  0x00, 0x43, 0xC3, 0x60, 0x03, 0x00, 0x57, 0xE0, 0x02, 0x07, 0x40, 0x0B,
+  0x23, 0xEB, 0x63, 0xF3, 0x40, 0x0B, 0xE0, 0x0B, 0x03, 0x23, 0xFB, 0x40,
+  0x03, 0x5B, 0xB7, 0x00, 0x65, 0xFF, 0x32, 0xFF, 0x23, 0xC0, 0x02, 0xB3,
+  0xB3, 0xB3, 0x67, 0xEB, 0x47, 0xCF, 0x40, 0x03, 0x47, 0xF7, 0x02, 0x85,
+  0x85, 0x85, 0x60, 0x03, 0xC3, 0xEF, 0x12, 0xA4, 0xA4, 0xA4, 0xFF, 0x9E,
+  0x9E, 0x9E, 0xFF, 0x9C, 0x9C, 0x9C, 0xFF, 0x52, 0x52, 0x52, 0xFF, 0x7C,
+  0x7C, 0x7C, 0x6E, 0x77, 0x40, 0x2F, 0x43, 0xC3, 0x43, 0xE7, 0x40, 0x03,
+  0xE3, 0x07, 0xDF, 0xE0, 0x03, 0x0F, 0x40, 0x1F, 0xE0, 0x07, 0x03, 0x44,
+  0x27, 0x02, 0xE4, 0xDE, 0xA7, 0x63, 0xDF, 0x47, 0xDB, 0x43, 0xE7, 0x40,
+  0x07, 0x40, 0x03, 0x02, 0xE6, 0xD9, 0xAE, 0x60, 0x07, 0x05, 0xE7, 0xDB,
+  0xAF, 0xFF, 0xCD, 0xC7, 0x87, 0xEF, 0x48, 0x03, 0x06, 0xD7, 0xCB, 0x9F,
+  0xFF, 0xC2, 0xBC, 0x84, 0x64, 0x23, 0x02, 0xC9, 0xC2, 0x8B, 0x63, 0xE3,
+  0x03, 0xA2, 0x98, 0x97, 0xFF, 0x47, 0xE3, 0x40, 0x03, 0x0A, 0x9A, 0x91,
+  0x90, 0xFF, 0x5A, 0x54, 0x53, 0xFF, 0x77, 0x71, 0x73, 0x60, 0x1B, 0x1E,
+  0x95, 0x96, 0x98, 0xFF, 0x77, 0x6D, 0x66, 0xFF, 0x61, 0x5A, 0x51, 0xFF,
+  0xAB, 0xA2, 0xA1, 0xFF, 0x9F, 0x8F, 0x8C, 0xFF, 0x8F, 0x86, 0x86, 0xFF,
+  0xA6, 0xA2, 0xA2, 0xFF, 0x96, 0x8D, 0x85, 0x6F, 0x97, 0x47, 0xF7, 0x4F,
+  0x8F, 0xC7, 0xE3, 0x43, 0xFF, 0xC0, 0x0F, 0x00, 0x6E, 0x2F, 0xAF, 0x43,
+  0xEB, 0x4F, 0xBF, 0x4B, 0xFF, 0x43, 0xFF, 0x40, 0x07, 0x43, 0xBB, 0x40,
+  0x27, 0x00, 0x4C, 0x34, 0x0F, 0x02, 0xB3, 0x8F, 0x59, 0x67, 0xFF, 0x43,
+  0xEF, 0x43, 0xD7, 0x43, 0xE7, 0x40, 0x07, 0xC0, 0x03, 0x44, 0x17, 0x40,
+  0x0B, 0xC4, 0x07, 0x48, 0x0B, 0x40, 0x0F, 0x44, 0x3B, 0x42, 0x6B, 0x06,
+  0x47, 0xE7, 0x27, 0xFF, 0x46, 0xE6, 0x26, 0x60, 0x0B, 0x40, 0x00, 0x05,
+  0x57, 0xE0, 0x3E, 0xFF, 0x26, 0x71, 0x80, 0x0F, 0x00, 0x4B, 0x2C, 0x13,
+  0x01, 0x3F, 0xC8, 0x80, 0x0B, 0x40, 0x00, 0xC0, 0x0B, 0x02, 0x45, 0xCE,
+  0x2C, 0x64, 0x23, 0x47, 0xFF, 0x43, 0xE7, 0x43, 0xE3, 0x43, 0xF7, 0x40,
+  0x07, 0x40, 0x0F, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0x43, 0xFF, 0x43, 0xF3,
+  0x47, 0xFF, 0xC0, 0x03, 0x40, 0x3B, 0x01, 0xEA, 0xD1, 0x23, 0xCB, 0x01,
+  0xFD, 0x57, 0x23, 0xFB, 0x43, 0xF7, 0x00, 0x52, 0x23, 0xEF, 0x03, 0x4C,
+  0xFF, 0xFF, 0xFE, 0x23, 0xEB, 0x00, 0xFD, 0x20, 0x03, 0x24, 0x0F, 0x00,
+  0xFF, 0x28, 0x03, 0x00, 0xFF, 0x28, 0x03, 0x43, 0xFF, 0x00, 0xFE, 0x23,
+  0xFB, 0x05, 0xFD, 0xF6, 0x46, 0xFF, 0xFD, 0xF5, 0x2C, 0x33, 0x20, 0x03,
+  0x02, 0xEA, 0xD2, 0x39, 0xE3, 0x38, 0x7F, 0xE3, 0x37, 0xBF, 0xE0, 0x37,
+  0x3F, 0x41, 0x53, 0xE0, 0x73, 0x00, 0x43, 0xC3, 0xE7, 0x00, 0xD3, 0x43,
+  0xE7, 0x47, 0xE7, 0x40, 0x07, 0xC0, 0x03, 0xE4, 0x03, 0x07, 0x40, 0x1B,
+  0x40, 0x03, 0x40, 0x13, 0x40, 0x1F, 0x24, 0x03, 0xFF, 0x37, 0xFF, 0x23,
+  0xC0, 0x02, 0x72, 0x72, 0x72, 0x63, 0xEB, 0x02, 0x7D, 0x7D, 0x7D, 0x63,
+  0xCF, 0x06, 0x79, 0x79, 0x79, 0xFF, 0x8A, 0x8A, 0x8A, 0x6B, 0xEB, 0x02,
+  0x37, 0x37, 0x37, 0x67, 0xEB, 0x02, 0xC4, 0xC4, 0xC4, 0x60, 0x17, 0x50,
+  0x03, 0x02, 0x63, 0x63, 0x63, 0x67, 0xF7, 0x4C, 0x2B, 0x00, 0x3A, 0x30,
+  0x07, 0xC3, 0xE3, 0x44, 0x07, 0xC0, 0x03, 0xC0, 0x13, 0x40, 0x07, 0x40,
+  0x13, 0x43, 0xE7, 0x40, 0x07, 0x40, 0x03, 0x40, 0x13, 0x40, 0x03, 0xC0,
+  0x13, 0x00, 0xCD, 0x27, 0xFF, 0x02, 0xDF, 0xD8, 0xA0, 0x2B, 0xD3, 0x00,
+  0x92, 0x2F, 0xE3, 0x00, 0xF1, 0x6F, 0xDF, 0x02, 0xE9, 0xE3, 0xAC, 0x70,
+  0x17, 0x01, 0xDD, 0xD1, 0x24, 0x1B, 0x33, 0xF3, 0x03, 0xF1, 0xEA, 0xB4,
+  0xFF, 0x4C, 0x07, 0x02, 0xC5, 0xBE, 0x86, 0x60, 0x27, 0x02, 0xD1, 0xCB,
+  0x93, 0x67, 0xFF, 0x44, 0x07, 0x02, 0x9D, 0x92, 0x96, 0x36, 0xCB, 0x17,
+  0xB7, 0xFF, 0x7B, 0x6E, 0x75, 0xFF, 0xA6, 0x99, 0x9D, 0xFF, 0x7A, 0x79,
+  0x80, 0xFF, 0xAB, 0xA6, 0xAB, 0xFF, 0x89, 0x77, 0x77, 0xFF, 0x4B, 0x44,
+  0x2F, 0x53, 0x09, 0x4A, 0x4A, 0xFF, 0x72, 0x63, 0x5E, 0xFF, 0x89, 0x79,
+  0x7D, 0x60, 0x27, 0x0A, 0xC1, 0xBF, 0xC0, 0xFF, 0x5F, 0x54, 0x50, 0xFF,
+  0x6F, 0x68, 0x63, 0x20, 0x1F, 0x00, 0x41, 0x63, 0xE7, 0x4B, 0xFF, 0x43,
+  0xEF, 0x53, 0xEB, 0x43, 0xDB, 0x47, 0xEB, 0x40, 0x0B, 0x43, 0xF3, 0x01,
+  0x6B, 0x56, 0x27, 0x73, 0x34, 0x13, 0x43, 0xAB, 0x02, 0x8F, 0x6F, 0x40,
+  0x68, 0x17, 0x43, 0xF7, 0x48, 0x2B, 0x44, 0x2F, 0x44, 0x07, 0x43, 0xCB,
+  0x01, 0x9C, 0x81, 0x9C, 0x4B, 0x40, 0x0B, 0x43, 0xDF, 0x48, 0x0F, 0x02,
+  0xA4, 0x89, 0x52, 0x60, 0x0B, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x1B, 0x44,
+  0x1B, 0x4C, 0x17, 0x40, 0x0B, 0x40, 0x53, 0x42, 0x7B, 0x00, 0x56, 0x2B,
+  0xCB, 0x01, 0x38, 0xC1, 0x93, 0xF7, 0x47, 0xE7, 0x43, 0xE3, 0x02, 0x22,
+  0x86, 0x22, 0x60, 0x1B, 0x00, 0x26, 0x24, 0x07, 0x47, 0xE7, 0x40, 0x27,
+  0x01, 0x1C, 0x80, 0x88, 0x2F, 0x01, 0x20, 0x84, 0x90, 0x33, 0x02, 0x36,
+  0xBF, 0x1D, 0x63, 0xC3, 0x47, 0xEB, 0x43, 0xEB, 0x4B, 0xD7, 0x40, 0x03,
+  0x43, 0xEB, 0x40, 0x03, 0x44, 0x0B, 0xE0, 0x0B, 0x03, 0x44, 0x07, 0x40,
+  0x03, 0x63, 0xFF, 0x05, 0xD2, 0x43, 0xFF, 0xFE, 0xFE, 0x5A, 0x27, 0xF3,
+  0x00, 0x53, 0x21, 0x7E, 0x00, 0x44, 0x80, 0x03, 0x01, 0xF9, 0x49, 0x20,
+  0x03, 0x00, 0x4A, 0x20, 0x03, 0x24, 0x0B, 0x05, 0xF9, 0x50, 0xFF, 0xFE,
+  0xF9, 0x51, 0x24, 0x17, 0x00, 0x4F, 0x20, 0x03, 0x04, 0x4D, 0xFF, 0xFD,
+  0xFA, 0x4C, 0x28, 0x0F, 0x00, 0x4A, 0x2C, 0x13, 0x00, 0x49, 0x24, 0x3B,
+  0x00, 0x3A, 0xE3, 0x38, 0x7F, 0xE3, 0x37, 0xBF, 0xE0, 0x37, 0x3F, 0x41,
+  0x57, 0xE0, 0x73, 0x00, 0x43, 0xC3, 0x60, 0x03, 0x43, 0xD3, 0x43, 0xDB,
+  0x43, 0xD7, 0x20, 0x03, 0xE4, 0x00, 0x13, 0x23, 0xE3, 0x40, 0x03, 0x60,
+  0x0F, 0x40, 0x23, 0x40, 0x03, 0x20, 0x1F, 0x60, 0x03, 0x20, 0x1B, 0x01,
+  0x79, 0xB9, 0xFF, 0x35, 0xFF, 0x23, 0xC0, 0x53, 0xDB, 0xC0, 0x03, 0x47,
+  0xCF, 0x54, 0x07, 0x4B, 0xEB, 0x40, 0x03, 0x58, 0x03, 0x02, 0x61, 0x61,
+  0x61, 0x7D, 0xAB, 0x5A, 0xE7, 0x40, 0x27, 0x44, 0x2F, 0x40, 0x07, 0x06,
+  0x7E, 0x7E, 0x7E, 0xFF, 0x56, 0x56, 0x56, 0xE7, 0x00, 0xD3, 0x43, 0xDB,
+  0x44, 0x1B, 0x40, 0x07, 0x43, 0xDF, 0xC7, 0xEB, 0x40, 0x0F, 0xE0, 0x03,
+  0x03, 0xC0, 0x17, 0x40, 0x07, 0x44, 0x03, 0x0A, 0xBC, 0xB6, 0x7E, 0xFF,
+  0xDF, 0xD3, 0xA9, 0xFF, 0xCB, 0xBF, 0x94, 0x6F, 0xEF, 0x06, 0xBF, 0xB8,
+  0x82, 0xFF, 0xE2, 0xDB, 0xA3, 0x30, 0x07, 0x00, 0x9B, 0xAB, 0xFB, 0x00,
+  0x98, 0x64, 0x03, 0x48, 0x13, 0x06, 0xFF, 0xF7, 0xCC, 0xFF, 0xDC, 0xD5,
+  0x9F, 0x68, 0x07, 0x58, 0x33, 0x10, 0xD9, 0xCD, 0xA2, 0xFF, 0xA4, 0x9C,
+  0x9C, 0xFF, 0xA9, 0x97, 0x93, 0xFF, 0x7E, 0x7B, 0x7E, 0xFF, 0x96, 0x34,
+  0xA3, 0x00, 0x9D, 0x24, 0xBB, 0x00, 0xA4, 0x27, 0xF3, 0x08, 0x80, 0x7F,
+  0x80, 0xFF, 0xB0, 0xA2, 0xA5, 0xFF, 0x98, 0x2B, 0xF7, 0x09, 0x74, 0x6F,
+  0x6C, 0xFF, 0x89, 0x7E, 0x7C, 0xFF, 0x4B, 0x45, 0x24, 0x0F, 0x20, 0x03,
+  0x06, 0x8F, 0x85, 0x8A, 0xFF, 0x89, 0x87, 0x89, 0x68, 0x1F, 0x43, 0xEB,
+  0x43, 0xCF, 0x47, 0xC7, 0x44, 0x03, 0x06, 0x97, 0x77, 0x48, 0xFF, 0x62,
+  0x4D, 0x2C, 0x60, 0x17, 0x43, 0xDB, 0x02, 0x91, 0x71, 0x42, 0x60, 0x07,
+  0x40, 0x23, 0x06, 0x59, 0x47, 0x2C, 0xFF, 0x37, 0x2A, 0x17, 0x60, 0x0B,
+  0x4C, 0x1F, 0x00, 0x6E, 0x28, 0x1B, 0x40, 0x23, 0x43, 0xCB, 0x00, 0x9F,
+  0x2F, 0xDF, 0x53, 0xD7, 0x00, 0xB6, 0xB0, 0x0B, 0x40, 0x0B, 0x06, 0xBB,
+  0x97, 0x61, 0xFF, 0xBF, 0x9B, 0x65, 0x68, 0x17, 0x40, 0x1F, 0x40, 0x27,
+  0x48, 0x03, 0xC0, 0x0B, 0x40, 0x3B, 0x02, 0x18, 0x7C, 0x18, 0xEF, 0x00,
+  0xD3, 0x53, 0xD7, 0x02, 0x1D, 0x81, 0x1D, 0x62, 0x93, 0x4F, 0xFF, 0x02,
+  0x4D, 0xED, 0x2D, 0x60, 0x0B, 0x40, 0x00, 0x02, 0x2A, 0x8E, 0x2A, 0xE0,
+  0x00, 0x0B, 0x0A, 0x17, 0x7B, 0x17, 0xFF, 0x1E, 0x82, 0x1E, 0xFF, 0x21,
+  0x85, 0x21, 0x63, 0xC3, 0x43, 0xFB, 0x43, 0xE7, 0x43, 0xF3, 0x40, 0x03,
+  0x47, 0xDF, 0x40, 0x07, 0x40, 0x03, 0x40, 0x17, 0x40, 0x03, 0xE0, 0x03,
+  0x0B, 0x43, 0xFB, 0x54, 0x2B, 0x06, 0xD3, 0xD3, 0xD3, 0xFF, 0xE7, 0xD3,
+  0x40, 0x2F, 0xEB, 0x04, 0x5A, 0xFF, 0xFA, 0xFA, 0x54, 0x23, 0xEB, 0x43,
+  0xF3, 0x00, 0x4A, 0x27, 0xDB, 0x00, 0x46, 0x2B, 0xDF, 0xE4, 0x02, 0x03,
+  0x09, 0xFA, 0x4E, 0xFF, 0xF9, 0xFB, 0x49, 0xFF, 0xF9, 0xFD, 0x48, 0x22,
+  0xA3, 0x06, 0x48, 0xFF, 0xFD, 0xF8, 0x46, 0xFF, 0xFE, 0x30, 0x03, 0x02,
+  0xEA, 0xCE, 0x36, 0xE3, 0x38, 0x7F, 0xE3, 0x37, 0xBF, 0xE0, 0x37, 0x3F,
+  0x41, 0x5B, 0xE0, 0x73, 0x00, 0x63, 0xD7, 0x23, 0xC7, 0xC3, 0xCF, 0x60,
+  0x0B, 0x20, 0x0F, 0x40, 0x17, 0x40, 0x03, 0x40, 0x0B, 0xE0, 0x00, 0x03,
+  0x43, 0xF7, 0x20, 0x1B, 0x60, 0x03, 0x44, 0x07, 0x20, 0x0B, 0x01, 0x5E,
+  0x9E, 0xFF, 0x35, 0xFF, 0x23, 0xC0, 0x43, 0xCB, 0x40, 0x03, 0x06, 0x30,
+  0x30, 0x30, 0xFF, 0x54, 0x54, 0x54, 0x6B, 0xD7, 0x4C, 0x03, 0x44, 0x0B,
+  0x0A, 0x51, 0x51, 0x51, 0xFF, 0x5E, 0x5E, 0x5E, 0xFF, 0x4C, 0x4C, 0x4C,
+  0x68, 0x0B, 0x47, 0xFF, 0x40, 0x2B, 0x44, 0x1B, 0x06, 0x62, 0x62, 0x62,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xE3, 0x04, 0xDB, 0x43, 0xF7, 0xE0, 0x0B, 0x03,
+  0x43, 0xE7, 0xE0, 0x07, 0x17, 0x00, 0x57, 0x3C, 0x37, 0x40, 0x03, 0x4F,
+  0xC7, 0x47, 0xE3, 0x02, 0xE6, 0xDA, 0xAE, 0x6F, 0xD7, 0x53, 0xF7, 0x4F,
+  0xFB, 0x06, 0xE5, 0xDE, 0xA8, 0xFF, 0xFB, 0xF4, 0xBD, 0x63, 0xE7, 0x01,
+  0xD0, 0xC4, 0x94, 0x13, 0x57, 0xFB, 0x02, 0xDF, 0xD9, 0xA1, 0x78, 0x2B,
+  0x01, 0xD2, 0xCC, 0x8C, 0x0F, 0x53, 0xC3, 0x40, 0x03, 0x02, 0xBF, 0xB6,
+  0xB4, 0x60, 0x03, 0x03, 0xAE, 0xA6, 0xA3, 0xFF, 0x5C, 0x97, 0x05, 0x9A,
+  0x8F, 0x8C, 0xFF, 0x4E, 0x49, 0x33, 0xF7, 0x3C, 0x17, 0x02, 0xA4, 0x8C,
+  0x85, 0x23, 0xF3, 0x00, 0x82, 0x60, 0x0B, 0x00, 0x87, 0x34, 0x13, 0x0A,
+  0x6D, 0x68, 0x6A, 0xFF, 0x7D, 0x7F, 0x83, 0xFF, 0x72, 0x6F, 0x74, 0x67,
+  0xDF, 0x47, 0xF3, 0x43, 0xCF, 0x47, 0xEB, 0xDC, 0x03, 0x40, 0x13, 0x00,
+  0x41, 0x3B, 0xFF, 0x03, 0x99, 0x79, 0x4A, 0xFF, 0x54, 0x23, 0x43, 0xFF,
+  0x44, 0x23, 0x48, 0x17, 0x40, 0x0B, 0x00, 0x3F, 0x38, 0x37, 0x00, 0x6E,
+  0xA3, 0xFF, 0x53, 0xCB, 0x43, 0xD3, 0x02, 0xC9, 0xA5, 0x6F, 0x63, 0xE3,
+  0x40, 0x0B, 0xCC, 0x0B, 0x43, 0xF3, 0x44, 0x07, 0x06, 0xA1, 0x86, 0x4F,
+  0xFF, 0xAD, 0x89, 0x53, 0x60, 0x17, 0x40, 0x1F, 0x40, 0x17, 0x03, 0x74,
+  0x5F, 0x3E, 0xFF, 0x43, 0xE7, 0x02, 0x5C, 0xFC, 0x3C, 0x62, 0x87, 0x06,
+  0x4C, 0xEC, 0x2C, 0xFF, 0x5B, 0xFB, 0x3B, 0x64, 0x03, 0x4F, 0xEB, 0x01,
+  0x43, 0xCC, 0x83, 0xF3, 0x06, 0x4E, 0xEE, 0x2E, 0xFF, 0x62, 0xFF, 0x42,
+  0x64, 0x2B, 0x42, 0xAB, 0x43, 0xFF, 0x40, 0x07, 0x02, 0x27, 0x8B, 0x27,
+  0x63, 0xFF, 0x47, 0xFF, 0xC3, 0xE3, 0x47, 0xFF, 0xE0, 0x07, 0x03, 0x43,
+  0xEB, 0x44, 0x13, 0x43, 0xF7, 0x44, 0x07, 0x40, 0x0B, 0x00, 0xE7, 0xD3,
+  0xFF, 0x01, 0xD4, 0x3E, 0x27, 0xFB, 0x00, 0x62, 0x27, 0xD7, 0x37, 0xE3,
+  0x23, 0xFB, 0xE8, 0x00, 0x03, 0xC8, 0x0B, 0x20, 0x07, 0x06, 0xFE, 0xF3,
+  0x45, 0xFF, 0xFA, 0xF7, 0x41, 0x34, 0x0F, 0x00, 0x41, 0x28, 0x03, 0x06,
+  0x43, 0xFF, 0xFD, 0xF7, 0x40, 0xFF, 0xFC, 0x33, 0xFF, 0x01, 0xE9, 0xCE,
+  0x29, 0x1F, 0x3B, 0xFF, 0xF7, 0x73, 0xBF, 0xE0, 0x37, 0x7F, 0x41, 0x47,
+  0xE0, 0x73, 0x00, 0x43, 0xE3, 0x40, 0x03, 0x43, 0xCB, 0x63, 0xDF, 0x43,
+  0xD7, 0x23, 0xE7, 0x40, 0x13, 0x40, 0x03, 0x40, 0x0B, 0x60, 0x03, 0x23,
+  0xEB, 0x60, 0x0F, 0x20, 0x07, 0x60, 0x23, 0x48, 0x2B, 0x20, 0x2B, 0x01,
+  0x6F, 0xAF, 0xFF, 0x35, 0xFF, 0x23, 0xC0, 0x4B, 0xF7, 0x02, 0x24, 0x24,
+  0x24, 0x63, 0xEF, 0x5E, 0x3F, 0x43, 0xFB, 0x43, 0xE3, 0x02, 0x6D, 0x6D,
+  0x6D, 0x60, 0x0B, 0x02, 0xA8, 0xA8, 0xA8, 0x67, 0xEB, 0x0E, 0x5F, 0x5F,
+  0x5F, 0xFF, 0x49, 0x49, 0x49, 0xFF, 0x3E, 0x3E, 0x3E, 0xFF, 0x21, 0x21,
+  0x21, 0x6C, 0x13, 0x40, 0x2B, 0x43, 0xC3, 0x47, 0xCB, 0x40, 0x03, 0x43,
+  0xE7, 0x40, 0x07, 0x43, 0xEB, 0x40, 0x17, 0xC0, 0x03, 0x40, 0x13, 0xE0,
+  0x0F, 0x03, 0x02, 0xE0, 0xD9, 0xA2, 0x67, 0xFF, 0x02, 0xED, 0xE1, 0xB6,
+  0x6F, 0xEB, 0x02, 0xE0, 0xD4, 0xA9, 0x63, 0xE7, 0x47, 0xEF, 0x48, 0x17,
+  0x02, 0xF2, 0xE7, 0xBB, 0x2E, 0x8F, 0x04, 0xD2, 0xFF, 0xC1, 0xBA, 0x83,
+  0x67, 0xFB, 0x54, 0x2B, 0x02, 0xDB, 0xCF, 0xA4, 0x63, 0xFF, 0x44, 0x2B,
+  0x06, 0x6F, 0x68, 0x69, 0xFF, 0x55, 0x53, 0x53, 0x6F, 0xFB, 0x4F, 0xFF,
+  0x00, 0x96, 0x23, 0xEB, 0x12, 0x91, 0x82, 0x81, 0xFF, 0xAB, 0xA0, 0x9C,
+  0xFF, 0x83, 0x7F, 0x7F, 0xFF, 0x9A, 0x9B, 0x9F, 0xFF, 0x66, 0x5D, 0x5A,
+  0x63, 0xFB, 0x06, 0x96, 0x82, 0x88, 0xFF, 0xB3, 0xAB, 0xA7, 0x60, 0x0B,
+  0x06, 0x98, 0x8D, 0x8C, 0xFF, 0x5E, 0x60, 0x66, 0x6B, 0x83, 0x43, 0xE3,
+  0x43, 0xCF, 0x06, 0x70, 0x5B, 0x3A, 0xFF, 0x94, 0x74, 0x45, 0x63, 0xF7,
+  0x4B, 0x9B, 0x4B, 0xE3, 0x40, 0x07, 0x4F, 0xFF, 0x02, 0x93, 0x73, 0x44,
+  0x67, 0xAF, 0x01, 0x6C, 0x57, 0x26, 0xF3, 0x2C, 0x13, 0x40, 0x2F, 0x44,
+  0x07, 0x40, 0x1F, 0x43, 0xCB, 0x02, 0xAC, 0x91, 0x5A, 0x63, 0xDB, 0x40,
+  0x0B, 0x43, 0xDF, 0x47, 0xFF, 0x40, 0x0B, 0x40, 0x03, 0x44, 0x0B, 0x58,
+  0x1B, 0xC0, 0x0B, 0x4C, 0x2B, 0x48, 0x07, 0x40, 0x3B, 0x03, 0x5E, 0xFE,
+  0x3E, 0xFF, 0xD7, 0xFB, 0x02, 0x4D, 0xD6, 0x34, 0x68, 0x0B, 0x06, 0x28,
+  0x73, 0x28, 0xFF, 0x49, 0xD2, 0x30, 0xE3, 0x00, 0xFF, 0x57, 0xF3, 0xC4,
+  0x0B, 0x40, 0x00, 0x07, 0x63, 0xFF, 0x43, 0xFF, 0x50, 0xD9, 0x37, 0xFF,
+  0x5C, 0x1B, 0x53, 0xFF, 0x4F, 0xEF, 0x02, 0xF2, 0xF2, 0xF2, 0x63, 0xDB,
+  0x40, 0x07, 0xE3, 0x07, 0xFF, 0xE0, 0x07, 0x0F, 0x0E, 0xE6, 0xE6, 0xE6,
+  0xFF, 0xE2, 0xE2, 0xE2, 0xFF, 0xCF, 0xCF, 0xCF, 0xFF, 0xEA, 0xD4, 0x41,
+  0x2F, 0xE3, 0x00, 0x63, 0x2F, 0xEF, 0x00, 0x65, 0x83, 0xFF, 0x01, 0xFD,
+  0x6B, 0x63, 0xF3, 0x43, 0xF7, 0xE0, 0x0F, 0x03, 0x09, 0xFB, 0xEF, 0x3A,
+  0xFF, 0xF7, 0xE9, 0x35, 0xFF, 0xE8, 0xC8, 0xF7, 0xFF, 0x3A, 0xFF, 0x43,
+  0xD3, 0x40, 0x03, 0x63, 0xE3, 0x23, 0xCF, 0xC3, 0xD7, 0x63, 0xE7, 0xE3,
+  0x03, 0xEB, 0xA4, 0x13, 0x60, 0x13, 0x20, 0x0B, 0xC0, 0x03, 0x01, 0x61,
+  0xA1, 0xFF, 0x35, 0xFF, 0x23, 0xC0, 0x5B, 0xD7, 0x47, 0xEB, 0x43, 0xCB,
+  0x02, 0xB4, 0xB4, 0xB4, 0x67, 0xE3, 0x02, 0x3B, 0x3B, 0x3B, 0x60, 0x0F,
+  0x00, 0x69, 0x3B, 0x33, 0x44, 0x13, 0x5F, 0xF3, 0x02, 0x91, 0x91, 0x91,
+  0x60, 0x27, 0x00, 0x5E, 0x28, 0x0F, 0x47, 0xF7, 0x44, 0x23, 0x40, 0x03,
+  0x43, 0xE3, 0x43, 0xEF, 0xE0, 0x0B, 0x03, 0x40, 0x1B, 0x44, 0x13, 0x40,
+  0x07, 0x40, 0x03, 0xE0, 0x03, 0x23, 0x44, 0x0F, 0x40, 0x13, 0x0A, 0xC1,
+  0xBB, 0x84, 0xFF, 0xB0, 0xA9, 0x72, 0xFF, 0xE4, 0xD8, 0xAD, 0x77, 0xE3,
+  0x57, 0xDB, 0x02, 0xDD, 0xD2, 0xA6, 0x64, 0x0B, 0x47, 0xE3, 0x48, 0x1F,
+  0x4B, 0xF3, 0x40, 0x03, 0x02, 0xEE, 0xE8, 0xB1, 0x60, 0x0F, 0x01, 0xE0,
+  0xD5, 0x30, 0x93, 0x30, 0x0B, 0x00, 0xEA, 0x30, 0x27, 0x02, 0x91, 0x86,
+  0x8A, 0x63, 0xCF, 0x54, 0xA3, 0x06, 0xA0, 0xA0, 0xA2, 0xFF, 0x85, 0x7D,
+  0x77, 0x60, 0x0F, 0x4F, 0xE7, 0x40, 0x03, 0x06, 0x4B, 0x46, 0x41, 0xFF,
+  0x83, 0x7A, 0x78, 0x78, 0x1F, 0x06, 0x74, 0x60, 0x5E, 0xFF, 0x83, 0x74,
+  0x76, 0x2C, 0x23, 0x04, 0x8D, 0xFF, 0x6F, 0x6B, 0x6C, 0x20, 0x1B, 0x00,
+  0x44, 0x63, 0x83, 0x57, 0xCF, 0x02, 0x46, 0x39, 0x26, 0x6F, 0xCF, 0x02,
+  0x6D, 0x58, 0x37, 0x64, 0x03, 0x43, 0xF3, 0x4F, 0xFF, 0x40, 0x03, 0x02,
+  0x39, 0x2C, 0x19, 0x7F, 0xEB, 0x40, 0x13, 0x43, 0xFB, 0x00, 0x95, 0xBF,
+  0xFF, 0x04, 0x1C, 0xC3, 0xFF, 0x53, 0xDF, 0x43, 0xD3, 0x43, 0xE7, 0x54,
+  0x0B, 0x02, 0x9A, 0x7F, 0x48, 0x60, 0x0B, 0x40, 0x0F, 0x40, 0x03, 0x02,
+  0xBE, 0x9A, 0x64, 0x64, 0x13, 0x43, 0xFF, 0x57, 0xFF, 0x5C, 0x2B, 0x40,
+  0x0B, 0x43, 0xFF, 0x4F, 0xEB, 0xDF, 0xDF, 0x4B, 0xD3, 0x40, 0x0F, 0x43,
+  0xE3, 0xCF, 0xF3, 0x43, 0xE3, 0x40, 0x0F, 0x01, 0x47, 0xD0, 0x9F, 0xFF,
+  0x2D, 0xB4, 0x40, 0x0F, 0x06, 0x52, 0xF2, 0x32, 0xFF, 0x44, 0xCD, 0x2B,
+  0x60, 0x17, 0x02, 0xD7, 0xD7, 0xD7, 0xE3, 0x04, 0xFF, 0x44, 0x0B, 0x40,
+  0x03, 0x4C, 0x13, 0x40, 0x07, 0xC0, 0x03, 0x48, 0x23, 0x40, 0x03, 0x40,
+  0x0F, 0xC8, 0x2B, 0x4B, 0xFF, 0x01, 0xEA, 0xD3, 0x2B, 0xE7, 0x01, 0xFA,
+  0x69, 0x25, 0x63, 0x00, 0x6C, 0x83, 0xFF, 0x05, 0xFB, 0x64, 0xFF, 0xFE,
+  0xFB, 0x60, 0x20, 0x03, 0x04, 0x5D, 0xFF, 0xFE, 0xFC, 0x5B, 0x28, 0x1B,
+  0x20, 0x03, 0x04, 0xFE, 0x59, 0xFF, 0xFC, 0xFF, 0x34, 0x03, 0x00, 0xFF,
+  0x3C, 0x1F, 0x00, 0xFD, 0x54, 0x0F, 0x30, 0x2B, 0x01, 0xF7, 0x4F, 0x2B,
+  0xFF, 0x00, 0x3A, 0xE7, 0x38, 0x7F, 0x00, 0x6B, 0xE8, 0x76, 0x3F, 0x41,
+  0x5B, 0xE0, 0x73, 0x00, 0x63, 0xCF, 0x43, 0xE7, 0x40, 0x03, 0xE3, 0x02,
+  0xD7, 0x60, 0x0F, 0xC0, 0x13, 0x47, 0xEB, 0x20, 0x1B, 0x44, 0x27, 0x40,
+  0x03, 0xE0, 0x00, 0x17, 0x20, 0x1F, 0x01, 0x77, 0xB7, 0xFF, 0x35, 0xFF,
+  0x23, 0xC0, 0x43, 0xFB, 0x02, 0xA6, 0xA6, 0xA6, 0x73, 0xDF, 0x43, 0xCF,
+  0x40, 0x03, 0x43, 0xA7, 0x44, 0x0F, 0x02, 0x95, 0x95, 0x95, 0x60, 0x0F,
+  0x40, 0x13, 0x00, 0x86, 0x37, 0x33, 0x4B, 0xF7, 0x48, 0x07, 0x40, 0x33,
+  0x02, 0x9B, 0x9B, 0x9B, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x43, 0xC7, 0x43,
+  0xCF, 0x40, 0x37, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x0B, 0x43,
+  0xFF, 0x40, 0x07, 0x40, 0x0F, 0xC0, 0x03, 0x40, 0x2F, 0xC0, 0x03, 0x00,
+  0xDF, 0x27, 0xFF, 0x0E, 0xE0, 0xD4, 0xA8, 0xFF, 0xA9, 0xA3, 0x6C, 0xFF,
+  0xE5, 0xD9, 0xAE, 0xFF, 0xC7, 0xC0, 0x89, 0x68, 0x0B, 0x02, 0xD7, 0xD1,
+  0x99, 0x67, 0xE7, 0x02, 0xF1, 0xE6, 0xBA, 0x33, 0xFF, 0x04, 0xB2, 0xFF,
+  0xE6, 0xE0, 0xA9, 0x78, 0x1F, 0x44, 0x0F, 0x4C, 0x2F, 0xDF, 0xFF, 0x08,
+  0x28, 0x06, 0x6D, 0x5B, 0x61, 0xFF, 0xB0, 0xAB, 0xAB, 0x27, 0xD7, 0x11,
+  0xA9, 0xFF, 0x4B, 0x47, 0x44, 0xFF, 0xAB, 0x8F, 0x88, 0xFF, 0x5A, 0x4C,
+  0x47, 0xFF, 0x66, 0x61, 0x5B, 0xFF, 0x4F, 0xF7, 0x50, 0x13, 0x40, 0x07,
+  0x4C, 0x07, 0x02, 0x94, 0x86, 0x85, 0x6B, 0xFF, 0x02, 0x7E, 0x74, 0x6D,
+  0x64, 0x0F, 0x02, 0x66, 0x5B, 0x5A, 0x7B, 0xFB, 0x43, 0xC7, 0x47, 0xEB,
+  0x43, 0xEB, 0x53, 0xD3, 0x02, 0x96, 0x76, 0x47, 0x6B, 0xF3, 0x03, 0x64,
+  0x4F, 0x2E, 0xFF, 0x4C, 0x17, 0x54, 0x1F, 0x03, 0x9F, 0x7F, 0x50, 0xFF,
+  0xC0, 0x23, 0x4C, 0x23, 0x02, 0x43, 0x36, 0x23, 0x64, 0x07, 0x4C, 0x0F,
+  0x02, 0xB1, 0x8D, 0x57, 0x63, 0xDF, 0x44, 0x07, 0x43, 0xD7, 0x47, 0xFF,
+  0xE0, 0x0B, 0x03, 0x00, 0xB9, 0xFB, 0x06, 0xFF, 0x50, 0x7B, 0x5F, 0xD7,
+  0xE2, 0x07, 0x7F, 0x02, 0x1F, 0x6A, 0x1F, 0x6C, 0x03, 0x40, 0x17, 0x03,
+  0x4F, 0xEF, 0x2F, 0xFF, 0x5C, 0x03, 0x40, 0x0B, 0x40, 0x00, 0x50, 0x1F,
+  0x58, 0x13, 0x40, 0x0B, 0x40, 0x00, 0x43, 0xFF, 0x47, 0xF3, 0x02, 0xF3,
+  0xF3, 0xF3, 0x60, 0x03, 0x40, 0x0B, 0xE0, 0x0B, 0x03, 0x43, 0xFB, 0x40,
+  0x17, 0x40, 0x07, 0x43, 0xFF, 0x06, 0xE8, 0xE8, 0xE8, 0xFF, 0xCD, 0xCD,
+  0xCD, 0x23, 0xFF, 0x04, 0x4F, 0xFF, 0xFF, 0xFC, 0x73, 0x23, 0xFF, 0x00,
+  0x74, 0x20, 0x03, 0x00, 0x72, 0x27, 0xFF, 0x00, 0x6E, 0x20, 0x03, 0x00,
+  0x6B, 0x34, 0x13, 0x00, 0x69, 0x23, 0xEF, 0x04, 0x67, 0xFF, 0xFD, 0xFF,
+  0x65, 0x23, 0xFF, 0x00, 0x63, 0x20, 0x0F, 0x00, 0x5E, 0x20, 0x1F, 0x20,
+  0x03, 0x00, 0xFD, 0x20, 0x03, 0x09, 0xF7, 0x56, 0xFF, 0xFE, 0xEF, 0x4C,
+  0xFF, 0xE8, 0xC3, 0x33, 0xE3, 0x78, 0xBF, 0xE4, 0x37, 0x3F, 0x41, 0x43,
+  0xE0, 0x0B, 0x00, 0x03, 0xFE, 0x2A, 0x2A, 0xFF, 0xC0, 0x03, 0x02, 0xE2,
+  0x12, 0x12, 0xE0, 0x10, 0x27, 0xE0, 0x0F, 0x00, 0x03, 0xCC, 0x99, 0x78,
+  0xFF, 0xC0, 0x03, 0x02, 0x91, 0x6D, 0x55, 0xE0, 0x10, 0x3F, 0x43, 0xC3,
+  0x43, 0xDB, 0x60, 0x03, 0x23, 0xCF, 0xC0, 0x03, 0xE3, 0x04, 0xE7, 0x23,
+  0xFB, 0x60, 0x03, 0xC0, 0x1F, 0x48, 0x27, 0x40, 0x13, 0x20, 0x0F, 0x02,
+  0x7B, 0xBB, 0x51, 0xFF, 0x34, 0xFF, 0x23, 0xC0, 0x43, 0xCB, 0x40, 0x03,
+  0x02, 0xA0, 0xA0, 0xA0, 0x6C, 0x0B, 0x02, 0x6E, 0x6E, 0x6E, 0x63, 0xE7,
+  0x43, 0xF3, 0x06, 0x81, 0x81, 0x81, 0xFF, 0x92, 0x92, 0x92, 0x60, 0x0B,
+  0x43, 0xFB, 0x50, 0x0F, 0x02, 0xAC, 0xAC, 0xAC, 0x60, 0x2F, 0x40, 0x33,
+  0x40, 0x13, 0x43, 0xDF, 0xC3, 0xCB, 0x40, 0x07, 0x43, 0xEB, 0x40, 0x07,
+  0xC0, 0x03, 0xE3, 0x0B, 0xF3, 0xC0, 0x13, 0x40, 0x3B, 0x00, 0xCE, 0x3B,
+  0xDB, 0x43, 0xF7, 0x06, 0xE5, 0xDF, 0xA6, 0xFF, 0xC9, 0xBD, 0x91, 0x6F,
+  0xEF, 0x53, 0xF3, 0x47, 0xEF, 0x02, 0xD8, 0xD0, 0x99, 0x60, 0x0F, 0x60,
+  0x0B, 0x01, 0xD2, 0x9A, 0x26, 0xA7, 0x00, 0xC2, 0x68, 0x13, 0x48, 0x17,
+  0x05, 0xD1, 0xCA, 0x93, 0xFF, 0xBB, 0xB3, 0x9F, 0xFF, 0x0B, 0xDC, 0x02,
+  0xB3, 0xAB, 0xAC, 0x3F, 0xFB, 0x04, 0xA5, 0xFF, 0x69, 0x5C, 0x57, 0x37,
+  0xEB, 0x00, 0x5F, 0x6F, 0xFF, 0x12, 0x74, 0x74, 0x73, 0xFF, 0x55, 0x54,
+  0x52, 0xFF, 0xA4, 0x9A, 0x9A, 0xFF, 0x53, 0x4B, 0x48, 0xFF, 0xAB, 0xA7,
+  0xA8, 0x60, 0x07, 0x02, 0x69, 0x5E, 0x57, 0x64, 0x0B, 0x06, 0x7E, 0x78,
+  0x78, 0xFF, 0x96, 0x8A, 0x82, 0x63, 0xDF, 0x43, 0xFF, 0x4B, 0xCF, 0x43,
+  0xFB, 0x02, 0x6F, 0x5A, 0x39, 0x6F, 0xFB, 0x47, 0xEB, 0x50, 0x03, 0x02,
+  0x38, 0x2B, 0x18, 0x63, 0xFF, 0x02, 0x9D, 0x7D, 0x4E, 0x78, 0x07, 0x4B,
+  0xFF, 0x54, 0x23, 0x02, 0x3C, 0x2F, 0x1C, 0x64, 0x07, 0x40, 0x07, 0x47,
+  0xF3, 0x43, 0xEF, 0x47, 0xEB, 0x40, 0x0B, 0x00, 0xB6, 0x34, 0x03, 0x44,
+  0x07, 0x40, 0x0B, 0x40, 0x07, 0xC0, 0x03, 0x43, 0xFF, 0x40, 0x23, 0x00,
+  0xA4, 0x38, 0x17, 0x40, 0x13, 0x03, 0x65, 0x50, 0x2F, 0xFF, 0x5F, 0xC7,
+  0x42, 0x43, 0x40, 0x07, 0x02, 0x5A, 0xFA, 0x3A, 0x60, 0x0B, 0xE0, 0x03,
+  0x00, 0x40, 0x17, 0xC3, 0xEF, 0x44, 0x07, 0xDF, 0xFF, 0x08, 0x30, 0x03,
+  0x16, 0x7A, 0x16, 0xFF, 0x44, 0x1B, 0x02, 0xD8, 0xD8, 0xD8, 0x63, 0xF7,
+  0xC3, 0xFF, 0xE0, 0x03, 0x07, 0x43, 0xEF, 0x40, 0x03, 0x43, 0xF3, 0x40,
+  0x03, 0x43, 0xF7, 0x4F, 0xF7, 0x4B, 0xFB, 0x06, 0xDE, 0xDE, 0xDE, 0xFF,
+  0xC9, 0xC9, 0xC9, 0x23, 0xFF, 0x3B, 0xE3, 0x01, 0xFD, 0x78, 0x80, 0x03,
+  0x01, 0xFE, 0x77, 0x20, 0x03, 0x00, 0x75, 0x20, 0x03, 0x24, 0x0F, 0x01,
+  0xFF, 0x71, 0x20, 0x07, 0x00, 0x6E, 0x28, 0x03, 0x24, 0x0B, 0x00, 0xFB,
+  0x28, 0x1F, 0x01, 0xFC, 0x62, 0x23, 0xF7, 0x28, 0x07, 0x0C, 0xED, 0x4F,
+  0xFF, 0xF9, 0xE4, 0x47, 0xFF, 0xF8, 0xDE, 0x40, 0xFF, 0xE6, 0xBC, 0xEB,
+  0xCD, 0xFF, 0x43, 0xF7, 0x40, 0x00, 0x43, 0xF7, 0x40, 0x03, 0x05, 0xC4,
+  0x1D, 0x26, 0xFF, 0x9A, 0x17, 0x99, 0x7B, 0xE0, 0x1B, 0x00, 0xE3, 0x03,
+  0xF7, 0x43, 0xFB, 0x40, 0x03, 0x02, 0x72, 0x56, 0x43, 0xE1, 0x08, 0xDB,
+  0x40, 0x00, 0x43, 0xC3, 0x63, 0xCF, 0xA7, 0xE3, 0x63, 0xD7, 0xE3, 0x02,
+  0xDF, 0x60, 0x1F, 0x23, 0xE7, 0x60, 0x03, 0x43, 0xF3, 0x40, 0x1B, 0x40,
+  0x2B, 0x40, 0x07, 0x20, 0x17, 0x02, 0x64, 0xA4, 0x3A, 0xFF, 0x34, 0xFF,
+  0x23, 0xC0, 0x47, 0xE7, 0x40, 0x03, 0x43, 0xCB, 0xE0, 0x03, 0x03, 0x57,
+  0xCB, 0x44, 0x03, 0x06, 0x47, 0x47, 0x47, 0xFF, 0x36, 0x36, 0x36, 0x60,
+  0x23, 0x02, 0x9F, 0x9F, 0x9F, 0x60, 0x13, 0x40, 0x17, 0x43, 0xFF, 0x40,
+  0x03, 0x43, 0xE7, 0x43, 0xF3, 0xE0, 0x0F, 0x03, 0xC3, 0xEB, 0xE0, 0x0B,
+  0x1F, 0x40, 0x3B, 0x02, 0xEE, 0xE2, 0xB6, 0x63, 0xE3, 0x53, 0xDB, 0x04,
+  0xEF, 0xE7, 0xB2, 0xFF, 0xDF, 0x33, 0xDF, 0x0F, 0xD2, 0xCB, 0x95, 0xFF,
+  0xE2, 0xDA, 0xA4, 0xFF, 0xBE, 0xB7, 0x7F, 0xFF, 0xC7, 0xBF, 0x89, 0xFF,
+  0x63, 0xFF, 0x01, 0xD0, 0x9B, 0x63, 0xF3, 0x4B, 0xFB, 0x44, 0x2F, 0x02,
+  0xD0, 0xC9, 0x91, 0x70, 0x0B, 0x0E, 0xB7, 0xAB, 0xA6, 0xFF, 0xA2, 0x97,
+  0x95, 0xFF, 0x94, 0x8C, 0x89, 0xFF, 0x5A, 0x4F, 0x51, 0x2C, 0x4B, 0x08,
+  0xAA, 0xFF, 0xB3, 0xAA, 0xA9, 0xFF, 0xA9, 0x9D, 0xA0, 0x67, 0xEB, 0x06,
+  0xAE, 0xA6, 0xA7, 0xFF, 0x9F, 0x9E, 0x9E, 0x60, 0x0B, 0x00, 0xA6, 0x3F,
+  0xF3, 0x12, 0xA2, 0x98, 0x95, 0xFF, 0x55, 0x50, 0x4F, 0xFF, 0x85, 0x78,
+  0x71, 0xFF, 0x8F, 0x82, 0x7C, 0xFF, 0x3B, 0x2E, 0x1B, 0x63, 0xE7, 0x4B,
+  0xE3, 0x47, 0xCB, 0x4B, 0xDF, 0xC3, 0xF7, 0x48, 0x0F, 0x44, 0x17, 0x43,
+  0xA7, 0xC3, 0xF3, 0x40, 0x13, 0x58, 0x1F, 0x48, 0x0B, 0xDF, 0xFF, 0x04,
+  0x1C, 0x43, 0xCB, 0x43, 0xFF, 0x57, 0xEB, 0x4B, 0xDF, 0x48, 0x07, 0x53,
+  0xF3, 0x43, 0xEB, 0xC0, 0x03, 0x40, 0x1B, 0x40, 0x0B, 0x50, 0x17, 0x40,
+  0x2B, 0x54, 0x33, 0x44, 0x3B, 0xDF, 0xFF, 0x03, 0xE8, 0x02, 0x58, 0xF8,
+  0x38, 0xE3, 0x00, 0xE7, 0x4B, 0xDF, 0x03, 0x59, 0xF9, 0x39, 0xFF, 0x42,
+  0x1F, 0x40, 0x00, 0x02, 0x3B, 0xC4, 0x22, 0x60, 0x0B, 0x06, 0x3A, 0xDA,
+  0x1A, 0xFF, 0x42, 0xCB, 0x29, 0x60, 0x0B, 0x4C, 0x33, 0x02, 0x4A, 0xEA,
+  0x2A, 0xE3, 0x00, 0xFF, 0x43, 0xE7, 0xC0, 0x03, 0xC4, 0x03, 0x40, 0x0F,
+  0xCB, 0xEF, 0x53, 0xF3, 0x02, 0xE5, 0xE5, 0xE5, 0x7F, 0xFF, 0x0F, 0xFC,
+  0x02, 0xD9, 0xD9, 0xD9, 0x60, 0x03, 0x63, 0xFF, 0x01, 0xD4, 0x51, 0x23,
+  0xE7, 0x00, 0x73, 0x23, 0xE7, 0x02, 0x70, 0xFF, 0xFD, 0x20, 0x03, 0x01,
+  0xFF, 0xFD, 0x28, 0x03, 0x00, 0xFF, 0x40, 0x03, 0x00, 0x6F, 0x23, 0xF3,
+  0x00, 0x6C, 0x34, 0x17, 0x00, 0x69, 0x37, 0xEF, 0x30, 0x1B, 0x00, 0xF2,
+  0x2B, 0xFB, 0x11, 0xE8, 0x4A, 0xFF, 0xF6, 0xDC, 0x3D, 0xFF, 0xF4, 0xD6,
+  0x39, 0xFF, 0xF6, 0xD4, 0x37, 0xFF, 0xE8, 0xBB, 0x2E, 0xE7, 0x38, 0x7F,
+  0xE7, 0x37, 0xBF, 0xE0, 0x37, 0x3F, 0x41, 0x5F, 0xE0, 0x03, 0x00, 0x43,
+  0xFB, 0x00, 0xE2, 0x27, 0xEF, 0xE0, 0x03, 0x03, 0x02, 0xCE, 0xCE, 0xCE,
+  0x63, 0xFF, 0xE4, 0x1F, 0x03, 0x43, 0xEF, 0xE0, 0x03, 0x03, 0x43, 0xFB,
+  0x40, 0x03, 0xE0, 0x03, 0x67, 0xC0, 0x00, 0x43, 0xC3, 0x63, 0xCF, 0x43,
+  0xD3, 0x43, 0xDF, 0x40, 0x07, 0x40, 0x03, 0xA3, 0xDF, 0xE8, 0x00, 0x07,
+  0x23, 0xEB, 0xE0, 0x04, 0x1F, 0x40, 0x2B, 0x20, 0x13, 0x01, 0xA4, 0xD3,
+  0xFF, 0x35, 0xFF, 0x23, 0xC0, 0x10, 0xB8, 0xB8, 0xB8, 0xFF, 0x7B, 0x7B,
+  0x7B, 0xFF, 0x70, 0x70, 0x70, 0xFF, 0xB7, 0xB7, 0xB7, 0xFF, 0xA8, 0x33,
+  0xEF, 0x02, 0xB6, 0xB6, 0xB6, 0x63, 0xDB, 0x44, 0x0F, 0x44, 0x07, 0x02,
+  0xCB, 0xCB, 0xCB, 0x6F, 0x5F, 0x43, 0xF7, 0xC8, 0x0F, 0x02, 0x89, 0x89,
+  0x89, 0x64, 0x17, 0x43, 0xC3, 0x43, 0xE3, 0x43, 0xDF, 0x40, 0x07, 0x47,
+  0xD3, 0x40, 0x13, 0x40, 0x03, 0x40, 0x13, 0xC0, 0x03, 0x40, 0x17, 0x40,
+  0x0B, 0x40, 0x17, 0x40, 0x03, 0x40, 0x2B, 0x40, 0x03, 0x06, 0xFF, 0xFC,
+  0xD1, 0xFF, 0xE6, 0xDA, 0xAF, 0x7F, 0xFF, 0x08, 0x08, 0x02, 0xB3, 0xAD,
+  0x76, 0x63, 0xE3, 0x47, 0xDF, 0x44, 0x0F, 0x02, 0xF4, 0xE8, 0xBD, 0x23,
+  0xEF, 0x04, 0xAA, 0xFF, 0xF6, 0xE9, 0xBE, 0x60, 0x23, 0x4C, 0x2B, 0x02,
+  0xE3, 0xDD, 0xA4, 0x2B, 0xFB, 0x58, 0x2F, 0x10, 0xAF, 0xFF, 0xD5, 0xC9,
+  0x9E, 0xFF, 0xB4, 0xA9, 0xA6, 0xFF, 0x9F, 0x91, 0x8E, 0xFF, 0xB9, 0xB5,
+  0xB4, 0x23, 0xF7, 0x04, 0xA5, 0xFF, 0xA6, 0x9E, 0x9B, 0x30, 0x03, 0x1E,
+  0x78, 0xFF, 0x96, 0x96, 0x96, 0xFF, 0xAB, 0xA5, 0xA8, 0xFF, 0x8F, 0x87,
+  0x86, 0xFF, 0x83, 0x7B, 0x77, 0xFF, 0x9F, 0x97, 0x96, 0xFF, 0x91, 0x87,
+  0x87, 0xFF, 0x5F, 0x57, 0x53, 0xFF, 0xB4, 0x20, 0x23, 0x06, 0xB7, 0xB2,
+  0xB0, 0xFF, 0x5F, 0x4E, 0x4B, 0x73, 0xEB, 0x4F, 0xF3, 0x4B, 0xE3, 0x47,
+  0xDB, 0x4B, 0x93, 0x48, 0x0F, 0x57, 0xEB, 0x00, 0x6E, 0x37, 0xDF, 0x40,
+  0x1B, 0x02, 0x63, 0x4E, 0x2D, 0x68, 0x1B, 0x02, 0x3D, 0x30, 0x1D, 0x63,
+  0xFF, 0x54, 0x23, 0x50, 0x33, 0x58, 0x17, 0x43, 0xC3, 0x43, 0xFF, 0x02,
+  0x99, 0x7E, 0x47, 0x63, 0xD7, 0x47, 0xDB, 0x43, 0xDF, 0xC0, 0x03, 0x50,
+  0x0B, 0x02, 0xA0, 0x85, 0x4E, 0x60, 0x0F, 0x02, 0xA3, 0x88, 0x51, 0x7F,
+  0xFF, 0x0C, 0x10, 0x40, 0x23, 0x02, 0xB2, 0x8E, 0x58, 0x60, 0x3B, 0x02,
+  0x45, 0xCE, 0x2C, 0x62, 0x17, 0x02, 0x1F, 0x83, 0x1F, 0xEF, 0x00, 0xD3,
+  0x02, 0x4B, 0xEB, 0x2B, 0xFF, 0x00, 0xFF, 0x07, 0xE8, 0x40, 0x00, 0x47,
+  0xEB, 0x40, 0x07, 0x54, 0x07, 0x06, 0x14, 0x78, 0x14, 0xFF, 0x54, 0xF4,
+  0x34, 0xEC, 0x00, 0x13, 0x47, 0xFF, 0xC3, 0xE7, 0x4F, 0xF3, 0x40, 0x0B,
+  0xC0, 0x03, 0xC7, 0xF3, 0x43, 0xFB, 0x0A, 0xE3, 0xE3, 0xE3, 0xFF, 0xE0,
+  0xE0, 0xE0, 0xFF, 0xDD, 0xDD, 0xDD, 0x7F, 0xFF, 0x3B, 0xBC, 0x02, 0xDB,
+  0xDB, 0xDB, 0x7F, 0xFF, 0x1C, 0xBC, 0x02, 0xEA, 0xD5, 0x4B, 0x2B, 0xE7,
+  0x04, 0x64, 0xFF, 0xFB, 0xFC, 0x61, 0x37, 0xDF, 0x04, 0x61, 0xFF, 0xFE,
+  0xFE, 0x64, 0x24, 0x0F, 0x23, 0xEF, 0x40, 0x07, 0x27, 0xF3, 0x1E, 0xFD,
+  0xF8, 0x5F, 0xFF, 0xFC, 0xF4, 0x59, 0xFF, 0xFB, 0xE7, 0x47, 0xFF, 0xFC,
+  0xE0, 0x3E, 0xFF, 0xFA, 0xDC, 0x3A, 0xFF, 0xFA, 0xD8, 0x38, 0xFF, 0xFC,
+  0xD6, 0x37, 0xFF, 0xE9, 0xB9, 0x2C, 0xE3, 0x38, 0x7F, 0xE3, 0x37, 0xBF,
+  0xE0, 0x37, 0x3F, 0x41, 0x57, 0xE0, 0x03, 0x00, 0x43, 0xEB, 0x43, 0xFB,
+  0x47, 0xF3, 0x40, 0x0B, 0x40, 0x07, 0x43, 0xF7, 0x40, 0x03, 0x42, 0x53,
+  0xE0, 0x03, 0x2B, 0xE0, 0x0F, 0x00, 0x43, 0xFB, 0x43, 0xEF, 0xE0, 0x07,
+  0x03, 0xE0, 0x0B, 0x2F, 0x43, 0xC3, 0x63, 0xCB, 0x43, 0xEF, 0x43, 0xD3,
+  0xE0, 0x03, 0x03, 0x23, 0xDF, 0xE0, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x27,
+  0x40, 0x0F, 0x20, 0x03, 0xFF, 0x37, 0xFF, 0x23, 0xC0, 0x02, 0x75, 0x75,
+  0x75, 0x63, 0xCB, 0x04, 0x43, 0x43, 0x43, 0xFF, 0xA2, 0x27, 0x1F, 0x02,
+  0x83, 0x83, 0x83, 0x70, 0x0B, 0x5F, 0xDF, 0x47, 0xDF, 0xC0, 0x03, 0x43,
+  0xFB, 0x54, 0x07, 0x02, 0x8A, 0x8A, 0x8A, 0x7F, 0xFF, 0x0C, 0x1C, 0x02,
+  0x3D, 0x3D, 0x3D, 0x64, 0x1F, 0x43, 0xCB, 0xC0, 0x03, 0x43, 0xDF, 0xE0,
+  0x07, 0x03, 0xC0, 0x1B, 0x43, 0xEB, 0x40, 0x03, 0x40, 0x0F, 0xC0, 0x23,
+  0x40, 0x0B, 0x04, 0xE2, 0xD6, 0xAA, 0xFF, 0xD8, 0x3F, 0xC7, 0x00, 0xD7,
+  0x3F, 0xE7, 0x00, 0xCF, 0x27, 0xD3, 0x02, 0xDE, 0xD3, 0xA7, 0x23, 0xD7,
+  0x9F, 0xFF, 0x0F, 0xF8, 0x0E, 0xE1, 0xDB, 0xA3, 0xFF, 0xB4, 0xAE, 0x76,
+  0xFF, 0xDF, 0xD8, 0xA2, 0xFF, 0xBB, 0xB4, 0x7E, 0xE3, 0x00, 0xF7, 0x01,
+  0xCB, 0xBF, 0x9F, 0xFF, 0x0C, 0x1C, 0x44, 0x1B, 0x0E, 0x9F, 0x91, 0x8C,
+  0xFF, 0x7E, 0x70, 0x6E, 0xFF, 0x6A, 0x62, 0x67, 0xFF, 0x89, 0x7D, 0x79,
+  0x6B, 0xDB, 0x06, 0x98, 0x98, 0x98, 0xFF, 0x80, 0x79, 0x75, 0x6B, 0xEF,
+  0x02, 0xBC, 0xBA, 0xBA, 0x30, 0x1F, 0x00, 0xAC, 0x27, 0xEB, 0x04, 0x7F,
+  0xFF, 0xA6, 0x98, 0x93, 0x27, 0xF7, 0x00, 0x75, 0x2B, 0xE3, 0x08, 0x56,
+  0xFF, 0x7E, 0x6C, 0x66, 0xFF, 0x80, 0x75, 0x71, 0x63, 0xC3, 0x4B, 0xF7,
+  0x47, 0xDF, 0x47, 0xD3, 0x00, 0x6B, 0x37, 0xDB, 0xC3, 0xFF, 0x4F, 0xFB,
+  0x02, 0x92, 0x72, 0x43, 0x64, 0x13, 0x47, 0xEB, 0x48, 0x2B, 0x48, 0x0B,
+  0x40, 0x1F, 0x44, 0x0B, 0x40, 0x37, 0x44, 0x27, 0x43, 0xFF, 0xE0, 0x03,
+  0x03, 0x47, 0xFF, 0x5B, 0xEB, 0x02, 0xAE, 0x8A, 0x54, 0xE0, 0x00, 0x17,
+  0x02, 0xAB, 0x87, 0x51, 0xE0, 0x00, 0x0B, 0xC0, 0x2B, 0x53, 0xFF, 0x01,
+  0x2B, 0x8F, 0x93, 0xC7, 0x40, 0x00, 0x44, 0x03, 0x5F, 0xD3, 0xDF, 0xFF,
+  0x04, 0x0C, 0xC0, 0x00, 0x07, 0x29, 0x8D, 0x29, 0xFF, 0x15, 0x79, 0x15,
+  0xFF, 0xD4, 0x03, 0x48, 0x2B, 0x53, 0xFF, 0x50, 0x0B, 0x4F, 0xFF, 0xC7,
+  0xE3, 0xDB, 0xDF, 0x4B, 0xE7, 0x5B, 0xE7, 0x40, 0x0F, 0x43, 0xFB, 0x5B,
+  0xFF, 0x43, 0xFB, 0x00, 0xDB, 0x23, 0xF3, 0x58, 0x2F, 0x02, 0xD4, 0xD4,
+  0xD4, 0x73, 0xFB, 0x05, 0xC4, 0xC4, 0xC4, 0xFF, 0xEA, 0xD5, 0x37, 0xE7,
+  0x33, 0xD3, 0x02, 0xFD, 0xFB, 0x53, 0x3B, 0xD7, 0x03, 0x51, 0xFF, 0xFE,
+  0xF7, 0x2C, 0x0F, 0x00, 0xF8, 0x33, 0xDF, 0x01, 0xF6, 0x54, 0xBF, 0xFF,
+  0x13, 0xEC, 0x04, 0x54, 0xFF, 0xFE, 0xF1, 0x51, 0x23, 0xFB, 0x3B, 0xF3,
+  0x11, 0xD7, 0x36, 0xFF, 0xF6, 0xD0, 0x30, 0xFF, 0xF5, 0xCC, 0x2D, 0xFF,
+  0xF6, 0xCA, 0x2C, 0xFF, 0xE6, 0xB4, 0x28, 0xE3, 0x38, 0x7F, 0xE3, 0x37,
+  0xBF, 0xE0, 0x37, 0x3F, 0xC1, 0x63, 0xE0, 0x03, 0x00, 0xE3, 0x03, 0xF3,
+  0x43, 0xF7, 0xC0, 0x03, 0xE0, 0x03, 0x23, 0xE0, 0x1B, 0x00, 0x05, 0x68,
+  0x5B, 0x52, 0xFF, 0x49, 0x40, 0xED, 0x09, 0xD3, 0xE0, 0x03, 0x00, 0xE7,
+  0x00, 0xDF, 0x43, 0xF7, 0x23, 0xCF, 0xE0, 0x00, 0x0F, 0x20, 0x0B, 0x60,
+  0x13, 0x43, 0xEF, 0x40, 0x03, 0xA0, 0x1F, 0xE0, 0x00, 0x07, 0x20, 0x1F,
+  0x40, 0x2B, 0x00, 0x8D, 0xFF, 0x36, 0xFF, 0x23, 0xC0, 0x00, 0x78, 0x2F,
+  0x07, 0x44, 0x03, 0x08, 0x72, 0x72, 0x72, 0xFF, 0x4E, 0x4E, 0x4E, 0xFF,
+  0x2A, 0x30, 0xF7, 0x03, 0x29, 0x29, 0x29, 0xFF, 0x47, 0xFB, 0x43, 0xFB,
+  0x02, 0xAF, 0xAF, 0xAF, 0x70, 0x07, 0x00, 0x57, 0x3F, 0xAF, 0x00, 0x5E,
+  0x37, 0xFB, 0x4C, 0x0F, 0x06, 0x4A, 0x4A, 0x4A, 0xFF, 0x3C, 0x3C, 0x3C,
+  0x7F, 0xFF, 0x00, 0x04, 0xC3, 0xCB, 0xC0, 0x07, 0x47, 0xE7, 0x43, 0xE7,
+  0x40, 0x03, 0x40, 0x33, 0xE0, 0x03, 0x03, 0xC0, 0x23, 0x40, 0x07, 0xC0,
+  0x17, 0x5B, 0xCF, 0x02, 0xE3, 0xDD, 0xA6, 0x63, 0xDB, 0x58, 0x0B, 0x02,
+  0xFF, 0xFF, 0xD1, 0x23, 0xEF, 0x03, 0xA0, 0xFF, 0xC7, 0xC1, 0x94, 0x07,
+  0x53, 0xEF, 0x00, 0xF1, 0x34, 0x03, 0x4F, 0xEF, 0x48, 0x13, 0x50, 0x1B,
+  0x5B, 0xF7, 0x48, 0x03, 0x12, 0xC6, 0xC0, 0x89, 0xFF, 0x50, 0x4B, 0x43,
+  0xFF, 0x91, 0x89, 0x87, 0xFF, 0x4E, 0x42, 0x41, 0xFF, 0xA4, 0x94, 0x96,
+  0x3B, 0xD7, 0x00, 0x8D, 0x64, 0x03, 0x00, 0x55, 0x20, 0xCB, 0x02, 0x94,
+  0x89, 0x86, 0x64, 0x03, 0x4F, 0xFF, 0x01, 0x4B, 0x44, 0x20, 0x1F, 0x05,
+  0x90, 0x85, 0xFF, 0xB3, 0xA3, 0xA3, 0x60, 0x1F, 0x06, 0xB3, 0x8C, 0x80,
+  0xFF, 0x9F, 0x9A, 0x9B, 0x67, 0xF7, 0xC7, 0xF3, 0x43, 0xEF, 0x53, 0xF3,
+  0x43, 0x97, 0x40, 0x13, 0x44, 0x0F, 0x40, 0x0B, 0x48, 0x17, 0x43, 0xEB,
+  0x02, 0x37, 0x2A, 0x17, 0x60, 0x07, 0x40, 0x13, 0xC4, 0x07, 0x40, 0x0B,
+  0x50, 0x33, 0x48, 0x07, 0x40, 0x27, 0x40, 0x0F, 0x40, 0x3B, 0x40, 0x0F,
+  0x4C, 0x2B, 0x40, 0x0F, 0xE0, 0x03, 0x03, 0x40, 0x17, 0xC0, 0x03, 0x40,
+  0x17, 0x01, 0x49, 0xE9, 0x8B, 0xCF, 0xE0, 0x03, 0x00, 0xD7, 0xFB, 0x02,
+  0x18, 0x7C, 0x18, 0x67, 0xE7, 0x03, 0x55, 0xF5, 0x35, 0xFF, 0xDF, 0xF3,
+  0x40, 0x00, 0x5C, 0x2F, 0x02, 0x1C, 0x80, 0x1C, 0x60, 0x17, 0x43, 0xDF,
+  0x5B, 0xDF, 0x4F, 0xD7, 0x06, 0xE4, 0xE4, 0xE4, 0xFF, 0xDF, 0xDF, 0xDF,
+  0x6B, 0xE3, 0x48, 0x17, 0x57, 0xDF, 0x43, 0xEB, 0x4B, 0xEF, 0x44, 0x27,
+  0x40, 0x03, 0xC3, 0xFF, 0x02, 0xD2, 0xD2, 0xD2, 0x7B, 0xFF, 0x01, 0xFF,
+  0xF5, 0x3F, 0xF3, 0x10, 0xF0, 0x48, 0xFF, 0xFF, 0xEC, 0x45, 0xFF, 0xFF,
+  0xE7, 0x42, 0xFF, 0xFB, 0xDE, 0x3C, 0xFF, 0xFA, 0xDA, 0x3B, 0xDF, 0x1F,
+  0xD2, 0x36, 0xFF, 0xF3, 0xCB, 0x31, 0xFF, 0xF5, 0xCB, 0x34, 0xFF, 0xFB,
+  0xD3, 0x3C, 0xFF, 0xFD, 0xCD, 0x36, 0xFF, 0xFF, 0xCC, 0x35, 0xFF, 0xFF,
+  0xCB, 0x35, 0xFF, 0xFD, 0xC7, 0x33, 0xFF, 0xFB, 0x04, 0xC3, 0x31, 0xFF,
+  0xFA, 0xBF, 0x2D, 0x2F, 0xF7, 0x76, 0xBF, 0xE0, 0x37, 0x7F, 0x41, 0x4F,
+  0xE0, 0x0F, 0x00, 0x06, 0x7C, 0x40, 0x42, 0xFF, 0x57, 0x2D, 0x2D, 0xE0,
+  0x14, 0x23, 0xE0, 0x13, 0x00, 0x00, 0x68, 0xE3, 0x2A, 0xFF, 0x43, 0xD7,
+  0x40, 0x03, 0x43, 0xDB, 0x40, 0x03, 0xE3, 0x04, 0xFB, 0x23, 0xF3, 0xC0,
+  0x03, 0x40, 0x1B, 0x40, 0x03, 0x01, 0x65, 0xA5, 0xFF, 0x35, 0xFF, 0x23,
+  0xC0, 0x47, 0xD7, 0x00, 0x74, 0xFF, 0x32, 0xFF, 0x5F, 0xC0, 0xE0, 0x77,
+  0x3F, 0x4F, 0x53, 0xC0, 0x03, 0x47, 0x57, 0xC0, 0x0B, 0x40, 0x07, 0xCB,
+  0x83, 0x40, 0x07, 0x01, 0x73, 0x5E, 0xFF, 0x01, 0xFF, 0x2F, 0xB4, 0x40,
+  0x1B, 0x40, 0x03, 0x40, 0x17, 0x50, 0xFB, 0xC0, 0x03, 0x00, 0xA6, 0x39,
+  0x07, 0xDF, 0xFF, 0x21, 0x00, 0x06, 0x21, 0x4B, 0x21, 0xFF, 0x1F, 0x47,
+  0x1F, 0x65, 0x03, 0xC0, 0x1F, 0x40, 0x07, 0x55, 0x13, 0x45, 0x17, 0x5D,
+  0x2B, 0x06, 0x8F, 0x8F, 0x8F, 0xFF, 0x10, 0x10, 0x18, 0xE0, 0x00, 0x03,
+  0x06, 0x0F, 0x0F, 0x16, 0xFF, 0x0E, 0x0E, 0x16, 0x60, 0x0F, 0x02, 0x0E,
+  0x0E, 0x17, 0x60, 0x0F, 0x40, 0x1F, 0x02, 0x09, 0x09, 0x0E, 0x20, 0x0B,
+  0x00, 0x17, 0x20, 0x0B, 0x04, 0x1C, 0xFF, 0x11, 0x11, 0x21, 0x20, 0x07,
+  0x00, 0x17, 0x60, 0x13, 0x40, 0x1B, 0x42, 0xBF, 0xE0, 0x33, 0x03, 0x4B,
+  0xF3, 0xC7, 0xEB, 0x47, 0xEF, 0x40, 0x0B, 0xC0, 0x03, 0x48, 0x07, 0x40,
+  0x03, 0x40, 0x0F, 0xE4, 0x03, 0x27, 0x50, 0x07, 0x02, 0xE1, 0xE1, 0xE1,
+  0x7F, 0xFF, 0x20, 0x0C, 0x01, 0xFF, 0xFD, 0x23, 0xFF, 0x05, 0xF9, 0x46,
+  0xFF, 0xFD, 0xF9, 0x43, 0x20, 0x03, 0x00, 0x41, 0x28, 0x07, 0x27, 0xE7,
+  0x00, 0xFC, 0x20, 0x03, 0x05, 0xFD, 0x3E, 0xFF, 0xFB, 0xFF, 0x3E, 0x37,
+  0xFF, 0x00, 0x3D, 0x30, 0x17, 0x00, 0x3C, 0x28, 0x13, 0x04, 0x3A, 0xFF,
+  0xFF, 0xF4, 0x37, 0x24, 0x2B, 0x00, 0x34, 0x24, 0x2B, 0x08, 0x32, 0xFF,
+  0xFF, 0xE5, 0x2D, 0xFF, 0xFD, 0xD8, 0x27, 0xE0, 0x34, 0xBB, 0xE0, 0x33,
+  0xF7, 0xE0, 0xFF, 0x40, 0x3B, 0x43, 0xBF, 0x40, 0x03, 0x42, 0xCB, 0xE0,
+  0x0B, 0x03, 0x44, 0x1B, 0xE0, 0x03, 0x17, 0x01, 0x68, 0x68, 0x9F, 0xFF,
+  0x20, 0x28, 0x40, 0x33, 0x40, 0x1B, 0x40, 0x07, 0x40, 0x03, 0xE0, 0x03,
+  0x23, 0xE0, 0x03, 0x0B, 0x40, 0x23, 0xE0, 0x03, 0x0F, 0xE0, 0x47, 0x3F,
+  0x43, 0xC7, 0x06, 0x2C, 0x22, 0x13, 0xFF, 0x27, 0x1E, 0x11, 0xE0, 0x04,
+  0x03, 0x06, 0x75, 0x8E, 0x11, 0xFF, 0x5E, 0x72, 0x0D, 0x60, 0x1B, 0xE0,
+  0x0B, 0x1F, 0x40, 0x13, 0xE3, 0x03, 0xFF, 0xC0, 0x97, 0x02, 0x2C, 0x2C,
+  0x2C, 0x63, 0xF7, 0x02, 0x3D, 0x8A, 0x3D, 0x60, 0x03, 0x44, 0x03, 0x40,
+  0xDF, 0xDF, 0xFF, 0x08, 0xFC, 0x4D, 0x03, 0x02, 0x14, 0x2D, 0x14, 0xFF,
+  0x00, 0xFF, 0x21, 0x00, 0x43, 0xEF, 0x01, 0x11, 0x11, 0x83, 0xCF, 0x43,
+  0xE7, 0x02, 0x0A, 0x0A, 0x0F, 0x23, 0xD7, 0x00, 0x10, 0x23, 0xEF, 0x00,
+  0x1D, 0x20, 0x07, 0x08, 0x18, 0xFF, 0x08, 0x08, 0x0D, 0xFF, 0x36, 0x2A,
+  0x50, 0x60, 0x0B, 0x40, 0x0F, 0x02, 0x10, 0x10, 0x1D, 0x20, 0x13, 0x04,
+  0x0C, 0xFF, 0x3C, 0x30, 0x56, 0x20, 0x0B, 0x83, 0xFF, 0xFF, 0x33, 0xFF,
+  0x07, 0x40, 0x43, 0xFF, 0xCF, 0xEF, 0xE0, 0x07, 0x07, 0x4F, 0xFF, 0x40,
+  0x13, 0x40, 0x07, 0x44, 0x07, 0x5B, 0xF3, 0x43, 0xF7, 0x50, 0x03, 0x06,
+  0xDA, 0xDA, 0xDA, 0xFF, 0xD1, 0xD1, 0xD1, 0x23, 0xFF, 0x00, 0x50, 0x20,
+  0x03, 0x00, 0x6E, 0x20, 0x03, 0x00, 0x6B, 0x2F, 0xFB, 0xFB, 0x19, 0xF3,
+  0x0E, 0xFB, 0xE2, 0x40, 0xFF, 0xFA, 0xDD, 0x39, 0xFF, 0xF9, 0xD7, 0x33,
+  0xFF, 0xF8, 0xC7, 0x21, 0x63, 0x87, 0xE0, 0x33, 0xBF, 0x43, 0xC7, 0xE0,
+  0xFF, 0x74, 0x3F, 0x42, 0xDB, 0x42, 0xFB, 0x43, 0xA7, 0x40, 0x03, 0x02,
+  0xFC, 0xEE, 0x4B, 0x60, 0x07, 0x40, 0x0B, 0x40, 0x03, 0x43, 0xBB, 0x40,
+  0x07, 0x40, 0x27, 0x40, 0x03, 0x02, 0xFF, 0xFF, 0xB5, 0x60, 0x23, 0x40,
+  0x0B, 0xC0, 0x03, 0xE0, 0x03, 0x3F, 0x02, 0xBC, 0x99, 0x80, 0x60, 0x2F,
+  0x40, 0x33, 0x40, 0x03, 0xE0, 0x07, 0x3F, 0x02, 0xD8, 0xAF, 0x93, 0x60,
+  0x23, 0xC0, 0x3B, 0x40, 0x07, 0xE0, 0x03, 0x3F, 0x02, 0x37, 0x37, 0x37,
+  0x60, 0x37, 0x40, 0x3B, 0x40, 0x03, 0xE0, 0x07, 0x3F, 0x02, 0x3F, 0x3F,
+  0x3F, 0x60, 0x23, 0x40, 0x37, 0x40, 0x03, 0x43, 0xFF, 0x05, 0xBC, 0x16,
+  0x16, 0xFF, 0x91, 0x11, 0x83, 0xD3, 0x06, 0x31, 0x5B, 0x8E, 0xFF, 0x2A,
+  0x4E, 0x7A, 0xE3, 0x00, 0xFF, 0x02, 0x36, 0x2A, 0x15, 0xE0, 0x00, 0x03,
+  0xC4, 0x13, 0x06, 0x3F, 0x2E, 0x18, 0xFF, 0x41, 0x31, 0x1A, 0x63, 0xFF,
+  0x01, 0x1F, 0x46, 0x83, 0xDF, 0x40, 0x4B, 0x02, 0x10, 0x24, 0x10, 0x63,
+  0xEF, 0x43, 0xFB, 0x47, 0xEB, 0x02, 0x2D, 0x66, 0x2D, 0x6C, 0xAB, 0x02,
+  0x0D, 0x1D, 0x0D, 0x7F, 0xFF, 0x05, 0x28, 0x40, 0x23, 0x02, 0x13, 0x2B,
+  0x13, 0x60, 0x23, 0x44, 0x17, 0x02, 0x84, 0x84, 0x84, 0x63, 0xC3, 0x06,
+  0x09, 0x09, 0x0F, 0xFF, 0x3A, 0x2E, 0x54, 0x63, 0xD3, 0x43, 0xD7, 0x44,
+  0x13, 0x02, 0x0E, 0x0E, 0x15, 0x20, 0x17, 0x00, 0x0E, 0x60, 0x0F, 0x0A,
+  0x1E, 0x18, 0x2B, 0xFF, 0x12, 0x12, 0x1B, 0xFF, 0x0D, 0x0D, 0x15, 0xE3,
+  0x00, 0xFB, 0x40, 0x13, 0x02, 0x10, 0x10, 0x19, 0xE2, 0x38, 0xFF, 0x4F,
+  0xFB, 0x00, 0xF3, 0xBF, 0xFB, 0x40, 0x07, 0x43, 0xEF, 0x40, 0x03, 0x43,
+  0xF3, 0x40, 0x03, 0x43, 0xF7, 0x4C, 0x1B, 0xDB, 0xF3, 0x43, 0xF7, 0x4C,
+  0x07, 0x06, 0xD5, 0xD5, 0xD5, 0xFF, 0xCD, 0xCD, 0xCD, 0x23, 0xF7, 0x2F,
+  0xE7, 0xFB, 0x22, 0xF3, 0x02, 0xF8, 0xD7, 0x39, 0x2C, 0x1B, 0x07, 0x33,
+  0xFF, 0xF7, 0xCD, 0x2F, 0xFF, 0xF8, 0xBE, 0xE3, 0xFF, 0xBE, 0xFF, 0x43,
+  0x63, 0x42, 0xDB, 0xC0, 0x03, 0x43, 0x8F, 0x40, 0x0B, 0x43, 0xEB, 0x02,
+  0xF8, 0xAF, 0x2B, 0x60, 0x0B, 0x43, 0x8B, 0xE0, 0x07, 0x03, 0x40, 0x23,
+  0x40, 0x03, 0xE0, 0x0F, 0x3F, 0x43, 0xEB, 0x02, 0xAF, 0x8E, 0x77, 0x60,
+  0x23, 0xE0, 0x07, 0x3B, 0x40, 0x0F, 0x40, 0x3B, 0x40, 0x03, 0xE0, 0x0F,
+  0x3F, 0x43, 0xEB, 0x01, 0x34, 0x34, 0x9F, 0xFF, 0x4C, 0x64, 0x40, 0x2F,
+  0xE0, 0x07, 0x03, 0x40, 0x3B, 0x4F, 0x43, 0x03, 0xB5, 0xB5, 0xB5, 0xFF,
+  0x58, 0x8F, 0x02, 0x11, 0x8E, 0x6B, 0xE3, 0x08, 0xFF, 0xC4, 0x1B, 0x44,
+  0x07, 0xC3, 0xFF, 0x40, 0x27, 0x03, 0x0C, 0x6B, 0x50, 0xFF, 0x4C, 0x13,
+  0x0B, 0x26, 0x58, 0x26, 0xFF, 0x18, 0x38, 0x18, 0xFF, 0x11, 0x26, 0x11,
+  0xFF, 0x43, 0xD3, 0x59, 0x0F, 0x03, 0x23, 0x50, 0x23, 0xFF, 0xCC, 0x07,
+  0x51, 0x07, 0x40, 0x17, 0x43, 0xF7, 0x54, 0xF3, 0x40, 0x0B, 0xDF, 0xFF,
+  0x21, 0x00, 0x40, 0x0B, 0x02, 0x0D, 0x0D, 0x12, 0x63, 0xE7, 0x43, 0xCF,
+  0x02, 0x21, 0x1B, 0x2E, 0x23, 0xF7, 0x4B, 0xF3, 0x00, 0x11, 0x23, 0xDB,
+  0x04, 0x10, 0xFF, 0x46, 0x3A, 0x60, 0x60, 0x17, 0x40, 0x1B, 0x4C, 0x1B,
+  0x47, 0xEF, 0x01, 0x08, 0x08, 0xCC, 0x0B, 0x48, 0x0B, 0x00, 0x1A, 0xE3,
+  0x38, 0xFF, 0x43, 0xDF, 0x43, 0xEF, 0x43, 0xFB, 0x40, 0x03, 0x40, 0x0B,
+  0x44, 0x13, 0x40, 0x17, 0x4B, 0xF3, 0x4B, 0xEB, 0x01, 0xDC, 0xDC, 0xFB,
+  0x01, 0xF3, 0x43, 0xFF, 0xD0, 0x0F, 0x56, 0xDF, 0x02, 0xFC, 0xFB, 0x4F,
+  0x24, 0x03, 0x5B, 0xEF, 0x40, 0x03, 0xFB, 0x19, 0xF3, 0x0D, 0xFB, 0xD5,
+  0x38, 0xFF, 0xFD, 0xD2, 0x35, 0xFF, 0xFC, 0xCF, 0x32, 0xFF, 0xFC, 0xBD,
+  0xE3, 0xFF, 0xC2, 0xFF, 0x43, 0x83, 0xE3, 0x07, 0x5F, 0xE0, 0x03, 0x0F,
+  0x40, 0x1F, 0xE0, 0x07, 0x03, 0xC4, 0x27, 0xC0, 0x17, 0xE0, 0x03, 0x2F,
+  0xE0, 0x07, 0x0B, 0xC0, 0x23, 0xE0, 0x03, 0x07, 0xE0, 0x3B, 0x3F, 0xE7,
+  0x03, 0xFF, 0x43, 0xD7, 0xC7, 0xFF, 0x02, 0x49, 0x49, 0x49, 0x64, 0x3F,
+  0xC3, 0xFF, 0x47, 0xF3, 0xC3, 0xFF, 0xC4, 0x2F, 0x40, 0x3B, 0x00, 0xB3,
+  0xFF, 0x02, 0xFF, 0x21, 0x00, 0x43, 0xCF, 0x47, 0xF7, 0x00, 0x85, 0xFF,
+  0x02, 0xFF, 0x21, 0x00, 0x40, 0x13, 0x02, 0x38, 0x7F, 0x38, 0x7F, 0xFF,
+  0x21, 0x00, 0x06, 0x35, 0x79, 0x35, 0xFF, 0x1C, 0x40, 0x1C, 0xFF, 0x04,
+  0xFF, 0x21, 0x00, 0x01, 0x0E, 0x0E, 0x43, 0xFF, 0x00, 0x0B, 0x63, 0xE3,
+  0x47, 0xCF, 0x02, 0x10, 0x10, 0x14, 0x60, 0x03, 0x01, 0x0D, 0x0D, 0x40,
+  0x07, 0x50, 0x13, 0x00, 0x0F, 0xA0, 0x0B, 0x00, 0x1B, 0x24, 0x27, 0x00,
+  0x12, 0x60, 0x27, 0x02, 0x0F, 0x0F, 0x1A, 0x20, 0x23, 0x00, 0x19, 0x2C,
+  0x37, 0xE3, 0x39, 0xFF, 0x43, 0xE3, 0x43, 0xF3, 0xC0, 0x03, 0xC7, 0xF3,
+  0x40, 0x17, 0xFB, 0x0B, 0xF3, 0x43, 0xFB, 0x40, 0x03, 0x54, 0x1F, 0x06,
+  0xCC, 0xCC, 0xCC, 0xFF, 0xF9, 0xF9, 0x44, 0x2B, 0xF7, 0xFB, 0x21, 0xF3,
+  0x43, 0xFB, 0x01, 0xFE, 0xD1, 0x30, 0x03, 0x00, 0xCF, 0x34, 0x03, 0x00,
+  0xBB, 0xE3, 0xFF, 0xBA, 0xFF, 0xC3, 0xA7, 0x47, 0x4B, 0xC0, 0x03, 0x80,
+  0x00, 0x00, 0xB5, 0x60, 0x1B, 0x40, 0x13, 0x43, 0xA7, 0x80, 0x00, 0x80,
+  0x13, 0x40, 0x33, 0x40, 0x13, 0x40, 0x1B, 0x40, 0x0B, 0x40, 0x03, 0x40,
+  0x0B, 0xC0, 0x03, 0x01, 0xE2, 0xC0, 0x3B, 0xD3, 0x2B, 0xE7, 0xC0, 0x17,
+  0x40, 0x2B, 0xE0, 0x03, 0x13, 0x40, 0x17, 0x40, 0x13, 0x40, 0x2F, 0x40,
+  0x0B, 0x40, 0x03, 0x40, 0x0B, 0xC0, 0x03, 0x02, 0x45, 0x45, 0x45, 0x63,
+  0xBB, 0xC0, 0x17, 0x40, 0x2B, 0xE0, 0x03, 0x13, 0x40, 0x17, 0x40, 0x13,
+  0x40, 0x2F, 0x4F, 0xC3, 0xC3, 0xE3, 0xE3, 0x0B, 0xFF, 0x4B, 0xE7, 0xC0,
+  0x1F, 0xC3, 0xFF, 0x40, 0x27, 0x47, 0xFF, 0x40, 0x3B, 0x00, 0x72, 0x38,
+  0xF7, 0x43, 0xEF, 0x03, 0x7D, 0x7D, 0x7D, 0xFF, 0x43, 0xEB, 0x02, 0x29,
+  0x5E, 0x29, 0x7C, 0xE3, 0x40, 0x5B, 0x06, 0x12, 0x2B, 0x12, 0xFF, 0x3A,
+  0x84, 0x3A, 0x7B, 0x27, 0x06, 0x79, 0x79, 0x79, 0xFF, 0x2E, 0x6A, 0x2E,
+  0x7F, 0xFF, 0x01, 0x10, 0x02, 0x5B, 0x5B, 0x5B, 0x6C, 0x2B, 0x50, 0x07,
+  0x43, 0xE3, 0x80, 0x03, 0x4B, 0xEF, 0x00, 0x13, 0x23, 0xE3, 0x00, 0x0B,
+  0x20, 0x03, 0x00, 0x0E, 0x27, 0xE7, 0x00, 0x0D, 0x60, 0x07, 0x40, 0x1B,
+  0x8C, 0x0B, 0x50, 0x17, 0x40, 0x2B, 0x44, 0x23, 0x80, 0x13, 0x02, 0x0F,
+  0x0F, 0x15, 0xE7, 0x38, 0xFF, 0x57, 0xFB, 0x53, 0xDF, 0x47, 0xEF, 0x40,
+  0x07, 0x54, 0x03, 0x43, 0xFB, 0xFB, 0x0F, 0xF3, 0x58, 0x13, 0x57, 0xFB,
+  0x58, 0x17, 0x67, 0xFF, 0x01, 0xF4, 0x39, 0xFB, 0x24, 0xF3, 0x0E, 0xF8,
+  0xCA, 0x2E, 0xFF, 0xF8, 0xC6, 0x2C, 0xFF, 0xFC, 0xC9, 0x30, 0xFF, 0xFF,
+  0xBB, 0x24, 0xE0, 0x38, 0xBF, 0xEF, 0xFF, 0x78, 0xFF, 0xC7, 0x8F, 0x42,
+  0xEF, 0x80, 0x00, 0x8F, 0xDF, 0x50, 0x07, 0xCB, 0xFB, 0x40, 0x1B, 0xC0,
+  0x0F, 0xC0, 0x2F, 0x40, 0x07, 0x43, 0x83, 0x40, 0x07, 0x40, 0x03, 0x40,
+  0x23, 0x00, 0xE2, 0xA3, 0xF7, 0x50, 0x03, 0x40, 0x03, 0xCB, 0xFB, 0x40,
+  0x1B, 0xC0, 0x0F, 0x40, 0x2B, 0xC0, 0x03, 0xE0, 0x07, 0x3F, 0xC3, 0xE3,
+  0x50, 0x03, 0x40, 0x03, 0xCB, 0xFB, 0x40, 0x3F, 0xC0, 0x0F, 0xC0, 0x3B,
+  0x40, 0x07, 0x40, 0x3F, 0x47, 0xC3, 0xC3, 0xDF, 0x43, 0xD7, 0xC7, 0xFF,
+  0xC3, 0xEB, 0x47, 0xF7, 0xC0, 0x1F, 0xC0, 0x13, 0x40, 0x27, 0x43, 0xFF,
+  0x40, 0x3B, 0x40, 0x5B, 0x40, 0x03, 0x03, 0x2B, 0x63, 0x2B, 0xFF, 0x43,
+  0xFF, 0x02, 0x23, 0x51, 0x23, 0x6B, 0xEB, 0x4B, 0xF7, 0x58, 0x03, 0x06,
+  0x21, 0x4C, 0x21, 0xFF, 0x31, 0x6F, 0x31, 0x7F, 0xFF, 0x21, 0x00, 0x40,
+  0x23, 0x44, 0x2F, 0x60, 0x2F, 0x01, 0x62, 0x2B, 0x7F, 0xFF, 0x21, 0x00,
+  0x43, 0xCB, 0x00, 0x11, 0x30, 0x7B, 0x02, 0x11, 0x11, 0x1C, 0x20, 0x0B,
+  0x00, 0x19, 0x6F, 0xEF, 0x50, 0x03, 0xC0, 0x03, 0x02, 0x0F, 0x0F, 0x14,
+  0x24, 0x07, 0x00, 0x0D, 0x60, 0x0F, 0x44, 0x07, 0x84, 0x17, 0x00, 0x0C,
+  0x20, 0x07, 0x00, 0x0F, 0x20, 0x1B, 0x00, 0x16, 0xE2, 0x38, 0xFF, 0x00,
+  0xDF, 0x3B, 0xEF, 0x40, 0x03, 0x4B, 0xE3, 0x47, 0xD3, 0x43, 0xDF, 0x43,
+  0xDB, 0x47, 0xE3, 0x4F, 0xE7, 0x40, 0x03, 0xFB, 0x07, 0xF3, 0x02, 0xCF,
+  0xCF, 0xCF, 0x60, 0x27, 0x02, 0xC7, 0xC7, 0xC7, 0x20, 0x40, 0x00, 0x2E,
+  0xFB, 0x28, 0xF3, 0x01, 0xFB, 0xBF, 0x37, 0xFF, 0x05, 0xC4, 0x38, 0xFF,
+  0xFF, 0xAE, 0x27, 0xE0, 0x38, 0xBF, 0xE3, 0xFF, 0x78, 0xFF, 0x42, 0xCB,
+  0xC0, 0x03, 0x47, 0x57, 0xE0, 0x0B, 0x03, 0x43, 0x67, 0xE0, 0x07, 0x17,
+  0xC0, 0x33, 0xE0, 0x03, 0x07, 0xE0, 0x07, 0x23, 0xC0, 0x0F, 0xE0, 0x53,
+  0x3F, 0x4F, 0xC3, 0x40, 0x03, 0x50, 0x07, 0xE0, 0x07, 0x03, 0x40, 0x17,
+  0xC0, 0x03, 0xE0, 0x0F, 0x1B, 0xC0, 0xBF, 0x06, 0x10, 0x25, 0x10, 0xFF,
+  0x1C, 0x41, 0x1C, 0x67, 0xEF, 0x4C, 0x03, 0x44, 0x0B, 0x0A, 0x1B, 0x3F,
+  0x1B, 0xFF, 0x20, 0x49, 0x20, 0xFF, 0x1A, 0x3B, 0x1A, 0x64, 0x7F, 0xD8,
+  0x03, 0x64, 0x1B, 0x24, 0x17, 0x02, 0xC0, 0xC0, 0xC0, 0x23, 0xF3, 0xD7,
+  0xE7, 0x00, 0x08, 0xAB, 0xE7, 0x04, 0x18, 0xFF, 0x1B, 0x15, 0x28, 0x6B,
+  0xE7, 0x06, 0x17, 0x11, 0x24, 0xFF, 0x13, 0x13, 0x1C, 0x23, 0xFF, 0x8C,
+  0x1F, 0x57, 0xF7, 0x02, 0x30, 0x24, 0x4A, 0x64, 0x0B, 0x50, 0x13, 0x02,
+  0x10, 0x10, 0x20, 0xE2, 0x38, 0xFF, 0x02, 0xCB, 0xCB, 0xCB, 0x6B, 0xC7,
+  0x02, 0xC5, 0xC5, 0xC5, 0x7F, 0xFF, 0x50, 0x8C, 0x0A, 0xBC, 0xBC, 0xBC,
+  0xFF, 0xBA, 0xBA, 0xBA, 0xFF, 0xBB, 0xBB, 0xBB, 0x60, 0x03, 0x40, 0x0F,
+  0x02, 0xBE, 0xBE, 0xBE, 0x60, 0x07, 0x40, 0x17, 0x40, 0xB3, 0xC0, 0x03,
+  0x1F, 0xAB, 0xAB, 0xAB, 0xFF, 0xFC, 0xB7, 0x26, 0xFF, 0xF6, 0xBB, 0x2C,
+  0xFF, 0xF0, 0xB1, 0x25, 0xFF, 0xEE, 0xAA, 0x22, 0xFF, 0xEB, 0xA2, 0x1E,
+  0xFF, 0xE9, 0x9E, 0x1C, 0xFF, 0xEB, 0x9E, 0x1E, 0xFF, 0x1F, 0xE8, 0xA0,
+  0x1D, 0xFF, 0xE9, 0xA3, 0x1F, 0xFF, 0xEB, 0xA4, 0x22, 0xFF, 0xEA, 0xA2,
+  0x21, 0xFF, 0xE8, 0x9E, 0x20, 0xFF, 0xF0, 0xA5, 0x2A, 0xFF, 0xF0, 0xA3,
+  0x2B, 0xFF, 0xF1, 0xA3, 0x2D, 0xFF, 0x02, 0xE5, 0x7E, 0x1C, 0xE0, 0x38,
+  0xBF, 0xE3, 0xFF, 0x7C, 0xFF, 0xC7, 0xF3, 0x43, 0xA7, 0x47, 0x57, 0x43,
+  0xB7, 0xC3, 0x17, 0x80, 0x00, 0x00, 0xB5, 0x60, 0x17, 0x40, 0x1B, 0xE0,
+  0x07, 0x03, 0x40, 0x27, 0x4B, 0xEB, 0x47, 0xDF, 0xE0, 0x0B, 0x3F, 0xC8,
+  0x13, 0xE0, 0x07, 0x37, 0xC0, 0x0F, 0x40, 0x3F, 0x53, 0xE7, 0x47, 0xDF,
+  0xE0, 0x0B, 0x3F, 0x00, 0x45, 0xAC, 0x0B, 0xC0, 0x2F, 0xE0, 0x07, 0x07,
+  0x47, 0xC3, 0x4B, 0xC7, 0xE0, 0x03, 0x03, 0x40, 0x13, 0x01, 0xB4, 0x90,
+  0x9F, 0xFF, 0x07, 0x68, 0xE0, 0x03, 0x17, 0x44, 0x0B, 0x40, 0x1B, 0xE0,
+  0x03, 0x13, 0x4B, 0xF7, 0x02, 0x0C, 0x1C, 0x0C, 0x63, 0xEF, 0x02, 0xB9,
+  0xB9, 0xB9, 0x77, 0xFB, 0x47, 0xE7, 0x02, 0x25, 0x55, 0x25, 0x64, 0x07,
+  0x02, 0xA8, 0xA8, 0xA8, 0x67, 0xEB, 0x0C, 0x20, 0x4A, 0x20, 0xFF, 0x19,
+  0x39, 0x19, 0xFF, 0x15, 0x30, 0x15, 0xFF, 0x21, 0xFF, 0x02, 0xFF, 0x21,
+  0x00, 0x47, 0xC3, 0x4B, 0xEF, 0x47, 0xEF, 0x43, 0xD3, 0x5F, 0xE7, 0x4F,
+  0xD7, 0x02, 0x24, 0x1E, 0x31, 0x60, 0x0F, 0x48, 0x13, 0x40, 0x23, 0x44,
+  0x27, 0x47, 0xFB, 0xC4, 0x1B, 0x40, 0x13, 0x58, 0x13, 0xE2, 0x37, 0xFF,
+  0x50, 0xCB, 0x43, 0xE3, 0x40, 0xBB, 0x40, 0x03, 0x06, 0xB6, 0xB6, 0xB6,
+  0xFF, 0xB2, 0xB2, 0xB2, 0x7F, 0xFF, 0x05, 0xB8, 0x02, 0xAD, 0xAD, 0xAD,
+  0x63, 0xE3, 0x43, 0xE7, 0x02, 0xAA, 0xAA, 0xAA, 0x74, 0xB7, 0x02, 0xA7,
+  0xA7, 0xA7, 0x7F, 0xFF, 0x0D, 0xCC, 0x02, 0xA4, 0xA4, 0xA4, 0x61, 0x4B,
+  0x11, 0xF5, 0x8D, 0x1C, 0xFF, 0xF1, 0x9C, 0x22, 0xFF, 0xF1, 0x96, 0x21,
+  0xFF, 0xF5, 0x95, 0x24, 0xFF, 0xF4, 0x8F, 0x20, 0x0B, 0x1F, 0x88, 0x20,
+  0xFF, 0xED, 0x84, 0x1C, 0xFF, 0xE3, 0x85, 0x16, 0xFF, 0xDE, 0x85, 0x14,
+  0xFF, 0xDD, 0x84, 0x14, 0xFF, 0xDC, 0x82, 0x15, 0xFF, 0xDB, 0x81, 0x16,
+  0xFF, 0xDA, 0x7E, 0x17, 0xFF, 0xD7, 0x01, 0x79, 0x16, 0x20, 0x03, 0x04,
+  0x17, 0xFF, 0xC7, 0x52, 0x0E, 0xE0, 0x38, 0xBF, 0xE0, 0x37, 0xFF, 0xE0,
+  0xFF, 0x38, 0x3F, 0x43, 0x7F, 0x43, 0xEF, 0xE0, 0x0B, 0x03, 0x22, 0x5D,
+  0x6C, 0x03, 0x4C, 0x07, 0x40, 0x03, 0xE0, 0x03, 0x23, 0x43, 0x87, 0x40,
+  0x3B, 0x40, 0x03, 0xE0, 0x03, 0x17, 0xE0, 0x03, 0x0B, 0x44, 0x17, 0x4C,
+  0x03, 0xC0, 0x03, 0xE0, 0x03, 0x1B, 0xE0, 0x1B, 0x3F, 0x44, 0x17, 0x00,
+  0x34, 0x37, 0xFF, 0xC0, 0x03, 0xE0, 0x0B, 0x3F, 0x43, 0xCB, 0xFF, 0x07,
+  0xFB, 0xC0, 0x0F, 0x5F, 0xE3, 0xC0, 0x03, 0xC0, 0x13, 0xCC, 0x1F, 0x40,
+  0x17, 0x40, 0x3B, 0x01, 0x8B, 0x8B, 0xFF, 0x05, 0xFF, 0x21, 0x00, 0x4F,
+  0xE3, 0x4F, 0xD7, 0x48, 0x03, 0x02, 0x69, 0x69, 0x69, 0x63, 0x53, 0x02,
+  0x31, 0x70, 0x31, 0x7F, 0xFF, 0x21, 0x00, 0x48, 0x13, 0x01, 0x5E, 0x5E,
+  0xFF, 0x05, 0xFF, 0x21, 0x00, 0x4B, 0xD3, 0x47, 0xF3, 0x80, 0x03, 0x00,
+  0x1E, 0x20, 0x07, 0x4F, 0xDF, 0x00, 0x17, 0x20, 0x07, 0x04, 0x18, 0xFF,
+  0x22, 0x1C, 0x2F, 0x23, 0xE7, 0x00, 0x18, 0x68, 0x17, 0x4C, 0x07, 0x02,
+  0x07, 0x07, 0x11, 0x64, 0x13, 0xE0, 0x03, 0x33, 0xE2, 0x37, 0xBF, 0x02,
+  0xA3, 0xA3, 0xA3, 0x60, 0xAB, 0x02, 0xAF, 0xAF, 0xAF, 0xE0, 0x00, 0x07,
+  0x43, 0xF7, 0x02, 0xAE, 0xAE, 0xAE, 0x63, 0xF7, 0xE3, 0x03, 0xEF, 0x02,
+  0xA6, 0xA6, 0xA6, 0x60, 0x0F, 0x02, 0xA5, 0xA5, 0xA5, 0x60, 0x07, 0x09,
+  0x96, 0x96, 0x96, 0xFF, 0xE9, 0x6B, 0x1A, 0xFF, 0xEA, 0x88, 0x27, 0xDF,
+  0x1D, 0x85, 0x22, 0xFF, 0xEE, 0x85, 0x25, 0xFF, 0xED, 0x82, 0x24, 0xFF,
+  0xEC, 0x7E, 0x24, 0xFF, 0xEF, 0x80, 0x26, 0xFF, 0xE8, 0x7E, 0x1E, 0xFF,
+  0xE2, 0x7A, 0x16, 0xFF, 0xDC, 0x76, 0x13, 0x20, 0x03, 0x14, 0x15, 0xFF,
+  0xDE, 0x77, 0x19, 0xFF, 0xDF, 0x78, 0x1C, 0xFF, 0xDD, 0x76, 0x1C, 0xFF,
+  0xDF, 0x79, 0x20, 0xFF, 0xD8, 0x56, 0x1A, 0xE0, 0x38, 0xBF, 0xE0, 0x37,
+  0xFF, 0xE0, 0xFF, 0x38, 0x3F, 0x43, 0xBF, 0x40, 0x03, 0x43, 0x8F, 0x43,
+  0x5F, 0x4F, 0xE7, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x0F, 0x47, 0x93, 0x40,
+  0x07, 0x40, 0x0F, 0xC0, 0x03, 0x40, 0x2F, 0xE0, 0x07, 0x03, 0x40, 0x1B,
+  0x40, 0x27, 0x48, 0x07, 0x01, 0x8F, 0x8F, 0x80, 0x2B, 0x40, 0x0F, 0xE0,
+  0x27, 0x3F, 0x48, 0x07, 0xE0, 0x23, 0x3F, 0x02, 0xBC, 0x98, 0x62, 0x63,
+  0xDB, 0x5B, 0xDF, 0x40, 0x03, 0xCF, 0xEB, 0x4F, 0xF7, 0x40, 0x03, 0x40,
+  0x13, 0x06, 0xA8, 0x9B, 0x0A, 0xFF, 0x89, 0x7E, 0x08, 0x63, 0xF3, 0xC3,
+  0xFF, 0x40, 0x17, 0x43, 0xFF, 0x06, 0x5C, 0x5C, 0x5C, 0xFF, 0x39, 0x81,
+  0x39, 0x73, 0xDF, 0xC0, 0xD3, 0x02, 0x33, 0x33, 0x33, 0x63, 0x4B, 0x00,
+  0x95, 0xBF, 0xFF, 0x21, 0x00, 0x48, 0x0F, 0xDF, 0xFF, 0x21, 0x00, 0x00,
+  0x20, 0x28, 0x07, 0x40, 0x33, 0xDF, 0xFF, 0x21, 0x00, 0x5B, 0xE7, 0x43,
+  0xEB, 0x47, 0xF3, 0x47, 0xFB, 0x47, 0xD7, 0x40, 0x0F, 0x57, 0xE3, 0x01,
+  0x0F, 0x0F, 0x50, 0x13, 0x00, 0x18, 0x68, 0x1F, 0x9C, 0x17, 0x00, 0x23,
+  0x60, 0x1B, 0x58, 0x07, 0x40, 0x17, 0x40, 0x03, 0xE2, 0x37, 0xBF, 0x02,
+  0x98, 0x98, 0x98, 0x63, 0xE7, 0x47, 0xE3, 0x43, 0xF7, 0x02, 0xAC, 0xAC,
+  0xAC, 0x63, 0xDB, 0x5C, 0xA3, 0x43, 0xFB, 0x43, 0xEB, 0x47, 0xEB, 0x44,
+  0x27, 0x40, 0x07, 0x02, 0xA2, 0xA2, 0xA2, 0xE0, 0x00, 0x0B, 0x1F, 0x93,
+  0x93, 0x93, 0xFF, 0xDA, 0x5A, 0x18, 0xFF, 0xE3, 0x7F, 0x22, 0xFF, 0xE2,
+  0x7E, 0x22, 0xFF, 0xE5, 0x81, 0x26, 0xFF, 0xE4, 0x7F, 0x26, 0xFF, 0xDE,
+  0x79, 0x21, 0xFF, 0xE1, 0x7B, 0x23, 0xFF, 0x1F, 0xE2, 0x77, 0x1C, 0xFF,
+  0xE1, 0x75, 0x17, 0xFF, 0xDE, 0x73, 0x16, 0xFF, 0xDD, 0x72, 0x17, 0xFF,
+  0xDC, 0x73, 0x18, 0xFF, 0xD9, 0x72, 0x18, 0xFF, 0xDA, 0x73, 0x1B, 0xFF,
+  0xDB, 0x75, 0x1E, 0xFF, 0x02, 0xD1, 0x54, 0x17, 0xE0, 0x38, 0xBF, 0xE0,
+  0x37, 0xFF, 0xE0, 0xFF, 0x38, 0x3F, 0x43, 0x9F, 0xC2, 0xF7, 0x40, 0x07,
+  0x43, 0xB3, 0x40, 0x07, 0xC0, 0x03, 0xC3, 0x8B, 0x40, 0x0F, 0xC8, 0x0F,
+  0xC0, 0x13, 0x40, 0x3B, 0x40, 0x03, 0x40, 0x1B, 0xC0, 0x03, 0xE0, 0x13,
+  0x3F, 0xC8, 0x0F, 0xE0, 0x2F, 0x3F, 0xC8, 0x0F, 0xE0, 0x03, 0x3F, 0x4B,
+  0xD3, 0x0A, 0x87, 0x36, 0x08, 0xFF, 0x77, 0x30, 0x07, 0xFF, 0x63, 0x28,
+  0x05, 0xE3, 0x00, 0xFF, 0x43, 0xDF, 0x57, 0xFB, 0x01, 0x5E, 0x72, 0xFB,
+  0x01, 0xEF, 0x00, 0x91, 0x33, 0xA7, 0xC3, 0xFF, 0x54, 0x03, 0x40, 0x3B,
+  0x01, 0x1F, 0x47, 0x9F, 0xFF, 0x03, 0xCC, 0x02, 0x37, 0x7D, 0x37, 0x6C,
+  0x0B, 0xFF, 0x0F, 0xFF, 0x21, 0x00, 0x03, 0x13, 0x2B, 0x13, 0xFF, 0x50,
+  0x0F, 0x02, 0x3B, 0x86, 0x3B, 0xE0, 0x00, 0x33, 0x50, 0x07, 0x4F, 0xC3,
+  0x4B, 0xFF, 0x9F, 0xFF, 0x07, 0xF8, 0x43, 0xF7, 0x00, 0x16, 0x23, 0xF7,
+  0xC4, 0x03, 0xEC, 0x01, 0x1B, 0x44, 0x1B, 0x48, 0x1B, 0x4C, 0x03, 0x02,
+  0x40, 0x34, 0x5A, 0x68, 0x07, 0x40, 0x2F, 0xE2, 0x37, 0xBF, 0x02, 0x92,
+  0x92, 0x92, 0x63, 0xE3, 0x43, 0xE7, 0xC3, 0xEF, 0x06, 0xA0, 0xA0, 0xA0,
+  0xFF, 0xA1, 0xA1, 0xA1, 0xE3, 0x00, 0xE7, 0x43, 0xF7, 0x43, 0xFF, 0x40,
+  0x17, 0xE0, 0x03, 0x03, 0x05, 0x8D, 0x8D, 0x8D, 0xFF, 0xD0, 0x52, 0x47,
+  0xDB, 0x00, 0x1D, 0x27, 0xDF, 0x27, 0xD3, 0x01, 0x78, 0x1F, 0x20, 0x07,
+  0x0F, 0x1D, 0xFF, 0xD6, 0x70, 0x18, 0xFF, 0xD6, 0x71, 0x19, 0xFF, 0xD9,
+  0x73, 0x19, 0xFF, 0xDB, 0x74, 0x43, 0xEB, 0x02, 0x1C, 0xFF, 0xD8, 0x23,
+  0xF3, 0x0A, 0xD3, 0x70, 0x19, 0xFF, 0xD3, 0x71, 0x1B, 0xFF, 0xD2, 0x71,
+  0x1C, 0x20, 0x03, 0x04, 0x1E, 0xFF, 0xC2, 0x4F, 0x15, 0xE0, 0x38, 0xBF,
+  0xE0, 0x37, 0xFF, 0xE0, 0xFF, 0x38, 0x3F, 0x43, 0xB7, 0x43, 0xB3, 0xE0,
+  0x0F, 0x03, 0x43, 0xF3, 0x80, 0x00, 0xF8, 0x05, 0x17, 0x40, 0x2F, 0x40,
+  0x3B, 0x40, 0x03, 0x40, 0x0B, 0xE0, 0x0F, 0x03, 0x43, 0xF3, 0x00, 0xE2,
+  0xF8, 0x0A, 0x17, 0x40, 0x2F, 0x40, 0x3B, 0x40, 0x03, 0x40, 0x0B, 0xE0,
+  0x0F, 0x03, 0x43, 0xF3, 0x00, 0x45, 0xB0, 0x03, 0x48, 0x1B, 0x40, 0x03,
+  0x4C, 0x0F, 0x40, 0x2F, 0x40, 0x3B, 0x47, 0xFF, 0xE3, 0x0B, 0xFF, 0x43,
+  0xE7, 0x44, 0x03, 0xE3, 0x13, 0xFF, 0x40, 0x3B, 0x4B, 0xE7, 0x40, 0x03,
+  0x43, 0xDF, 0xE0, 0x03, 0x03, 0x02, 0x22, 0x4D, 0x22, 0x60, 0x5F, 0x06,
+  0x18, 0x37, 0x18, 0xFF, 0x12, 0x2A, 0x12, 0x60, 0x23, 0x02, 0x9F, 0x9F,
+  0x9F, 0x68, 0x0B, 0x40, 0x77, 0xC4, 0x37, 0x43, 0xC3, 0x4F, 0xFB, 0x02,
+  0x3A, 0x2E, 0x54, 0x7F, 0xFF, 0x04, 0x00, 0x43, 0xE7, 0x5F, 0xF3, 0x02,
+  0x11, 0x0E, 0x1D, 0x27, 0xF3, 0x5C, 0x13, 0x00, 0x09, 0x60, 0x1B, 0x50,
+  0x1B, 0x40, 0x2B, 0x44, 0x03, 0x01, 0x10, 0x10, 0x4C, 0x0F, 0x5B, 0xFF,
+  0xF7, 0x39, 0xFF, 0x43, 0xC3, 0x06, 0x9E, 0x9E, 0x9E, 0xFF, 0x9D, 0x9D,
+  0x9D, 0x60, 0x9F, 0x40, 0xA3, 0x40, 0x0B, 0xC3, 0xE7, 0x47, 0xEF, 0x40,
+  0x03, 0x40, 0x0F, 0x40, 0x27, 0x40, 0x0B, 0x44, 0x1B, 0x40, 0x0F, 0x00,
+  0x8B, 0x2C, 0xFB, 0x0D, 0xC8, 0x4C, 0x11, 0xFF, 0xD5, 0x6B, 0x17, 0xFF,
+  0xD3, 0x6A, 0x14, 0xFF, 0xD6, 0x6D, 0x2F, 0xDB, 0x20, 0x03, 0x0E, 0xD4,
+  0x6A, 0x12, 0xFF, 0xD6, 0x6E, 0x16, 0xFF, 0xD5, 0x71, 0x1A, 0xFF, 0xD5,
+  0x73, 0x1C, 0x20, 0x03, 0x00, 0x1E, 0x23, 0xEF, 0x03, 0x1D, 0xFF, 0xCE,
+  0x6E, 0x23, 0xF7, 0x0C, 0x74, 0x23, 0xFF, 0xD0, 0x73, 0x23, 0xFF, 0xCC,
+  0x71, 0x22, 0xFF, 0xB9, 0x4E, 0xE0, 0x39, 0xBF, 0x01, 0x6B, 0x3F, 0xFF,
+  0xFF, 0x7A, 0xFF, 0x0C, 0x00, 0x47, 0x4F, 0x43, 0x4F, 0x43, 0xE3, 0x4F,
+  0xE7, 0x42, 0xDF, 0x40, 0x03, 0x40, 0x13, 0x40, 0x03, 0x40, 0x13, 0x40,
+  0x03, 0x40, 0x0B, 0x40, 0x17, 0x40, 0x03, 0x40, 0x33, 0x40, 0x03, 0xC0,
+  0x0B, 0x40, 0x1B, 0x43, 0xEB, 0x4F, 0xEB, 0x40, 0x13, 0x40, 0x03, 0x40,
+  0x13, 0x40, 0x03, 0x40, 0x13, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x17, 0x40,
+  0x03, 0x40, 0x3B, 0x40, 0x03, 0xC0, 0x0B, 0x40, 0x1B, 0x43, 0xEB, 0x43,
+  0xDB, 0x40, 0x13, 0x40, 0x03, 0x40, 0x13, 0x40, 0x03, 0x40, 0x13, 0x40,
+  0x03, 0x40, 0x0B, 0x40, 0x17, 0x40, 0x03, 0x40, 0x3B, 0x40, 0x03, 0x00,
+  0xB4, 0x33, 0xE7, 0xE3, 0x0F, 0xFF, 0x43, 0xFB, 0x44, 0x03, 0x00, 0xA8,
+  0xAB, 0xFF, 0xE7, 0x07, 0xFF, 0x40, 0x3B, 0x02, 0xB8, 0xB8, 0xB8, 0x7F,
+  0xFF, 0x21, 0x00, 0x0B, 0x26, 0x57, 0x26, 0xFF, 0xB7, 0xB7, 0xB7, 0xFF,
+  0x39, 0x83, 0x39, 0xFF, 0x53, 0x43, 0x43, 0xDF, 0x02, 0x38, 0x38, 0x38,
+  0x64, 0x07, 0x57, 0x63, 0x47, 0x43, 0x40, 0x77, 0x47, 0x6F, 0x40, 0x07,
+  0x01, 0x89, 0x89, 0x9F, 0xFF, 0x21, 0x00, 0x02, 0x0F, 0x0F, 0x21, 0x23,
+  0xCF, 0x00, 0x18, 0x63, 0xDF, 0x83, 0xE3, 0x00, 0x1F, 0x2F, 0xE7, 0x97,
+  0xEF, 0x40, 0x17, 0x48, 0x1B, 0x02, 0x23, 0x1D, 0x30, 0x60, 0x1B, 0x80,
+  0x1F, 0x43, 0xFF, 0x4C, 0x1B, 0x00, 0x1A, 0xF3, 0x3C, 0xFF, 0x41, 0x03,
+  0xC3, 0xCF, 0x43, 0xD3, 0x40, 0x03, 0x00, 0x9D, 0x24, 0x0B, 0x40, 0x03,
+  0xC0, 0x17, 0x43, 0xF7, 0x40, 0x03, 0x44, 0x1B, 0x40, 0x1F, 0x40, 0x0B,
+  0x16, 0x9C, 0x9C, 0x9C, 0xFF, 0x85, 0x85, 0x85, 0xFF, 0xCF, 0x4C, 0x15,
+  0xFF, 0xDC, 0x6E, 0x1F, 0xFF, 0xD9, 0x6C, 0x1A, 0xFF, 0xDA, 0x6D, 0x1A,
+  0x20, 0x07, 0x08, 0x19, 0xFF, 0xD4, 0x68, 0x13, 0xFF, 0xD6, 0x6A, 0x15,
+  0x28, 0x03, 0x47, 0xF3, 0x06, 0x1C, 0xFF, 0xD0, 0x6E, 0x1B, 0xFF, 0xCF,
+  0x23, 0xFB, 0x12, 0xCE, 0x6F, 0x1E, 0xFF, 0xCF, 0x71, 0x23, 0xFF, 0xCB,
+  0x6F, 0x21, 0xFF, 0xC6, 0x6B, 0x1E, 0xFF, 0xAE, 0x48, 0x12, 0xE3, 0xFF,
+  0x79, 0xBF, 0xE5, 0x37, 0x3F, 0x42, 0xCB, 0xC0, 0x03, 0x43, 0x5F, 0xE0,
+  0x07, 0x03, 0xC0, 0x1B, 0x42, 0x67, 0x40, 0x03, 0x40, 0x0F, 0xC0, 0x23,
+  0x40, 0x0B, 0xE0, 0x03, 0x03, 0xC0, 0x17, 0xE0, 0x03, 0x07, 0xC0, 0x1F,
+  0x40, 0x3B, 0x40, 0x03, 0x40, 0x0F, 0xC0, 0x1F, 0x40, 0x0B, 0xE0, 0x03,
+  0x03, 0xC0, 0x17, 0xE0, 0x03, 0x07, 0xC0, 0x1F, 0x40, 0x3B, 0x40, 0x03,
+  0x40, 0x0F, 0xC0, 0x1F, 0x40, 0x0B, 0x47, 0xC3, 0xE3, 0x13, 0xFF, 0x4C,
+  0x03, 0xE3, 0x0F, 0xFF, 0x40, 0x3B, 0x00, 0x75, 0xBF, 0xFF, 0x21, 0x00,
+  0x02, 0x17, 0x34, 0x17, 0x67, 0x1B, 0xFF, 0x03, 0xFF, 0x21, 0x00, 0x44,
+  0x03, 0xC0, 0x03, 0x40, 0x6B, 0x01, 0x90, 0x90, 0xFF, 0x05, 0xFF, 0x21,
+  0x00, 0x48, 0x2F, 0x83, 0xCF, 0x4B, 0xDB, 0x84, 0x03, 0x01, 0x11, 0x11,
+  0x43, 0xDF, 0x04, 0x18, 0xFF, 0x0C, 0x0C, 0x13, 0x24, 0x1B, 0x00, 0x17,
+  0x23, 0xFF, 0x05, 0x0F, 0xFF, 0x1A, 0x14, 0x27, 0xFF, 0x43, 0xFB, 0xC0,
+  0x03, 0x40, 0x33, 0x40, 0x1B, 0x01, 0x0C, 0x0C, 0xE7, 0x39, 0x3F, 0x40,
+  0x93, 0x44, 0x9B, 0x4B, 0xDF, 0xE7, 0x03, 0xDB, 0x00, 0x9D, 0x24, 0x03,
+  0x43, 0xEB, 0x43, 0xF3, 0x40, 0x0B, 0x40, 0x03, 0x43, 0xF7, 0x40, 0x03,
+  0x43, 0xFB, 0x18, 0x99, 0x99, 0x99, 0xFF, 0x82, 0x82, 0x82, 0xFF, 0xD0,
+  0x4E, 0x18, 0xFF, 0xDE, 0x72, 0x25, 0xFF, 0xDC, 0x70, 0x22, 0xFF, 0xDB,
+  0x6F, 0x20, 0xFF, 0xDA, 0x23, 0xE3, 0x08, 0xD9, 0x6D, 0x1D, 0xFF, 0xD5,
+  0x6A, 0x18, 0xFF, 0xD5, 0x23, 0xF7, 0x00, 0xD3, 0x20, 0x03, 0x05, 0xD1,
+  0x6C, 0x1B, 0xFF, 0xD0, 0x6C, 0x24, 0x07, 0x10, 0x6D, 0x1F, 0xFF, 0xCE,
+  0x6D, 0x20, 0xFF, 0xC9, 0x6A, 0x1E, 0xFF, 0xC4, 0x66, 0x19, 0xFF, 0xAC,
+  0x44, 0xF7, 0xFF, 0xBA, 0xFF, 0xC3, 0x4B, 0xC0, 0x07, 0x4F, 0xCF, 0x43,
+  0x67, 0x40, 0x03, 0x42, 0xF3, 0xE0, 0x03, 0x03, 0xC0, 0x23, 0x40, 0x07,
+  0xC0, 0x17, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0xE0, 0x67, 0x3F, 0x4F, 0xC3,
+  0xC0, 0x03, 0x00, 0x7C, 0xFF, 0x2A, 0xFF, 0x5F, 0xC0, 0xFF, 0x03, 0xFF,
+  0x21, 0x00, 0x05, 0x1A, 0x3C, 0x1A, 0xFF, 0x0E, 0x20, 0x33, 0xAB, 0x01,
+  0x1F, 0x0E, 0x63, 0xDB, 0x43, 0xFB, 0x02, 0x3C, 0x89, 0x3C, 0x7F, 0xFF,
+  0x1B, 0xF4, 0x06, 0x57, 0x57, 0x57, 0xFF, 0x20, 0x49, 0x20, 0x6C, 0x0F,
+  0x5C, 0x07, 0x02, 0x14, 0x2E, 0x14, 0x7F, 0xFF, 0x21, 0x00, 0x43, 0xEB,
+  0x4B, 0xCB, 0x80, 0x07, 0x00, 0x1D, 0x20, 0x07, 0x9F, 0xFF, 0x0B, 0xD8,
+  0x40, 0x0F, 0x80, 0x03, 0x40, 0x0F, 0x54, 0x07, 0x00, 0x14, 0x24, 0x1B,
+  0xE0, 0x01, 0x17, 0x43, 0xFF, 0x58, 0x2F, 0xE5, 0x37, 0xBF, 0x02, 0x91,
+  0x91, 0x91, 0x64, 0x03, 0x02, 0x8A, 0x8A, 0x8A, 0xFF, 0x00, 0xFF, 0x60,
+  0x54, 0x02, 0x88, 0x88, 0x88, 0x60, 0x0F, 0x40, 0x13, 0x40, 0x0B, 0x40,
+  0x03, 0xDF, 0xFF, 0x60, 0x70, 0x40, 0x07, 0x54, 0xCB, 0x47, 0xFB, 0x43,
+  0xFF, 0x04, 0xCF, 0x4F, 0x1A, 0xFF, 0xCD, 0x20, 0x03, 0x08, 0xC2, 0x48,
+  0x13, 0xFF, 0xBD, 0x45, 0x10, 0xFF, 0xBB, 0x20, 0x03, 0x02, 0xBE, 0x45,
+  0x13, 0x20, 0x0F, 0x00, 0x14, 0x20, 0x03, 0x07, 0x12, 0xFF, 0xC0, 0x47,
+  0x10, 0xFF, 0xBF, 0x46, 0x80, 0x17, 0x08, 0xBA, 0x45, 0x11, 0xFF, 0xBA,
+  0x46, 0x13, 0xFF, 0xB6, 0x20, 0x1F, 0x06, 0xB2, 0x44, 0x12, 0xFF, 0xAD,
+  0x42, 0x10, 0xE0, 0x38, 0xBF, 0xE0, 0x37, 0xFF, 0xE0, 0xFF, 0x38, 0x3F,
+  0x06, 0xD1, 0xD1, 0x49, 0xFF, 0xCE, 0xCE, 0x46, 0x2A, 0xFB, 0x00, 0x2F,
+  0x60, 0x07, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0x02, 0xDF, 0xDF, 0x57, 0x60,
+  0x0F, 0x0A, 0x53, 0x53, 0x00, 0xFF, 0xE5, 0xE5, 0x4E, 0xFF, 0xDE, 0xDE,
+  0x56, 0x60, 0x0F, 0xC0, 0x23, 0x02, 0xFE, 0xFE, 0xFE, 0xE0, 0x00, 0x03,
+  0x00, 0x00, 0x20, 0x00, 0xE0, 0x03, 0x0F, 0xE0, 0x17, 0x0B, 0x02, 0xC0,
+  0xF5, 0xFE, 0x61, 0xBF, 0x41, 0xC3, 0xE0, 0x6F, 0x03, 0x02, 0x61, 0x43,
+  0x70, 0xE0, 0x34, 0x03, 0xC0, 0xB7, 0x02, 0x38, 0x2C, 0x55, 0xE0, 0x00,
+  0x0B, 0xC0, 0x13, 0xE0, 0x5B, 0x07, 0x02, 0xC0, 0xC0, 0xC0, 0x7F, 0xFF,
+  0x03, 0xFC, 0x02, 0xC3, 0xC3, 0xC3, 0x60, 0x03, 0x02, 0xC2, 0xC2, 0xC2,
+  0x60, 0x13, 0x02, 0xBE, 0xBE, 0xBE, 0x7F, 0xFF, 0x04, 0x00, 0x06, 0xBB,
+  0xBB, 0xBB, 0xFF, 0xBF, 0xBF, 0xBF, 0x60, 0x0F, 0x4C, 0xEB, 0x02, 0xBA,
+  0xBA, 0xBA, 0x60, 0x0B, 0x40, 0x13, 0x40, 0x03, 0x09, 0xD2, 0xA8, 0x11,
+  0xFF, 0xD8, 0xB0, 0x19, 0xFF, 0xDA, 0xAA, 0x34, 0x07, 0x18, 0xA9, 0x12,
+  0xFF, 0xDC, 0xA8, 0x12, 0xFF, 0xDA, 0xA4, 0x10, 0xFF, 0xD8, 0xA0, 0x0E,
+  0xFF, 0xD7, 0x9C, 0x0D, 0xFF, 0xD8, 0x9C, 0x0F, 0xFF, 0xDC, 0xA1, 0x2C,
+  0x23, 0x0C, 0x9E, 0x15, 0xFF, 0xD7, 0x96, 0x0D, 0xFF, 0xD9, 0x97, 0x0D,
+  0xFF, 0xDC, 0xA0, 0x20, 0x27, 0x05, 0xA1, 0x11, 0xFF, 0xDB, 0xA2, 0x0F,
+  0xE0, 0x5C, 0xE3, 0xE1, 0x5B, 0x47, 0xE0, 0xEF, 0x63, 0x02, 0xC7, 0xC7,
+  0x3F, 0x2E, 0xE7, 0x83, 0xDB, 0x02, 0xCF, 0xCF, 0x47, 0x22, 0x3B, 0x00,
+  0x38, 0x63, 0xDB, 0x40, 0x13, 0x40, 0x03, 0x43, 0xE7, 0x02, 0xD2, 0xD2,
+  0x4A, 0x60, 0x07, 0x40, 0x0B, 0xC0, 0x03, 0x01, 0x21, 0x21, 0x80, 0x1B,
+  0x43, 0xE3, 0x23, 0xF6, 0xE0, 0x0C, 0x00, 0x43, 0xDF, 0xE0, 0x0C, 0x18,
+  0xA0, 0x00, 0x02, 0xB3, 0xD6, 0xDB, 0x61, 0x77, 0xFF, 0xFF, 0x34, 0xFF,
+  0x1E, 0x00, 0x43, 0xDF, 0xC0, 0x03, 0x01, 0xBC, 0xBC, 0xFF, 0x11, 0xFF,
+  0x07, 0xEC, 0x40, 0x23, 0x02, 0xB4, 0xB4, 0xB4, 0x7F, 0xFF, 0x04, 0x30,
+  0x02, 0xB9, 0xB9, 0xB9, 0x60, 0x2B, 0x06, 0xC1, 0xC1, 0xC1, 0xFF, 0xCD,
+  0x9F, 0x15, 0xFF, 0x1C, 0xFF, 0x07, 0xEC, 0x16, 0xEB, 0x9C, 0x28, 0xFF,
+  0xE3, 0x93, 0x1E, 0xFF, 0xE5, 0x94, 0x1F, 0xFF, 0xE8, 0x9A, 0x21, 0xFF,
+  0xEB, 0xA0, 0x23, 0xFF, 0xD4, 0xA8, 0x1F, 0xE1, 0xFF, 0x39, 0xBF, 0x44,
+  0x77, 0xE2, 0x73, 0xFF, 0xC3, 0xCF, 0x40, 0x07, 0x02, 0xD0, 0xD0, 0x48,
+  0x60, 0x07, 0x0E, 0xDC, 0xDC, 0x54, 0xFF, 0x52, 0x52, 0x00, 0xFF, 0x63,
+  0x63, 0x00, 0xFF, 0xD9, 0xD9, 0x42, 0x60, 0x13, 0x06, 0xBF, 0xBF, 0x37,
+  0xFF, 0xE2, 0xE2, 0x5A, 0x64, 0x13, 0x06, 0xCB, 0xCB, 0x43, 0xFF, 0xFC,
+  0xFC, 0x65, 0x60, 0x17, 0xE3, 0x03, 0xFF, 0xE0, 0x03, 0x0B, 0xE3, 0x17,
+  0xFB, 0xC0, 0x00, 0xE0, 0x77, 0xFF, 0xE0, 0xB7, 0x7F, 0x54, 0xAB, 0x01,
+  0xAF, 0xAF, 0x9F, 0xFF, 0x03, 0xF4, 0x01, 0xAB, 0xAB, 0x9F, 0xFF, 0x00,
+  0x08, 0xFF, 0x0B, 0xFF, 0x07, 0xEC, 0x50, 0x1B, 0x50, 0x03, 0x40, 0x03,
+  0x50, 0x2B, 0x40, 0x23, 0x44, 0x07, 0x02, 0xD2, 0x91, 0x17, 0xFF, 0x1C,
+  0xFF, 0x07, 0xEC, 0x06, 0xD4, 0x75, 0x15, 0xFF, 0xCD, 0x6E, 0x0E, 0x34,
+  0x03, 0x0B, 0x0D, 0xFF, 0xD4, 0x77, 0x12, 0xFF, 0xDB, 0x82, 0x19, 0xFF,
+  0xCD, 0x99, 0xFF, 0xFF, 0xBA, 0xFF, 0x04, 0x00, 0x43, 0xF7, 0x02, 0xC3,
+  0xC3, 0x3B, 0x63, 0xF3, 0x47, 0xEF, 0x40, 0x03, 0x47, 0xEF, 0x4B, 0xEB,
+  0x01, 0x3C, 0x3C, 0x88, 0x17, 0x48, 0x23, 0x48, 0x17, 0x01, 0x2C, 0x2C,
+  0x84, 0x13, 0x02, 0xC8, 0xC8, 0x31, 0x60, 0x37, 0x02, 0xD9, 0xD9, 0x51,
+  0xE3, 0x00, 0xFF, 0xE3, 0x03, 0xFB, 0xE0, 0x1B, 0x00, 0x44, 0x1F, 0xE7,
+  0xFF, 0x3C, 0xFF, 0x02, 0xB3, 0xB3, 0xB3, 0xFF, 0x1C, 0xFF, 0x07, 0xEC,
+  0x02, 0xA9, 0xA9, 0xA9, 0x7F, 0xFF, 0x0C, 0xCC, 0x02, 0xA8, 0xA8, 0xA8,
+  0xFF, 0x00, 0xFF, 0x04, 0x28, 0x06, 0xB5, 0xB5, 0xB5, 0xFF, 0xCF, 0x8B,
+  0x1A, 0xFF, 0x1C, 0xFF, 0x07, 0xEC, 0x15, 0xE1, 0x7B, 0x25, 0xFF, 0xE0,
+  0x7A, 0x22, 0xFF, 0xE2, 0x79, 0x20, 0xFF, 0xE6, 0x80, 0x24, 0xFF, 0xE4,
+  0x81, 0x24, 0xFF, 0xCC, 0x91, 0xFF, 0x39, 0xFF, 0x0C, 0xC0, 0xE5, 0xB7,
+  0x7F, 0xE0, 0xB7, 0xBF, 0x43, 0xFF, 0xC0, 0x03, 0x47, 0xEF, 0x40, 0x03,
+  0x40, 0x0F, 0x02, 0xA7, 0xA7, 0x1F, 0x64, 0x17, 0x40, 0x0B, 0x02, 0xBD,
+  0xBD, 0x35, 0x60, 0x07, 0x40, 0x0B, 0x44, 0x17, 0x40, 0x07, 0x02, 0xFF,
+  0xFF, 0x79, 0x60, 0x07, 0x43, 0xF7, 0x40, 0x03, 0xE3, 0x13, 0xF3, 0xE0,
+  0x07, 0x1F, 0x43, 0xFB, 0x40, 0x2F, 0xE3, 0xFF, 0x3C, 0xFF, 0x02, 0xB0,
+  0xB0, 0xB0, 0x63, 0xDB, 0xDF, 0xFF, 0x03, 0xFC, 0xD8, 0x0B, 0x40, 0x07,
+  0x47, 0xF3, 0x47, 0xEB, 0x40, 0x0B, 0xDF, 0xFF, 0x0B, 0xFC, 0x43, 0xFF,
+  0x02, 0xAE, 0xAE, 0xAE, 0x7F, 0xFF, 0x08, 0x28, 0x06, 0xB1, 0xB1, 0xB1,
+  0xFF, 0xC7, 0x88, 0x18, 0x23, 0xDB, 0xFF, 0x19, 0xFF, 0x07, 0xEC, 0x08,
+  0xDC, 0x77, 0x21, 0xFF, 0xDD, 0x78, 0x21, 0xFF, 0xE1, 0x24, 0x03, 0x0A,
+  0xE6, 0x82, 0x2A, 0xFF, 0xE2, 0x80, 0x2A, 0xFF, 0xC7, 0x8B, 0x1D, 0xE2,
+  0xB8, 0xFF, 0xE3, 0xB7, 0xBF, 0xE0, 0x37, 0xBF, 0x43, 0xCB, 0x02, 0xBA,
+  0xBA, 0x32, 0x60, 0x07, 0x40, 0x0B, 0x43, 0xDF, 0x02, 0xBE, 0xBE, 0x36,
+  0x60, 0x0B, 0x48, 0x07, 0x01, 0x25, 0x25, 0x84, 0x0F, 0x01, 0xD6, 0xD6,
+  0x83, 0xF7, 0x44, 0x1F, 0x06, 0xDB, 0xDB, 0x53, 0xFF, 0xD5, 0xD5, 0x4D,
+  0x60, 0x23, 0xE3, 0x07, 0xDB, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x1F, 0xC3,
+  0xFB, 0xC0, 0x00, 0xE0, 0x37, 0xBF, 0xE0, 0xF7, 0x3F, 0x4B, 0xF3, 0x5F,
+  0xE7, 0xC3, 0xE7, 0x43, 0xEB, 0x40, 0x0B, 0x5B, 0xFB, 0xE0, 0x0F, 0x03,
+  0x44, 0x0B, 0x40, 0x27, 0x4C, 0x03, 0x02, 0xC2, 0x82, 0x12, 0x3F, 0xE7,
+  0xFF, 0x19, 0xFF, 0x07, 0xEC, 0x01, 0xD0, 0x71, 0x3F, 0xFB, 0x00, 0x72,
+  0x20, 0x07, 0x0C, 0x72, 0x21, 0xFF, 0xD4, 0x79, 0x29, 0xFF, 0xD1, 0x77,
+  0x29, 0xFF, 0xB9, 0x84, 0xE7, 0xFF, 0xBA, 0xFF, 0x4F, 0xEB, 0x4B, 0xF3,
+  0x43, 0xFB, 0x02, 0xEA, 0xEA, 0x62, 0x63, 0xDF, 0x40, 0x0B, 0xC0, 0x03,
+  0x44, 0x0F, 0x02, 0xD3, 0xD3, 0x4B, 0x60, 0x0F, 0x06, 0xB5, 0xB5, 0x2D,
+  0xFF, 0xFB, 0xFB, 0x64, 0x60, 0x13, 0xC0, 0x1F, 0xC3, 0xC7, 0xE0, 0x0B,
+  0x00, 0xE3, 0x07, 0xEB, 0xE0, 0x07, 0x00, 0xE7, 0xFF, 0x3C, 0xFF, 0x47,
+  0xCF, 0xC3, 0xE7, 0x47, 0xEF, 0x40, 0x03, 0x40, 0x0F, 0x5F, 0xE7, 0x40,
+  0x0B, 0x44, 0x1B, 0x40, 0x0F, 0x4F, 0xF7, 0x40, 0x03, 0x02, 0x9A, 0x9A,
+  0x9A, 0x7F, 0xFF, 0x13, 0xF8, 0x02, 0x94, 0x94, 0x94, 0x60, 0x1B, 0x02,
+  0xC0, 0x7F, 0x0F, 0xFF, 0x1C, 0xFF, 0x07, 0xEC, 0x15, 0xC9, 0x6F, 0x20,
+  0xFF, 0xC4, 0x6E, 0x20, 0xFF, 0xBE, 0x6B, 0x21, 0xFF, 0xB6, 0x66, 0x1F,
+  0xFF, 0xB3, 0x64, 0x1F, 0xFF, 0xA9, 0x7A, 0xFF, 0xFF, 0xBA, 0xFF, 0x10,
+  0x00, 0x06, 0xBC, 0xBC, 0x34, 0xFF, 0x6A, 0x6A, 0x07, 0x63, 0xD3, 0x53,
+  0xFF, 0x43, 0xEF, 0x02, 0xDA, 0xDA, 0x52, 0x36, 0x1B, 0x00, 0x39, 0x73,
+  0xE7, 0xC3, 0xE7, 0x47, 0xFF, 0x02, 0xB2, 0xB2, 0x2A, 0x22, 0x43, 0x00,
+  0x15, 0x60, 0x13, 0x06, 0xD8, 0xD8, 0x50, 0xFF, 0xCC, 0xCC, 0x44, 0xE7,
+  0x00, 0xFF, 0xE3, 0x07, 0xEB, 0xE0, 0x07, 0x0F, 0xE0, 0x0B, 0x00, 0xE3,
+  0xFF, 0x40, 0xFF, 0x43, 0xD7, 0xC3, 0xE7, 0x43, 0xF7, 0x40, 0x03, 0x01,
+  0x9F, 0x9F, 0xFF, 0x05, 0xFF, 0x07, 0xEC, 0x02, 0x99, 0x99, 0x99, 0x63,
+  0xF7, 0x0A, 0x92, 0x92, 0x92, 0xFF, 0x8E, 0x8E, 0x8E, 0xFF, 0x8C, 0x8C,
+  0x8C, 0x7F, 0xFF, 0x14, 0xC4, 0x01, 0xC0, 0x7D, 0x23, 0xFF, 0xFF, 0x1A,
+  0xFF, 0x07, 0xEC, 0x16, 0xC1, 0x67, 0x1A, 0xFF, 0xBB, 0x65, 0x1B, 0xFF,
+  0xB0, 0x61, 0x1C, 0xFF, 0xAA, 0x5B, 0x1A, 0xFF, 0xA7, 0x5A, 0x1C, 0xFF,
+  0x9F, 0x72, 0x13, 0xE9, 0xF8, 0x7F, 0xEA, 0xB7, 0x7F, 0x43, 0xDF, 0x43,
+  0xF3, 0x57, 0xE7, 0x02, 0xD1, 0xD1, 0x49, 0x6B, 0xF3, 0x40, 0x13, 0x05,
+  0xC2, 0xC2, 0x3A, 0xFF, 0x39, 0x39, 0x93, 0xFF, 0x48, 0x1F, 0xC0, 0x03,
+  0x02, 0xB4, 0xB4, 0x2C, 0x60, 0x1F, 0x40, 0x0F, 0x40, 0x27, 0x4B, 0xDF,
+  0xE3, 0x1B, 0xEB, 0xE0, 0x0B, 0x00, 0xE3, 0xFF, 0x3C, 0xFF, 0x4B, 0xC3,
+  0x43, 0xFF, 0x47, 0xE3, 0x43, 0xF3, 0x40, 0x0B, 0x40, 0x03, 0x44, 0x03,
+  0x40, 0x03, 0xDF, 0xFF, 0x07, 0xEC, 0x02, 0x95, 0x95, 0x95, 0x7F, 0xFF,
+  0x17, 0xF0, 0x43, 0xF7, 0x00, 0x88, 0xBF, 0xFF, 0x04, 0x20, 0x07, 0x98,
+  0x98, 0x98, 0xFF, 0xC3, 0x80, 0x15, 0xFF, 0xFF, 0x1B, 0xFF, 0x07, 0xEC,
+  0x15, 0xBF, 0x61, 0x15, 0xFF, 0xB9, 0x5E, 0x18, 0xFF, 0xAC, 0x58, 0x18,
+  0xFF, 0xA5, 0x53, 0x15, 0xFF, 0xA5, 0x55, 0x19, 0xFF, 0x9C, 0x6D, 0xFF,
+  0xFF, 0xBA, 0xFF, 0x04, 0x00, 0x43, 0xC3, 0xC0, 0x03, 0xC3, 0xD3, 0x40,
+  0x0F, 0x4C, 0x17, 0x4F, 0xFF, 0x40, 0x0B, 0x4F, 0xF3, 0x01, 0x53, 0x53,
+  0x94, 0x1B, 0x44, 0x2B, 0x40, 0x27, 0x02, 0x6B, 0x6B, 0x08, 0x60, 0x03,
+  0x43, 0xFF, 0xE3, 0x0B, 0xDB, 0xC0, 0x00, 0xE0, 0x17, 0x1F, 0xE5, 0xB7,
+  0x3F, 0xE0, 0x77, 0xBF, 0x4F, 0xCB, 0x43, 0xE3, 0x40, 0x03, 0x4B, 0xDB,
+  0x40, 0x03, 0x47, 0xEB, 0x40, 0x03, 0x40, 0x0B, 0x43, 0xE3, 0x01, 0x96,
+  0x96, 0x8B, 0xEF, 0x01, 0x93, 0x93, 0x9F, 0xFF, 0x25, 0x88, 0x02, 0x89,
+  0x89, 0x89, 0x64, 0x07, 0x40, 0x1F, 0x1F, 0xBC, 0x7A, 0x14, 0xFF, 0xD0,
+  0x67, 0x1D, 0xFF, 0xD0, 0x66, 0x1A, 0xFF, 0xCF, 0x65, 0x18, 0xFF, 0xCE,
+  0x64, 0x18, 0xFF, 0xCB, 0x63, 0x18, 0xFF, 0xCA, 0x63, 0x19, 0xFF, 0xCA,
+  0x64, 0x1C, 0xFF, 0x08, 0xC7, 0x63, 0x1B, 0xFF, 0xC4, 0x61, 0x1A, 0xFF,
+  0xC0, 0x23, 0xFB, 0x11, 0xBC, 0x5C, 0x1B, 0xFF, 0xB4, 0x58, 0x1E, 0xFF,
+  0xAC, 0x51, 0x18, 0xFF, 0xAD, 0x54, 0x1C, 0xFF, 0xA3, 0x6E, 0xFF, 0xFF,
+  0xBA, 0xFF, 0x10, 0x00, 0x43, 0xDF, 0x02, 0xD4, 0xD4, 0x4C, 0x60, 0x07,
+  0x43, 0xDB, 0x40, 0x0F, 0x06, 0xC5, 0xC5, 0x3D, 0xFF, 0x19, 0x19, 0x00,
+  0x6F, 0xF7, 0x02, 0xEC, 0xEC, 0x64, 0x64, 0x0B, 0x02, 0xEB, 0xEB, 0x54,
+  0xE0, 0x00, 0x1F, 0x05, 0xFF, 0xFF, 0x6E, 0xFF, 0x55, 0x55, 0x9C, 0x07,
+  0xC3, 0xE7, 0xE0, 0x0B, 0x00, 0xE3, 0x0F, 0xFB, 0xE0, 0x03, 0x17, 0xE3,
+  0x77, 0x3F, 0xE0, 0xB7, 0x7F, 0x4F, 0xE3, 0x43, 0xDF, 0xC0, 0x03, 0x4F,
+  0xD7, 0x43, 0xE7, 0x4B, 0xE7, 0x02, 0x90, 0x90, 0x90, 0xE0, 0x0C, 0x03,
+  0x48, 0x03, 0x02, 0x8D, 0x8D, 0x8D, 0x68, 0x27, 0x1C, 0xB5, 0x76, 0x14,
+  0xFF, 0xC5, 0x5F, 0x1D, 0xFF, 0xC8, 0x5F, 0x1C, 0xFF, 0xC8, 0x5E, 0x1A,
+  0xFF, 0xC5, 0x5C, 0x19, 0xFF, 0xC2, 0x5A, 0x18, 0xFF, 0xC0, 0x59, 0x18,
+  0xFF, 0xBD, 0x27, 0xEB, 0x0A, 0xBC, 0x58, 0x19, 0xFF, 0xBB, 0x58, 0x1A,
+  0xFF, 0xBA, 0x58, 0x1B, 0x20, 0x03, 0x07, 0x1F, 0xFF, 0xB9, 0x57, 0x24,
+  0xFF, 0xB3, 0x52, 0x2F, 0xFF, 0x04, 0x54, 0x20, 0xFF, 0xA9, 0x70, 0xFF,
+  0x39, 0xFF, 0x10, 0xC0, 0xE1, 0xB7, 0x7F, 0xE0, 0xB7, 0xBF, 0x06, 0x1E,
+  0x1E, 0x00, 0xFF, 0xD7, 0xD7, 0x40, 0x63, 0xF7, 0x43, 0xFB, 0xC0, 0x03,
+  0x02, 0xD6, 0xD6, 0x3F, 0x20, 0x17, 0x00, 0x4F, 0x60, 0x0F, 0x4F, 0xE7,
+  0x40, 0x03, 0x02, 0x12, 0x12, 0x00, 0x7F, 0xFF, 0x08, 0x24, 0x40, 0x23,
+  0x44, 0x2B, 0x40, 0x13, 0xE3, 0x03, 0xCB, 0xE0, 0x03, 0x00, 0xEC, 0x0F,
+  0x13, 0xE0, 0x03, 0x2F, 0xEB, 0xFF, 0x3C, 0xFF, 0x4B, 0xF7, 0x43, 0xE7,
+  0x43, 0xEF, 0x02, 0x91, 0x91, 0x91, 0x7F, 0xFF, 0x11, 0xB8, 0x43, 0xDF,
+  0x02, 0x8B, 0x8B, 0x8B, 0x7F, 0xFF, 0x0F, 0xEC, 0x4B, 0xEB, 0xC0, 0x03,
+  0x47, 0xF7, 0x40, 0x03, 0x40, 0x0F, 0x02, 0x87, 0x87, 0x87, 0x6F, 0xFF,
+  0x02, 0xB0, 0x73, 0x15, 0x63, 0xD7, 0x08, 0xBE, 0x59, 0x20, 0xFF, 0xBD,
+  0x57, 0x1F, 0xFF, 0xBA, 0x27, 0xD7, 0x0E, 0xB6, 0x51, 0x1A, 0xFF, 0xB2,
+  0x50, 0x1A, 0xFF, 0xAD, 0x4C, 0x17, 0xFF, 0xAC, 0x4D, 0x19, 0x20, 0x03,
+  0x18, 0x1A, 0xFF, 0xAC, 0x4E, 0x1B, 0xFF, 0xAE, 0x4E, 0x1F, 0xFF, 0xB2,
+  0x4C, 0x23, 0xFF, 0xAF, 0x4A, 0x1E, 0xFF, 0xAD, 0x4B, 0x1C, 0xFF, 0xA7,
+  0x6D, 0x15, 0xE2, 0xB8, 0xFF, 0xE3, 0xB7, 0xBF, 0xE0, 0x37, 0xBF, 0x4B,
+  0xDB, 0x06, 0xF2, 0xF2, 0x5B, 0xFF, 0xC9, 0xC9, 0x41, 0x6B, 0xD7, 0x03,
+  0x1C, 0x1C, 0x00, 0xFF, 0x54, 0x07, 0x43, 0xE3, 0x02, 0xC6, 0xC6, 0x3E,
+  0x60, 0x13, 0x01, 0x2B, 0x2B, 0x44, 0x23, 0x04, 0x4F, 0xFF, 0xCD, 0xCD,
+  0x45, 0x24, 0x17, 0x04, 0x4E, 0xFF, 0xAD, 0xAD, 0x25, 0x60, 0x37, 0x44,
+  0x03, 0x43, 0xF3, 0xE3, 0x0F, 0xEB, 0xE0, 0x07, 0x00, 0xE3, 0x03, 0xFB,
+  0x40, 0x00, 0xE3, 0xFF, 0x3C, 0xFF, 0x4B, 0xF7, 0x43, 0xEF, 0x43, 0xD7,
+  0x43, 0xD3, 0x02, 0x84, 0x84, 0x84, 0x7F, 0xFF, 0x14, 0xB0, 0x01, 0x7F,
+  0x7F, 0x9F, 0xFF, 0x65, 0xC0, 0x05, 0x81, 0x81, 0x81, 0xFF, 0x80, 0x80,
+  0x9F, 0xFF, 0x49, 0x70, 0x02, 0x7E, 0x7E, 0x7E, 0x60, 0x17, 0x40, 0x07,
+  0x02, 0x7D, 0x7D, 0x7D, 0x68, 0x33, 0x00, 0xA9, 0x2B, 0xC3, 0x04, 0xB1,
+  0x52, 0x1D, 0xFF, 0xAF, 0x23, 0xDF, 0x14, 0xAC, 0x4B, 0x1A, 0xFF, 0xA8,
+  0x47, 0x19, 0xFF, 0xA3, 0x44, 0x17, 0xFF, 0x9F, 0x42, 0x16, 0xFF, 0x9F,
+  0x44, 0x19, 0xFF, 0x9E, 0x20, 0x03, 0x19, 0x9C, 0x44, 0x18, 0xFF, 0x9B,
+  0x43, 0x17, 0xFF, 0x9D, 0x41, 0x19, 0xFF, 0xA1, 0x3F, 0x1B, 0xFF, 0xA0,
+  0x3D, 0x17, 0xFF, 0x9E, 0x3E, 0x13, 0xFF, 0xA0, 0x66, 0xEF, 0xFF, 0xBA,
+  0xFF, 0x43, 0xC3, 0x40, 0x03, 0x43, 0xF3, 0x02, 0x68, 0x68, 0x05, 0xE3,
+  0x00, 0xD7, 0x05, 0xC7, 0xC7, 0x3F, 0xFF, 0x3D, 0x3D, 0x80, 0x0F, 0x44,
+  0x23, 0x02, 0x51, 0x51, 0x00, 0xF0, 0x00, 0x0F, 0x44, 0x1B, 0x44, 0x0B,
+  0x40, 0x07, 0xE3, 0x1F, 0xFB, 0xE0, 0x0B, 0x27, 0xE3, 0xFF, 0x3C, 0xFF,
+  0x53, 0xEB, 0x01, 0x8F, 0x8F, 0x8F, 0xD3, 0x02, 0x85, 0x85, 0x85, 0x63,
+  0xEF, 0x43, 0xF3, 0xC3, 0xE3, 0x40, 0x07, 0x43, 0xFF, 0xC0, 0x03, 0x40,
+  0x0F, 0x40, 0x03, 0x43, 0xFF, 0x4C, 0x27, 0x05, 0xA9, 0x71, 0x0E, 0xFF,
+  0xB3, 0x59, 0x27, 0xE3, 0x1F, 0x51, 0x15, 0xFF, 0xA7, 0x4B, 0x13, 0xFF,
+  0xA1, 0x46, 0x14, 0xFF, 0x9E, 0x45, 0x17, 0xFF, 0x9A, 0x41, 0x17, 0xFF,
+  0x97, 0x40, 0x15, 0xFF, 0x9A, 0x43, 0x15, 0xFF, 0x9B, 0x45, 0x13, 0xFF,
+  0x9B, 0x14, 0x47, 0x0F, 0xFF, 0x99, 0x47, 0x13, 0xFF, 0x91, 0x44, 0x1A,
+  0xFF, 0x94, 0x43, 0x18, 0xFF, 0x96, 0x41, 0x15, 0xFF, 0x99, 0x64, 0x9F,
+  0xFF, 0x14, 0x00, 0xFF, 0x73, 0xFF, 0x0E, 0xC0, 0xE6, 0x37, 0xFF, 0xE0,
+  0xF7, 0x3F, 0x43, 0xC3, 0x43, 0xEB, 0x06, 0xBB, 0xBB, 0x33, 0xFF, 0xED,
+  0xED, 0x65, 0x64, 0x0B, 0x5F, 0xE7, 0x02, 0xDD, 0xDD, 0x55, 0x60, 0x1B,
+  0x43, 0xFB, 0x40, 0x03, 0x44, 0x23, 0x02, 0xCB, 0xCB, 0x43, 0xE0, 0x00,
+  0x0B, 0x40, 0x37, 0x50, 0x27, 0xE7, 0x07, 0xD3, 0xE0, 0x23, 0x00, 0x44,
+  0x13, 0xE1, 0xF7, 0x7F, 0xE0, 0x37, 0xFF, 0x02, 0xA1, 0xA1, 0xA1, 0x7B,
+  0xCF, 0xCB, 0xD3, 0x02, 0x83, 0x83, 0x83, 0x67, 0xE3, 0x43, 0xDF, 0xC3,
+  0xE7, 0x40, 0x0B, 0x02, 0x7C, 0x7C, 0x7C, 0x60, 0x03, 0x40, 0x0B, 0x02,
+  0x7A, 0x7A, 0x7A, 0x7F, 0xFF, 0x30, 0xF0, 0x43, 0xFF, 0x1F, 0xAC, 0x79,
+  0x0E, 0xFF, 0xAE, 0x5C, 0x0E, 0xFF, 0xA3, 0x55, 0x0B, 0xFF, 0xA0, 0x53,
+  0x0D, 0xFF, 0x9C, 0x4E, 0x0C, 0xFF, 0x97, 0x47, 0x0B, 0xFF, 0x94, 0x44,
+  0x0A, 0xFF, 0x96, 0x46, 0x0C, 0xFF, 0x02, 0x95, 0x45, 0x08, 0x20, 0x03,
+  0x13, 0x06, 0xFF, 0x93, 0x45, 0x04, 0xFF, 0x90, 0x45, 0x07, 0xFF, 0x8D,
+  0x47, 0x10, 0xFF, 0x8B, 0x44, 0x0C, 0xFF, 0x8C, 0x40, 0x20, 0x1B, 0x01,
+  0x65, 0x0D, 0xE0, 0x38, 0xBF, 0xE0, 0x37, 0xFF, 0xE0, 0xFF, 0x38, 0x3F,
+  0x02, 0xE2, 0xE2, 0x5A, 0x7F, 0xFF, 0x13, 0xDC, 0xDF, 0xFF, 0x1C, 0x00,
+  0x02, 0xB6, 0xB6, 0x2E, 0x67, 0xDB, 0xD4, 0x13, 0x06, 0xFF, 0xFF, 0x69,
+  0xFF, 0xEA, 0xEA, 0x53, 0x7F, 0xFF, 0x1C, 0x08, 0x5C, 0x1F, 0x44, 0x07,
+  0x01, 0xCE, 0xCE, 0x88, 0x03, 0x02, 0xCF, 0xCF, 0x47, 0x67, 0xFF, 0x47,
+  0xC7, 0xE0, 0x07, 0x03, 0xC4, 0x07, 0xC0, 0x17, 0x40, 0x0F, 0xC0, 0x0B,
+  0xC0, 0x07, 0xE3, 0xFF, 0x3C, 0xFF, 0x01, 0xAD, 0xAD, 0x9F, 0xFF, 0x37,
+  0xEC, 0x01, 0xAE, 0xAE, 0x9F, 0xFF, 0x37, 0xF0, 0x01, 0xA4, 0xA4, 0x9F,
+  0xFF, 0x08, 0x00, 0x01, 0xA5, 0xA5, 0x9F, 0xFF, 0x0C, 0x0C, 0x5C, 0x13,
+  0x5C, 0x07, 0x40, 0x07, 0x4C, 0x2B, 0x57, 0xF3, 0x58, 0x1B, 0x00, 0x97,
+  0xBF, 0xFF, 0x9D, 0xA0, 0x1F, 0xC9, 0x82, 0x17, 0xFF, 0xCA, 0x84, 0x1A,
+  0xFF, 0xC3, 0x86, 0x1D, 0xFF, 0xBD, 0x82, 0x1C, 0xFF, 0xB8, 0x78, 0x13,
+  0xFF, 0xB9, 0x75, 0x12, 0xFF, 0xBE, 0x78, 0x15, 0xFF, 0xBD, 0x76, 0x13,
+  0xFF, 0x1D, 0xB6, 0x70, 0x0C, 0xFF, 0xB3, 0x70, 0x0B, 0xFF, 0xB1, 0x72,
+  0x0B, 0xFF, 0xAD, 0x6F, 0x08, 0xFF, 0xAC, 0x6C, 0x08, 0xFF, 0xA9, 0x69,
+  0x09, 0xFF, 0xA6, 0x66, 0x0C, 0xFF, 0xA5, 0x66, 0xE7, 0xFF, 0xBA, 0xFF,
+  0x0C, 0xCB, 0x2E, 0x2E, 0xFF, 0xD3, 0x2F, 0x2F, 0xFF, 0xC6, 0x2D, 0x2D,
+  0xFF, 0xCA, 0x20, 0x03, 0x08, 0xDD, 0x32, 0x32, 0xFF, 0xEB, 0x35, 0x35,
+  0xFF, 0xCD, 0x20, 0x17, 0x00, 0xD0, 0x20, 0x17, 0x04, 0xE5, 0x34, 0x34,
+  0xFF, 0xE8, 0x20, 0x03, 0x04, 0xBD, 0x2A, 0x2A, 0xFF, 0xC8, 0x20, 0x1F,
+  0x00, 0xE0, 0x20, 0x1F, 0x40, 0x03, 0x40, 0x0B, 0x05, 0xC1, 0x2B, 0x2B,
+  0xFF, 0xCB, 0x7C, 0x20, 0x3F, 0x00, 0x81, 0x20, 0x3F, 0x00, 0x79, 0x20,
+  0x3F, 0x00, 0x7B, 0x20, 0x3F, 0x00, 0x87, 0x20, 0x3F, 0x00, 0x8F, 0x20,
+  0x3F, 0x00, 0x7D, 0x20, 0x3F, 0x00, 0x7F, 0x20, 0x3F, 0x00, 0x8C, 0x20,
+  0x3F, 0x00, 0x8E, 0x20, 0x3F, 0x00, 0x73, 0x20, 0x3F, 0x00, 0x7A, 0x20,
+  0x3F, 0x00, 0x89, 0x20, 0x3F, 0x20, 0x03, 0x40, 0x0B, 0x01, 0xC1, 0x76,
+  0x20, 0x3F, 0x00, 0xCB, 0x20, 0x3F, 0x00, 0xD3, 0x20, 0x3F, 0x00, 0xC6,
+  0x20, 0x3F, 0x00, 0xCA, 0x20, 0x3F, 0x00, 0xDD, 0x20, 0x3F, 0x00, 0xEB,
+  0x20, 0x3F, 0x00, 0xCD, 0x20, 0x3F, 0x00, 0xD0, 0x20, 0x3F, 0x00, 0xE5,
+  0x20, 0x3F, 0x00, 0xE8, 0x20, 0x3F, 0x00, 0xBD, 0x20, 0x3F, 0x00, 0xC8,
+  0x20, 0x3F, 0x01, 0xE0, 0x32, 0x60, 0x03, 0x40, 0x0B, 0x04, 0xC1, 0xC1,
+  0x2B, 0xFF, 0x7C, 0x20, 0x3F, 0x00, 0x81, 0x20, 0x3F, 0x00, 0x79, 0x20,
+  0x3F, 0x00, 0x7B, 0x20, 0x3F, 0x04, 0x87, 0xDD, 0x32, 0xFF, 0x8F, 0x20,
+  0x3F, 0x00, 0x7D, 0x20, 0x3F, 0x00, 0x7F, 0x20, 0x3F, 0x00, 0x8C, 0x20,
+  0x3F, 0x00, 0x8E, 0x20, 0x3F, 0x00, 0x73, 0x20, 0x3F, 0x00, 0x7A, 0x20,
+  0x3F, 0x00, 0x89, 0x20, 0x3F, 0x40, 0x03, 0x40, 0x0B, 0x00, 0x76, 0x20,
+  0x3F, 0x00, 0x2E, 0x20, 0x3F, 0x00, 0x2F, 0x20, 0x3F, 0x00, 0x2D, 0x20,
+  0x3F, 0x00, 0x2D, 0x20, 0x3F, 0x00, 0x32, 0x20, 0x3F, 0x00, 0x35, 0x20,
+  0x3F, 0x00, 0x2E, 0x20, 0x3F, 0x00, 0x2F, 0x20, 0x3F, 0x00, 0x34, 0x20,
+  0x3F, 0x00, 0x34, 0x20, 0x3F, 0x00, 0x2A, 0x20, 0x3F, 0x00, 0x2D, 0x20,
+  0x3F, 0x00, 0x32, 0x20, 0x3F, 0x40, 0x03, 0x40, 0x0B, 0x00, 0x2B, 0x60,
+  0x3F, 0x00, 0x7C, 0x20, 0x3F, 0x00, 0x81, 0x20, 0x3F, 0x00, 0x79, 0x20,
+  0x3F, 0x00, 0x7B, 0x20, 0x3F, 0x00, 0x87, 0x20, 0x3F, 0x00, 0x8F, 0x20,
+  0x3F, 0x00, 0x7D, 0x20, 0x3F, 0x00, 0x7F, 0x20, 0x3F, 0x00, 0x8C, 0x20,
+  0x3F, 0x00, 0x8E, 0x20, 0x3F, 0x00, 0x73, 0x20, 0x33, 0x00, 0x7A, 0x20,
+  0x3B, 0x00, 0x89, 0x60, 0x03, 0x40, 0x0B, 0x02, 0x2B, 0xC1, 0x76, 0x20,
+  0x7F, 0x00, 0xCB, 0x20, 0x3F, 0x00, 0xD3, 0x20, 0x3F, 0x00, 0xC6, 0x20,
+  0x3F, 0x00, 0xCA, 0x20, 0x3F, 0x00, 0xDD, 0x20, 0x3F, 0x00, 0xEB, 0x20,
+  0x3F, 0x00, 0xCD, 0x20, 0x3F, 0x00, 0xD0, 0x20, 0x3F, 0x00, 0xE5, 0x20,
+  0x3F, 0x00, 0xE8, 0x20, 0x3F, 0x00, 0xBD, 0x20, 0x33, 0x00, 0xC8, 0x20,
+  0x3B, 0x00, 0xE0, 0x60, 0x03, 0x40, 0x0B, 0x1F, 0x2B, 0xC1, 0xC1, 0xFF,
+  0x5F, 0x95, 0xCB, 0xFF, 0x63, 0x9B, 0xD3, 0xFF, 0x5D, 0x91, 0xC6, 0xFF,
+  0x5F, 0x94, 0xCA, 0xFF, 0x68, 0xA3, 0xDD, 0xFF, 0x6F, 0xAD, 0xEB, 0xFF,
+  0x60, 0x96, 0xCD, 0xFF, 0x16, 0x62, 0x99, 0xD0, 0xFF, 0x6C, 0xA8, 0xE5,
+  0xFF, 0x6D, 0xAA, 0xE8, 0xFF, 0x59, 0x8B, 0xBD, 0xFF, 0x5E, 0x93, 0xC8,
+  0xFF, 0x69, 0xA5, 0xE0, 0x60, 0x03, 0x40, 0x0B, 0x0A, 0x5B, 0x8E, 0xC1,
+  0xFF, 0x6E, 0x6E, 0xCB, 0xFF, 0x72, 0x72, 0xD3, 0x3D, 0xCB, 0x08, 0xC6,
+  0xFF, 0x6D, 0x6D, 0xCA, 0xFF, 0x77, 0x77, 0xDD, 0x28, 0x3F, 0x0C, 0xEB,
+  0xFF, 0x6F, 0x6F, 0xCD, 0xFF, 0x70, 0x70, 0xD0, 0xFF, 0x7B, 0x7B, 0xE5,
+  0x28, 0x47, 0x08, 0xE8, 0xFF, 0x66, 0x66, 0xBD, 0xFF, 0x6C, 0x6C, 0xC8,
+  0x28, 0x37, 0x00, 0xE0, 0x60, 0x03, 0x40, 0x0B, 0x1F, 0x68, 0x68, 0xC1,
+  0xFF, 0x7C, 0x2E, 0xCB, 0xFF, 0x81, 0x2F, 0xD3, 0xFF, 0x79, 0x2D, 0xC6,
+  0xFF, 0x7B, 0x2D, 0xCA, 0xFF, 0x87, 0x32, 0xDD, 0xFF, 0x8F, 0x35, 0xEB,
+  0xFF, 0x7D, 0x2E, 0xCD, 0xFF, 0x16, 0x7F, 0x2F, 0xD0, 0xFF, 0x8C, 0x34,
+  0xE5, 0xFF, 0x8E, 0x34, 0xE8, 0xFF, 0x73, 0x2A, 0xBD, 0xFF, 0x7A, 0x2D,
+  0xC8, 0xFF, 0x89, 0x32, 0xE0, 0x60, 0x03, 0x40, 0x0B, 0x0E, 0x76, 0x2B,
+  0xC1, 0xFF, 0x9F, 0x43, 0xCB, 0xFF, 0xA6, 0x46, 0xD3, 0xFF, 0x9C, 0x41,
+  0xC6, 0x20, 0x0B, 0x1F, 0xCA, 0xFF, 0xAD, 0x49, 0xDD, 0xFF, 0xB8, 0x4E,
+  0xEB, 0xFF, 0xA1, 0x44, 0xCD, 0xFF, 0xA3, 0x45, 0xD0, 0xFF, 0xB4, 0x4C,
+  0xE5, 0xFF, 0xB6, 0x4D, 0xE8, 0xFF, 0x94, 0x3F, 0xBD, 0xFF, 0x9D, 0x42,
+  0x04, 0xC8, 0xFF, 0xB0, 0x4A, 0xE0, 0x60, 0x03, 0x40, 0x0B, 0x02, 0x98,
+  0x3F, 0xC1, 0x22, 0xBF, 0x00, 0xCB, 0x22, 0xBF, 0x00, 0xD3, 0x22, 0xBF,
+  0x00, 0xC6, 0x22, 0xBF, 0x00, 0xCA, 0x22, 0xBF, 0x02, 0xDD, 0xFF, 0xEB,
+  0x20, 0x7F, 0x00, 0xCD, 0x20, 0x7F, 0x00, 0xD0, 0x20, 0x7F, 0x00, 0xE5,
+  0x20, 0x7F, 0x00, 0xE8, 0x20, 0x7F, 0x00, 0xBD, 0x20, 0x7F, 0x00, 0xC8,
+  0x20, 0x7F, 0x00, 0xE0, 0x20, 0x7F, 0x40, 0x03, 0x40, 0x0B, 0x00, 0xC1,
+  0x20, 0x7F, 0x02, 0xCB, 0x2E, 0x7C, 0x20, 0x3F, 0x00, 0x81, 0x20, 0x3F,
+  0x00, 0x79, 0x20, 0x3F, 0x00, 0x7B, 0x20, 0x3F, 0x00, 0x87, 0x20, 0x3F,
+  0x00, 0x8F, 0x20, 0x3F, 0x00, 0x7D, 0x20, 0x3F, 0x00, 0x7F, 0x20, 0x3F,
+  0x00, 0x8C, 0x20, 0x3F, 0x00, 0x8E, 0x20, 0x3F, 0x00, 0x73, 0x20, 0x33,
+  0x00, 0x7A, 0x20, 0x3B, 0x00, 0x89, 0x60, 0x03, 0x40, 0x0B, 0x06, 0xC1,
+  0x2B, 0x76, 0xFF, 0x43, 0x43, 0x43, 0x7F, 0xFF, 0x67, 0x14, 0x06, 0x40,
+  0x40, 0x40, 0xFF, 0x42, 0x42, 0x42, 0x7F, 0xFF, 0x87, 0x2C, 0x06, 0x53,
+  0x53, 0x53, 0xFF, 0x44, 0x44, 0x44, 0x7F, 0xFF, 0x32, 0xB8, 0x06, 0x50,
+  0x50, 0x50, 0xFF, 0x52, 0x52, 0x52, 0x7F, 0xFF, 0x7F, 0x54, 0x02, 0x41,
+  0x41, 0x41, 0x7F, 0xFF, 0x67, 0x64, 0x02, 0x4E, 0x4E, 0x4E, 0x60, 0x0B,
+  0x03, 0x3D, 0x3D, 0x3D, 0xFF, 0x4D, 0xAB, 0x51, 0xB7, 0x49, 0x97, 0x4D,
+  0xA3, 0x00, 0x8F, 0x2D, 0xCB, 0x45, 0x9F, 0x02, 0x82, 0x82, 0x82, 0x6D,
+  0xCF, 0x02, 0x94, 0x94, 0x94, 0x71, 0xA7, 0x01, 0x77, 0x77, 0x9F, 0xFF,
+  0x2F, 0x58, 0x55, 0xE3, 0x40, 0x03, 0x51, 0xDF, 0x49, 0xC7, 0x00, 0xCB,
+  0x22, 0x3F, 0x00, 0xD3, 0x22, 0x3F, 0x00, 0xC6, 0x22, 0x3F, 0x00, 0xCA,
+  0x22, 0x3F, 0x01, 0xDD, 0xDD, 0x20, 0xFF, 0x22, 0x3F, 0x00, 0xCD, 0x22,
+  0x3F, 0x00, 0xD0, 0x22, 0x3F, 0x00, 0xE5, 0x22, 0x3F, 0x00, 0xE8, 0x22,
+  0x3F, 0x00, 0xBD, 0x22, 0x3F, 0x00, 0xC8, 0x22, 0x3F, 0x00, 0xE0, 0x22,
+  0x3F, 0x40, 0x03, 0x40, 0x0B, 0x00, 0xC1, 0x22, 0x3F, 0x00, 0xDE, 0x23,
+  0xCF, 0x0E, 0xE4, 0x33, 0x33, 0xFF, 0xFB, 0x39, 0x39, 0xFF, 0xFF, 0x3A,
+  0x3A, 0xFF, 0xEE, 0x36, 0x36, 0x20, 0xEF, 0x08, 0x34, 0xFF, 0xD8, 0x31,
+  0x31, 0xFF, 0xD7, 0x30, 0x30, 0x21, 0x13, 0x00, 0x2D, 0x20, 0xE7, 0x00,
+  0x2B, 0x21, 0x0B, 0x00, 0x2F, 0x60, 0x0F, 0x06, 0xB3, 0x28, 0x28, 0xFF,
+  0xC3, 0x2C, 0x2C, 0x21, 0x33, 0x02, 0x2F, 0xFF, 0xDA, 0x20, 0x23, 0x01,
+  0xDE, 0x88, 0x20, 0x3F, 0x00, 0x8B, 0x20, 0x3F, 0x01, 0x99, 0x39, 0x32,
+  0x8C, 0x20, 0x3F, 0x00, 0x92, 0x20, 0x3F, 0x23, 0xEF, 0x01, 0xD8, 0x84,
+  0x20, 0x3F, 0x00, 0x83, 0x20, 0x3F, 0x24, 0x13, 0x43, 0xE7, 0x44, 0x0B,
+  0x40, 0x0F, 0x01, 0xB3, 0x6D, 0x20, 0x3F, 0x00, 0x77, 0x20, 0x3F, 0x24,
+  0x33, 0x01, 0xDA, 0x85, 0x20, 0x3F, 0x00, 0xDE, 0x20, 0x3F, 0x00, 0xE4,
+  0x20, 0x3F, 0x01, 0xFB, 0x39, 0x28, 0x6B, 0x20, 0x3F, 0x00, 0xEE, 0x20,
+  0x3F, 0x23, 0x6F, 0x01, 0xD8, 0xD8, 0x20, 0x3F, 0x00, 0xD7, 0x20, 0x3F,
+  0x23, 0x93, 0x43, 0xE7, 0x44, 0x0B, 0x40, 0x0F, 0x01, 0xB3, 0xB3, 0x20,
+  0x3F, 0x00, 0xC3, 0x20, 0x3F, 0x23, 0xB3, 0x04, 0xDA, 0xDA, 0x31, 0xFF,
+  0x88, 0x20, 0x3F, 0x00, 0x8B, 0x20, 0x3F, 0x00, 0x99, 0x20, 0x3F, 0x00,
+  0x9C, 0x20, 0x3F, 0x00, 0x92, 0x20, 0x3F, 0x43, 0xEF, 0x00, 0x84, 0x20,
+  0x3F, 0x00, 0x83, 0x20, 0x3F, 0x44, 0x13, 0x00, 0x76, 0x23, 0xA7, 0x00,
+  0x7F, 0x23, 0xCB, 0x40, 0x0F, 0x00, 0x6D, 0x20, 0x3F, 0x00, 0x77, 0x20,
+  0x3F, 0x44, 0x33, 0x00, 0x85, 0x20, 0x3F, 0x00, 0x32, 0x20, 0x3F, 0x00,
+  0x33, 0x20, 0x3F, 0x00, 0x39, 0x20, 0x3F, 0x00, 0x3A, 0x20, 0x01, 0x00,
+  0x36, 0x20, 0x3F, 0x43, 0xEF, 0x00, 0x31, 0x20, 0x3F, 0x00, 0x30, 0x20,
+  0x3F, 0x44, 0x13, 0x43, 0xE7, 0x44, 0x0B, 0x40, 0x0F, 0x00, 0x28, 0x20,
+  0x3F, 0x00, 0x2C, 0x20, 0x3F, 0x44, 0x33, 0x00, 0x31, 0x60, 0x3F, 0x00,
+  0x88, 0x20, 0x3F, 0x00, 0x8B, 0x20, 0x3F, 0x00, 0x99, 0x20, 0x3D, 0x00,
+  0x9C, 0x20, 0x3F, 0x00, 0x92, 0x20, 0x3F, 0x00, 0x8E, 0x20, 0x3F, 0x00,
+  0x84, 0x20, 0x2F, 0x00, 0x83, 0x20, 0x3F, 0x00, 0x7B, 0x20, 0x3F, 0x00,
+  0x76, 0x20, 0x3F, 0x00, 0x7F, 0x60, 0x0F, 0x02, 0x28, 0xB3, 0x6D, 0x20,
+  0x3F, 0x00, 0x77, 0x20, 0x3F, 0x00, 0x81, 0x20, 0x3F, 0x00, 0x85, 0x20,
+  0x7F, 0x00, 0xDE, 0x20, 0x3F, 0x00, 0xE4, 0x20, 0x3F, 0x00, 0xFB, 0x20,
+  0x3F, 0x00, 0xFF, 0x20, 0x3F, 0x00, 0xEE, 0x20, 0x3F, 0x00, 0xE8, 0x20,
+  0x3F, 0x00, 0xD8, 0x20, 0x2F, 0x00, 0xD7, 0x20, 0x3F, 0x00, 0xCA, 0x20,
+  0x3F, 0x00, 0xC1, 0x20, 0x3F, 0x00, 0xD0, 0x60, 0x0F, 0x02, 0x28, 0xB3,
+  0xB3, 0x20, 0x3F, 0x00, 0xC3, 0x20, 0x3F, 0x00, 0xD3, 0x20, 0x3F, 0x14,
+  0xDA, 0xFF, 0x69, 0xA3, 0xDE, 0xFF, 0x6B, 0xA7, 0xE4, 0xFF, 0x76, 0xB8,
+  0xFB, 0xFF, 0x78, 0xBB, 0xFF, 0xFF, 0x70, 0xAF, 0xEE, 0x63, 0xEF, 0x06,
+  0x66, 0x9E, 0xD8, 0xFF, 0x65, 0x9E, 0xD7, 0x64, 0x13, 0x43, 0xE7, 0x44,
+  0x0B, 0x40, 0x0F, 0x06, 0x54, 0x83, 0xB3, 0xFF, 0x5C, 0x8F, 0xC3, 0x64,
+  0x33, 0x06, 0x66, 0xA0, 0xDA, 0xFF, 0x78, 0x78, 0xDE, 0x23, 0xE3, 0x00,
+  0xE4, 0x22, 0x83, 0x04, 0xFB, 0xFF, 0x8A, 0x8A, 0xFF, 0x22, 0x8F, 0x00,
+  0xEE, 0x63, 0xEF, 0x06, 0x75, 0x75, 0xD8, 0xFF, 0x74, 0x74, 0xD7, 0x64,
+  0x13, 0x43, 0xE7, 0x44, 0x0B, 0x40, 0x0F, 0x07, 0x61, 0x61, 0xB3, 0xFF,
+  0x6A, 0x6A, 0xC3, 0xFF, 0x44, 0x33, 0x0E, 0x76, 0x76, 0xDA, 0xFF, 0x88,
+  0x32, 0xDE, 0xFF, 0x8B, 0x33, 0xE4, 0xFF, 0x99, 0x39, 0xFB, 0x41, 0xFE,
+  0x03, 0xFF, 0x92, 0x36, 0xEE, 0x63, 0xEF, 0x06, 0x84, 0x31, 0xD8, 0xFF,
+  0x83, 0x30, 0xD7, 0x64, 0x13, 0x00, 0x76, 0x23, 0x67, 0x44, 0x0B, 0x40,
+  0x0F, 0x06, 0x6D, 0x28, 0xB3, 0xFF, 0x77, 0x2C, 0xC3, 0x64, 0x33, 0x16,
+  0x85, 0x31, 0xDA, 0xFF, 0xAE, 0x49, 0xDE, 0xFF, 0xB3, 0x4B, 0xE4, 0xFF,
+  0xC5, 0x53, 0xFB, 0xFF, 0xC8, 0x55, 0xFF, 0xFF, 0xBB, 0x4F, 0xEE, 0x63,
+  0xEF, 0x06, 0xAA, 0x48, 0xD8, 0xFF, 0xA9, 0x48, 0xD7, 0x64, 0x13, 0x43,
+  0xE7, 0x44, 0x0B, 0x40, 0x0F, 0x06, 0x8D, 0x3C, 0xB3, 0xFF, 0x99, 0x41,
+  0xC3, 0x64, 0x33, 0x02, 0xAB, 0x48, 0xDA, 0x22, 0xBF, 0x00, 0xDE, 0x22,
+  0xBF, 0x00, 0xE4, 0x22, 0xBF, 0x00, 0xFB, 0x42, 0x3E, 0x22, 0xBF, 0x00,
+  0xEE, 0x22, 0xBF, 0x00, 0xE8, 0x22, 0xBF, 0x00, 0xD8, 0x22, 0xAF, 0x00,
+  0xD7, 0x22, 0xBF, 0x00, 0xCA, 0x22, 0xBF, 0x00, 0xC1, 0x22, 0xBF, 0x00,
+  0xD0, 0x60, 0x0F, 0x00, 0xB3, 0x20, 0x7F, 0x00, 0xC3, 0x20, 0x7F, 0x44,
+  0x33, 0x00, 0xDA, 0x20, 0x7F, 0x02, 0xDE, 0x32, 0x88, 0x20, 0x3F, 0x00,
+  0x8B, 0x20, 0x3F, 0x00, 0x99, 0x20, 0x3F, 0x00, 0x9C, 0x20, 0x3F, 0x00,
+  0x92, 0x20, 0x3F, 0x00, 0x8E, 0x20, 0x3F, 0x00, 0x84, 0x20, 0x2F, 0x00,
+  0x83, 0x20, 0x3F, 0x00, 0x7B, 0x20, 0x3F, 0x00, 0x76, 0x20, 0x3F, 0x00,
+  0x7F, 0x60, 0x0F, 0x02, 0xB3, 0x28, 0x6D, 0x20, 0x3F, 0x00, 0x77, 0x20,
+  0x3F, 0x00, 0x81, 0x20, 0x3F, 0x00, 0x85, 0x63, 0xEF, 0x43, 0xE3, 0x01,
+  0x5C, 0x5C, 0x9F, 0xFF, 0x83, 0x1C, 0x03, 0x55, 0x55, 0x55, 0xFF, 0x43,
+  0xEF, 0x02, 0x4A, 0x4A, 0x4A, 0x7F, 0xFF, 0x56, 0x84, 0x44, 0x13, 0x43,
+  0xE7, 0x02, 0x45, 0x45, 0x45, 0x60, 0x0F, 0x00, 0x36, 0x23, 0x5F, 0x02,
+  0x3F, 0x3F, 0x3F, 0x64, 0x33, 0x02, 0x4B, 0x4B, 0x4B, 0x63, 0xEF, 0x4D,
+  0x87, 0x49, 0xB7, 0x06, 0xA7, 0xA7, 0xA7, 0xFF, 0x9B, 0x9B, 0x9B, 0x63,
+  0xEF, 0x00, 0x8A, 0x21, 0x8C, 0x40, 0x03, 0x44, 0x13, 0x43, 0xE7, 0x51,
+  0xDB, 0x40, 0x0F, 0x02, 0x6F, 0x6F, 0x6F, 0x21, 0xAF, 0x00, 0x7B, 0x21,
+  0xAF, 0x00, 0x87, 0x75, 0xF7, 0x00, 0xDE, 0x22, 0x3F, 0x00, 0xE4, 0x22,
+  0x3F, 0x00, 0xFB, 0x22, 0x3F, 0x40, 0x00, 0x00, 0xEE, 0x22, 0x3F, 0x43,
+  0xEF, 0x00, 0xD8, 0x22, 0x3F, 0x00, 0xD7, 0x22, 0x3F, 0x44, 0x13, 0x43,
+  0xE7, 0x44, 0x0B, 0x40, 0x0F, 0x00, 0xB3, 0x22, 0x3F, 0x00, 0xC3, 0x22,
+  0x3F, 0x44, 0x33, 0x00, 0xDA, 0x22, 0x3F, 0x43, 0xEF, 0x00, 0xF1, 0x20,
+  0x93, 0x43, 0xEB, 0x00, 0xDB, 0x23, 0xCF, 0x02, 0xF7, 0x38, 0x38, 0x60,
+  0x0F, 0x00, 0xE1, 0x24, 0x13, 0x40, 0x13, 0x44, 0x0B, 0x40, 0x1F, 0x00,
+  0xE7, 0x24, 0x13, 0x40, 0x03, 0x00, 0xF8, 0x20, 0x1F, 0x00, 0xFD, 0x24,
+  0x2B, 0x40, 0x17, 0x44, 0x37, 0x43, 0xEF, 0x01, 0xF1, 0x93, 0x20, 0x3F,
+  0x23, 0xEB, 0x01, 0xDB, 0x86, 0x20, 0x3F, 0x00, 0x97, 0x20, 0x3F, 0x20,
+  0x0F, 0x01, 0xE1, 0x89, 0x20, 0x3F, 0x20, 0x13, 0x44, 0x0B, 0x00, 0xF1,
+  0x20, 0x0F, 0x01, 0xE7, 0x8D, 0x20, 0x3F, 0x20, 0x03, 0x01, 0xF8, 0x98,
+  0x20, 0x3F, 0x00, 0x9A, 0x20, 0x3F, 0x24, 0x23, 0x44, 0x37, 0x43, 0xEF,
+  0x01, 0xF1, 0xF1, 0x20, 0x3F, 0x23, 0x6B, 0x01, 0xDB, 0xDB, 0x20, 0x3F,
+  0x00, 0xF7, 0x20, 0x3F, 0x20, 0x0F, 0x01, 0xE1, 0xE1, 0x20, 0x3F, 0x20,
+  0x13, 0x44, 0x0B, 0x40, 0x0F, 0x01, 0xE7, 0xE7, 0x20, 0x3F, 0x20, 0x03,
+  0x01, 0xF8, 0xF8, 0x20, 0x3F, 0x00, 0xFD, 0x20, 0x3F, 0x24, 0x23, 0x44,
+  0x37, 0x43, 0xEF, 0x00, 0x93, 0x20, 0x2F, 0x43, 0xDB, 0x00, 0x86, 0x20,
+  0x3F, 0x00, 0x97, 0x20, 0x3F, 0x40, 0x0F, 0x00, 0x89, 0x20, 0x3F, 0x40,
+  0x13, 0x44, 0x0B, 0x40, 0x0F, 0x00, 0x8D, 0x20, 0x3B, 0x40, 0x03, 0x00,
+  0x98, 0x20, 0x3F, 0x00, 0x9A, 0x20, 0x3F, 0x40, 0x17, 0x44, 0x37, 0x43,
+  0xEF, 0x00, 0x36, 0x20, 0x3F, 0x43, 0xDB, 0x00, 0x31, 0x20, 0x3F, 0x00,
+  0x38, 0x20, 0x3F, 0x40, 0x0F, 0x00, 0x33, 0x20, 0x3F, 0x40, 0x13, 0x44,
+  0x0B, 0x40, 0x0F, 0x00, 0x34, 0x20, 0x3F, 0x40, 0x03, 0x00, 0x38, 0x20,
+  0x3F, 0x00, 0x39, 0x20, 0x3F, 0x40, 0x17, 0x44, 0x37, 0x00, 0x36, 0x23,
+  0xEF, 0x02, 0x36, 0xF1, 0x93, 0x20, 0x2B, 0x00, 0x83, 0x20, 0x3F, 0x00,
+  0x86, 0x20, 0x3F, 0x00, 0x97, 0x60, 0x0F, 0x02, 0x33, 0xE1, 0x89, 0x60,
+  0x13, 0x44, 0x0B, 0x40, 0x1F, 0x02, 0x34, 0xE7, 0x8D, 0x60, 0x03, 0x02,
+  0x38, 0xF8, 0x98, 0x20, 0x3F, 0x00, 0x9A, 0x60, 0x17, 0x44, 0x37, 0x43,
+  0xEF, 0x02, 0x36, 0xF1, 0xF1, 0x20, 0x2B, 0x00, 0xD7, 0x20, 0x3F, 0x00,
+  0xDB, 0x20, 0x3F, 0x00, 0xF7, 0x60, 0x0F, 0x02, 0x33, 0xE1, 0xE1, 0x60,
+  0x13, 0x00, 0x34, 0x24, 0x0B, 0x40, 0x1F, 0x02, 0x34, 0xE7, 0xE7, 0x60,
+  0x03, 0x02, 0x38, 0xF8, 0xF8, 0x20, 0x3F, 0x00, 0xFD, 0x60, 0x17, 0x44,
+  0x37, 0x00, 0x70, 0x23, 0xEF, 0x02, 0x72, 0xB1, 0xF1, 0x63, 0xDB, 0x06,
+  0x67, 0xA1, 0xDB, 0xFF, 0x74, 0xB6, 0xF7, 0x60, 0x0F, 0x02, 0x6A, 0xA5,
+  0xE1, 0x60, 0x13, 0x47, 0xFB, 0x40, 0x1F, 0x02, 0x6C, 0xA9, 0xE7, 0x60,
+  0x03, 0x06, 0x75, 0xB6, 0xF8, 0xFF, 0x77, 0xBA, 0xFD, 0x60, 0x17, 0x44,
+  0x37, 0x43, 0xEF, 0x02, 0x82, 0x82, 0xF1, 0x63, 0xDB, 0x06, 0x76, 0x76,
+  0xDB, 0xFF, 0x86, 0x86, 0xF7, 0x60, 0x0F, 0x02, 0x7A, 0x7A, 0xE1, 0x60,
+  0x13, 0x47, 0xFB, 0x40, 0x1F, 0x02, 0x7D, 0x7D, 0xE7, 0x60, 0x03, 0x02,
+  0x86, 0x86, 0xF8, 0x38, 0x6B, 0x00, 0xFD, 0x60, 0x17, 0x44, 0x37, 0x43,
+  0xEF, 0x03, 0x93, 0x36, 0xF1, 0xFF, 0x43, 0xDB, 0x06, 0x86, 0x31, 0xDB,
+  0xFF, 0x97, 0x38, 0xF7, 0x60, 0x0F, 0x02, 0x89, 0x33, 0xE1, 0x60, 0x13,
+  0x47, 0xFB, 0x40, 0x1F, 0x02, 0x8D, 0x34, 0xE7, 0x60, 0x03, 0x06, 0x98,
+  0x38, 0xF8, 0xFF, 0x9A, 0x39, 0xFD, 0x60, 0x17, 0x44, 0x37, 0x43, 0xEF,
+  0x03, 0xBE, 0x50, 0xF1, 0xFF, 0x43, 0xDB, 0x06, 0xAC, 0x48, 0xDB, 0xFF,
+  0xC2, 0x52, 0xF7, 0x60, 0x0F, 0x02, 0xB1, 0x4B, 0xE1, 0x60, 0x13, 0x47,
+  0xFB, 0x40, 0x1F, 0x02, 0xB6, 0x4D, 0xE7, 0x60, 0x03, 0x06, 0xC3, 0x52,
+  0xF8, 0xFF, 0xC7, 0x54, 0xFD, 0x20, 0x0B, 0x00, 0xE8, 0x64, 0x37, 0x43,
+  0xEF, 0x00, 0xF1, 0x20, 0x7F, 0x43, 0xEB, 0x00, 0xDB, 0x20, 0x7F, 0x00,
+  0xF7, 0x20, 0x7F, 0x40, 0x0F, 0x00, 0xE1, 0x20, 0x7F, 0x40, 0x13, 0x44,
+  0x0B, 0x40, 0x0F, 0x00, 0xE7, 0x20, 0x7F, 0x40, 0x03, 0x00, 0xF8, 0x20,
+  0x7F, 0x00, 0xFD, 0x20, 0x7F, 0x40, 0x17, 0x44, 0x37, 0x43, 0xEF, 0x02,
+  0xF1, 0x36, 0x93, 0x20, 0x2B, 0x00, 0x83, 0x20, 0x3F, 0x00, 0x86, 0x20,
+  0x3F, 0x00, 0x97, 0x60, 0x0F, 0x02, 0xE1, 0x33, 0x89, 0x60, 0x13, 0x44,
+  0x0B, 0x40, 0x1F, 0x02, 0xE7, 0x34, 0x8D, 0x60, 0x03, 0x02, 0xF8, 0x38,
+  0x98, 0x20, 0x3F, 0x00, 0x9A, 0x60, 0x17, 0x44, 0x37, 0x43, 0xEF, 0x02,
+  0x57, 0x57, 0x57, 0x63, 0xDB, 0x00, 0x4B, 0x23, 0xCF, 0x02, 0x5A, 0x5A,
+  0x5A, 0x60, 0x0F, 0x47, 0xE3, 0x03, 0x49, 0x49, 0x49, 0xFF, 0x44, 0x0B,
+  0x40, 0x1F, 0x40, 0x07, 0x40, 0x03, 0x40, 0x1F, 0x02, 0x5D, 0x5D, 0x5D,
+  0x60, 0x0B, 0x44, 0x37, 0x43, 0xEF, 0x55, 0xC3, 0x00, 0x8A, 0x23, 0xEF,
+  0x02, 0x8D, 0x8D, 0x8D, 0x7F, 0xFF, 0x01, 0xD0, 0x40, 0x0F, 0x47, 0xE3,
+  0x40, 0x13, 0x02, 0x96, 0x96, 0x96, 0x60, 0x0F, 0x02, 0x95, 0x95, 0x95,
+  0x60, 0x03, 0x02, 0xA2, 0xA2, 0xA2, 0x7F, 0xFF, 0x05, 0xF4, 0x40, 0x17,
+  0x02, 0x93, 0x93, 0x93, 0x23, 0x3F, 0x20, 0xFF, 0x22, 0x3F, 0x43, 0xDB,
+  0x00, 0xDB, 0x22, 0x3F, 0x00, 0xF7, 0x22, 0x3F, 0x40, 0x0F, 0x00, 0xE1,
+  0x22, 0x3F, 0x40, 0x13, 0x44, 0x0B, 0x40, 0x0F, 0x00, 0xE7, 0x22, 0x3F,
+  0x40, 0x03, 0x00, 0xF8, 0x22, 0x3F, 0x00, 0xFD, 0x22, 0x3F, 0x40, 0x17,
+  0x44, 0x37, 0x47, 0xFF, 0x47, 0xCB, 0x02, 0xEA, 0x35, 0x35, 0x20, 0xE7,
+  0x23, 0x87, 0x27, 0xF3, 0x00, 0xD4, 0x20, 0x03, 0x00, 0xDD, 0x28, 0x17,
+  0x40, 0x0F, 0x4C, 0x07, 0x48, 0x0B, 0x40, 0x0B, 0x40, 0x03, 0xC0, 0x2F,
+  0x48, 0x2B, 0x00, 0xF0, 0x20, 0x2F, 0x47, 0xFF, 0x47, 0xCB, 0x01, 0xEA,
+  0x8F, 0x20, 0x3F, 0x23, 0xE7, 0x43, 0xF3, 0x01, 0xD4, 0x82, 0x20, 0x3F,
+  0x2C, 0x07, 0x00, 0xF1, 0x20, 0x0F, 0x4C, 0x07, 0x48, 0x0B, 0x40, 0x0B,
+  0x40, 0x03, 0xC0, 0x2F, 0x46, 0x2C, 0x00, 0xF0, 0x20, 0x1F, 0x00, 0xDE,
+  0x27, 0x7F, 0x47, 0xCB, 0x01, 0xEA, 0xEA, 0x20, 0x3F, 0x23, 0x87, 0x43,
+  0xF3, 0x01, 0xD4, 0xD4, 0x20, 0x3F, 0x00, 0xDD, 0x20, 0x3F, 0x20, 0x0F,
+  0x4C, 0x07, 0x48, 0x0B, 0x40, 0x0B, 0x40, 0x03, 0xC0, 0x2F, 0x20, 0x80,
+  0x03, 0xFF, 0xF0, 0xF0, 0x36, 0x67, 0xFF, 0x47, 0xCB, 0x00, 0x8F, 0x20,
+  0x3F, 0x43, 0xE7, 0x43, 0xF3, 0x00, 0x82, 0x20, 0x3F, 0x4C, 0x07, 0x40,
+  0x0F, 0x00, 0x7D, 0x2B, 0xC7, 0x48, 0x0B, 0x40, 0x0B, 0x40, 0x03, 0x48,
+  0x2F, 0x40, 0x2F, 0x48, 0x2B, 0x00, 0x93, 0x20, 0x3F, 0x47, 0xFF, 0x47,
+  0xCB, 0x00, 0x35, 0x20, 0x3F, 0x43, 0xE7, 0x43, 0xF3, 0x00, 0x30, 0x20,
+  0x3F, 0x4C, 0x07, 0x40, 0x0F, 0x00, 0x2E, 0x20, 0x3F, 0x48, 0x0B, 0x40,
+  0x0B, 0x40, 0x03, 0xC0, 0x2F, 0x68, 0x2B, 0x60, 0x3F, 0x00, 0x88, 0x20,
+  0x3F, 0x00, 0x81, 0x20, 0x3F, 0x00, 0x8F, 0x20, 0x1F, 0x84, 0x07, 0x02,
+  0x30, 0xD4, 0x82, 0x20, 0x3F, 0x00, 0x87, 0x60, 0x0F, 0x4C, 0x07, 0x48,
+  0x0B, 0x40, 0x1B, 0x40, 0x03, 0xC0, 0x2F, 0x68, 0x2B, 0x00, 0xF0, 0x40,
+  0x0F, 0x00, 0xDE, 0x20, 0x3F, 0x00, 0xD3, 0x20, 0x3F, 0x00, 0xEA, 0x20,
+  0x1F, 0x84, 0x07, 0x02, 0x30, 0xD4, 0xD4, 0x20, 0x3F, 0x00, 0xDD, 0x60,
+  0x0F, 0x00, 0x2E, 0x29, 0xC7, 0x02, 0x31, 0xD8, 0xD8, 0x60, 0x0B, 0x40,
+  0x1F, 0xC0, 0x2F, 0x26, 0xEA, 0x20, 0x3F, 0x01, 0xF0, 0xFF, 0x47, 0xFF,
+  0x00, 0x63, 0x2B, 0xFF, 0x02, 0x6E, 0xAC, 0xEA, 0x63, 0xE7, 0x47, 0xE3,
+  0x02, 0x63, 0x9C, 0xD4, 0x6C, 0x07, 0x43, 0xF7, 0x4C, 0x07, 0x00, 0x66,
+  0x28, 0x0B, 0x40, 0x0B, 0x40, 0x03, 0xC0, 0x2F, 0x48, 0x2B, 0x02, 0x71,
+  0xB0, 0xF0, 0x67, 0xFF, 0x47, 0xCB, 0x02, 0x7E, 0x7E, 0xEA, 0x63, 0xE7,
+  0x47, 0xE3, 0x02, 0x72, 0x72, 0xD4, 0x2A, 0x6F, 0x00, 0xDD, 0x60, 0x0F,
+  0x4C, 0x07, 0x48, 0x0B, 0x44, 0x03, 0x40, 0x03, 0x48, 0x2F, 0x40, 0x2F,
+  0x22, 0xAE, 0x20, 0x0F, 0x01, 0xF0, 0xFF, 0x47, 0xFF, 0x4B, 0xFF, 0x02,
+  0x8F, 0x35, 0xEA, 0x63, 0xE7, 0x44, 0x07, 0x02, 0x82, 0x30, 0xD4, 0x6C,
+  0x07, 0x43, 0xF7, 0x4C, 0x07, 0x48, 0x0B, 0x40, 0x0B, 0x40, 0x03, 0xC0,
+  0x2F, 0x2A, 0x2A, 0x20, 0x0F, 0x00, 0xF0, 0x67, 0xFF, 0x4B, 0xFF, 0x02,
+  0xB8, 0x4D, 0xEA, 0x63, 0xE7, 0x44, 0x07, 0x06, 0xA7, 0x46, 0xD4, 0xFF,
+  0xAD, 0x49, 0xDD, 0x60, 0x0F, 0x4C, 0x07, 0x48, 0x0B, 0x44, 0x03, 0x40,
+  0x03, 0x48, 0x2F, 0x40, 0x2F, 0x48, 0x2B, 0x02, 0xBD, 0x50, 0xF0, 0x22,
+  0x8F, 0x00, 0xDE, 0x22, 0xBF, 0x00, 0xD3, 0x22, 0xBF, 0x00, 0xEA, 0x22,
+  0x9F, 0x23, 0x07, 0x01, 0x30, 0xD7, 0x22, 0xBF, 0x00, 0xD4, 0x22, 0xBF,
+  0x00, 0xDD, 0x60, 0x0F, 0x4C, 0x07, 0x48, 0x0B, 0x40, 0x1B, 0x40, 0x03,
+  0xC0, 0x2F, 0x41, 0x40, 0x00, 0xF0, 0x20, 0x7F, 0x47, 0xFF, 0x47, 0xCB,
+  0x00, 0xEA, 0x2B, 0xF3, 0x43, 0xE7, 0x44, 0x07, 0x02, 0xD4, 0x30, 0x82,
+  0x20, 0x3F, 0x00, 0x87, 0x60, 0x0F, 0x00, 0xCD, 0x2C, 0x07, 0x48, 0x0B,
+  0x40, 0x1B, 0x40, 0x03, 0xC0, 0x2F, 0x48, 0x2B, 0x00, 0xF0, 0x24, 0x37,
+  0x02, 0x4C, 0x4C, 0x4C, 0x67, 0xCB, 0x4B, 0xF3, 0x43, 0xE7, 0x43, 0xF3,
+  0x02, 0x47, 0x47, 0x47, 0x60, 0x17, 0x40, 0x0F, 0x4C, 0x07, 0x48, 0x0B,
+  0x40, 0x0B, 0x40, 0x03, 0xC0, 0x2F, 0x06, 0x5E, 0x5E, 0x5E, 0xFF, 0x56,
+  0x56, 0x56, 0x67, 0xFF, 0x47, 0xCB, 0x02, 0x98, 0x98, 0x98, 0x63, 0xE7,
+  0x00, 0x8A, 0x21, 0x58, 0x55, 0xCB, 0x4C, 0x07, 0x44, 0x07, 0x4C, 0x07,
+  0x40, 0x13, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x17, 0x40, 0x2F, 0x48, 0x2B,
+  0x02, 0x9C, 0x9C, 0x9C, 0x23, 0x0F, 0x20, 0xFF, 0x22, 0x3F, 0x00, 0xEA,
+  0x22, 0x3F, 0x43, 0xE7, 0x43, 0xF3, 0x00, 0xD4, 0x22, 0x3F, 0x4C, 0x07,
+  0x40, 0x0F, 0x4C, 0x07, 0x48, 0x0B, 0x40, 0x0B, 0x40, 0x03, 0xC0, 0x2F,
+  0x40, 0x00, 0x00, 0xF0, 0x22, 0x3F, 0x47, 0xC3, 0x4B, 0xC7, 0x43, 0xE7,
+  0x43, 0xDB, 0x00, 0xEB, 0x24, 0x07, 0x44, 0x0B, 0x4F, 0xEF, 0x04, 0xB7,
+  0x29, 0x29, 0xFF, 0xD1, 0x2B, 0xE7, 0x4F, 0xEF, 0x00, 0xD0, 0x20, 0x07,
+  0x00, 0xC4, 0x2B, 0xF7, 0x40, 0x1F, 0x40, 0x03, 0x02, 0xC8, 0x2D, 0x2D,
+  0x60, 0x23, 0x47, 0xC3, 0x00, 0xDA, 0x2B, 0xC7, 0x43, 0xE7, 0x43, 0xDB,
+  0x00, 0xEB, 0x24, 0x07, 0x44, 0x0B, 0x00, 0xBD, 0x2F, 0xEF, 0x01, 0xB7,
+  0x6F, 0x20, 0x3F, 0x30, 0x03, 0x4F, 0xEF, 0x4B, 0xFF, 0x01, 0xC4, 0x78,
+  0x20, 0x3F, 0x20, 0x1F, 0x40, 0x03, 0x4F, 0xFF, 0x40, 0x23, 0x47, 0xC3,
+  0x4B, 0xC7, 0x43, 0xE7, 0x43, 0xDB, 0x4F, 0xFB, 0x44, 0x0B, 0x4F, 0xEF,
+  0x01, 0xB7, 0xB7, 0x20, 0x3F, 0x00, 0xD1, 0x20, 0x3F, 0x2F, 0x73, 0x00,
+  0xD0, 0x2B, 0xBF, 0x01, 0xC4, 0xC4, 0x20, 0x3F, 0x2F, 0x9B, 0x40, 0x03,
+  0x4F, 0xFF, 0x40, 0x23, 0x47, 0xC3, 0x4B, 0xC7, 0x00, 0x7D, 0x23, 0xA7,
+  0x43, 0xDB, 0x4F, 0xFB, 0x44, 0x0B, 0x4F, 0xEF, 0x00, 0x6F, 0x20, 0x3F,
+  0x00, 0x7F, 0x20, 0x3F, 0x4F, 0xEF, 0x4B, 0xFF, 0x00, 0x78, 0x20, 0x3F,
+  0x60, 0x1F, 0x20, 0x43, 0x4F, 0xFF, 0x40, 0x23, 0x47, 0xC3, 0x4B, 0xC7,
+  0x43, 0xE7, 0x43, 0xDB, 0x4F, 0xFB, 0x44, 0x0B, 0x4F, 0xEF, 0x00, 0x29,
+  0x20, 0x3F, 0x00, 0x2F, 0x20, 0x3F, 0x4F, 0xEF, 0x00, 0x2F, 0x20, 0x7F,
+  0x00, 0x2C, 0x20, 0x3F, 0x60, 0x1F, 0x20, 0x3F, 0x4F, 0xFF, 0x40, 0x23,
+  0x47, 0xC3, 0x4B, 0xC7, 0x43, 0xE7, 0x43, 0xDB, 0x4F, 0xFB, 0x02, 0x35,
+  0xEA, 0x8F, 0x20, 0x1B, 0x00, 0x73, 0x20, 0x3F, 0x00, 0x6F, 0x20, 0x3F,
+  0x00, 0x7F, 0x20, 0x3F, 0x00, 0x89, 0x20, 0x3F, 0x00, 0x7F, 0x20, 0x3F,
+  0x00, 0x78, 0x80, 0x1F, 0x30, 0x1F, 0x4F, 0xFF, 0x40, 0x23, 0x47, 0xC3,
+  0x4B, 0xC7, 0x43, 0xE7, 0x43, 0xDB, 0x02, 0x35, 0xEB, 0xEB, 0x20, 0x3F,
+  0x00, 0xEA, 0x20, 0x1B, 0x00, 0xBD, 0x20, 0x3F, 0x00, 0xB7, 0x20, 0x3F,
+  0x00, 0xD1, 0x20, 0x3F, 0x00, 0xE0, 0x20, 0x3F, 0x00, 0xD0, 0x20, 0x3F,
+  0x00, 0xC4, 0x80, 0x1F, 0x20, 0x23, 0x4F, 0xFF, 0x40, 0x23, 0x47, 0xC3,
+  0x03, 0x66, 0xA0, 0xDA, 0xFF, 0x43, 0xE7, 0x43, 0xDB, 0x4F, 0xFB, 0x44,
+  0x0B, 0x4F, 0xEF, 0x0A, 0x56, 0x87, 0xB7, 0xFF, 0x62, 0x9A, 0xD1, 0xFF,
+  0x69, 0xA5, 0xE0, 0x6B, 0xFF, 0x02, 0x5C, 0x90, 0xC4, 0x60, 0x1F, 0x40,
+  0x23, 0x4F, 0xFF, 0x40, 0x23, 0x47, 0xC3, 0x4B, 0xC7, 0x43, 0xE7, 0x43,
+  0xDB, 0x4F, 0xFB, 0x44, 0x0B, 0x4F, 0xEF, 0x06, 0x63, 0x63, 0xB7, 0xFF,
+  0x71, 0x71, 0xD1, 0x6F, 0xEF, 0x4B, 0xFF, 0x02, 0x6A, 0x6A, 0xC4, 0x60,
+  0x1F, 0x40, 0x23, 0x00, 0x6C, 0x30, 0x0B, 0x40, 0x23, 0x47, 0xC3, 0x00,
+  0x85, 0x2B, 0x47, 0x43, 0xE7, 0x43, 0xDB, 0x4F, 0xFB, 0x00, 0x8F, 0x23,
+  0x8B, 0x4F, 0xEF, 0x02, 0x6F, 0x29, 0xB7, 0x2B, 0xF7, 0x00, 0xD1, 0x6F,
+  0xEF, 0x06, 0x7F, 0x2F, 0xD0, 0xFF, 0x78, 0x2C, 0xC4, 0x20, 0x1B, 0x40,
+  0x1F, 0x00, 0xEB, 0x6F, 0xFF, 0x40, 0x23, 0x4B, 0xFB, 0x4B, 0xC7, 0x43,
+  0xE7, 0x43, 0xDB, 0x4F, 0xFB, 0x44, 0x0B, 0x4F, 0xEF, 0x07, 0x90, 0x3C,
+  0xB7, 0xFF, 0xA4, 0x45, 0xD1, 0xFF, 0x4F, 0xF3, 0x4B, 0xFF, 0x02, 0x9A,
+  0x41, 0xC4, 0x80, 0x1F, 0x30, 0x1F, 0x4F, 0xFF, 0x40, 0x23, 0x47, 0xC3,
+  0x00, 0xDA, 0x20, 0x7F, 0x43, 0xE7, 0x43, 0xDB, 0x4F, 0xFB, 0x44, 0x0B,
+  0x4F, 0xEF, 0x00, 0xB7, 0x20, 0x7F, 0x00, 0xD1, 0x20, 0x7F, 0x4F, 0xEF,
+  0x4B, 0xFF, 0x00, 0xC4, 0x20, 0x7F, 0x40, 0x1F, 0x40, 0x03, 0x4F, 0xFF,
+  0x40, 0x23, 0x47, 0xC3, 0x4B, 0xC7, 0x43, 0xE7, 0x43, 0xDB, 0x4F, 0xFB,
+  0x44, 0x0B, 0x00, 0xBD, 0x2F, 0xEF, 0x02, 0xB7, 0x29, 0x6F, 0x20, 0x3F,
+  0x00, 0x7F, 0x20, 0x3F, 0x00, 0x89, 0x20, 0x3F, 0x00, 0x7F, 0x20, 0x3F,
+  0x00, 0x78, 0x60, 0x1F, 0x40, 0x23, 0x4F, 0xFF, 0x40, 0x23, 0x47, 0xC3,
+  0x00, 0x4B, 0x27, 0xF7, 0x43, 0xE7, 0x43, 0xDB, 0x44, 0x07, 0x40, 0x03,
+  0x04, 0x3B, 0x3B, 0x3B, 0xFF, 0x38, 0x2B, 0x2B, 0x02, 0x46, 0x46, 0x46,
+  0x68, 0x0B, 0x4B, 0xFF, 0x00, 0x3F, 0x2B, 0xF7, 0x40, 0x1B, 0x40, 0x03,
+  0x50, 0x0B, 0x40, 0x23, 0x47, 0xC3, 0x03, 0x8C, 0x8C, 0x8C, 0xFF, 0x43,
+  0xE7, 0x43, 0xDB, 0x4F, 0xFB, 0x44, 0x0B, 0x00, 0x77, 0x2F, 0xEF, 0x02,
+  0x73, 0x73, 0x73, 0x29, 0x6F, 0x00, 0x86, 0x68, 0x0B, 0x4B, 0xFF, 0x00,
+  0x7C, 0x39, 0xC3, 0x40, 0x1F, 0x40, 0x03, 0x4F, 0xFF, 0x40, 0x23, 0x47,
+  0xC3, 0x4B, 0xC7, 0x43, 0xE7, 0x43, 0xDB, 0x4F, 0xFB, 0x44, 0x0B, 0x00,
+  0xBD, 0x22, 0x3F, 0x01, 0xB7, 0xB7, 0x20, 0xFF, 0x22, 0x3F, 0x4F, 0xEF,
+  0x00, 0xD0, 0x22, 0x3F, 0x00, 0xC4, 0x22, 0x3F, 0x40, 0x1F, 0x40, 0x03,
+  0x00, 0xC8, 0x30, 0x0B, 0x40, 0x23, 0x4F, 0xCB, 0x00, 0xBB, 0x33, 0xDB,
+  0x00, 0xCE, 0x33, 0xEF, 0x47, 0xDF, 0x44, 0x07, 0x43, 0xF7, 0xD4, 0x17,
+  0xC0, 0x0F, 0x00, 0xD3, 0x23, 0xFF, 0x48, 0x1B, 0x00, 0xC0, 0xB0, 0x0B,
+  0x50, 0x17, 0x00, 0xD5, 0x28, 0x27, 0x4F, 0xCB, 0x01, 0xBB, 0x72, 0x20,
+  0x3F, 0x00, 0x7E, 0x20, 0x3F, 0x27, 0xCF, 0x44, 0x07, 0x43, 0xF7, 0xD4,
+  0x17, 0xC0, 0x0F, 0x48, 0x23, 0x00, 0xD7, 0x2C, 0x0F, 0x01, 0xC0, 0x75,
+  0x2F, 0xCB, 0x24, 0x13, 0x50, 0x17, 0x00, 0xD5, 0x28, 0x27, 0x4F, 0xCB,
+  0x01, 0xBB, 0xBB, 0x20, 0x3F, 0x00, 0xCE, 0x20, 0x3F, 0xA7, 0xEF, 0x43,
+  0xF7, 0xD4, 0x17, 0x44, 0x17, 0x40, 0x0F, 0x48, 0x23, 0x48, 0x1B, 0x01,
+  0xC0, 0xC0, 0x20, 0x3F, 0x23, 0x8B, 0x50, 0x17, 0x02, 0xD5, 0xD5, 0x30,
+  0x6F, 0xCB, 0x00, 0x72, 0x20, 0x3F, 0x00, 0x7E, 0x20, 0x3F, 0x47, 0xDF,
+  0x44, 0x07, 0x43, 0xF7, 0xD4, 0x17, 0xC0, 0x0F, 0x47, 0xF3, 0x48, 0x1B,
+  0x00, 0x75, 0x20, 0x3F, 0x44, 0x0B, 0x50, 0x17, 0x00, 0x82, 0x20, 0x3F,
+  0x4F, 0xCB, 0x00, 0x2A, 0x20, 0x3F, 0x00, 0x2E, 0x20, 0x3F, 0x47, 0xDF,
+  0x44, 0x07, 0x00, 0x29, 0x23, 0xF7, 0x01, 0x2E, 0xCB, 0x33, 0xFF, 0x30,
+  0x63, 0xC0, 0x0F, 0x40, 0x0B, 0x48, 0x1B, 0x00, 0x2B, 0x20, 0x3F, 0x44,
+  0x0B, 0x00, 0x2D, 0x30, 0x97, 0x00, 0x30, 0x60, 0x3F, 0x00, 0x77, 0x20,
+  0x3F, 0x00, 0x72, 0x20, 0x3F, 0x00, 0x7E, 0x20, 0x3F, 0x00, 0x93, 0x20,
+  0x2F, 0x00, 0x7D, 0x20, 0x3F, 0x00, 0x6F, 0x20, 0x3F, 0x94, 0x17, 0xC0,
+  0x0F, 0x48, 0x23, 0x4C, 0x23, 0x02, 0x2B, 0xC0, 0x75, 0x20, 0x3F, 0x00,
+  0x7F, 0x20, 0x3F, 0x00, 0x7B, 0x20, 0x3F, 0x00, 0x82, 0x20, 0x7F, 0x00,
+  0xC3, 0x20, 0x3F, 0x00, 0xBB, 0x20, 0x3F, 0x00, 0xCE, 0x20, 0x3F, 0x00,
+  0xF1, 0x20, 0x2F, 0x00, 0xCD, 0x20, 0x3F, 0x00, 0xB7, 0x20, 0x3F, 0x00,
+  0xCB, 0x20, 0x33, 0x00, 0xD3, 0xE0, 0x00, 0x0F, 0x40, 0x0B, 0x4C, 0x23,
+  0x02, 0x2B, 0xC0, 0xC0, 0x20, 0x3F, 0x00, 0xD0, 0x20, 0x3F, 0x00, 0xCA,
+  0x20, 0x3F, 0x00, 0xD5, 0x6F, 0xCB, 0x07, 0x58, 0x89, 0xBB, 0xFF, 0x61,
+  0x97, 0xCE, 0xFF, 0x47, 0xDF, 0x44, 0x07, 0x00, 0x56, 0x23, 0xF7, 0xD4,
+  0x17, 0xC0, 0x0F, 0x00, 0x63, 0x28, 0x23, 0x48, 0x1B, 0x02, 0x5A, 0x8D,
+  0xC0, 0x64, 0x0B, 0x54, 0x2B, 0x02, 0x64, 0x9C, 0xD5, 0x23, 0xD3, 0x04,
+  0xC3, 0xFF, 0x65, 0x65, 0xBB, 0x23, 0xFF, 0x00, 0xCE, 0x22, 0x83, 0x87,
+  0xEF, 0x43, 0xF7, 0xD4, 0x17, 0x44, 0x17, 0x40, 0x0F, 0x47, 0xF3, 0x48,
+  0x1B, 0x02, 0x67, 0x67, 0xC0, 0x64, 0x0B, 0x54, 0x2B, 0x02, 0x73, 0x73,
+  0xD5, 0x6F, 0xCB, 0x07, 0x72, 0x2A, 0xBB, 0xFF, 0x7E, 0x2E, 0xCE, 0xFF,
+  0x47, 0xDF, 0x44, 0x07, 0x43, 0xF7, 0xD4, 0x17, 0xC0, 0x0F, 0x48, 0x23,
+  0x48, 0x1B, 0x02, 0x75, 0x2B, 0xC0, 0x64, 0x0B, 0x54, 0x2B, 0x02, 0x82,
+  0x30, 0xD5, 0x6F, 0xCB, 0x02, 0x93, 0x3E, 0xBB, 0x23, 0xFF, 0x01, 0xCE,
+  0xFF, 0x47, 0xDF, 0x44, 0x07, 0x43, 0xF7, 0xD4, 0x17, 0xC0, 0x0F, 0x00,
+  0xA6, 0x34, 0x23, 0x48, 0x1B, 0x02, 0x97, 0x3F, 0xC0, 0x64, 0x0B, 0x06,
+  0x9F, 0x43, 0xCA, 0xFF, 0xA8, 0x46, 0xD5, 0x22, 0xBF, 0x00, 0xC3, 0x22,
+  0xBF, 0x00, 0xBB, 0x22, 0xBF, 0x00, 0xCE, 0x22, 0xBF, 0x26, 0xEF, 0x33,
+  0xF7, 0x43, 0xF7, 0xD4, 0x17, 0xC0, 0x0F, 0x48, 0x23, 0x48, 0x1B, 0x00,
+  0xC0, 0x20, 0x7F, 0x44, 0x0B, 0x00, 0xCA, 0x30, 0x17, 0x00, 0xD5, 0x20,
+  0x7F, 0x02, 0xC3, 0x2C, 0x77, 0x20, 0x3F, 0x00, 0x72, 0x20, 0x3F, 0x00,
+  0x7E, 0x20, 0x3F, 0x87, 0xEF, 0x43, 0xF7, 0xD4, 0x17, 0x00, 0xCD, 0x27,
+  0xFF, 0x40, 0x0F, 0x48, 0x23, 0x48, 0x1B, 0x02, 0xC0, 0x2B, 0x75, 0x20,
+  0x3F, 0x00, 0x7F, 0x20, 0x3F, 0x00, 0x7B, 0x20, 0x3F, 0x00, 0x82, 0x63,
+  0xD3, 0x00, 0x3A, 0x33, 0x37, 0x43, 0xFF, 0x47, 0xDF, 0x40, 0x07, 0x43,
+  0xF7, 0xD4, 0x17, 0xC0, 0x0F, 0x48, 0x13, 0x48, 0x1B, 0xD0, 0x0B, 0x50,
+  0x17, 0x02, 0x48, 0x48, 0x48, 0x25, 0x7F, 0x04, 0x7B, 0xFF, 0x75, 0x75,
+  0x75, 0x7D, 0xB7, 0x47, 0xDF, 0x44, 0x07, 0x43, 0xF7, 0xD4, 0x17, 0xC0,
+  0x0F, 0x47, 0xF3, 0x00, 0x8A, 0x28, 0x1B, 0x02, 0x79, 0x79, 0x79, 0x64,
+  0x0B, 0x50, 0x17, 0x48, 0x27, 0x4F, 0xCB, 0x00, 0xBB, 0x22, 0x3F, 0x00,
+  0xCE, 0x22, 0x3F, 0x47, 0xDF, 0x44, 0x07, 0x43, 0xF7, 0xD4, 0x17, 0xC0,
+  0x0F, 0x48, 0x23, 0x48, 0x1B, 0x00, 0xC0, 0x22, 0x3F, 0x44, 0x0B, 0x50,
+  0x17, 0x00, 0xD5, 0x22, 0x3F, 0x4F, 0xCB, 0x00, 0xFE, 0x2F, 0xCF, 0x00,
+  0xED, 0xA7, 0xF7, 0x4B, 0xF7, 0x40, 0x03, 0x48, 0x13, 0x47, 0xF7, 0x50,
+  0x1F, 0x40, 0x1F, 0x58, 0x07, 0x4C, 0x07, 0x20, 0xEC, 0x60, 0x03, 0x4F,
+  0xFF, 0x50, 0x23, 0x4F, 0xCB, 0x01, 0xFE, 0x9B, 0x20, 0x3F, 0x00, 0x91,
+  0x27, 0xB7, 0x00, 0x8F, 0x20, 0x3F, 0x2B, 0xF7, 0x40, 0x03, 0x48, 0x13,
+  0x47, 0xF7, 0x50, 0x1F, 0x40, 0x1F, 0x00, 0xE5, 0x38, 0x07, 0x4C, 0x07,
+  0x00, 0xFF, 0x49, 0xF8, 0x20, 0x03, 0x4F, 0xFF, 0x50, 0x23, 0x4F, 0xCB,
+  0x01, 0xFE, 0xFE, 0x20, 0x3F, 0x00, 0xED, 0x20, 0x3F, 0x2B, 0x83, 0x4B,
+  0xF7, 0x40, 0x03, 0x48, 0x13, 0x47, 0xF7, 0x50, 0x1F, 0x40, 0x1F, 0x00,
+  0xE5, 0x37, 0x87, 0x01, 0xD8, 0xD8, 0x20, 0x3F, 0x00, 0xFF, 0x20, 0x7F,
+  0x20, 0x03, 0x4F, 0xFF, 0x50, 0x23, 0x4F, 0xCB, 0x00, 0x9B, 0x20, 0x3F,
+  0x00, 0x91, 0x20, 0x3F, 0x47, 0xF7, 0x4B, 0xF7, 0x40, 0x03, 0x48, 0x13,
+  0x47, 0xF7, 0x50, 0x1F, 0x40, 0x1F, 0x58, 0x07, 0x4C, 0x07, 0x4B, 0xF7,
+  0x40, 0x03, 0x4F, 0xFF, 0x50, 0x23, 0x4F, 0xCB, 0x00, 0x39, 0x20, 0x3F,
+  0x00, 0x35, 0x20, 0x3F, 0x47, 0xF7, 0x4B, 0xF7, 0x40, 0x03, 0x48, 0x13,
+  0x47, 0xF7, 0x00, 0x36, 0x34, 0x0F, 0x40, 0x1F, 0x00, 0x34, 0x20, 0x7F,
+  0x4C, 0x07, 0x4B, 0xF7, 0x40, 0x01, 0x6F, 0xFF, 0x30, 0x23, 0x02, 0x39,
+  0xFD, 0x9A, 0x20, 0x1F, 0x00, 0x9B, 0x20, 0x3F, 0x00, 0x91, 0x20, 0x3F,
+  0x00, 0x8F, 0x20, 0x3B, 0x00, 0x87, 0x60, 0x03, 0x48, 0x13, 0x47, 0xF7,
+  0x00, 0x36, 0x30, 0x1F, 0x40, 0x1F, 0x58, 0x07, 0x4C, 0x07, 0x80, 0x7D,
+  0x00, 0x9C, 0x20, 0x3F, 0x2F, 0xFF, 0x30, 0x23, 0x4F, 0xCB, 0x02, 0x39,
+  0xFE, 0xFE, 0x20, 0x3F, 0x00, 0xED, 0x20, 0x3F, 0x00, 0xEA, 0x20, 0x3B,
+  0x00, 0xDD, 0x60, 0x03, 0x48, 0x13, 0x47, 0xF7, 0x50, 0x1F, 0x40, 0x1F,
+  0x00, 0x34, 0x35, 0xC7, 0x02, 0x31, 0xD8, 0xD8, 0x20, 0x3F, 0x40, 0xFD,
+  0x00, 0xFF, 0x20, 0x3F, 0x2F, 0xFF, 0x2D, 0xE3, 0x4F, 0xCB, 0x06, 0x78,
+  0xBA, 0xFE, 0xFF, 0x6F, 0xAE, 0xED, 0x67, 0xF7, 0x00, 0x68, 0x37, 0xFF,
+  0x40, 0x03, 0x48, 0x13, 0x47, 0xF7, 0x50, 0x1F, 0x40, 0x1F, 0x58, 0x07,
+  0x00, 0x66, 0x2C, 0x07, 0x02, 0x78, 0xBB, 0xFF, 0x60, 0x03, 0x50, 0x17,
+  0x00, 0x6A, 0x30, 0x23, 0x4F, 0xCB, 0x02, 0x8A, 0x8A, 0xFE, 0x22, 0x4F,
+  0x00, 0xED, 0x67, 0xF7, 0x4B, 0xF7, 0x40, 0x03, 0x48, 0x13, 0x57, 0xEB,
+  0x50, 0x1F, 0x40, 0x1F, 0x58, 0x07, 0x4C, 0x07, 0x22, 0x82, 0x60, 0x03,
+  0x50, 0x17, 0x50, 0x23, 0x4F, 0xCB, 0x06, 0x9B, 0x39, 0xFE, 0xFF, 0x91,
+  0x35, 0xED, 0x27, 0xDB, 0x00, 0xEA, 0x6B, 0xF7, 0x58, 0x03, 0x48, 0x13,
+  0x00, 0x89, 0x37, 0x6B, 0x00, 0x92, 0x33, 0x8F, 0x40, 0x1F, 0x58, 0x07,
+  0x4C, 0x07, 0x21, 0xFA, 0x60, 0x03, 0x50, 0x17, 0x50, 0x23, 0x4F, 0xCB,
+  0x06, 0xC7, 0x54, 0xFE, 0xFF, 0xBA, 0x4F, 0xED, 0x67, 0xF7, 0x00, 0xAD,
+  0x2B, 0xF7, 0x40, 0x03, 0x48, 0x13, 0x00, 0xB0, 0x37, 0xEB, 0x50, 0x1F,
+  0x40, 0x1F, 0x58, 0x07, 0x4C, 0x07, 0x4B, 0xF7, 0x40, 0x03, 0x4F, 0xFF,
+  0x50, 0x23, 0x4F, 0xCB, 0x00, 0xFE, 0x20, 0x7F, 0x00, 0xED, 0x20, 0x7F,
+  0x47, 0xF7, 0x4B, 0xF7, 0x40, 0x03, 0x48, 0x13, 0x47, 0xF7, 0x50, 0x1F,
+  0x40, 0x1F, 0x58, 0x07, 0x4C, 0x07, 0xC1, 0x40, 0x4F, 0xFF, 0x01, 0xE1,
+  0x33, 0x40, 0x3F, 0x00, 0x9A, 0x20, 0x1F, 0x00, 0x9B, 0x20, 0x3F, 0x00,
+  0x91, 0x20, 0x3F, 0x00, 0x8F, 0x20, 0x3B, 0x00, 0x87, 0x60, 0x03, 0x00,
+  0xDA, 0x33, 0xDB, 0x47, 0xF7, 0x50, 0x1F, 0x40, 0x1F, 0x58, 0x07, 0x4C,
+  0x07, 0x4B, 0xF7, 0x40, 0x03, 0x50, 0x17, 0x00, 0xE1, 0x30, 0x23, 0x00,
+  0x5D, 0x2F, 0xCB, 0x4B, 0xCB, 0x02, 0x54, 0x54, 0x54, 0x67, 0xD7, 0x48,
+  0x03, 0x40, 0x03, 0x48, 0x13, 0x50, 0x03, 0x50, 0x1F, 0x40, 0x1F, 0x48,
+  0x27, 0x4C, 0x07, 0x40, 0x0B, 0x40, 0x03, 0x50, 0x0B, 0x40, 0x1F, 0x02,
+  0xA6, 0xA6, 0xA6, 0x60, 0x03, 0x5D, 0x97, 0x47, 0xF7, 0x48, 0x03, 0x40,
+  0x03, 0x00, 0x8C, 0x28, 0x13, 0x02, 0x91, 0x91, 0x91, 0x70, 0x1F, 0x40,
+  0x23, 0x00, 0x94, 0x38, 0x07, 0x43, 0xFF, 0x4B, 0xF7, 0x40, 0x03, 0x4F,
+  0xFF, 0x40, 0x1F, 0x4F, 0xCB, 0x00, 0xFE, 0x22, 0x3F, 0x00, 0xED, 0x22,
+  0x3F, 0x47, 0xF7, 0x4B, 0xF7, 0x40, 0x03, 0x48, 0x13, 0x47, 0xF7, 0x50,
+  0x1F, 0x40, 0x1F, 0x58, 0x07, 0x4C, 0x07, 0xC0, 0x00, 0x4F, 0xFF, 0x50,
+  0x23, 0x47, 0xD7, 0x40, 0x03, 0x44, 0x07, 0x43, 0xDB, 0x43, 0xD7, 0x00,
+  0xE5, 0x33, 0xEB, 0x48, 0x0B, 0x4F, 0xDF, 0x47, 0xE7, 0x00, 0xD0, 0x27,
+  0xFB, 0x4C, 0x13, 0x40, 0x13, 0x40, 0x1B, 0x4C, 0x33, 0x02, 0xF2, 0x37,
+  0x37, 0x60, 0x1F, 0x47, 0xD7, 0x40, 0x03, 0x44, 0x07, 0x41, 0xD8, 0x43,
+  0xD7, 0x43, 0xEB, 0x00, 0xF1, 0x28, 0x0B, 0x4F, 0xDF, 0x47, 0xE7, 0x00,
+  0xD0, 0x27, 0xEF, 0x44, 0x1B, 0x40, 0x13, 0x40, 0x1B, 0x4C, 0x33, 0x01,
+  0xF2, 0x94, 0x20, 0x3F, 0x20, 0x23, 0x47, 0xD7, 0x40, 0x03, 0x44, 0x07,
+  0x20, 0x80, 0x20, 0x97, 0x20, 0x3F, 0x23, 0x6B, 0x00, 0xF1, 0x28, 0x0B,
+  0x4F, 0xDF, 0x00, 0xCA, 0x27, 0x67, 0x47, 0xEF, 0x44, 0x1B, 0x40, 0x13,
+  0x40, 0x1B, 0x4C, 0x33, 0x01, 0xF2, 0xF2, 0x20, 0x3F, 0x2F, 0x7F, 0x47,
+  0xD7, 0x40, 0x03, 0x44, 0x07, 0xC3, 0xD7, 0x43, 0xEB, 0x00, 0x93, 0x20,
+  0x3F, 0x4F, 0xDF, 0x47, 0xE7, 0x01, 0x7F, 0xD0, 0xF0, 0x01, 0x1F, 0x40,
+  0x1B, 0x4C, 0x33, 0x00, 0x94, 0x20, 0x3F, 0x40, 0x1F, 0x47, 0xD7, 0x40,
+  0x03, 0x44, 0x07, 0xC3, 0xD7, 0x43, 0xEB, 0x48, 0x0B, 0x4F, 0xDF, 0x00,
+  0x2D, 0x20, 0x7F, 0x47, 0xEF, 0x44, 0x1B, 0x40, 0x13, 0x40, 0x1B, 0x4C,
+  0x33, 0x00, 0x37, 0x20, 0x3F, 0x40, 0x1F, 0x47, 0xD7, 0x40, 0x03, 0x44,
+  0x07, 0xC3, 0xD7, 0x43, 0xEB, 0x48, 0x0B, 0x4F, 0xDF, 0x47, 0xE7, 0x00,
+  0x2F, 0x27, 0xEF, 0x44, 0x1B, 0x40, 0x13, 0x40, 0x1B, 0x4C, 0x33, 0x02,
+  0x37, 0xF2, 0x94, 0x60, 0x1F, 0x47, 0xD7, 0x40, 0x03, 0x44, 0x07, 0x23,
+  0x1A, 0x63, 0xD7, 0x00, 0x34, 0x23, 0xEB, 0x48, 0x0B, 0x4F, 0xDF, 0x47,
+  0xE7, 0x47, 0xEF, 0x44, 0x1B, 0x40, 0x13, 0x40, 0x1B, 0x4C, 0x33, 0x02,
+  0x37, 0xF2, 0xF2, 0x60, 0x1F, 0x00, 0x63, 0x27, 0xD7, 0x40, 0x03, 0x64,
+  0x07, 0x23, 0xDB, 0x43, 0xD7, 0x43, 0xEB, 0x48, 0x0B, 0x00, 0x71, 0x2F,
+  0xDF, 0x47, 0xE7, 0x57, 0xFB, 0x4C, 0x13, 0x40, 0x13, 0x40, 0x1B, 0x00,
+  0x6B, 0x38, 0x2F, 0x02, 0x72, 0xB1, 0xF2, 0x60, 0x1F, 0x47, 0xD7, 0x40,
+  0x03, 0x84, 0x07, 0x83, 0xD7, 0x43, 0xEB, 0x48, 0x0B, 0x4F, 0xDF, 0x47,
+  0xE7, 0x4B, 0xFB, 0x4C, 0x13, 0x40, 0x13, 0x40, 0x1B, 0x4C, 0x33, 0x02,
+  0x83, 0x83, 0xF2, 0x20, 0x0F, 0x00, 0xF0, 0x67, 0xD7, 0x02, 0x81, 0x2F,
+  0xD3, 0x64, 0x07, 0x43, 0xDB, 0x43, 0xD7, 0x43, 0xEB, 0x48, 0x0B, 0x4F,
+  0xDF, 0x00, 0x7B, 0x27, 0x67, 0x4B, 0xFB, 0x44, 0x1B, 0x40, 0x13, 0x40,
+  0x1B, 0x4C, 0x33, 0x02, 0x94, 0x37, 0xF2, 0x20, 0x0F, 0x00, 0xF0, 0x67,
+  0xD7, 0x47, 0xDB, 0x44, 0x07, 0xC3, 0xD7, 0x43, 0xEB, 0x48, 0x0B, 0x4F,
+  0xDF, 0x47, 0xE7, 0x4B, 0xFB, 0x4C, 0x13, 0x40, 0x13, 0x40, 0x1B, 0x4C,
+  0x33, 0x02, 0xBF, 0x50, 0xF2, 0x60, 0x1F, 0x47, 0xD7, 0x40, 0x03, 0x44,
+  0x07, 0x41, 0x40, 0x43, 0xD7, 0x43, 0xEB, 0x48, 0x0B, 0x4F, 0xDF, 0x47,
+  0xE7, 0x47, 0xEF, 0x44, 0x1B, 0x40, 0x13, 0x40, 0x1B, 0x4C, 0x33, 0x00,
+  0xF2, 0x20, 0x7F, 0x40, 0x1F, 0x47, 0xD7, 0x40, 0x03, 0x44, 0x07, 0xC3,
+  0xD7, 0x43, 0xEB, 0x48, 0x0B, 0x4F, 0xDF, 0x00, 0xCA, 0x27, 0xE7, 0x47,
+  0xEF, 0x44, 0x1B, 0x40, 0x13, 0x40, 0x1B, 0x4C, 0x33, 0x02, 0xF2, 0x37,
+  0x94, 0x60, 0x1F, 0x47, 0xD7, 0x40, 0x03, 0xC4, 0x07, 0x43, 0xD7, 0x43,
+  0xEB, 0x48, 0x0B, 0x4F, 0xDF, 0x47, 0xE7, 0x4B, 0xFB, 0x4B, 0xF3, 0x40,
+  0x13, 0x40, 0x1B, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x1F, 0x47, 0xD7, 0x40,
+  0x03, 0x43, 0xE3, 0xC3, 0xD7, 0x00, 0x94, 0x23, 0xEB, 0x48, 0x0B, 0x4F,
+  0xDF, 0x47, 0xE7, 0x4B, 0xFB, 0x44, 0x1B, 0x40, 0x13, 0x40, 0x1B, 0x4C,
+  0x33, 0x40, 0x0B, 0x40, 0x1F, 0x47, 0xD7, 0x40, 0x03, 0x44, 0x07, 0x40,
+  0x00, 0x43, 0xD7, 0x43, 0xEB, 0x48, 0x0B, 0x4F, 0xDF, 0x47, 0xE7, 0x00,
+  0xD0, 0x2A, 0x2F, 0x44, 0x1B, 0x40, 0x13, 0x40, 0x1B, 0x4C, 0x33, 0x00,
+  0xF2, 0x22, 0x3F, 0x40, 0x1F, 0x43, 0xEF, 0x57, 0xD7, 0x4C, 0x07, 0x4F,
+  0xEB, 0x43, 0xF3, 0x43, 0xE3, 0x4B, 0xF7, 0x54, 0x07, 0x40, 0x13, 0x4B,
+  0xF7, 0x00, 0xD0, 0x24, 0x03, 0x00, 0xC0, 0x2B, 0xFB, 0x48, 0x1B, 0x48,
+  0x07, 0x02, 0xC6, 0x2D, 0x2D, 0x2D, 0x0F, 0x00, 0x2C, 0x63, 0xEF, 0x57,
+  0xD7, 0x4C, 0x07, 0x4F, 0xEB, 0x43, 0xD3, 0x43, 0xE3, 0x4B, 0xF7, 0x54,
+  0x07, 0x40, 0x13, 0x00, 0xD7, 0x2B, 0xF7, 0x44, 0x03, 0x4B, 0xFB, 0x48,
+  0x1B, 0x48, 0x07, 0x01, 0xC6, 0x79, 0x20, 0x3F, 0x30, 0x0F, 0x43, 0xEF,
+  0x01, 0xE7, 0xE7, 0x20, 0x3F, 0x3B, 0x53, 0x4F, 0xEB, 0x43, 0xD3, 0x00,
+  0xE5, 0x23, 0xFF, 0x4B, 0xF7, 0x54, 0x07, 0x40, 0x13, 0x4B, 0xF7, 0x44,
+  0x03, 0x4B, 0xFB, 0x48, 0x1B, 0x48, 0x07, 0x00, 0xC6, 0x3F, 0xAF, 0x50,
+  0x0F, 0x47, 0xC7, 0x57, 0xD7, 0x00, 0x77, 0x20, 0x3F, 0x4F, 0xEB, 0x43,
+  0xD3, 0x43, 0xE3, 0x00, 0x7D, 0x30, 0x0F, 0x54, 0x07, 0x40, 0x13, 0x4B,
+  0xF7, 0x00, 0x7F, 0x24, 0x03, 0x00, 0x75, 0x2B, 0xBB, 0x48, 0x1B, 0x48,
+  0x07, 0x00, 0x79, 0x20, 0x3F, 0x50, 0x0F, 0x47, 0xC7, 0x57, 0xD7, 0x4C,
+  0x07, 0x4F, 0xEB, 0x43, 0xD3, 0x43, 0xE3, 0x4B, 0xF7, 0x00, 0x30, 0x34,
+  0x07, 0x40, 0x13, 0x00, 0x30, 0x38, 0x87, 0x44, 0x03, 0x4B, 0xFB, 0x68,
+  0x1B, 0x28, 0x87, 0x00, 0x2D, 0x20, 0x3F, 0x50, 0x0F, 0x47, 0xC7, 0x57,
+  0xDB, 0x00, 0x2C, 0x2C, 0x07, 0x4F, 0xEB, 0x43, 0xF3, 0x43, 0xE3, 0x4B,
+  0xF7, 0x54, 0x07, 0x40, 0x13, 0x4B, 0xF7, 0x00, 0x2F, 0x24, 0x03, 0x00,
+  0x2B, 0x2B, 0xFB, 0x48, 0x1F, 0x48, 0x07, 0x02, 0x2D, 0xC6, 0x79, 0x20,
+  0x3F, 0x00, 0x78, 0x20, 0x3F, 0x23, 0xEF, 0x35, 0x9B, 0x00, 0x2C, 0x2C,
+  0x07, 0x4F, 0xEB, 0x43, 0xF3, 0x43, 0xE3, 0x4C, 0x07, 0x54, 0x07, 0x40,
+  0x13, 0x4B, 0xF7, 0x44, 0x03, 0x4B, 0xFB, 0x48, 0x1F, 0x02, 0x31, 0xD8,
+  0xD8, 0x20, 0x3F, 0x00, 0xC6, 0x20, 0x3F, 0x00, 0xC4, 0x83, 0xEF, 0x01,
+  0xA9, 0xE7, 0x6C, 0x07, 0x00, 0x62, 0x2F, 0xEB, 0x43, 0xF3, 0x43, 0xE3,
+  0x4B, 0xF7, 0x00, 0x63, 0x34, 0x07, 0x40, 0x13, 0x4B, 0xF7, 0x44, 0x03,
+  0x4B, 0xFB, 0x68, 0x1B, 0x28, 0x07, 0x03, 0x5D, 0x91, 0xC6, 0xFF, 0x50,
+  0x0F, 0x47, 0xC7, 0x57, 0xDB, 0x4C, 0x07, 0x4F, 0xEB, 0x43, 0xD3, 0x43,
+  0xE3, 0x4B, 0xF7, 0x54, 0x07, 0x40, 0x13, 0x4B, 0xF7, 0x44, 0x03, 0x4B,
+  0xFB, 0x48, 0x1B, 0x48, 0x07, 0x02, 0x6B, 0x6B, 0xC6, 0x20, 0x33, 0x00,
+  0xC4, 0x63, 0xEF, 0x00, 0x8D, 0x37, 0x5B, 0x5B, 0xD3, 0x4F, 0xEB, 0x43,
+  0xD3, 0x43, 0xE3, 0x4B, 0xF7, 0x54, 0x07, 0x40, 0x13, 0x4B, 0xF7, 0x44,
+  0x03, 0x4B, 0xFB, 0x48, 0x1B, 0x48, 0x07, 0x00, 0x79, 0x3F, 0xAF, 0x50,
+  0x0F, 0x47, 0xC7, 0x57, 0xDB, 0x5B, 0xD3, 0x00, 0xA4, 0x2F, 0xEB, 0x43,
+  0xF3, 0x43, 0xE3, 0x4B, 0xF7, 0x54, 0x07, 0x40, 0x13, 0x4B, 0xF7, 0x44,
+  0x03, 0x4B, 0xFB, 0x00, 0xAD, 0x28, 0x1F, 0x48, 0x07, 0x02, 0x9C, 0x41,
+  0xC6, 0x70, 0x0F, 0x43, 0xEF, 0x57, 0xD7, 0x4C, 0x07, 0x4F, 0xEB, 0x43,
+  0xD3, 0x43, 0xE3, 0x4B, 0xF7, 0x54, 0x07, 0x40, 0x13, 0x4B, 0xF7, 0x44,
+  0x03, 0x4B, 0xFB, 0x48, 0x1B, 0x48, 0x07, 0x00, 0xC6, 0x20, 0x7F, 0x50,
+  0x0F, 0x47, 0xC7, 0x57, 0xDB, 0x4C, 0x07, 0x4F, 0xEB, 0x43, 0xF3, 0x43,
+  0xE3, 0x00, 0xCD, 0x2B, 0xF7, 0x54, 0x07, 0x40, 0x13, 0x00, 0xD7, 0x38,
+  0x1B, 0x44, 0x03, 0x4B, 0xFB, 0x48, 0x1F, 0x48, 0x07, 0x02, 0xC6, 0x2D,
+  0x79, 0x20, 0x3F, 0x01, 0x78, 0xFF, 0x43, 0xEF, 0x40, 0x03, 0x00, 0x3F,
+  0x2F, 0xDB, 0x4F, 0xEB, 0x43, 0xD3, 0x43, 0xDF, 0x4B, 0xF7, 0x44, 0x17,
+  0x40, 0x13, 0x4B, 0xF7, 0x44, 0x03, 0x4B, 0xFB, 0x48, 0x1B, 0x48, 0x07,
+  0x02, 0x40, 0x40, 0x40, 0x60, 0x33, 0x47, 0xC7, 0x57, 0xDB, 0x4C, 0x07,
+  0x00, 0x86, 0x2F, 0xEB, 0x43, 0xD3, 0x00, 0x94, 0x23, 0xFF, 0x4B, 0xF7,
+  0x4B, 0xDF, 0x40, 0x13, 0x00, 0x8A, 0x25, 0x98, 0x44, 0x03, 0x4B, 0xFB,
+  0x48, 0x1B, 0x40, 0x0F, 0x03, 0x7D, 0x7D, 0x7D, 0xFF, 0x50, 0x0F, 0x43,
+  0xEF, 0x57, 0xD7, 0x4C, 0x07, 0x4F, 0xEB, 0x43, 0xD3, 0x43, 0xE3, 0x4B,
+  0xF7, 0x54, 0x07, 0x40, 0x13, 0x4B, 0xF7, 0x44, 0x03, 0x4B, 0xFB, 0x48,
+  0x1B, 0x48, 0x07, 0x00, 0xC6, 0x22, 0x3F, 0x02, 0xC4, 0xC4, 0xC4, 0x20,
+  0xDF, 0x00, 0x2F, 0x20, 0xCF, 0x00, 0x31, 0x2C, 0xCB, 0x00, 0x30, 0x28,
+  0xEB, 0x04, 0x36, 0xFF, 0xB8, 0x29, 0x29, 0x30, 0xD7, 0x00, 0x2A, 0x60,
+  0x13, 0x00, 0xE3, 0x3C, 0x03, 0x44, 0x07, 0x47, 0xEF, 0x48, 0x1B, 0x40,
+  0x03, 0x5C, 0x23, 0x44, 0x2F, 0x40, 0x0B, 0x00, 0xFB, 0x2C, 0x37, 0x43,
+  0xDF, 0x43, 0xCF, 0x4F, 0xCB, 0x4B, 0xEB, 0x01, 0xB8, 0x70, 0x20, 0x3F,
+  0x33, 0xFB, 0x40, 0x13, 0x01, 0xE3, 0x8A, 0x20, 0x3F, 0x00, 0x7D, 0x20,
+  0x3F, 0x00, 0x8B, 0x20, 0x3F, 0x46, 0x1C, 0x20, 0x03, 0x5C, 0x23, 0x44,
+  0x2F, 0x40, 0x0B, 0x01, 0xFB, 0x99, 0x20, 0x3F, 0x00, 0xD1, 0x20, 0x3F,
+  0x23, 0x4F, 0x4F, 0xCB, 0x4B, 0xEB, 0x01, 0xB8, 0xB8, 0x20, 0x3F, 0x00,
+  0xBD, 0x20, 0x3F, 0x20, 0x13, 0x01, 0xE3, 0xE3, 0x20, 0x3F, 0x23, 0xC7,
+  0x47, 0xEF, 0x20, 0x70, 0x60, 0x03, 0x5C, 0x23, 0x44, 0x2F, 0x40, 0x0F,
+  0x00, 0xFB, 0x3F, 0xB3, 0x43, 0xDF, 0x43, 0xCF, 0x4F, 0xCB, 0x4B, 0xEB,
+  0x00, 0x70, 0x20, 0x3F, 0x53, 0xD7, 0x40, 0x13, 0x00, 0x8A, 0x20, 0x3F,
+  0x00, 0x7D, 0x20, 0x3F, 0x47, 0xEF, 0x48, 0x1B, 0x40, 0x03, 0x5C, 0x23,
+  0x44, 0x2F, 0x40, 0x0B, 0x00, 0x99, 0x20, 0x3F, 0x43, 0xDF, 0x43, 0xCF,
+  0x00, 0x30, 0x2F, 0xCB, 0x4B, 0xEB, 0x00, 0x29, 0x20, 0x3F, 0x53, 0xD7,
+  0x40, 0x13, 0x00, 0x33, 0x20, 0x3F, 0x00, 0x2E, 0x20, 0x3F, 0x47, 0xEF,
+  0x48, 0x1B, 0x40, 0x01, 0x5C, 0x23, 0x44, 0x2F, 0x40, 0x0B, 0x00, 0x39,
+  0x60, 0x3F, 0x00, 0x7F, 0x20, 0x2B, 0x3F, 0xEB, 0x2F, 0xCB, 0x4B, 0xEB,
+  0x02, 0x29, 0xB8, 0x70, 0x20, 0x3F, 0x00, 0x73, 0x60, 0x13, 0x02, 0x33,
+  0xE3, 0x8A, 0x20, 0x3F, 0x00, 0x7D, 0x20, 0x3F, 0x00, 0x8B, 0x20, 0x2F,
+  0x40, 0x71, 0x00, 0x9C, 0x20, 0x3F, 0x00, 0x86, 0x20, 0x3F, 0x00, 0x8D,
+  0x60, 0x0F, 0x02, 0x39, 0xFB, 0x99, 0x20, 0x7F, 0x00, 0xD1, 0x20, 0x2B,
+  0x3F, 0xEB, 0x2D, 0x8B, 0x4B, 0xEB, 0x02, 0x29, 0xB8, 0xB8, 0x20, 0x3F,
+  0x00, 0xBD, 0x60, 0x13, 0x02, 0x33, 0xE3, 0xE3, 0x20, 0x3F, 0x00, 0xCD,
+  0x20, 0x3F, 0x00, 0xE4, 0x20, 0x2F, 0x40, 0xF1, 0x00, 0xFF, 0x20, 0x3F,
+  0x00, 0xDB, 0x20, 0x3F, 0x00, 0xE7, 0x60, 0x0F, 0x00, 0x39, 0x3D, 0xF3,
+  0x43, 0xDF, 0x43, 0xCF, 0x4F, 0xCB, 0x4B, 0xEB, 0x02, 0x56, 0x87, 0xB8,
+  0x73, 0xD7, 0x40, 0x13, 0x02, 0x6B, 0xA7, 0xE3, 0x64, 0x07, 0x47, 0xEF,
+  0x48, 0x1B, 0x40, 0x03, 0x00, 0x67, 0x3C, 0x23, 0x44, 0x2F, 0x40, 0x0B,
+  0x02, 0x76, 0xB8, 0xFB, 0x63, 0xDF, 0x43, 0xCF, 0x4F, 0xCB, 0x4B, 0xEB,
+  0x02, 0x63, 0x63, 0xB8, 0x73, 0xD7, 0x40, 0x13, 0x02, 0x7B, 0x7B, 0xE3,
+  0x64, 0x07, 0x47, 0xEF, 0x22, 0x82, 0x60, 0x03, 0x5C, 0x23, 0x44, 0x2F,
+  0x40, 0x0F, 0x02, 0x87, 0x87, 0xFB, 0x23, 0xD7, 0x00, 0xD1, 0x63, 0xCF,
+  0x4F, 0xCB, 0x4B, 0xEB, 0x02, 0x70, 0x29, 0xB8, 0x73, 0xD7, 0x43, 0xE3,
+  0x02, 0x8A, 0x33, 0xE3, 0x64, 0x07, 0x47, 0xEF, 0x21, 0xFA, 0x60, 0x03,
+  0x5C, 0x23, 0x44, 0x2F, 0x40, 0x0F, 0x00, 0x99, 0x3F, 0xB3, 0x43, 0xDF,
+  0x43, 0xCF, 0x4F, 0xCB, 0x4B, 0xEB, 0x02, 0x90, 0x3D, 0xB8, 0x73, 0xD7,
+  0x40, 0x13, 0x02, 0xB3, 0x4B, 0xE3, 0x64, 0x07, 0x47, 0xEF, 0x48, 0x1B,
+  0x40, 0x03, 0x00, 0xAC, 0x3C, 0x23, 0x44, 0x2F, 0x40, 0x0B, 0x02, 0xC5,
+  0x53, 0xFB, 0x22, 0xBF, 0x00, 0xD1, 0x22, 0xAB, 0x00, 0xD8, 0x22, 0xBF,
+  0x00, 0xD5, 0x22, 0xBF, 0x00, 0xEE, 0x22, 0xBF, 0x00, 0xB8, 0x22, 0xBF,
+  0x00, 0xBD, 0x60, 0x13, 0x00, 0xE3, 0x20, 0x7F, 0x44, 0x07, 0x47, 0xEF,
+  0x61, 0x30, 0x20, 0x83, 0x5C, 0x23, 0x44, 0x2F, 0x40, 0x0B, 0x00, 0xFB,
+  0x20, 0x7F, 0x43, 0xDF, 0x43, 0xCF, 0x4F, 0xCB, 0x4B, 0xEB, 0x02, 0xB8,
+  0x29, 0x70, 0x20, 0x3F, 0x00, 0x73, 0x60, 0x13, 0x02, 0xE3, 0x33, 0x8A,
+  0x20, 0x3F, 0x00, 0x7D, 0x20, 0x3F, 0x00, 0x8B, 0x20, 0x2F, 0x8B, 0xF7,
+  0x5C, 0x23, 0x44, 0x2F, 0x40, 0x0F, 0x02, 0xFB, 0x39, 0x99, 0x63, 0xDF,
+  0x43, 0xCF, 0x4F, 0xCB, 0x03, 0x55, 0x55, 0x55, 0xFF, 0x4F, 0xFB, 0x53,
+  0xD7, 0x40, 0x13, 0x02, 0x4F, 0x4F, 0x4F, 0x64, 0x07, 0x44, 0x0F, 0x4B,
+  0xF3, 0x40, 0x03, 0x4C, 0x17, 0x44, 0x2F, 0x40, 0x0B, 0x02, 0x5C, 0x5C,
+  0x5C, 0xE3, 0x00, 0xDF, 0x43, 0xEB, 0x5C, 0x0B, 0x4F, 0xFB, 0x00, 0x77,
+  0x33, 0xFB, 0x43, 0xE3, 0x47, 0xE7, 0x44, 0x07, 0x40, 0x07, 0x48, 0x1B,
+  0x40, 0x03, 0x5C, 0x23, 0x44, 0x2F, 0x40, 0x0B, 0x02, 0xA4, 0xA4, 0xA4,
+  0x23, 0x3F, 0x20, 0xFF, 0x22, 0x3F, 0x4F, 0xCB, 0x4B, 0xEB, 0x00, 0xB8,
+  0x22, 0x3F, 0x00, 0xBD, 0x22, 0x3F, 0x40, 0x13, 0x00, 0xE3, 0x22, 0x3F,
+  0x44, 0x07, 0x47, 0xEF, 0xC0, 0x00, 0x5C, 0x23, 0x44, 0x2F, 0x40, 0x00,
+  0x00, 0xFB, 0x22, 0x3F, 0x47, 0xEF, 0x4B, 0xCB, 0x48, 0x07, 0x40, 0x03,
+  0x4F, 0xEB, 0x4B, 0xE7, 0x40, 0x0B, 0x48, 0x07, 0x40, 0x1B, 0x44, 0x17,
+  0x48, 0x03, 0x50, 0x0F, 0x44, 0x0B, 0x48, 0x03, 0x57, 0xFF, 0x58, 0x2F,
+  0x47, 0xEF, 0x00, 0xF2, 0x2B, 0xCB, 0x4B, 0xF7, 0x40, 0x03, 0x4F, 0xEB,
+  0x00, 0xF1, 0x2B, 0xD7, 0x40, 0x0B, 0x00, 0xE5, 0x2F, 0xF3, 0x40, 0x1B,
+  0x44, 0x17, 0x48, 0x03, 0x50, 0x0F, 0x44, 0x0B, 0x48, 0x03, 0x01, 0xC8,
+  0x7A, 0x20, 0x3F, 0x00, 0x88, 0x20, 0x3F, 0x2B, 0xC3, 0x4B, 0xCB, 0x48,
+  0x07, 0x40, 0x03, 0x4F, 0xEB, 0x4B, 0xE7, 0x40, 0x0B, 0x48, 0x07, 0x40,
+  0x1B, 0x44, 0x17, 0x48, 0x03, 0x50, 0x0F, 0x44, 0x0B, 0x48, 0x03, 0x57,
+  0xFF, 0x58, 0x2F, 0x47, 0xEF, 0x4B, 0xCB, 0x00, 0x8E, 0x2C, 0x37, 0x40,
+  0x03, 0x4F, 0xEB, 0x00, 0x93, 0x2B, 0xFB, 0x40, 0x0B, 0x48, 0x07, 0x40,
+  0x1B, 0x44, 0x17, 0x48, 0x03, 0x50, 0x0F, 0x44, 0x0B, 0x48, 0x03, 0x57,
+  0xFF, 0x58, 0x2F, 0x47, 0xEF, 0x4B, 0xCB, 0x68, 0x07, 0x20, 0x43, 0x00,
+  0x39, 0x30, 0x0B, 0x6B, 0xE7, 0x20, 0x0B, 0x48, 0x07, 0x40, 0x1B, 0x44,
+  0x17, 0x00, 0x30, 0x28, 0x03, 0x50, 0x0F, 0x44, 0x0B, 0x48, 0x03, 0x57,
+  0xFF, 0x00, 0x32, 0x3C, 0xBB, 0x47, 0xEF, 0x4B, 0xCB, 0x68, 0x07, 0x2F,
+  0xD3, 0x4F, 0xEB, 0x6B, 0xE7, 0x20, 0x0B, 0x48, 0x07, 0x40, 0x1B, 0x44,
+  0x17, 0x48, 0x03, 0x00, 0x32, 0x38, 0x07, 0x44, 0x0B, 0x00, 0x32, 0x30,
+  0x23, 0x57, 0xFF, 0x02, 0x32, 0xDE, 0x88, 0x20, 0x3F, 0x00, 0xF0, 0x20,
+  0x23, 0x00, 0xF2, 0x20, 0x2F, 0x28, 0x07, 0x20, 0x03, 0x4F, 0xEB, 0x6B,
+  0xE7, 0x20, 0x0B, 0x00, 0x34, 0x2C, 0x07, 0x40, 0x1B, 0x44, 0x17, 0x48,
+  0x03, 0x50, 0x0F, 0x44, 0x0B, 0x48, 0x03, 0x57, 0xFF, 0x58, 0x2F, 0x47,
+  0xEF, 0x4B, 0xCB, 0x4B, 0xF7, 0x40, 0x03, 0x00, 0x78, 0x30, 0x0B, 0x4B,
+  0xE7, 0x40, 0x0B, 0x48, 0x07, 0x40, 0x1B, 0x44, 0x17, 0x48, 0x03, 0x00,
+  0x69, 0x38, 0x07, 0x44, 0x0B, 0x48, 0x03, 0x57, 0xFF, 0x58, 0x2F, 0x47,
+  0xEF, 0x4B, 0xCB, 0x48, 0x07, 0x40, 0x03, 0x00, 0x8A, 0x30, 0x0B, 0x4B,
+  0xE7, 0x40, 0x0B, 0x48, 0x07, 0x40, 0x1B, 0x44, 0x17, 0x48, 0x03, 0x50,
+  0x0F, 0x44, 0x0B, 0x48, 0x03, 0x57, 0xFF, 0x58, 0x2F, 0x00, 0x93, 0x2B,
+  0xC3, 0x4B, 0xCB, 0x4B, 0xF7, 0x40, 0x03, 0x00, 0x9B, 0x2F, 0x8B, 0x4B,
+  0xE7, 0x40, 0x0B, 0x48, 0x07, 0x40, 0x1B, 0x44, 0x17, 0x48, 0x03, 0x00,
+  0x89, 0x30, 0x0F, 0x44, 0x0B, 0x48, 0x03, 0x02, 0x7A, 0x2D, 0xC8, 0x78,
+  0x2F, 0x47, 0xEF, 0x4B, 0xCB, 0x88, 0x07, 0x00, 0xE8, 0x2C, 0x07, 0x01,
+  0xFE, 0xFF, 0x4B, 0xE7, 0x40, 0x0B, 0x48, 0x07, 0x40, 0x1B, 0x44, 0x17,
+  0x02, 0xA9, 0x48, 0xD7, 0x70, 0x0F, 0x44, 0x0B, 0x00, 0xAD, 0x28, 0x03,
+  0x57, 0xFF, 0x58, 0x2F, 0x47, 0xEF, 0x00, 0xF2, 0x2B, 0xCB, 0x48, 0x07,
+  0x40, 0x03, 0x4F, 0xEB, 0x4B, 0xE7, 0x40, 0x0B, 0x48, 0x07, 0x40, 0x1B,
+  0x44, 0x17, 0x48, 0x03, 0x50, 0x0F, 0x44, 0x0B, 0x48, 0x03, 0x57, 0xFF,
+  0x00, 0xDE, 0x3C, 0x3B, 0x47, 0xEF, 0x00, 0xF2, 0x2B, 0xCB, 0x48, 0x07,
+  0x40, 0x03, 0x00, 0xFE, 0x30, 0x0B, 0x00, 0xF1, 0x34, 0x07, 0x40, 0x0B,
+  0x48, 0x07, 0x40, 0x1B, 0x44, 0x17, 0x48, 0x03, 0x50, 0x0F, 0x44, 0x0B,
+  0x48, 0x03, 0x57, 0xFF, 0x02, 0xDE, 0x32, 0x88, 0x67, 0xEF, 0x4B, 0xCB,
+  0x43, 0xD3, 0x40, 0x03, 0x43, 0xD7, 0xC0, 0x0F, 0x43, 0xF7, 0x40, 0x0B,
+  0x44, 0x17, 0x48, 0x03, 0x4F, 0xEF, 0x40, 0x13, 0x48, 0x03, 0x57, 0xFF,
+  0x40, 0x07, 0x47, 0xEF, 0x4B, 0xCB, 0x48, 0x07, 0x40, 0x03, 0x4C, 0x07,
+  0xC0, 0x0F, 0x48, 0x07, 0x40, 0x0B, 0x44, 0x17, 0x00, 0x8A, 0x25, 0x70,
+  0x4F, 0xEF, 0x44, 0x0B, 0x48, 0x03, 0x57, 0xFF, 0x40, 0x07, 0x47, 0xEF,
+  0x4B, 0xCB, 0x48, 0x07, 0x40, 0x03, 0x4F, 0xEB, 0x4B, 0xE7, 0x40, 0x0B,
+  0x00, 0xE5, 0x22, 0x3F, 0x40, 0x1B, 0x44, 0x17, 0x48, 0x03, 0x50, 0x0F,
+  0x44, 0x0B, 0x48, 0x03, 0x00, 0xC8, 0x37, 0xFF, 0x58, 0x2F, 0x43, 0xC7,
+  0x47, 0xE3, 0x00, 0xE3, 0x27, 0xEB, 0x40, 0x03, 0x50, 0x0B, 0x4B, 0xF7,
+  0x02, 0xEB, 0x35, 0x35, 0x24, 0xE7, 0x00, 0x34, 0x2C, 0xFF, 0x80, 0x1F,
+  0x48, 0x27, 0x43, 0xFB, 0x58, 0x2B, 0x00, 0xBA, 0x28, 0x1F, 0x48, 0x2F,
+  0x40, 0x0F, 0x43, 0xC7, 0x47, 0xE3, 0x47, 0xEB, 0x40, 0x03, 0x01, 0xD3,
+  0x81, 0x20, 0x3F, 0x00, 0x82, 0x20, 0x3F, 0x34, 0x0B, 0x47, 0xE7, 0x4F,
+  0xFF, 0x40, 0x1F, 0x48, 0x27, 0x43, 0xFB, 0x01, 0xBB, 0x72, 0x20, 0x3F,
+  0x20, 0x03, 0x48, 0x2F, 0x40, 0x0F, 0x43, 0xC7, 0x47, 0xE3, 0x47, 0xEB,
+  0x40, 0x03, 0x50, 0x0B, 0x4B, 0xF7, 0x5B, 0xE3, 0x00, 0xE7, 0x2C, 0x17,
+  0x00, 0xCA, 0x2F, 0x7F, 0x40, 0x1F, 0x48, 0x27, 0x43, 0xFB, 0x58, 0x2B,
+  0x01, 0xBA, 0xBA, 0x20, 0x3F, 0x27, 0xAF, 0x40, 0x0F, 0x43, 0xC7, 0x00,
+  0x7D, 0x27, 0xA3, 0x47, 0xEB, 0x40, 0x03, 0x50, 0x0B, 0x4B, 0xF7, 0x5B,
+  0xE3, 0x47, 0xE7, 0x4F, 0xFF, 0x40, 0x1F, 0x48, 0x27, 0x43, 0xFB, 0x58,
+  0x2B, 0x00, 0x72, 0x20, 0x3F, 0x48, 0x2F, 0x40, 0x0F, 0x43, 0xC7, 0x67,
+  0xE3, 0x27, 0xEB, 0x40, 0x03, 0x50, 0x0B, 0x4B, 0xF7, 0x5B, 0xE3, 0x47,
+  0xE7, 0x00, 0x2D, 0x20, 0x7F, 0x40, 0x1F, 0x48, 0x27, 0x43, 0xFB, 0x58,
+  0x2B, 0x00, 0x2A, 0x20, 0x3F, 0x48, 0x2F, 0x40, 0x0F, 0x43, 0xC7, 0x67,
+  0xE3, 0x27, 0xEB, 0x40, 0x03, 0x50, 0x0B, 0x02, 0x30, 0xD4, 0x82, 0x20,
+  0x3F, 0x00, 0x8F, 0x20, 0x3F, 0x00, 0x8D, 0x20, 0x3F, 0x00, 0x7B, 0x60,
+  0x1F, 0x48, 0x27, 0x43, 0xFB, 0x00, 0x2A, 0x38, 0x2B, 0x02, 0x2A, 0xBA,
+  0x72, 0x20, 0x3F, 0x00, 0x82, 0x60, 0x0F, 0x43, 0xC7, 0x67, 0xE3, 0x25,
+  0xAB, 0x40, 0x03, 0x00, 0x2F, 0x37, 0xF3, 0x4B, 0xF7, 0x02, 0x35, 0xEB,
+  0xEB, 0x20, 0x3F, 0x00, 0xE7, 0x20, 0x3F, 0x00, 0xCA, 0x60, 0x1F, 0x48,
+  0x27, 0x43, 0xFB, 0x58, 0x2B, 0x02, 0x2A, 0xBA, 0xBA, 0x20, 0x3F, 0x00,
+  0xD5, 0x60, 0x0F, 0x43, 0xC7, 0x4B, 0xEB, 0x47, 0xEB, 0x40, 0x03, 0x00,
+  0x63, 0x50, 0x0F, 0x2B, 0xF7, 0x5B, 0xE3, 0x47, 0xE7, 0x4F, 0xFF, 0x40,
+  0x1F, 0x48, 0x27, 0x43, 0xFB, 0x58, 0x2B, 0x02, 0x57, 0x89, 0xBA, 0x68,
+  0x2F, 0x40, 0x0F, 0x43, 0xC7, 0x4B, 0xEB, 0x47, 0xEB, 0x40, 0x03, 0x50,
+  0x0B, 0x4B, 0xF7, 0x5B, 0xE3, 0x47, 0xE7, 0x4F, 0xFF, 0x40, 0x1F, 0x4C,
+  0x07, 0x43, 0xFB, 0x58, 0x2B, 0x02, 0x65, 0x65, 0xBA, 0x26, 0xA7, 0x00,
+  0xD5, 0x60, 0x0F, 0x43, 0xC7, 0x4B, 0xEB, 0x00, 0x8A, 0x27, 0x6B, 0x40,
+  0x03, 0x50, 0x0B, 0x4B, 0xF7, 0x5B, 0xE3, 0x47, 0xE7, 0x4F, 0xFF, 0x40,
+  0x1F, 0x48, 0x27, 0x43, 0xFB, 0x58, 0x2B, 0x02, 0x72, 0x2A, 0xBA, 0x20,
+  0x23, 0x00, 0xD5, 0x60, 0x0F, 0x43, 0xC7, 0x4B, 0xEB, 0x47, 0xEB, 0x40,
+  0x03, 0x50, 0x0B, 0x02, 0xA7, 0x46, 0xD4, 0x7B, 0xE3, 0x47, 0xE7, 0x4F,
+  0xFF, 0x40, 0x1F, 0x00, 0xA4, 0x2C, 0x1B, 0x43, 0xFB, 0x58, 0x2B, 0x02,
+  0x92, 0x3E, 0xBA, 0x68, 0x2F, 0x40, 0x0F, 0x43, 0xC7, 0x47, 0xE3, 0x00,
+  0xE3, 0x20, 0x7F, 0x40, 0x03, 0x50, 0x0B, 0x4B, 0xF7, 0x00, 0xEB, 0x3C,
+  0x63, 0x47, 0xE7, 0x4F, 0xFF, 0x40, 0x1F, 0x48, 0x27, 0x43, 0xFB, 0x00,
+  0xBB, 0x38, 0x2B, 0x00, 0xBA, 0x20, 0x7F, 0x48, 0x2F, 0x40, 0x0F, 0x43,
+  0xC7, 0x00, 0xCD, 0x27, 0xE3, 0x47, 0xEB, 0x40, 0x03, 0x50, 0x0B, 0x4B,
+  0xF7, 0x5B, 0xE3, 0x47, 0xE7, 0x4F, 0xFF, 0x40, 0x1F, 0x48, 0x27, 0x43,
+  0xFB, 0x00, 0xBB, 0x38, 0x2B, 0x00, 0xBA, 0x20, 0x03, 0x48, 0x2F, 0x40,
+  0x0F, 0x43, 0xC7, 0x4B, 0xEB, 0x47, 0xEB, 0x40, 0x03, 0x4B, 0xF3, 0x40,
+  0x03, 0x4F, 0xEF, 0x44, 0x0F, 0x4F, 0xFF, 0x40, 0x1F, 0x4C, 0x07, 0x43,
+  0xFB, 0x58, 0x2B, 0x00, 0x39, 0x2B, 0x37, 0x00, 0x48, 0x37, 0xFB, 0x40,
+  0x0F, 0x43, 0xC7, 0x01, 0x82, 0x82, 0x87, 0xE3, 0x43, 0xDB, 0x02, 0x87,
+  0x87, 0x87, 0x68, 0x0B, 0x5B, 0xE3, 0x47, 0xE7, 0x4F, 0xFF, 0x40, 0x1F,
+  0x00, 0x86, 0x2C, 0x1B, 0x40, 0x1F, 0x58, 0x2B, 0x40, 0x03, 0x48, 0x2F,
+  0x40, 0x0F, 0x43, 0xC7, 0x47, 0xE3, 0x47, 0xEB, 0x40, 0x03, 0x50, 0x0B,
+  0x4B, 0xF7, 0x5B, 0xE3, 0x47, 0xE7, 0x00, 0xCA, 0x22, 0x3F, 0x40, 0x1F,
+  0x48, 0x27, 0x43, 0xFB, 0x58, 0x2B, 0x00, 0xBA, 0x22, 0x3F, 0x48, 0x2F,
+  0x40, 0x0F, 0x43, 0xEB, 0x43, 0xF3, 0x00, 0xB8, 0xAB, 0xF7, 0x48, 0x0F,
+  0x02, 0xF7, 0x38, 0x38, 0x2C, 0xDB, 0x00, 0x2C, 0x38, 0xF7, 0x00, 0x29,
+  0x24, 0xEB, 0x00, 0x32, 0x21, 0x0B, 0x00, 0x35, 0x24, 0xFB, 0x00, 0x32,
+  0x21, 0x0F, 0x00, 0x34, 0x28, 0xF7, 0x29, 0x44, 0x20, 0x03, 0x43, 0xFB,
+  0x50, 0x0F, 0x43, 0xEB, 0x43, 0xF3, 0xCB, 0xF7, 0x48, 0x0F, 0x01, 0xF7,
+  0x97, 0x20, 0x3F, 0x2F, 0xDB, 0x01, 0xB7, 0x6F, 0x20, 0x3F, 0x00, 0x87,
+  0x20, 0x3F, 0x24, 0x0B, 0x47, 0xFB, 0x44, 0x0F, 0x69, 0xF8, 0x29, 0xFC,
+  0x43, 0xFB, 0x50, 0x0F, 0x43, 0xEB, 0x43, 0xF3, 0xCB, 0xF7, 0x48, 0x0F,
+  0x01, 0xF7, 0xF7, 0x20, 0x3F, 0x3F, 0x6B, 0x5B, 0xF7, 0x47, 0xEB, 0x44,
+  0x0B, 0x47, 0xFB, 0x44, 0x0F, 0x20, 0x7C, 0x60, 0x03, 0x43, 0xFB, 0x50,
+  0x0F, 0x43, 0xEB, 0x43, 0xF3, 0xCB, 0xF7, 0x48, 0x0F, 0x00, 0x97, 0x20,
+  0x3F, 0x4F, 0xDB, 0x5C, 0x07, 0x47, 0xEB, 0x44, 0x0B, 0x47, 0xFB, 0x44,
+  0x0F, 0x8B, 0x85, 0x01, 0x3A, 0xFF, 0x43, 0xFB, 0x02, 0x75, 0xC0, 0x2B,
+  0x23, 0x6B, 0x2F, 0xDB, 0x3B, 0xE7, 0x00, 0x29, 0xAB, 0xF7, 0x48, 0x0F,
+  0x00, 0x38, 0x20, 0x3F, 0x4F, 0xDB, 0x5C, 0x07, 0x47, 0xEB, 0x44, 0x0B,
+  0x47, 0xFB, 0x44, 0x0F, 0x4B, 0xF7, 0x40, 0x01, 0x43, 0xFB, 0x50, 0x0F,
+  0x43, 0xEB, 0x43, 0xF3, 0xCB, 0xF7, 0x48, 0x0F, 0x02, 0x38, 0xF7, 0x97,
+  0x20, 0x3F, 0x00, 0x78, 0x20, 0x3F, 0x00, 0x6F, 0x20, 0x3F, 0x00, 0x87,
+  0x20, 0x3F, 0x38, 0x17, 0x27, 0xFB, 0x44, 0x0F, 0x4C, 0x03, 0x40, 0x03,
+  0x44, 0x0B, 0x50, 0x0F, 0x43, 0xEB, 0x00, 0x2F, 0x23, 0xF3, 0xCB, 0xF7,
+  0x48, 0x0F, 0x02, 0x38, 0xF7, 0xF7, 0x20, 0x3F, 0x00, 0xC4, 0x20, 0x3F,
+  0x00, 0xB7, 0x20, 0x3F, 0x9F, 0xFF, 0x10, 0x10, 0x47, 0xFB, 0x44, 0x0F,
+  0x80, 0xFD, 0x00, 0xFF, 0x20, 0x3F, 0x00, 0xE4, 0x20, 0x3F, 0x00, 0xC0,
+  0x63, 0xEB, 0x00, 0x63, 0x23, 0xF3, 0x00, 0x56, 0xAB, 0xF7, 0x48, 0x0F,
+  0x02, 0x74, 0xB6, 0xF7, 0x6F, 0xDB, 0x5C, 0x07, 0x47, 0xEB, 0x44, 0x0B,
+  0x47, 0xFB, 0x44, 0x0F, 0x4B, 0xF7, 0x40, 0x03, 0x43, 0xFB, 0x00, 0x5A,
+  0x3C, 0x0B, 0x43, 0xEB, 0x43, 0xF3, 0xCB, 0xF7, 0x48, 0x0F, 0x02, 0x86,
+  0x86, 0xF7, 0x6F, 0xDB, 0x5B, 0xF7, 0x01, 0x77, 0x77, 0x9F, 0xFF, 0x10,
+  0x10, 0x47, 0xFB, 0x44, 0x0F, 0x26, 0x86, 0x60, 0x03, 0x44, 0x0B, 0x50,
+  0x0F, 0x43, 0xEB, 0x43, 0xF3, 0xCB, 0xF7, 0x00, 0x93, 0x28, 0x0F, 0x02,
+  0x97, 0x38, 0xF7, 0x6F, 0xDB, 0x5C, 0x07, 0x47, 0xEB, 0x44, 0x0B, 0x00,
+  0x89, 0x27, 0xFB, 0x44, 0x0F, 0x21, 0xFA, 0x60, 0x03, 0x44, 0x0B, 0x50,
+  0x0F, 0x43, 0xEB, 0x43, 0xF3, 0x00, 0x90, 0xAB, 0xF7, 0x02, 0xBD, 0x50,
+  0xF0, 0x7F, 0xFF, 0x08, 0x04, 0x5F, 0xEB, 0x5C, 0x07, 0x47, 0xEB, 0x00,
+  0xB8, 0x3F, 0xEF, 0x58, 0x0B, 0x44, 0x0F, 0x4B, 0xF7, 0x40, 0x03, 0x43,
+  0xFB, 0x50, 0x0F, 0x43, 0xEB, 0x43, 0xF3, 0xCB, 0xF7, 0x48, 0x0F, 0x00,
+  0xF7, 0x20, 0x7F, 0x4F, 0xDB, 0x5C, 0x07, 0x47, 0xEB, 0x44, 0x0B, 0x47,
+  0xFB, 0x44, 0x0F, 0xC1, 0x40, 0x43, 0xFB, 0x50, 0x0F, 0x43, 0xEB, 0x43,
+  0xF3, 0xCB, 0xF7, 0x48, 0x0F, 0x02, 0xF7, 0x38, 0x97, 0x20, 0x3F, 0x00,
+  0x78, 0x20, 0x3F, 0x00, 0x6F, 0x20, 0x3F, 0x00, 0x87, 0x20, 0x3F, 0x00,
+  0x8F, 0x20, 0x3F, 0x00, 0x89, 0x20, 0x3F, 0x00, 0x8D, 0x20, 0x3F, 0x8C,
+  0x07, 0x43, 0xFB, 0x50, 0x0F, 0x43, 0xEB, 0x40, 0x03, 0xCB, 0xF7, 0x4F,
+  0xFF, 0x02, 0x5A, 0x5A, 0x5A, 0x6F, 0xDB, 0x40, 0x13, 0x47, 0xE3, 0x44,
+  0x0B, 0x47, 0xFB, 0x44, 0x0F, 0x48, 0x1F, 0x40, 0x03, 0x43, 0xFB, 0x02,
+  0x3D, 0x3D, 0x3D, 0x63, 0xC7, 0x43, 0xF3, 0xCB, 0xF7, 0x48, 0x0F, 0x02,
+  0xA2, 0xA2, 0xA2, 0x6F, 0xDB, 0x40, 0x13, 0x47, 0xE3, 0x44, 0x0B, 0x47,
+  0xFB, 0x44, 0x0F, 0x4B, 0xF7, 0x40, 0x03, 0x43, 0xFB, 0x50, 0x0F, 0x43,
+  0xEB, 0x43, 0xF3, 0x00, 0xB8, 0xAB, 0xF7, 0x48, 0x0F, 0x00, 0xF7, 0x22,
+  0x3F, 0x00, 0xC4, 0x22, 0x3F, 0x5C, 0x07, 0x47, 0xEB, 0x44, 0x0B, 0x47,
+  0xFB, 0x44, 0x0F, 0xC0, 0x00, 0x43, 0xFB, 0x50, 0x0F, 0x43, 0xD3, 0x4B,
+  0xE7, 0x00, 0xF8, 0x23, 0xF3, 0x43, 0xD7, 0x43, 0xFF, 0x4B, 0xFB, 0x43,
+  0xEF, 0x4B, 0xF3, 0x00, 0xB8, 0x24, 0x03, 0x00, 0xDB, 0x30, 0x1F, 0x40,
+  0x27, 0x4C, 0x17, 0x5C, 0x17, 0x40, 0x0F, 0x40, 0x0B, 0x58, 0x33, 0x43,
+  0xD3, 0x00, 0xE5, 0x2B, 0xE7, 0x01, 0xF8, 0x98, 0x20, 0x3F, 0x21, 0xDC,
+  0x43, 0xFF, 0x4B, 0xFB, 0x43, 0xEF, 0x4B, 0xF3, 0x44, 0x17, 0xCF, 0xF3,
+  0x00, 0xF1, 0x2C, 0x17, 0x5C, 0x17, 0x40, 0x0F, 0x40, 0x0B, 0x58, 0x33,
+  0x43, 0xD3, 0x00, 0xE5, 0x33, 0xEF, 0x01, 0xF8, 0xF8, 0x20, 0x3F, 0x21,
+  0x9C, 0x43, 0xFF, 0x4B, 0xFB, 0x43, 0xEF, 0x4B, 0xF3, 0x44, 0x17, 0xCF,
+  0xF3, 0x4C, 0x17, 0x01, 0xDA, 0xDA, 0x20, 0x3F, 0x00, 0xDB, 0x20, 0x3F,
+  0x2B, 0xE3, 0x58, 0x33, 0x43, 0xD3, 0x4B, 0xE7, 0x00, 0x98, 0x20, 0x3F,
+  0x43, 0x59, 0x43, 0xFF, 0x4B, 0xFB, 0x43, 0xEF, 0x4B, 0xF3, 0x44, 0x17,
+  0xCF, 0xF3, 0x00, 0x93, 0x20, 0x33, 0x5C, 0x17, 0x40, 0x0F, 0x40, 0x0B,
+  0x58, 0x33, 0x43, 0xD3, 0x4B, 0xE7, 0x00, 0x38, 0x20, 0x3F, 0x43, 0xD7,
+  0x43, 0xFF, 0x4B, 0xFB, 0x43, 0xEF, 0x00, 0x30, 0x2B, 0xF3, 0x44, 0x17,
+  0xCF, 0xF3, 0x4C, 0x17, 0x5C, 0x17, 0x40, 0x0F, 0x40, 0x0B, 0x58, 0x33,
+  0x43, 0xD3, 0x4B, 0xE7, 0x02, 0x38, 0xF8, 0x98, 0x20, 0x3F, 0x00, 0x9C,
+  0x20, 0x3F, 0x33, 0xFF, 0x2B, 0xFB, 0x43, 0xEF, 0x4B, 0xF3, 0x44, 0x17,
+  0xCF, 0xF3, 0x4C, 0x17, 0x5C, 0x17, 0x40, 0x0F, 0x40, 0x0B, 0x58, 0x33,
+  0x43, 0xD3, 0x00, 0x34, 0x29, 0xA7, 0x02, 0x38, 0xF8, 0xF8, 0x20, 0x3F,
+  0x9F, 0xFF, 0x07, 0xD4, 0x00, 0x34, 0x2B, 0xFB, 0x43, 0xEF, 0x4B, 0xF3,
+  0x44, 0x17, 0xCF, 0xF3, 0x4C, 0x17, 0x02, 0x31, 0xDA, 0xDA, 0x60, 0x0F,
+  0x40, 0x0B, 0x58, 0x33, 0x43, 0xD3, 0x4B, 0xE7, 0x02, 0x75, 0xB6, 0xF8,
+  0x63, 0xD7, 0x43, 0xFF, 0x4B, 0xFB, 0x43, 0xEF, 0x4B, 0xF3, 0x44, 0x17,
+  0xCF, 0xF3, 0x4C, 0x17, 0x5C, 0x17, 0x40, 0x0F, 0x40, 0x0B, 0x58, 0x33,
+  0x43, 0xD3, 0x4B, 0xE7, 0x02, 0x86, 0x86, 0xF8, 0x63, 0xD7, 0x43, 0xFF,
+  0x4B, 0xFB, 0x43, 0xEF, 0x4B, 0xF3, 0x44, 0x17, 0xCF, 0xF3, 0x4C, 0x17,
+  0x5C, 0x17, 0x40, 0x0F, 0x40, 0x0B, 0x58, 0x33, 0x02, 0x8D, 0x34, 0xE7,
+  0x6B, 0xE7, 0x02, 0x98, 0x38, 0xF8, 0x41, 0xFE, 0x63, 0xFF, 0x4B, 0xFB,
+  0x43, 0xEF, 0x4B, 0xF3, 0x44, 0x17, 0xCF, 0xF3, 0x4C, 0x17, 0x02, 0x85,
+  0x31, 0xDA, 0x60, 0x0F, 0x40, 0x0B, 0x5C, 0x3B, 0x43, 0xD3, 0x4B, 0xE7,
+  0x02, 0xC3, 0x52, 0xF8, 0x63, 0xD7, 0x43, 0xFF, 0x4B, 0xFB, 0x43, 0xEF,
+  0x4B, 0xF3, 0x00, 0x90, 0x24, 0x17, 0xCF, 0xF3, 0x4C, 0x17, 0x5C, 0x17,
+  0x40, 0x0F, 0x40, 0x0B, 0x58, 0x33, 0x43, 0xD3, 0x4B, 0xE7, 0x00, 0xF8,
+  0x20, 0x7F, 0x41, 0x40, 0x00, 0xF0, 0x24, 0x7F, 0x4B, 0xFB, 0x43, 0xEF,
+  0x02, 0xD7, 0x30, 0xD7, 0x22, 0xBF, 0x00, 0xB8, 0x22, 0xAF, 0x2E, 0xF3,
+  0x20, 0xA7, 0x4C, 0x17, 0x00, 0xDA, 0x20, 0x7F, 0x40, 0x0F, 0x40, 0x0B,
+  0x01, 0xFD, 0x39, 0x40, 0x3F, 0x00, 0x8D, 0x20, 0x3F, 0x00, 0x8C, 0x20,
+  0x3F, 0x00, 0x98, 0x20, 0x3F, 0x9F, 0xFF, 0x07, 0xD4, 0x4B, 0xFB, 0x01,
+  0xE0, 0x32, 0x9F, 0xFF, 0x0C, 0x00, 0x44, 0x17, 0xCF, 0xF3, 0x00, 0xF1,
+  0x2C, 0x17, 0x00, 0xDA, 0x3C, 0x17, 0x40, 0x0F, 0x40, 0x0B, 0x58, 0x33,
+  0x43, 0xD3, 0x43, 0xCB, 0x43, 0xF3, 0x43, 0xD7, 0x43, 0xFF, 0x40, 0x13,
+  0x43, 0xEF, 0x4B, 0xF3, 0x44, 0x03, 0xCF, 0xF3, 0x4C, 0x0B, 0x40, 0x0B,
+  0x40, 0x03, 0x40, 0x0B, 0x58, 0x33, 0x43, 0xD3, 0x4B, 0xE7, 0x43, 0xF3,
+  0x43, 0xD7, 0x43, 0xFF, 0x4C, 0x07, 0x43, 0xEF, 0x00, 0x8A, 0x25, 0x6C,
+  0x44, 0x03, 0xCF, 0xF3, 0x4C, 0x0B, 0x00, 0x8C, 0x3C, 0x17, 0x40, 0x0F,
+  0x40, 0x0B, 0x4C, 0x2B, 0x43, 0xD3, 0x4B, 0xE7, 0x00, 0xF8, 0x22, 0x3F,
+  0x40, 0x00, 0x43, 0xFF, 0x4B, 0xFB, 0x43, 0xEF, 0x4B, 0xF3, 0x00, 0xB8,
+  0x24, 0x17, 0xCF, 0xF3, 0x4C, 0x17, 0x00, 0xDA, 0x22, 0x3F, 0x40, 0x0F,
+  0x40, 0x0B, 0x58, 0x33, 0x47, 0xEB, 0x00, 0xF5, 0x3B, 0xCB, 0x4F, 0xCB,
+  0x54, 0x07, 0x43, 0xD7, 0x43, 0xFB, 0x47, 0xDF, 0x5B, 0xF3, 0x44, 0x13,
+  0x4F, 0xFF, 0x00, 0xD0, 0x34, 0x27, 0x4C, 0x03, 0x5F, 0xF3, 0x44, 0x0B,
+  0x48, 0x37, 0x4C, 0x1B, 0x47, 0xEB, 0x01, 0xF5, 0x95, 0x20, 0x3F, 0x00,
+  0x88, 0x20, 0x3F, 0x00, 0x84, 0x20, 0x3F, 0x23, 0xE3, 0x43, 0xFB, 0x47,
+  0xDF, 0x5B, 0xF3, 0x42, 0x14, 0x4F, 0xFF, 0x00, 0xD0, 0x3C, 0x03, 0x4C,
+  0x03, 0x01, 0xE1, 0x89, 0x20, 0x3F, 0x00, 0x8D, 0x20, 0x3F, 0x2C, 0x23,
+  0x4C, 0x1B, 0x00, 0xF7, 0x27, 0x6B, 0x01, 0xF5, 0xF5, 0x20, 0x3F, 0x2F,
+  0x4B, 0x53, 0xF3, 0x43, 0xD7, 0x43, 0xFB, 0x47, 0xDF, 0x5B, 0xF3, 0x20,
+  0x80, 0x2C, 0xBF, 0x20, 0x3F, 0x37, 0xBF, 0x4C, 0x03, 0x5F, 0xF3, 0x44,
+  0x33, 0x48, 0x37, 0x00, 0xCA, 0x2B, 0x9B, 0x47, 0xEB, 0x00, 0x95, 0x20,
+  0x3F, 0x00, 0x88, 0x20, 0x3F, 0x53, 0xF3, 0x00, 0x93, 0x23, 0xE3, 0x43,
+  0xFB, 0x47, 0xDF, 0x02, 0x8F, 0xEA, 0x35, 0x23, 0x91, 0x00, 0x3A, 0x6F,
+  0xFF, 0x00, 0x7F, 0x20, 0x3F, 0x4C, 0x03, 0x5F, 0xF3, 0x44, 0x33, 0x48,
+  0x37, 0x4C, 0x1B, 0x47, 0xEB, 0x00, 0x37, 0x20, 0x3F, 0x00, 0x32, 0x20,
+  0x3F, 0x53, 0xF3, 0x43, 0xD7, 0x43, 0xFB, 0x47, 0xDF, 0x5B, 0xF3, 0x64,
+  0x13, 0x20, 0x7F, 0x57, 0xFF, 0x6C, 0x03, 0x3F, 0xF3, 0x44, 0x33, 0x48,
+  0x37, 0x4C, 0x1B, 0x47, 0xEB, 0x02, 0x37, 0xF5, 0x95, 0x20, 0x3F, 0x00,
+  0x88, 0x20, 0x3F, 0x9F, 0xFF, 0x0B, 0xE8, 0x43, 0xFB, 0x47, 0xDF, 0x02,
+  0x35, 0xEA, 0x8F, 0x20, 0x3F, 0x24, 0x13, 0x01, 0xEE, 0x92, 0x20, 0x3F,
+  0x00, 0x7F, 0x20, 0x3F, 0x2C, 0x03, 0x3F, 0xF3, 0x44, 0x33, 0x48, 0x37,
+  0x4C, 0x1B, 0x47, 0xEB, 0x02, 0x37, 0xF5, 0xF5, 0x20, 0x3F, 0x00, 0xDE,
+  0x20, 0x3F, 0x00, 0xD8, 0x20, 0x7F, 0x00, 0xF1, 0x20, 0x3F, 0x8F, 0xE7,
+  0x5B, 0xF3, 0x23, 0x52, 0x20, 0x3F, 0x00, 0xEE, 0x20, 0x3F, 0x00, 0xD0,
+  0x20, 0x3F, 0x2C, 0x03, 0x01, 0xE1, 0xE1, 0x20, 0x3F, 0x00, 0xE7, 0x20,
+  0x3F, 0x00, 0xD4, 0x20, 0x3F, 0x00, 0xCA, 0x67, 0xEB, 0x03, 0x73, 0xB4,
+  0xF5, 0xFF, 0x4F, 0xCB, 0x00, 0x66, 0x37, 0xD7, 0x43, 0xD7, 0x43, 0xFB,
+  0x47, 0xDF, 0x5B, 0xF3, 0x47, 0xEB, 0x4F, 0xFF, 0x57, 0xFF, 0x4C, 0x03,
+  0x00, 0x6A, 0x3F, 0xF3, 0x44, 0x33, 0x4C, 0x23, 0x4C, 0x1B, 0x47, 0xEB,
+  0x02, 0x84, 0x84, 0xF5, 0x6F, 0xCB, 0x53, 0xF3, 0x43, 0xD7, 0x43, 0xFB,
+  0x47, 0xDF, 0x5B, 0xF3, 0x22, 0x82, 0x6F, 0xFF, 0x57, 0xFF, 0x4C, 0x03,
+  0x5F, 0xF3, 0x44, 0x33, 0x48, 0x37, 0x4C, 0x1B, 0x47, 0xEB, 0x02, 0x95,
+  0x37, 0xF5, 0x6F, 0xCB, 0x53, 0xF3, 0x43, 0xD7, 0x00, 0x89, 0x27, 0xEB,
+  0x47, 0xDF, 0x02, 0x8F, 0x35, 0xEA, 0x41, 0xFE, 0x6F, 0xFF, 0x02, 0x7F,
+  0x2F, 0xD0, 0x20, 0x03, 0x00, 0xD1, 0x7F, 0xF3, 0x44, 0x33, 0x48, 0x37,
+  0x4C, 0x1B, 0x06, 0xC2, 0x52, 0xF7, 0xFF, 0xC1, 0x51, 0xF5, 0x6F, 0xCB,
+  0x53, 0xF3, 0x43, 0xD7, 0x43, 0xFB, 0x47, 0xDF, 0x5B, 0xF3, 0x47, 0xEB,
+  0x4F, 0xFF, 0x57, 0xFF, 0x4C, 0x03, 0x5F, 0xF3, 0x44, 0x33, 0x00, 0xA7,
+  0x2C, 0x23, 0x4C, 0x1B, 0x47, 0xEB, 0x00, 0xF5, 0x20, 0x7F, 0x00, 0xDE,
+  0x2F, 0xCB, 0x54, 0x07, 0x43, 0xD7, 0x43, 0xFB, 0x47, 0xDF, 0x5B, 0xF3,
+  0x41, 0x40, 0x4F, 0xFF, 0x57, 0xFF, 0x4C, 0x03, 0x02, 0xE1, 0x33, 0xE1,
+  0x22, 0xBF, 0x00, 0xE7, 0x22, 0xBF, 0x00, 0xD4, 0x22, 0xBF, 0x40, 0x3F,
+  0x00, 0x97, 0x20, 0x3F, 0x00, 0x95, 0x20, 0x3F, 0x00, 0x88, 0x20, 0x3F,
+  0x9F, 0xFF, 0x0B, 0xE8, 0x43, 0xFB, 0x47, 0xDF, 0x5B, 0xF3, 0x44, 0x13,
+  0x4F, 0xFF, 0x02, 0xD0, 0x2F, 0x7F, 0x20, 0x3F, 0x00, 0x7F, 0x20, 0x3F,
+  0x88, 0x07, 0x48, 0x37, 0x4C, 0x1B, 0x43, 0xF7, 0x02, 0x59, 0x59, 0x59,
+  0x67, 0xE7, 0x53, 0xF3, 0x43, 0xD7, 0x43, 0xFB, 0x44, 0x13, 0x47, 0xF7,
+  0x44, 0x13, 0x4F, 0xFF, 0x57, 0xFF, 0x01, 0x46, 0x46, 0x9F, 0xFF, 0x08,
+  0x0C, 0x44, 0x1F, 0x48, 0x33, 0x4C, 0x1B, 0x43, 0xF7, 0x02, 0xA0, 0xA0,
+  0xA0, 0x67, 0xE7, 0x43, 0xEF, 0x43, 0xD7, 0x43, 0xFB, 0x47, 0xDF, 0x5B,
+  0xF3, 0x44, 0x13, 0x4F, 0xFF, 0x57, 0xFF, 0x00, 0x86, 0x2C, 0x03, 0x40,
+  0x1B, 0x44, 0x33, 0x4B, 0xFF, 0x4C, 0x1B, 0x47, 0xEB, 0x00, 0xF5, 0x22,
+  0x3F, 0x4F, 0xCB, 0x53, 0xF3, 0x43, 0xD7, 0x43, 0xFB, 0x47, 0xDF, 0x5B,
+  0xF3, 0x40, 0x00, 0x4F, 0xFF, 0x00, 0xD0, 0x22, 0x3F, 0x4C, 0x03, 0x00,
+  0xE1, 0x22, 0x3F, 0x44, 0x33, 0x48, 0x37, 0x4C, 0x1B, 0x00, 0xC1, 0x3B,
+  0xD3, 0x4F, 0xFF, 0x47, 0xF7, 0x43, 0xDB, 0x43, 0xD3, 0x43, 0xDB, 0x44,
+  0x07, 0x48, 0x13, 0x47, 0xEF, 0x4C, 0x1F, 0x00, 0xE5, 0x2B, 0xFB, 0x40,
+  0x23, 0x40, 0x1F, 0x40, 0x2F, 0x44, 0x13, 0x40, 0x23, 0x01, 0xC1, 0x76,
+  0x20, 0x3F, 0x37, 0xE3, 0x47, 0xF7, 0x43, 0xDB, 0x43, 0xD3, 0x43, 0xDB,
+  0x44, 0x07, 0x48, 0x13, 0x47, 0xEF, 0x00, 0xD3, 0x30, 0x13, 0x00, 0xE5,
+  0x28, 0x23, 0x40, 0x23, 0x40, 0x1F, 0x40, 0x2F, 0x44, 0x13, 0x40, 0x23,
+  0x01, 0xC1, 0xC1, 0x20, 0x3F, 0x2F, 0xBF, 0x47, 0xF7, 0x43, 0xDB, 0x00,
+  0xCA, 0x23, 0xD3, 0x43, 0xDB, 0x44, 0x07, 0x00, 0xF8, 0x27, 0x93, 0x47,
+  0xEF, 0x4C, 0x1F, 0x48, 0x23, 0x40, 0x23, 0x40, 0x1F, 0x40, 0x2F, 0x44,
+  0x13, 0x40, 0x23, 0x00, 0x76, 0x20, 0x3F, 0x00, 0x7D, 0x20, 0x3F, 0x47,
+  0xF7, 0x43, 0xDB, 0x43, 0xD3, 0x43, 0xDB, 0x44, 0x07, 0x48, 0x13, 0x47,
+  0xEF, 0x4C, 0x1F, 0x48, 0x23, 0x40, 0x23, 0x40, 0x1F, 0x40, 0x2F, 0x54,
+  0x13, 0x40, 0x23, 0x00, 0x2B, 0x20, 0x3F, 0x00, 0x2E, 0x20, 0x3F, 0x47,
+  0xF7, 0x43, 0xDB, 0x00, 0x2D, 0x20, 0x7F, 0x43, 0xDB, 0x44, 0x07, 0x48,
+  0x13, 0x47, 0xEF, 0x4C, 0x1F, 0x48, 0x23, 0x40, 0x23, 0x40, 0x1F, 0x60,
+  0x2F, 0x24, 0x13, 0x40, 0x23, 0x02, 0x2B, 0xC1, 0x76, 0x20, 0x0F, 0x00,
+  0x7D, 0x20, 0x1B, 0x9F, 0xFF, 0x13, 0xF4, 0x43, 0xD3, 0x43, 0xDB, 0x47,
+  0xDF, 0x00, 0x38, 0x28, 0x13, 0x47, 0xEF, 0x02, 0x2F, 0xD3, 0x81, 0x20,
+  0x3F, 0x00, 0x8C, 0x60, 0x23, 0x40, 0x1F, 0x60, 0x2F, 0x24, 0x13, 0x40,
+  0x23, 0x02, 0x2B, 0xC1, 0xC1, 0x20, 0x0F, 0x00, 0xCD, 0x20, 0x1B, 0x00,
+  0xF0, 0x20, 0x7F, 0x00, 0xE1, 0x20, 0x1F, 0x00, 0xCA, 0x20, 0x3F, 0x00,
+  0xD4, 0x20, 0x1B, 0x00, 0xF1, 0x20, 0x3F, 0x00, 0xF8, 0x20, 0x3F, 0x00,
+  0xDA, 0x20, 0x3F, 0x00, 0xD3, 0x20, 0x3F, 0x00, 0xE5, 0x60, 0x23, 0x40,
+  0x1F, 0x60, 0x2F, 0x24, 0x13, 0x40, 0x23, 0x03, 0x5B, 0x8E, 0xC1, 0xFF,
+  0x4F, 0xDF, 0x00, 0x71, 0x3F, 0xEB, 0x00, 0x6A, 0x23, 0xDB, 0x43, 0xD3,
+  0x43, 0xDB, 0x44, 0x07, 0x48, 0x13, 0x47, 0xEF, 0x4C, 0x1F, 0x48, 0x23,
+  0x40, 0x23, 0x40, 0x1F, 0x40, 0x2F, 0x44, 0x13, 0x40, 0x23, 0x02, 0x68,
+  0x68, 0xC1, 0x6F, 0xDF, 0x47, 0xF7, 0x43, 0xDB, 0x43, 0xD3, 0x43, 0xDB,
+  0x44, 0x07, 0x48, 0x13, 0x47, 0xEF, 0x4C, 0x1F, 0x48, 0x23, 0x40, 0x23,
+  0x40, 0x1F, 0x50, 0x0F, 0x54, 0x13, 0x40, 0x23, 0x02, 0x76, 0x2B, 0xC1,
+  0x6F, 0xDF, 0x00, 0x93, 0x27, 0x77, 0x02, 0x89, 0x33, 0xE1, 0x63, 0xD3,
+  0x43, 0xDB, 0x44, 0x07, 0x48, 0x13, 0x47, 0xEF, 0x4C, 0x1F, 0x54, 0x0B,
+  0x40, 0x23, 0x43, 0xF3, 0x50, 0x0F, 0x54, 0x13, 0x60, 0x23, 0x01, 0x3F,
+  0xC1, 0x6F, 0xDF, 0x00, 0xBD, 0x2B, 0xF7, 0x43, 0xDB, 0x43, 0xD3, 0x43,
+  0xDB, 0x44, 0x07, 0x48, 0x13, 0x47, 0xEF, 0x4C, 0x1F, 0x48, 0x23, 0x40,
+  0x23, 0x40, 0x1F, 0x02, 0xA1, 0x44, 0xCD, 0x64, 0x13, 0x40, 0x23, 0x00,
+  0xC1, 0x20, 0x7F, 0x4F, 0xDF, 0x47, 0xF7, 0x00, 0xE1, 0x20, 0x7F, 0x00,
+  0xCA, 0x23, 0xD3, 0x43, 0xDB, 0x44, 0x07, 0x00, 0xF8, 0x28, 0x13, 0x47,
+  0xEF, 0x4C, 0x1F, 0x48, 0x23, 0x40, 0x23, 0x40, 0x1F, 0x40, 0x2F, 0x44,
+  0x13, 0x40, 0x23, 0x02, 0xC1, 0x2B, 0x76, 0x20, 0x0F, 0x00, 0x7D, 0x20,
+  0x1B, 0x9F, 0xFF, 0x13, 0xF4, 0x43, 0xD3, 0x43, 0xDB, 0x00, 0xF1, 0x20,
+  0x0F, 0x48, 0x13, 0x47, 0xEF, 0x4C, 0x1F, 0x48, 0x23, 0x40, 0x23, 0x40,
+  0x1F, 0x40, 0x2F, 0x44, 0x13, 0x40, 0x23, 0x4B, 0xC3, 0x4F, 0xDF, 0x47,
+  0xF7, 0x43, 0xF7, 0x43, 0xD3, 0x43, 0xDB, 0x44, 0x07, 0x44, 0x1B, 0x47,
+  0xEB, 0x40, 0x0F, 0x44, 0x0F, 0x40, 0x23, 0x40, 0x1F, 0x40, 0x2F, 0x44,
+  0x13, 0x40, 0x23, 0x02, 0x7A, 0x7A, 0x7A, 0x21, 0x47, 0x00, 0x82, 0x67,
+  0xF7, 0x43, 0xDB, 0x43, 0xD3, 0x43, 0xDB, 0x44, 0x07, 0x44, 0x1B, 0x00,
+  0x8C, 0x27, 0xEF, 0x4C, 0x1F, 0x00, 0x94, 0x3C, 0x13, 0x01, 0x9C, 0x9C,
+  0x9F, 0xFF, 0x00, 0x10, 0x40, 0x2F, 0x44, 0x13, 0x40, 0x23, 0x00, 0xC1,
+  0x22, 0x3F, 0x4F, 0xDF, 0x47, 0xF7, 0x43, 0xDB, 0x43, 0xD3, 0x43, 0xDB,
+  0x44, 0x07, 0x48, 0x13, 0x47, 0xEF, 0x4C, 0x1F, 0x48, 0x23, 0x40, 0x23,
+  0x40, 0x1F, 0x40, 0x2F, 0x44, 0x13, 0x40, 0x23, 0x01, 0x6B, 0x3F, 0xFF,
+  0xF1, 0xFF, 0x5C, 0xFC, 0xE0, 0xFF, 0xFF, 0xFF, 0x02, 0xFB, 0xFF, 0xFF,
+  0xB4, 0xFF, 0x2D, 0xC0, 0x44, 0xC3, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x71, 0xBF, 0x00, 0x6B, 0xFF, 0xFF, 0xB3,
+  0xFF, 0x20, 0x04, 0x06, 0xDB, 0x44, 0x1A, 0xFF, 0xDF, 0x3A, 0x16, 0x60,
+  0x07, 0x02, 0xD1, 0xCD, 0xD4, 0x60, 0x07, 0x0A, 0xDF, 0x42, 0x24, 0xFF,
+  0xDB, 0x3B, 0x15, 0xFF, 0xE2, 0x4A, 0x15, 0x60, 0x0F, 0x06, 0xE3, 0x4E,
+  0x24, 0xFF, 0xD1, 0x3D, 0x16, 0x7F, 0xFF, 0x22, 0x08, 0x40, 0x2F, 0x02,
+  0xE0, 0x4B, 0x1C, 0x60, 0x07, 0x40, 0x0B, 0x0A, 0xCD, 0x3E, 0x19, 0xFF,
+  0xE7, 0x4A, 0x23, 0xFF, 0xDA, 0x38, 0x0B, 0x60, 0x1F, 0x12, 0xE7, 0x52,
+  0x29, 0xFF, 0xE7, 0x4C, 0x27, 0xFF, 0xCD, 0x34, 0x11, 0xFF, 0xE2, 0x51,
+  0x2B, 0xFF, 0xDC, 0x3F, 0x13, 0x60, 0x27, 0x40, 0x2B, 0x12, 0xD3, 0xD3,
+  0xD3, 0xFF, 0xD7, 0x3F, 0x14, 0xFF, 0xC6, 0x3E, 0x17, 0xFF, 0xDC, 0x50,
+  0x21, 0xFF, 0xDD, 0x4A, 0x1C, 0xE2, 0xFF, 0xB5, 0x3B, 0xC3, 0xF7, 0xFF,
+  0xFF, 0xB4, 0xFF, 0x1E, 0x40, 0x02, 0xB5, 0x3A, 0x15, 0x60, 0x03, 0x0A,
+  0xC0, 0x3E, 0x1C, 0xFF, 0xDE, 0xE3, 0xD9, 0xFF, 0xE3, 0x54, 0x24, 0x60,
+  0x0F, 0x06, 0xB0, 0x31, 0x16, 0xFF, 0xAE, 0x2A, 0x1D, 0x60, 0x0B, 0x0A,
+  0xAC, 0x38, 0x1A, 0xFF, 0xC1, 0x3D, 0x12, 0xFF, 0xD8, 0xD0, 0xDC, 0x63,
+  0xC7, 0x02, 0xB9, 0x3B, 0x14, 0x60, 0x17, 0x06, 0xB6, 0x3C, 0x11, 0xFF,
+  0xBB, 0x3F, 0x1F, 0x60, 0x0B, 0x02, 0xB4, 0x37, 0x0A, 0x63, 0xDF, 0x43,
+  0xE7, 0xC0, 0x53, 0x02, 0xAF, 0x36, 0x12, 0xE0, 0x00, 0x0B, 0x40, 0x13,
+  0x05, 0xCB, 0xD0, 0xD5, 0xFF, 0xD8, 0x42, 0x80, 0x0B, 0x05, 0xB9, 0x3A,
+  0x1D, 0xFF, 0xC4, 0x44, 0xFF, 0xFF, 0xBA, 0xFF, 0x8C, 0x00, 0x44, 0x03,
+  0xE3, 0xFF, 0xB8, 0xFF, 0x06, 0xBC, 0x43, 0x22, 0xFF, 0xAE, 0x30, 0x0E,
+  0xE3, 0x00, 0xBF, 0x01, 0xAB, 0x40, 0x83, 0xF7, 0x02, 0xAA, 0x38, 0x13,
+  0x63, 0xB7, 0x43, 0xBB, 0x40, 0x03, 0x47, 0xBF, 0x06, 0xD3, 0x33, 0x0C,
+  0xFF, 0xC2, 0x46, 0x1B, 0x60, 0x0F, 0x01, 0xBE, 0x46, 0x20, 0x1F, 0x10,
+  0x2D, 0x07, 0xFF, 0xBE, 0x38, 0x10, 0xFF, 0xB5, 0x33, 0x11, 0xFF, 0xD8,
+  0xE5, 0xE3, 0xFF, 0xE4, 0x56, 0x84, 0x3F, 0x40, 0x2F, 0x02, 0xAE, 0x32,
+  0x1E, 0x60, 0x07, 0x40, 0x0B, 0x06, 0xB8, 0x42, 0x0F, 0xFF, 0xD4, 0xCE,
+  0xCD, 0x27, 0xF3, 0x03, 0x1F, 0xFF, 0xBC, 0x40, 0xE0, 0x01, 0x17, 0xE2,
+  0xFF, 0xB8, 0x3F, 0xE1, 0xFF, 0xB8, 0xBF, 0x0A, 0xBA, 0xA1, 0x93, 0xFF,
+  0xBA, 0x9C, 0x8C, 0xFF, 0xB0, 0x90, 0x91, 0x63, 0xDF, 0x06, 0xB4, 0x94,
+  0x93, 0xFF, 0xB5, 0x95, 0x8D, 0x60, 0x03, 0x02, 0xB1, 0x91, 0x83, 0x60,
+  0x07, 0x0A, 0xBD, 0x9F, 0x8F, 0xFF, 0xC5, 0x8B, 0x8F, 0xFF, 0xD9, 0xE0,
+  0xE6, 0x60, 0x0F, 0x40, 0x1F, 0x06, 0xAC, 0x8F, 0x8E, 0xFF, 0xCA, 0xA7,
+  0x99, 0x60, 0x0B, 0x40, 0x0F, 0x02, 0xC2, 0xA4, 0x9B, 0x60, 0x3F, 0x40,
+  0x0B, 0x06, 0xB7, 0x93, 0x87, 0xFF, 0xBA, 0x9D, 0x90, 0x60, 0x0B, 0x01,
+  0xB1, 0x97, 0x20, 0x5B, 0x05, 0x92, 0x8B, 0xFF, 0xB9, 0x9A, 0x96, 0x60,
+  0x1F, 0x0E, 0xB0, 0x9B, 0x94, 0xFF, 0xAB, 0x85, 0x87, 0xFF, 0xB0, 0x99,
+  0x92, 0xFF, 0xB0, 0x96, 0x92, 0xE2, 0xFF, 0xB9, 0x3F, 0xE3, 0xFF, 0xB8,
+  0xFF, 0x01, 0xD2, 0x38, 0x8F, 0xFB, 0x4B, 0xB7, 0xC0, 0x03, 0x01, 0xD9,
+  0x3E, 0x8F, 0xB3, 0x47, 0xEF, 0x0A, 0xE0, 0x4A, 0x22, 0xFF, 0xDB, 0x4D,
+  0x1F, 0xFF, 0xE4, 0x42, 0x1E, 0xE0, 0x00, 0x1F, 0xC0, 0x27, 0x02, 0xD2,
+  0xD2, 0xCC, 0xE0, 0x00, 0x0B, 0x40, 0x13, 0x02, 0xDE, 0x43, 0x1D, 0x60,
+  0x07, 0x02, 0xDF, 0x3C, 0x0D, 0x60, 0x07, 0x40, 0x3F, 0x00, 0xDF, 0x30,
+  0x37, 0x40, 0x1B, 0x40, 0x03, 0x08, 0xED, 0x5D, 0x20, 0xFF, 0xC7, 0x37,
+  0x1C, 0xFF, 0xCF, 0x2C, 0x4F, 0x40, 0x0F, 0x40, 0x1F, 0xE2, 0xFF, 0xB8,
+  0x3F, 0xE1, 0xFF, 0xB8, 0xBF, 0x43, 0x87, 0x4B, 0x9F, 0x02, 0xC3, 0x4C,
+  0x26, 0x60, 0x07, 0x02, 0xAB, 0x30, 0x0C, 0x60, 0x07, 0x00, 0xB9, 0x2F,
+  0xBB, 0x43, 0x9F, 0xC0, 0x1F, 0x02, 0xB1, 0x34, 0x11, 0x60, 0x17, 0x02,
+  0xAE, 0x32, 0x08, 0x60, 0x07, 0x40, 0x33, 0x05, 0xCD, 0xDB, 0xD7, 0xFF,
+  0xE5, 0x40, 0x2B, 0xFB, 0x30, 0x43, 0x02, 0xB3, 0x3A, 0x17, 0x60, 0x07,
+  0x01, 0xAB, 0x2E, 0x80, 0x3F, 0x05, 0xC0, 0x3B, 0x19, 0xFF, 0xCF, 0xCF,
+  0x84, 0x1F, 0x04, 0xB9, 0x3E, 0x1A, 0xFF, 0xBB, 0x34, 0x4B, 0x40, 0x27,
+  0x40, 0x03, 0x06, 0xAC, 0x2B, 0x13, 0xFF, 0xB9, 0x47, 0x22, 0x60, 0x5F,
+  0xE2, 0xFF, 0xB8, 0x3F, 0xE1, 0xFF, 0xB8, 0xBF, 0x43, 0xDF, 0x0A, 0xA8,
+  0x2D, 0x00, 0xFF, 0xBA, 0x41, 0x1F, 0xFF, 0xB2, 0x32, 0x07, 0x63, 0x9F,
+  0x02, 0xB1, 0x29, 0x0F, 0x60, 0x07, 0x11, 0xD1, 0xE2, 0xDF, 0xFF, 0xDD,
+  0x4F, 0x1F, 0xFF, 0xAC, 0x34, 0x0C, 0xFF, 0xB8, 0x40, 0x1A, 0xFF, 0xAF,
+  0x38, 0x83, 0xBF, 0x43, 0xC3, 0x40, 0x03, 0x0A, 0xD6, 0xD1, 0xD3, 0xFF,
+  0xDD, 0x48, 0x14, 0xFF, 0xBB, 0x34, 0x18, 0x60, 0x0F, 0x40, 0x13, 0xE0,
+  0x03, 0x03, 0x02, 0xD3, 0xCE, 0xD2, 0x60, 0x5F, 0x06, 0xB0, 0x3E, 0x12,
+  0xFF, 0xC4, 0x3C, 0x19, 0x60, 0x1B, 0x0E, 0xB2, 0x36, 0x19, 0xFF, 0xC6,
+  0x47, 0x1D, 0xFF, 0xB2, 0x2C, 0x0D, 0xFF, 0xCF, 0xD7, 0xCE, 0xE2, 0xFF,
+  0xB9, 0x3F, 0xE3, 0xFF, 0xB8, 0xFF, 0x4F, 0xAF, 0xC0, 0x03, 0x00, 0xAC,
+  0x2F, 0xF7, 0x06, 0xB2, 0x93, 0x90, 0xFF, 0xC3, 0x9B, 0x91, 0x60, 0x13,
+  0x47, 0xFF, 0xC0, 0x1B, 0x01, 0xB5, 0x89, 0x20, 0x03, 0x20, 0x1F, 0xC0,
+  0x03, 0x02, 0xB8, 0x95, 0x86, 0x60, 0x1F, 0x01, 0xB7, 0xA3, 0x8F, 0xE7,
+  0x02, 0xB9, 0x91, 0x8A, 0x60, 0x1B, 0x05, 0xB6, 0x97, 0x8D, 0xFF, 0xA9,
+  0x93, 0x80, 0x0B, 0x09, 0xCA, 0xCD, 0xD3, 0xFF, 0xBA, 0xA2, 0x8D, 0xFF,
+  0xB3, 0x92, 0x90, 0x53, 0x06, 0xB9, 0x95, 0x98, 0xFF, 0xB3, 0x9B, 0x92,
+  0x60, 0x27, 0x40, 0x47, 0x02, 0xCA, 0xCE, 0xD1, 0xE2, 0xFF, 0xB9, 0x3F,
+  0xE3, 0xFF, 0xB8, 0xFF, 0x01, 0xE1, 0x44, 0xEF, 0x01, 0xD7, 0x43, 0xEF,
+  0x02, 0xDC, 0x42, 0x14, 0x67, 0xB3, 0x09, 0xDC, 0x49, 0x1F, 0xFF, 0xF0,
+  0x58, 0x22, 0xFF, 0xE0, 0x44, 0x2F, 0xFF, 0x00, 0x44, 0xEF, 0x01, 0xAF,
+  0xC0, 0x0B, 0x06, 0xEB, 0x57, 0x13, 0xFF, 0xC8, 0x35, 0x04, 0x80, 0x0F,
+  0x05, 0x4F, 0x15, 0xFF, 0xE2, 0x4C, 0x14, 0x60, 0x3F, 0xC0, 0x1F, 0x05,
+  0xE1, 0x42, 0x16, 0xFF, 0xEB, 0x45, 0xFF, 0x01, 0xFF, 0x00, 0x28, 0x40,
+  0x17, 0x02, 0xDD, 0xDB, 0xD6, 0x60, 0x07, 0x02, 0xE7, 0x54, 0x20, 0x60,
+  0x07, 0x40, 0x13, 0xE2, 0xFF, 0xB8, 0x3F, 0xE1, 0xFF, 0xB8, 0xBF, 0xEB,
+  0x03, 0xAF, 0x00, 0xCA, 0x2B, 0xCF, 0x02, 0xE0, 0x3A, 0x22, 0x60, 0x13,
+  0x01, 0xB3, 0x3B, 0x8B, 0xD3, 0x05, 0xBB, 0x41, 0x18, 0xFF, 0xB8, 0x47,
+  0x3F, 0xE7, 0x05, 0x35, 0x16, 0xFF, 0xD1, 0xCC, 0xCF, 0x63, 0xB3, 0x02,
+  0xBD, 0x3F, 0x20, 0x60, 0x23, 0xC0, 0x3B, 0x05, 0xC1, 0x47, 0x1A, 0xFF,
+  0xB1, 0x27, 0x84, 0x3F, 0x0A, 0xE5, 0x4B, 0x23, 0xFF, 0xB0, 0x30, 0x14,
+  0xFF, 0xBC, 0x3E, 0x16, 0xE0, 0x00, 0x1F, 0xC0, 0x27, 0x04, 0xCD, 0xC7,
+  0xD3, 0xFF, 0xDE, 0xBF, 0xFF, 0x00, 0x30, 0x01, 0xB2, 0x3B, 0x80, 0x17,
+  0xE2, 0xFF, 0xB8, 0x3F, 0xE1, 0xFF, 0xB8, 0xBF, 0x01, 0xB3, 0x47, 0xBF,
+  0xCB, 0x2F, 0xDF, 0x02, 0xDA, 0xE0, 0xE0, 0x63, 0xDF, 0x43, 0xAF, 0x01,
+  0xB2, 0x1F, 0x93, 0xCF, 0x06, 0xB7, 0x2C, 0x09, 0xFF, 0xB4, 0x3F, 0x21,
+  0x60, 0x13, 0x02, 0xCC, 0xD3, 0xD5, 0xE0, 0x00, 0x1F, 0x01, 0xB7, 0x42,
+  0x80, 0x27, 0x40, 0x2B, 0x40, 0x03, 0x06, 0xB0, 0x35, 0x0C, 0xFF, 0xE7,
+  0xE2, 0xDB, 0x60, 0x1F, 0x0D, 0xAD, 0x38, 0x0F, 0xFF, 0xAE, 0x41, 0x17,
+  0xFF, 0xB9, 0x45, 0x13, 0xFF, 0xC9, 0x57, 0x9F, 0xFF, 0x00, 0x4C, 0x05,
+  0xC0, 0x4C, 0x13, 0xFF, 0xCC, 0xC9, 0x90, 0x0F, 0x40, 0x2F, 0xC0, 0x03,
+  0xE2, 0xFF, 0xB8, 0x3F, 0xE1, 0xFF, 0xB8, 0xBF, 0x4F, 0x87, 0x40, 0x03,
+  0x02, 0xA7, 0x87, 0x8A, 0x6B, 0xBF, 0x40, 0x0B, 0xE0, 0x0B, 0x03, 0x19,
+  0xAF, 0x92, 0x94, 0xFF, 0xD3, 0xD7, 0xDA, 0xFF, 0xBC, 0x90, 0x8A, 0xFF,
+  0xBB, 0xA0, 0x98, 0xFF, 0xAA, 0x94, 0x85, 0xFF, 0xAC, 0x99, 0x86, 0xFF,
+  0xB8, 0x9C, 0x8F, 0xEB, 0x40, 0x33, 0x0E, 0xC7, 0xC9, 0xC9, 0xFF, 0xB7,
+  0x97, 0x87, 0xFF, 0xB2, 0x9D, 0x88, 0xFF, 0xBB, 0x8A, 0x8E, 0x60, 0x13,
+  0x01, 0xBB, 0x9C, 0x80, 0x07, 0x06, 0xB2, 0x85, 0x7B, 0xFF, 0xCE, 0xD2,
+  0xD5, 0x60, 0x13, 0x40, 0x2B, 0x06, 0xB2, 0x97, 0x84, 0xFF, 0xAD, 0x91,
+  0x86, 0xE2, 0xFF, 0xB9, 0x3F, 0xE3, 0xFF, 0xB8, 0xFF, 0x0A, 0xCC, 0x4E,
+  0x19, 0xFF, 0xDA, 0x46, 0x21, 0xFF, 0xE3, 0x4E, 0x21, 0x67, 0xBB, 0x4F,
+  0x93, 0x40, 0x03, 0x0E, 0xD1, 0x42, 0x12, 0xFF, 0xC9, 0xCD, 0xD1, 0xFF,
+  0xDB, 0x40, 0x0C, 0xFF, 0xDF, 0x59, 0x23, 0x60, 0x13, 0x40, 0x17, 0x00,
+  0xDA, 0x38, 0x27, 0x40, 0x07, 0x06, 0xDF, 0x44, 0x1C, 0xFF, 0xE0, 0xE2,
+  0xE2, 0x60, 0x0B, 0x01, 0xDE, 0x3F, 0x80, 0x1F, 0x0E, 0xD4, 0x39, 0x1E,
+  0xFF, 0xE0, 0x4D, 0x27, 0xFF, 0xD9, 0x44, 0x11, 0xFF, 0xDC, 0x52, 0x15,
+  0x64, 0x4F, 0x06, 0xDC, 0x44, 0x14, 0xFF, 0xDE, 0x45, 0x15, 0x60, 0x27,
+  0x40, 0x37, 0x40, 0x03, 0x04, 0xE3, 0x44, 0x12, 0xFF, 0xE8, 0x28, 0x77,
+  0x02, 0xDC, 0xE7, 0xD8, 0xE2, 0xFF, 0xB9, 0x3F, 0xE3, 0xFF, 0xB8, 0xFF,
+  0x43, 0x8F, 0x4B, 0x8B, 0x05, 0xAB, 0x3B, 0x1F, 0xFF, 0xB0, 0x3C, 0xEB,
+  0x01, 0x97, 0x06, 0xAC, 0x2E, 0x15, 0xFF, 0xC6, 0xCF, 0xCE, 0x60, 0x1F,
+  0x01, 0xBF, 0x33, 0xE0, 0x01, 0x17, 0x40, 0x2B, 0x01, 0xB6, 0x3B, 0x3F,
+  0xBF, 0x01, 0x3B, 0x1B, 0x63, 0xDF, 0x11, 0xE0, 0x53, 0x21, 0xFF, 0xB1,
+  0x39, 0x18, 0xFF, 0xB7, 0x30, 0x0D, 0xFF, 0xB3, 0x3D, 0x11, 0xFF, 0xA0,
+  0x35, 0x9F, 0xFF, 0x10, 0x1C, 0x40, 0x27, 0x54, 0x4F, 0x01, 0xDF, 0x4D,
+  0x8C, 0x47, 0x40, 0x0F, 0xE0, 0x03, 0x03, 0x01, 0xCD, 0x3C, 0x80, 0x3F,
+  0xE2, 0xFF, 0xB8, 0x3F, 0xE1, 0xFF, 0xB8, 0xBF, 0x43, 0xFF, 0x04, 0xA8,
+  0x21, 0x00, 0xFF, 0xBB, 0x27, 0xC3, 0xE3, 0x03, 0x9F, 0x40, 0x0B, 0x01,
+  0xD3, 0xD5, 0x97, 0xAF, 0x40, 0x0B, 0xC0, 0x03, 0x02, 0xB8, 0x3B, 0x29,
+  0x60, 0x0B, 0x00, 0xB1, 0x2F, 0xDF, 0x43, 0xDF, 0x40, 0x3F, 0x0D, 0xB2,
+  0x3E, 0x19, 0xFF, 0xB7, 0x39, 0x0C, 0xFF, 0xC3, 0x43, 0x19, 0xFF, 0xBF,
+  0x3C, 0x94, 0x37, 0x40, 0x2F, 0xC0, 0x1F, 0x40, 0x0B, 0x01, 0xB5, 0x40,
+  0x9F, 0xFF, 0x14, 0x28, 0x01, 0xAF, 0x2A, 0x9F, 0xFF, 0x00, 0x5C, 0x01,
+  0xB0, 0x3C, 0x28, 0x23, 0x01, 0xDC, 0xD7, 0xE2, 0xFF, 0xB9, 0x3F, 0xE3,
+  0xFF, 0xB8, 0xFF, 0x4F, 0x8B, 0x02, 0xB7, 0x93, 0x83, 0x2F, 0xFF, 0x04,
+  0x7E, 0xFF, 0xB7, 0x9A, 0x97, 0x60, 0x0F, 0x02, 0xB2, 0x9C, 0x98, 0x60,
+  0x07, 0x06, 0xD3, 0xD3, 0xD3, 0xFF, 0xBC, 0xA2, 0x87, 0x60, 0x0B, 0x02,
+  0xAF, 0x8E, 0x8C, 0x60, 0x07, 0x01, 0xBE, 0x9C, 0x9F, 0xEF, 0x40, 0x37,
+  0x02, 0xC0, 0xC9, 0xCB, 0x60, 0x07, 0x40, 0x0B, 0xE0, 0x0B, 0x03, 0x40,
+  0x3F, 0x02, 0xB5, 0x95, 0x8B, 0x20, 0x03, 0x80, 0x1F, 0x01, 0xAE, 0x8C,
+  0xE0, 0x01, 0x0B, 0x40, 0x13, 0x40, 0x1F, 0xE2, 0xFF, 0xB8, 0x3F, 0x41,
+  0xBF, 0xE0, 0xFF, 0xB4, 0x03, 0x47, 0xBF, 0x40, 0x03, 0x02, 0xD8, 0x40,
+  0x12, 0x63, 0x8F, 0x40, 0x0B, 0x40, 0x03, 0x02, 0xD8, 0x4C, 0x16, 0x60,
+  0x07, 0x40, 0x0B, 0x40, 0x03, 0x02, 0xE4, 0x48, 0x1E, 0x60, 0x1F, 0x06,
+  0xD0, 0x39, 0x15, 0xFF, 0xE1, 0x40, 0x18, 0x60, 0x13, 0x01, 0xEB, 0x3C,
+  0x9F, 0xFF, 0x0F, 0xF0, 0x06, 0xD7, 0x3E, 0x18, 0xFF, 0xE5, 0x46, 0x23,
+  0x60, 0x1F, 0x40, 0x2B, 0x02, 0xDE, 0x4B, 0x25, 0x60, 0x07, 0x02, 0xD3,
+  0x47, 0x08, 0x60, 0x07, 0x40, 0x13, 0x40, 0x03, 0x43, 0xEF, 0x40, 0x07,
+  0x01, 0xD8, 0x48, 0x80, 0x3F, 0x40, 0x0B, 0xE2, 0xFF, 0xB4, 0x3B, 0xC1,
+  0xBB, 0xFF, 0xFF, 0xB8, 0xFF, 0x1C, 0x00, 0x6B, 0x9F, 0x00, 0x3A, 0xEB,
+  0x01, 0xAF, 0x02, 0x9E, 0x32, 0x05, 0x60, 0x0F, 0x40, 0x13, 0x40, 0x03,
+  0x01, 0xB4, 0x40, 0x3B, 0xEF, 0x05, 0x35, 0x18, 0xFF, 0xC6, 0xC6, 0xD0,
+  0x63, 0xB3, 0x60, 0x13, 0x08, 0x37, 0x13, 0xFF, 0xB2, 0x38, 0x1C, 0xFF,
+  0xB5, 0x3D, 0x9F, 0xFF, 0x1B, 0xCC, 0x01, 0xB9, 0x42, 0xEC, 0x01, 0x0F,
+  0x01, 0xBA, 0x2F, 0x9F, 0xFF, 0x1F, 0xF8, 0x02, 0xAC, 0x3B, 0x10, 0x60,
+  0x2B, 0x01, 0xB0, 0x32, 0x3C, 0x4F, 0x01, 0x38, 0x09, 0xE3, 0x00, 0xFF,
+  0x05, 0xA5, 0x2B, 0x00, 0xFF, 0xBD, 0x3E, 0x9C, 0x17, 0x42, 0x43, 0xE2,
+  0xFF, 0xB4, 0x3F, 0xE1, 0xFF, 0xB8, 0xBF, 0x01, 0xBA, 0x3A, 0x83, 0xA3,
+  0x43, 0xD3, 0x47, 0x9F, 0x05, 0xD6, 0x47, 0x18, 0xFF, 0xAF, 0x32, 0x80,
+  0x13, 0x05, 0xB3, 0x3C, 0x17, 0xFF, 0xAA, 0x2B, 0x9F, 0xFF, 0x0F, 0xB8,
+  0x0A, 0xB1, 0x35, 0x10, 0xFF, 0xC7, 0xC5, 0xC4, 0xFF, 0xE0, 0x43, 0x2A,
+  0x60, 0x2B, 0x01, 0xAE, 0x39, 0x80, 0x17, 0x02, 0xB3, 0x3A, 0x13, 0x60,
+  0x0F, 0xC0, 0x3F, 0x04, 0xDA, 0x48, 0x15, 0xFF, 0xCA, 0x38, 0x1B, 0x09,
+  0xAB, 0x30, 0x0E, 0xFF, 0xAA, 0x38, 0x0E, 0xFF, 0xAC, 0x37, 0xFF, 0x01,
+  0xFF, 0x14, 0x30, 0x40, 0x5F, 0x00, 0xD1, 0x28, 0x3B, 0x40, 0x2B, 0x40,
+  0x03, 0x02, 0xCF, 0x44, 0x22, 0xE2, 0xFF, 0xB9, 0x3F, 0xE3, 0xFF, 0xB8,
+  0xFF, 0x4F, 0x87, 0xC0, 0x03, 0x02, 0xE2, 0xDD, 0xDD, 0xE0, 0x00, 0x0B,
+  0x01, 0xB4, 0xA3, 0xFF, 0x01, 0xD7, 0x40, 0x1F, 0x01, 0xB1, 0x8D, 0x9F,
+  0xFF, 0x0F, 0xF0, 0x40, 0x0B, 0x40, 0x03, 0x06, 0xA8, 0x82, 0x78, 0xFF,
+  0xC5, 0xA5, 0x8C, 0x3F, 0xEF, 0x0C, 0x8A, 0xFF, 0xBC, 0x9E, 0x8A, 0xFF,
+  0xB9, 0x93, 0x88, 0xFF, 0xD7, 0xD2, 0xC1, 0x60, 0x1B, 0x02, 0xA7, 0x90,
+  0x8E, 0x60, 0x07, 0x12, 0xB4, 0x9E, 0x8C, 0xFF, 0xB2, 0x9F, 0x94, 0xFF,
+  0xB9, 0x97, 0x88, 0xFF, 0xB3, 0x94, 0x8D, 0xFF, 0xC5, 0xCB, 0xCC, 0x60,
+  0x17, 0x40, 0x3F, 0x01, 0xB7, 0x90, 0x80, 0x07, 0xE2, 0xFF, 0xB8, 0x3F,
+  0xE1, 0xFF, 0xB8, 0xBF, 0x02, 0xD8, 0x47, 0x19, 0x6B, 0xD3, 0x4F, 0x8B,
+  0xC0, 0x03, 0x02, 0xD9, 0x3E, 0x0F, 0x60, 0x0B, 0x10, 0xCB, 0xDC, 0xCB,
+  0xFF, 0xD8, 0x4A, 0x28, 0xFF, 0xE3, 0x4E, 0x17, 0xFF, 0xD7, 0x49, 0x12,
+  0xFF, 0xCB, 0xBF, 0xFF, 0x10, 0x1C, 0x0A, 0xE0, 0x4A, 0x26, 0xFF, 0xCF,
+  0x3D, 0x15, 0xFF, 0xD1, 0xCE, 0xD1, 0x60, 0x27, 0x40, 0x37, 0x06, 0xCE,
+  0x3C, 0x14, 0xFF, 0xD1, 0x49, 0x10, 0x60, 0x0B, 0x40, 0x0F, 0x02, 0xDA,
+  0x41, 0x10, 0x67, 0xEF, 0x40, 0x0B, 0xE0, 0x07, 0x03, 0x05, 0xD7, 0x3C,
+  0x10, 0xFF, 0xCF, 0x3F, 0x9F, 0xFF, 0x30, 0x50, 0xE2, 0xFF, 0xB8, 0x3F,
+  0xE1, 0xFF, 0xB8, 0xBF, 0x01, 0xD8, 0x40, 0x9F, 0xFF, 0x0F, 0xCC, 0x08,
+  0xAF, 0x2F, 0x0E, 0xFF, 0xBC, 0x36, 0x18, 0xFF, 0xB8, 0x3F, 0xCB, 0x4B,
+  0x9B, 0x00, 0xB6, 0x2F, 0xC3, 0x08, 0xDE, 0xE7, 0xD3, 0xFF, 0xF3, 0x55,
+  0x1E, 0xFF, 0xAB, 0x23, 0xF7, 0x40, 0x13, 0x02, 0xA5, 0x3D, 0x06, 0x60,
+  0x07, 0x40, 0x0B, 0x01, 0xA9, 0x2D, 0xFF, 0x01, 0xFF, 0x2C, 0x30, 0x05,
+  0xA6, 0x2A, 0x0C, 0xFF, 0xAC, 0x3F, 0x80, 0x37, 0x01, 0xBC, 0x47, 0x90,
+  0x1F, 0x02, 0xAC, 0x2F, 0x0C, 0x63, 0xFF, 0x05, 0xD6, 0x40, 0x16, 0xFF,
+  0xBE, 0x3F, 0x20, 0x17, 0x04, 0x39, 0x20, 0xFF, 0xAC, 0x36, 0x8C, 0x57,
+  0x40, 0x3F, 0x40, 0x03, 0x02, 0xDE, 0xCB, 0xD6, 0xE2, 0xFF, 0xB9, 0x3F,
+  0xE3, 0xFF, 0xB8, 0xFF, 0x02, 0xEC, 0x47, 0x27, 0x63, 0x8B, 0x01, 0xA7,
+  0x21, 0x83, 0xB7, 0x43, 0x97, 0x40, 0x03, 0x01, 0xBD, 0x42, 0x9F, 0xFF,
+  0x03, 0xA0, 0x0D, 0xE2, 0x49, 0x22, 0xFF, 0xB2, 0x37, 0x18, 0xFF, 0xB4,
+  0x3A, 0x14, 0xFF, 0xB0, 0x42, 0xB3, 0xD7, 0x0B, 0x28, 0x17, 0xFF, 0xB5,
+  0x4A, 0x20, 0xFF, 0xC9, 0xD3, 0xD4, 0xFF, 0xD8, 0x30, 0x3F, 0x01, 0xB6,
+  0x34, 0x90, 0x03, 0x01, 0xC4, 0x5C, 0x93, 0xD3, 0x40, 0x3F, 0x40, 0x03,
+  0x4F, 0xEF, 0x47, 0xFB, 0x40, 0x0B, 0x40, 0x03, 0x00, 0xBB, 0x27, 0xF3,
+  0x40, 0x07, 0x40, 0x03, 0x02, 0xBA, 0x40, 0x28, 0x60, 0x1F, 0xE2, 0xFF,
+  0xB8, 0x3F, 0xE1, 0xFF, 0xB8, 0xBF, 0x06, 0xB7, 0x98, 0x92, 0xFF, 0xC2,
+  0xAC, 0x9E, 0x6F, 0x93, 0x05, 0xB8, 0xAC, 0x85, 0xFF, 0xBE, 0x9A, 0xBF,
+  0xFF, 0x1F, 0xAC, 0x01, 0x98, 0x98, 0x63, 0x9F, 0x4F, 0xAB, 0xE0, 0x07,
+  0x03, 0x06, 0xAF, 0x90, 0x8C, 0xFF, 0xB0, 0x8D, 0x87, 0xE0, 0x00, 0x1F,
+  0x02, 0xB9, 0xA2, 0x9D, 0xE0, 0x08, 0x23, 0x09, 0xB2, 0x92, 0x8B, 0xFF,
+  0xCD, 0xCA, 0xD7, 0xFF, 0xB7, 0xA0, 0x9F, 0xFF, 0x00, 0x4C, 0x40, 0x43,
+  0x01, 0xAE, 0x99, 0xF0, 0x05, 0x53, 0x44, 0x1F, 0xE2, 0xFF, 0xB8, 0x3F,
+  0xE1, 0xFF, 0xB8, 0xBF, 0x00, 0xDD, 0x2B, 0x97, 0x47, 0xA3, 0x00, 0xD4,
+  0x2F, 0xCF, 0x43, 0x8F, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0x05, 0xE1, 0x47,
+  0x1C, 0xFF, 0xD9, 0x4A, 0x90, 0x23, 0x02, 0xD7, 0xE2, 0xDD, 0xE0, 0x00,
+  0x1B, 0x06, 0xE3, 0x50, 0x27, 0xFF, 0xD3, 0x3B, 0x0D, 0xE0, 0x00, 0x0F,
+  0x06, 0xD5, 0x3D, 0x14, 0xFF, 0xCD, 0xC3, 0xD0, 0xE0, 0x00, 0x0F, 0xC0,
+  0x43, 0x02, 0xDA, 0x48, 0x12, 0xE0, 0x00, 0x0B, 0xE0, 0x0B, 0x5F, 0xE2,
+  0xFF, 0xB8, 0x3F, 0xE1, 0xFF, 0xB8, 0xBF, 0x4B, 0x8B, 0x01, 0xAA, 0x41,
+  0x9F, 0xFF, 0x1C, 0x04, 0xC3, 0x9F, 0x40, 0x13, 0xE0, 0x0B, 0x03, 0xE0,
+  0x03, 0x1F, 0x01, 0xAD, 0x31, 0x9B, 0xFF, 0xC0, 0x27, 0x06, 0xAA, 0x30,
+  0x0C, 0xFF, 0xCA, 0xBF, 0xD4, 0x63, 0xEB, 0xE0, 0x00, 0x13, 0x04, 0x3B,
+  0x0F, 0xFF, 0xAE, 0x40, 0x9F, 0xFF, 0x30, 0x38, 0x05, 0xB8, 0x42, 0x19,
+  0xFF, 0xCB, 0xD9, 0x84, 0x1F, 0x01, 0xB8, 0x31, 0x20, 0x13, 0x05, 0x3D,
+  0x16, 0xFF, 0xB3, 0x35, 0x1E, 0xE2, 0xFF, 0xB9, 0x3F, 0xE3, 0xFF, 0xBC,
+  0xFF, 0xC3, 0xAF, 0xE3, 0x03, 0xDF, 0xC0, 0x13, 0x40, 0x07, 0x06, 0xBB,
+  0x57, 0x22, 0xFF, 0xB7, 0x3E, 0x1D, 0x60, 0x1F, 0x09, 0xD8, 0x3F, 0x1F,
+  0xFF, 0xC1, 0x48, 0x1C, 0xFF, 0xB8, 0x34, 0xEF, 0x01, 0xCB, 0x01, 0xB6,
+  0x3C, 0x8F, 0xF7, 0xC0, 0x3F, 0x01, 0xAF, 0x38, 0x23, 0xDF, 0x00, 0x3A,
+  0x80, 0x3B, 0xE0, 0x03, 0x07, 0x40, 0x1F, 0x09, 0xDE, 0x4E, 0x18, 0xFF,
+  0xB7, 0x48, 0x0F, 0xFF, 0xC1, 0x33, 0x80, 0x3F, 0xE2, 0xFF, 0xB8, 0x3F,
+  0xE1, 0xFF, 0xB8, 0xBF, 0x4F, 0x97, 0x02, 0xBA, 0xA6, 0x96, 0x60, 0x07,
+  0x05, 0xC4, 0xC8, 0xC4, 0xFF, 0xB6, 0x9D, 0xBF, 0xFF, 0x0F, 0xA4, 0x00,
+  0x8F, 0x9F, 0xFF, 0x0F, 0xF8, 0x40, 0x1F, 0x01, 0xB4, 0x9A, 0x80, 0x07,
+  0x43, 0xBF, 0x15, 0xB8, 0x97, 0x96, 0xFF, 0xC6, 0xA1, 0x96, 0xFF, 0xB4,
+  0x97, 0x8B, 0xFF, 0xB4, 0x8C, 0x89, 0xFF, 0xBC, 0x9C, 0x91, 0xFF, 0xB3,
+  0x90, 0x9F, 0xFF, 0x30, 0x30, 0x02, 0xD4, 0xCC, 0xD0, 0x60, 0x2F, 0x40,
+  0x33, 0xC0, 0x03, 0x06, 0xC1, 0x98, 0x94, 0xFF, 0xB8, 0x94, 0x81, 0x60,
+  0x0F, 0x40, 0x3F, 0x40, 0x17, 0x02, 0xC6, 0xA7, 0x9F, 0x60, 0x07, 0x40,
+  0x0B, 0xE2, 0xFF, 0xB8, 0x3F, 0xE1, 0xFF, 0xB8, 0xBF, 0x06, 0xEE, 0x4D,
+  0x1E, 0xFF, 0xE0, 0x41, 0x1C, 0x6B, 0xB7, 0x01, 0xD7, 0x45, 0x9F, 0xFF,
+  0x2F, 0xFC, 0x4F, 0xBB, 0x01, 0xDA, 0x3D, 0x97, 0xFF, 0x40, 0x0B, 0x01,
+  0xC8, 0x39, 0xE0, 0x02, 0x17, 0x01, 0x33, 0x11, 0x60, 0x13, 0x40, 0x17,
+  0x43, 0xCF, 0x40, 0x07, 0xC0, 0x03, 0x0A, 0xDA, 0x3A, 0x11, 0xFF, 0xD4,
+  0x43, 0x13, 0xFF, 0xD2, 0x33, 0x0E, 0x60, 0x13, 0x05, 0xD6, 0xCE, 0xDB,
+  0xFF, 0xE9, 0x58, 0xFF, 0x01, 0xFF, 0x30, 0x40, 0xC0, 0x27, 0xC0, 0x07,
+  0x40, 0x3F, 0xE2, 0xFF, 0xB8, 0x3F, 0xE1, 0xFF, 0xB8, 0xBF, 0x01, 0xD7,
+  0x43, 0x8B, 0x87, 0x02, 0xB8, 0x3C, 0x0D, 0x3F, 0xB3, 0x00, 0x0B, 0xEB,
+  0x04, 0xAF, 0x05, 0xE3, 0xDA, 0xD7, 0xFF, 0xD0, 0x3A, 0xEF, 0x01, 0xE7,
+  0x01, 0xBB, 0x44, 0xE0, 0x01, 0x0B, 0x4B, 0xD7, 0x09, 0xC2, 0xC0, 0xC5,
+  0xFF, 0xD3, 0x46, 0x14, 0xFF, 0xA0, 0x2D, 0x9F, 0xFF, 0x1B, 0xD4, 0x00,
+  0xB5, 0xAB, 0xF7, 0x05, 0xB1, 0x31, 0x16, 0xFF, 0xB0, 0x3F, 0x9F, 0xFF,
+  0x10, 0x10, 0x01, 0xD2, 0x47, 0x90, 0x5B, 0x40, 0x2F, 0x00, 0xC1, 0x30,
+  0x03, 0x40, 0x07, 0xC0, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0x7E, 0xFF, 0x47,
+  0x8B, 0xC3, 0x8F, 0x40, 0x07, 0x01, 0xAB, 0x2F, 0x9F, 0xFF, 0x03, 0xA4,
+  0x09, 0xC0, 0x4F, 0x1D, 0xFF, 0xC9, 0xCB, 0xD4, 0xFF, 0xE4, 0x4B, 0x9F,
+  0xFF, 0x1F, 0xB8, 0x40, 0x1B, 0xE0, 0x03, 0x03, 0x05, 0xBD, 0x4A, 0x16,
+  0xFF, 0xCA, 0xCB, 0x9F, 0xFF, 0x08, 0x00, 0x02, 0xBA, 0x36, 0x0D, 0x60,
+  0x1B, 0x04, 0xB0, 0x3C, 0x14, 0xFF, 0xBD, 0xFF, 0x02, 0xFF, 0x24, 0x44,
+  0x06, 0xD5, 0xC5, 0xCA, 0xFF, 0xC8, 0x3A, 0x09, 0x60, 0x1B, 0x04, 0xBC,
+  0x3C, 0x18, 0xFF, 0xB0, 0xBF, 0xFF, 0x04, 0x5C, 0x01, 0xB9, 0x39, 0x80,
+  0x4B, 0x02, 0xD4, 0xD0, 0xD9, 0xE6, 0xFF, 0xB9, 0x3F, 0xE7, 0xFF, 0xB8,
+  0xFF, 0x09, 0xA4, 0x86, 0x80, 0xFF, 0xC7, 0x97, 0x86, 0xFF, 0xA5, 0x81,
+  0x8F, 0xA3, 0x01, 0xBC, 0x97, 0x9F, 0xFF, 0x00, 0x00, 0x4F, 0x9B, 0x47,
+  0x9F, 0xFF, 0x07, 0xFF, 0x10, 0x08, 0x01, 0xBA, 0x9F, 0xF0, 0x01, 0x17,
+  0x12, 0xD1, 0xE7, 0xDC, 0xFF, 0xBB, 0x97, 0x87, 0xFF, 0xBE, 0x95, 0x91,
+  0xFF, 0xBC, 0x9A, 0x91, 0xFF, 0xA8, 0x7F, 0x8F, 0x60, 0x37, 0x40, 0x3B,
+  0x06, 0xA2, 0x7D, 0x81, 0xFF, 0xC6, 0xCB, 0xCD, 0x60, 0x0B, 0x11, 0xB1,
+  0x90, 0x8A, 0xFF, 0xC0, 0xA1, 0x93, 0xFF, 0xAB, 0x94, 0x93, 0xFF, 0xB6,
+  0x93, 0x88, 0xFF, 0xB1, 0x95, 0x9F, 0xFF, 0x10, 0x20, 0x01, 0xD4, 0xCF,
+  0xEB, 0xFF, 0xBE, 0xFF, 0x44, 0x03, 0xE0, 0xFF, 0xD0, 0x03, 0x1F, 0x7C,
+  0x44, 0x57, 0xFF, 0x80, 0x47, 0x58, 0xFF, 0x80, 0x46, 0x57, 0xFF, 0x83,
+  0x48, 0x58, 0xFF, 0x88, 0x4A, 0x58, 0xFF, 0x8A, 0x4B, 0x57, 0xFF, 0x8C,
+  0x4D, 0x58, 0xFF, 0x8E, 0x4F, 0x5A, 0xFF, 0x0A, 0x90, 0x50, 0x5B, 0xFF,
+  0x91, 0x50, 0x5A, 0xFF, 0x91, 0x4F, 0x59, 0x60, 0x03, 0x01, 0x92, 0x50,
+  0xA0, 0x03, 0x03, 0x4F, 0x58, 0xFF, 0x94, 0x20, 0x17, 0xE2, 0xFF, 0xD0,
+  0x17, 0xE1, 0x03, 0xD7, 0xFF, 0xFF, 0xD4, 0xFF, 0x1D, 0xC0, 0x08, 0xC3,
+  0x6D, 0xA8, 0xFF, 0xC6, 0x6E, 0xA9, 0xFF, 0xC6, 0x20, 0x07, 0x1A, 0xC9,
+  0x70, 0xAA, 0xFF, 0xCC, 0x71, 0xA9, 0xFF, 0xCD, 0x72, 0xA8, 0xFF, 0xCF,
+  0x73, 0xA8, 0xFF, 0xD0, 0x74, 0xA9, 0xFF, 0x8E, 0x4C, 0x59, 0xFF, 0xD1,
+  0x74, 0xA8, 0x60, 0x03, 0x00, 0xD2, 0x20, 0x07, 0x01, 0xD3, 0x75, 0xC0,
+  0x03, 0x00, 0xA9, 0x20, 0x0F, 0x00, 0xA9, 0xE2, 0x18, 0x1B, 0x42, 0x47,
+  0xE2, 0xFF, 0xD4, 0x3F, 0xE1, 0x17, 0xDB, 0xE1, 0xFF, 0x98, 0xFF, 0x06,
+  0xC6, 0x6E, 0xAA, 0xFF, 0xC8, 0x6E, 0xAB, 0x20, 0x03, 0x06, 0xAA, 0xFF,
+  0xCB, 0x6F, 0xAC, 0xFF, 0xCB, 0x24, 0x03, 0x02, 0xCB, 0x70, 0xA9, 0x20,
+  0x03, 0x02, 0xA8, 0xFF, 0xCC, 0x20, 0x03, 0x00, 0x89, 0x28, 0x13, 0x00,
+  0xCD, 0x20, 0x07, 0x01, 0xCE, 0x71, 0x24, 0x13, 0x20, 0x03, 0x00, 0xD0,
+  0x24, 0x1B, 0x04, 0xD0, 0x72, 0xA9, 0xFF, 0xCF, 0x20, 0x03, 0x00, 0xCE,
+  0x24, 0x2B, 0xE1, 0xFF, 0xB8, 0xFF, 0xE1, 0xFF, 0xF8, 0xBF, 0x01, 0xC6,
+  0x6C, 0x27, 0xFB, 0x04, 0x6B, 0xA9, 0xFF, 0xC7, 0x6B, 0x24, 0x07, 0x01,
+  0x6B, 0xAC, 0x20, 0x0F, 0x00, 0xAA, 0x20, 0x03, 0x20, 0x13, 0x00, 0x6C,
+  0x28, 0x17, 0x20, 0x03, 0x04, 0x83, 0x43, 0x57, 0xFF, 0xC8, 0x48, 0x1B,
+  0x20, 0x03, 0x00, 0xCB, 0x28, 0x27, 0x01, 0xCC, 0x6F, 0x28, 0x23, 0x01,
+  0x70, 0xAB, 0x24, 0x1F, 0x84, 0x27, 0xE2, 0xFF, 0xF8, 0x3F, 0xE1, 0xFF,
+  0xB8, 0xFF, 0x1A, 0xC1, 0x68, 0xA6, 0xFF, 0xC0, 0x66, 0xA6, 0xFF, 0xC1,
+  0x66, 0xA7, 0xFF, 0xC2, 0x66, 0xA9, 0xFF, 0xC0, 0x67, 0xA8, 0xFF, 0xBF,
+  0x68, 0xA7, 0xFF, 0xC0, 0x68, 0xA8, 0x60, 0x03, 0x02, 0x7E, 0x40, 0x58,
+  0x20, 0x23, 0x20, 0x1B, 0x20, 0x03, 0x01, 0xC4, 0x69, 0x24, 0x13, 0x03,
+  0x6B, 0xA8, 0xFF, 0xC7, 0x24, 0x1F, 0x00, 0xC8, 0x24, 0x0B, 0x00, 0xC7,
+  0x24, 0x1F, 0xE1, 0xFF, 0xB8, 0xFF, 0xE1, 0xFF, 0xF8, 0xBF, 0x08, 0xBD,
+  0x66, 0xA5, 0xFF, 0xBD, 0x67, 0xA6, 0xFF, 0xBD, 0x23, 0xEF, 0x00, 0xBC,
+  0x20, 0x03, 0x02, 0xBF, 0x69, 0xA6, 0x20, 0x03, 0x00, 0xA4, 0x20, 0x03,
+  0x20, 0x07, 0x24, 0x1B, 0x05, 0x7B, 0x3F, 0x57, 0xFF, 0xBF, 0x67, 0x24,
+  0x0F, 0x00, 0x69, 0x24, 0x03, 0x20, 0x13, 0x02, 0xC4, 0x6B, 0xA6, 0x30,
+  0x2B, 0x02, 0xA6, 0xFF, 0xC8, 0x2C, 0x13, 0x02, 0xC6, 0x6E, 0xA5, 0xE2,
+  0xFF, 0xF9, 0x3F, 0xE4, 0xFF, 0xB8, 0x3F, 0x02, 0xBA, 0x67, 0xA4, 0x20,
+  0x03, 0x12, 0xA3, 0xFF, 0xB9, 0x68, 0xA3, 0xFF, 0xBA, 0x69, 0xA5, 0xFF,
+  0xBB, 0x69, 0xA1, 0xFF, 0xBC, 0x69, 0xA0, 0xFF, 0xBD, 0x20, 0x07, 0x06,
+  0xBD, 0x69, 0xA2, 0xFF, 0x7B, 0x41, 0x53, 0x24, 0x1B, 0x17, 0xA2, 0xFF,
+  0xBE, 0x69, 0xA3, 0xFF, 0xC0, 0x6C, 0xA3, 0xFF, 0xC1, 0x6E, 0xA3, 0xFF,
+  0xC2, 0x6F, 0xA3, 0xFF, 0xC6, 0x71, 0xA4, 0xFF, 0xC9, 0x73, 0xE3, 0xFF,
+  0xFF, 0xFF, 0xBC, 0xFF, 0x0D, 0xD0, 0x82, 0xB1, 0xFF, 0xD1, 0x82, 0xB0,
+  0xFF, 0xD2, 0x83, 0xAF, 0xFF, 0xD3, 0x85, 0x20, 0x03, 0x0B, 0x86, 0xAF,
+  0xFF, 0xD5, 0x87, 0xB0, 0xFF, 0xD6, 0x86, 0xB0, 0xFF, 0xD7, 0x20, 0x03,
+  0x1E, 0x97, 0x60, 0x63, 0xFF, 0xDA, 0x89, 0xB4, 0xFF, 0xD8, 0x88, 0xB2,
+  0xFF, 0xD7, 0x89, 0xB3, 0xFF, 0xD9, 0x8D, 0xB6, 0xFF, 0xDC, 0x8E, 0xB7,
+  0xFF, 0xDE, 0x8E, 0xB5, 0xFF, 0xDE, 0x8D, 0xB4, 0xE5, 0xFF, 0xB9, 0xFF,
+  0xE7, 0xFF, 0xB8, 0xBF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x79,
+  0xBF, 0x00, 0x6B, 0xFF, 0xFF, 0xB3, 0xFF, 0xA0, 0x00, 0xE1, 0xFF, 0xFF,
+  0x3D, 0xBB, 0xFF, 0x17, 0xFF, 0x02, 0x64, 0xE0, 0x13, 0x1F, 0x42, 0x7F,
+  0xE0, 0x13, 0x1F, 0xE0, 0x17, 0x1B, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF,
+  0x3F, 0x1E, 0xFC, 0xF8, 0x49, 0xFF, 0xFD, 0xFA, 0x4B, 0xFF, 0xFE, 0xFA,
+  0x52, 0xFF, 0xFF, 0xF9, 0x51, 0xFF, 0xFF, 0xFA, 0x4C, 0xFF, 0xFF, 0xFB,
+  0x4A, 0xFF, 0xF7, 0xF5, 0x45, 0xFF, 0xFE, 0xFD, 0x54, 0x20, 0x17, 0x04,
+  0x5B, 0xFF, 0xFF, 0xF8, 0x5E, 0x20, 0x13, 0x04, 0x58, 0xFF, 0xFF, 0xFD,
+  0x50, 0x20, 0x23, 0x08, 0x4D, 0xFF, 0xFA, 0xDB, 0x3F, 0xFF, 0xE2, 0xAE,
+  0x25, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0x15, 0x00, 0x0A, 0xFD, 0xFC,
+  0x48, 0xFF, 0xF9, 0xFD, 0x47, 0xFF, 0xFD, 0xF9, 0x4B, 0x23, 0xE7, 0x20,
+  0x03, 0x00, 0xF7, 0x24, 0x0F, 0x0D, 0xF6, 0x48, 0xFF, 0xE4, 0xDE, 0x34,
+  0xFF, 0xFA, 0xFA, 0x57, 0xFF, 0xFB, 0xFD, 0x58, 0x24, 0x07, 0x00, 0x56,
+  0x24, 0x17, 0x24, 0x03, 0x00, 0xF8, 0x24, 0x0B, 0x00, 0xFB, 0x44, 0x27,
+  0x04, 0x47, 0xFF, 0xFF, 0xF4, 0x44, 0xE3, 0xFF, 0xFF, 0x9E, 0xFF, 0x00,
+  0x6B, 0xFF, 0xFF, 0x17, 0xFF, 0x20, 0x00, 0x1A, 0xFD, 0xF5, 0x3D, 0xFF,
+  0xF8, 0xF3, 0x39, 0xFF, 0xF9, 0xEC, 0x3D, 0xFF, 0xFC, 0xEA, 0x3F, 0xFF,
+  0xFD, 0xE9, 0x3F, 0xFF, 0xF2, 0xDE, 0x38, 0xFF, 0xE7, 0xD9, 0x39, 0x28,
+  0x1C, 0x13, 0x62, 0xFF, 0xFD, 0xFE, 0x59, 0xFF, 0xFB, 0xFF, 0x50, 0xFF,
+  0xFA, 0xFD, 0x5E, 0xFF, 0xFA, 0xFC, 0x64, 0xFF, 0xFE, 0xFE, 0x24, 0x07,
+  0x01, 0xFD, 0x55, 0x20, 0x03, 0x00, 0x52, 0xE1, 0xFF, 0x19, 0x5B, 0xE2,
+  0xFF, 0x18, 0x7B, 0xE1, 0x5B, 0x1F, 0xFF, 0x17, 0xFF, 0x1F, 0xA4, 0xE0,
+  0x13, 0x1F, 0x40, 0x9F, 0xE0, 0x13, 0x1F, 0xE0, 0x17, 0x1B, 0xE0, 0x9B,
+  0x3F, 0x02, 0xFF, 0xFC, 0x56, 0x23, 0xE3, 0x00, 0x58, 0x20, 0x03, 0x08,
+  0x59, 0xFF, 0xFD, 0xFD, 0x5C, 0xFF, 0xFD, 0xFB, 0x5E, 0x2C, 0x0F, 0x04,
+  0x61, 0xFF, 0xFE, 0xFC, 0x69, 0x23, 0xE3, 0x00, 0x6D, 0x20, 0x07, 0x04,
+  0x66, 0xFF, 0xFA, 0xFE, 0x5B, 0x28, 0x23, 0x28, 0x0B, 0x05, 0xFF, 0x60,
+  0xFF, 0xFC, 0xFE, 0x67, 0x20, 0x03, 0x00, 0x66, 0x20, 0x2F, 0x00, 0x61,
+  0xE0, 0xBC, 0xFF, 0xE1, 0x13, 0xC3, 0xE1, 0x9B, 0xBF, 0xE0, 0xFF, 0xFF,
+  0x39, 0xBF, 0x02, 0xFD, 0xF1, 0x53, 0x2B, 0xD3, 0x00, 0x5D, 0x2B, 0xE3,
+  0x00, 0x66, 0x27, 0xDB, 0x04, 0x6A, 0xFF, 0xFF, 0xFE, 0x6E, 0x20, 0x03,
+  0x00, 0x71, 0x20, 0x03, 0x00, 0x75, 0x20, 0x1C, 0x00, 0x77, 0x20, 0x03,
+  0x00, 0x72, 0x64, 0x03, 0x02, 0xFD, 0xFC, 0x61, 0x20, 0x0B, 0x00, 0x68,
+  0x20, 0x2B, 0x00, 0x6F, 0x30, 0x13, 0x00, 0x6F, 0x20, 0x07, 0x00, 0x6B,
+  0xE2, 0x14, 0x7B, 0x42, 0x97, 0xE3, 0xFF, 0xFF, 0xDD, 0x3F, 0x42, 0xE7,
+  0xE0, 0x0F, 0x03, 0xE2, 0x9B, 0xFF, 0x02, 0xF6, 0xDB, 0x3C, 0x2B, 0xF3,
+  0x00, 0x4A, 0x2F, 0xF3, 0x00, 0x5F, 0x23, 0xD7, 0x23, 0xDF, 0x01, 0xFE,
+  0x6D, 0x28, 0x14, 0x00, 0x70, 0x23, 0xEF, 0x00, 0x6E, 0x60, 0x03, 0x01,
+  0xFF, 0xFE, 0x23, 0xEB, 0x48, 0x0B, 0x01, 0xFC, 0x67, 0x23, 0xFF, 0x00,
+  0x6C, 0x30, 0x07, 0x20, 0x0F, 0x00, 0xFA, 0x24, 0x1F, 0x01, 0xFA, 0x6E,
+  0xE0, 0x10, 0xF7, 0xC1, 0x0F, 0xE0, 0x9B, 0xFF, 0xC0, 0xAB, 0xE0, 0x0B,
+  0x07, 0xE0, 0xFF, 0xFF, 0xDD, 0xBF, 0x0A, 0xF8, 0xD3, 0x33, 0xFF, 0xFC,
+  0xDC, 0x3B, 0xFF, 0xFD, 0xEE, 0x4F, 0x24, 0x0C, 0x37, 0xE3, 0x01, 0xF9,
+  0x5A, 0x23, 0xDB, 0x04, 0x59, 0xFF, 0xFC, 0xF9, 0x57, 0x23, 0xFF, 0x20,
+  0x0F, 0x00, 0xFF, 0x2F, 0xF7, 0x01, 0xF8, 0x59, 0x24, 0x07, 0x47, 0xFF,
+  0x00, 0x63, 0x28, 0x0B, 0x00, 0x65, 0x20, 0x03, 0x00, 0x66, 0x24, 0x0F,
+  0x00, 0x68, 0xE3, 0x0C, 0x33, 0xE3, 0x03, 0x47, 0xE3, 0xFF, 0xFF, 0xDD,
+  0x3F, 0xE2, 0x03, 0xEF, 0xE0, 0x07, 0x0B, 0xE2, 0x9B, 0xFF, 0x1F, 0xFB,
+  0xC3, 0x31, 0xFF, 0xFA, 0xC4, 0x31, 0xFF, 0xF8, 0xC8, 0x35, 0xFF, 0xF2,
+  0xC3, 0x2E, 0xFF, 0xF3, 0xC9, 0x30, 0xFF, 0xF8, 0xD4, 0x37, 0xFF, 0xFE,
+  0xDF, 0x3E, 0xFF, 0xFF, 0xE8, 0x44, 0xFF, 0x11, 0xFF, 0xF0, 0x48, 0xFF,
+  0xFE, 0xF1, 0x4A, 0xFF, 0xF9, 0xEB, 0x49, 0xFF, 0xFC, 0xEF, 0x4F, 0xFF,
+  0xFC, 0xEE, 0x3C, 0x2B, 0x05, 0xF2, 0x53, 0xFF, 0xFC, 0xF1, 0x58, 0xE0,
+  0x08, 0xEF, 0xE0, 0xAB, 0xFF, 0xE0, 0x07, 0xB3, 0xE0, 0x03, 0x0F, 0xE1,
+  0x9B, 0xBF, 0xE0, 0x03, 0xAF, 0xE0, 0x07, 0x0B, 0xE0, 0xFF, 0xFF, 0x1D,
+  0xBF, 0x1F, 0xE0, 0x8C, 0x17, 0xFF, 0xE0, 0x8D, 0x16, 0xFF, 0xE9, 0x8B,
+  0x1A, 0xFF, 0xEF, 0x90, 0x1E, 0xFF, 0xF2, 0x99, 0x22, 0xFF, 0xF0, 0x9F,
+  0x22, 0xFF, 0xF8, 0xAF, 0x2B, 0xFF, 0xFB, 0xB7, 0x2F, 0xFF, 0x1A, 0xFF,
+  0xCC, 0x36, 0xFF, 0xFF, 0xE1, 0x40, 0xFF, 0xEB, 0xC4, 0x2B, 0xFF, 0xF7,
+  0xC6, 0x2F, 0xFF, 0xF4, 0xCF, 0x31, 0xFF, 0xEF, 0xC8, 0x2D, 0xFF, 0xE4,
+  0xBD, 0x29, 0xE2, 0x08, 0x6F, 0xE2, 0xFF, 0xFF, 0x2D, 0x7F, 0xE2, 0x07,
+  0x33, 0xE0, 0x03, 0x0F, 0xE4, 0xFF, 0x5C, 0xBF, 0x0C, 0xDD, 0x75, 0x14,
+  0xFF, 0xE3, 0x79, 0x17, 0xFF, 0xEB, 0x7F, 0x24, 0xFF, 0xEA, 0x20, 0x03,
+  0x1F, 0xEC, 0x84, 0x26, 0xFF, 0xE8, 0x84, 0x22, 0xFF, 0xEB, 0x8A, 0x24,
+  0xFF, 0xEE, 0x8F, 0x26, 0xFF, 0xF4, 0xA2, 0x28, 0xFF, 0xFC, 0xC3, 0x35,
+  0xFF, 0xEF, 0xB0, 0x24, 0xFF, 0xFD, 0xCC, 0x3C, 0xFF, 0x02, 0xF8, 0xC6,
+  0x31, 0x64, 0x07, 0x02, 0xFE, 0xD4, 0x3F, 0xE1, 0x04, 0xAB, 0xE1, 0x03,
+  0xB7, 0xC0, 0x0B, 0xE1, 0xFF, 0x5C, 0xBF, 0xC1, 0x6B, 0xE0, 0x0B, 0x07,
+  0xE1, 0xFF, 0xFF, 0x1D, 0x7F, 0x0A, 0xDC, 0x74, 0x1A, 0xFF, 0xDD, 0x74,
+  0x19, 0xFF, 0xDA, 0x74, 0x1C, 0x60, 0x03, 0x06, 0xE1, 0x7B, 0x22, 0xFF,
+  0xDE, 0x79, 0x1F, 0x60, 0x03, 0x1E, 0xDD, 0x78, 0x1E, 0xFF, 0xE0, 0x7C,
+  0x1B, 0xFF, 0xEB, 0x89, 0x21, 0xFF, 0xDE, 0x81, 0x17, 0xFF, 0xDA, 0x84,
+  0x18, 0xFF, 0xD2, 0x83, 0x15, 0xFF, 0xCF, 0x84, 0x14, 0xFF, 0xCC, 0x88,
+  0x16, 0xE2, 0x0C, 0x73, 0xE2, 0x03, 0x87, 0xE2, 0xFF, 0xFF, 0x1D, 0x7F,
+  0xE2, 0x03, 0x2F, 0xE0, 0x07, 0x0B, 0xE2, 0xFF, 0x5C, 0x3F, 0x11, 0xD3,
+  0x72, 0x1D, 0xFF, 0xD4, 0x72, 0x1C, 0xFF, 0xD6, 0x6E, 0x17, 0xFF, 0xD5,
+  0x6B, 0x14, 0xFF, 0xD7, 0x6D, 0x40, 0x07, 0x23, 0xDB, 0x1C, 0x6C, 0x1A,
+  0xFF, 0xD8, 0x6D, 0x1C, 0xFF, 0xDC, 0x70, 0x1D, 0xFF, 0xDE, 0x71, 0x1C,
+  0xFF, 0xE2, 0x75, 0x23, 0xFF, 0xDA, 0x6D, 0x1E, 0xFF, 0xD7, 0x6A, 0x1E,
+  0xFF, 0xD5, 0x68, 0x24, 0x1B, 0x01, 0x71, 0x28, 0xE1, 0x08, 0xAF, 0xE1,
+  0xFF, 0x6C, 0xBF, 0xE1, 0x07, 0x73, 0xE0, 0x03, 0x0F, 0xE3, 0xFF, 0x5C,
+  0x3F, 0xE1, 0x03, 0x6F, 0xE0, 0x07, 0x0B, 0xE1, 0x9B, 0x7F, 0x06, 0xD0,
+  0x6C, 0x1B, 0xFF, 0xD4, 0x6F, 0x1C, 0x23, 0xFB, 0x02, 0x18, 0xFF, 0xD8,
+  0x23, 0xF3, 0x0A, 0xDB, 0x6F, 0x1E, 0xFF, 0xDD, 0x70, 0x21, 0xFF, 0xDC,
+  0x6F, 0x22, 0x23, 0xE7, 0x1B, 0x1C, 0xFF, 0xD2, 0x6B, 0x19, 0xFF, 0xCD,
+  0x6C, 0x12, 0xFF, 0xD2, 0x6F, 0x16, 0xFF, 0xD5, 0x6F, 0x18, 0xFF, 0xDA,
+  0x6F, 0x1B, 0xFF, 0xDC, 0x6E, 0x1B, 0xFF, 0xDF, 0x70, 0x24, 0x33, 0x00,
+  0x7F, 0xE0, 0x09, 0xF3, 0xE0, 0x03, 0x13, 0xE0, 0x9B, 0xFF, 0xE0, 0x03,
+  0xAF, 0xE0, 0x07, 0x0B, 0xE0, 0xFF, 0xFF, 0xDD, 0xBF, 0x1F, 0xCC, 0x62,
+  0x18, 0xFF, 0xCE, 0x64, 0x19, 0xFF, 0xCE, 0x65, 0x1C, 0xFF, 0xCA, 0x62,
+  0x1A, 0xFF, 0xCB, 0x63, 0x19, 0xFF, 0xD1, 0x69, 0x1E, 0xFF, 0xD9, 0x71,
+  0x24, 0xFF, 0xD1, 0x6A, 0x1C, 0xFF, 0x09, 0xCC, 0x68, 0x1A, 0xFF, 0xC6,
+  0x67, 0x1B, 0xFF, 0xC7, 0x66, 0x20, 0x27, 0x00, 0x69, 0x28, 0x13, 0x03,
+  0x6F, 0x1F, 0xFF, 0xD7, 0x24, 0x2B, 0x02, 0xDB, 0x6D, 0x1A, 0xE3, 0x08,
+  0x2F, 0xE3, 0xFF, 0xFF, 0xED, 0x3F, 0xE2, 0x07, 0xF3, 0xE0, 0x03, 0x0F,
+  0xE6, 0x9B, 0x3F, 0x08, 0xBD, 0x56, 0x1B, 0xFF, 0xC1, 0x5A, 0x1E, 0xFF,
+  0xBE, 0x20, 0x03, 0x12, 0xBD, 0x59, 0x1B, 0xFF, 0xBC, 0x59, 0x16, 0xFF,
+  0xC1, 0x60, 0x15, 0xFF, 0xCA, 0x6A, 0x18, 0xFF, 0xC6, 0x66, 0x0F, 0x20,
+  0x03, 0x02, 0x14, 0xFF, 0xC3, 0x24, 0x17, 0x08, 0xC1, 0x5F, 0x16, 0xFF,
+  0xC6, 0x61, 0x17, 0xFF, 0xC8, 0x20, 0x03, 0x00, 0xCA, 0x20, 0x03, 0x02,
+  0xC8, 0x5E, 0x14, 0xE0, 0x04, 0xEB, 0xE0, 0x03, 0xF7, 0xC0, 0x0B, 0xE0,
+  0x9B, 0xFF, 0xC0, 0xAB, 0xE0, 0x0B, 0x07, 0xE0, 0xFF, 0xFF, 0xDD, 0xBF,
+  0x1F, 0xA5, 0x46, 0x17, 0xFF, 0xAC, 0x4C, 0x19, 0xFF, 0xB1, 0x52, 0x1B,
+  0xFF, 0xAC, 0x4E, 0x12, 0xFF, 0xB2, 0x55, 0x11, 0xFF, 0xCF, 0x75, 0x25,
+  0xFF, 0xD2, 0x79, 0x1D, 0xFF, 0xD8, 0x80, 0x1C, 0xFF, 0x11, 0xEB, 0x94,
+  0x30, 0xFF, 0xE3, 0x8D, 0x2E, 0xFF, 0xD2, 0x7A, 0x1D, 0xFF, 0xCE, 0x75,
+  0x1A, 0xFF, 0xCA, 0x70, 0x27, 0xFB, 0x05, 0x7F, 0x2B, 0xFF, 0xD3, 0x76,
+  0x24, 0xE3, 0x0C, 0x33, 0xE3, 0x03, 0x47, 0xE3, 0xFF, 0xFF, 0xDD, 0x3F,
+  0xE2, 0x03, 0xEF, 0xE0, 0x07, 0x0B, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x82, 0xFF, 0x47, 0x83, 0xE0, 0xFF, 0xFF, 0xFF, 0xF6, 0x03,
+  0xEB, 0x07, 0x93, 0xE0, 0x23, 0x0F, 0x44, 0x37, 0xE0, 0x23, 0x2F, 0xE0,
+  0x07, 0x2B, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xB6, 0x3F, 0x01, 0x6B, 0x3F, 0xE0, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x03, 0xFF, 0x07, 0xFF, 0x1F, 0x94, 0xE0, 0x23, 0x0F, 0x44, 0x3B, 0xE0,
+  0x23, 0x2F, 0xE0, 0x07, 0x2B, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0x3F, 0x00, 0x6B, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x72, 0xFF, 0x20, 0x00, 0x02, 0x7F,
+  0x7F, 0x7F, 0xE0, 0xFF, 0xFF, 0x0E, 0x03, 0x02, 0x3D, 0x3D, 0x3D, 0x62,
+  0x17, 0x02, 0x9B, 0x9B, 0x9B, 0x60, 0x07, 0xE2, 0x07, 0x27, 0xE0, 0x07,
+  0x17, 0xC0, 0x2F, 0xC0, 0x27, 0xC0, 0x0F, 0xC0, 0x27, 0xC0, 0x0F, 0xC0,
+  0x07, 0xC0, 0x17, 0xFF, 0xFF, 0x78, 0xFF, 0x62, 0x7C, 0xC1, 0xAF, 0xE0,
+  0xFF, 0x84, 0x07, 0xC3, 0x23, 0xE1, 0x2B, 0x93, 0x40, 0x3B, 0x40, 0x03,
+  0xE0, 0x33, 0x3B, 0x40, 0x3F, 0xC3, 0x9F, 0xC0, 0x47, 0x40, 0x13, 0x40,
+  0x0B, 0xC0, 0x07, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0x40, 0x2F, 0x40, 0x1B,
+  0xC0, 0x03, 0x40, 0x0F, 0xE0, 0x03, 0x1F, 0x40, 0x17, 0x40, 0x0F, 0xC0,
+  0x07, 0x40, 0x0B, 0x40, 0x03, 0x43, 0xFF, 0xFF, 0x07, 0xFF, 0xA2, 0x14,
+  0xE0, 0x23, 0x0F, 0xE0, 0xFF, 0x38, 0x3F, 0x41, 0x83, 0xE0, 0xFF, 0x14,
+  0x03, 0xE2, 0x07, 0xAF, 0xE1, 0x1F, 0x2B, 0xC0, 0x37, 0x40, 0x07, 0x40,
+  0x03, 0xE0, 0x1F, 0x37, 0x40, 0x27, 0x43, 0x3B, 0xC0, 0x33, 0x40, 0x07,
+  0x40, 0x03, 0x40, 0x17, 0xE0, 0x1B, 0x03, 0x40, 0x3B, 0x40, 0x03, 0xC0,
+  0x33, 0x40, 0x07, 0x40, 0x03, 0xE0, 0x13, 0x3B, 0xC0, 0x1F, 0x40, 0x37,
+  0xC0, 0x03, 0xC0, 0x13, 0x40, 0x07, 0x40, 0x03, 0x40, 0x17, 0x40, 0x43,
+  0x40, 0x07, 0x40, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xC0, 0x0F, 0x40, 0x1B,
+  0xC0, 0x03, 0xC0, 0x13, 0x40, 0x07, 0x40, 0x03, 0x40, 0x17, 0x40, 0x2F,
+  0x40, 0x07, 0x40, 0x0F, 0x40, 0x0B, 0x40, 0x03, 0xE3, 0xFF, 0x38, 0xBF,
+  0xE1, 0x37, 0x3F, 0x41, 0x83, 0xE0, 0xCF, 0x03, 0xE2, 0x03, 0x67, 0xE0,
+  0x2B, 0xE3, 0x40, 0x3F, 0x42, 0xAF, 0xE0, 0x2B, 0x3B, 0x40, 0x37, 0xC0,
+  0x3F, 0x40, 0x0B, 0xE0, 0x27, 0x43, 0x40, 0x33, 0xE0, 0x23, 0x3F, 0x40,
+  0x2B, 0x40, 0x03, 0xC0, 0x67, 0xE0, 0x13, 0x3F, 0xE0, 0x03, 0x27, 0x40,
+  0x2F, 0xC0, 0x2B, 0xE0, 0x03, 0x17, 0xC0, 0x13, 0x40, 0x07, 0x40, 0x03,
+  0x40, 0x27, 0xC0, 0x03, 0xE0, 0x03, 0x27, 0x40, 0x13, 0x40, 0x1F, 0x40,
+  0x13, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x03, 0xC0, 0x13, 0x40, 0x07, 0x40,
+  0x03, 0x40, 0x13, 0xC0, 0x03, 0xE0, 0x03, 0x27, 0xE2, 0x37, 0xBF, 0xE0,
+  0xFF, 0x38, 0x3F, 0xC1, 0x93, 0xE0, 0x87, 0x07, 0xE2, 0x03, 0x23, 0xE0,
+  0x2B, 0x9B, 0x40, 0x3F, 0xE2, 0x07, 0x77, 0xE0, 0x23, 0x47, 0xE0, 0x03,
+  0x3F, 0x40, 0x0B, 0xE0, 0x03, 0x3B, 0xE0, 0x07, 0x0F, 0xE0, 0x03, 0x1B,
+  0xC0, 0x0B, 0x40, 0x23, 0xC0, 0x7F, 0x40, 0x0B, 0xC0, 0x17, 0x40, 0x07,
+  0x40, 0x0F, 0x40, 0x03, 0x40, 0x0B, 0xE0, 0x07, 0x03, 0xC0, 0x17, 0x40,
+  0x07, 0xE0, 0x23, 0x3F, 0x40, 0x2B, 0x40, 0x03, 0x40, 0x37, 0x40, 0x53,
+  0x40, 0x07, 0x40, 0x0F, 0xC0, 0x0B, 0x40, 0x0F, 0x40, 0x0B, 0x40, 0x03,
+  0x40, 0x0B, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x2B,
+  0x40, 0x03, 0x40, 0x0B, 0xE0, 0x03, 0x13, 0xC0, 0x0B, 0xC0, 0x17, 0xE0,
+  0x07, 0x0F, 0x40, 0x17, 0x40, 0x03, 0x40, 0x3B, 0x40, 0x03, 0x40, 0x0B,
+  0xC0, 0x23, 0x40, 0x0F, 0xC0, 0x0B, 0xC0, 0x17, 0xE0, 0x07, 0x0F, 0xE3,
+  0xFF, 0x38, 0xBF, 0xE1, 0x37, 0x3F, 0x41, 0x8F, 0xE0, 0x4B, 0x03, 0xE1,
+  0x03, 0xEF, 0xE0, 0x2B, 0x5F, 0xE0, 0x43, 0x3F, 0xE0, 0x03, 0x4B, 0xE0,
+  0x03, 0x0B, 0xE0, 0x13, 0x97, 0xE0, 0x03, 0x27, 0xE0, 0x07, 0x0B, 0xC2,
+  0xD7, 0xE0, 0x0B, 0x3F, 0xC0, 0x2B, 0xC0, 0x07, 0x40, 0x23, 0xE0, 0x07,
+  0x0B, 0x40, 0x3F, 0x40, 0x03, 0x40, 0x1B, 0xE0, 0x07, 0x03, 0xC0, 0x2B,
+  0xC0, 0x07, 0x40, 0x1F, 0xE0, 0x07, 0x0B, 0x40, 0x3B, 0x40, 0x03, 0x40,
+  0x1B, 0xE0, 0x07, 0x03, 0xC0, 0x2B, 0xC0, 0x07, 0x40, 0x1F, 0x40, 0x0B,
+  0xC0, 0x2F, 0xC0, 0x0B, 0x40, 0x0F, 0x40, 0x0B, 0x40, 0x1F, 0x40, 0x0B,
+  0x40, 0x07, 0x40, 0x03, 0xC0, 0x13, 0xC0, 0x07, 0xC0, 0x13, 0xC0, 0x23,
+  0x40, 0x17, 0x40, 0x0B, 0x40, 0x03, 0xE0, 0x03, 0x0B, 0x40, 0x27, 0x40,
+  0x03, 0x40, 0x13, 0xE0, 0x03, 0x07, 0xC0, 0x0B, 0x40, 0x2F, 0xE0, 0x03,
+  0x0B, 0x40, 0x0F, 0x40, 0x2B, 0xE2, 0x37, 0xBF, 0xE0, 0xFF, 0x38, 0x3F,
+  0x41, 0x93, 0xE0, 0x4B, 0x03, 0x41, 0xDB, 0xE0, 0x33, 0x57, 0xE0, 0x07,
+  0x3F, 0x40, 0x0F, 0x40, 0x03, 0xE0, 0x1B, 0x53, 0x40, 0x27, 0x40, 0x03,
+  0xC0, 0x2B, 0xC2, 0x6B, 0x40, 0x13, 0x40, 0x0B, 0xC0, 0x17, 0xE0, 0x0B,
+  0x07, 0x40, 0x23, 0xC0, 0x03, 0xC0, 0x1F, 0x40, 0x33, 0xC0, 0x13, 0x40,
+  0x0B, 0xC0, 0x17, 0xE0, 0x0B, 0x07, 0xC0, 0x27, 0x40, 0x07, 0xC0, 0x1F,
+  0x40, 0x33, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x0B, 0xC0, 0x17, 0xE0, 0x0B,
+  0x07, 0x40, 0x23, 0xC0, 0x03, 0xC0, 0x1F, 0x40, 0x33, 0xC0, 0x13, 0x40,
+  0x0B, 0xC0, 0x17, 0xE0, 0x0B, 0x07, 0xC0, 0x27, 0x40, 0x07, 0xC0, 0x1F,
+  0x40, 0x33, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x0B, 0xE0, 0x03, 0x17, 0xC0,
+  0x0B, 0xC0, 0x07, 0x40, 0x23, 0xC0, 0x03, 0xC0, 0x13, 0x40, 0x33, 0xC0,
+  0x13, 0x40, 0x0B, 0xE0, 0x03, 0x17, 0xC0, 0x0B, 0xC0, 0x07, 0xC0, 0x27,
+  0x40, 0x07, 0xC0, 0x13, 0x40, 0x33, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x0B,
+  0xE0, 0x03, 0x17, 0xE3, 0xFF, 0x38, 0xBF, 0xE1, 0x37, 0x3F, 0xC1, 0x8B,
+  0xE0, 0x0B, 0x07, 0x41, 0xAF, 0xE0, 0x0B, 0x17, 0xE0, 0x1B, 0x13, 0x41,
+  0xE7, 0xC0, 0x3F, 0xC0, 0x07, 0xE0, 0x1B, 0x37, 0xC0, 0x23, 0xE0, 0x07,
+  0x3F, 0x40, 0x0F, 0x40, 0x03, 0xC0, 0x1F, 0xE0, 0x13, 0x07, 0x40, 0x27,
+  0x40, 0x03, 0xC0, 0x77, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x03, 0xE0, 0x13,
+  0x37, 0xE0, 0x03, 0x27, 0x40, 0x2B, 0x40, 0x0F, 0x40, 0x2F, 0x40, 0x07,
+  0x40, 0x0F, 0x40, 0x03, 0x40, 0x0F, 0xE0, 0x0F, 0x03, 0xE0, 0x03, 0x27,
+  0x40, 0x2B, 0x40, 0x0F, 0x40, 0x2B, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x03,
+  0x40, 0x0F, 0xE0, 0x0F, 0x03, 0xE0, 0x03, 0x27, 0x40, 0x2B, 0x40, 0x0F,
+  0x40, 0x2B, 0x40, 0x07, 0xE0, 0x03, 0x0F, 0x40, 0x13, 0xE0, 0x0B, 0x03,
+  0xC0, 0x27, 0x40, 0x2B, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x27, 0x40, 0x07,
+  0xE0, 0x03, 0x0F, 0x40, 0x13, 0xE0, 0x0B, 0x03, 0xC0, 0x27, 0x40, 0x2B,
+  0x40, 0x03, 0x40, 0x0F, 0x40, 0x27, 0x40, 0x07, 0xE0, 0x03, 0x0F, 0x40,
+  0x13, 0xC0, 0x03, 0x40, 0x1B, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x07, 0x40,
+  0x27, 0xC0, 0x03, 0x40, 0x0F, 0xE0, 0x03, 0x17, 0xC0, 0x0F, 0x40, 0x13,
+  0xC0, 0x03, 0xE2, 0x37, 0xBF, 0xE0, 0xFF, 0x38, 0x3F, 0xC1, 0x87, 0xE0,
+  0x0B, 0x07, 0x41, 0xC7, 0xE1, 0x0B, 0xB3, 0xE0, 0x0B, 0x2B, 0xE0, 0x0B,
+  0x13, 0xC0, 0x3F, 0x40, 0x07, 0xE0, 0x0B, 0x1F, 0xE0, 0x17, 0x13, 0x40,
+  0x37, 0x40, 0x7F, 0x40, 0x07, 0xE0, 0x17, 0x2B, 0xE0, 0x0B, 0x1F, 0x40,
+  0x37, 0xE0, 0x23, 0x3F, 0x40, 0x2F, 0xE0, 0x03, 0x47, 0x40, 0x0F, 0xE0,
+  0x1F, 0x3F, 0xE0, 0x0B, 0x27, 0xE0, 0x47, 0x3F, 0x40, 0x4F, 0xE0, 0x03,
+  0x9F, 0xE0, 0x03, 0x0B, 0xE0, 0x03, 0x7F, 0x40, 0x0B, 0x40, 0x1B, 0x40,
+  0x2F, 0x40, 0x0B, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x0B, 0x40, 0x07, 0xE0,
+  0x0B, 0x03, 0x40, 0x1B, 0xE0, 0x07, 0x27, 0x40, 0x0F, 0xE0, 0x0B, 0x17,
+  0xE0, 0x03, 0x3F, 0x40, 0x23, 0x40, 0x03, 0xE0, 0x0B, 0x27, 0xE0, 0x0F,
+  0x17, 0xC0, 0x3F, 0x40, 0x33, 0xE3, 0xFF, 0x38, 0xBF, 0xE1, 0x37, 0x3F,
+  0xC1, 0x8B, 0xE0, 0x0F, 0x07, 0x41, 0xC3, 0xE0, 0x0F, 0x1B, 0xE0, 0x1B,
+  0x17, 0x41, 0xE3, 0xE0, 0x1B, 0x27, 0xE0, 0x0F, 0x23, 0xE0, 0x9F, 0x3F,
+  0xE1, 0x0F, 0x27, 0xE0, 0x1F, 0xBF, 0xC0, 0x27, 0xC0, 0x07, 0xC1, 0x0F,
+  0xE0, 0x07, 0x0F, 0xC0, 0x17, 0xE0, 0x07, 0x07, 0xC0, 0x27, 0x40, 0x07,
+  0xE0, 0x03, 0x8B, 0x40, 0x0F, 0xC0, 0x2B, 0x40, 0x17, 0xE0, 0x03, 0x0F,
+  0xC0, 0x17, 0x40, 0x07, 0xC0, 0x17, 0x40, 0x07, 0x40, 0x27, 0x40, 0x13,
+  0x40, 0x03, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x03, 0x40, 0x17, 0xC0, 0x0F,
+  0xC0, 0x07, 0x40, 0x17, 0x40, 0x03, 0xC0, 0x0F, 0x40, 0x07, 0x40, 0x27,
+  0x40, 0x13, 0x40, 0x03, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x03, 0x40, 0x17,
+  0xC0, 0x0F, 0x40, 0x07, 0x40, 0x0F, 0xE2, 0x37, 0xBF, 0xE0, 0xFF, 0x38,
+  0x3F, 0x41, 0x97, 0xE0, 0x53, 0x03, 0x41, 0xE3, 0xE0, 0x33, 0x5F, 0x42,
+  0x27, 0xE0, 0xA7, 0x3F, 0xE0, 0x03, 0xB3, 0xE0, 0x03, 0x0B, 0xE0, 0x13,
+  0xC7, 0xC1, 0x27, 0x40, 0x07, 0xE0, 0x03, 0x33, 0x40, 0x0B, 0x40, 0x03,
+  0xE0, 0x13, 0x3B, 0x40, 0x1B, 0x40, 0x37, 0xC0, 0x07, 0xE0, 0x03, 0x2F,
+  0x40, 0x0B, 0x40, 0x03, 0x40, 0x1B, 0x40, 0x03, 0xC0, 0x27, 0x40, 0x0B,
+  0x40, 0x03, 0xC0, 0x1B, 0xC0, 0x17, 0x40, 0x07, 0xC0, 0x13, 0xC0, 0x1F,
+  0xE0, 0x03, 0x0F, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x1F, 0x40, 0x07, 0xC0,
+  0x0F, 0x40, 0x07, 0xE0, 0x03, 0x2F, 0x40, 0x0B, 0x40, 0x03, 0x40, 0x23,
+  0x40, 0x03, 0xC0, 0x1F, 0x40, 0x07, 0x40, 0x0F, 0xE3, 0xFF, 0x38, 0xBF,
+  0xE1, 0x37, 0x3F, 0x41, 0x83, 0xE0, 0x8F, 0x03, 0x42, 0x37, 0xC2, 0x27,
+  0xE0, 0x27, 0xA3, 0x40, 0x3B, 0x40, 0x03, 0xE0, 0x2B, 0x3F, 0x40, 0x37,
+  0xC0, 0x03, 0xE0, 0x7B, 0x3F, 0xE0, 0x27, 0x83, 0xC0, 0xBB, 0x40, 0x07,
+  0x40, 0x3B, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x03, 0xE1, 0x07, 0x47, 0xC0,
+  0x1B, 0xE0, 0x03, 0x17, 0x40, 0x27, 0xC0, 0x03, 0x40, 0x1F, 0x40, 0x03,
+  0xC0, 0x0F, 0x40, 0x27, 0x40, 0x0B, 0x40, 0x07, 0x40, 0x03, 0xC0, 0x1B,
+  0x40, 0x0B, 0xC0, 0x03, 0x40, 0x1F, 0xC0, 0x03, 0x40, 0x1F, 0x40, 0x03,
+  0xC0, 0x0F, 0x40, 0x23, 0x40, 0x0B, 0x40, 0x07, 0x40, 0x03, 0xE2, 0x37,
+  0xBF, 0xE0, 0xFF, 0x38, 0x3F, 0x41, 0x83, 0xE0, 0x8F, 0x03, 0x42, 0x37,
+  0xE0, 0x2F, 0x9B, 0x40, 0x3B, 0x40, 0x03, 0xE0, 0x2B, 0x3F, 0x40, 0x37,
+  0xC0, 0x03, 0xE2, 0x03, 0xAB, 0xE0, 0x1B, 0x4B, 0x40, 0x2F, 0xC0, 0x3B,
+  0x40, 0x07, 0x40, 0x0F, 0xE0, 0x1B, 0x37, 0xC0, 0x23, 0x40, 0x2F, 0x40,
+  0x37, 0xC0, 0x03, 0x40, 0x0F, 0xC0, 0x1B, 0xE0, 0x0F, 0x07, 0xE0, 0x03,
+  0x23, 0x40, 0x0B, 0xC0, 0x3B, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x37, 0x40,
+  0x0B, 0x40, 0x03, 0x40, 0x0B, 0xE0, 0x07, 0x03, 0xC0, 0x23, 0x40, 0x17,
+  0x40, 0x0B, 0x40, 0x27, 0xC0, 0x03, 0x40, 0x0F, 0x40, 0x17, 0xC0, 0x0F,
+  0xC0, 0x0B, 0x40, 0x07, 0xC0, 0x03, 0xC0, 0x23, 0x40, 0x0F, 0x40, 0x0B,
+  0xC0, 0x2B, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x17, 0x40, 0x0B, 0x40, 0x03,
+  0xC0, 0x0B, 0x40, 0x17, 0x40, 0x03, 0xE3, 0xFF, 0x38, 0xBF, 0xE1, 0x37,
+  0x3F, 0x41, 0x8F, 0xE0, 0xFF, 0x14, 0x03, 0xC2, 0xB3, 0xE1, 0x1F, 0x23,
+  0xE0, 0x07, 0x2F, 0x40, 0x0F, 0x42, 0xE7, 0xE0, 0x1B, 0x3F, 0x40, 0x27,
+  0x40, 0x2F, 0xE0, 0x03, 0x2B, 0x40, 0x0F, 0x40, 0x17, 0xC0, 0x03, 0xE0,
+  0x03, 0x1B, 0xC0, 0x0B, 0xE0, 0x03, 0x23, 0x40, 0x0B, 0xC0, 0x17, 0x40,
+  0x07, 0x40, 0x0F, 0xC0, 0x3B, 0x40, 0x07, 0x40, 0x13, 0xE0, 0x07, 0x03,
+  0xE0, 0x03, 0x23, 0x40, 0x0B, 0xE0, 0x03, 0x1F, 0x40, 0x0F, 0x40, 0x37,
+  0xC0, 0x03, 0xE0, 0x03, 0x1B, 0xC0, 0x0B, 0xE0, 0x03, 0x23, 0x40, 0x0B,
+  0xC0, 0x17, 0x40, 0x07, 0x40, 0x0F, 0xC0, 0x3B, 0x40, 0x07, 0x40, 0x13,
+  0x40, 0x03, 0x40, 0x17, 0x40, 0x03, 0xE2, 0x37, 0xBF, 0xE0, 0xFF, 0x38,
+  0x3F, 0x41, 0x8B, 0xE0, 0xFF, 0x58, 0x03, 0x42, 0xE7, 0xE1, 0x1B, 0x63,
+  0xE0, 0x0F, 0x27, 0x40, 0x17, 0xC0, 0x03, 0xE0, 0x0F, 0x47, 0xC0, 0x1F,
+  0xE3, 0x03, 0x63, 0x40, 0x2B, 0x40, 0x0F, 0xC0, 0x1B, 0x40, 0x07, 0x40,
+  0x0F, 0x40, 0x17, 0xE0, 0x07, 0x03, 0x40, 0x17, 0xC0, 0x1F, 0x40, 0x0B,
+  0xC0, 0x1F, 0x40, 0x0B, 0x40, 0x17, 0xC0, 0x03, 0x40, 0x0F, 0x40, 0x03,
+  0xC0, 0x1F, 0xC0, 0x07, 0x40, 0x13, 0x40, 0x23, 0x40, 0x07, 0x40, 0x03,
+  0xE0, 0x07, 0x17, 0x40, 0x1B, 0x40, 0x03, 0x40, 0x1B, 0x40, 0x03, 0xC0,
+  0x1F, 0xE3, 0xFF, 0x38, 0xBF, 0xE1, 0x37, 0x3F, 0xC1, 0x87, 0xE0, 0xFF,
+  0xC0, 0x07, 0x43, 0x63, 0xE1, 0x03, 0xCB, 0xE0, 0x17, 0x0F, 0xC0, 0x2B,
+  0xC0, 0x27, 0x40, 0x07, 0x40, 0x03, 0xC0, 0x17, 0xE3, 0x03, 0xAB, 0x40,
+  0x13, 0x40, 0x1B, 0x40, 0x03, 0xE0, 0x07, 0x17, 0xC0, 0x0F, 0x40, 0x1B,
+  0x40, 0x03, 0x40, 0x2B, 0x40, 0x03, 0xC0, 0x17, 0x40, 0x0B, 0x40, 0x03,
+  0x40, 0x1B, 0x40, 0x03, 0xC0, 0x17, 0xE2, 0x37, 0xBF, 0xE0, 0xFF, 0x33,
+  0x3F, 0x04, 0xFF, 0xD6, 0x7F, 0xFF, 0xFF,
+};
+
+const BakedTexture terrainBakedTexture = { 256, 256, 4, 262144, 36787, terrainBakedTextureData };
+
+static const unsigned char bedrockBakedTextureData[352] = {
+  0x26, 0x57, 0x57, 0x57, 0xFF, 0x33, 0x33, 0x33, 0xE0, 0x04, 0x03, 0x40,
+  0x13, 0x02, 0x97, 0x97, 0x97, 0x60, 0x03, 0x02, 0x07, 0x07, 0x07, 0x60,
+  0x07, 0x40, 0x13, 0xE0, 0x0B, 0x27, 0x40, 0x17, 0x40, 0x03, 0xC0, 0x2F,
+  0xE0, 0x07, 0x07, 0x40, 0x33, 0xE0, 0x03, 0x13, 0x40, 0x4F, 0x40, 0x2F,
+  0x40, 0x03, 0x40, 0x1B, 0x40, 0x07, 0x40, 0x13, 0x40, 0x0B, 0x40, 0x03,
+  0xE0, 0x03, 0x0B, 0x40, 0x0F, 0x40, 0x3B, 0x40, 0x07, 0x40, 0x27, 0xC0,
+  0x03, 0x40, 0x13, 0xC0, 0x0B, 0x40, 0x07, 0xE0, 0x07, 0x0F, 0x40, 0x43,
+  0xE0, 0x07, 0x17, 0x40, 0x43, 0xE0, 0x07, 0x03, 0x40, 0x23, 0x40, 0x03,
+  0x40, 0x3F, 0x40, 0x03, 0xE0, 0x07, 0x1F, 0xE0, 0x03, 0x0F, 0x40, 0x1F,
+  0xE0, 0x07, 0x03, 0x40, 0x67, 0xC0, 0x23, 0x40, 0x47, 0xC0, 0x03, 0xC0,
+  0x13, 0x40, 0x07, 0x40, 0x13, 0x40, 0x27, 0x40, 0x07, 0x40, 0x03, 0x40,
+  0x13, 0x40, 0x03, 0xC0, 0x13, 0xC0, 0x53, 0x40, 0x1B, 0x02, 0x63, 0x63,
+  0x63, 0x60, 0x07, 0x40, 0x1F, 0xE0, 0x03, 0x17, 0x40, 0x1B, 0xC0, 0x03,
+  0xC0, 0x17, 0x40, 0x07, 0xC0, 0x43, 0xC0, 0x1B, 0x40, 0x37, 0xE0, 0x0B,
+  0x03, 0x40, 0x27, 0xE0, 0x07, 0x17, 0xC0, 0x33, 0x40, 0x07, 0x40, 0x4B,
+  0x40, 0x03, 0x40, 0x27, 0x40, 0x07, 0x40, 0x2B, 0x40, 0x17, 0xC0, 0x03,
+  0x40, 0x13, 0xE0, 0x0F, 0x03, 0x40, 0x23, 0x40, 0x2F, 0xE0, 0x0B, 0x03,
+  0x40, 0x1B, 0x40, 0x53, 0x40, 0x07, 0x40, 0x03, 0xE0, 0x03, 0x23, 0x40,
+  0x4F, 0x40, 0x13, 0xC0, 0x03, 0x40, 0x0F, 0xC0, 0x1F, 0x40, 0x0B, 0x40,
+  0x03, 0x40, 0x0F, 0x40, 0x3F, 0x40, 0x07, 0x40, 0x0F, 0xC0, 0x03, 0xC0,
+  0x33, 0x40, 0x07, 0x40, 0x1F, 0x40, 0x07, 0xC0, 0x03, 0x40, 0x2B, 0xC0,
+  0x0B, 0x40, 0x07, 0xE0, 0x0B, 0x33, 0xC0, 0x13, 0xC0, 0x3B, 0x40, 0x33,
+  0xE0, 0x0F, 0x03, 0xC0, 0x2B, 0xE0, 0x0B, 0x1F, 0x40, 0x5F, 0x40, 0x03,
+  0x40, 0x23, 0x40, 0x1F, 0x40, 0x07, 0xC0, 0x53, 0x40, 0x17, 0x40, 0x13,
+  0xC0, 0x03, 0x40, 0x17, 0x40, 0x0B, 0x40, 0x17, 0x40, 0x03, 0x40, 0x2B,
+  0x40, 0x03, 0x40, 0x0B, 0xC0, 0x03, 0x40, 0x1F, 0xE0, 0x07, 0x03, 0xC0,
+  0x1B, 0x40, 0x2B, 0x40, 0x03, 0x40, 0x0F, 0xC0, 0x23, 0xE0, 0x03, 0x0B,
+  0xC0, 0x13, 0x40, 0x67, 0x40, 0x27, 0x40, 0x03, 0x40, 0x1F, 0xE0, 0x03,
+  0x03, 0xC0, 0x23, 0x0B, 0x33, 0x33, 0x33, 0xFF, 0x57, 0x57, 0x57, 0xFF,
+  0x57, 0x57, 0x57, 0xFF,
+};
+
+const BakedTexture bedrockBakedTexture = { 16, 16, 4, 1024, 352, bedrockBakedTextureData };
+
+static const unsigned char waterBakedTextureData[274] = {
+  0x27, 0x3D, 0x6D, 0xFF, 0x92, 0x26, 0x5C, 0xFF, 0x87, 0x40, 0x03, 0x01,
+  0x1F, 0x55, 0xE0, 0x01, 0x03, 0x40, 0x0F, 0xE0, 0x0B, 0x03, 0x40, 0x2F,
+  0xE0, 0x03, 0x03, 0x40, 0x33, 0x40, 0x27, 0xE0, 0x03, 0x13, 0xE0, 0x0F,
+  0x0B, 0x40, 0x27, 0xC0, 0x03, 0x40, 0x37, 0xE0, 0x03, 0x03, 0xC0, 0x17,
+  0x40, 0x07, 0x40, 0x3F, 0x40, 0x07, 0xE0, 0x03, 0x03, 0x40, 0x2B, 0x40,
+  0x17, 0x40, 0x03, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0x40, 0x13, 0x40, 0x03,
+  0xC0, 0x2F, 0x40, 0x0B, 0xE0, 0x03, 0x03, 0xE0, 0x03, 0x2B, 0xC0, 0x0B,
+  0xE0, 0x0B, 0x2B, 0xC0, 0x1B, 0xE0, 0x07, 0x07, 0x40, 0x4B, 0xC0, 0x2F,
+  0x40, 0x07, 0x40, 0x1F, 0xC0, 0x07, 0xE0, 0x03, 0x1B, 0xC0, 0x17, 0x40,
+  0x1B, 0xC0, 0x03, 0x40, 0x1F, 0x40, 0x17, 0xE0, 0x03, 0x03, 0xE0, 0x03,
+  0x13, 0xC0, 0x27, 0xE0, 0x03, 0x1F, 0xC0, 0x0B, 0xE0, 0x03, 0x27, 0x40,
+  0x13, 0xC0, 0x2B, 0x40, 0x17, 0xC0, 0x03, 0xC0, 0x17, 0xC0, 0x0F, 0x40,
+  0x07, 0xC0, 0x27, 0x40, 0x07, 0xC0, 0x1F, 0x40, 0x0B, 0x40, 0x1B, 0x40,
+  0x03, 0x40, 0x0B, 0x40, 0x03, 0xE0, 0x07, 0x1B, 0x40, 0x13, 0xE0, 0x0B,
+  0x03, 0x40, 0x27, 0xE0, 0x27, 0x03, 0x40, 0x67, 0xE0, 0x03, 0x03, 0x40,
+  0x57, 0xC0, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0x40, 0x57, 0x40, 0x0B, 0xC0,
+  0x1B, 0x40, 0x07, 0x40, 0x0F, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x03, 0x40,
+  0x23, 0x40, 0x03, 0x40, 0x0B, 0x40, 0x17, 0x40, 0x0B, 0xE0, 0x3F, 0x03,
+  0x40, 0x53, 0xE0, 0x13, 0x03, 0x40, 0x6F, 0xE0, 0x03, 0x03, 0xE0, 0x1B,
+  0x77, 0xC0, 0x2F, 0xE0, 0x0F, 0x57, 0xC0, 0x1F, 0x40, 0x4B, 0xC0, 0x0B,
+  0xE0, 0x07, 0x2B, 0x40, 0x1B, 0xE0, 0x03, 0x03, 0xC0, 0x27, 0xC0, 0x07,
+  0xC0, 0x2F, 0xE0, 0x03, 0x23, 0xE0, 0x03, 0x0B, 0x40, 0x1F, 0xE0, 0x03,
+  0x0F, 0xE0, 0x0A, 0x0B, 0x04, 0x87, 0x1F, 0x55, 0xFF, 0x87,
+};
+
+const BakedTexture waterBakedTexture = { 16, 16, 4, 1024, 274, waterBakedTextureData };
+
@@ -0,0 +1,20 @@
+#pragma once
+#include <stddef.h>
+
+struct BakedTexture
+{
+  unsigned int width;
+  unsigned int height;
+  unsigned int components;
+  size_t size;
+  size_t length;
+  const unsigned char* data;
+};
+
+extern const BakedTexture cloudsBakedTexture;
+extern const BakedTexture fontBakedTexture;
+extern const BakedTexture interfaceBakedTexture;
+extern const BakedTexture playerBakedTexture;
+extern const BakedTexture terrainBakedTexture;
+extern const BakedTexture bedrockBakedTexture;
+extern const BakedTexture waterBakedTexture;
@@ -0,0 +1,62 @@
+#pragma once
+#include "Block.h"
+#include "Level.h"
+
+// A read-only view of a level's blocks and light depths. Meshing only looks at the level through this, so it can run
+// over any block array without the game, a GL context or the main thread.
+struct BlockSource
+{
+  BlockSource(const unsigned char* blocks, const int* lightDepths, int groundLevel, int waterLevel)
+    : blocks(blocks), lightDepths(lightDepths), groundLevel(groundLevel), waterLevel(waterLevel) {}
+
+  BlockSource(const Level& level)
+    : BlockSource(level.blocks, level.lightDepths, level.groundLevel, level.waterLevel) {}
+
+  inline bool isInBounds(int x, int y, int z) const
+  {
+    return x >= 0 && y >= 0 && z >= 0 && x < Level::WIDTH && y < Level::HEIGHT && z < Level::DEPTH;
+  }
+
+  inline unsigned char getTile(int x, int y, int z) const
+  {
+    return isInBounds(x, y, z) ? blocks[(z * Level::HEIGHT + y) * Level::WIDTH + x] : (unsigned char)Block::Type::BLOCK_AIR;
+  }
+
+  inline unsigned char getRenderTile(int x, int y, int z) const
+  {
+    if (x < 0 || y < 0 || z < 0 || x >= Level::WIDTH || z >= Level::DEPTH)
+    {
+      if (y < waterLevel && y >= groundLevel)
+      {
+        return (unsigned char)Block::Type::BLOCK_WATER;
+      }
+    }
+
+    return getTile(x, y, z);
+  }
+
+  inline bool isTileLit(int x, int y, int z) const
+  {
+    return isInBounds(x, y, z) ? y >= lightDepths[x + z * Level::WIDTH] : true;
+  }
+
+  inline float getTileBrightness(int x, int y, int z) const
+  {
+    return isLavaTile(getTile(x, y, z)) || isTileLit(x, y, z) ? 1.0f : 0.6f;
+  }
+
+  static inline bool isWaterTile(unsigned char blockType)
+  {
+    return blockType == (unsigned char)Block::Type::BLOCK_WATER || blockType == (unsigned char)Block::Type::BLOCK_STILL_WATER;
+  }
+
+  static inline bool isLavaTile(unsigned char blockType)
+  {
+    return blockType == (unsigned char)Block::Type::BLOCK_LAVA || blockType == (unsigned char)Block::Type::BLOCK_STILL_LAVA;
+  }
+
+  const unsigned char* blocks;
+  const int* lightDepths;
+  int groundLevel;
+  int waterLevel;
+};
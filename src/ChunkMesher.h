@@ -0,0 +1,63 @@
+#pragma once
+#include "BlockSource.h"
+#include "VertexList.h"
+
+#include <glm/glm.hpp>
+#include <vector>
+
+class ChunkMesher
+{
+public:
+  struct Mesh
+  {
+    std::vector<VertexList::Vertex> vertices;
+    std::vector<VertexList::Vertex> waterVertices;
+  };
+
+  void build(const BlockSource& source, const glm::ivec3& position, Mesh& mesh);
+
+  static const int SIZE = 16;
+
+private:
+  enum class FaceType { Front, Back, Left, Right, Top, Bottom };
+
+  struct Face
+  {
+    bool valid = false;
+    bool mirror;
+    unsigned char blockType;
+    float brightness;
+    float blockShift;
+    float height;
+
+    bool operator==(const Face& rhs)
+    {
+      return rhs.valid &&
+        this->valid &&
+        this->blockType == rhs.blockType &&
+        this->brightness == rhs.brightness &&
+        this->blockShift == rhs.blockShift &&
+        this->height == rhs.height;
+    }
+  };
+
+  inline Face& getFace(Face* faces, int x, int y, int z);
+
+  template <FaceType faceType>
+  inline bool shouldRenderFace(const int x, const int y, const int z);
+
+  template<FaceType faceType>
+  inline void generateMesh(Face* faces);
+  inline void generateFaces();
+
+  BlockSource source = { nullptr, nullptr, 0, 0 };
+  glm::ivec3 position;
+  Mesh* mesh;
+
+  Face topFaces[SIZE * SIZE * SIZE];
+  Face bottomFaces[SIZE * SIZE * SIZE];
+  Face leftFaces[SIZE * SIZE * SIZE];
+  Face rightFaces[SIZE * SIZE * SIZE];
+  Face frontFaces[SIZE * SIZE * SIZE];
+  Face backFaces[SIZE * SIZE * SIZE];
+};
@@ -10,3 +10,22 @@ float CombinedNoise::compute(float x, float y)
 {
   return noise1.compute(x + noise2.compute(x, y), y);
 }
+
+void CombinedNoise::compute(const float* x, float y, float* out, int count)
+{
+  float offsets[BATCH_SIZE];
+
+  for (int i = 0; i < count; i += BATCH_SIZE)
+  {
+    const int size = count - i < BATCH_SIZE ? count - i : BATCH_SIZE;
+
+    noise2.compute(x + i, y, offsets, size);
+
+    for (int j = 0; j < size; j++)
+    {
+      offsets[j] += x[i + j];
+    }
+
+    noise1.compute(offsets, y, out + i, size);
+  }
+}
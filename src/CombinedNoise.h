@@ -6,7 +6,10 @@ public:
   CombinedNoise(OctaveNoise noise1, OctaveNoise noise2);
 
   float compute(float x, float y);
+  void compute(const float* x, float y, float* out, int count);
 private:
+  static const int BATCH_SIZE = 64;
+
   OctaveNoise noise1;
   OctaveNoise noise2;
 };
\ No newline at end of file
@@ -0,0 +1,654 @@
+#include "Datagram.h"
+
+#if !defined(EMSCRIPTEN)
+#define ASIO_STANDALONE
+
+#if defined(_WIN32)
+#pragma warning(push, 0)
+#else
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Weverything"
+#endif
+
+#include <asio.hpp>
+
+#if defined(_WIN32)
+#pragma warning(pop)
+#else
+#pragma clang diagnostic pop
+#endif
+
+#include <chrono>
+#include <cstring>
+#include <algorithm>
+
+struct Datagram::Socket
+{
+  Socket() : socket(context) {}
+
+  asio::io_context context;
+  asio::ip::udp::socket socket;
+  asio::ip::udp::endpoint remote;
+};
+
+static bool isNewer(uint16_t a, uint16_t b)
+{
+  return int16_t(a - b) > 0;
+}
+
+Datagram::Datagram()
+{
+  random.seed((unsigned int)std::chrono::steady_clock::now().time_since_epoch().count());
+
+  loss = 0.0f;
+  statistics = {};
+  accepted = false;
+  listening = false;
+}
+
+Datagram::~Datagram()
+{
+  close();
+}
+
+bool Datagram::open(const std::string& host, unsigned short port)
+{
+  close();
+
+  socket = std::make_unique<Socket>();
+
+  asio::error_code error;
+  asio::ip::udp::resolver resolver(socket->context);
+
+  auto endpoints = resolver.resolve(asio::ip::udp::v4(), host, std::to_string(port), error);
+
+  if (error || endpoints.empty())
+  {
+    printf("network error: failed to resolve %s.\n", host.c_str());
+
+    socket.reset();
+    return false;
+  }
+
+  socket->remote = endpoints.begin()->endpoint();
+  socket->socket.open(asio::ip::udp::v4(), error);
+
+  if (!error)
+  {
+    socket->socket.non_blocking(true, error);
+  }
+
+  if (error)
+  {
+    printf("network error: failed to open datagram socket: %s.\n", error.message().c_str());
+
+    socket.reset();
+    return false;
+  }
+
+  reset();
+  transmit(Type::Connect, 0, 0, nullptr, 0);
+
+  return true;
+}
+
+// Waits for the first peer to connect instead of connecting out, so a transport can be tested against itself.
+bool Datagram::listen(unsigned short port)
+{
+  close();
+
+  socket = std::make_unique<Socket>();
+
+  asio::error_code error;
+  socket->socket.open(asio::ip::udp::v4(), error);
+
+  if (!error)
+  {
+    socket->socket.bind(asio::ip::udp::endpoint(asio::ip::udp::v4(), port), error);
+  }
+
+  if (!error)
+  {
+    socket->socket.non_blocking(true, error);
+  }
+
+  if (error)
+  {
+    printf("network error: failed to listen on datagram port %d: %s.\n", port, error.message().c_str());
+
+    socket.reset();
+    return false;
+  }
+
+  reset();
+  listening = true;
+
+  return true;
+}
+
+void Datagram::reset()
+{
+  accepted = false;
+  listening = false;
+
+  openTime = time();
+  lastSendTime = openTime;
+  lastReceiveTime = openTime;
+  lastConnectTime = openTime;
+  roundTripTime = 0.0;
+  retransmitTimeout = 0.5;
+
+  window = 4.0f;
+  threshold = MAX_WINDOW;
+
+  unreliableSequence = 0;
+  remoteUnreliableSequence = 0;
+  remoteUnreliableReceived = false;
+
+  reliableSequence = 0;
+  nextReliableSequence = 0;
+  latestReliableSequence = UINT16_MAX;
+  ackPending = false;
+
+  outgoing.clear();
+  incoming.assign(WINDOW, {});
+  assembly.clear();
+
+  statistics = {};
+  statistics.window = window;
+}
+
+void Datagram::close()
+{
+  if (socket && accepted)
+  {
+    transmit(Type::Disconnect, 0, 0, nullptr, 0);
+  }
+
+  socket.reset();
+
+  accepted = false;
+  listening = false;
+
+  outgoing.clear();
+  incoming.clear();
+  assembly.clear();
+}
+
+void Datagram::disconnect()
+{
+  close();
+
+  if (onClose)
+  {
+    onClose();
+  }
+}
+
+void Datagram::poll()
+{
+  if (!socket)
+  {
+    return;
+  }
+
+  receiveBuffer.resize(UINT16_MAX);
+
+  while (socket)
+  {
+    asio::error_code error;
+    asio::ip::udp::endpoint sender;
+
+    auto size = socket->socket.receive_from(asio::buffer(receiveBuffer), sender, 0, error);
+
+    if (error)
+    {
+      break;
+    }
+
+    if (listening && !accepted && size >= sizeof(Header) && receiveBuffer[0] == (unsigned char)Type::Connect)
+    {
+      socket->remote = sender;
+    }
+
+    if (sender == socket->remote)
+    {
+      receive(receiveBuffer.data(), size);
+    }
+  }
+
+  if (!socket)
+  {
+    return;
+  }
+
+  const auto now = time();
+
+  if (!accepted)
+  {
+    if (listening)
+    {
+      return;
+    }
+
+    if (now - openTime > CONNECT_TIMEOUT)
+    {
+      printf("network error: datagram connection timed out.\n");
+
+      disconnect();
+      return;
+    }
+
+    if (now - lastConnectTime > CONNECT_INTERVAL)
+    {
+      transmit(Type::Connect, 0, 0, nullptr, 0);
+
+      lastConnectTime = now;
+    }
+
+    return;
+  }
+
+  if (now - lastReceiveTime > TIMEOUT)
+  {
+    printf("network error: datagram connection timed out.\n");
+
+    disconnect();
+    return;
+  }
+
+  resend();
+
+  if (ackPending || now - lastSendTime > KEEPALIVE_INTERVAL)
+  {
+    transmit(Type::Ack, 0, 0, nullptr, 0);
+  }
+}
+
+void Datagram::send(const unsigned char* data, size_t size, Channel channel, bool text)
+{
+  if (!accepted)
+  {
+    return;
+  }
+
+  const auto payload = MTU - sizeof(Header);
+  const uint8_t flags = text ? FLAG_TEXT : 0;
+
+  if (channel == Channel::Unreliable && size <= payload)
+  {
+    transmit(Type::Data, flags, ++unreliableSequence, data, size);
+    return;
+  }
+
+  size_t offset = 0;
+
+  do
+  {
+    const auto length = std::min(size - offset, payload);
+    const auto more = offset + length < size;
+
+    Outgoing packet;
+    packet.sequence = reliableSequence++;
+    packet.flags = flags | FLAG_RELIABLE | (more ? FLAG_FRAGMENT : 0);
+    packet.data.assign(data + offset, data + offset + length);
+    packet.sentTime = 0.0;
+    packet.sent = false;
+    packet.retransmitted = false;
+
+    outgoing.push_back(std::move(packet));
+
+    offset += length;
+  } while (offset < size);
+
+  resend();
+}
+
+void Datagram::seed(unsigned int value)
+{
+  random.seed(value);
+}
+
+bool Datagram::isOpen()
+{
+  return accepted;
+}
+
+unsigned short Datagram::getPort()
+{
+  if (!socket)
+  {
+    return 0;
+  }
+
+  asio::error_code error;
+  auto endpoint = socket->socket.local_endpoint(error);
+
+  return error ? 0 : endpoint.port();
+}
+
+size_t Datagram::getBufferedAmount()
+{
+  size_t amount = 0;
+
+  for (const auto& packet : outgoing)
+  {
+    amount += packet.data.size();
+  }
+
+  return amount;
+}
+
+double Datagram::time()
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint32_t Datagram::getAckBits()
+{
+  uint32_t bits = 0;
+
+  for (uint16_t i = 0; i < 32; i++)
+  {
+    const uint16_t sequence = latestReliableSequence - 1 - i;
+
+    if (!isNewer(sequence, nextReliableSequence) && sequence != nextReliableSequence)
+    {
+      break;
+    }
+
+    const auto& slot = incoming[sequence % WINDOW];
+
+    if (slot.received && slot.sequence == sequence)
+    {
+      bits |= 1u << i;
+    }
+  }
+
+  return bits;
+}
+
+void Datagram::transmit(Type type, uint8_t flags, uint16_t sequence, const unsigned char* data, size_t size)
+{
+  if (!socket)
+  {
+    return;
+  }
+
+  Header header;
+  header.type = type;
+  header.flags = flags;
+  header.sequence = sequence;
+  header.cumulative = nextReliableSequence;
+  header.latest = latestReliableSequence;
+  header.bits = getAckBits();
+
+  sendBuffer.resize(sizeof(header) + size);
+  std::memcpy(sendBuffer.data(), &header, sizeof(header));
+
+  if (size)
+  {
+    std::memcpy(sendBuffer.data() + sizeof(header), data, size);
+  }
+
+  ackPending = false;
+  lastSendTime = time();
+
+  if (loss > 0.0f && std::uniform_real_distribution<float>(0.0f, 1.0f)(random) < loss)
+  {
+    return;
+  }
+
+  asio::error_code error;
+  socket->socket.send_to(asio::buffer(sendBuffer), socket->remote, 0, error);
+}
+
+void Datagram::receive(const unsigned char* data, size_t size)
+{
+  if (size < sizeof(Header))
+  {
+    printf("network error: datagram is too small.\n");
+    return;
+  }
+
+  Header header;
+  std::memcpy(&header, data, sizeof(header));
+
+  const auto payload = data + sizeof(header);
+  const auto length = size - sizeof(header);
+
+  lastReceiveTime = time();
+
+  // A lost accept makes the peer retry, so every connect is answered.
+  if (header.type == Type::Connect)
+  {
+    if (listening)
+    {
+      transmit(Type::Accept, 0, 0, nullptr, 0);
+
+      if (!accepted)
+      {
+        accepted = true;
+
+        if (onOpen)
+        {
+          onOpen();
+        }
+      }
+    }
+
+    return;
+  }
+
+  if (header.type == Type::Accept)
+  {
+    if (!accepted)
+    {
+      accepted = true;
+
+      if (onOpen)
+      {
+        onOpen();
+      }
+    }
+
+    return;
+  }
+
+  if (header.type == Type::Disconnect)
+  {
+    disconnect();
+    return;
+  }
+
+  if (!accepted || (header.type != Type::Data && header.type != Type::Ack))
+  {
+    return;
+  }
+
+  acknowledge(header);
+
+  if (header.type != Type::Data)
+  {
+    return;
+  }
+
+  if (header.flags & FLAG_RELIABLE)
+  {
+    ackPending = true;
+
+    const auto distance = int16_t(header.sequence - nextReliableSequence);
+
+    if (distance < 0 || distance >= (int)WINDOW)
+    {
+      return;
+    }
+
+    auto& slot = incoming[header.sequence % WINDOW];
+
+    if (!slot.received)
+    {
+      slot.sequence = header.sequence;
+      slot.received = true;
+      slot.flags = header.flags;
+      slot.data.assign(payload, payload + length);
+    }
+
+    if (isNewer(header.sequence, latestReliableSequence))
+    {
+      latestReliableSequence = header.sequence;
+    }
+
+    deliver();
+  }
+  else
+  {
+    if (remoteUnreliableReceived && !isNewer(header.sequence, remoteUnreliableSequence))
+    {
+      return;
+    }
+
+    remoteUnreliableSequence = header.sequence;
+    remoteUnreliableReceived = true;
+
+    if (onMessage)
+    {
+      onMessage(payload, length, header.flags & FLAG_TEXT);
+    }
+  }
+}
+
+void Datagram::deliver()
+{
+  while (socket)
+  {
+    auto& slot = incoming[nextReliableSequence % WINDOW];
+
+    if (!slot.received || slot.sequence != nextReliableSequence)
+    {
+      break;
+    }
+
+    const auto flags = slot.flags;
+
+    assembly.insert(assembly.end(), slot.data.begin(), slot.data.end());
+
+    slot.received = false;
+    slot.data.clear();
+
+    nextReliableSequence++;
+
+    if (!(flags & FLAG_FRAGMENT))
+    {
+      auto message = std::move(assembly);
+      assembly.clear();
+
+      if (onMessage)
+      {
+        onMessage(message.data(), message.size(), flags & FLAG_TEXT);
+      }
+    }
+  }
+}
+
+void Datagram::acknowledge(const Header& header)
+{
+  const auto now = time();
+
+  for (auto packet = outgoing.begin(); packet != outgoing.end();)
+  {
+    if (!packet->sent)
+    {
+      packet++;
+      continue;
+    }
+
+    bool acknowledged = isNewer(header.cumulative, packet->sequence);
+
+    if (!acknowledged && !isNewer(header.cumulative, header.latest))
+    {
+      acknowledged = packet->sequence == header.latest;
+    }
+
+    if (!acknowledged && !isNewer(header.cumulative, header.latest))
+    {
+      const uint16_t distance = header.latest - 1 - packet->sequence;
+
+      acknowledged = distance < 32 && (header.bits >> distance) & 1;
+    }
+
+    if (!acknowledged)
+    {
+      packet++;
+      continue;
+    }
+
+    if (!packet->retransmitted)
+    {
+      const auto sample = now - packet->sentTime;
+
+      roundTripTime = roundTripTime > 0.0 ? roundTripTime * 0.875 + sample * 0.125 : sample;
+      retransmitTimeout = std::clamp(roundTripTime * 2.0, MIN_RETRANSMIT_TIMEOUT, MAX_RETRANSMIT_TIMEOUT);
+    }
+
+    window = std::min(window < threshold ? window + 1.0f : window + 1.0f / window, MAX_WINDOW);
+
+    packet = outgoing.erase(packet);
+  }
+
+  statistics.roundTripTime = float(roundTripTime * 1000.0);
+  statistics.window = window;
+}
+
+void Datagram::resend()
+{
+  if (outgoing.empty())
+  {
+    return;
+  }
+
+  const auto now = time();
+  const auto oldest = outgoing.front().sequence;
+
+  size_t inFlight = 0;
+  bool lost = false;
+
+  for (auto& packet : outgoing)
+  {
+    if (packet.sent)
+    {
+      if (now - packet.sentTime > retransmitTimeout)
+      {
+        transmit(Type::Data, packet.flags, packet.sequence, packet.data.data(), packet.data.size());
+
+        packet.sentTime = now;
+        packet.retransmitted = true;
+
+        statistics.retransmits++;
+        lost = true;
+      }
+
+      inFlight++;
+    }
+    else if (inFlight < size_t(window) && uint16_t(packet.sequence - oldest) < WINDOW)
+    {
+      transmit(Type::Data, packet.flags, packet.sequence, packet.data.data(), packet.data.size());
+
+      packet.sentTime = now;
+      packet.sent = true;
+
+      inFlight++;
+    }
+  }
+
+  if (lost)
+  {
+    threshold = std::max(window / 2.0f, 2.0f);
+    window = threshold;
+    retransmitTimeout = std::min(retransmitTimeout * 2.0, MAX_RETRANSMIT_TIMEOUT);
+
+    statistics.lost++;
+    statistics.window = window;
+  }
+}
+#endif
@@ -0,0 +1,147 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <memory>
+#include <functional>
+#include <random>
+#include <cstdint>
+
+class Datagram
+{
+public:
+  enum class Channel : uint8_t
+  {
+    Unreliable,
+    Reliable,
+  };
+
+  struct Statistics
+  {
+    float roundTripTime;
+    float window;
+    size_t retransmits;
+    size_t lost;
+  };
+
+  Datagram();
+  ~Datagram();
+
+  bool open(const std::string& host, unsigned short port);
+  bool listen(unsigned short port);
+  void close();
+  void poll();
+  void send(const unsigned char* data, size_t size, Channel channel, bool text = false);
+
+  void seed(unsigned int value);
+
+  bool isOpen();
+  size_t getBufferedAmount();
+  unsigned short getPort();
+
+  std::function<void()> onOpen;
+  std::function<void()> onClose;
+  std::function<void(const unsigned char* data, size_t size, bool text)> onMessage;
+
+  float loss;
+  Statistics statistics;
+
+private:
+  enum class Type : uint8_t
+  {
+    Connect,
+    Accept,
+    Data,
+    Ack,
+    Disconnect,
+  };
+
+  enum Flags : uint8_t
+  {
+    FLAG_RELIABLE = 1,
+    FLAG_TEXT = 2,
+    FLAG_FRAGMENT = 4,
+  };
+
+#pragma pack(push, 1)
+  struct Header
+  {
+    Type type;
+    uint8_t flags;
+    uint16_t sequence;
+    uint16_t cumulative;
+    uint16_t latest;
+    uint32_t bits;
+  };
+#pragma pack(pop)
+
+  struct Outgoing
+  {
+    uint16_t sequence;
+    uint8_t flags;
+    std::vector<unsigned char> data;
+    double sentTime;
+    bool sent;
+    bool retransmitted;
+  };
+
+  struct Incoming
+  {
+    uint16_t sequence;
+    bool received;
+    uint8_t flags;
+    std::vector<unsigned char> data;
+  };
+
+  struct Socket;
+
+  double time();
+  void reset();
+  void transmit(Type type, uint8_t flags, uint16_t sequence, const unsigned char* data, size_t size);
+  void receive(const unsigned char* data, size_t size);
+  void acknowledge(const Header& header);
+  void deliver();
+  void resend();
+  void disconnect();
+  uint32_t getAckBits();
+
+  std::unique_ptr<Socket> socket;
+  std::minstd_rand random;
+
+  bool accepted;
+  bool listening;
+
+  double openTime;
+  double lastSendTime;
+  double lastReceiveTime;
+  double lastConnectTime;
+  double roundTripTime;
+  double retransmitTimeout;
+
+  float window;
+  float threshold;
+
+  uint16_t unreliableSequence;
+  uint16_t remoteUnreliableSequence;
+  bool remoteUnreliableReceived;
+
+  uint16_t reliableSequence;
+  uint16_t nextReliableSequence;
+  uint16_t latestReliableSequence;
+  bool ackPending;
+
+  std::vector<Outgoing> outgoing;
+  std::vector<Incoming> incoming;
+  std::vector<unsigned char> assembly;
+  std::vector<unsigned char> sendBuffer;
+  std::vector<unsigned char> receiveBuffer;
+
+  constexpr static size_t MTU = 1200;
+  constexpr static size_t WINDOW = 256;
+  constexpr static float MAX_WINDOW = 128.0f;
+  constexpr static double CONNECT_INTERVAL = 0.25;
+  constexpr static double CONNECT_TIMEOUT = 5.0;
+  constexpr static double KEEPALIVE_INTERVAL = 1.0;
+  constexpr static double TIMEOUT = 10.0;
+  constexpr static double MIN_RETRANSMIT_TIMEOUT = 0.05;
+  constexpr static double MAX_RETRANSMIT_TIMEOUT = 2.0;
+};
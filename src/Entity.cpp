@@ -1,9 +1,12 @@
 #include "Entity.h"
-#include "Game.h"
 #include "Level.h"
 
-void Entity::init()
+#include <vector>
+
+void Entity::init(Level* level)
 {
+  this->level = level;
+
   onGround = false;
   horizontalCollision = false;
   collision = false;
@@ -81,21 +84,21 @@ void Entity::turn(float rx, float ry)
 bool Entity::isFree(float ax, float ay, float az) 
 {
   AABB aabb = this->aabb.move(ax, ay, az);
-  bool free = game.level.getTileAABBCount(aabb) > 0 ? false : !game.level.containsAnyLiquid(aabb);
+  bool free = level->getTileAABBCount(aabb) > 0 ? false : !level->containsAnyLiquid(aabb);
 
   return free;
 }
 
 bool Entity::isInWater() 
 {
-  return game.level.containsLiquid(aabb.grow(0.0f, -0.4f, 0.0f), Block::Type::BLOCK_WATER) ||
-    game.level.containsLiquid(aabb.grow(0.0f, -0.4f, 0.0f), Block::Type::BLOCK_STILL_WATER);
+  return level->containsLiquid(aabb.grow(0.0f, -0.4f, 0.0f), Block::Type::BLOCK_WATER) ||
+    level->containsLiquid(aabb.grow(0.0f, -0.4f, 0.0f), Block::Type::BLOCK_STILL_WATER);
 }
 
 bool Entity::isInLava() 
 {
-  return game.level.containsLiquid(aabb.grow(0.0f, -0.4f, 0.0f), Block::Type::BLOCK_LAVA) ||
-    game.level.containsLiquid(aabb.grow(0.0f, -0.4f, 0.0f), Block::Type::BLOCK_STILL_LAVA);
+  return level->containsLiquid(aabb.grow(0.0f, -0.4f, 0.0f), Block::Type::BLOCK_LAVA) ||
+    level->containsLiquid(aabb.grow(0.0f, -0.4f, 0.0f), Block::Type::BLOCK_STILL_LAVA);
 }
 
 void Entity::moveRelative(float x, float z, float speed) 
@@ -136,7 +139,9 @@ void Entity::move(float ax, float ay, float az)
     float oy = ay;
     float oz = az;
 
-    auto cubes = game.level.getTileAABB(aabb.expand(ax, ay, az));
+    // Kept between calls so moving does not allocate once it has grown to fit.
+    static thread_local std::vector<AABB> cubes;
+    level->getTileAABB(aabb.expand(ax, ay, az), cubes);
 
     ///////////////////////////////////////////////////////
 
@@ -202,7 +207,7 @@ void Entity::move(float ax, float ay, float az)
       AABB tempAABB = aabb;
       aabb = oldAABB;
 
-      cubes = game.level.getTileAABB(aabb.expand(ox, ay, oz));
+      level->getTileAABB(aabb.expand(ox, ay, oz), cubes);
 
       for (size_t i = 0; i < cubes.size(); i++)
       {
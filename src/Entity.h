@@ -3,10 +3,12 @@
 
 #include <glm/glm.hpp>
 
+class Level;
+
 class Entity
 {
 public:
-  void init();
+  void init(Level* level);
   void tick();
 
   void setSize(float w, float h);
@@ -31,6 +33,8 @@ public:
 
   AABB aabb;
 protected:
+  Level* level;
+
   bool noPhysics;
   bool onGround;
   bool collision;
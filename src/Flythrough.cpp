@@ -0,0 +1,275 @@
+#include "Flythrough.h"
+#include "Game.h"
+#include "Level.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+
+static glm::vec2 getRotation(const glm::vec3& position, const glm::vec3& target)
+{
+  const auto direction = glm::normalize(target - position);
+
+  return glm::vec2(-glm::degrees(std::atan2(direction.x, direction.z)), glm::degrees(std::asin(direction.y)));
+}
+
+static void writeStatistics(FILE* file, const char* name, const std::vector<double>& values, bool last = false)
+{
+  auto sorted = values;
+  std::sort(sorted.begin(), sorted.end());
+
+  double total = 0.0;
+  for (auto value : sorted)
+  {
+    total += value;
+  }
+
+  auto percentile = [&](double p) {
+    const auto rank = size_t(std::ceil(p / 100.0 * double(sorted.size())));
+    return sorted[std::min(sorted.size() - 1, rank > 0 ? rank - 1 : 0)];
+  };
+
+  fprintf(
+    file,
+    "  \"%s\": {\"mean\": %.3f, \"p50\": %.3f, \"p90\": %.3f, \"p95\": %.3f, \"p99\": %.3f, \"max\": %.3f, \"total\": %.3f}%s\n",
+    name,
+    total / double(sorted.size()),
+    percentile(50.0),
+    percentile(90.0),
+    percentile(95.0),
+    percentile(99.0),
+    sorted.back(),
+    total,
+    last ? "" : ","
+  );
+}
+
+void Flythrough::init()
+{
+#if !defined(EMSCRIPTEN) && !defined(ANDROID) && !TARGET_OS_IPHONE
+  const char* report = std::getenv("CUBIC_FLYTHROUGH");
+  if (!report)
+  {
+    return;
+  }
+
+  reportPath = report;
+  active = true;
+
+  if (const char* fixedSeed = std::getenv("CUBIC_SEED"))
+  {
+    seed = std::strtoull(fixedSeed, nullptr, 10);
+  }
+
+  const char* path = std::getenv("CUBIC_FLYTHROUGH_PATH");
+  if (!path || !loadPath(path))
+  {
+    loadDefaultPath();
+  }
+
+  game.levelGenerator.setSeed(seed);
+
+  // Nearly every frame on a software renderer is over budget, a hitch capture per frame would only add noise.
+  game.profiler.hitchBudget = 0.0f;
+
+  SDL_GL_SetSwapInterval(0);
+#endif
+}
+
+bool Flythrough::loadPath(const std::string& path)
+{
+  FILE* file = fopen(path.c_str(), "rb");
+  if (!file)
+  {
+    printf("flythrough error: failed to open %s.\n", path.c_str());
+    return false;
+  }
+
+  keyframes.clear();
+
+  char line[256];
+  while (fgets(line, sizeof(line), file))
+  {
+    Keyframe keyframe;
+
+    if (sscanf(line, "%f %f %f %f %f", &keyframe.position.x, &keyframe.position.y, &keyframe.position.z, &keyframe.rotation.x, &keyframe.rotation.y) == 5)
+    {
+      keyframes.push_back(keyframe);
+    }
+  }
+
+  fclose(file);
+
+  if (keyframes.size() < 2)
+  {
+    printf("flythrough error: %s needs at least two keyframes.\n", path.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+void Flythrough::loadDefaultPath()
+{
+  const glm::vec3 size(Level::WIDTH, Level::HEIGHT, Level::DEPTH);
+  const glm::vec3 center = size * 0.5f;
+  const glm::vec3 ahead = size * glm::vec3(1.0f, 0.5f, 0.5f);
+
+  const glm::vec3 points[][2] = {
+    // Circle the level from above, looking at its center.
+    { size * glm::vec3(0.05f, 0.8f, 0.05f), center },
+    { size * glm::vec3(0.95f, 0.8f, 0.05f), center },
+    { size * glm::vec3(0.95f, 0.65f, 0.95f), center },
+    { size * glm::vec3(0.05f, 0.6f, 0.95f), center },
+    // Skim the water towards the far edge, then climb and look straight down.
+    { size * glm::vec3(0.2f, 0.55f, 0.5f), ahead },
+    { size * glm::vec3(0.8f, 0.55f, 0.5f), ahead },
+    { size * glm::vec3(0.5f, 1.25f, 0.5f), size * glm::vec3(0.5f, 0.0f, 0.51f) },
+  };
+
+  keyframes.clear();
+
+  for (const auto& point : points)
+  {
+    keyframes.push_back({ point[0], getRotation(point[0], point[1]) });
+  }
+}
+
+void Flythrough::update()
+{
+  if (!active || !game.levelGenerator.isFinished())
+  {
+    return;
+  }
+
+  if (game.ui.state != UI::State::None)
+  {
+    game.ui.closeMenu();
+  }
+
+  started = true;
+
+  // The camera advances by frame rather than by time, so every run renders exactly the same views.
+  const int index = int(frames.size());
+  const int segment = glm::min(index / FRAMES_PER_KEYFRAME, int(keyframes.size()) - 2);
+  const float t = float(index - segment * FRAMES_PER_KEYFRAME) / float(FRAMES_PER_KEYFRAME);
+
+  const auto& from = keyframes[segment];
+  const auto& to = keyframes[segment + 1];
+
+  const auto position = glm::mix(from.position, to.position, t);
+  const float yaw = from.rotation.x + (glm::mod(to.rotation.x - from.rotation.x + 540.0f, 360.0f) - 180.0f) * t;
+  const float pitch = glm::clamp(glm::mix(from.rotation.y, to.rotation.y, t), -89.9f, 89.9f);
+
+  auto& player = game.localPlayer;
+  player.noPhysics = true;
+  player.setPosition(position.x, position.y, position.z);
+  player.rotation = glm::vec2(yaw, pitch);
+  player.oldRotation = player.rotation;
+}
+
+void Flythrough::endFrame()
+{
+  if (!started)
+  {
+    return;
+  }
+
+  const auto now = std::chrono::steady_clock::now();
+
+  // The frame that finished loading the level is only partly ours, timing starts with the next one.
+  if (lastFrame == std::chrono::steady_clock::time_point())
+  {
+    lastFrame = now;
+    return;
+  }
+
+  Frame frame;
+  frame.frameTime = std::chrono::duration<float, std::milli>(now - lastFrame).count();
+  frame.renderTime = game.profiler.getHistory(Profiler::Scope::Frame, 0);
+  frame.drawCalls = game.profiler.getCount(Profiler::Counter::DrawCalls);
+  frame.vertices = game.profiler.getCount(Profiler::Counter::Vertices);
+  frame.chunkUpdates = game.profiler.getCount(Profiler::Counter::ChunkUpdates);
+  frame.allocations = game.profiler.getAllocations(Profiler::Scope::Frame, 0);
+
+  frames.push_back(frame);
+  lastFrame = now;
+
+  if (frames.size() > (keyframes.size() - 1) * FRAMES_PER_KEYFRAME)
+  {
+    std::exit(writeReport() ? EXIT_SUCCESS : EXIT_FAILURE);
+  }
+}
+
+bool Flythrough::writeReport()
+{
+  FILE* file = fopen(reportPath.c_str(), "wb");
+  if (!file)
+  {
+    printf("flythrough error: failed to open %s.\n", reportPath.c_str());
+    return false;
+  }
+
+  auto collect = [&](auto field) {
+    std::vector<double> values;
+
+    for (const auto& frame : frames)
+    {
+      values.push_back(double(frame.*field));
+    }
+
+    return values;
+  };
+
+  const char* renderer = (const char*)glGetString(GL_RENDERER);
+
+  fprintf(file, "{\n");
+  fprintf(file, "  \"seed\": %llu,\n", (unsigned long long)seed);
+  fprintf(file, "  \"renderer\": \"%s\",\n", renderer ? renderer : "unknown");
+  fprintf(file, "  \"width\": %d,\n", game.width);
+  fprintf(file, "  \"height\": %d,\n", game.height);
+  fprintf(file, "  \"frames\": %zu,\n", frames.size());
+
+  writeStatistics(file, "frame_ms", collect(&Frame::frameTime));
+  writeStatistics(file, "render_ms", collect(&Frame::renderTime));
+  writeStatistics(file, "draw_calls", collect(&Frame::drawCalls));
+  writeStatistics(file, "vertices", collect(&Frame::vertices));
+  writeStatistics(file, "chunk_updates", collect(&Frame::chunkUpdates), !AllocationTracker::ENABLED);
+
+  if (AllocationTracker::ENABLED)
+  {
+    writeStatistics(file, "allocations", collect(&Frame::allocations), true);
+  }
+
+  fprintf(file, "}\n");
+
+  if (fclose(file) != 0)
+  {
+    printf("flythrough error: failed to write %s.\n", reportPath.c_str());
+    return false;
+  }
+
+  printf("Wrote flythrough report for %zu frames to %s\n", frames.size(), reportPath.c_str());
+
+  return true;
+}
+
+void Flythrough::record()
+{
+  const auto path = (std::filesystem::path(game.path) / FILENAME).u8string();
+
+  FILE* file = fopen(path.c_str(), "ab");
+  if (!file)
+  {
+    game.ui.log("Failed to open %s", FILENAME);
+    return;
+  }
+
+  const auto& player = game.localPlayer;
+  fprintf(file, "%.3f %.3f %.3f %.3f %.3f\n", player.position.x, player.position.y, player.position.z, player.rotation.x, player.rotation.y);
+  fclose(file);
+
+  game.ui.log("Added a keyframe to %s", FILENAME);
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <glm/glm.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Flythrough
+{
+public:
+  void init();
+  void update();
+  void endFrame();
+  void record();
+
+  bool active = false;
+
+private:
+  struct Keyframe
+  {
+    glm::vec3 position;
+    glm::vec2 rotation;
+  };
+
+  struct Frame
+  {
+    float frameTime;
+    float renderTime;
+    size_t drawCalls;
+    size_t vertices;
+    size_t chunkUpdates;
+    size_t allocations;
+  };
+
+  bool loadPath(const std::string& path);
+  void loadDefaultPath();
+  bool writeReport();
+
+  std::vector<Keyframe> keyframes;
+  std::vector<Frame> frames;
+  std::string reportPath;
+  uint64_t seed = DEFAULT_SEED;
+
+  bool started = false;
+  std::chrono::steady_clock::time_point lastFrame;
+
+  constexpr static uint64_t DEFAULT_SEED = 1;
+  constexpr static int FRAMES_PER_KEYFRAME = 120;
+  constexpr static const char* FILENAME = "Flythrough.txt";
+};
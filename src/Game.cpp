@@ -6,12 +6,13 @@
 #include "ShaderManager.h"
 #include "Random.h"
 #include "Timer.h"
-#include "Resources.h"
+#include "Baked.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp> 
 #include <ctime>
 #include <cstdio>
+#include <filesystem>
 
 #if defined(EMSCRIPTEN)
 #include <emscripten/html5.h>
@@ -112,17 +113,28 @@ void Game::init(SDL_Window* window_)
   modelMatrixUniform = glGetUniformLocation(shader, "model");
 
   window = window_;
+  jobs.init();
   random.init(std::time(nullptr));
   timer.init(TICK_RATE);
   localPlayer.init();
   network.init();
+  level.network = &network;
+  level.levelRenderer = &levelRenderer;
+  level.journal = &journal;
+  textureManager.init();
+  flythrough.init();
+  replay.init();
   ui.init();
   heldBlock.init();
   selectedBlock.init();
   levelGenerator.init();
+  levelStorage.init();
+  journal.init();
   levelRenderer.init();
+  profiler.init();
   lastTick = timer.milliTime();
-  atlasTexture = textureManager.load(terrainResourceTexture, sizeof(terrainResourceTexture));
+  lastProfilerUpdate = lastTick;
+  atlasTexture = textureManager.load(terrainBakedTexture, "terrain", &atlasScale);
   frameRate = 0;
   fullscreen = false;
 
@@ -146,18 +158,24 @@ void Game::init(SDL_Window* window_)
 void Game::render()
 {
   timer.update();
+  replay.beginFrame();
+  profiler.beginFrame();
 
-  for (int i = 0; i < timer.deltaTicks; i++)
-  {
-    localPlayer.tick();
-    particleManager.tick();
-    level.tick();
-    levelRenderer.tick();
-    heldBlock.tick();
-    network.tick();
-    ui.tick();
-    timer.tick();
-  }
+  profiler.measure(Profiler::Scope::Tick, [&] {
+    for (int i = 0; i < timer.deltaTicks; i++)
+    {
+      replay.tick();
+      profiler.measure(Profiler::Scope::PlayerTick, [&] { localPlayer.tick(); });
+      profiler.measure(Profiler::Scope::ParticleTick, [&] { particleManager.tick(); });
+      profiler.measure(Profiler::Scope::LevelTick, [&] { level.tick(); });
+      profiler.measure(Profiler::Scope::JournalTick, [&] { journal.tick(); });
+      profiler.measure(Profiler::Scope::LevelRendererTick, [&] { levelRenderer.tick(); });
+      profiler.measure(Profiler::Scope::HeldBlockTick, [&] { heldBlock.tick(); });
+      profiler.measure(Profiler::Scope::NetworkTick, [&] { network.tick(); });
+      profiler.measure(Profiler::Scope::UITick, [&] { ui.tick(); });
+      timer.tick();
+    }
+  });
 
   glClearColor(fogColor.r, fogColor.g, fogColor.b, fogColor.a);
   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -169,28 +187,36 @@ void Game::render()
   glUniform1f(fogDistanceUniform, fogDistance);
   glUniform4fv(fogColorUniform, 1, glm::value_ptr(fogColor));
 
-  levelGenerator.update();
-  localPlayer.update();
-  frustum.update();
+  profiler.measure(Profiler::Scope::Generator, [&] { levelGenerator.update(); });
+  profiler.measure(Profiler::Scope::Storage, [&] { levelStorage.update(); });
+  profiler.measure(Profiler::Scope::MainThreadJobs, [&] { jobs.update(); });
+  flythrough.update();
+
+  profiler.measure(Profiler::Scope::PlayerUpdate, [&] {
+    localPlayer.update();
+    frustum.update();
+  });
 
   glUniformMatrix4fv(viewMatrixUniform, 1, GL_FALSE, glm::value_ptr(viewMatrix));
   
-  network.render();
-  levelRenderer.render();
-  particleManager.render();
+  profiler.measure(Profiler::Scope::NetworkRender, [&] { network.render(); });
+  profiler.measure(Profiler::Scope::LevelRender, [&] { levelRenderer.render(); });
+  profiler.measure(Profiler::Scope::ParticleRender, [&] { particleManager.render(); });
 
-  selectedBlock.renderPost();
-  levelRenderer.renderPost();
+  profiler.measure(Profiler::Scope::PostRender, [&] {
+    selectedBlock.renderPost();
+    levelRenderer.renderPost();
+  });
 
   glClear(GL_DEPTH_BUFFER_BIT);
   glUniform1f(fogEnableUniform, 1.0f);
   glUniformMatrix4fv(viewMatrixUniform, 1, GL_FALSE, glm::value_ptr(IDENTITY_MATRIX));
 
-  heldBlock.render();
+  profiler.measure(Profiler::Scope::HeldBlockRender, [&] { heldBlock.render(); });
 
   glUniformMatrix4fv(projectionMatrixUniform, 1, GL_FALSE, glm::value_ptr(orthographicProjectionMatrix));
 
-  ui.render();
+  profiler.measure(Profiler::Scope::UIRender, [&] { ui.render(); });
 
   frameRate++;
   if (timer.milliTime() - lastTick > 1000.0f)
@@ -201,13 +227,28 @@ void Game::render()
     frameRate = 0;
     chunkUpdates = 0;
     lastTick = timer.milliTime();
+    lastProfilerUpdate = lastTick;
 
-    ui.update();
+    profiler.measure(Profiler::Scope::UIUpdate, [&] { ui.update(); });
+  }
+  else if (profiler.visible && timer.milliTime() - lastProfilerUpdate > Profiler::REFRESH_INTERVAL)
+  {
+    lastProfilerUpdate = timer.milliTime();
+
+    profiler.measure(Profiler::Scope::UIUpdate, [&] { ui.update(); });
   }
+
+  profiler.endFrame();
+  flythrough.endFrame();
 }
 
 void Game::input(const SDL_Event& event)
 {
+  if (!replay.input(event))
+  {
+    return;
+  }
+
   if (event.type == SDL_WINDOWEVENT)
   {
     if (event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED)
@@ -258,6 +299,28 @@ void Game::input(const SDL_Event& event)
   else if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F2)
   {
     ui.log("Players: %d", network.count());
+    ui.log(
+      "Send queue: %d bytes, %d packets per tick, %d positions dropped",
+      int(network.statistics.bufferedAmount),
+      int(network.statistics.queuedPackets),
+      int(network.statistics.droppedPositions)
+    );
+    ui.log(
+      "Host limits: %d edits limited, %d edits rejected, %d positions limited, %d positions clamped",
+      int(network.statistics.limitedEdits),
+      int(network.statistics.rejectedEdits),
+      int(network.statistics.limitedPositions),
+      int(network.statistics.clampedPositions)
+    );
+
+    if (network.transport == Network::Transport::Datagram)
+    {
+      ui.log(
+        "Datagram: %d ms round trip, %d retransmits",
+        int(network.statistics.roundTripTime),
+        int(network.statistics.retransmits)
+      );
+    }
   }
   else if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F3)
   {
@@ -280,7 +343,7 @@ void Game::input(const SDL_Event& event)
       return crc;
     };
 
-    auto hash = crc32(level.blocks, std::size(level.blocks));
+    auto hash = crc32(level.blocks, Level::VOLUME);
     ui.log("CRC32 checksum: %X", hash);
   }
   else if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F4)
@@ -292,6 +355,30 @@ void Game::input(const SDL_Event& event)
     ui.isTouch = !ui.isTouch;
     resize();
   }
+  else if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F6)
+  {
+    profiler.visible = !profiler.visible;
+    ui.update();
+  }
+  else if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F7)
+  {
+    if (!profiler.tracing)
+    {
+      ui.log("Tracing is disabled");
+    }
+    else if (profiler.exportTrace((std::filesystem::path(path) / "Trace.json").u8string()))
+    {
+      ui.log("Saving trace to Trace.json");
+    }
+    else
+    {
+      ui.log("A trace is already being saved");
+    }
+  }
+  else if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F8)
+  {
+    flythrough.record();
+  }
   else if (
     event.type == SDL_KEYDOWN || 
     event.type == SDL_CONTROLLERBUTTONDOWN ||
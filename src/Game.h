@@ -4,6 +4,7 @@
 #include "TextureManager.h"
 #include "ShaderManager.h"
 #include "LevelGenerator.h"
+#include "LevelStorage.h"
 #include "Level.h"
 #include "Random.h"
 #include "Timer.h"
@@ -13,6 +14,11 @@
 #include "UI.h"
 #include "Frustum.h"
 #include "Network.h"
+#include "Journal.h"
+#include "Profiler.h"
+#include "Flythrough.h"
+#include "Replay.h"
+#include "JobSystem.h"
 
 #include <SDL2/SDL.h>
 #include <GL/glew.h>
@@ -26,6 +32,10 @@ public:
   void render();
   void resize();
 
+  // Declared first so they are destroyed last, after every subsystem whose threads still profile or wait on jobs.
+  Profiler profiler;
+  JobSystem jobs;
+
   TextureManager textureManager;
   ShaderManager shaderManager;
   ParticleManager particleManager;
@@ -34,18 +44,23 @@ public:
   SelectedBlock selectedBlock;
   LevelRenderer levelRenderer;
   LevelGenerator levelGenerator;
+  LevelStorage levelStorage;
   Level level;
   Random random;
   Timer timer;
   UI ui;
   Frustum frustum;
   Network network;
+  Journal journal;
+  Flythrough flythrough;
+  Replay replay;
 
   SDL_Window* window;
   SDL_GameController* controller;
 
   GLuint shader;
   GLuint atlasTexture;
+  unsigned int atlasScale;
 
   GLuint projectionMatrixUniform;
   GLuint viewMatrixUniform;
@@ -74,6 +89,7 @@ public:
   float scaledWidth;
 
   uint64_t lastTick;
+  uint64_t lastProfilerUpdate;
   uint64_t lastChunkUpdates;
   uint64_t lastFrameRate;
   uint64_t frameRate;
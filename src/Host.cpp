@@ -0,0 +1,167 @@
+#include "Host.h"
+
+#if !defined(EMSCRIPTEN)
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+Host::~Host()
+{
+  stop();
+}
+
+void Host::init(JobSystem* jobs_, float ticksPerSecond)
+{
+  stop();
+
+  jobs = jobs_;
+  rooms.clear();
+
+  tickLength = 1.0f / ticksPerSecond;
+  maxTickTime = 0.0f;
+  averageTickTime = 0.0f;
+}
+
+void Host::start()
+{
+  if (running)
+  {
+    return;
+  }
+
+  running = true;
+  thread = std::thread(&Host::run, this);
+}
+
+void Host::stop()
+{
+  running = false;
+
+  if (thread.joinable())
+  {
+    thread.join();
+  }
+}
+
+void Host::tick()
+{
+  const auto start = std::chrono::steady_clock::now();
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  // One shard of rooms per thread, so a room never moves between threads within a tick.
+  const int count = int(rooms.size());
+  const int grain = std::max((count + jobs->getThreadCount() - 1) / jobs->getThreadCount(), 1);
+
+  jobs->parallelFor(0, count, grain, [this](int begin, int end) {
+    for (int i = begin; i < end; i++)
+    {
+      tick(*rooms[i]);
+    }
+  });
+
+  const auto tickTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  maxTickTime = std::max(maxTickTime, tickTime);
+  averageTickTime = averageTickTime * 0.95f + tickTime * 0.05f;
+}
+
+Host::Room* Host::create(const std::string& id, const unsigned char* blocks)
+{
+  auto room = std::make_unique<Room>();
+  room->id = id;
+  room->level.init();
+
+  std::memcpy(room->level.blocks, blocks, Level::VOLUME);
+
+  room->level.calculateLightDepths(0, 0, Level::WIDTH, Level::DEPTH);
+  room->level.calculateSpawnPosition();
+  room->level.reset();
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  rooms.push_back(std::move(room));
+
+  return rooms.back().get();
+}
+
+void Host::destroy(Room* room)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  rooms.erase(
+    std::remove_if(rooms.begin(), rooms.end(), [room](const std::unique_ptr<Room>& other) { return other.get() == room; }),
+    rooms.end()
+  );
+}
+
+size_t Host::join(Room* room, const glm::vec3& position)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  Entity player;
+  player.init(&room->level);
+  player.setPosition(position.x, position.y, position.z);
+
+  room->players.push_back(player);
+
+  return room->players.size() - 1;
+}
+
+Host::Statistics Host::getStatistics()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  Statistics statistics = {};
+  statistics.rooms = rooms.size();
+  statistics.maxTickTime = maxTickTime;
+  statistics.averageTickTime = averageTickTime;
+
+  for (const auto& room : rooms)
+  {
+    statistics.players += room->players.size();
+  }
+
+  return statistics;
+}
+
+void Host::run()
+{
+  using clock = std::chrono::steady_clock;
+
+  const auto period = std::chrono::duration_cast<clock::duration>(std::chrono::duration<float>(tickLength));
+
+  auto next = clock::now();
+
+  while (running)
+  {
+    tick();
+
+    next += period;
+
+    if (next < clock::now())
+    {
+      next = clock::now();
+    }
+
+    std::this_thread::sleep_until(next);
+  }
+}
+
+void Host::tick(Room& room)
+{
+  room.level.tick();
+
+  for (auto& player : room.players)
+  {
+    // Players walk with the velocity their last input gave them, falling and slowing down as the local player does.
+    player.tick();
+    player.move(player.velocity.x, player.velocity.y, player.velocity.z);
+
+    player.velocity.x *= 0.91f;
+    player.velocity.y *= 0.98f;
+    player.velocity.z *= 0.91f;
+    player.velocity.y -= 0.08f;
+  }
+}
+#endif
@@ -0,0 +1,63 @@
+#pragma once
+#include "Entity.h"
+#include "JobSystem.h"
+#include "Level.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Holds many rooms in one process, each with its own level and players, and ticks them all at a fixed rate with the
+// rooms shared out across the job pool. Nothing in a room reaches through the global game, so rooms can tick on
+// different threads at once.
+class Host
+{
+public:
+  struct Room
+  {
+    std::string id;
+    std::vector<Entity> players;
+
+    Level level;
+  };
+
+  struct Statistics
+  {
+    size_t rooms;
+    size_t players;
+    float maxTickTime;
+    float averageTickTime;
+  };
+
+  ~Host();
+
+  void init(JobSystem* jobs, float ticksPerSecond);
+  void start();
+  void stop();
+  void tick();
+
+  Room* create(const std::string& id, const unsigned char* blocks);
+  void destroy(Room* room);
+  size_t join(Room* room, const glm::vec3& position);
+
+  Statistics getStatistics();
+
+private:
+  void run();
+  void tick(Room& room);
+
+  JobSystem* jobs = nullptr;
+
+  std::mutex mutex;
+  std::vector<std::unique_ptr<Room>> rooms;
+
+  std::thread thread;
+  std::atomic<bool> running = { false };
+  float tickLength;
+
+  float maxTickTime;
+  float averageTickTime;
+};
@@ -0,0 +1,248 @@
+#include "JobSystem.h"
+#include "Game.h"
+
+#include <cstdlib>
+
+// Workers own queues 1 and up. Every other thread, the main thread included, shares queue 0.
+static thread_local int queueIndex = 0;
+
+JobSystem::~JobSystem()
+{
+  {
+    std::lock_guard<std::mutex> lock(sleepMutex);
+    stopping = true;
+  }
+
+  sleepCondition.notify_all();
+
+  for (auto& worker : workers)
+  {
+    worker.join();
+  }
+}
+
+void JobSystem::init()
+{
+#if !defined(EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+  int count = int(std::thread::hardware_concurrency()) - 1;
+
+  if (const char* threads = std::getenv("CUBIC_JOB_THREADS"))
+  {
+    count = std::atoi(threads);
+  }
+
+  workerCount = std::clamp(count, 0, MAX_WORKERS);
+  workers.reserve(workerCount);
+
+  for (int i = 0; i < workerCount; i++)
+  {
+    workers.emplace_back(&JobSystem::work, this, i + 1);
+  }
+#endif
+}
+
+void JobSystem::update()
+{
+  {
+    std::lock_guard<std::mutex> lock(mainThreadMutex);
+    runningMainThreadJobs.swap(mainThreadJobs);
+  }
+
+  for (auto& function : runningMainThreadJobs)
+  {
+    function();
+  }
+
+  runningMainThreadJobs.clear();
+
+  // Without workers nothing else will pick up jobs that nobody waits on.
+  if (workerCount == 0)
+  {
+    while (Handle job = pop())
+    {
+      run(job);
+    }
+  }
+}
+
+JobSystem::Handle JobSystem::schedule(std::function<void()> function, const std::vector<Handle>& dependencies)
+{
+  Handle job = std::make_shared<Job>();
+  job->function = std::move(function);
+  job->claimed = false;
+  job->finished = false;
+
+  // The extra dependency keeps the job from being pushed by a dependency finishing before we are done here.
+  job->dependencies = int(dependencies.size()) + 1;
+
+  for (const auto& dependency : dependencies)
+  {
+    std::lock_guard<std::mutex> lock(dependency->mutex);
+
+    if (dependency->finished)
+    {
+      job->dependencies--;
+    }
+    else
+    {
+      dependency->dependents.push_back(job);
+    }
+  }
+
+  if (--job->dependencies == 0)
+  {
+    push(job);
+  }
+
+  return job;
+}
+
+void JobSystem::wait(const Handle& job)
+{
+  while (!job->finished)
+  {
+    Handle other;
+
+    if (job->dependencies == 0 && !job->claimed.exchange(true))
+    {
+      // Its queue entry is skipped by whoever pops it later.
+      run(job);
+    }
+    else if (workerCount == 0 && (other = pop()))
+    {
+      run(other);
+    }
+    else
+    {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void JobSystem::runOnMainThread(std::function<void()> function)
+{
+  std::lock_guard<std::mutex> lock(mainThreadMutex);
+  mainThreadJobs.push_back(std::move(function));
+}
+
+int JobSystem::getThreadCount() const
+{
+  return workerCount + 1;
+}
+
+void JobSystem::work(int index)
+{
+  queueIndex = index;
+
+  while (!stopping)
+  {
+    if (Handle job = pop())
+    {
+      run(job);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(sleepMutex);
+    sleepCondition.wait(lock, [this]() { return stopping || queued > 0; });
+  }
+}
+
+void JobSystem::push(const Handle& job)
+{
+  {
+    auto& queue = queues[queueIndex];
+
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.jobs.push_back(job);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(sleepMutex);
+    queued++;
+  }
+
+  sleepCondition.notify_one();
+}
+
+JobSystem::Handle JobSystem::pop()
+{
+  while (Handle job = take())
+  {
+    if (!job->claimed.exchange(true))
+    {
+      return job;
+    }
+  }
+
+  return nullptr;
+}
+
+JobSystem::Handle JobSystem::take()
+{
+  if (queued == 0)
+  {
+    return nullptr;
+  }
+
+  // Take the newest job from our own queue, it is the most likely to still be in cache, otherwise steal the oldest
+  // job from someone else's.
+  {
+    auto& queue = queues[queueIndex];
+
+    std::lock_guard<std::mutex> lock(queue.mutex);
+
+    if (!queue.jobs.empty())
+    {
+      Handle job = std::move(queue.jobs.back());
+      queue.jobs.pop_back();
+      queued--;
+
+      return job;
+    }
+  }
+
+  const int count = workerCount + 1;
+
+  for (int i = 1; i < count; i++)
+  {
+    auto& queue = queues[(queueIndex + i) % count];
+
+    std::lock_guard<std::mutex> lock(queue.mutex);
+
+    if (!queue.jobs.empty())
+    {
+      Handle job = std::move(queue.jobs.front());
+      queue.jobs.pop_front();
+      queued--;
+
+      return job;
+    }
+  }
+
+  return nullptr;
+}
+
+void JobSystem::run(const Handle& job)
+{
+  {
+    Profiler::Sample sample(Profiler::Scope::Job);
+    job->function();
+  }
+
+  std::vector<Handle> dependents;
+
+  {
+    std::lock_guard<std::mutex> lock(job->mutex);
+
+    job->finished = true;
+    dependents.swap(job->dependents);
+  }
+
+  for (const auto& dependent : dependents)
+  {
+    if (--dependent->dependencies == 0)
+    {
+      push(dependent);
+    }
+  }
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class JobSystem
+{
+public:
+  struct Job
+  {
+    std::function<void()> function;
+    std::atomic<int> dependencies;
+    std::atomic<bool> claimed;
+    std::atomic<bool> finished;
+
+    std::mutex mutex;
+    std::vector<std::shared_ptr<Job>> dependents;
+  };
+
+  using Handle = std::shared_ptr<Job>;
+
+  ~JobSystem();
+
+  void init();
+  void update();
+
+  Handle schedule(std::function<void()> function, const std::vector<Handle>& dependencies = {});
+  // Runs the job on the calling thread if no worker has started it yet, and nothing else, so waiting on a job can't
+  // pick up unrelated background work. Only without workers does it run other jobs, while the job's dependencies are
+  // still pending.
+  void wait(const Handle& job);
+  void runOnMainThread(std::function<void()> function);
+
+  int getThreadCount() const;
+
+  // Splits [begin, end) into ranges of at most grain items, runs them on the pool and returns once all are done. The
+  // first range runs on the calling thread, so a range that fits in one never schedules, or allocates, anything.
+  template <typename Function>
+  void parallelFor(int begin, int end, int grain, Function function)
+  {
+    if (begin >= end)
+    {
+      return;
+    }
+
+    std::vector<Handle> jobs;
+
+    for (int from = begin + grain; from < end; from += grain)
+    {
+      const int to = std::min(from + grain, end);
+
+      jobs.push_back(schedule([&function, from, to]() { function(from, to); }));
+    }
+
+    function(begin, std::min(begin + grain, end));
+
+    for (const auto& job : jobs)
+    {
+      wait(job);
+    }
+  }
+
+private:
+  struct Queue
+  {
+    std::mutex mutex;
+    std::deque<Handle> jobs;
+  };
+
+  void work(int index);
+  void push(const Handle& job);
+  Handle pop();
+  Handle take();
+  void run(const Handle& job);
+
+  constexpr static int MAX_WORKERS = 15;
+
+  std::vector<std::thread> workers;
+  int workerCount = 0;
+  Queue queues[MAX_WORKERS + 1];
+
+  std::atomic<int> queued = { 0 };
+  std::atomic<bool> stopping = { false };
+  std::mutex sleepMutex;
+  std::condition_variable sleepCondition;
+
+  std::mutex mainThreadMutex;
+  std::vector<std::function<void()>> mainThreadJobs;
+  std::vector<std::function<void()>> runningMainThreadJobs;
+};
@@ -0,0 +1,252 @@
+#include "Journal.h"
+#include "Game.h"
+
+#include <filesystem>
+#include <cstring>
+
+#if defined(EMSCRIPTEN)
+#include <emscripten/emscripten.h>
+#endif
+
+Journal::~Journal()
+{
+#if !defined(EMSCRIPTEN)
+  if (thread.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+
+    condition.notify_one();
+    thread.join();
+  }
+#endif
+
+  if (file)
+  {
+    fclose(file);
+  }
+}
+
+void Journal::init()
+{
+  active = false;
+  ticks = 0;
+  journalSize = 0;
+  file = nullptr;
+  stopping = false;
+}
+
+void Journal::tick()
+{
+  if (!active)
+  {
+    return;
+  }
+
+  ticks++;
+
+  if (ticks % COMPACT_INTERVAL == 0 || journalSize > MAX_JOURNAL_SIZE)
+  {
+    compact();
+  }
+  else if (ticks % FLUSH_INTERVAL == 0)
+  {
+    flush();
+  }
+}
+
+void Journal::record(int x, int y, int z, unsigned char oldType, unsigned char newType, unsigned int tick)
+{
+  if (!active)
+  {
+    return;
+  }
+
+  Record record;
+  record.x = uint8_t(x);
+  record.y = uint8_t(y);
+  record.z = uint8_t(z);
+  record.oldType = oldType;
+  record.newType = newType;
+  record.tick = tick;
+
+  const auto data = reinterpret_cast<const unsigned char*>(&record);
+  pending.insert(pending.end(), data, data + sizeof(record));
+}
+
+void Journal::compact()
+{
+  // Flythroughs and replays stay offline, so the journal of the level the player was last playing is left alone.
+  if (game.flythrough.active || game.replay.isReplaying())
+  {
+    return;
+  }
+
+  if (!active)
+  {
+    path = (std::filesystem::path(game.path) / FILENAME).u8string();
+    active = true;
+
+#if !defined(EMSCRIPTEN)
+    thread = std::thread(&Journal::work, this);
+#endif
+  }
+
+  flush();
+
+  Job job;
+  job.compact = true;
+  job.snapshot.blocks.assign(game.level.blocks, game.level.blocks + Level::VOLUME);
+  job.snapshot.seed = game.level.seed;
+  job.snapshot.spawn = game.level.spawn;
+  job.snapshot.hasSpawn = true;
+
+  journalSize = 0;
+
+  submit(std::move(job));
+}
+
+void Journal::flush()
+{
+  if (pending.empty())
+  {
+    return;
+  }
+
+  Job job;
+  job.compact = false;
+  job.records.swap(pending);
+
+  journalSize += job.records.size();
+
+  submit(std::move(job));
+}
+
+void Journal::submit(Job job)
+{
+#if defined(EMSCRIPTEN)
+  process(job);
+
+  EM_ASM(
+    FS.syncfs(false, function(err) {
+      if (err) console.log(err);
+    });
+  );
+#else
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    jobs.push_back(std::move(job));
+  }
+
+  condition.notify_one();
+#endif
+}
+
+void Journal::work()
+{
+  while (true)
+  {
+    Job job;
+
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      condition.wait(lock, [this]() { return stopping || !jobs.empty(); });
+
+      if (jobs.empty())
+      {
+        return;
+      }
+
+      job = std::move(jobs.front());
+      jobs.pop_front();
+    }
+
+    process(job);
+  }
+}
+
+void Journal::process(Job& job)
+{
+  Profiler::Sample sample(Profiler::Scope::JournalIO);
+
+  const std::string journalPath = getPath(path);
+
+  if (job.compact)
+  {
+    if (file)
+    {
+      fclose(file);
+      file = nullptr;
+    }
+
+    if (!SaveFile::write(path, job.snapshot, cache))
+    {
+      printf("journal error: failed to write %s.\n", path.c_str());
+
+      file = fopen(journalPath.c_str(), "ab");
+      return;
+    }
+
+    file = fopen(journalPath.c_str(), "wb");
+
+    if (!file)
+    {
+      printf("journal error: failed to open %s.\n", journalPath.c_str());
+      return;
+    }
+
+    const Header header = { MAGIC, VERSION };
+    fwrite(&header, sizeof(header), 1, file);
+    fflush(file);
+    return;
+  }
+
+  if (!file)
+  {
+    return;
+  }
+
+  if (fwrite(job.records.data(), 1, job.records.size(), file) != job.records.size())
+  {
+    printf("journal error: failed to append to %s.\n", journalPath.c_str());
+  }
+
+  fflush(file);
+}
+
+bool Journal::replay(const std::string& path, std::vector<unsigned char>& blocks)
+{
+  FILE* file = fopen(path.c_str(), "rb");
+  if (!file)
+  {
+    return false;
+  }
+
+  Header header;
+  if (fread(&header, sizeof(header), 1, file) != 1 || header.magic != MAGIC || header.version != VERSION)
+  {
+    fclose(file);
+    return false;
+  }
+
+  Record record;
+
+  while (fread(&record, sizeof(record), 1, file) == 1)
+  {
+    if (record.x < Level::WIDTH && record.y < Level::HEIGHT && record.z < Level::DEPTH)
+    {
+      blocks[(record.z * Level::HEIGHT + record.y) * Level::WIDTH + record.x] = record.newType;
+    }
+  }
+
+  fclose(file);
+
+  return true;
+}
+
+std::string Journal::getPath(const std::string& savePath)
+{
+  return savePath + ".journal";
+}
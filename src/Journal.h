@@ -0,0 +1,82 @@
+#pragma once
+#include "SaveFile.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+class Journal
+{
+public:
+  ~Journal();
+
+  void init();
+  void tick();
+
+  void record(int x, int y, int z, unsigned char oldType, unsigned char newType, unsigned int tick);
+  void compact();
+
+  static bool replay(const std::string& path, std::vector<unsigned char>& blocks);
+  static std::string getPath(const std::string& savePath);
+
+  const char* FILENAME = "Autosave";
+
+private:
+  struct Job
+  {
+    bool compact;
+    std::vector<unsigned char> records;
+    SaveFile::Snapshot snapshot;
+  };
+
+#pragma pack(push, 1)
+  struct Header
+  {
+    uint32_t magic;
+    uint32_t version;
+  };
+
+  struct Record
+  {
+    uint8_t x;
+    uint8_t y;
+    uint8_t z;
+    uint8_t oldType;
+    uint8_t newType;
+    uint32_t tick;
+  };
+#pragma pack(pop)
+
+  void flush();
+  void submit(Job job);
+  void process(Job& job);
+  void work();
+
+  bool active;
+  int ticks;
+  size_t journalSize;
+
+  std::string path;
+  std::vector<unsigned char> pending;
+
+  FILE* file;
+  SaveFile::Cache cache;
+
+  std::thread thread;
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::deque<Job> jobs;
+  bool stopping;
+
+  constexpr static uint32_t MAGIC = 0x4A425543;
+  constexpr static uint32_t VERSION = 1;
+
+  const int FLUSH_INTERVAL = 100;
+  const int COMPACT_INTERVAL = 6000;
+  const size_t MAX_JOURNAL_SIZE = 256 * 1024;
+};
@@ -1,14 +1,34 @@
 #include "Level.h"
+#include "BlockSource.h"
 #include "AABB.h"
 #include "AABBPosition.h"
-#include "Game.h"
+#include "Network.h"
+#include "LevelRenderer.h"
+#include "Journal.h"
 
 #include <glm/glm.hpp>
+#include <cstring>
+#include <filesystem>
+
+#if defined(__linux__) && !defined(ANDROID)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+Level::~Level()
+{
+  unmap();
+}
 
 void Level::init()
 {
   waterLevel = Level::HEIGHT / 2;
   groundLevel = waterLevel - 2;
+  ticks = 0;
+  version = 0;
+  seed = 0;
 
   spawn.x = Level::WIDTH - 1.0f;
   spawn.x = Level::HEIGHT - 1.0f;
@@ -20,9 +40,96 @@ void Level::init()
   }
 }
 
+bool Level::map(const std::string& path, bool& existing)
+{
+  existing = false;
+
+#if defined(__linux__) && !defined(ANDROID)
+  unmap();
+
+  descriptor = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+  if (descriptor < 0)
+  {
+    printf("level error: failed to open %s.\n", path.c_str());
+    return false;
+  }
+
+  struct stat status;
+  existing = fstat(descriptor, &status) == 0 && status.st_size == Level::VOLUME;
+
+  if (!existing && ftruncate(descriptor, Level::VOLUME) != 0)
+  {
+    printf("level error: failed to resize %s.\n", path.c_str());
+
+    close(descriptor);
+    descriptor = -1;
+    return false;
+  }
+
+  mapping = mmap(nullptr, Level::VOLUME, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+  if (mapping == MAP_FAILED)
+  {
+    printf("level error: failed to map %s.\n", path.c_str());
+
+    mapping = nullptr;
+    close(descriptor);
+    descriptor = -1;
+    return false;
+  }
+
+  blocks = (unsigned char*)mapping;
+  mappedPath = path;
+
+  return true;
+#else
+  return false;
+#endif
+}
+
+void Level::unmap()
+{
+#if defined(__linux__) && !defined(ANDROID)
+  if (!mapping)
+  {
+    return;
+  }
+
+  std::memcpy(storage, mapping, Level::VOLUME);
+  blocks = storage;
+
+  msync(mapping, Level::VOLUME, MS_SYNC);
+  munmap(mapping, Level::VOLUME);
+  close(descriptor);
+
+  mapping = nullptr;
+  descriptor = -1;
+  mappedPath.clear();
+#endif
+}
+
+bool Level::flush()
+{
+#if defined(__linux__) && !defined(ANDROID)
+  return !mapping || msync(mapping, Level::VOLUME, MS_SYNC) == 0;
+#else
+  return true;
+#endif
+}
+
+bool Level::isMapped()
+{
+  return mapping != nullptr;
+}
+
+bool Level::isMappedTo(const std::string& path)
+{
+  std::error_code ec;
+  return mapping && std::filesystem::equivalent(path, mappedPath, ec);
+}
+
 void Level::tick()
 {
-  if (game.timer.ticks % 7 == 0)
+  if (ticks++ % 7 == 0)
   {
     size_t size = updates.size();
 
@@ -31,7 +138,7 @@ void Level::tick()
       auto& update = updates.front();
       
       updateTile(update.x, update.y, update.z);
-      updates.pop();
+      updates.pop_front();
     }
   }
 }
@@ -57,17 +164,12 @@ bool Level::canFlood(int x, int y, int z, unsigned char blockType)
 
 bool Level::isTileLit(int x, int y, int z)
 {
-  return !(x < 0 || y < 0 || z < 0 || x >= Level::WIDTH || y >= Level::HEIGHT || z >= Level::DEPTH) ? y >= lightDepths[x + z * Level::WIDTH] : true;
+  return BlockSource(*this).isTileLit(x, y, z);
 }
 
 float Level::getTileBrightness(int x, int y, int z)
 {
-  if (isLavaTile(x, y, z) || isTileLit(x, y, z))
-  {
-    return 1.0f;
-  }
-
-  return 0.6f;
+  return BlockSource(*this).getTileBrightness(x, y, z);
 }
 
 unsigned int Level::getTileAABBCount(AABB box)
@@ -147,9 +249,9 @@ unsigned int Level::getTileAABBCount(AABB box)
   return tiles;
 }
 
-std::vector<AABB> Level::getTileAABB(AABB box)
+void Level::getTileAABB(AABB box, std::vector<AABB>& tiles)
 {
-  std::vector<AABB> tiles;
+  tiles.clear();
 
   int x0 = (int)box.x0, y0 = (int)box.y0, z0 = (int)box.z0;
   int x1 = (int)(box.x1 + 1.0f), y1 = (int)(box.y1 + 1.0f), z1 = (int)(box.z1 + 1.0f);
@@ -220,8 +322,6 @@ std::vector<AABB> Level::getTileAABB(AABB box)
       }
     }
   }
-
-  return tiles;
 }
 
 bool Level::containsAnyLiquid(AABB box)
@@ -319,16 +419,21 @@ bool Level::containsLiquid(AABB box, Block::Type blockType)
 
 void Level::reset()
 {
-  updates = {};
+  updates.clear();
 }
 
 void Level::calculateSpawnPosition()
+{
+  calculateSpawnPosition(0, 0, Level::WIDTH, Level::DEPTH);
+}
+
+void Level::calculateSpawnPosition(int x0, int z0, int offsetX, int offsetZ)
 {
   glm::vec3 maxPosition = glm::vec3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
 
-  for (int x = 0; x < Level::WIDTH; x++)
+  for (int x = x0; x < x0 + offsetX; x++)
   {
-    for (int z = 0; z < Level::DEPTH; z++)
+    for (int z = z0; z < z0 + offsetZ; z++)
     {
       int y = lightDepths[x + z * Level::WIDTH];
 
@@ -347,12 +452,9 @@ void Level::calculateSpawnPosition()
     }
   }
 
-  game.level.spawn.x = maxPosition.x + 0.5f;
-  game.level.spawn.y = maxPosition.y + 2.0f;
-  game.level.spawn.z = maxPosition.z + 0.5f;
-
-  game.localPlayer.setPosition(game.level.spawn.x, game.level.spawn.y, game.level.spawn.z);
-  game.level.spawn = game.localPlayer.position;
+  spawn.x = maxPosition.x + 0.5f;
+  spawn.y = maxPosition.y + 2.0f;
+  spawn.z = maxPosition.z + 0.5f;
 }
 
 void Level::calculateLightDepths(int x, int z, int offsetX, int offsetZ)
@@ -379,7 +481,10 @@ void Level::calculateLightDepths(int x, int z, int offsetX, int offsetZ)
         int min = blocker < k ? blocker : k;
         int max = blocker > k ? blocker : k;
 
-        game.levelRenderer.loadChunks(i, min, j);
+        if (levelRenderer)
+        {
+          levelRenderer->loadChunks(i, min, j);
+        }
       }
     }
   }
@@ -392,20 +497,12 @@ unsigned char Level::getTile(int x, int y, int z)
 
 unsigned char Level::getRenderTile(int x, int y, int z)
 {
-  if (x < 0 || y < 0 || z < 0 || x >= Level::WIDTH || z >= Level::DEPTH)
-  {
-    if (y < waterLevel && y >= groundLevel)
-    {
-      return (unsigned char)Block::Type::BLOCK_WATER;
-    }
-  }
-
-  return isInBounds(x, y, z) ? blocks[(z * Level::HEIGHT + y) * Level::WIDTH + x] : (unsigned char)Block::Type::BLOCK_AIR;
+  return BlockSource(*this).getRenderTile(x, y, z);
 }
 
 void Level::updateTile(int x, int y, int z, bool deferred)
 {
-  if (game.network.isConnected() && !game.network.isHost())
+  if (network && network->isConnected() && !network->isHost())
   {
     return;
   }
@@ -421,7 +518,7 @@ void Level::updateTile(int x, int y, int z, bool deferred)
   {
     if (deferred)
     {
-      updates.emplace(x, y, z);
+      updates.emplace_back(x, y, z);
     }
     else 
     {
@@ -429,7 +526,7 @@ void Level::updateTile(int x, int y, int z, bool deferred)
       {
         setTileWithNoNeighborChange(x - 1, y, z, blockType);
 
-        updates.emplace(x - 1, y, z);
+        updates.emplace_back(x - 1, y, z);
       }
       else if (
         (isLavaTile(x - 1, y, z) && isWaterTile(blockType)) || 
@@ -443,7 +540,7 @@ void Level::updateTile(int x, int y, int z, bool deferred)
       {
         setTileWithNoNeighborChange(x + 1, y, z, blockType);
 
-        updates.emplace(x + 1, y, z);
+        updates.emplace_back(x + 1, y, z);
       }
       else if (
         (isLavaTile(x + 1, y, z) && isWaterTile(blockType)) || 
@@ -457,7 +554,7 @@ void Level::updateTile(int x, int y, int z, bool deferred)
       {
         setTileWithNoNeighborChange(x, y - 1, z, blockType);
 
-        updates.emplace(x, y - 1, z);
+        updates.emplace_back(x, y - 1, z);
       }
       else if (
         (isLavaTile(x, y - 1, z) && isWaterTile(blockType)) || 
@@ -471,7 +568,7 @@ void Level::updateTile(int x, int y, int z, bool deferred)
       {
         setTileWithNoNeighborChange(x, y, z - 1, blockType);
 
-        updates.emplace(x, y, z - 1);
+        updates.emplace_back(x, y, z - 1);
       }
       else if (
         (isLavaTile(x, y, z - 1) && isWaterTile(blockType)) ||
@@ -485,7 +582,7 @@ void Level::updateTile(int x, int y, int z, bool deferred)
       {
         setTileWithNoNeighborChange(x, y, z + 1, blockType);
 
-        updates.emplace(x, y, z + 1);
+        updates.emplace_back(x, y, z + 1);
       }
       else if (
         (isLavaTile(x, y, z + 1) && isWaterTile(blockType)) || 
@@ -604,7 +701,10 @@ bool Level::setTileWithNoNeighborChange(int x, int y, int z, unsigned char block
   setTile(x, y, z, blockType, mode);
   calculateLightDepths(x, z, 1, 1);
 
-  game.levelRenderer.loadChunks(x, y, z);
+  if (levelRenderer)
+  {
+    levelRenderer->loadChunks(x, y, z);
+  }
 
   if (previousBlockType != (unsigned char)Block::Type::BLOCK_AIR) 
   { 
@@ -623,11 +723,18 @@ void Level::setTile(int x, int y, int z, unsigned char blockType, bool mode)
 {
   if (isInBounds(x, y, z))
   {
-    blocks[(z * Level::HEIGHT + y) * Level::WIDTH + x] = blockType;
+    auto& block = blocks[(z * Level::HEIGHT + y) * Level::WIDTH + x];
+
+    if (journal && block != blockType)
+    {
+      journal->record(x, y, z, block, blockType, ticks);
+    }
+
+    block = blockType;
 
-    if (game.network.isConnected() && game.network.isHost())
+    if (network && network->isConnected() && network->isHost())
     {
-      game.network.sendSetBlock(x, y, z, blockType, mode);
+      network->sendSetBlock(x, y, z, blockType, mode);
     }
   }
 }
@@ -3,15 +3,27 @@
 #include "AABBPosition.h"
 
 #include <glm/glm.hpp>
-#include <queue>
+#include <deque>
+#include <cstdint>
+#include <string>
+#include <vector>
 
 class AABB;
+class Network;
+class LevelRenderer;
+class Journal;
 
 class Level {
 public:
   constexpr static int WIDTH = 128;
   constexpr static int HEIGHT = 64;
   constexpr static int DEPTH = 128;
+  constexpr static int VOLUME = WIDTH * HEIGHT * DEPTH;
+
+  Level() = default;
+  Level(const Level&) = delete;
+  Level& operator=(const Level&) = delete;
+  ~Level();
 
   void init();
   void tick();
@@ -47,9 +59,10 @@ public:
   unsigned char getRenderTile(int x, int y, int z);
 
   unsigned int getTileAABBCount(AABB box);
-  std::vector<AABB> getTileAABB(AABB box);
+  void getTileAABB(AABB box, std::vector<AABB>& tiles);
 
   void calculateSpawnPosition();
+  void calculateSpawnPosition(int x, int z, int offsetX, int offsetZ);
   void calculateLightDepths(int x, int z, int offsetX, int offsetZ);
 
   bool containsAnyLiquid(AABB box);
@@ -57,14 +70,33 @@ public:
 
   AABBPosition clip(glm::vec3 start, glm::vec3 end, const glm::ivec3* expected = nullptr);
 
-  unsigned char blocks[Level::WIDTH * Level::HEIGHT * Level::DEPTH];
+  bool map(const std::string& path, bool& existing);
+  void unmap();
+  bool flush();
+  bool isMapped();
+  bool isMappedTo(const std::string& path);
+
+  unsigned char* blocks = storage;
   int lightDepths[Level::WIDTH * Level::DEPTH];
 
   int groundLevel;
   int waterLevel;
 
   glm::vec3 spawn;
+  uint64_t seed;
+
+  unsigned int ticks;
+  unsigned int version;
+  std::deque<glm::ivec3> updates;
+
+  Network* network = nullptr;
+  LevelRenderer* levelRenderer = nullptr;
+  Journal* journal = nullptr;
 
 private:
-  std::queue<glm::ivec3> updates;
+  unsigned char storage[Level::VOLUME];
+
+  void* mapping = nullptr;
+  int descriptor = -1;
+  std::string mappedPath;
 };
\ No newline at end of file
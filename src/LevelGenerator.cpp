@@ -5,143 +5,591 @@
 #include "CombinedNoise.h"
 #include "OctaveNoise.h"
 #include "Random.h"
+#include "RandomStream.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+static const char* descriptions[] = {
+  "Generating height map...",
+  "Generating height map...",
+  "Generating dirt, stone and lava...",
+  "Generating water...",
+  "Generating caves...",
+  "Generating ores...",
+  "Generating grass, sand and gravel...",
+  "Generating flowers...",
+  "Generating mushrooms...",
+  "Generating trees...",
+  "Generating light depths...",
+};
+
+LevelGenerator::~LevelGenerator()
+{
+  if (thread.joinable())
+  {
+    thread.join();
+  }
+}
 
 void LevelGenerator::init()
 {
   game.level.init();
+  game.level.seed = seed;
 
   state = State::Init;
+  progress = 0;
+  progressTotal = 0;
+
+#if defined(EMSCRIPTEN)
+  progressive = false;
+#else
+  progressive = std::getenv("CUBIC_PROGRESSIVE_GENERATION") != nullptr;
+#endif
+
+#if defined(__linux__) && !defined(ANDROID)
+  if (const char* mappedPath = std::getenv("CUBIC_MAPPED_LEVEL"))
+  {
+    bool existing;
+
+    if (game.level.map(mappedPath, existing) && existing)
+    {
+      progressive = false;
+      state = State::Destroy;
+    }
+  }
+#endif
+
+  level = &game.level;
+  staging.reset();
+
+  // The level is playable while the rest is still being generated, so regions are generated into a copy of it and
+  // only handed over once nothing will write to them again.
+  if (progressive)
+  {
+    staging = std::make_unique<Level>();
+    staging->init();
+
+    level = staging.get();
+  }
+
+  playable = false;
+  finishedRegions = 0;
+  finished.clear();
+
+  for (auto& stage : regionStages)
+  {
+    stage = RegionStage::None;
+  }
+}
+
+void LevelGenerator::setSeed(uint64_t seed_)
+{
+  seed = seed_;
+
+  random.init(seed);
+  noise1 = CombinedNoise{ OctaveNoise(random, 8), OctaveNoise(random, 8) };
+  noise2 = CombinedNoise{ OctaveNoise(random, 8), OctaveNoise(random, 8) };
+  noise3 = OctaveNoise(random, 6);
+}
+
+uint64_t LevelGenerator::getSeed() const
+{
+  return seed;
+}
+
+bool LevelGenerator::isFinished() const
+{
+  return state == State::Finished;
 }
 
 void LevelGenerator::update()
 {
+  if (progressive)
+  {
+    updateProgressive();
+    return;
+  }
+
   switch (state)
   {
   case State::Init:
-    game.ui.openStatusMenu("Generating World", "Generating height map...");
     state = State::HeightMap;
+
+#if !defined(EMSCRIPTEN)
+    thread = std::thread([this]() { generate(); });
+#endif
     break;
-  case State::HeightMap:
-    game.ui.openStatusMenu("Generating World", "Generating dirt, stone and lava...");
+  case State::Destroy:
+    if (thread.joinable())
+    {
+      thread.join();
+    }
 
-    generateHeightMap();
+    game.level.calculateLightDepths(0, 0, Level::WIDTH, Level::DEPTH);
+    game.level.calculateSpawnPosition();
+    game.localPlayer.respawn();
+    game.level.reset();
 
-    state = State::DirtStoneLava;
-    break;
-  case State::DirtStoneLava:
-    game.ui.openStatusMenu("Generating World", "Generating water...");
+    game.levelRenderer.loadAllChunks();
+
+    // A flythrough runs offline.
+    if (!game.flythrough.active)
+    {
+      game.journal.compact();
+      game.network.connect();
+    }
 
-    generateDirtStoneLava();
+    state = State::Finished;
+    return;
+  case State::Finished:
+    return;
+  default:
+#if defined(EMSCRIPTEN)
+    generate(state);
 
-    state = State::Water;
+    state = State(int(state.load()) + 1);
+#endif
     break;
-  case State::Water:
-    game.ui.openStatusMenu("Generating World", "Generating caves...");
+  }
 
-    generateWater();
+  const State stage = state;
+  const int total = progressTotal;
 
-    state = State::Caves;
-    break;
-  case State::Caves:
-    game.ui.openStatusMenu("Generating World", "Generating ores...");
+  char description[64];
 
-    generateCaves();
+  if (total > 0)
+  {
+    snprintf(description, sizeof(description), "%s %d%%", descriptions[int(stage)], progress * 100 / total);
+  }
+  else
+  {
+    snprintf(description, sizeof(description), "%s", descriptions[int(stage)]);
+  }
 
-    state = State::Ore;
-    break;
-  case State::Ore:
-    game.ui.openStatusMenu("Generating World", "Generating grass, sand and gravel...");
+  game.ui.openStatusMenu("Generating World", description);
+}
 
-    generateOre(Block::Type::BLOCK_COAL_ORE, 90);
-    generateOre(Block::Type::BLOCK_IRON_ORE, 70);
-    generateOre(Block::Type::BLOCK_GOLD_ORE, 50);
+void LevelGenerator::updateProgressive()
+{
+  if (state == State::Finished)
+  {
+    return;
+  }
 
-    state = State::GrassSandGravel;
-    break;
-  case State::GrassSandGravel:
-    game.ui.openStatusMenu("Generating World", "Generating flowers...");
+  if (state == State::Init)
+  {
+    state = State::HeightMap;
+    thread = std::thread([this]() { generateProgressive(); });
+  }
 
-    generateGrassSandGravel();
+  const bool done = state == State::Destroy;
 
-    state = State::Flowers;
-    break;
-  case State::Flowers:
-    game.ui.openStatusMenu("Generating World", "Generating mushrooms...");
+  if (done)
+  {
+    thread.join();
+  }
 
-    generateFlowers();
+  std::vector<int> regions;
 
-    state = State::Mushrooms;
-    break;
-  case State::Mushrooms:
-    game.ui.openStatusMenu("Generating World", "Generating trees...");
+  {
+    std::lock_guard<std::mutex> lock(finishedMutex);
+    regions.swap(finished);
+  }
 
-    generateMushrooms();
+  for (const auto index : regions)
+  {
+    const Region region = getRegion(index);
 
-    state = State::Trees;
-    break;
-  case State::Trees:
-    game.ui.openStatusMenu("Generating World", "Generating light depths...");
+    publish(region);
+    game.level.calculateLightDepths(region.x0, region.z0, region.x1 - region.x0, region.z1 - region.z0);
+    game.levelRenderer.loadRegion(region.x0 - 1, region.z0 - 1, region.x1 + 1, region.z1 + 1);
 
-    generateTrees();
+    if (!playable)
+    {
+      playable = true;
+
+      game.level.calculateSpawnPosition(region.x0, region.z0, region.x1 - region.x0, region.z1 - region.z0);
+      game.localPlayer.respawn();
+      game.ui.closeMenu();
+    }
+  }
+
+  if (done)
+  {
+    level = &game.level;
+    staging.reset();
 
-    state = State::Destroy;
-    break;
-  case State::Destroy:
-    game.level.calculateLightDepths(0, 0, Level::WIDTH, Level::DEPTH);
-    game.level.calculateSpawnPosition();
     game.level.reset();
 
-    game.levelRenderer.loadAllChunks();
-    game.network.connect();
+    if (!game.flythrough.active)
+    {
+      game.journal.compact();
+      game.network.connect();
+    }
 
     state = State::Finished;
-    break;
-  case State::Finished:
     return;
   }
+
+  if (!playable)
+  {
+    char description[64];
+    snprintf(description, sizeof(description), "Generating world... %d%%", finishedRegions * 100 / (REGIONS_X * REGIONS_Z));
+
+    game.ui.openStatusMenu("Generating World", description);
+  }
+}
+
+void LevelGenerator::publish(const Region& region)
+{
+  for (int z = region.z0; z < region.z1; z++)
+  {
+    for (int y = 0; y < Level::HEIGHT; y++)
+    {
+      const int offset = (z * Level::HEIGHT + y) * Level::WIDTH + region.x0;
+
+      std::memcpy(game.level.blocks + offset, staging->blocks + offset, region.x1 - region.x0);
+    }
+  }
+}
+
+void LevelGenerator::generateProgressive()
+{
+  int order[REGIONS_X * REGIONS_Z];
+
+  for (int i = 0; i < REGIONS_X * REGIONS_Z; i++)
+  {
+    order[i] = i;
+  }
+
+  std::stable_sort(std::begin(order), std::end(order), [this](int a, int b) {
+    const Region regionA = getRegion(a);
+    const Region regionB = getRegion(b);
+
+    const auto distanceA = glm::abs(glm::ivec2(regionA.x0 + regionA.x1 - Level::WIDTH, regionA.z0 + regionA.z1 - Level::DEPTH));
+    const auto distanceB = glm::abs(glm::ivec2(regionB.x0 + regionB.x1 - Level::WIDTH, regionB.z0 + regionB.z1 - Level::DEPTH));
+
+    return distanceA.x + distanceA.y < distanceB.x + distanceB.y;
+  });
+
+  for (const auto index : order)
+  {
+    const int regionX = index % REGIONS_X;
+    const int regionZ = index / REGIONS_X;
+
+    for (int z = glm::max(regionZ - 1, 0); z <= glm::min(regionZ + 1, REGIONS_Z - 1); z++)
+    {
+      for (int x = glm::max(regionX - 1, 0); x <= glm::min(regionX + 1, REGIONS_X - 1); x++)
+      {
+        generateRegion(x + z * REGIONS_X, RegionStage::Trees);
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(finishedMutex);
+    finished.push_back(index);
+    finishedRegions++;
+  }
+
+  state = State::Destroy;
+}
+
+void LevelGenerator::generateRegion(int index, RegionStage stage)
+{
+  Profiler::Sample sample(Profiler::Scope::Generation);
+
+  if (regionStages[index] >= stage)
+  {
+    return;
+  }
+
+  const int regionX = index % REGIONS_X;
+  const int regionZ = index / REGIONS_X;
+  const RegionStage previous = RegionStage(int(stage) - 1);
+
+  if (previous != RegionStage::None)
+  {
+    for (int z = glm::max(regionZ - 1, 0); z <= glm::min(regionZ + 1, REGIONS_Z - 1); z++)
+    {
+      for (int x = glm::max(regionX - 1, 0); x <= glm::min(regionX + 1, REGIONS_X - 1); x++)
+      {
+        generateRegion(x + z * REGIONS_X, previous);
+      }
+    }
+  }
+
+  generateRegionStage(index, stage);
+
+  regionStages[index] = stage;
+}
+
+// Neighbouring regions write into each other's margins, so only regions two apart run at the same time. Each stage only
+// ever moves a block one way, so the order regions run in does not change the result.
+void LevelGenerator::generateRegions(RegionStage stage)
+{
+  for (int pass = 0; pass < 4; pass++)
+  {
+    const int offsetX = pass % 2;
+    const int offsetZ = pass / 2;
+    const int countX = (REGIONS_X - offsetX + 1) / 2;
+    const int countZ = (REGIONS_Z - offsetZ + 1) / 2;
+
+    game.jobs.parallelFor(0, countX * countZ, 1, [&](int begin, int end) {
+      for (int i = begin; i < end; i++)
+      {
+        generateRegionStage(offsetX + i % countX * 2 + (offsetZ + i / countX * 2) * REGIONS_X, stage);
+
+        progress++;
+      }
+    });
+  }
+}
+
+void LevelGenerator::generateRegionStage(int index, RegionStage stage)
+{
+  const Region region = getRegion(index);
+  const Region bounds = getRegionBounds(index);
+
+  switch (stage)
+  {
+  case RegionStage::Terrain:
+    generateHeightMap(region.x0, region.z0, region.x1, region.z1);
+    generateDirtStoneLava(region.x0, region.z0, region.x1, region.z1);
+    generateWater(region.x0, region.z0, region.x1, region.z1);
+    break;
+  case RegionStage::Caves:
+    generateCaves(region, bounds);
+    break;
+  case RegionStage::CoalOre:
+    generateOre(region, bounds, Block::Type::BLOCK_COAL_ORE, 90);
+    break;
+  case RegionStage::IronOre:
+    generateOre(region, bounds, Block::Type::BLOCK_IRON_ORE, 70);
+    break;
+  case RegionStage::GoldOre:
+    generateOre(region, bounds, Block::Type::BLOCK_GOLD_ORE, 50);
+    break;
+  case RegionStage::Surface:
+    generateGrassSandGravel(region.x0, region.z0, region.x1, region.z1);
+    break;
+  case RegionStage::Flowers:
+    generateFlowers(region, bounds);
+    break;
+  case RegionStage::Mushrooms:
+    generateMushrooms(region, bounds);
+    break;
+  case RegionStage::Trees:
+    generateTrees(region);
+    break;
+  default:
+    break;
+  }
+}
+
+LevelGenerator::Region LevelGenerator::getRegion(int index)
+{
+  const int x = index % REGIONS_X * REGION_SIZE;
+  const int z = index / REGIONS_X * REGION_SIZE;
+
+  return { x, z, x + REGION_SIZE, z + REGION_SIZE };
+}
+
+LevelGenerator::Region LevelGenerator::getRegionBounds(int index)
+{
+  const Region region = getRegion(index);
+
+  return {
+    glm::max(region.x0 - REGION_MARGIN, 0),
+    glm::max(region.z0 - REGION_MARGIN, 0),
+    glm::min(region.x1 + REGION_MARGIN, Level::WIDTH),
+    glm::min(region.z1 + REGION_MARGIN, Level::DEPTH),
+  };
 }
 
-void LevelGenerator::generateHeightMap()
+void LevelGenerator::generate()
 {
-  for (int z = 0; z < Level::DEPTH; z++)
+  for (int stage = int(State::HeightMap); stage < int(State::Destroy); stage++)
+  {
+    state = State(stage);
+
+    generate(State(stage));
+  }
+
+  state = State::Destroy;
+}
+
+void LevelGenerator::generate(State stage)
+{
+  Profiler::Sample sample(Profiler::Scope::Generation);
+
+  const int regions = REGIONS_X * REGIONS_Z;
+
+  progress = 0;
+  progressTotal = 0;
+
+  switch (stage)
   {
-    for (int x = 0; x < Level::WIDTH; x++)
+  case State::HeightMap:
+    progressTotal = Level::DEPTH;
+    generateSlabs(&LevelGenerator::generateHeightMap);
+    break;
+  case State::DirtStoneLava:
+    progressTotal = Level::DEPTH;
+    generateSlabs(&LevelGenerator::generateDirtStoneLava);
+    break;
+  case State::Water:
+    progressTotal = Level::DEPTH;
+    generateSlabs(&LevelGenerator::generateWater);
+    break;
+  case State::Caves:
+    progressTotal = regions;
+    generateRegions(RegionStage::Caves);
+    break;
+  case State::Ore:
+    progressTotal = regions * 3;
+    generateRegions(RegionStage::CoalOre);
+    generateRegions(RegionStage::IronOre);
+    generateRegions(RegionStage::GoldOre);
+    break;
+  case State::GrassSandGravel:
+    progressTotal = Level::DEPTH;
+    generateSlabs(&LevelGenerator::generateGrassSandGravel);
+    break;
+  case State::Flowers:
+    progressTotal = regions;
+    generateRegions(RegionStage::Flowers);
+    break;
+  case State::Mushrooms:
+    progressTotal = regions;
+    generateRegions(RegionStage::Mushrooms);
+    break;
+  case State::Trees:
+    progressTotal = regions;
+    generateRegions(RegionStage::Trees);
+    break;
+  default:
+    break;
+  }
+}
+
+void LevelGenerator::generateSlabs(void (LevelGenerator::*stage)(int x0, int z0, int x1, int z1))
+{
+  const int count = glm::clamp(game.jobs.getThreadCount(), 1, Level::DEPTH);
+  const int size = (Level::DEPTH + count - 1) / count;
+
+  game.jobs.parallelFor(0, Level::DEPTH, size, [&](int z0, int z1) {
+    (this->*stage)(0, z0, Level::WIDTH, z1);
+  });
+}
+
+// Each region draws its own count from its expected share, rounded up or down at random, so the same regions get the
+// same features however the level is split up and the level's total still averages out.
+static int getCount(const RandomStream& stream, double expected)
+{
+  RandomStream random = stream.split(UINT64_MAX);
+
+  const int count = int(expected);
+
+  return count + (random.uniform() < expected - count ? 1 : 0);
+}
+
+double LevelGenerator::getCaveCount()
+{
+  return REGION_SIZE * REGION_SIZE * Level::HEIGHT / 256.0 / 64.0 * 2.0;
+}
+
+double LevelGenerator::getOreCount(int amount)
+{
+  return REGION_SIZE * REGION_SIZE * Level::HEIGHT / 256.0 / 64.0 * amount / 100.0;
+}
+
+double LevelGenerator::getFlowerCount()
+{
+  return REGION_SIZE * REGION_SIZE / 3000.0;
+}
+
+double LevelGenerator::getMushroomCount()
+{
+  return REGION_SIZE * REGION_SIZE * Level::HEIGHT / 2000.0;
+}
+
+void LevelGenerator::generateHeightMap(int x0, int z0, int x1, int z1)
+{
+  float row[Level::WIDTH];
+  float scaledRow[Level::WIDTH];
+  float noise1Values[Level::WIDTH];
+  float noise2Values[Level::WIDTH];
+  float noise3Values[Level::WIDTH];
+
+  for (int x = x0; x < x1; x++)
+  {
+    row[x - x0] = (float)x;
+    scaledRow[x - x0] = x * 1.3f;
+  }
+
+  for (int z = z0; z < z1; z++)
+  {
+    noise1.compute(scaledRow, z * 1.3f, noise1Values, x1 - x0);
+    noise2.compute(scaledRow, z * 1.3f, noise2Values, x1 - x0);
+    noise3.compute(row, (float)z, noise3Values, x1 - x0);
+
+    for (int x = x0; x < x1; x++)
     {
-      float noise1Value = noise1.compute(x * 1.3f, z * 1.3f) / 6.0f - 4.0f;
-      float noise2Value = noise2.compute(x * 1.3f, z * 1.3f) / 5.0f + 6.0f;
-      if (noise3.compute((float)x, (float)z) / 8.0f > 0.0f) { noise2Value = noise1Value; }
+      float noise1Value = noise1Values[x - x0] / 6.0f - 4.0f;
+      float noise2Value = noise2Values[x - x0] / 5.0f + 6.0f;
+      if (noise3Values[x - x0] / 8.0f > 0.0f) { noise2Value = noise1Value; }
 
       float maxValue = glm::max(noise1Value, noise2Value) / 2.0f;
       heights[x + z * Level::WIDTH] = (int)maxValue;
     } 
   }
 
-  for (int z = 0; z < Level::DEPTH; z++)
+  for (int x = x0; x < x1; x++)
   {
-    for (int x = 0; x < Level::WIDTH; x++)
+    scaledRow[x - x0] = x * 2.0f;
+  }
+
+  for (int z = z0; z < z1; z++)
+  {
+    noise1.compute(scaledRow, z * 2.0f, noise1Values, x1 - x0);
+    noise2.compute(scaledRow, z * 2.0f, noise2Values, x1 - x0);
+
+    for (int x = x0; x < x1; x++)
     {
-      float noise1Value = noise1.compute(x * 2.0f, z * 2.0f) / 8.0f;
-      int noise2Value = noise2.compute(x * 2.0f, z * 2.0f) > 0.0f ? 1 : 0;
+      float noise1Value = noise1Values[x - x0] / 8.0f;
+      int noise2Value = noise2Values[x - x0] > 0.0f ? 1 : 0;
 
       if (noise1Value > 2.0f)
       {
         heights[x + z * Level::WIDTH] = ((heights[x + z * Level::WIDTH] - noise2Value) / 2 << 1) + noise2Value;
       }
     }
+
+    progress++;
   }
 }
 
-void LevelGenerator::generateDirtStoneLava()
+void LevelGenerator::generateDirtStoneLava(int x0, int z0, int x1, int z1)
 {
-  for (int z = 0; z < Level::DEPTH; z++)
+  float row[Level::WIDTH];
+  float noise3Values[Level::WIDTH];
+
+  for (int x = x0; x < x1; x++)
+  {
+    row[x - x0] = (float)x;
+  }
+
+  for (int z = z0; z < z1; z++)
   { 
-    for (int x = 0; x < Level::WIDTH; x++)
+    noise3.compute(row, (float)z, noise3Values, x1 - x0);
+
+    for (int x = x0; x < x1; x++)
     {
-      int noise3Value = (int)(noise3.compute((float)x, (float)z) / 24.0f) - 4;
-      int heightValue = heights[x + z * Level::WIDTH] + game.level.waterLevel;
+      int noise3Value = (int)(noise3Values[x - x0] / 24.0f) - 4;
+      int heightValue = heights[x + z * Level::WIDTH] + level->waterLevel;
       int combinedValue = heightValue + noise3Value;
 
       heights[x + z * Level::WIDTH] = heightValue > combinedValue ? heightValue : combinedValue;
@@ -156,42 +604,51 @@ void LevelGenerator::generateDirtStoneLava()
         if (height <= combinedValue) { tile = Block::Type::BLOCK_STONE; }
         if (height == 0) { tile = Block::Type::BLOCK_LAVA; }
 
-        game.level.setTile(x, height, z, (unsigned char)tile);
+        level->setTile(x, height, z, (unsigned char)tile);
       }
     }
+
+    progress++;
   }
 }
 
-void LevelGenerator::generateWater()
+void LevelGenerator::generateWater(int x0, int z0, int x1, int z1)
 {
-  for (int z = 0; z < Level::DEPTH; z++)
+  for (int z = z0; z < z1; z++)
   {
-    for (int x = 0; x < Level::WIDTH; x++)
+    for (int x = x0; x < x1; x++)
     {
       int heightValue = heights[x + z * Level::WIDTH];
 
-      for (auto height = heightValue; height < game.level.waterLevel; height++)
+      for (auto height = heightValue; height < level->waterLevel; height++)
       {
-        if (game.level.getTile(x, height, z) == (unsigned char)Block::Type::BLOCK_AIR)
+        if (level->getTile(x, height, z) == (unsigned char)Block::Type::BLOCK_AIR)
         {
-          game.level.setTile(x, height, z, (unsigned char)Block::Type::BLOCK_WATER);
+          level->setTile(x, height, z, (unsigned char)Block::Type::BLOCK_WATER);
         }
       }
     }
+
+    progress++;
   }
 }
 
-void LevelGenerator::generateCaves()
+void LevelGenerator::generateCaves(const Region& region, const Region& bounds)
 {
-  int size = (Level::WIDTH * Level::DEPTH * Level::HEIGHT) / 256 / 64 << 1;
+  const RandomStream caves = { seed, uint32_t(State::Caves), region.x0, region.z0 };
+  const int size = getCount(caves, getCaveCount());
+
+  double steps[MAX_CAVE_STEPS * 6];
 
   for (int i = 0; i < size; i++) 
   {
+    RandomStream random = caves.split(i);
+
     int numberOfSteps = (int)((random.uniform() + random.uniform()) * 200.0f);
 
-    float startX = (float)(random.uniform() * Level::WIDTH);
+    float startX = (float)(region.x0 + random.uniform() * (region.x1 - region.x0));
     float startY = (float)(random.uniform() * Level::HEIGHT);
-    float startZ = (float)(random.uniform() * Level::DEPTH);
+    float startZ = (float)(region.z0 + random.uniform() * (region.z1 - region.z0));
 
     float angleX = (float)(random.uniform() * 2.0 * M_PI);
     float angleY = (float)(random.uniform() * 2.0 * M_PI);
@@ -199,21 +656,25 @@ void LevelGenerator::generateCaves()
 
     float randomFactor = (float)(random.uniform() * random.uniform());
 
+    random.uniform(steps, numberOfSteps * 6);
+
     for (int j = 0; j < numberOfSteps; j++) 
     {
+      const double* step = steps + j * 6;
+
       startX += glm::sin(angleX) * glm::cos(angleY);
       startY += glm::sin(angleY);
       startZ += glm::cos(angleX) * glm::cos(angleY);
 
       angleX = (angleX + angleX * 0.2f) * 0.9f;
       angleY = (angleY + angleYOffset * 0.5f) * 0.5f;
-      angleYOffset = angleYOffset * 0.75f + (float)(random.uniform() - random.uniform());
+      angleYOffset = angleYOffset * 0.75f + (float)(step[0] - step[1]);
 
-      if (random.uniform() >= 0.25) 
+      if (step[2] >= 0.25) 
       {
-        float currentX = startX + (float)((random.uniform() * 4.0 - 2.0) * 0.2);
-        float currentY = startY + (float)((random.uniform() * 4.0 - 2.0) * 0.2);
-        float currentZ = startZ + (float)((random.uniform() * 4.0 - 2.0) * 0.2);
+        float currentX = startX + (float)((step[3] * 4.0 - 2.0) * 0.2);
+        float currentY = startY + (float)((step[4] * 4.0 - 2.0) * 0.2);
+        float currentZ = startZ + (float)((step[5] * 4.0 - 2.0) * 0.2);
 
         float radius = (Level::HEIGHT - currentY) / Level::HEIGHT * 2;
         radius = 1.2f + (radius * 3.5f + 1.0f) * randomFactor;
@@ -229,21 +690,21 @@ void LevelGenerator::generateCaves()
               float distanceY = blockY - currentY;
               float distanceZ = blockZ - currentZ;
 
-              if (distanceX * distanceX + 2.0 * distanceY * distanceY + distanceZ * distanceZ < radius * radius && blockX >= 1 && blockY >= 1 && blockZ >= 1 && blockX < Level::WIDTH - 1 && blockY < Level::HEIGHT - 1 && blockZ < Level::DEPTH - 1) {
+              if (distanceX * distanceX + 2.0 * distanceY * distanceY + distanceZ * distanceZ < radius * radius && blockX >= 1 && blockY >= 1 && blockZ >= 1 && blockX < Level::WIDTH - 1 && blockY < Level::HEIGHT - 1 && blockZ < Level::DEPTH - 1 && bounds.contains(blockX, blockZ)) {
                 if (
-                  game.level.getTile(blockX, blockY + 1, blockZ) != (unsigned char)Block::Type::BLOCK_WATER &&
-                  game.level.getTile(blockX, blockY - 1, blockZ) != (unsigned char)Block::Type::BLOCK_WATER &&
-                  game.level.getTile(blockX + 1, blockY, blockZ) != (unsigned char)Block::Type::BLOCK_WATER &&
-                  game.level.getTile(blockX - 1, blockY, blockZ) != (unsigned char)Block::Type::BLOCK_WATER &&
-                  game.level.getTile(blockX, blockY, blockZ + 1) != (unsigned char)Block::Type::BLOCK_WATER &&
-                  game.level.getTile(blockX, blockY, blockZ - 1) != (unsigned char)Block::Type::BLOCK_WATER
+                  level->getTile(blockX, blockY + 1, blockZ) != (unsigned char)Block::Type::BLOCK_WATER &&
+                  level->getTile(blockX, blockY - 1, blockZ) != (unsigned char)Block::Type::BLOCK_WATER &&
+                  level->getTile(blockX + 1, blockY, blockZ) != (unsigned char)Block::Type::BLOCK_WATER &&
+                  level->getTile(blockX - 1, blockY, blockZ) != (unsigned char)Block::Type::BLOCK_WATER &&
+                  level->getTile(blockX, blockY, blockZ + 1) != (unsigned char)Block::Type::BLOCK_WATER &&
+                  level->getTile(blockX, blockY, blockZ - 1) != (unsigned char)Block::Type::BLOCK_WATER
                 )
                 {
                   if (
-                    game.level.getTile(blockX, blockY, blockZ) == (unsigned char)Block::Type::BLOCK_STONE
+                    level->getTile(blockX, blockY, blockZ) == (unsigned char)Block::Type::BLOCK_STONE
                   )
                   {
-                    game.level.setTile(blockX, blockY, blockZ, (unsigned char)Block::Type::BLOCK_AIR);
+                    level->setTile(blockX, blockY, blockZ, (unsigned char)Block::Type::BLOCK_AIR);
                   }
                 }
               }
@@ -255,32 +716,41 @@ void LevelGenerator::generateCaves()
   }
 }
 
-void LevelGenerator::generateOre(Block::Type blockType, int amount)
+void LevelGenerator::generateOre(const Region& region, const Region& bounds, Block::Type blockType, int amount)
 {
-  int size = Level::WIDTH * Level::DEPTH * Level::HEIGHT / 256 / 64 * amount / 100;
+  const RandomStream veins = { seed, uint32_t(State::Ore) << 8 | uint32_t(blockType), region.x0, region.z0 };
+  const int size = getCount(veins, getOreCount(amount));
+
+  double steps[MAX_VEIN_STEPS * 4];
 
   for (int i = 0; i < size; i++) 
   {
+    RandomStream random = veins.split(i);
+
     int numberOfSteps = (int)((random.uniform() + random.uniform()) * 75.0 * amount / 100.0);
 
-    float startX = (float)(random.uniform() * Level::WIDTH);
+    float startX = (float)(region.x0 + random.uniform() * (region.x1 - region.x0));
     float startY = (float)(random.uniform() * Level::HEIGHT);
-    float startZ = (float)(random.uniform() * Level::DEPTH);
+    float startZ = (float)(region.z0 + random.uniform() * (region.z1 - region.z0));
 
     float angleX = (float)(random.uniform() * 2.0 * M_PI);
     float angleY = (float)(random.uniform() * 2.0 * M_PI);
     float angleXOffset = 0.0;
     float angleYOffset = 0.0;
 
+    random.uniform(steps, numberOfSteps * 4);
+
     for (int j = 0; j < numberOfSteps; j++) 
     { 
+      const double* step = steps + j * 4;
+
       startX += glm::sin(angleX) * glm::cos(angleY);
       startY += glm::sin(angleY);
       startZ += glm::cos(angleX) * glm::cos(angleY);
       angleX += angleXOffset * 0.2f;
-      angleXOffset = angleXOffset * 0.9f + (float)(random.uniform() - random.uniform());
+      angleXOffset = angleXOffset * 0.9f + (float)(step[0] - step[1]);
       angleY = (angleY + angleYOffset * 0.5f) * 0.5f;
-      angleYOffset = angleYOffset * 0.9f + (float)(random.uniform() - random.uniform());
+      angleYOffset = angleYOffset * 0.9f + (float)(step[2] - step[3]);
 
       float radius = glm::sin(j * (float)M_PI / numberOfSteps) * amount / 100.0f + 1.0f;
 
@@ -294,11 +764,11 @@ void LevelGenerator::generateOre(Block::Type blockType, int amount)
             float distanceY = blockY - startY;
             float distanceZ = blockZ - startZ;
 
-            if (distanceX * distanceX + 2.0 * distanceY * distanceY + distanceZ * distanceZ < radius * radius && blockX >= 1 && blockY >= 1 && blockZ >= 1 && blockX < Level::WIDTH - 1 && blockY < Level::HEIGHT - 1 && blockZ < Level::DEPTH - 1)
+            if (distanceX * distanceX + 2.0 * distanceY * distanceY + distanceZ * distanceZ < radius * radius && blockX >= 1 && blockY >= 1 && blockZ >= 1 && blockX < Level::WIDTH - 1 && blockY < Level::HEIGHT - 1 && blockZ < Level::DEPTH - 1 && bounds.contains(blockX, blockZ))
             {
-              if (game.level.getTile(blockX, blockY, blockZ) == (unsigned char)Block::Type::BLOCK_STONE)
+              if (level->getTile(blockX, blockY, blockZ) == (unsigned char)Block::Type::BLOCK_STONE)
               {
-                game.level.setTile(blockX, blockY, blockZ, (unsigned char)blockType);
+                level->setTile(blockX, blockY, blockZ, (unsigned char)blockType);
               }
             }
           }
@@ -308,47 +778,64 @@ void LevelGenerator::generateOre(Block::Type blockType, int amount)
   }
 }
 
-void LevelGenerator::generateGrassSandGravel()
+void LevelGenerator::generateGrassSandGravel(int x0, int z0, int x1, int z1)
 {
-  for (int z = 0; z < Level::DEPTH; z++)
+  float row[Level::WIDTH];
+  float noise1Values[Level::WIDTH];
+  float noise2Values[Level::WIDTH];
+
+  for (int x = x0; x < x1; x++)
+  {
+    row[x - x0] = (float)x;
+  }
+
+  for (int z = z0; z < z1; z++)
   {
-    for (int x = 0; x < Level::WIDTH; x++)
+    noise1.compute(row, (float)z, noise1Values, x1 - x0);
+    noise2.compute(row, (float)z, noise2Values, x1 - x0);
+
+    for (int x = x0; x < x1; x++)
     { 
       int height = heights[x + z * Level::WIDTH];
 
-      bool isNoise1 = noise1.compute((float)x, (float)z) > 8.0f;
-      bool isNoise2 = noise2.compute((float)x, (float)z) > 12.0f;
+      bool isNoise1 = noise1Values[x - x0] > 8.0f;
+      bool isNoise2 = noise2Values[x - x0] > 12.0f;
 
-      auto blockAbove = game.level.getTile(x, height + 1, z);
+      auto blockAbove = level->getTile(x, height + 1, z);
 
       if (blockAbove == (unsigned char)Block::Type::BLOCK_WATER && height <= (Level::HEIGHT / 2) - 1 && isNoise2) 
       {
-        game.level.setTile(x, height, z, (unsigned char)Block::Type::BLOCK_GRAVEL);
+        level->setTile(x, height, z, (unsigned char)Block::Type::BLOCK_GRAVEL);
       }
 
       if (blockAbove == (unsigned char)Block::Type::BLOCK_AIR) 
       {
         if (height <= (Level::HEIGHT / 2) - 1 && isNoise1) 
         {
-          game.level.setTile(x, height, z, (unsigned char)Block::Type::BLOCK_SAND);
+          level->setTile(x, height, z, (unsigned char)Block::Type::BLOCK_SAND);
         }
         else 
         {
-          game.level.setTile(x, height, z, (unsigned char)Block::Type::BLOCK_GRASS);
+          level->setTile(x, height, z, (unsigned char)Block::Type::BLOCK_GRASS);
         }
       }
     }
+
+    progress++;
   }
 }
 
-void LevelGenerator::generateFlowers()
+void LevelGenerator::generateFlowers(const Region& region, const Region& bounds)
 {
-  int size = Level::WIDTH * Level::DEPTH / 3000;
+  const RandomStream patches = { seed, uint32_t(State::Flowers), region.x0, region.z0 };
+  const int size = getCount(patches, getFlowerCount());
 
   for (int i = 0; i < size; i++) 
   {
-    int xCoord = (int)random.integerRange(0, Level::WIDTH - 1);
-    int zCoord = (int)random.integerRange(0, Level::DEPTH - 1);
+    RandomStream random = patches.split(i);
+
+    int xCoord = (int)random.integerRange(region.x0, region.x1 - 1);
+    int zCoord = (int)random.integerRange(region.z0, region.z1 - 1);
     int flowerType = (int)random.integerRange(0, 1);
 
     for (int j = 0; j < 10; j++) 
@@ -361,14 +848,16 @@ void LevelGenerator::generateFlowers()
         currXCoord += (int)random.integerRange(0, 5) - (int)random.integerRange(0, 5);
         currZCoord += (int)random.integerRange(0, 5) - (int)random.integerRange(0, 5);
 
-        if ((flowerType < 2 || random.integerRange(0, 3) == 0) && currXCoord >= 0 && currZCoord >= 0 && currXCoord < Level::WIDTH && currZCoord < Level::DEPTH) 
+        if ((flowerType < 2 || random.integerRange(0, 3) == 0) && bounds.contains(currXCoord, currZCoord)) 
         {
           int yCoord = heights[currXCoord + currZCoord * Level::WIDTH];
 
-          if (game.level.getTile(currXCoord, yCoord, currZCoord) == (unsigned char)Block::Type::BLOCK_GRASS) 
+          const auto blockType = flowerType == 0 ? Block::Type::BLOCK_DANDELION : Block::Type::BLOCK_ROSE;
+
+          // Where patches overlap the rose wins, whichever was placed first.
+          if (level->getTile(currXCoord, yCoord, currZCoord) == (unsigned char)Block::Type::BLOCK_GRASS && level->getTile(currXCoord, yCoord + 1, currZCoord) < (unsigned char)blockType) 
           {
-            if (flowerType == 0) { game.level.setTile(currXCoord, yCoord + 1, currZCoord, (unsigned char)Block::Type::BLOCK_DANDELION); }
-            else if (flowerType == 1) { game.level.setTile(currXCoord, yCoord + 1, currZCoord, (unsigned char)Block::Type::BLOCK_ROSE); }
+            level->setTile(currXCoord, yCoord + 1, currZCoord, (unsigned char)blockType);
           }
         }
       }
@@ -376,16 +865,19 @@ void LevelGenerator::generateFlowers()
   }
 }
 
-void LevelGenerator::generateMushrooms()
+void LevelGenerator::generateMushrooms(const Region& region, const Region& bounds)
 {
-  int size = Level::WIDTH * Level::DEPTH * Level::HEIGHT / 2000;
+  const RandomStream patches = { seed, uint32_t(State::Mushrooms), region.x0, region.z0 };
+  const int size = getCount(patches, getMushroomCount());
 
   for (int i = 0; i < size; i++) 
   {
+    RandomStream random = patches.split(i);
+
     int mushroomType = (int)random.integerRange(0, 1);
-    int blockX = (int)random.integerRange(0, Level::WIDTH - 1);
+    int blockX = (int)random.integerRange(region.x0, region.x1 - 1);
     int blockY = (int)random.integerRange(0, Level::HEIGHT - 1);
-    int blockZ = (int)random.integerRange(0, Level::DEPTH - 1);
+    int blockZ = (int)random.integerRange(region.z0, region.z1 - 1);
 
     for (int j = 0; j < 20; j++)
     {
@@ -399,12 +891,15 @@ void LevelGenerator::generateMushrooms()
         currentY += (int)random.integerRange(0, 1) - (int)random.integerRange(0, 1);
         currentZ += (int)random.integerRange(0, 5) - (int)random.integerRange(0, 5);
 
-        if ((mushroomType < 2 || random.integerRange(0, 3) == 0) && currentX >= 0 && currentZ >= 0 && currentY >= 1 && currentX < Level::WIDTH && currentZ < Level::DEPTH && currentY < heights[currentX + currentZ * Level::WIDTH] - 1) 
+        if ((mushroomType < 2 || random.integerRange(0, 3) == 0) && bounds.contains(currentX, currentZ) && currentY >= 1 && currentY < heights[currentX + currentZ * Level::WIDTH] - 1) 
         {
-          if (game.level.getTile(currentX, blockY, currentZ) == (unsigned char)Block::Type::BLOCK_AIR) {
-            if (game.level.getTile(currentX, blockY - 1, currentZ) == (unsigned char)Block::Type::BLOCK_STONE) {
-              if (mushroomType == 0) { game.level.setTile(currentX, blockY, currentZ, (unsigned char)Block::Type::BLOCK_BROWN_SHROOM); }
-              else { game.level.setTile(currentX, blockY, currentZ, (unsigned char)Block::Type::BLOCK_RED_SHROOM); }
+          const auto blockType = mushroomType == 0 ? Block::Type::BLOCK_BROWN_SHROOM : Block::Type::BLOCK_RED_SHROOM;
+          const auto previousBlockType = level->getTile(currentX, blockY, currentZ);
+
+          // Where patches overlap the red mushroom wins, whichever was placed first.
+          if (previousBlockType == (unsigned char)Block::Type::BLOCK_AIR || previousBlockType == (unsigned char)Block::Type::BLOCK_BROWN_SHROOM) {
+            if (level->getTile(currentX, blockY - 1, currentZ) == (unsigned char)Block::Type::BLOCK_STONE && previousBlockType < (unsigned char)blockType) {
+              level->setTile(currentX, blockY, currentZ, (unsigned char)blockType);
             }
           }
         }
@@ -413,21 +908,26 @@ void LevelGenerator::generateMushrooms()
   }
 }
 
-void LevelGenerator::generateTrees()
+void LevelGenerator::generateTrees(const Region& region)
 {
-  for (int z = 4; z < Level::DEPTH - 4; z += 5)
+  const int startX = region.x0 > 4 ? 4 + (region.x0 - 4 + 4) / 5 * 5 : 4;
+  const int startZ = region.z0 > 4 ? 4 + (region.z0 - 4 + 4) / 5 * 5 : 4;
+
+  for (int z = startZ; z < glm::min(region.z1, Level::DEPTH - 4); z += 5)
   {
-    for (int x = 4; x < Level::WIDTH - 4; x += 5)
+    for (int x = startX; x < glm::min(region.x1, Level::WIDTH - 4); x += 5)
     {
       int treeHeight = heights[x + z * Level::WIDTH];
 
+      RandomStream random = { seed, uint32_t(State::Trees), x, z };
+
       if (random.integerRange(0, 4) == 0)
       {
         int treeTrunkSize = (int)random.integerRange(0, 2) + 5;
 
-        if (game.level.getTile(x, treeHeight, z) == (unsigned char)Block::Type::BLOCK_GRASS && treeHeight < Level::DEPTH - treeTrunkSize - 1)
+        if (level->getTile(x, treeHeight, z) == (unsigned char)Block::Type::BLOCK_GRASS && treeHeight < Level::DEPTH - treeTrunkSize - 1)
         {
-          game.level.setTile(x, treeHeight, z, (unsigned char)Block::Type::BLOCK_DIRT);
+          level->setTile(x, treeHeight, z, (unsigned char)Block::Type::BLOCK_DIRT);
 
           for (int treeLeavesLevel = treeHeight - 3 + treeTrunkSize; treeLeavesLevel <= treeHeight + treeTrunkSize; ++treeLeavesLevel) 
           {
@@ -443,7 +943,7 @@ void LevelGenerator::generateTrees()
                 int zDistanceFromBase = treeLeavesZ - z;
                 if (abs(xDistanceFromBase) != treeLeavesWidth || abs(zDistanceFromBase) != treeLeavesWidth || (random.integerRange(0, 1) != 0 && treeLeavesDistanceFromTop != 0)) 
                 {
-                  game.level.setTile(treeLeavesX, treeLeavesLevel, treeLeavesZ, (unsigned char)Block::Type::BLOCK_LEAVES);
+                  level->setTile(treeLeavesX, treeLeavesLevel, treeLeavesZ, (unsigned char)Block::Type::BLOCK_LEAVES);
                 }
               }
             }
@@ -451,7 +951,7 @@ void LevelGenerator::generateTrees()
 
           for (int treeTrunkLevel = 0; treeTrunkLevel < treeTrunkSize; treeTrunkLevel++)
           {
-            game.level.setTile(x, treeHeight + treeTrunkLevel, z, (unsigned char)Block::Type::BLOCK_LOG);
+            level->setTile(x, treeHeight + treeTrunkLevel, z, (unsigned char)Block::Type::BLOCK_LOG);
           }
         }
       }
@@ -7,12 +7,23 @@
 
 #include <cstdint>
 #include <ctime>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 class LevelGenerator
 {
 public:
+  ~LevelGenerator();
+
   void init();
   void update();
+  void setSeed(uint64_t seed);
+  uint64_t getSeed() const;
+  void generate();
+  bool isFinished() const;
 
 private:
   enum class State
@@ -31,20 +42,85 @@ private:
     Finished,
   };
 
-  void generateHeightMap();
-  void generateDirtStoneLava();
-  void generateWater();
-  void generateCaves();
-  void generateOre(Block::Type blockType, int amount);
-  void generateGrassSandGravel();
-  void generateFlowers();
-  void generateMushrooms();
-  void generateTrees();
-
-  State state;
+  struct Region
+  {
+    int x0;
+    int z0;
+    int x1;
+    int z1;
+
+    int getArea() const { return (x1 - x0) * (z1 - z0); }
+    bool contains(int x, int z) const { return x >= x0 && z >= z0 && x < x1 && z < z1; }
+  };
+
+  enum class RegionStage
+  {
+    None,
+    Terrain,
+    Caves,
+    CoalOre,
+    IronOre,
+    GoldOre,
+    Surface,
+    Flowers,
+    Mushrooms,
+    Trees,
+  };
+
+  void generateProgressive();
+  void generateRegion(int index, RegionStage stage);
+  void generateRegions(RegionStage stage);
+  void generateRegionStage(int index, RegionStage stage);
+  Region getRegion(int index);
+  Region getRegionBounds(int index);
+  void updateProgressive();
+  void publish(const Region& region);
+
+  void generate(State stage);
+  void generateSlabs(void (LevelGenerator::*stage)(int x0, int z0, int x1, int z1));
+  void generateHeightMap(int x0, int z0, int x1, int z1);
+  void generateDirtStoneLava(int x0, int z0, int x1, int z1);
+  void generateWater(int x0, int z0, int x1, int z1);
+  void generateCaves(const Region& region, const Region& bounds);
+  void generateOre(const Region& region, const Region& bounds, Block::Type blockType, int amount);
+  void generateGrassSandGravel(int x0, int z0, int x1, int z1);
+  void generateFlowers(const Region& region, const Region& bounds);
+  void generateMushrooms(const Region& region, const Region& bounds);
+  void generateTrees(const Region& region);
+
+  double getCaveCount();
+  double getOreCount(int amount);
+  double getFlowerCount();
+  double getMushroomCount();
+
+  std::atomic<State> state;
+  std::atomic<int> progress;
+  std::atomic<int> progressTotal;
+  std::thread thread;
+
+  static const int MAX_CAVE_STEPS = 400;
+  static const int MAX_VEIN_STEPS = 150;
+
+  static const int REGION_SIZE = 32;
+  static const int REGION_MARGIN = 8;
+  static const int REGIONS_X = Level::WIDTH / REGION_SIZE;
+  static const int REGIONS_Z = Level::DEPTH / REGION_SIZE;
+
+  Level* level;
+  std::unique_ptr<Level> staging;
+
+  bool progressive;
+  bool playable;
+  std::atomic<int> finishedRegions;
+  std::mutex finishedMutex;
+  std::vector<int> finished;
+  RegionStage regionStages[REGIONS_X * REGIONS_Z];
+
   int heights[Level::WIDTH * Level::DEPTH];
 
-  Random random = { uint64_t(std::time(nullptr)) };
+  uint64_t seed = uint64_t(std::time(nullptr));
+
+  Random random = { seed };
   CombinedNoise noise1 = { OctaveNoise(random, 8), OctaveNoise(random, 8) };
   CombinedNoise noise2 = { OctaveNoise(random, 8), OctaveNoise(random, 8) };
   OctaveNoise noise3 = { random, 6 };
@@ -6,6 +6,7 @@
 
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <cstring>
 
 void LevelRenderer::init()
 {
@@ -26,18 +27,36 @@ void LevelRenderer::init()
 
 void LevelRenderer::render()
 {
+  Chunk* updates[MAX_CHUNK_UPDATES];
+
   int chunkUpdates = 0;
   while (chunkUpdates < MAX_CHUNK_UPDATES && !chunkQueue.empty())
   {
     Chunk* chunk = chunkQueue.top();
-    chunk->isLoaded = true;
-    chunk->update();
+    chunk->isQueued = false;
 
-    chunkUpdates++;
+    updates[chunkUpdates++] = chunk;
     chunkQueue.pop();
   }
 
+  game.profiler.measure(Profiler::Scope::Meshing, [&] {
+    game.jobs.parallelFor(0, chunkUpdates, 1, [&](int begin, int end) {
+      for (int i = begin; i < end; i++)
+      {
+        updates[i]->build(meshes[i]);
+      }
+    });
+  });
+
+  game.profiler.measure(Profiler::Scope::Upload, [&] {
+    for (int i = 0; i < chunkUpdates; i++)
+    {
+      updates[i]->upload(meshes[i]);
+    }
+  });
+
   game.chunkUpdates += chunkUpdates;
+  game.profiler.count(Profiler::Counter::ChunkUpdates, chunkUpdates);
 
   glBindTexture(GL_TEXTURE_2D, game.atlasTexture);
   
@@ -148,8 +167,7 @@ void LevelRenderer::updateWaterTexture()
     waterTextureData[(i << 2) + 3] = d;
   }
 
-  const auto texture = Block::Definitions[(unsigned char)Block::Type::BLOCK_WATER].topTexture;
-  glTexSubImage2D(GL_TEXTURE_2D, 0, texture % 16 << 4, texture / 16 << 4, 16, 16, GL_RGBA, GL_UNSIGNED_BYTE, waterTextureData);
+  updateTile(Block::Definitions[(unsigned char)Block::Type::BLOCK_WATER].topTexture, waterTextureData);
   
   skybox.updateWater(waterTextureData);
 }
@@ -203,17 +221,38 @@ void LevelRenderer::updateLavaTexture()
     lavaTextureData[(i << 2) + 3] = -1;
   }
 
-  const auto texture = Block::Definitions[(unsigned char)Block::Type::BLOCK_LAVA].topTexture;
-  glTexSubImage2D(GL_TEXTURE_2D, 0, texture % 16 << 4, texture / 16 << 4, 16, 16, GL_RGBA, GL_UNSIGNED_BYTE, lavaTextureData);
+  updateTile(Block::Definitions[(unsigned char)Block::Type::BLOCK_LAVA].topTexture, lavaTextureData);
+}
+
+void LevelRenderer::updateTile(int texture, const unsigned char* data)
+{
+  const auto scale = (int)game.atlasScale;
+  const auto size = 16 * scale;
+
+  if (scale == 1)
+  {
+    glTexSubImage2D(GL_TEXTURE_2D, 0, texture % 16 << 4, texture / 16 << 4, 16, 16, GL_RGBA, GL_UNSIGNED_BYTE, data);
+    return;
+  }
+
+  tileData.resize(size * size * 4);
+
+  for (int y = 0; y < size; y++)
+  {
+    for (int x = 0; x < size; x++)
+    {
+      std::memcpy(&tileData[(x + y * size) * 4], &data[(x / scale + (y / scale << 4)) * 4], 4);
+    }
+  }
+
+  glTexSubImage2D(GL_TEXTURE_2D, 0, texture % 16 * size, texture / 16 * size, size, size, GL_RGBA, GL_UNSIGNED_BYTE, tileData.data());
 }
 
 void LevelRenderer::loadAllChunks()
 {
   for (auto& chunk : chunks)
   {
-    chunk.isLoaded = false;
-
-    chunkQueue.push(&chunk);
+    queue(&chunk);
   }
 }
 
@@ -243,15 +282,39 @@ void LevelRenderer::loadChunks(int x, int y, int z)
       continue;
     }
 
-    if (Chunk* chunk = getChunk(offsetX, offsetY, offsetZ); chunk->isLoaded)
-    {
-      chunk->isLoaded = false;
+    queue(getChunk(offsetX, offsetY, offsetZ));
+  }
+}
 
-      chunkQueue.push(chunk);
+void LevelRenderer::loadRegion(int x0, int z0, int x1, int z1)
+{
+  const int chunkX0 = glm::max(x0, 0) / Chunk::SIZE;
+  const int chunkZ0 = glm::max(z0, 0) / Chunk::SIZE;
+  const int chunkX1 = glm::min((x1 + Chunk::SIZE - 1) / Chunk::SIZE, CHUNKS_X);
+  const int chunkZ1 = glm::min((z1 + Chunk::SIZE - 1) / Chunk::SIZE, CHUNKS_Z);
+
+  for (int z = chunkZ0; z < chunkZ1; z++)
+  {
+    for (int y = 0; y < CHUNKS_Y; y++)
+    {
+      for (int x = chunkX0; x < chunkX1; x++)
+      {
+        queue(getChunk(x, y, z));
+      }
     }
   }
 }
 
+void LevelRenderer::queue(Chunk* chunk)
+{
+  if (!chunk->isQueued)
+  {
+    chunk->isQueued = true;
+
+    chunkQueue.push(chunk);
+  }
+}
+
 Chunk* LevelRenderer::getChunk(int x, int y, int z)
 {
   return &chunks[(z * CHUNKS_Y + y) * CHUNKS_X + x];
@@ -4,6 +4,7 @@
 #include "Level.h"
 
 #include <queue>
+#include <vector>
 #include <GL/glew.h>
 
 class Level;
@@ -19,11 +20,14 @@ public:
 
   void loadAllChunks();
   void loadChunks(int x, int y, int z);
+  void loadRegion(int x0, int z0, int x1, int z1);
   Chunk* getChunk(int x, int y, int z);
 
 private:
   void updateWaterTexture();
   void updateLavaTexture();
+  void updateTile(int texture, const unsigned char* data);
+  void queue(Chunk* chunk);
 
   const static int MAX_CHUNK_UPDATES = 4;
   const static int CHUNKS_X = Level::WIDTH / Chunk::SIZE;
@@ -33,6 +37,8 @@ private:
   Skybox skybox;
 
   Chunk chunks[CHUNKS_X * CHUNKS_Y * CHUNKS_Z];
+  ChunkMesher::Mesh meshes[MAX_CHUNK_UPDATES];
   std::priority_queue<Chunk*, std::vector<Chunk*>, Chunk::Comparator> chunkQueue;
+  std::vector<unsigned char> tileData;
 };
 
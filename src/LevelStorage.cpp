@@ -0,0 +1,247 @@
+#include "LevelStorage.h"
+#include "Game.h"
+
+#include <climits>
+#include <cstring>
+
+#if defined(EMSCRIPTEN)
+#include <emscripten/emscripten.h>
+#endif
+
+LevelStorage::~LevelStorage()
+{
+  if (thread.joinable())
+  {
+    thread.join();
+  }
+}
+
+void LevelStorage::init()
+{
+  state = State::Idle;
+  done = false;
+  progress = 0;
+  succeeded = false;
+  appliedSlabs = 0;
+}
+
+void LevelStorage::update()
+{
+  switch (state)
+  {
+  case State::Saving:
+    if (done)
+    {
+      finishSave();
+    }
+    break;
+  case State::Loading:
+    if (done)
+    {
+#if !defined(EMSCRIPTEN)
+      thread.join();
+#endif
+
+      if (!succeeded)
+      {
+        state = State::Idle;
+
+        game.ui.closeMenu();
+        game.ui.log("Failed to load level.");
+        return;
+      }
+
+      appliedSlabs = 0;
+      state = State::Applying;
+
+      // Applying the save to a mapped level would overwrite the mapped file, so the loaded level is kept in memory.
+      game.level.unmap();
+      game.level.reset();
+    }
+    else
+    {
+      char description[64];
+      snprintf(description, sizeof(description), "Reading level... %d%%", progress * 100 / SaveFile::CHUNK_COUNT);
+
+      game.ui.openStatusMenu("Loading Level", description);
+    }
+    break;
+  case State::Applying:
+    apply();
+    break;
+  default:
+    break;
+  }
+}
+
+bool LevelStorage::save(const std::string& path_)
+{
+  if (state != State::Idle)
+  {
+    return false;
+  }
+
+  path = path_;
+  state = State::Saving;
+
+  // A mapped level is its own save file, so saving to it only writes back the pages that changed.
+  if (game.level.isMappedTo(path))
+  {
+    run(&LevelStorage::flush);
+    return true;
+  }
+
+  snapshot.blocks.assign(game.level.blocks, game.level.blocks + Level::VOLUME);
+  snapshot.seed = game.level.seed;
+  snapshot.spawn = game.level.spawn;
+  snapshot.hasSpawn = true;
+
+  run(&LevelStorage::write);
+
+  return true;
+}
+
+bool LevelStorage::load(const std::string& path_)
+{
+  if (state != State::Idle)
+  {
+    return false;
+  }
+
+  path = path_;
+
+  state = State::Loading;
+  run(&LevelStorage::read);
+
+  game.ui.openStatusMenu("Loading Level", "Reading level...");
+
+  return true;
+}
+
+bool LevelStorage::isSaving()
+{
+  return state == State::Saving;
+}
+
+bool LevelStorage::isLoading()
+{
+  return state == State::Loading || state == State::Applying;
+}
+
+void LevelStorage::run(bool (LevelStorage::*task)())
+{
+  done = false;
+  progress = 0;
+
+#if defined(EMSCRIPTEN)
+  succeeded = (this->*task)();
+  done = true;
+#else
+  if (thread.joinable())
+  {
+    thread.join();
+  }
+
+  thread = std::thread([this, task]() {
+    Profiler::Sample sample(Profiler::Scope::StorageIO);
+
+    succeeded = (this->*task)();
+    done = true;
+  });
+#endif
+}
+
+bool LevelStorage::write()
+{
+  return SaveFile::write(path, snapshot, cache);
+}
+
+bool LevelStorage::flush()
+{
+  return game.level.flush();
+}
+
+bool LevelStorage::read()
+{
+  if (!SaveFile::read(path, snapshot, &progress))
+  {
+    return false;
+  }
+
+  Journal::replay(Journal::getPath(path), snapshot.blocks);
+
+  return true;
+}
+
+void LevelStorage::apply()
+{
+  const int slab = SaveFile::CHUNK_SIZE;
+  const int z0 = appliedSlabs * slab;
+  const int z1 = z0 + slab;
+
+  std::memcpy(
+    game.level.blocks + z0 * Level::HEIGHT * Level::WIDTH,
+    snapshot.blocks.data() + z0 * Level::HEIGHT * Level::WIDTH,
+    slab * Level::HEIGHT * Level::WIDTH
+  );
+
+  game.level.calculateLightDepths(0, z0, Level::WIDTH, slab);
+  game.levelRenderer.loadRegion(0, z0 - 1, Level::WIDTH, z1 + 1);
+
+  appliedSlabs++;
+
+  if (appliedSlabs < Level::DEPTH / slab)
+  {
+    char description[64];
+    snprintf(description, sizeof(description), "Applying level... %d%%", appliedSlabs * slab * 100 / Level::DEPTH);
+
+    game.ui.openStatusMenu("Loading Level", description);
+    return;
+  }
+
+  game.level.seed = snapshot.seed;
+
+  if (snapshot.hasSpawn)
+  {
+    game.level.spawn = snapshot.spawn;
+  }
+  else
+  {
+    game.level.calculateSpawnPosition();
+  }
+
+  game.localPlayer.respawn();
+  game.level.reset();
+  game.journal.compact();
+
+  game.network.sendLevel(UCHAR_MAX, true);
+
+  state = State::Idle;
+
+  game.ui.closeMenu();
+}
+
+void LevelStorage::finishSave()
+{
+#if !defined(EMSCRIPTEN)
+  thread.join();
+#endif
+
+  state = State::Idle;
+
+  if (!succeeded)
+  {
+    game.ui.log("Failed to save level.");
+    return;
+  }
+
+#if defined(EMSCRIPTEN)
+  EM_ASM(
+    FS.syncfs(false, function(err) {
+      console.log(err);
+    });
+  );
+#endif
+
+  game.ui.log("Level saved.");
+}
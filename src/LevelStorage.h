@@ -0,0 +1,49 @@
+#pragma once
+#include "SaveFile.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+class LevelStorage
+{
+public:
+  ~LevelStorage();
+
+  void init();
+  void update();
+
+  bool save(const std::string& path);
+  bool load(const std::string& path);
+
+  bool isSaving();
+  bool isLoading();
+
+private:
+  enum class State
+  {
+    Idle,
+    Saving,
+    Loading,
+    Applying,
+  };
+
+  void run(bool (LevelStorage::*task)());
+  bool write();
+  bool flush();
+  bool read();
+  void apply();
+  void finishSave();
+
+  std::atomic<State> state;
+  std::atomic<bool> done;
+  std::atomic<int> progress;
+  std::thread thread;
+
+  bool succeeded;
+  int appliedSlabs;
+
+  std::string path;
+  SaveFile::Snapshot snapshot;
+  SaveFile::Cache cache;
+};
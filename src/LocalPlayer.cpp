@@ -11,7 +11,7 @@
 
 void LocalPlayer::init()
 {
-  Entity::init();
+  Entity::init(&game.level);
 
   footSize = 0.5f;
   heightOffset = 1.62f;
@@ -142,7 +142,7 @@ void LocalPlayer::interact()
 
         if (game.network.isConnected() && !game.network.isHost())
         {
-          game.network.sendSetBlock(vx, vy, vz, (unsigned char)Block::Type::BLOCK_AIR);
+          game.network.predictSetBlock(vx, vy, vz, (unsigned char)Block::Type::BLOCK_AIR, blockType);
         }
       }
     }
@@ -174,7 +174,7 @@ void LocalPlayer::interact()
 
           if (game.network.isConnected() && !game.network.isHost())
           {
-            game.network.sendSetBlock(vx, vy, vz, heldBlockType);
+            game.network.predictSetBlock(vx, vy, vz, heldBlockType, blockType);
           }
 
           selectedIndex = 0;
@@ -570,4 +570,11 @@ void LocalPlayer::setPosition(float x, float y, float z)
 {
   Entity::setPosition(x, y, z);
   Entity::move(0.0f, -heightOffset, 0.0f);
+}
+
+void LocalPlayer::respawn()
+{
+  setPosition(game.level.spawn.x, game.level.spawn.y, game.level.spawn.z);
+
+  game.level.spawn = position;
 }
\ No newline at end of file
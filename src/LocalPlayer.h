@@ -18,6 +18,7 @@ public:
   void update();
   void interact();
   void setPosition(float x, float y, float z);
+  void respawn();
 
   glm::vec2 viewAngles;
   glm::vec3 viewPosition;
@@ -85,5 +86,6 @@ private:
   const glm::vec3 UP = glm::vec3(0.0, 1.0, 0.0);
 
   friend class UI;
+  friend class Flythrough;
 };
 
@@ -2,11 +2,22 @@
 #include "Game.h"
 #include "LZ.h"
 #include "JSON.h"
+#include "Datagram.h"
 
 #include <cstdlib>
+#include <cstring>
+#include <algorithm>
 
 static Network* network;
 
+static bool isFinite(float value)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+
+  return (bits & 0x7f800000) != 0x7f800000;
+}
+
 #if defined(EMSCRIPTEN)
 #include <emscripten/emscripten.h>
 #include <emscripten/websocket.h>
@@ -84,6 +95,7 @@ using websocketpp::lib::bind;
 
 static websocketpp_connection_handle socket_connection_handle;
 static websocketpp_client* socket_client;
+static std::unique_ptr<Datagram> datagram;
 
 void websocketpp_on_message(websocketpp_client* socket, websocketpp_connection_handle connection_handle, websocketpp_message_ptr message)
 {
@@ -117,7 +129,29 @@ void Network::init()
 {
   url = "...";
   connected = false;
+  sequence = 0;
+  acknowledgement = {};
+  replica = {};
+  statistics = {};
+  transport = Transport::WebSocket;
+  datagramLoss = 0.0f;
   network = this;
+
+#if !defined(EMSCRIPTEN)
+  const char* transportUri = std::getenv("CUBIC_TRANSPORT");
+  const char* packetLoss = std::getenv("CUBIC_PACKET_LOSS");
+
+  if (transportUri && !std::strncmp(transportUri, "udp://", 6))
+  {
+    transport = Transport::Datagram;
+    datagramUri = transportUri + 6;
+  }
+
+  if (packetLoss)
+  {
+    datagramLoss = (float)std::atof(packetLoss);
+  }
+#endif
 }
 
 void Network::connect()
@@ -149,6 +183,47 @@ void Network::connect()
 #else
   game.ui.openStatusMenu(title, description);
 
+  // The replay delivers the recorded connection's messages instead.
+  if (game.replay.isReplaying())
+  {
+    return;
+  }
+
+  if (transport == Transport::Datagram)
+  {
+    const auto separator = datagramUri.rfind(':');
+
+    if (separator == std::string::npos)
+    {
+      printf("Failed to connect: invalid datagram address %s\n", datagramUri.c_str());
+      return;
+    }
+
+    // Replacing the previous transport closes it.
+    datagram = std::make_unique<Datagram>();
+    datagram->loss = datagramLoss;
+
+    datagram->onOpen = []() { network->onOpen(); };
+    datagram->onClose = []() { network->onClose(); };
+    datagram->onMessage = [](const unsigned char* data, size_t size, bool text) {
+      if (text)
+      {
+        network->onMessage(std::string(data, data + size));
+      }
+      else
+      {
+        network->onBinaryMessage(data, size);
+      }
+    };
+
+    if (!datagram->open(datagramUri.substr(0, separator), (unsigned short)std::atoi(datagramUri.c_str() + separator + 1)))
+    {
+      printf("Failed to connect: %s\n", datagramUri.c_str());
+    }
+
+    return;
+  }
+
   try
   {
     socket_client = new websocketpp_client;
@@ -184,14 +259,54 @@ void Network::connect()
 void Network::tick()
 {
 #if !defined(EMSCRIPTEN)
+  game.replay.poll();
+
   if (socket_client)
   {
     socket_client->poll();
   }
+
+  if (datagram)
+  {
+    datagram->poll();
+  }
 #endif
 
   sendPosition(game.localPlayer.position, game.localPlayer.rotation);
 
+  for (auto& player : players)
+  {
+    if (player)
+    {
+      player->editTokens = std::min(player->editTokens + EDIT_RATE / game.timer.ticksPerSecond, EDIT_BURST);
+      player->positionTokens = std::min(player->positionTokens + POSITION_RATE / game.timer.ticksPerSecond, POSITION_BURST);
+      player->correctionTokens = std::min(player->correctionTokens + CORRECTION_RATE / game.timer.ticksPerSecond, CORRECTION_BURST);
+    }
+  }
+
+  for (auto prediction = predictions.begin(); prediction != predictions.end();)
+  {
+    if (game.timer.ticks - prediction->tick > PREDICTION_TIMEOUT)
+    {
+      printf("network error: set block prediction was never acknowledged.\n");
+
+      // Fall back to the last tile the host told us about, the edit may never have reached it.
+      const auto position = prediction->position;
+      const auto blockType = prediction->authoritativeBlockType;
+
+      prediction = predictions.erase(prediction);
+      game.level.setTileWithNeighborChange(position.x, position.y, position.z, blockType);
+      continue;
+    }
+
+    prediction++;
+  }
+
+  if (isHost() && game.timer.ticks % STATE_INTERVAL == 0)
+  {
+    sendState();
+  }
+
   for (auto positionPacket = positionPackets.begin(); positionPacket != positionPackets.end();)
   {
     const auto index = positionPacket->index;
@@ -243,6 +358,8 @@ void Network::tick()
       }
     }
   }
+
+  flush();
 }
 
 void Network::render()
@@ -272,6 +389,17 @@ void Network::send(const std::string& text)
     printf("Failed to send: %d\n", result);
   }
 #else
+  if (game.replay.isReplaying())
+  {
+    return;
+  }
+
+  if (datagram)
+  {
+    datagram->send((const unsigned char*)text.data(), text.size(), Datagram::Channel::Reliable, true);
+    return;
+  }
+
   if (!socket_client)
   {
     printf("Failed to send, socket_client is nullptr\n");
@@ -298,6 +426,19 @@ void Network::sendBinary(unsigned char* data, size_t size)
     printf("Failed to send binary: %d\n", result);
   }
 #else
+  if (game.replay.isReplaying())
+  {
+    return;
+  }
+
+  if (datagram)
+  {
+    const auto channel = data[1] == (unsigned char)PacketType::Position ? Datagram::Channel::Unreliable : Datagram::Channel::Reliable;
+
+    datagram->send(data, size, channel);
+    return;
+  }
+
   if (!socket_client)
   {
     printf("Failed to send, socket_client is nullptr\n");
@@ -315,16 +456,142 @@ void Network::sendBinary(unsigned char* data, size_t size)
 #endif
 }
 
+void Network::queueBinary(unsigned char* data, size_t size)
+{
+  const auto index = data[0];
+  const auto type = data[1];
+
+  auto batch = std::find_if(batches.begin(), batches.end(), [&](const Batch& batch) {
+    return batch.index == index;
+  });
+
+  if (batch == batches.end())
+  {
+    batch = batches.insert(batches.end(), { index, 0, SIZE_MAX, {} });
+  }
+
+  if (batch->data.empty())
+  {
+    auto packet = BatchPacket();
+    packet.index = index;
+
+    batch->data.insert(batch->data.end(), (unsigned char*)&packet, (unsigned char*)&packet + sizeof(packet));
+  }
+
+  if (type == (unsigned char)PacketType::Position && batch->positionOffset != SIZE_MAX)
+  {
+    std::memcpy(batch->data.data() + batch->positionOffset, data + 1, size - 1);
+
+    statistics.droppedPositions++;
+    return;
+  }
+
+  const auto length = uint16_t(size - 1);
+  const auto offset = batch->data.size();
+
+  batch->data.resize(offset + sizeof(length) + length);
+  std::memcpy(batch->data.data() + offset, &length, sizeof(length));
+  std::memcpy(batch->data.data() + offset + sizeof(length), data + 1, length);
+
+  if (type == (unsigned char)PacketType::Position)
+  {
+    batch->positionOffset = offset + sizeof(length);
+  }
+
+  batch->count++;
+}
+
+void Network::flush()
+{
+  statistics.queuedPackets = 0;
+
+  for (auto& batch : batches)
+  {
+    if (batch.count == 1)
+    {
+      const auto offset = sizeof(BatchPacket) + sizeof(uint16_t);
+
+      batchBuffer.resize(batch.data.size() - offset + 1);
+      batchBuffer[0] = batch.index;
+      std::memcpy(batchBuffer.data() + 1, batch.data.data() + offset, batchBuffer.size() - 1);
+
+      sendBinary(batchBuffer.data(), batchBuffer.size());
+    }
+    else if (batch.count > 1)
+    {
+      sendBinary(batch.data.data(), batch.data.size());
+    }
+
+    statistics.queuedPackets += batch.count;
+
+    batch.data.clear();
+    batch.count = 0;
+    batch.positionOffset = SIZE_MAX;
+  }
+
+  statistics.bufferedAmount = getBufferedAmount();
+
+#if !defined(EMSCRIPTEN)
+  if (datagram)
+  {
+    statistics.roundTripTime = datagram->statistics.roundTripTime;
+    statistics.retransmits = datagram->statistics.retransmits;
+  }
+#endif
+}
+
+size_t Network::getBufferedAmount()
+{
+#if defined(EMSCRIPTEN)
+  size_t bufferedAmount = 0;
+  emscripten_websocket_get_buffered_amount(socket, &bufferedAmount);
+
+  return bufferedAmount;
+#else
+  if (datagram)
+  {
+    return datagram->getBufferedAmount();
+  }
+
+  if (!socket_client)
+  {
+    return 0;
+  }
+
+  websocketpp::lib::error_code error_code;
+  auto connection = socket_client->get_con_from_hdl(socket_connection_handle, error_code);
+
+  if (error_code)
+  {
+    return 0;
+  }
+
+  return connection->get_buffered_amount();
+#endif
+}
+
 void Network::sendPosition(const glm::vec3& position, const glm::vec2& rotation)
 {
   if (isConnected() && players.size() > 1)
   {
+    if (statistics.bufferedAmount > MAX_BUFFERED_AMOUNT)
+    {
+      statistics.droppedPositions++;
+      return;
+    }
+
     auto packet = PositionPacket();
     packet.index = UCHAR_MAX;
     packet.position = position;
     packet.rotation = rotation;
 
-    sendBinary((unsigned char*)&packet, sizeof(packet));
+    if (transport == Transport::Datagram)
+    {
+      sendBinary((unsigned char*)&packet, sizeof(packet));
+      return;
+    }
+
+    queueBinary((unsigned char*)&packet, sizeof(packet));
   }
 }
 
@@ -332,11 +599,18 @@ void Network::sendLevel(unsigned char index, bool respawn)
 {
   if (isConnected() && players.size() > 1)
   {
-    auto packet = std::make_unique<LevelPacket>();
+    if (!levelPacket)
+    {
+      levelPacket = std::make_unique<LevelPacket>();
+    }
+
+    auto& packet = levelPacket;
     packet->index = index;
     packet->respawn = respawn;
+    packet->version = game.level.version;
     packet->length = fastlz_compress(game.level.blocks, sizeof(packet->data) / 2, packet->data);
 
+    flush();
     sendBinary(
       (unsigned char*)packet.get(),
       sizeof(*packet) - sizeof(packet->data) + packet->length
@@ -353,23 +627,65 @@ void Network::sendSetBlock(int x, int y, int z, unsigned char blockType, bool mo
     if (isHost())
     {
       packet.index = UCHAR_MAX;
+      game.level.version++;
+
+      if (acknowledgement.pending && acknowledgement.position == glm::ivec3(x, y, z))
+      {
+        packet.origin = acknowledgement.origin;
+        packet.sequence = acknowledgement.sequence;
+
+        acknowledgement.pending = false;
+      }
     }
     else
     {
       packet.index = 0;
+      packet.sequence = ++sequence;
+
+      auto prediction = std::find_if(predictions.begin(), predictions.end(), [&](const Prediction& prediction) {
+        return prediction.position == glm::ivec3(x, y, z);
+      });
+
+      if (prediction != predictions.end())
+      {
+        prediction->sequence = packet.sequence;
+        prediction->tick = game.timer.ticks;
+      }
+      else
+      {
+        predictions.push_back({ glm::ivec3(x, y, z), packet.sequence, game.timer.ticks, game.level.getTile(x, y, z) });
+      }
     }
 
     packet.position = glm::ivec3(x, y, z);
     packet.blockType = blockType;
     packet.mode = mode;
 
-    sendBinary(
+    queueBinary(
       (unsigned char*)&packet,
       sizeof(packet)
     );
   }
 }
 
+void Network::predictSetBlock(int x, int y, int z, unsigned char blockType, unsigned char previousBlockType)
+{
+  if (isConnected() && players.size() > 1)
+  {
+    auto prediction = std::find_if(predictions.begin(), predictions.end(), [&](const Prediction& prediction) {
+      return prediction.position == glm::ivec3(x, y, z);
+    });
+
+    // An outstanding prediction already remembers the tile from before any of our edits.
+    if (prediction == predictions.end())
+    {
+      predictions.push_back({ glm::ivec3(x, y, z), 0, game.timer.ticks, previousBlockType });
+    }
+
+    sendSetBlock(x, y, z, blockType);
+  }
+}
+
 bool Network::isConnected()
 {
   return connected;
@@ -390,6 +706,196 @@ size_t Network::count()
   return players.size();
 }
 
+size_t Network::localIndex()
+{
+  for (size_t index = 0; index < players.size(); index++)
+  {
+    if (!players[index])
+    {
+      return index;
+    }
+  }
+
+  return UCHAR_MAX;
+}
+
+void Network::acknowledge()
+{
+  if (acknowledgement.pending)
+  {
+    const auto position = acknowledgement.position;
+
+    sendSetBlock(position.x, position.y, position.z, game.level.getTile(position.x, position.y, position.z));
+  }
+
+  acknowledgement.pending = false;
+}
+
+bool Network::reconcile(const SetBlockPacket* packet)
+{
+  const auto position = glm::ivec3(packet->position);
+
+  for (auto prediction = predictions.begin(); prediction != predictions.end(); prediction++)
+  {
+    if (prediction->position == position)
+    {
+      if (packet->origin != localIndex() || packet->sequence != prediction->sequence)
+      {
+        prediction->authoritativeBlockType = packet->blockType;
+        return false;
+      }
+
+      predictions.erase(prediction);
+      return true;
+    }
+  }
+
+  return true;
+}
+
+bool Network::validate(Player* player, const SetBlockPacket* packet)
+{
+  const auto position = glm::ivec3(packet->position);
+
+  if (!game.level.isInBounds(position.x, position.y, position.z))
+  {
+    return false;
+  }
+
+  if (packet->blockType >= sizeof(Block::Definitions) / sizeof(*Block::Definitions))
+  {
+    return false;
+  }
+
+  const auto eye = player->position + glm::vec3(0.0f, 1.62f, 0.0f);
+
+  return glm::distance(eye, glm::vec3(position) + 0.5f) <= MAX_REACH;
+}
+
+bool Network::validate(PositionPacket* packet)
+{
+  const auto index = packet->index;
+
+  if (index >= players.size() || !players[index])
+  {
+    printf("network error: index out of bounds for position packet.\n");
+    return false;
+  }
+
+  auto& player = players[index];
+
+  if (player->positionTokens < 1.0f)
+  {
+    statistics.limitedPositions++;
+    return false;
+  }
+
+  player->positionTokens -= 1.0f;
+
+  const float values[] = {
+    packet->position.x, packet->position.y, packet->position.z,
+    packet->rotation.x, packet->rotation.y
+  };
+
+  for (const auto value : values)
+  {
+    if (!isFinite(value))
+    {
+      printf("network error: invalid position packet values.\n");
+      return false;
+    }
+  }
+
+  const auto minimum = glm::vec3(-MAX_DISTANCE);
+  const auto maximum = glm::vec3(Level::WIDTH, Level::HEIGHT, Level::DEPTH) + MAX_DISTANCE;
+
+  const auto position = glm::clamp(glm::vec3(packet->position), minimum, maximum);
+  const auto rotation = glm::vec2(packet->rotation.x, glm::clamp(packet->rotation.y, -90.0f, 90.0f));
+
+  if (position != glm::vec3(packet->position) || rotation != glm::vec2(packet->rotation))
+  {
+    packet->position = position;
+    packet->rotation = rotation;
+
+    statistics.clampedPositions++;
+  }
+
+  return true;
+}
+
+void Network::sendState()
+{
+  if (isConnected() && players.size() > 1)
+  {
+    const auto& updates = game.level.updates;
+
+    if (updates.empty() && replica.updates.empty() && replica.version == game.level.version)
+    {
+      return;
+    }
+
+    auto packet = std::make_unique<StatePacket>();
+    packet->index = UCHAR_MAX;
+    packet->version = game.level.version;
+    packet->count = 0;
+
+    replica.version = game.level.version;
+    replica.updates.clear();
+
+    for (size_t i = 0; i < updates.size() && packet->count < MAX_SCHEDULED_UPDATES; i++)
+    {
+      const auto& update = updates[i];
+
+      if (game.level.isInBounds(update.x, update.y, update.z))
+      {
+        packet->updates[packet->count++] = glm::u8vec3(update);
+        replica.updates.push_back(update);
+      }
+    }
+
+    queueBinary(
+      (unsigned char*)packet.get(),
+      sizeof(*packet) - sizeof(packet->updates) + packet->count * sizeof(*packet->updates)
+    );
+  }
+}
+
+void Network::sendVersion(unsigned char index)
+{
+  if (isConnected() && players.size() > 1)
+  {
+    auto packet = VersionPacket();
+    packet.index = index;
+    packet.version = game.level.version;
+
+    queueBinary(
+      (unsigned char*)&packet,
+      sizeof(packet)
+    );
+  }
+}
+
+void Network::migrate()
+{
+  game.level.reset();
+
+  for (const auto& update : replica.updates)
+  {
+    game.level.updates.push_back(update);
+  }
+
+  // The old host never confirmed our outstanding edits, so everyone else still has the tiles from before them.
+  for (const auto& prediction : predictions)
+  {
+    const auto& position = prediction.position;
+    sendSetBlock(position.x, position.y, position.z, game.level.getTile(position.x, position.y, position.z));
+  }
+
+  predictions.clear();
+
+  sendVersion(UCHAR_MAX);
+}
+
 void Network::join(const std::string& id)
 {
   if (isConnected())
@@ -442,6 +948,8 @@ void Network::create()
 
 void Network::onOpen()
 {
+  game.replay.recordOpen();
+
   connected = true;
 
 #if defined(EMSCRIPTEN)
@@ -464,6 +972,8 @@ void Network::onOpen()
 
 void Network::onClose()
 {
+  game.replay.recordClose();
+
 #if defined(EMSCRIPTEN)
   setHash("");
 #endif
@@ -472,16 +982,21 @@ void Network::onClose()
   connected = false;
 
   players.clear();
+  predictions.clear();
+  batches.clear();
   game.ui.openStatusMenu("Disconnected", "The connection was closed.", true);
 }
 
 void Network::onMessage(const std::string& text)
 {
+  game.replay.recordMessage(text);
+
   const auto MAX_FIELDS = 4;
   json_t pool[MAX_FIELDS];
 
-  auto json = text;
-  auto message = json_create(json.data(), pool, MAX_FIELDS);
+  // The parser writes into the text, so it gets a copy, kept between messages to avoid allocating one each time.
+  messageBuffer.assign(text);
+  auto message = json_create(messageBuffer.data(), pool, MAX_FIELDS);
   
   std::string type = json_getValue(json_getProperty(message, "type"));
   if (type == "error")
@@ -566,10 +1081,10 @@ void Network::onMessage(const std::string& text)
 
     if (isHost())
     {
-      sendLevel(
-        UCHAR_MAX,
-        false
-      );
+      if (!index)
+      {
+        migrate();
+      }
 
       if (game.ui.state == UI::State::StatusMenu)
       {
@@ -587,6 +1102,15 @@ void Network::onMessage(const std::string& text)
 
 void Network::onBinaryMessage(const unsigned char* data, size_t size)
 {
+  game.replay.recordBinaryMessage(data, size);
+
+  handleBinaryMessage(data, size);
+}
+
+void Network::handleBinaryMessage(const unsigned char* data, size_t size)
+{
+  Profiler::Sample sample(Profiler::Scope::NetworkMessage);
+
   if (size < 2)
   {
     printf("network error: packet is too small.\n");
@@ -596,7 +1120,38 @@ void Network::onBinaryMessage(const unsigned char* data, size_t size)
   unsigned char index = data[0];
   unsigned char type = data[1];
 
-  if (type == (unsigned char)PacketType::Level)
+  if (type == (unsigned char)PacketType::Batch)
+  {
+    std::vector<unsigned char> packet;
+
+    for (size_t offset = sizeof(BatchPacket); offset < size;)
+    {
+      uint16_t length;
+
+      if (offset + sizeof(length) > size)
+      {
+        printf("network error: invalid batch packet size.\n");
+        return;
+      }
+
+      std::memcpy(&length, data + offset, sizeof(length));
+      offset += sizeof(length);
+
+      if (length < 1 || offset + length > size || data[offset] == (unsigned char)PacketType::Batch)
+      {
+        printf("network error: invalid batched packet.\n");
+        return;
+      }
+
+      packet.resize(length + 1);
+      packet[0] = index;
+      std::memcpy(packet.data() + 1, data + offset, length);
+      offset += length;
+
+      handleBinaryMessage(packet.data(), packet.size());
+    }
+  }
+  else if (type == (unsigned char)PacketType::Level)
   {
     if (size > sizeof(LevelPacket))
     {
@@ -624,10 +1179,84 @@ void Network::onBinaryMessage(const unsigned char* data, size_t size)
     if (packet->respawn)
     {
       game.level.calculateSpawnPosition();
+      game.localPlayer.respawn();
     }
 
     game.level.reset();
+    game.level.version = packet->version;
+    game.journal.compact();
     game.ui.closeMenu();
+
+    predictions.clear();
+    replica = { packet->version, {} };
+  }
+  else if (type == (unsigned char)PacketType::State)
+  {
+    StatePacket* packet = (StatePacket*)data;
+
+    if (size < sizeof(StatePacket) - sizeof(packet->updates) || size != sizeof(StatePacket) - sizeof(packet->updates) + packet->count * sizeof(*packet->updates))
+    {
+      printf("network error: invalid state packet size.\n");
+      return;
+    }
+
+    if (index)
+    {
+      printf("network error: cannot process state packet from a non-host.\n");
+      return;
+    }
+
+    replica.version = packet->version;
+    replica.updates.clear();
+
+    for (size_t i = 0; i < packet->count; i++)
+    {
+      replica.updates.push_back(glm::ivec3(packet->updates[i]));
+    }
+  }
+  else if (type == (unsigned char)PacketType::Version)
+  {
+    if (size != sizeof(VersionPacket))
+    {
+      printf("network error: invalid version packet size.\n");
+      return;
+    }
+
+    VersionPacket* packet = (VersionPacket*)data;
+
+    if (isHost())
+    {
+      if (packet->version != game.level.version)
+      {
+        sendLevel(index, false);
+      }
+    }
+    else
+    {
+      if (index)
+      {
+        printf("network error: cannot process version packet from a non-host.\n");
+        return;
+      }
+
+      if (packet->version != game.level.version)
+      {
+        sendVersion(0);
+        return;
+      }
+
+      for (const auto& prediction : predictions)
+      {
+        const auto position = prediction.position;
+
+        sendSetBlock(position.x, position.y, position.z, game.level.getTile(position.x, position.y, position.z));
+      }
+
+      if (game.ui.state == UI::State::StatusMenu)
+      {
+        game.ui.closeMenu();
+      }
+    }
   }
   else if (type == (unsigned char)PacketType::Position)
   {
@@ -637,7 +1266,15 @@ void Network::onBinaryMessage(const unsigned char* data, size_t size)
       return;
     }
 
-    positionPackets.push_back(*(PositionPacket*)data);
+    PositionPacket* packet = (PositionPacket*)data;
+
+    // Only the host is authoritative, everyone else takes what the relay forwards.
+    if (isHost() && !validate(packet))
+    {
+      return;
+    }
+
+    positionPackets.push_back(*packet);
   }
   else if (type == (unsigned char)PacketType::SetBlock)
   {
@@ -649,18 +1286,53 @@ void Network::onBinaryMessage(const unsigned char* data, size_t size)
 
     SetBlockPacket* packet = (SetBlockPacket*)data;
 
+    if (isHost())
+    {
+      if (index >= players.size() || !players[index])
+      {
+        printf("network error: index out of bounds for set block packet.\n");
+        return;
+      }
+
+      auto& player = players[index];
+
+      if (player->editTokens < 1.0f)
+      {
+        // The sender already applied the edit, so tell it what the tile really is, without letting a flood of edits
+        // turn into a flood of replies.
+        if (player->correctionTokens >= 1.0f)
+        {
+          player->correctionTokens -= 1.0f;
+
+          acknowledgement = { packet->position, packet->sequence, index, true };
+          acknowledge();
+        }
+
+        statistics.limitedEdits++;
+        return;
+      }
+
+      player->editTokens -= 1.0f;
+
+      if (!validate(player.get(), packet))
+      {
+        acknowledgement = { packet->position, packet->sequence, index, true };
+        acknowledge();
+
+        statistics.rejectedEdits++;
+        return;
+      }
+    }
+
     auto previousBlockType = game.level.getTile(packet->position.x, packet->position.y, packet->position.z);
 
     if (isHost())
     {
+      acknowledgement = { packet->position, packet->sequence, index, true };
+
       if (game.level.isWaterTile(packet->blockType) || game.level.isLavaTile(packet->blockType))
       {
-        sendSetBlock(
-          packet->position.x,
-          packet->position.y,
-          packet->position.z,
-          previousBlockType
-        );
+        acknowledge();
 
         printf("network error: attempted to place a forbidden block.\n");
         return;
@@ -692,6 +1364,8 @@ void Network::onBinaryMessage(const unsigned char* data, size_t size)
         packet->blockType,
         mode
       );
+
+      acknowledge();
     }
     else
     {
@@ -701,6 +1375,13 @@ void Network::onBinaryMessage(const unsigned char* data, size_t size)
         return;
       }
 
+      game.level.version++;
+
+      if (!reconcile(packet))
+      {
+        return;
+      }
+
       if (
         game.level.setTileWithNoNeighborChange(
           packet->position.x,
@@ -5,6 +5,7 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <climits>
 
 class Network
 {
@@ -17,6 +18,7 @@ public:
   void sendPosition(const glm::vec3& position, const glm::vec2& rotation);
   void sendLevel(unsigned char index, bool respawn);
   void sendSetBlock(int x, int y, int z, unsigned char blockType, bool mode = false);
+  void predictSetBlock(int x, int y, int z, unsigned char blockType, unsigned char previousBlockType);
 
   void join(const std::string& id);
   void create();
@@ -30,10 +32,44 @@ public:
   void onMessage(const std::string& text);
   void onBinaryMessage(const unsigned char* data, size_t size);
 
+  struct Statistics
+  {
+    size_t queuedPackets;
+    size_t bufferedAmount;
+    size_t droppedPositions;
+
+    size_t limitedEdits;
+    size_t rejectedEdits;
+    size_t limitedPositions;
+    size_t clampedPositions;
+
+    float roundTripTime;
+    size_t retransmits;
+  };
+
+  enum class Transport
+  {
+    WebSocket,
+    Datagram,
+  };
+
+  constexpr static float EDIT_RATE = 20.0f;
+  constexpr static float EDIT_BURST = 40.0f;
+  constexpr static float POSITION_RATE = 40.0f;
+  constexpr static float POSITION_BURST = 80.0f;
+  constexpr static float CORRECTION_RATE = 5.0f;
+  constexpr static float CORRECTION_BURST = 10.0f;
+
   std::string url;
+  Statistics statistics;
+  Transport transport;
 private:
   void send(const std::string& text);
   void sendBinary(unsigned char* data, size_t size);
+  void queueBinary(unsigned char* data, size_t size);
+  void flush();
+  void handleBinaryMessage(const unsigned char* data, size_t size);
+  size_t getBufferedAmount();
 
   const char* BASE_URL = "https://cubic.vldr.org/#";
 
@@ -43,12 +79,17 @@ private:
   const char* URI = "ws://relay.vldr.org/";
 #endif
 
+  constexpr static size_t MAX_SCHEDULED_UPDATES = 4096;
+
 #pragma pack(push, 1)
   enum class PacketType : uint8_t
   {
     Level,
     Position,
     SetBlock,
+    Batch,
+    State,
+    Version,
   };
 
   struct Packet
@@ -61,6 +102,7 @@ private:
     PacketType type = PacketType::Level;
 
     uint8_t respawn;
+    uint32_t version;
 
     uint32_t length;
     uint8_t data[2 * Level::WIDTH * Level::HEIGHT * Level::DEPTH];
@@ -82,11 +124,94 @@ private:
 
     uint8_t blockType;
     uint8_t mode;
+
+    uint8_t origin = UCHAR_MAX;
+    uint16_t sequence = 0;
+  };
+
+  struct BatchPacket : Packet
+  {
+    PacketType type = PacketType::Batch;
+  };
+
+  struct StatePacket : Packet
+  {
+    PacketType type = PacketType::State;
+
+    uint32_t version;
+
+    uint16_t count;
+    glm::u8vec3 updates[MAX_SCHEDULED_UPDATES];
+  };
+
+  struct VersionPacket : Packet
+  {
+    PacketType type = PacketType::Version;
+
+    uint32_t version;
   };
 #pragma pack(pop)
 
+  struct Batch
+  {
+    uint8_t index;
+    size_t count;
+    size_t positionOffset;
+    std::vector<unsigned char> data;
+  };
+
+  struct Prediction
+  {
+    glm::ivec3 position;
+    uint16_t sequence;
+    int tick;
+    unsigned char authoritativeBlockType;
+  };
+
+  struct Replica
+  {
+    unsigned int version;
+    std::vector<glm::ivec3> updates;
+  };
+
+  struct Acknowledgement
+  {
+    glm::ivec3 position;
+    uint16_t sequence;
+    uint8_t origin;
+    bool pending;
+  };
+
+  size_t localIndex();
+  void acknowledge();
+  bool reconcile(const SetBlockPacket* packet);
+  bool validate(Player* player, const SetBlockPacket* packet);
+  bool validate(PositionPacket* packet);
+  void sendState();
+  void sendVersion(unsigned char index);
+  void migrate();
+
   bool connected;
+  uint16_t sequence;
+
+  Acknowledgement acknowledgement;
+  Replica replica;
+
+  std::string datagramUri;
+  float datagramLoss;
 
   std::vector<std::unique_ptr<Player>> players;
   std::vector<PositionPacket> positionPackets;
+  std::vector<Prediction> predictions;
+  std::vector<Batch> batches;
+  std::vector<unsigned char> batchBuffer;
+  std::unique_ptr<LevelPacket> levelPacket;
+  std::string messageBuffer;
+
+  const int PREDICTION_TIMEOUT = 100;
+  const int STATE_INTERVAL = 7;
+  const size_t MAX_BUFFERED_AMOUNT = 64 * 1024;
+
+  const float MAX_REACH = 8.0f;
+  const float MAX_DISTANCE = 1024.0f;
 };
@@ -1,6 +1,8 @@
 #include "OctaveNoise.h"
 #include "PerlinNoise.h"
 
+#include <algorithm>
+
 OctaveNoise::OctaveNoise(Random& random, int octaveCount) : octaveCount(octaveCount)
 {
   for (int i = 0; i < octaveCount; i++) 
@@ -22,3 +24,16 @@ float OctaveNoise::compute(float x, float y)
 
   return a;
 }
+
+void OctaveNoise::compute(const float* x, float y, float* out, int count)
+{
+  float b = 1.0;
+
+  std::fill(out, out + count, 0.0f);
+
+  for (int i = 0; i < octaveCount; i++)
+  {
+    noises[i].accumulate(x, y, 1.0f / b, b, out, count);
+    b *= 2;
+  }
+}
@@ -9,6 +9,7 @@ public:
   OctaveNoise(Random& random, int octaveCount);
 
   float compute(float x, float y);
+  void compute(const float* x, float y, float* out, int count);
 private:
   int octaveCount;
   std::vector<PerlinNoise> noises;
@@ -31,6 +31,14 @@ freely, subject to the following restrictions:
 
 #include "PNG.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define UPNG_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define UPNG_NEON
+#include <arm_neon.h>
+#endif
+
 #define MAKE_BYTE(b) ((b) & 0xFF)
 #define MAKE_DWORD(a,b,c,d) ((MAKE_BYTE(a) << 24) | (MAKE_BYTE(b) << 16) | (MAKE_BYTE(c) << 8) | MAKE_BYTE(d))
 #define MAKE_DWORD_PTR(p) MAKE_DWORD((p)[0], (p)[1], (p)[2], (p)[3])
@@ -47,15 +55,6 @@ freely, subject to the following restrictions:
 #define NUM_CODE_LENGTH_CODES 19  /*the code length codes. 0-15: code lengths, 16: copy previous 3-6 times, 17: 3-10 zeros, 18: 11-138 zeros */
 #define MAX_SYMBOLS 288 /* largest number of symbols used by any tree type */
 
-#define DEFLATE_CODE_BITLEN 15
-#define DISTANCE_BITLEN 15
-#define CODE_LENGTH_BITLEN 7
-#define MAX_BIT_LENGTH 15 /* largest bitlen used by any tree type */
-
-#define DEFLATE_CODE_BUFFER_SIZE (NUM_DEFLATE_CODE_SYMBOLS * 2)
-#define DISTANCE_BUFFER_SIZE (NUM_DISTANCE_SYMBOLS * 2)
-#define CODE_LENGTH_BUFFER_SIZE (NUM_DISTANCE_SYMBOLS * 2)
-
 #define SET_ERROR(upng,code) do { (upng)->error = (code); (upng)->error_line = __LINE__; } while (0)
 
 #define upng_chunk_length(chunk) MAKE_DWORD_PTR(chunk)
@@ -100,11 +99,28 @@ struct upng_t {
   upng_source   source;
 };
 
-typedef struct huffman_tree {
-  unsigned* tree2d;
-  unsigned maxbitlen; /*maximum number of bits a single code can get */
-  unsigned numcodes;  /*number of symbols in the alphabet = number of codes */
-} huffman_tree;
+#define FAST_BITS 10 /* codes up to this length are resolved with a single table lookup */
+#define FAST_SIZE (1 << FAST_BITS)
+#define FAST_MASK (FAST_SIZE - 1)
+
+/* lookup-table huffman decoder: short codes hit the fast table directly, longer ones are found by comparing against the canonical code limits */
+typedef struct huffman_table {
+  unsigned short fast[FAST_SIZE]; /* (code length << 9) | symbol, indexed by the next FAST_BITS input bits; 0 means the code is longer */
+  unsigned short firstcode[16];
+  unsigned maxcode[17]; /* first code that doesn't fit in each length, left aligned to 16 bits */
+  unsigned short firstsymbol[16];
+  unsigned char size[MAX_SYMBOLS];
+  unsigned short value[MAX_SYMBOLS];
+} huffman_table;
+
+/* little-endian bit buffer that is refilled a whole word at a time */
+typedef struct bit_reader {
+  const unsigned char* in;
+  unsigned long size;
+  unsigned long pos;  /* next byte to be loaded into the buffer */
+  unsigned long long buffer;
+  unsigned count; /* valid bits in buffer */
+} bit_reader;
 
 static const unsigned LENGTH_BASE[29] = { /*the base lengths represented by codes 257-285 */
   3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59,
@@ -129,387 +145,310 @@ static const unsigned DISTANCE_EXTRA[30] = {  /*the extra bits of backwards dist
 static const unsigned CLCL[NUM_CODE_LENGTH_CODES] /*the order in which "code length alphabet code lengths" are stored, out of this the huffman tree of the dynamic huffman tree lengths is generated */
 = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
 
-static const unsigned FIXED_DEFLATE_CODE_TREE[NUM_DEFLATE_CODE_SYMBOLS * 2] = {
-  289, 370, 290, 307, 546, 291, 561, 292, 293, 300, 294, 297, 295, 296, 0, 1,
-  2, 3, 298, 299, 4, 5, 6, 7, 301, 304, 302, 303, 8, 9, 10, 11, 305, 306, 12,
-  13, 14, 15, 308, 339, 309, 324, 310, 317, 311, 314, 312, 313, 16, 17, 18,
-  19, 315, 316, 20, 21, 22, 23, 318, 321, 319, 320, 24, 25, 26, 27, 322, 323,
-  28, 29, 30, 31, 325, 332, 326, 329, 327, 328, 32, 33, 34, 35, 330, 331, 36,
-  37, 38, 39, 333, 336, 334, 335, 40, 41, 42, 43, 337, 338, 44, 45, 46, 47,
-  340, 355, 341, 348, 342, 345, 343, 344, 48, 49, 50, 51, 346, 347, 52, 53,
-  54, 55, 349, 352, 350, 351, 56, 57, 58, 59, 353, 354, 60, 61, 62, 63, 356,
-  363, 357, 360, 358, 359, 64, 65, 66, 67, 361, 362, 68, 69, 70, 71, 364,
-  367, 365, 366, 72, 73, 74, 75, 368, 369, 76, 77, 78, 79, 371, 434, 372,
-  403, 373, 388, 374, 381, 375, 378, 376, 377, 80, 81, 82, 83, 379, 380, 84,
-  85, 86, 87, 382, 385, 383, 384, 88, 89, 90, 91, 386, 387, 92, 93, 94, 95,
-  389, 396, 390, 393, 391, 392, 96, 97, 98, 99, 394, 395, 100, 101, 102, 103,
-  397, 400, 398, 399, 104, 105, 106, 107, 401, 402, 108, 109, 110, 111, 404,
-  419, 405, 412, 406, 409, 407, 408, 112, 113, 114, 115, 410, 411, 116, 117,
-  118, 119, 413, 416, 414, 415, 120, 121, 122, 123, 417, 418, 124, 125, 126,
-  127, 420, 427, 421, 424, 422, 423, 128, 129, 130, 131, 425, 426, 132, 133,
-  134, 135, 428, 431, 429, 430, 136, 137, 138, 139, 432, 433, 140, 141, 142,
-  143, 435, 483, 436, 452, 568, 437, 438, 445, 439, 442, 440, 441, 144, 145,
-  146, 147, 443, 444, 148, 149, 150, 151, 446, 449, 447, 448, 152, 153, 154,
-  155, 450, 451, 156, 157, 158, 159, 453, 468, 454, 461, 455, 458, 456, 457,
-  160, 161, 162, 163, 459, 460, 164, 165, 166, 167, 462, 465, 463, 464, 168,
-  169, 170, 171, 466, 467, 172, 173, 174, 175, 469, 476, 470, 473, 471, 472,
-  176, 177, 178, 179, 474, 475, 180, 181, 182, 183, 477, 480, 478, 479, 184,
-  185, 186, 187, 481, 482, 188, 189, 190, 191, 484, 515, 485, 500, 486, 493,
-  487, 490, 488, 489, 192, 193, 194, 195, 491, 492, 196, 197, 198, 199, 494,
-  497, 495, 496, 200, 201, 202, 203, 498, 499, 204, 205, 206, 207, 501, 508,
-  502, 505, 503, 504, 208, 209, 210, 211, 506, 507, 212, 213, 214, 215, 509,
-  512, 510, 511, 216, 217, 218, 219, 513, 514, 220, 221, 222, 223, 516, 531,
-  517, 524, 518, 521, 519, 520, 224, 225, 226, 227, 522, 523, 228, 229, 230,
-  231, 525, 528, 526, 527, 232, 233, 234, 235, 529, 530, 236, 237, 238, 239,
-  532, 539, 533, 536, 534, 535, 240, 241, 242, 243, 537, 538, 244, 245, 246,
-  247, 540, 543, 541, 542, 248, 249, 250, 251, 544, 545, 252, 253, 254, 255,
-  547, 554, 548, 551, 549, 550, 256, 257, 258, 259, 552, 553, 260, 261, 262,
-  263, 555, 558, 556, 557, 264, 265, 266, 267, 559, 560, 268, 269, 270, 271,
-  562, 565, 563, 564, 272, 273, 274, 275, 566, 567, 276, 277, 278, 279, 569,
-  572, 570, 571, 280, 281, 282, 283, 573, 574, 284, 285, 286, 287, 0, 0
-};
-
-static const unsigned FIXED_DISTANCE_TREE[NUM_DISTANCE_SYMBOLS * 2] = {
-  33, 48, 34, 41, 35, 38, 36, 37, 0, 1, 2, 3, 39, 40, 4, 5, 6, 7, 42, 45, 43,
-  44, 8, 9, 10, 11, 46, 47, 12, 13, 14, 15, 49, 56, 50, 53, 51, 52, 16, 17,
-  18, 19, 54, 55, 20, 21, 22, 23, 57, 60, 58, 59, 24, 25, 26, 27, 61, 62, 28,
-  29, 30, 31, 0, 0
-};
+static void bits_refill(bit_reader* br)
+{
+  if (br->pos + 8 <= br->size) {
+    unsigned long long word;
+    memcpy(&word, br->in + br->pos, 8);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    br->buffer |= word << br->count;
+    br->pos += (63 - br->count) >> 3;
+    br->count |= 56;
+  } else {
+    /* past the end the stream is padded with zeros, bits_overrun reports if any of them get consumed */
+    while (br->count <= 56) {
+      if (br->pos < br->size) {
+        br->buffer |= (unsigned long long)br->in[br->pos] << br->count;
+      }
+      br->pos++;
+      br->count += 8;
+    }
+  }
+}
 
-static unsigned char read_bit(unsigned long *bitpointer, const unsigned char *bitstream)
+static int bits_overrun(const bit_reader* br)
 {
-  unsigned char result = (unsigned char)((bitstream[(*bitpointer) >> 3] >> ((*bitpointer) & 0x7)) & 1);
-  (*bitpointer)++;
-  return result;
+  return br->pos > br->size && (br->pos - br->size) * 8 > br->count;
 }
 
-static unsigned read_bits(unsigned long *bitpointer, const unsigned char *bitstream, unsigned long nbits)
+static unsigned bits_read(bit_reader* br, unsigned nbits)
 {
-  unsigned result = 0, i;
-  for (i = 0; i < nbits; i++)
-    result |= ((unsigned)read_bit(bitpointer, bitstream)) << i;
+  unsigned result;
+  if (br->count < nbits) {
+    bits_refill(br);
+  }
+
+  result = (unsigned)(br->buffer & ((1ull << nbits) - 1));
+  br->buffer >>= nbits;
+  br->count -= nbits;
   return result;
 }
 
-/* the buffer must be numcodes*2 in size! */
-static void huffman_tree_init(huffman_tree* tree, unsigned* buffer, unsigned numcodes, unsigned maxbitlen)
+static unsigned bit_reverse(unsigned code, unsigned bits)
 {
-  tree->tree2d = buffer;
-
-  tree->numcodes = numcodes;
-  tree->maxbitlen = maxbitlen;
+  code = ((code & 0xAAAA) >> 1) | ((code & 0x5555) << 1);
+  code = ((code & 0xCCCC) >> 2) | ((code & 0x3333) << 2);
+  code = ((code & 0xF0F0) >> 4) | ((code & 0x0F0F) << 4);
+  code = ((code & 0xFF00) >> 8) | ((code & 0x00FF) << 8);
+  return code >> (16 - bits);
 }
 
-/*given the code lengths (as stored in the PNG file), generate the tree as defined by Deflate. maxbitlen is the maximum bits that a code in the tree can have. return value is error.*/
-static void huffman_tree_create_lengths(upng_t* upng, huffman_tree* tree, const unsigned *bitlen)
+/*given the code lengths (as stored in the PNG file), generate the lookup tables as defined by Deflate. return value is error.*/
+static void huffman_table_create_lengths(upng_t* upng, huffman_table* table, const unsigned char *bitlen, unsigned numcodes)
 {
-  unsigned tree1d[MAX_SYMBOLS];
-  unsigned blcount[MAX_BIT_LENGTH];
-  unsigned nextcode[MAX_BIT_LENGTH+1];
-  unsigned bits, n, i;
-  unsigned nodefilled = 0;  /*up to which node it is filled */
-  unsigned treepos = 0; /*position in the tree (1 of the numcodes columns) */
-
-  /* initialize local vectors */
-  memset(blcount, 0, sizeof(blcount));
-  memset(nextcode, 0, sizeof(nextcode));
+  unsigned nextcode[16];
+  unsigned blcount[17];
+  unsigned code = 0, symbols = 0;
+  unsigned i;
 
-  /*step 1: count number of instances of each code length */
-  for (bits = 0; bits < tree->numcodes; bits++) {
-    blcount[bitlen[bits]]++;
-  }
+  memset(blcount, 0, sizeof(blcount));
+  memset(table->fast, 0, sizeof(table->fast));
 
-  /*step 2: generate the nextcode values */
-  for (bits = 1; bits <= tree->maxbitlen; bits++) {
-    nextcode[bits] = (nextcode[bits - 1] + blcount[bits - 1]) << 1;
+  /*count number of instances of each code length */
+  for (i = 0; i < numcodes; i++) {
+    blcount[bitlen[i]]++;
   }
-
-  /*step 3: generate all the codes */
-  for (n = 0; n < tree->numcodes; n++) {
-    if (bitlen[n] != 0) {
-      tree1d[n] = nextcode[bitlen[n]]++;
+  blcount[0] = 0;
+
+  /*generate the first code of every length and check the tree isn't oversubscribed */
+  for (i = 1; i < 16; i++) {
+    nextcode[i] = code;
+    table->firstcode[i] = (unsigned short)code;
+    table->firstsymbol[i] = (unsigned short)symbols;
+    code += blcount[i];
+    if (blcount[i] != 0 && code - 1 >= (1u << i)) {
+      SET_ERROR(upng, UPNG_EMALFORMED);
+      return;
     }
-  }
 
-  /*convert tree1d[] to tree2d[][]. In the 2D array, a value of 32767 means uninited, a value >= numcodes is an address to another bit, a value < numcodes is a code. The 2 rows are the 2 possible bit values (0 or 1), there are as many columns as codes - 1
-     a good huffmann tree has N * 2 - 1 nodes, of which N - 1 are internal nodes. Here, the internal nodes are stored (what their 0 and 1 option point to). There is only memory for such good tree currently, if there are more nodes (due to too long length codes), error 55 will happen */
-  for (n = 0; n < tree->numcodes * 2; n++) {
-    tree->tree2d[n] = 32767;  /*32767 here means the tree2d isn't filled there yet */
+    table->maxcode[i] = code << (16 - i);
+    code <<= 1;
+    symbols += blcount[i];
   }
-
-  for (n = 0; n < tree->numcodes; n++) {  /*the codes */
-    for (i = 0; i < bitlen[n]; i++) { /*the bits for this code */
-      unsigned char bit = (unsigned char)((tree1d[n] >> (bitlen[n] - i - 1)) & 1);
-      /* check if oversubscribed */
-      if (treepos > tree->numcodes - 2) {
-        SET_ERROR(upng, UPNG_EMALFORMED);
-        return;
-      }
-
-      if (tree->tree2d[2 * treepos + bit] == 32767) { /*not yet filled in */
-        if (i + 1 == bitlen[n]) { /*last bit */
-          tree->tree2d[2 * treepos + bit] = n;  /*put the current code in it */
-          treepos = 0;
-        } else {  /*put address of the next step in here, first that address has to be found of course (it's just nodefilled + 1)... */
-          nodefilled++;
-          tree->tree2d[2 * treepos + bit] = nodefilled + tree->numcodes;  /*addresses encoded with numcodes added to it */
-          treepos = nodefilled;
+  table->maxcode[16] = 0x10000;
+
+  /*fill the symbol tables, and the fast table with every bit pattern a short code can be followed by */
+  for (i = 0; i < numcodes; i++) {
+    unsigned length = bitlen[i];
+    if (length != 0) {
+      unsigned slot = nextcode[length] - table->firstcode[length] + table->firstsymbol[length];
+      table->size[slot] = (unsigned char)length;
+      table->value[slot] = (unsigned short)i;
+
+      if (length <= FAST_BITS) {
+        unsigned j = bit_reverse(nextcode[length], length);
+        while (j < FAST_SIZE) {
+          table->fast[j] = (unsigned short)((length << 9) | i);
+          j += 1u << length;
         }
-      } else {
-        treepos = tree->tree2d[2 * treepos + bit] - tree->numcodes;
       }
+
+      nextcode[length]++;
     }
   }
+}
 
-  for (n = 0; n < tree->numcodes * 2; n++) {
-    if (tree->tree2d[n] == 32767) {
-      tree->tree2d[n] = 0;  /*remove possible remaining 32767's */
-    }
+static void huffman_table_create_fixed(upng_t* upng, huffman_table* codetable, huffman_table* codetableD)
+{
+  unsigned char bitlen[NUM_DEFLATE_CODE_SYMBOLS];
+  unsigned char bitlenD[NUM_DISTANCE_SYMBOLS];
+
+  memset(bitlen, 8, 144);
+  memset(bitlen + 144, 9, 256 - 144);
+  memset(bitlen + 256, 7, 280 - 256);
+  memset(bitlen + 280, 8, NUM_DEFLATE_CODE_SYMBOLS - 280);
+  memset(bitlenD, 5, sizeof(bitlenD));
+
+  huffman_table_create_lengths(upng, codetable, bitlen, NUM_DEFLATE_CODE_SYMBOLS);
+  if (upng->error == UPNG_EOK) {
+    huffman_table_create_lengths(upng, codetableD, bitlenD, NUM_DISTANCE_SYMBOLS);
   }
 }
 
-static unsigned huffman_decode_symbol(upng_t *upng, const unsigned char *in, unsigned long *bp, const huffman_tree* codetree, unsigned long inlength)
+/* the caller has to make sure at least 15 bits are buffered */
+static unsigned huffman_decode_symbol(upng_t *upng, bit_reader* br, const huffman_table* table)
 {
-  unsigned treepos = 0, ct;
-  unsigned char bit;
-  for (;;) {
-    /* error: end of input memory reached without endcode */
-    if (((*bp) & 0x07) == 0 && ((*bp) >> 3) > inlength) {
-      SET_ERROR(upng, UPNG_EMALFORMED);
-      return 0;
-    }
+  unsigned entry = table->fast[br->buffer & FAST_MASK];
+  unsigned code, length, slot;
+
+  if (entry != 0) {
+    length = entry >> 9;
+    br->buffer >>= length;
+    br->count -= length;
+    return entry & 511;
+  }
 
-    bit = read_bit(bp, in);
+  /*slow path for codes longer than FAST_BITS */
+  code = bit_reverse((unsigned)(br->buffer & 0xFFFF), 16);
+  for (length = FAST_BITS + 1; code >= table->maxcode[length]; length++);
 
-    ct = codetree->tree2d[(treepos << 1) | bit];
-    if (ct < codetree->numcodes) {
-      return ct;
-    }
+  if (length >= 16) {
+    SET_ERROR(upng, UPNG_EMALFORMED);
+    return 0;
+  }
 
-    treepos = ct - codetree->numcodes;
-    if (treepos >= codetree->numcodes) {
-      SET_ERROR(upng, UPNG_EMALFORMED);
-      return 0;
-    }
+  slot = (code >> (16 - length)) - table->firstcode[length] + table->firstsymbol[length];
+  if (slot >= MAX_SYMBOLS || table->size[slot] != length) {
+    SET_ERROR(upng, UPNG_EMALFORMED);
+    return 0;
   }
+
+  br->buffer >>= length;
+  br->count -= length;
+  return table->value[slot];
 }
 
 /* get the tree of a deflated block with dynamic tree, the tree itself is also Huffman compressed with a known tree*/
-static void get_tree_inflate_dynamic(upng_t* upng, huffman_tree* codetree, huffman_tree* codetreeD, huffman_tree* codelengthcodetree, const unsigned char *in, unsigned long *bp, unsigned long inlength)
+static void get_tree_inflate_dynamic(upng_t* upng, huffman_table* codetable, huffman_table* codetableD, bit_reader* br)
 {
-  unsigned codelengthcode[NUM_CODE_LENGTH_CODES];
-  unsigned bitlen[NUM_DEFLATE_CODE_SYMBOLS];
-  unsigned bitlenD[NUM_DISTANCE_SYMBOLS];
-  unsigned n, hlit, hdist, hclen, i;
+  huffman_table codelengthtable;
+  unsigned char codelengthcode[NUM_CODE_LENGTH_CODES];
+  unsigned char bitlen[NUM_DEFLATE_CODE_SYMBOLS + NUM_DISTANCE_SYMBOLS];
+  unsigned hlit, hdist, hclen, i;
 
   /*make sure that length values that aren't filled in will be 0, or a wrong tree will be generated */
-  /*C-code note: use no "return" between ctor and dtor of an uivector! */
-  if ((*bp) >> 3 >= inlength - 2) {
+  memset(codelengthcode, 0, sizeof(codelengthcode));
+  memset(bitlen, 0, sizeof(bitlen));
+
+  hlit = bits_read(br, 5) + 257;  /*number of literal/length codes + 257. Unlike the spec, the value 257 is added to it here already */
+  hdist = bits_read(br, 5) + 1; /*number of distance codes. Unlike the spec, the value 1 is added to it here already */
+  hclen = bits_read(br, 4) + 4; /*number of code length codes. Unlike the spec, the value 4 is added to it here already */
+
+  if (hlit > NUM_DEFLATE_CODE_SYMBOLS || hdist > NUM_DISTANCE_SYMBOLS) {
     SET_ERROR(upng, UPNG_EMALFORMED);
     return;
   }
 
-  /* clear bitlen arrays */
-  memset(bitlen, 0, sizeof(bitlen));
-  memset(bitlenD, 0, sizeof(bitlenD));
-
-  /*the bit pointer is or will go past the memory */
-  hlit = read_bits(bp, in, 5) + 257;  /*number of literal/length codes + 257. Unlike the spec, the value 257 is added to it here already */
-  hdist = read_bits(bp, in, 5) + 1; /*number of distance codes. Unlike the spec, the value 1 is added to it here already */
-  hclen = read_bits(bp, in, 4) + 4; /*number of code length codes. Unlike the spec, the value 4 is added to it here already */
-
-  for (i = 0; i < NUM_CODE_LENGTH_CODES; i++) {
-    if (i < hclen) {
-      codelengthcode[CLCL[i]] = read_bits(bp, in, 3);
-    } else {
-      codelengthcode[CLCL[i]] = 0;  /*if not, it must stay 0 */
-    }
+  for (i = 0; i < hclen; i++) {
+    codelengthcode[CLCL[i]] = (unsigned char)bits_read(br, 3);
   }
 
-  huffman_tree_create_lengths(upng, codelengthcodetree, codelengthcode);
+  huffman_table_create_lengths(upng, &codelengthtable, codelengthcode, NUM_CODE_LENGTH_CODES);
 
   /* bail now if we encountered an error earlier */
   if (upng->error != UPNG_EOK) {
     return;
   }
 
-  /*now we can use this tree to read the lengths for the tree that this function will return */
+  /*now we can use this tree to read the lengths for the tree that this function will return; literal/length and distance lengths form one run-length coded sequence */
   i = 0;
-  while (i < hlit + hdist) {  /*i is the current symbol we're reading in the part that contains the code lengths of lit/len codes and dist codes */
-    unsigned code = huffman_decode_symbol(upng, in, bp, codelengthcodetree, inlength);
+  while (i < hlit + hdist) {
+    unsigned code, replength;
+    unsigned char value = 0;
+
+    if (br->count < 16) {
+      bits_refill(br);
+    }
+
+    code = huffman_decode_symbol(upng, br, &codelengthtable);
     if (upng->error != UPNG_EOK) {
-      break;
+      return;
     }
 
     if (code <= 15) { /*a length code */
-      if (i < hlit) {
-        bitlen[i] = code;
-      } else {
-        bitlenD[i - hlit] = code;
-      }
-      i++;
-    } else if (code == 16) {  /*repeat previous */
-      unsigned replength = 3; /*read in the 2 bits that indicate repeat length (3-6) */
-      unsigned value; /*set value to the previous code */
-
-      if ((*bp) >> 3 >= inlength) {
+      bitlen[i++] = (unsigned char)code;
+      continue;
+    } else if (code == 16) {  /*repeat previous 3-6 times */
+      if (i == 0) {
         SET_ERROR(upng, UPNG_EMALFORMED);
-        break;
-      }
-      /*error, bit pointer jumps past memory */
-      replength += read_bits(bp, in, 2);
-
-      if ((i - 1) < hlit) {
-        value = bitlen[i - 1];
-      } else {
-        value = bitlenD[i - hlit - 1];
+        return;
       }
 
-      /*repeat this value in the next lengths */
-      for (n = 0; n < replength; n++) {
-        /* i is larger than the amount of codes */
-        if (i >= hlit + hdist) {
-          SET_ERROR(upng, UPNG_EMALFORMED);
-          break;
-        }
-
-        if (i < hlit) {
-          bitlen[i] = value;
-        } else {
-          bitlenD[i - hlit] = value;
-        }
-        i++;
-      }
+      replength = 3 + bits_read(br, 2);
+      value = bitlen[i - 1];
     } else if (code == 17) {  /*repeat "0" 3-10 times */
-      unsigned replength = 3; /*read in the bits that indicate repeat length */
-      if ((*bp) >> 3 >= inlength) {
-        SET_ERROR(upng, UPNG_EMALFORMED);
-        break;
-      }
-
-      /*error, bit pointer jumps past memory */
-      replength += read_bits(bp, in, 3);
-
-      /*repeat this value in the next lengths */
-      for (n = 0; n < replength; n++) {
-        /* error: i is larger than the amount of codes */
-        if (i >= hlit + hdist) {
-          SET_ERROR(upng, UPNG_EMALFORMED);
-          break;
-        }
-
-        if (i < hlit) {
-          bitlen[i] = 0;
-        } else {
-          bitlenD[i - hlit] = 0;
-        }
-        i++;
-      }
+      replength = 3 + bits_read(br, 3);
     } else if (code == 18) {  /*repeat "0" 11-138 times */
-      unsigned replength = 11;  /*read in the bits that indicate repeat length */
-      /* error, bit pointer jumps past memory */
-      if ((*bp) >> 3 >= inlength) {
-        SET_ERROR(upng, UPNG_EMALFORMED);
-        break;
-      }
-
-      replength += read_bits(bp, in, 7);
-
-      /*repeat this value in the next lengths */
-      for (n = 0; n < replength; n++) {
-        /* i is larger than the amount of codes */
-        if (i >= hlit + hdist) {
-          SET_ERROR(upng, UPNG_EMALFORMED);
-          break;
-        }
-        if (i < hlit)
-          bitlen[i] = 0;
-        else
-          bitlenD[i - hlit] = 0;
-        i++;
-      }
+      replength = 11 + bits_read(br, 7);
     } else {
       /* somehow an unexisting code appeared. This can never happen. */
       SET_ERROR(upng, UPNG_EMALFORMED);
-      break;
+      return;
+    }
+
+    /* i would become larger than the amount of codes */
+    if (i + replength > hlit + hdist) {
+      SET_ERROR(upng, UPNG_EMALFORMED);
+      return;
     }
+
+    memset(bitlen + i, value, replength);
+    i += replength;
   }
 
-  if (upng->error == UPNG_EOK && bitlen[256] == 0) {
+  /* error, bit pointer jumped past memory */
+  if (bits_overrun(br)) {
     SET_ERROR(upng, UPNG_EMALFORMED);
+    return;
   }
 
   /*the length of the end code 256 must be larger than 0 */
-  /*now we've finally got hlit and hdist, so generate the code trees, and the function is done */
-  if (upng->error == UPNG_EOK) {
-    huffman_tree_create_lengths(upng, codetree, bitlen);
+  if (bitlen[256] == 0) {
+    SET_ERROR(upng, UPNG_EMALFORMED);
+    return;
   }
+
+  /*now we've finally got hlit and hdist, so generate the code tables, and the function is done */
+  huffman_table_create_lengths(upng, codetable, bitlen, hlit);
   if (upng->error == UPNG_EOK) {
-    huffman_tree_create_lengths(upng, codetreeD, bitlenD);
+    huffman_table_create_lengths(upng, codetableD, bitlen + hlit, hdist);
   }
 }
 
 /*inflate a block with dynamic of fixed Huffman tree*/
-static void inflate_huffman(upng_t* upng, unsigned char* out, unsigned long outsize, const unsigned char *in, unsigned long *bp, unsigned long *pos, unsigned long inlength, unsigned btype)
+static void inflate_huffman(upng_t* upng, unsigned char* out, unsigned long outsize, bit_reader* br, unsigned long *pos, unsigned btype)
 {
-  unsigned codetree_buffer[DEFLATE_CODE_BUFFER_SIZE];
-  unsigned codetreeD_buffer[DISTANCE_BUFFER_SIZE];
-  unsigned done = 0;
-
-  huffman_tree codetree;
-  huffman_tree codetreeD;
+  huffman_table codetable;
+  huffman_table codetableD;
 
   if (btype == 1) {
-    /* fixed trees */
-    huffman_tree_init(&codetree, (unsigned*)FIXED_DEFLATE_CODE_TREE, NUM_DEFLATE_CODE_SYMBOLS, DEFLATE_CODE_BITLEN);
-    huffman_tree_init(&codetreeD, (unsigned*)FIXED_DISTANCE_TREE, NUM_DISTANCE_SYMBOLS, DISTANCE_BITLEN);
-  } else if (btype == 2) {
-    /* dynamic trees */
-    unsigned codelengthcodetree_buffer[CODE_LENGTH_BUFFER_SIZE];
-    huffman_tree codelengthcodetree;
+    huffman_table_create_fixed(upng, &codetable, &codetableD);
+  } else {
+    get_tree_inflate_dynamic(upng, &codetable, &codetableD, br);
+  }
 
-    huffman_tree_init(&codetree, codetree_buffer, NUM_DEFLATE_CODE_SYMBOLS, DEFLATE_CODE_BITLEN);
-    huffman_tree_init(&codetreeD, codetreeD_buffer, NUM_DISTANCE_SYMBOLS, DISTANCE_BITLEN);
-    huffman_tree_init(&codelengthcodetree, codelengthcodetree_buffer, NUM_CODE_LENGTH_CODES, CODE_LENGTH_BITLEN);
-    get_tree_inflate_dynamic(upng, &codetree, &codetreeD, &codelengthcodetree, in, bp, inlength);
+  if (upng->error != UPNG_EOK) {
+    return;
   }
 
-  while (done == 0) {
-    unsigned code = huffman_decode_symbol(upng, in, bp, &codetree, inlength);
+  for (;;) {
+    unsigned code;
+
+    /* the longest symbol sequence (length code, extra bits, distance code, extra bits) is 48 bits */
+    if (br->count < 48) {
+      bits_refill(br);
+    }
+
+    code = huffman_decode_symbol(upng, br, &codetable);
     if (upng->error != UPNG_EOK) {
       return;
     }
 
-    if (code == 256) {
-      /* end code */
-      done = 1;
-    } else if (code <= 255) {
+    if (code <= 255) {
       /* literal symbol */
       if ((*pos) >= outsize) {
         SET_ERROR(upng, UPNG_EMALFORMED);
         return;
       }
 
-      /* store output */
       out[(*pos)++] = (unsigned char)(code);
-    } else if (code >= FIRST_LENGTH_CODE_INDEX && code <= LAST_LENGTH_CODE_INDEX) { /*length code */
-      /* part 1: get length base */
-      unsigned long length = LENGTH_BASE[code - FIRST_LENGTH_CODE_INDEX];
-      unsigned codeD, distance, numextrabitsD;
-      unsigned long start, forward, backward, numextrabits;
-
-      /* part 2: get extra bits and add the value of that to length */
-      numextrabits = LENGTH_EXTRA[code - FIRST_LENGTH_CODE_INDEX];
-
-      /* error, bit pointer will jump past memory */
-      if (((*bp) >> 3) >= inlength) {
-        SET_ERROR(upng, UPNG_EMALFORMED);
-        return;
-      }
-      length += read_bits(bp, in, numextrabits);
-
-      /*part 3: get distance code */
-      codeD = huffman_decode_symbol(upng, in, bp, &codetreeD, inlength);
+    } else if (code == 256) {
+      /* end code */
+      break;
+    } else if (code <= LAST_LENGTH_CODE_INDEX) { /*length code */
+      unsigned long length, distance;
+      unsigned codeD;
+      unsigned char* dst;
+      const unsigned char* src;
+
+      length = LENGTH_BASE[code - FIRST_LENGTH_CODE_INDEX];
+      length += (unsigned long)(br->buffer & ((1u << LENGTH_EXTRA[code - FIRST_LENGTH_CODE_INDEX]) - 1));
+      br->buffer >>= LENGTH_EXTRA[code - FIRST_LENGTH_CODE_INDEX];
+      br->count -= LENGTH_EXTRA[code - FIRST_LENGTH_CODE_INDEX];
+
+      codeD = huffman_decode_symbol(upng, br, &codetableD);
       if (upng->error != UPNG_EOK) {
         return;
       }
@@ -521,59 +460,67 @@ static void inflate_huffman(upng_t* upng, unsigned char* out, unsigned long outs
       }
 
       distance = DISTANCE_BASE[codeD];
+      distance += (unsigned long)(br->buffer & ((1u << DISTANCE_EXTRA[codeD]) - 1));
+      br->buffer >>= DISTANCE_EXTRA[codeD];
+      br->count -= DISTANCE_EXTRA[codeD];
 
-      /*part 4: get extra bits from distance */
-      numextrabitsD = DISTANCE_EXTRA[codeD];
-
-      /* error, bit pointer will jump past memory */
-      if (((*bp) >> 3) >= inlength) {
+      if (distance > (*pos) || (*pos) + length > outsize) {
         SET_ERROR(upng, UPNG_EMALFORMED);
         return;
       }
 
-      distance += read_bits(bp, in, numextrabitsD);
-
-      /*part 5: fill in all the out[n] values based on the length and dist */
-      start = (*pos);
-      backward = start - distance;
-
-      if ((*pos) + length >= outsize) {
-        SET_ERROR(upng, UPNG_EMALFORMED);
-        return;
-      }
-
-      for (forward = 0; forward < length; forward++) {
-        out[(*pos)++] = out[backward];
-        backward++;
-
-        if (backward >= start) {
-          backward = start - distance;
+      dst = out + (*pos);
+      src = dst - distance;
+      (*pos) += length;
+
+      /*copy whole words when the source can't overlap them and there's room to overshoot; the overshoot is overwritten by later output */
+      if (distance >= 8 && (*pos) + 8 <= outsize) {
+        unsigned char* end = dst + length;
+        do {
+          memcpy(dst, src, 8);
+          dst += 8;
+          src += 8;
+        } while (dst < end);
+      } else if (distance == 1) {
+        memset(dst, *src, length);
+      } else {
+        while (length--) {
+          *dst++ = *src++;
         }
       }
+    } else {
+      SET_ERROR(upng, UPNG_EMALFORMED);
+      return;
+    }
+
+    /* error, bit pointer jumped past memory */
+    if (bits_overrun(br)) {
+      SET_ERROR(upng, UPNG_EMALFORMED);
+      return;
     }
   }
 }
 
-static void inflate_uncompressed(upng_t* upng, unsigned char* out, unsigned long outsize, const unsigned char *in, unsigned long *bp, unsigned long *pos, unsigned long inlength)
+static void inflate_uncompressed(upng_t* upng, unsigned char* out, unsigned long outsize, bit_reader* br, unsigned long *pos)
 {
   unsigned long p;
-  unsigned len, nlen, n;
+  unsigned len, nlen;
 
-  /* go to first boundary of byte */
-  while (((*bp) & 0x7) != 0) {
-    (*bp)++;
-  }
-  p = (*bp) / 8;    /*byte position */
+  /* go to first boundary of byte, then give the remaining whole bytes back to the input */
+  br->pos -= br->count >> 3;
+  br->buffer = 0;
+  br->count = 0;
+  p = br->pos;
 
   /* read len (2 bytes) and nlen (2 bytes) */
-  if (p >= inlength - 4) {
+  if (p + 4 > br->size) {
     SET_ERROR(upng, UPNG_EMALFORMED);
     return;
   }
 
-  len = in[p] + 256 * in[p + 1];
+  len = br->in[p] + 256 * br->in[p + 1];
   p += 2;
-  nlen = in[p] + 256 * in[p + 1];
+  nlen = br->in[p] + 256 * br->in[p + 1];
   p += 2;
 
   /* check if 16-bit nlen is really the one's complement of len */
@@ -582,53 +529,58 @@ static void inflate_uncompressed(upng_t* upng, unsigned char* out, unsigned long
     return;
   }
 
-  if ((*pos) + len >= outsize) {
+  if ((*pos) + len > outsize) {
     SET_ERROR(upng, UPNG_EMALFORMED);
     return;
   }
 
   /* read the literal data: len bytes are now stored in the out buffer */
-  if (p + len > inlength) {
+  if (p + len > br->size) {
     SET_ERROR(upng, UPNG_EMALFORMED);
     return;
   }
 
-  for (n = 0; n < len; n++) {
-    out[(*pos)++] = in[p++];
-  }
+  memcpy(out + (*pos), br->in + p, len);
+  (*pos) += len;
 
-  (*bp) = p * 8;
+  br->pos = p + len;
 }
 
 /*inflate the deflated data (cfr. deflate spec); return value is the error*/
 static upng_error uz_inflate_data(upng_t* upng, unsigned char* out, unsigned long outsize, const unsigned char *in, unsigned long insize, unsigned long inpos)
 {
-  unsigned long bp = 0; /*bit pointer in the "in" data, current byte is bp >> 3, current bit is bp & 0x7 (from lsb to msb of the byte) */
+  bit_reader br;
   unsigned long pos = 0;  /*byte position in the out buffer */
 
   unsigned done = 0;
 
+  br.in = in + inpos;
+  br.size = insize - inpos;
+  br.pos = 0;
+  br.buffer = 0;
+  br.count = 0;
+
   while (done == 0) {
     unsigned btype;
 
-    /* ensure next bit doesn't point past the end of the buffer */
-    if ((bp >> 3) >= insize) {
+    /* read block control bits */
+    done = bits_read(&br, 1);
+    btype = bits_read(&br, 2);
+
+    /* ensure the header didn't point past the end of the buffer */
+    if (bits_overrun(&br)) {
       SET_ERROR(upng, UPNG_EMALFORMED);
       return upng->error;
     }
 
-    /* read block control bits */
-    done = read_bit(&bp, &in[inpos]);
-    btype = read_bit(&bp, &in[inpos]) | (read_bit(&bp, &in[inpos]) << 1);
-
     /* process control type appropriateyly */
     if (btype == 3) {
       SET_ERROR(upng, UPNG_EMALFORMED);
       return upng->error;
     } else if (btype == 0) {
-      inflate_uncompressed(upng, out, outsize, &in[inpos], &bp, &pos, insize);  /*no compression */
+      inflate_uncompressed(upng, out, outsize, &br, &pos);  /*no compression */
     } else {
-      inflate_huffman(upng, out, outsize, &in[inpos], &bp, &pos, insize, btype);  /*compression, btype 01 or 10 */
+      inflate_huffman(upng, out, outsize, &br, &pos, btype);  /*compression, btype 01 or 10 */
     }
 
     /* stop if an error has occured */
@@ -688,6 +640,167 @@ static int paeth_predictor(int a, int b, int c)
     return c;
 }
 
+#if defined(UPNG_SSE2) || defined(UPNG_NEON)
+/* pixels of 3 or 4 bytes, packed little-endian into the low lane of a vector */
+static unsigned read_pixel(const unsigned char* p, unsigned long bytewidth)
+{
+  unsigned pixel;
+  if (bytewidth == 4) {
+    memcpy(&pixel, p, 4);
+  } else {
+    pixel = p[0] | (p[1] << 8) | (p[2] << 16);
+  }
+  return pixel;
+}
+
+static void write_pixel(unsigned char* p, unsigned pixel, unsigned long bytewidth)
+{
+  if (bytewidth == 4) {
+    memcpy(p, &pixel, 4);
+  } else {
+    p[0] = (unsigned char)pixel;
+    p[1] = (unsigned char)(pixel >> 8);
+    p[2] = (unsigned char)(pixel >> 16);
+  }
+}
+#endif
+
+#if defined(UPNG_SSE2)
+static __m128i load_pixel(const unsigned char* p, unsigned long bytewidth)
+{
+  return _mm_cvtsi32_si128((int)read_pixel(p, bytewidth));
+}
+
+static void store_pixel(unsigned char* p, __m128i x, unsigned long bytewidth)
+{
+  write_pixel(p, (unsigned)_mm_cvtsi128_si32(x), bytewidth);
+}
+
+static void unfilter_up(unsigned char *recon, const unsigned char *scanline, const unsigned char *precon, unsigned long length)
+{
+  unsigned long i = 0;
+  for (; i + 16 <= length; i += 16) {
+    __m128i x = _mm_loadu_si128((const __m128i*)(scanline + i));
+    __m128i b = _mm_loadu_si128((const __m128i*)(precon + i));
+    _mm_storeu_si128((__m128i*)(recon + i), _mm_add_epi8(x, b));
+  }
+  for (; i < length; i++)
+    recon[i] = scanline[i] + precon[i];
+}
+
+static void unfilter_sub(unsigned char *recon, const unsigned char *scanline, unsigned long bytewidth, unsigned long length)
+{
+  __m128i a = _mm_setzero_si128();
+  unsigned long i;
+  for (i = 0; i < length; i += bytewidth) {
+    a = _mm_add_epi8(a, load_pixel(scanline + i, bytewidth));
+    store_pixel(recon + i, a, bytewidth);
+  }
+}
+
+static void unfilter_avg(unsigned char *recon, const unsigned char *scanline, const unsigned char *precon, unsigned long bytewidth, unsigned long length)
+{
+  const __m128i one = _mm_set1_epi8(1);
+  __m128i a = _mm_setzero_si128();
+  unsigned long i;
+  for (i = 0; i < length; i += bytewidth) {
+    __m128i b = load_pixel(precon + i, bytewidth);
+    /* _mm_avg_epu8 rounds up, deflate's average rounds down */
+    __m128i average = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), one));
+    a = _mm_add_epi8(average, load_pixel(scanline + i, bytewidth));
+    store_pixel(recon + i, a, bytewidth);
+  }
+}
+
+static void unfilter_paeth(unsigned char *recon, const unsigned char *scanline, const unsigned char *precon, unsigned long bytewidth, unsigned long length)
+{
+  const __m128i zero = _mm_setzero_si128();
+  __m128i a = zero, c = zero;
+  unsigned long i;
+  for (i = 0; i < length; i += bytewidth) {
+    __m128i b = _mm_unpacklo_epi8(load_pixel(precon + i, bytewidth), zero);
+    __m128i x = _mm_unpacklo_epi8(load_pixel(scanline + i, bytewidth), zero);
+
+    /* p = a + b - c, so p - a = b - c, p - b = a - c and p - c = (p - a) + (p - b) */
+    __m128i pa = _mm_sub_epi16(b, c);
+    __m128i pb = _mm_sub_epi16(a, c);
+    __m128i pc = _mm_add_epi16(pa, pb);
+    __m128i smallest, pickA, pickB;
+
+    pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+    pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+    pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+    smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+
+    pickA = _mm_cmpeq_epi16(smallest, pa);
+    pickB = _mm_cmpeq_epi16(smallest, pb);
+    c = _mm_or_si128(_mm_and_si128(pickB, b), _mm_andnot_si128(pickB, c));
+    c = _mm_or_si128(_mm_and_si128(pickA, a), _mm_andnot_si128(pickA, c));
+
+    a = _mm_and_si128(_mm_add_epi16(c, x), _mm_set1_epi16(0xFF));
+    c = b;
+    store_pixel(recon + i, _mm_packus_epi16(a, a), bytewidth);
+  }
+}
+#elif defined(UPNG_NEON)
+static uint8x8_t load_pixel(const unsigned char* p, unsigned long bytewidth)
+{
+  return vreinterpret_u8_u32(vdup_n_u32(read_pixel(p, bytewidth)));
+}
+
+static void store_pixel(unsigned char* p, uint8x8_t x, unsigned long bytewidth)
+{
+  write_pixel(p, vget_lane_u32(vreinterpret_u32_u8(x), 0), bytewidth);
+}
+
+static void unfilter_up(unsigned char *recon, const unsigned char *scanline, const unsigned char *precon, unsigned long length)
+{
+  unsigned long i = 0;
+  for (; i + 16 <= length; i += 16)
+    vst1q_u8(recon + i, vaddq_u8(vld1q_u8(scanline + i), vld1q_u8(precon + i)));
+  for (; i < length; i++)
+    recon[i] = scanline[i] + precon[i];
+}
+
+static void unfilter_sub(unsigned char *recon, const unsigned char *scanline, unsigned long bytewidth, unsigned long length)
+{
+  uint8x8_t a = vdup_n_u8(0);
+  unsigned long i;
+  for (i = 0; i < length; i += bytewidth) {
+    a = vadd_u8(a, load_pixel(scanline + i, bytewidth));
+    store_pixel(recon + i, a, bytewidth);
+  }
+}
+
+static void unfilter_avg(unsigned char *recon, const unsigned char *scanline, const unsigned char *precon, unsigned long bytewidth, unsigned long length)
+{
+  uint8x8_t a = vdup_n_u8(0);
+  unsigned long i;
+  for (i = 0; i < length; i += bytewidth) {
+    a = vadd_u8(vhadd_u8(a, load_pixel(precon + i, bytewidth)), load_pixel(scanline + i, bytewidth));
+    store_pixel(recon + i, a, bytewidth);
+  }
+}
+
+static void unfilter_paeth(unsigned char *recon, const unsigned char *scanline, const unsigned char *precon, unsigned long bytewidth, unsigned long length)
+{
+  uint8x8_t a = vdup_n_u8(0), c = vdup_n_u8(0);
+  unsigned long i;
+  for (i = 0; i < length; i += bytewidth) {
+    uint8x8_t b = load_pixel(precon + i, bytewidth);
+    uint16x8_t pa = vabdl_u8(b, c);
+    uint16x8_t pb = vabdl_u8(a, c);
+    uint16x8_t pc = vabdq_u16(vaddl_u8(a, b), vaddl_u8(c, c));
+    uint8x8_t pickA = vmovn_u16(vandq_u16(vcleq_u16(pa, pb), vcleq_u16(pa, pc)));
+    uint8x8_t pickB = vmovn_u16(vcleq_u16(pb, pc));
+
+    a = vadd_u8(vbsl_u8(pickA, a, vbsl_u8(pickB, b, c)), load_pixel(scanline + i, bytewidth));
+    c = b;
+    store_pixel(recon + i, a, bytewidth);
+  }
+}
+#endif
+
 static void unfilter_scanline(upng_t* upng, unsigned char *recon, const unsigned char *scanline, const unsigned char *precon, unsigned long bytewidth, unsigned char filterType, unsigned long length)
 {
   /*
@@ -699,6 +812,26 @@ static void unfilter_scanline(upng_t* upng, unsigned char *recon, const unsigned
    */
 
   unsigned long i;
+
+#if defined(UPNG_SSE2) || defined(UPNG_NEON)
+  /* whole pixels of 3 or 4 bytes are reconstructed with one vector operation each */
+  const int vector = (bytewidth == 3 || bytewidth == 4) && length % bytewidth == 0;
+
+  if (filterType == 2 && precon) {
+    unfilter_up(recon, scanline, precon, length);
+    return;
+  } else if (filterType == 1 && vector) {
+    unfilter_sub(recon, scanline, bytewidth, length);
+    return;
+  } else if (filterType == 3 && precon && vector) {
+    unfilter_avg(recon, scanline, precon, bytewidth, length);
+    return;
+  } else if (filterType == 4 && precon && vector) {
+    unfilter_paeth(recon, scanline, precon, bytewidth, length);
+    return;
+  }
+#endif
+
   switch (filterType) {
   case 0:
     for (i = 0; i < length; i++)
@@ -12,7 +12,7 @@ void Particle::init(
   unsigned char blockType
 ) 
 {
-  Entity::init();
+  Entity::init(&game.level);
 
   setSize(0.2f, 0.2f);
   setPosition(x, y, z);
@@ -23,7 +23,7 @@ void ParticleManager::tick()
 
     if (expiredCount == PARTICLES_PER_AXIS * PARTICLES_PER_AXIS * PARTICLES_PER_AXIS)
     {
-      particleGroup->vertexList.destroy();
+      spareVertexLists.push_back(particleGroup->vertexList);
       particleGroup = particleGroups.erase(particleGroup);
     }
     else
@@ -52,7 +52,18 @@ void ParticleManager::render()
 void ParticleManager::spawn(float x, float y, float z, unsigned char blockType)
 {
   ParticleGroup particleGroup{};
-  particleGroup.vertexList.init(PARTICLES_PER_AXIS * PARTICLES_PER_AXIS * PARTICLES_PER_AXIS * VERTICES_PER_PARTICLE);
+
+  // Vertex lists of expired groups are reused with their buffers, so breaking blocks stops allocating once enough
+  // groups have been alive at the same time.
+  if (!spareVertexLists.empty())
+  {
+    particleGroup.vertexList = spareVertexLists.back();
+    spareVertexLists.pop_back();
+  }
+  else
+  {
+    particleGroup.vertexList.init(PARTICLES_PER_AXIS * PARTICLES_PER_AXIS * PARTICLES_PER_AXIS * VERTICES_PER_PARTICLE);
+  }
 
   for (int i = 0; i < PARTICLES_PER_AXIS; i++)
   {
@@ -27,5 +27,6 @@ public:
 
 private:
   std::vector<ParticleGroup> particleGroups;
+  std::vector<VertexList> spareVertexLists;
 };
 
@@ -3,6 +3,79 @@
 
 #include <glm/glm.hpp>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PERLIN_SSE2
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define PERLIN_NEON
+#endif
+
+#if defined(PERLIN_SSE2)
+static inline __m128 fade4(__m128 t)
+{
+  const __m128 a = _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f));
+  const __m128 b = _mm_add_ps(_mm_mul_ps(t, a), _mm_set1_ps(10.0f));
+
+  return _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(t, t), t), b);
+}
+
+static inline __m128 lerp4(__m128 t, __m128 a, __m128 b)
+{
+  return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+}
+
+static inline __m128 grad4(__m128i i, __m128 x, __m128 y)
+{
+  i = _mm_and_si128(i, _mm_set1_epi32(15));
+
+  const __m128 lessThan8 = _mm_castsi128_ps(_mm_cmplt_epi32(i, _mm_set1_epi32(8)));
+  const __m128 lessThan4 = _mm_castsi128_ps(_mm_cmplt_epi32(i, _mm_set1_epi32(4)));
+  const __m128 equals12or14 = _mm_castsi128_ps(_mm_or_si128(
+    _mm_cmpeq_epi32(i, _mm_set1_epi32(12)),
+    _mm_cmpeq_epi32(i, _mm_set1_epi32(14))
+  ));
+
+  __m128 a = _mm_or_ps(_mm_and_ps(lessThan8, x), _mm_andnot_ps(lessThan8, y));
+  __m128 b = _mm_or_ps(_mm_and_ps(lessThan4, y), _mm_andnot_ps(lessThan4, _mm_and_ps(equals12or14, x)));
+
+  a = _mm_xor_ps(a, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(i, _mm_set1_epi32(1)), 31)));
+  b = _mm_xor_ps(b, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(i, _mm_set1_epi32(2)), 30)));
+
+  return _mm_add_ps(a, b);
+}
+#elif defined(PERLIN_NEON)
+static inline float32x4_t fade4(float32x4_t t)
+{
+  const float32x4_t a = vsubq_f32(vmulq_n_f32(t, 6.0f), vdupq_n_f32(15.0f));
+  const float32x4_t b = vaddq_f32(vmulq_f32(t, a), vdupq_n_f32(10.0f));
+
+  return vmulq_f32(vmulq_f32(vmulq_f32(t, t), t), b);
+}
+
+static inline float32x4_t lerp4(float32x4_t t, float32x4_t a, float32x4_t b)
+{
+  return vaddq_f32(a, vmulq_f32(t, vsubq_f32(b, a)));
+}
+
+static inline float32x4_t grad4(int32x4_t i, float32x4_t x, float32x4_t y)
+{
+  i = vandq_s32(i, vdupq_n_s32(15));
+
+  const uint32x4_t lessThan8 = vcltq_s32(i, vdupq_n_s32(8));
+  const uint32x4_t lessThan4 = vcltq_s32(i, vdupq_n_s32(4));
+  const uint32x4_t equals12or14 = vorrq_u32(vceqq_s32(i, vdupq_n_s32(12)), vceqq_s32(i, vdupq_n_s32(14)));
+
+  uint32x4_t a = vreinterpretq_u32_f32(vbslq_f32(lessThan8, x, y));
+  uint32x4_t b = vreinterpretq_u32_f32(vbslq_f32(lessThan4, y, vbslq_f32(equals12or14, x, vdupq_n_f32(0.0f))));
+
+  a = veorq_u32(a, vshlq_n_u32(vreinterpretq_u32_s32(vandq_s32(i, vdupq_n_s32(1))), 31));
+  b = veorq_u32(b, vshlq_n_u32(vreinterpretq_u32_s32(vandq_s32(i, vdupq_n_s32(2))), 30));
+
+  return vaddq_f32(vreinterpretq_f32_u32(a), vreinterpretq_f32_u32(b));
+}
+#endif
+
 PerlinNoise::PerlinNoise(Random& random) 
 {
   for (int i = 0; i < 256; i++) 
@@ -67,3 +140,93 @@ float PerlinNoise::compute(float x, float y)
 
   return l;
 }
+
+void PerlinNoise::accumulate(const float* x, float y, float frequency, float amplitude, float* out, int count)
+{
+  const float sy = y * frequency;
+  const int iy = ((int)sy) & 255;
+  const float vy = sy - glm::floor(sy);
+  const float yd = f(vy);
+
+  int i = 0;
+
+#if defined(PERLIN_SSE2) || defined(PERLIN_NEON)
+  alignas(16) int ix[4];
+  alignas(16) int aa[4], ab[4], ba[4], bb[4];
+
+  for (; i + 4 <= count; i += 4)
+  {
+#if defined(PERLIN_SSE2)
+    __m128 vx = _mm_mul_ps(_mm_loadu_ps(x + i), _mm_set1_ps(frequency));
+
+    const __m128i truncated = _mm_cvttps_epi32(vx);
+    const __m128 whole = _mm_cvtepi32_ps(truncated);
+
+    vx = _mm_sub_ps(vx, _mm_sub_ps(whole, _mm_and_ps(_mm_cmpgt_ps(whole, vx), _mm_set1_ps(1.0f))));
+
+    _mm_store_si128((__m128i*)ix, _mm_and_si128(truncated, _mm_set1_epi32(255)));
+#else
+    float32x4_t vx = vmulq_n_f32(vld1q_f32(x + i), frequency);
+
+    const int32x4_t truncated = vcvtq_s32_f32(vx);
+    const float32x4_t whole = vcvtq_f32_s32(truncated);
+
+    vx = vsubq_f32(vx, vsubq_f32(whole, vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(whole, vx), vreinterpretq_u32_f32(vdupq_n_f32(1.0f))))));
+
+    vst1q_s32(ix, vandq_s32(truncated, vdupq_n_s32(255)));
+#endif
+
+    for (int lane = 0; lane < 4; lane++)
+    {
+      const int a = hash[ix[lane]] + iy;
+      const int b = hash[ix[lane] + 1] + iy;
+
+      aa[lane] = hash[hash[a]];
+      ab[lane] = hash[hash[a + 1]];
+      ba[lane] = hash[hash[b]];
+      bb[lane] = hash[hash[b + 1]];
+    }
+
+#if defined(PERLIN_SSE2)
+    const __m128 vy0 = _mm_set1_ps(vy);
+    const __m128 vy1 = _mm_set1_ps(vy - 1.0f);
+    const __m128 vx1 = _mm_sub_ps(vx, _mm_set1_ps(1.0f));
+    const __m128 xd = fade4(vx);
+
+    const __m128 l1 = lerp4(xd, grad4(_mm_load_si128((__m128i*)aa), vx, vy0), grad4(_mm_load_si128((__m128i*)ba), vx1, vy0));
+    const __m128 l2 = lerp4(xd, grad4(_mm_load_si128((__m128i*)ab), vx, vy1), grad4(_mm_load_si128((__m128i*)bb), vx1, vy1));
+    const __m128 l = lerp4(_mm_set1_ps(yd), l1, l2);
+
+    _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(out + i), _mm_mul_ps(l, _mm_set1_ps(amplitude))));
+#else
+    const float32x4_t vy0 = vdupq_n_f32(vy);
+    const float32x4_t vy1 = vdupq_n_f32(vy - 1.0f);
+    const float32x4_t vx1 = vsubq_f32(vx, vdupq_n_f32(1.0f));
+    const float32x4_t xd = fade4(vx);
+
+    const float32x4_t l1 = lerp4(xd, grad4(vld1q_s32(aa), vx, vy0), grad4(vld1q_s32(ba), vx1, vy0));
+    const float32x4_t l2 = lerp4(xd, grad4(vld1q_s32(ab), vx, vy1), grad4(vld1q_s32(bb), vx1, vy1));
+    const float32x4_t l = lerp4(vdupq_n_f32(yd), l1, l2);
+
+    vst1q_f32(out + i, vaddq_f32(vld1q_f32(out + i), vmulq_n_f32(l, amplitude)));
+#endif
+  }
+#endif
+
+  for (; i < count; i++)
+  {
+    float vx = x[i] * frequency;
+    const int ix = ((int)vx) & 255;
+
+    vx -= glm::floor(vx);
+
+    const int a = hash[ix] + iy;
+    const int b = hash[ix + 1] + iy;
+
+    const float xd = f(vx);
+    const float l1 = lerp(xd, grad(hash[hash[a]], vx, vy, 0.0f), grad(hash[hash[b]], vx - 1.0f, vy, 0.0f));
+    const float l2 = lerp(xd, grad(hash[hash[a + 1]], vx, vy - 1.0f, 0.0f), grad(hash[hash[b + 1]], vx - 1.0f, vy - 1.0f, 0.0f));
+
+    out[i] += lerp(yd, l1, l2) * amplitude;
+  }
+}
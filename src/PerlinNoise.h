@@ -7,6 +7,7 @@ public:
   PerlinNoise(Random& random);
 
   float compute(float x, float y);
+  void accumulate(const float* x, float y, float frequency, float amplitude, float* out, int count);
 private:
   float f(float x);
   float lerp(float t, float a, float b);
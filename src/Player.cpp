@@ -1,6 +1,6 @@
 #include "Player.h"
 #include "Game.h"
-#include "Resources.h"
+#include "Baked.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -16,18 +16,21 @@ VertexList Player::rightLeg{};
 
 void Player::init()
 {
-  Entity::init();
+  Entity::init(&game.level);
 
   footSize = 0.5f;
   heightOffset = 1.62f;
   noPhysics = true;
   updates = 0;
   flushUpdates = false;
+  editTokens = Network::EDIT_BURST;
+  positionTokens = Network::POSITION_BURST;
+  correctionTokens = Network::CORRECTION_BURST;
 
   static bool initialized = false;
   if (!initialized)
   {
-    playerTexture = game.textureManager.load(playerResourceTexture, sizeof(playerResourceTexture));
+    playerTexture = game.textureManager.load(playerBakedTexture);
 
     head.init(36);
     body.init(36);
@@ -14,6 +14,10 @@ public:
   bool flushUpdates;
   unsigned int updates;
 
+  float editTokens;
+  float positionTokens;
+  float correctionTokens;
+
   static GLuint playerTexture;
 private:
   static VertexList head;
@@ -0,0 +1,513 @@
+#include "Profiler.h"
+#include "Game.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+
+Profiler::Sample::Sample(Profiler::Scope scope_)
+{
+  scope = scope_;
+  parent = AllocationTracker::enter(int(scope));
+  start = std::chrono::steady_clock::now();
+}
+
+Profiler::Sample::~Sample()
+{
+  auto end = std::chrono::steady_clock::now();
+  auto& profiler = game.profiler;
+
+  if (profiler.tracing)
+  {
+    profiler.record(scope, start, end);
+  }
+
+  if (auto ring = profiler.getRing(); ring && ring->main)
+  {
+    profiler.add(scope, std::chrono::duration<float, std::milli>(end - start).count());
+  }
+
+  AllocationTracker::leave(parent);
+}
+
+Profiler::~Profiler()
+{
+  if (exportThread.joinable())
+  {
+    exportThread.join();
+  }
+
+#if !defined(EMSCRIPTEN) && !defined(ANDROID) && !TARGET_OS_IPHONE
+  if (gpuSupported)
+  {
+    glDeleteQueries(QUERIES, queries);
+  }
+#endif
+}
+
+void Profiler::init()
+{
+  getRing()->main = true;
+
+  if (const char* trace = std::getenv("CUBIC_TRACE"))
+  {
+    tracing = std::atoi(trace) != 0;
+  }
+
+#if !defined(EMSCRIPTEN) && !defined(ANDROID) && !TARGET_OS_IPHONE
+  if (const char* budget = std::getenv("CUBIC_HITCH_BUDGET"))
+  {
+    hitchBudget = float(std::atof(budget));
+  }
+
+  gpuSupported = GLEW_VERSION_3_3 || GLEW_ARB_timer_query;
+
+  if (gpuSupported)
+  {
+    glGenQueries(QUERIES, queries);
+  }
+#endif
+}
+
+void Profiler::beginFrame()
+{
+  frameStart = std::chrono::steady_clock::now();
+
+#if !defined(EMSCRIPTEN) && !defined(ANDROID) && !TARGET_OS_IPHONE
+  if (gpuSupported && !pending[queryIndex])
+  {
+    glBeginQuery(GL_TIME_ELAPSED, queries[queryIndex]);
+    pending[queryIndex] = true;
+    active = true;
+  }
+#endif
+}
+
+void Profiler::endFrame()
+{
+  auto frameEnd = std::chrono::steady_clock::now();
+  auto milliseconds = std::chrono::duration<float, std::milli>(frameEnd - frameStart).count();
+
+  add(Scope::Frame, milliseconds);
+
+  if (tracing)
+  {
+    record(Scope::Frame, frameStart, frameEnd);
+  }
+
+#if !defined(EMSCRIPTEN) && !defined(ANDROID) && !TARGET_OS_IPHONE
+  if (active)
+  {
+    glEndQuery(GL_TIME_ELAPSED);
+    queryIndex = (queryIndex + 1) % QUERIES;
+    active = false;
+  }
+
+  collectQueries();
+#endif
+
+  for (int i = 0; i < SCOPES; i++)
+  {
+    history[i][frame] = current[i];
+    current[i] = 0.0f;
+  }
+
+  for (int i = 0; i < COUNTERS; i++)
+  {
+    lastCounts[i] = counts[i];
+    counts[i] = 0;
+  }
+
+  if (AllocationTracker::ENABLED)
+  {
+    // Allocations outside any scope are counted against the frame, whose row shows the total of every scope.
+    size_t totalCount = 0;
+    size_t totalBytes = 0;
+
+    for (int i = 0; i < SCOPES; i++)
+    {
+      const auto totals = AllocationTracker::collect(i);
+
+      allocations[i][frame] = totals.count;
+      allocatedBytes[i][frame] = totals.bytes;
+
+      totalCount += totals.count;
+      totalBytes += totals.bytes;
+    }
+
+    allocations[int(Scope::Frame)][frame] = totalCount;
+    allocatedBytes[int(Scope::Frame)][frame] = totalBytes;
+  }
+
+  frame = (frame + 1) % HISTORY;
+  frames = std::min(frames + 1, HISTORY);
+
+#if !defined(EMSCRIPTEN) && !defined(ANDROID) && !TARGET_OS_IPHONE
+  if (tracing && hitchBudget > 0.0f && milliseconds > hitchBudget && frames == HISTORY)
+  {
+    captureHitch(milliseconds);
+  }
+#endif
+}
+
+void Profiler::captureHitch(float milliseconds)
+{
+  if (lastHitch != 0 && game.timer.milliTime() - lastHitch < HITCH_COOLDOWN)
+  {
+    return;
+  }
+
+  // Every hitch overwrites the same file, so a long session with many of them doesn't fill the disk.
+  if (exportTrace((std::filesystem::path(game.path) / HITCH_FILENAME).u8string(), HITCH_WINDOW))
+  {
+    lastHitch = game.timer.milliTime();
+
+    game.ui.log("Captured a %d ms frame to %s", int(milliseconds), HITCH_FILENAME);
+  }
+}
+
+Profiler::Ring* Profiler::getRing()
+{
+  struct Holder
+  {
+    Ring* ring = nullptr;
+
+    ~Holder()
+    {
+      if (ring)
+      {
+        ring->used = false;
+      }
+    }
+  };
+
+  static thread_local Holder holder;
+
+  if (holder.ring)
+  {
+    return holder.ring;
+  }
+
+  std::lock_guard<std::mutex> lock(ringMutex);
+
+  // Rings outlive their threads so a finished thread's events can still be exported until another thread reuses it.
+  for (int i = 0; i < ringCount; i++)
+  {
+    if (!rings[i]->used)
+    {
+      rings[i]->used = true;
+      holder.ring = rings[i].get();
+      return holder.ring;
+    }
+  }
+
+  if (ringCount == MAX_THREADS)
+  {
+    return nullptr;
+  }
+
+  auto ring = std::make_unique<Ring>();
+  ring->head = 0;
+  ring->used = true;
+  ring->main = false;
+  ring->id = ringCount;
+  ring->events.reset(new Event[RING_SIZE]);
+
+  holder.ring = ring.get();
+  rings[ringCount] = std::move(ring);
+  ringCount++;
+
+  return holder.ring;
+}
+
+void Profiler::record(Profiler::Scope scope, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+  auto ring = getRing();
+  if (!ring)
+  {
+    return;
+  }
+
+  const auto head = ring->head.load(std::memory_order_relaxed);
+  const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+  auto& event = ring->events[head & (RING_SIZE - 1)];
+  event.start = uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(start - origin).count());
+  event.duration = uint32_t(std::min<int64_t>(duration, UINT_MAX));
+  event.scope = uint32_t(scope);
+
+  ring->head.store(head + 1, std::memory_order_release);
+}
+
+bool Profiler::exportTrace(const std::string& path, float seconds)
+{
+  if (exporting)
+  {
+    return false;
+  }
+
+  if (exportThread.joinable())
+  {
+    exportThread.join();
+  }
+
+  const auto now = uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin).count());
+  const auto window = uint64_t(seconds * 1000000000.0f);
+  const auto from = seconds > 0.0f && now > window ? now - window : 0;
+
+  std::vector<Trace> traces;
+
+  for (int i = 0; i < ringCount; i++)
+  {
+    auto& ring = *rings[i];
+
+    Trace trace;
+    trace.id = ring.id;
+    trace.main = ring.main;
+
+    const auto end = ring.head.load(std::memory_order_acquire);
+    const auto begin = end > RING_SIZE ? end - RING_SIZE : 0;
+
+    for (auto j = begin; j < end; j++)
+    {
+      trace.events.push_back(ring.events[j & (RING_SIZE - 1)]);
+    }
+
+    // Anything the owning thread wrapped around to while we were copying can't be trusted.
+    const auto after = ring.head.load(std::memory_order_acquire);
+    const auto oldest = after > RING_SIZE ? after - RING_SIZE : 0;
+    const auto overwritten = oldest > begin ? std::min<uint64_t>(oldest - begin, trace.events.size()) : 0;
+    trace.events.erase(trace.events.begin(), trace.events.begin() + size_t(overwritten));
+
+    trace.events.erase(
+      std::remove_if(trace.events.begin(), trace.events.end(), [from](const Event& event) { return event.start + event.duration < from; }),
+      trace.events.end()
+    );
+
+    traces.push_back(std::move(trace));
+  }
+
+  exporting = true;
+
+#if defined(EMSCRIPTEN)
+  writeTrace(path, traces);
+  exporting = false;
+#else
+  exportThread = std::thread([this, path, traces = std::move(traces)]() {
+    writeTrace(path, traces);
+    exporting = false;
+  });
+#endif
+
+  return true;
+}
+
+void Profiler::writeTrace(const std::string& path, const std::vector<Profiler::Trace>& traces)
+{
+  FILE* file = fopen(path.c_str(), "wb");
+  if (!file)
+  {
+    printf("profiler error: failed to open %s.\n", path.c_str());
+    return;
+  }
+
+  fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+  bool first = true;
+  for (const auto& trace : traces)
+  {
+    fprintf(
+      file,
+      "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s %d\"}}",
+      first ? "" : ",\n",
+      trace.id,
+      trace.main ? "Main" : "Worker",
+      trace.id
+    );
+    first = false;
+
+    for (const auto& event : trace.events)
+    {
+      const char* name = getName(Scope(event.scope));
+      while (*name == ' ')
+      {
+        name++;
+      }
+
+      fprintf(
+        file,
+        ",\n{\"name\":\"%s\",\"cat\":\"cubic\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+        name,
+        trace.id,
+        double(event.start) / 1000.0,
+        double(event.duration) / 1000.0
+      );
+    }
+  }
+
+  fprintf(file, "\n]}\n");
+
+  if (fclose(file) != 0)
+  {
+    printf("profiler error: failed to write %s.\n", path.c_str());
+  }
+}
+
+void Profiler::collectQueries()
+{
+#if !defined(EMSCRIPTEN) && !defined(ANDROID) && !TARGET_OS_IPHONE
+  // Results arrive a few frames late, they are credited to the frame that reads them.
+  for (int i = 0; i < QUERIES; i++)
+  {
+    if (!pending[i])
+    {
+      continue;
+    }
+
+    GLint available = 0;
+    glGetQueryObjectiv(queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+
+    if (available)
+    {
+      GLuint64 nanoseconds = 0;
+      glGetQueryObjectui64v(queries[i], GL_QUERY_RESULT, &nanoseconds);
+
+      add(Scope::GPU, float(nanoseconds) / 1000000.0f);
+      pending[i] = false;
+    }
+  }
+#endif
+}
+
+void Profiler::add(Profiler::Scope scope, float milliseconds)
+{
+  current[int(scope)] += milliseconds;
+}
+
+void Profiler::count(Profiler::Counter counter, size_t amount)
+{
+  counts[int(counter)] += amount;
+}
+
+float Profiler::getAverage(Profiler::Scope scope) const
+{
+  if (frames == 0)
+  {
+    return 0.0f;
+  }
+
+  float total = 0.0f;
+  for (int i = 0; i < frames; i++)
+  {
+    total += history[int(scope)][i];
+  }
+
+  return total / float(frames);
+}
+
+float Profiler::getMaximum(Profiler::Scope scope) const
+{
+  float maximum = 0.0f;
+  for (int i = 0; i < frames; i++)
+  {
+    maximum = std::max(maximum, history[int(scope)][i]);
+  }
+
+  return maximum;
+}
+
+float Profiler::getHistory(Profiler::Scope scope, int age) const
+{
+  if (age >= frames)
+  {
+    return 0.0f;
+  }
+
+  return history[int(scope)][(frame - 1 - age + HISTORY) % HISTORY];
+}
+
+size_t Profiler::getCount(Profiler::Counter counter) const
+{
+  return lastCounts[int(counter)];
+}
+
+float Profiler::getAverageAllocations(Profiler::Scope scope) const
+{
+  if (frames == 0)
+  {
+    return 0.0f;
+  }
+
+  size_t total = 0;
+  for (int i = 0; i < frames; i++)
+  {
+    total += allocations[int(scope)][i];
+  }
+
+  return float(total) / float(frames);
+}
+
+float Profiler::getAverageAllocatedBytes(Profiler::Scope scope) const
+{
+  if (frames == 0)
+  {
+    return 0.0f;
+  }
+
+  size_t total = 0;
+  for (int i = 0; i < frames; i++)
+  {
+    total += allocatedBytes[int(scope)][i];
+  }
+
+  return float(total) / float(frames);
+}
+
+size_t Profiler::getAllocations(Profiler::Scope scope, int age) const
+{
+  if (age >= frames)
+  {
+    return 0;
+  }
+
+  return allocations[int(scope)][(frame - 1 - age + HISTORY) % HISTORY];
+}
+
+const char* Profiler::getName(Profiler::Scope scope)
+{
+  static const char* names[SCOPES] = {
+    "Frame",
+    "Tick",
+    "  Player tick",
+    "  Particle tick",
+    "  Level tick",
+    "  Journal tick",
+    "  Renderer tick",
+    "  Held block tick",
+    "  Network tick",
+    "    Messages",
+    "  UI tick",
+    "Generator",
+    "Storage",
+    "Player update",
+    "Network render",
+    "Level render",
+    "  Meshing",
+    "  Uploads",
+    "Particle render",
+    "Post render",
+    "Held block render",
+    "UI render",
+    "UI update",
+    "Main thread jobs",
+    "GPU",
+    "Generation",
+    "Storage IO",
+    "Journal IO",
+    "Jobs",
+  };
+
+  return names[int(scope)];
+}
@@ -0,0 +1,177 @@
+#pragma once
+#include "AllocationTracker.h"
+
+#include <GL/glew.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class Profiler
+{
+public:
+  enum class Scope
+  {
+    Frame,
+    Tick,
+    PlayerTick,
+    ParticleTick,
+    LevelTick,
+    JournalTick,
+    LevelRendererTick,
+    HeldBlockTick,
+    NetworkTick,
+    NetworkMessage,
+    UITick,
+    Generator,
+    Storage,
+    PlayerUpdate,
+    NetworkRender,
+    LevelRender,
+    Meshing,
+    Upload,
+    ParticleRender,
+    PostRender,
+    HeldBlockRender,
+    UIRender,
+    UIUpdate,
+    MainThreadJobs,
+    GPU,
+    Generation,
+    StorageIO,
+    JournalIO,
+    Job,
+    Count,
+  };
+
+  enum class Counter
+  {
+    DrawCalls,
+    Vertices,
+    ChunkUpdates,
+    Count,
+  };
+
+  class Sample
+  {
+  public:
+    Sample(Profiler::Scope scope);
+    ~Sample();
+
+  private:
+    Profiler::Scope scope;
+    int parent;
+    std::chrono::steady_clock::time_point start;
+  };
+
+  ~Profiler();
+
+  void init();
+  void beginFrame();
+  void endFrame();
+
+  void add(Profiler::Scope scope, float milliseconds);
+  void count(Profiler::Counter counter, size_t amount = 1);
+  void record(Profiler::Scope scope, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
+
+  template <typename Function>
+  void measure(Profiler::Scope scope, Function function)
+  {
+    Sample sample(scope);
+    function();
+  }
+
+  bool exportTrace(const std::string& path, float seconds = 0.0f);
+
+  float getAverage(Profiler::Scope scope) const;
+  float getMaximum(Profiler::Scope scope) const;
+  float getHistory(Profiler::Scope scope, int age) const;
+  size_t getCount(Profiler::Counter counter) const;
+
+  float getAverageAllocations(Profiler::Scope scope) const;
+  float getAverageAllocatedBytes(Profiler::Scope scope) const;
+  size_t getAllocations(Profiler::Scope scope, int age) const;
+
+  static const char* getName(Profiler::Scope scope);
+
+  constexpr static int HISTORY = 120;
+  constexpr static int REFRESH_INTERVAL = 250;
+  constexpr static Profiler::Scope LAST_OVERLAY_SCOPE = Profiler::Scope::GPU;
+
+  bool visible = false;
+  bool gpuSupported = false;
+  bool tracing = true;
+
+  float hitchBudget = 0.0f;
+
+private:
+  struct Event
+  {
+    uint64_t start;
+    uint32_t duration;
+    uint32_t scope;
+  };
+
+  struct Ring
+  {
+    std::atomic<uint64_t> head;
+    std::atomic<bool> used;
+    bool main;
+    int id;
+    std::unique_ptr<Event[]> events;
+  };
+
+  struct Trace
+  {
+    int id;
+    bool main;
+    std::vector<Event> events;
+  };
+
+  constexpr static int QUERIES = 4;
+  constexpr static int SCOPES = int(Profiler::Scope::Count);
+  constexpr static int COUNTERS = int(Profiler::Counter::Count);
+  constexpr static int MAX_THREADS = 32;
+  constexpr static uint64_t RING_SIZE = 1 << 15;
+
+  static_assert(SCOPES <= AllocationTracker::MAX_SCOPES, "allocation tracker has too few scopes");
+  constexpr static float HITCH_WINDOW = 5.0f;
+  constexpr static int HITCH_COOLDOWN = 30000;
+  constexpr static const char* HITCH_FILENAME = "Hitch.json";
+
+  Ring* getRing();
+  void collectQueries();
+  void captureHitch(float milliseconds);
+
+  static void writeTrace(const std::string& path, const std::vector<Profiler::Trace>& traces);
+
+  float current[SCOPES] = {};
+  float history[SCOPES][HISTORY] = {};
+  size_t counts[COUNTERS] = {};
+  size_t lastCounts[COUNTERS] = {};
+  size_t allocations[SCOPES][HISTORY] = {};
+  size_t allocatedBytes[SCOPES][HISTORY] = {};
+  int frame = 0;
+  int frames = 0;
+  std::chrono::steady_clock::time_point frameStart;
+
+  std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+  std::unique_ptr<Ring> rings[MAX_THREADS];
+  std::atomic<int> ringCount = { 0 };
+  std::mutex ringMutex;
+
+  std::thread exportThread;
+  std::atomic<bool> exporting = { false };
+  uint64_t lastHitch = 0;
+
+  GLuint queries[QUERIES] = {};
+  bool pending[QUERIES] = {};
+  int queryIndex = 0;
+  bool active = false;
+};
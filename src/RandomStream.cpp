@@ -0,0 +1,73 @@
+#include "RandomStream.h"
+
+RandomStream::RandomStream(uint64_t seed, uint32_t stage, int32_t x, int32_t z)
+{
+  key = mix(mix(mix(seed) ^ stage) ^ (uint64_t(uint32_t(x)) << 32 | uint32_t(z))) | 1;
+  counter = 0;
+}
+
+RandomStream::RandomStream(uint64_t key) : key(key), counter(0)
+{
+}
+
+RandomStream RandomStream::split(uint64_t index) const
+{
+  return RandomStream(mix(key ^ mix(index + 1)) | 1);
+}
+
+int64_t RandomStream::integerRange(int64_t min, int64_t max)
+{
+  return min + integer() % (max + 1 - min);
+}
+
+uint64_t RandomStream::integer()
+{
+  return squares(counter++, key);
+}
+
+double RandomStream::uniform()
+{
+  return double(integer() >> 11) * 0x1.0p-53;
+}
+
+double RandomStream::uniformRange(double min, double max)
+{
+  return min + uniform() * (max - min);
+}
+
+void RandomStream::uniform(double* out, int count)
+{
+  const uint64_t start = counter;
+  const uint64_t streamKey = key;
+
+  for (int i = 0; i < count; i++)
+  {
+    out[i] = double(squares(start + i, streamKey) >> 11) * 0x1.0p-53;
+  }
+
+  counter += count;
+}
+
+uint64_t RandomStream::mix(uint64_t value)
+{
+  value += 0x9E3779B97F4A7C15ULL;
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+  return value ^ (value >> 31);
+}
+
+uint64_t RandomStream::squares(uint64_t counter, uint64_t key)
+{
+  uint64_t x = counter * key;
+  const uint64_t y = x;
+  const uint64_t z = y + key;
+
+  x = x * x + y; x = (x >> 32) | (x << 32);
+  x = x * x + z; x = (x >> 32) | (x << 32);
+  x = x * x + y; x = (x >> 32) | (x << 32);
+
+  const uint64_t t = x = x * x + z;
+  x = (x >> 32) | (x << 32);
+
+  return t ^ ((x * x + y) >> 32);
+}
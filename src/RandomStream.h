@@ -0,0 +1,24 @@
+#pragma once
+#include <cstdint>
+
+class RandomStream {
+public:
+  RandomStream(uint64_t seed, uint32_t stage, int32_t x = 0, int32_t z = 0);
+
+  RandomStream split(uint64_t index) const;
+
+  int64_t integerRange(int64_t min, int64_t max);
+  uint64_t integer();
+  double uniform();
+  double uniformRange(double min, double max);
+  void uniform(double* out, int count);
+
+private:
+  RandomStream(uint64_t key);
+
+  static uint64_t mix(uint64_t value);
+  static uint64_t squares(uint64_t counter, uint64_t key);
+
+  uint64_t key;
+  uint64_t counter;
+};
@@ -0,0 +1,402 @@
+#include "Replay.h"
+#include "Game.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <thread>
+
+static bool isRecordable(const SDL_Event& event)
+{
+  // Drops and user events carry pointers, and quitting ends the recording rather than being part of it.
+  return event.type != SDL_QUIT &&
+    event.type != SDL_DROPFILE &&
+    event.type != SDL_DROPTEXT &&
+    event.type != SDL_DROPBEGIN &&
+    event.type != SDL_DROPCOMPLETE &&
+    event.type < SDL_USEREVENT;
+}
+
+Replay::~Replay()
+{
+  if (file)
+  {
+    fclose(file);
+  }
+}
+
+void Replay::init()
+{
+#if !defined(EMSCRIPTEN) && !defined(ANDROID) && !TARGET_OS_IPHONE
+  fast = std::getenv("CUBIC_REPLAY_FAST") != nullptr;
+
+  if (const char* path = std::getenv("CUBIC_REPLAY"))
+  {
+    openReplay(path);
+  }
+  else if (const char* path = std::getenv("CUBIC_RECORD"))
+  {
+    openRecording(path);
+  }
+#endif
+}
+
+bool Replay::openRecording(const char* path)
+{
+  file = fopen(path, "wb");
+  if (!file)
+  {
+    printf("replay error: failed to open %s.\n", path);
+    return false;
+  }
+
+  const uint64_t generatorSeed = game.levelGenerator.getSeed();
+  const uint64_t randomSeed = uint64_t(std::time(nullptr));
+
+  game.random.init(randomSeed);
+
+  mode = Mode::Recording;
+
+  write(MAGIC, sizeof(MAGIC));
+  write(&VERSION, sizeof(VERSION));
+  write(&generatorSeed, sizeof(generatorSeed));
+  write(&randomSeed, sizeof(randomSeed));
+
+  printf("Recording to %s\n", path);
+
+  return true;
+}
+
+bool Replay::openReplay(const char* path)
+{
+  file = fopen(path, "rb");
+  if (!file)
+  {
+    printf("replay error: failed to open %s.\n", path);
+    return false;
+  }
+
+  char magic[sizeof(MAGIC)];
+  uint32_t version;
+  uint64_t generatorSeed;
+  uint64_t randomSeed;
+
+  if (
+    !read(magic, sizeof(magic)) ||
+    !read(&version, sizeof(version)) ||
+    !read(&generatorSeed, sizeof(generatorSeed)) ||
+    !read(&randomSeed, sizeof(randomSeed)) ||
+    std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0
+  )
+  {
+    printf("replay error: %s is not a replay.\n", path);
+
+    fclose(file);
+    file = nullptr;
+    return false;
+  }
+
+  if (version != VERSION)
+  {
+    printf("replay error: %s has version %u, expected %u.\n", path, version, VERSION);
+
+    fclose(file);
+    file = nullptr;
+    return false;
+  }
+
+  game.levelGenerator.setSeed(generatorSeed);
+  game.random.init(randomSeed);
+
+  mode = Mode::Replaying;
+  start = std::chrono::steady_clock::now();
+
+  printf("Replaying %s\n", path);
+
+  return true;
+}
+
+void Replay::beginFrame()
+{
+  if (mode == Mode::Recording)
+  {
+    const uint8_t deltaTicks = uint8_t(game.timer.deltaTicks);
+    const float delta = game.timer.delta;
+    const uint64_t time = game.timer.milliTime();
+
+    unsigned char frame[sizeof(deltaTicks) + sizeof(delta) + sizeof(time)];
+    std::memcpy(frame, &deltaTicks, sizeof(deltaTicks));
+    std::memcpy(frame + sizeof(deltaTicks), &delta, sizeof(delta));
+    std::memcpy(frame + sizeof(deltaTicks) + sizeof(delta), &time, sizeof(time));
+
+    writeRecord(RecordType::Frame, frame, sizeof(frame));
+
+    // A crash is often what we want to reproduce, so everything up to the last frame has to be on disk.
+    if (file)
+    {
+      fflush(file);
+    }
+  }
+  else if (mode == Mode::Replaying)
+  {
+    RecordType type;
+
+    while (peek(type) && type != RecordType::Frame)
+    {
+      deliver(type);
+    }
+
+    uint8_t deltaTicks;
+    float delta;
+    uint64_t time;
+
+    if (!peek(type) || !read(&deltaTicks, sizeof(deltaTicks)) || !read(&delta, sizeof(delta)) || !read(&time, sizeof(time)))
+    {
+      finish();
+    }
+
+    pending = false;
+
+    if (frames++ == 0)
+    {
+      firstTime = time;
+    }
+
+    lastTime = time;
+
+    if (!fast)
+    {
+      std::this_thread::sleep_until(start + std::chrono::milliseconds(time - firstTime));
+    }
+
+    game.timer.deltaTicks = deltaTicks;
+    game.timer.delta = delta;
+    game.timer.frozenTime = time;
+  }
+}
+
+void Replay::tick()
+{
+  if (mode == Mode::Recording)
+  {
+    writeRecord(RecordType::Tick);
+  }
+  else if (mode == Mode::Replaying)
+  {
+    RecordType type;
+
+    while (peek(type) && type != RecordType::Tick)
+    {
+      if (type == RecordType::Frame)
+      {
+        printf("replay error: frame %zu has fewer ticks than recorded.\n", frames);
+        finish(EXIT_FAILURE);
+      }
+
+      deliver(type);
+    }
+
+    pending = false;
+  }
+}
+
+void Replay::poll()
+{
+  if (mode != Mode::Replaying)
+  {
+    return;
+  }
+
+  RecordType type;
+
+  while (peek(type) && type != RecordType::Frame && type != RecordType::Tick && type != RecordType::Input)
+  {
+    deliver(type);
+  }
+}
+
+bool Replay::input(const SDL_Event& event)
+{
+  if (mode == Mode::Replaying)
+  {
+    // Only events from the log reach the game, apart from closing the window.
+    return feeding || event.type == SDL_QUIT;
+  }
+
+  if (mode == Mode::Recording && isRecordable(event))
+  {
+    writeRecord(RecordType::Input, &event, sizeof(event));
+  }
+
+  return true;
+}
+
+void Replay::recordMessage(const std::string& text)
+{
+  if (mode == Mode::Recording)
+  {
+    writeRecord(RecordType::Message, text.data(), text.size());
+  }
+}
+
+void Replay::recordBinaryMessage(const unsigned char* data, size_t size)
+{
+  if (mode == Mode::Recording)
+  {
+    writeRecord(RecordType::BinaryMessage, data, size);
+  }
+}
+
+void Replay::recordOpen()
+{
+  if (mode == Mode::Recording)
+  {
+    writeRecord(RecordType::Open);
+  }
+}
+
+void Replay::recordClose()
+{
+  if (mode == Mode::Recording)
+  {
+    writeRecord(RecordType::Close);
+  }
+}
+
+bool Replay::isRecording() const
+{
+  return mode == Mode::Recording;
+}
+
+bool Replay::isReplaying() const
+{
+  return mode == Mode::Replaying;
+}
+
+void Replay::write(const void* data, size_t size)
+{
+  if (mode != Mode::Recording)
+  {
+    return;
+  }
+
+  if (fwrite(data, 1, size, file) != size)
+  {
+    printf("replay error: failed to write record, stopping recording.\n");
+
+    fclose(file);
+    file = nullptr;
+    mode = Mode::None;
+  }
+}
+
+void Replay::writeRecord(RecordType type, const void* data, size_t size)
+{
+  write(&type, sizeof(type));
+
+  if (type == RecordType::Message || type == RecordType::BinaryMessage)
+  {
+    const uint32_t length = uint32_t(size);
+    write(&length, sizeof(length));
+  }
+
+  if (size > 0)
+  {
+    write(data, size);
+  }
+}
+
+bool Replay::read(void* data, size_t size)
+{
+  return fread(data, 1, size, file) == size;
+}
+
+bool Replay::peek(RecordType& type)
+{
+  if (!pending)
+  {
+    if (!read(&pendingType, sizeof(pendingType)))
+    {
+      return false;
+    }
+
+    pending = true;
+  }
+
+  type = pendingType;
+
+  return true;
+}
+
+void Replay::deliver(RecordType type)
+{
+  pending = false;
+
+  if (type == RecordType::Input)
+  {
+    SDL_Event event;
+
+    if (!read(&event, sizeof(event)))
+    {
+      finish();
+    }
+
+    feeding = true;
+    game.input(event);
+    feeding = false;
+  }
+  else if (type == RecordType::Message || type == RecordType::BinaryMessage)
+  {
+    uint32_t length;
+
+    if (!read(&length, sizeof(length)))
+    {
+      finish();
+    }
+
+    buffer.resize(length);
+
+    if (length > 0 && !read(buffer.data(), length))
+    {
+      finish();
+    }
+
+    if (type == RecordType::Message)
+    {
+      game.network.onMessage(std::string(buffer.begin(), buffer.end()));
+    }
+    else
+    {
+      game.network.onBinaryMessage(buffer.data(), buffer.size());
+    }
+  }
+  else if (type == RecordType::Open)
+  {
+    game.network.onOpen();
+  }
+  else if (type == RecordType::Close)
+  {
+    game.network.onClose();
+  }
+  else
+  {
+    printf("replay error: unexpected record %u at frame %zu.\n", unsigned(type), frames);
+    finish(EXIT_FAILURE);
+  }
+}
+
+void Replay::finish(int status)
+{
+  const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  const double recorded = double(lastTime - firstTime) / 1000.0;
+
+  printf(
+    "Replayed %zu frames, %.2f s recorded in %.2f s (%.2f ms per frame)\n",
+    frames,
+    recorded,
+    wall,
+    frames > 0 ? wall * 1000.0 / double(frames) : 0.0
+  );
+
+  std::exit(status);
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <SDL2/SDL.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+class Replay
+{
+public:
+  ~Replay();
+
+  void init();
+  void beginFrame();
+  void tick();
+  void poll();
+
+  bool input(const SDL_Event& event);
+  void recordMessage(const std::string& text);
+  void recordBinaryMessage(const unsigned char* data, size_t size);
+  void recordOpen();
+  void recordClose();
+
+  bool isRecording() const;
+  bool isReplaying() const;
+
+private:
+  enum class Mode
+  {
+    None,
+    Recording,
+    Replaying,
+  };
+
+  enum class RecordType : uint8_t
+  {
+    Frame,
+    Tick,
+    Input,
+    Message,
+    BinaryMessage,
+    Open,
+    Close,
+  };
+
+  bool openRecording(const char* path);
+  bool openReplay(const char* path);
+
+  void write(const void* data, size_t size);
+  void writeRecord(RecordType type, const void* data = nullptr, size_t size = 0);
+  bool read(void* data, size_t size);
+  bool peek(RecordType& type);
+  void deliver(RecordType type);
+  void finish(int status = EXIT_SUCCESS);
+
+  Mode mode = Mode::None;
+  FILE* file = nullptr;
+  bool fast = false;
+  bool feeding = false;
+
+  bool pending = false;
+  RecordType pendingType;
+  std::vector<unsigned char> buffer;
+
+  size_t frames = 0;
+  uint64_t firstTime = 0;
+  uint64_t lastTime = 0;
+  std::chrono::steady_clock::time_point start;
+
+  constexpr static char MAGIC[4] = { 'C', 'R', 'P', 'L' };
+  constexpr static uint32_t VERSION = 1;
+};
@@ -0,0 +1,278 @@
+#include "SaveFile.h"
+#include "Game.h"
+#include "LZ.h"
+
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+bool SaveFile::write(const std::string& path, const Snapshot& snapshot, Cache& cache)
+{
+  const std::string partial = path + ".part";
+
+  FILE* file = fopen(partial.c_str(), "wb");
+  if (!file)
+  {
+    return false;
+  }
+
+  Header header;
+  header.magic = MAGIC;
+  header.version = VERSION;
+  header.width = Level::WIDTH;
+  header.height = Level::HEIGHT;
+  header.depth = Level::DEPTH;
+  header.chunkSize = CHUNK_SIZE;
+  header.chunkCount = CHUNK_COUNT;
+  header.seed = snapshot.seed;
+  header.spawn = snapshot.spawn;
+
+  const bool cached = cache.blocks.size() == snapshot.blocks.size() && cache.payloads.size() == CHUNK_COUNT;
+
+  cache.payloads.resize(CHUNK_COUNT);
+
+  std::vector<ChunkEntry> entries(CHUNK_COUNT);
+  uint32_t offset = uint32_t(sizeof(Header) + sizeof(ChunkEntry) * CHUNK_COUNT);
+
+  game.jobs.parallelFor(0, CHUNK_COUNT, CHUNKS_X * CHUNKS_Y, [&](int begin, int end) {
+    unsigned char data[CHUNK_VOLUME];
+    unsigned char previous[CHUNK_VOLUME];
+    unsigned char compressed[CHUNK_VOLUME * 2];
+
+    for (int i = begin; i < end; i++)
+    {
+      gather(snapshot.blocks.data(), i, data);
+
+      if (cached)
+      {
+        gather(cache.blocks.data(), i, previous);
+      }
+
+      auto& payload = cache.payloads[i];
+
+      if (!cached || std::memcmp(data, previous, CHUNK_VOLUME))
+      {
+        const int length = fastlz_compress_level(2, data, CHUNK_VOLUME, compressed);
+
+        if (length <= 0 || length >= CHUNK_VOLUME)
+        {
+          payload.assign(data, data + CHUNK_VOLUME);
+        }
+        else
+        {
+          payload.assign(compressed, compressed + length);
+        }
+      }
+    }
+  });
+
+  for (int i = 0; i < CHUNK_COUNT; i++)
+  {
+    const auto& payload = cache.payloads[i];
+
+    entries[i].offset = offset;
+    entries[i].length = uint32_t(payload.size());
+
+    offset += entries[i].length;
+  }
+
+  cache.blocks = snapshot.blocks;
+
+  bool written =
+    fwrite(&header, sizeof(header), 1, file) == 1 &&
+    fwrite(entries.data(), sizeof(ChunkEntry), entries.size(), file) == entries.size();
+
+  for (const auto& payload : cache.payloads)
+  {
+    written = written && fwrite(payload.data(), 1, payload.size(), file) == payload.size();
+  }
+
+  written = fclose(file) == 0 && written;
+
+  if (!written)
+  {
+    std::remove(partial.c_str());
+    return false;
+  }
+
+  std::remove(path.c_str());
+
+  return std::rename(partial.c_str(), path.c_str()) == 0;
+}
+
+bool SaveFile::read(const std::string& path, Snapshot& snapshot, std::atomic<int>* progress)
+{
+  snapshot.blocks.resize(Level::WIDTH * Level::HEIGHT * Level::DEPTH);
+  snapshot.seed = 0;
+  snapshot.hasSpawn = false;
+
+  FILE* file = fopen(path.c_str(), "rb");
+  if (!file)
+  {
+    return false;
+  }
+
+  Header header;
+  if (!readHeader(file, header))
+  {
+    fseek(file, 0, SEEK_END);
+    const long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    const bool legacy = size == long(snapshot.blocks.size()) && fread(snapshot.blocks.data(), 1, snapshot.blocks.size(), file) == snapshot.blocks.size();
+
+    fclose(file);
+
+    return legacy;
+  }
+
+  if (
+    header.version != VERSION || header.width != Level::WIDTH || header.height != Level::HEIGHT ||
+    header.depth != Level::DEPTH || header.chunkSize != CHUNK_SIZE || header.chunkCount != CHUNK_COUNT
+  )
+  {
+    printf("save error: unsupported save %s (version %u, %ux%ux%u).\n", path.c_str(), header.version, header.width, header.height, header.depth);
+
+    fclose(file);
+    return false;
+  }
+
+  std::vector<ChunkEntry> entries(CHUNK_COUNT);
+
+  if (fread(entries.data(), sizeof(ChunkEntry), entries.size(), file) != entries.size())
+  {
+    fclose(file);
+    return false;
+  }
+
+  fseek(file, 0, SEEK_END);
+  const long size = ftell(file);
+
+  std::vector<unsigned char> contents(size_t(size > 0 ? size : 0));
+
+  fseek(file, 0, SEEK_SET);
+  const bool complete = fread(contents.data(), 1, contents.size(), file) == contents.size();
+
+  fclose(file);
+
+  if (!complete)
+  {
+    return false;
+  }
+
+  std::atomic<bool> valid = { true };
+
+  game.jobs.parallelFor(0, CHUNK_COUNT, CHUNKS_X * CHUNKS_Y, [&](int begin, int end) {
+    unsigned char data[CHUNK_VOLUME];
+
+    for (int i = begin; i < end && valid; i++)
+    {
+      const auto& entry = entries[i];
+
+      if (size_t(entry.offset) + entry.length > contents.size())
+      {
+        printf("save error: chunk %d of %s is out of bounds.\n", i, path.c_str());
+        valid = false;
+        return;
+      }
+
+      if (entry.length == CHUNK_VOLUME)
+      {
+        scatter(snapshot.blocks.data(), i, contents.data() + entry.offset);
+      }
+      else if (fastlz_decompress(contents.data() + entry.offset, int(entry.length), data, CHUNK_VOLUME) == CHUNK_VOLUME)
+      {
+        scatter(snapshot.blocks.data(), i, data);
+      }
+      else
+      {
+        printf("save error: chunk %d of %s is corrupt.\n", i, path.c_str());
+        valid = false;
+        return;
+      }
+
+      if (progress)
+      {
+        (*progress)++;
+      }
+    }
+  });
+
+  if (!valid)
+  {
+    return false;
+  }
+
+  snapshot.seed = header.seed;
+  snapshot.spawn = header.spawn;
+  snapshot.hasSpawn = true;
+
+  return true;
+}
+
+bool SaveFile::probe(const std::string& path)
+{
+  FILE* file = fopen(path.c_str(), "rb");
+  if (!file)
+  {
+    return false;
+  }
+
+  Header header;
+  bool valid = readHeader(file, header);
+
+  if (!valid)
+  {
+    fseek(file, 0, SEEK_END);
+    valid = ftell(file) == long(Level::WIDTH * Level::HEIGHT * Level::DEPTH);
+  }
+
+  fclose(file);
+
+  return valid;
+}
+
+bool SaveFile::readHeader(FILE* file, Header& header)
+{
+  if (fread(&header, sizeof(header), 1, file) != 1 || header.magic != MAGIC)
+  {
+    fseek(file, 0, SEEK_SET);
+    return false;
+  }
+
+  return true;
+}
+
+void SaveFile::gather(const unsigned char* blocks, int index, unsigned char* data)
+{
+  const int chunkX = index % CHUNKS_X * CHUNK_SIZE;
+  const int chunkY = index / CHUNKS_X % CHUNKS_Y * CHUNK_SIZE;
+  const int chunkZ = index / (CHUNKS_X * CHUNKS_Y) * CHUNK_SIZE;
+
+  for (int z = 0; z < CHUNK_SIZE; z++)
+  {
+    for (int y = 0; y < CHUNK_SIZE; y++)
+    {
+      const auto row = blocks + ((chunkZ + z) * Level::HEIGHT + chunkY + y) * Level::WIDTH + chunkX;
+
+      std::copy(row, row + CHUNK_SIZE, data + (z * CHUNK_SIZE + y) * CHUNK_SIZE);
+    }
+  }
+}
+
+void SaveFile::scatter(unsigned char* blocks, int index, const unsigned char* data)
+{
+  const int chunkX = index % CHUNKS_X * CHUNK_SIZE;
+  const int chunkY = index / CHUNKS_X % CHUNKS_Y * CHUNK_SIZE;
+  const int chunkZ = index / (CHUNKS_X * CHUNKS_Y) * CHUNK_SIZE;
+
+  for (int z = 0; z < CHUNK_SIZE; z++)
+  {
+    for (int y = 0; y < CHUNK_SIZE; y++)
+    {
+      const auto row = data + (z * CHUNK_SIZE + y) * CHUNK_SIZE;
+
+      std::copy(row, row + CHUNK_SIZE, blocks + ((chunkZ + z) * Level::HEIGHT + chunkY + y) * Level::WIDTH + chunkX);
+    }
+  }
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include "Level.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+class SaveFile
+{
+public:
+  struct Snapshot
+  {
+    std::vector<unsigned char> blocks;
+    uint64_t seed = 0;
+    glm::vec3 spawn = glm::vec3(0.0f);
+    bool hasSpawn = false;
+  };
+
+  struct Cache
+  {
+    std::vector<unsigned char> blocks;
+    std::vector<std::vector<unsigned char>> payloads;
+  };
+
+  static bool write(const std::string& path, const Snapshot& snapshot, Cache& cache);
+  static bool read(const std::string& path, Snapshot& snapshot, std::atomic<int>* progress = nullptr);
+  static bool probe(const std::string& path);
+
+  constexpr static int CHUNK_SIZE = 16;
+  constexpr static int CHUNKS_X = Level::WIDTH / CHUNK_SIZE;
+  constexpr static int CHUNKS_Y = Level::HEIGHT / CHUNK_SIZE;
+  constexpr static int CHUNKS_Z = Level::DEPTH / CHUNK_SIZE;
+  constexpr static int CHUNK_COUNT = CHUNKS_X * CHUNKS_Y * CHUNKS_Z;
+  constexpr static int CHUNK_VOLUME = CHUNK_SIZE * CHUNK_SIZE * CHUNK_SIZE;
+
+private:
+  constexpr static uint32_t MAGIC = 0x53425543;
+  constexpr static uint32_t VERSION = 1;
+
+#pragma pack(push, 1)
+  struct Header
+  {
+    uint32_t magic;
+    uint32_t version;
+
+    uint16_t width;
+    uint16_t height;
+    uint16_t depth;
+    uint16_t chunkSize;
+    uint32_t chunkCount;
+
+    uint64_t seed;
+    glm::f32vec3 spawn;
+  };
+
+  struct ChunkEntry
+  {
+    uint32_t offset;
+    uint32_t length;
+  };
+#pragma pack(pop)
+
+  static bool readHeader(FILE* file, Header& header);
+  static void gather(const unsigned char* blocks, int index, unsigned char* data);
+  static void scatter(unsigned char* blocks, int index, const unsigned char* data);
+};
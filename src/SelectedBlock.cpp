@@ -72,6 +72,9 @@ void SelectedBlock::renderPost()
       }
 
       glDrawArrays(GL_LINES, 0, (GLsizei)BUFFER_SIZE);
+
+      game.profiler.count(Profiler::Counter::DrawCalls);
+      game.profiler.count(Profiler::Counter::Vertices, BUFFER_SIZE);
     }
   }
 }
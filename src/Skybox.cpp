@@ -2,7 +2,7 @@
 #include "Level.h"
 #include "Game.h"
 #include "TextureManager.h"
-#include "Resources.h"
+#include "Baked.h"
 
 void Skybox::init()
 {
@@ -14,14 +14,7 @@ void Skybox::init()
 
 void Skybox::initBedrock()
 {
-  const unsigned char blockType = (unsigned char)Block::Type::BLOCK_BEDROCK;
-  const unsigned char texture = Block::Definitions[blockType].sideTexture;
-  const int width = 16;
-  const int height = 16;
-  const int x = (texture % width) * width;
-  const int y = (texture / height) * height;
-
-  bedrockTexture = game.textureManager.load(terrainResourceTexture, sizeof(terrainResourceTexture), x, y, width, height);
+  bedrockTexture = game.textureManager.load(bedrockBakedTexture);
   bedrockVertices.init();
 
   const float ground = (float)game.level.groundLevel;
@@ -88,14 +81,7 @@ void Skybox::initBedrock()
 
 void Skybox::initWater()
 {
-  const unsigned char blockType = (unsigned char)Block::Type::BLOCK_WATER;
-  const unsigned char texture = Block::Definitions[blockType].sideTexture;
-  const int width = 16;
-  const int height = 16;
-  const int x = (texture % width) * width;
-  const int y = (texture / height) * height;
-
-  waterTexture = game.textureManager.load(terrainResourceTexture, sizeof(terrainResourceTexture), x, y, width, height);
+  waterTexture = game.textureManager.load(waterBakedTexture);
   waterVertices.init();
 
   const float water = (float)game.level.waterLevel;
@@ -134,7 +120,7 @@ void Skybox::initWater()
 
 void Skybox::initClouds()
 {
-  cloudsTexture = game.textureManager.load(cloudsResourceTexture, sizeof(cloudsResourceTexture));
+  cloudsTexture = game.textureManager.load(cloudsBakedTexture);
   cloudsVertices.init();
 
   float y = Level::HEIGHT + 2.0f;
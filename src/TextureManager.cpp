@@ -1,7 +1,98 @@
 #include "TextureManager.h"
 #include "PNG.h"
+#include "LZ.h"
+#include "Baked.h"
 
 #include <vector>
+#include <cstdio>
+#include <cstdlib>
+
+void TextureManager::init()
+{
+  if (const char* pack = std::getenv("CUBIC_TEXTURE_PACK"))
+  {
+    packPath = pack;
+  }
+}
+
+GLuint TextureManager::load(const BakedTexture& baked)
+{
+  std::vector<unsigned char> pixels(baked.size);
+  fastlz_decompress(baked.data, (int)baked.length, pixels.data(), (int)baked.size);
+
+  auto format = baked.components > 3 ? GL_RGBA : GL_RGB;
+
+  GLuint texture;
+  glGenTextures(1, &texture);
+  glBindTexture(GL_TEXTURE_2D, texture);
+  glTexImage2D(GL_TEXTURE_2D, 0, format, baked.width, baked.height, 0, format, GL_UNSIGNED_BYTE, pixels.data());
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+  return texture;
+}
+
+GLuint TextureManager::load(const BakedTexture& baked, const char* name, unsigned int* scale)
+{
+  if (scale)
+  {
+    *scale = 1;
+  }
+
+  if (packPath.empty())
+  {
+    return load(baked);
+  }
+
+  const auto path = packPath + "/" + name + ".png";
+
+  upng_t* upng = upng_new_from_file(path.c_str());
+  if (upng_decode(upng) != UPNG_EOK)
+  {
+    if (upng_get_error(upng) != UPNG_ENOTFOUND)
+    {
+      printf("TextureManager error: failed to decode %s.\n", path.c_str());
+    }
+
+    upng_free(upng);
+    return load(baked);
+  }
+
+  auto width = upng_get_width(upng);
+  auto height = upng_get_height(upng);
+  auto components = upng_get_components(upng);
+  auto factor = width / baked.width;
+
+  if (factor == 0 || width != baked.width * factor || height != baked.height * factor || upng_get_bitdepth(upng) != 8 || components < 3)
+  {
+    printf("TextureManager error: %s must be 8-bit RGB or RGBA and %ux%u scaled by a whole number.\n", path.c_str(), baked.width, baked.height);
+
+    upng_free(upng);
+    return load(baked);
+  }
+
+  auto format = components > 3 ? GL_RGBA : GL_RGB;
+
+  GLuint texture;
+  glGenTextures(1, &texture);
+  glBindTexture(GL_TEXTURE_2D, texture);
+  glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, upng_get_buffer(upng));
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+  upng_free(upng);
+
+  if (scale)
+  {
+    *scale = factor;
+  }
+
+  return texture;
+}
 
 GLuint TextureManager::load(const unsigned char* data, size_t length)
 {
@@ -1,11 +1,21 @@
 #pragma once
 #include <GL/glew.h>
 #include <stddef.h>
+#include <string>
+
+struct BakedTexture;
 
 class TextureManager
 {
 public:
+  void init();
+
+  GLuint load(const BakedTexture& baked);
+  GLuint load(const BakedTexture& baked, const char* name, unsigned int* scale = nullptr);
   GLuint load(const unsigned char* data, size_t length);
   GLuint load(const unsigned char* data, size_t length, unsigned int left, unsigned int top, unsigned int right, unsigned int bottom);
   GLuint loadColor(float r, float g, float b);
+
+private:
+  std::string packPath;
 };
\ No newline at end of file
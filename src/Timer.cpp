@@ -1,6 +1,8 @@
 #include "Timer.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 
 void Timer::init(float ticksPerSecond_)
 {
@@ -13,15 +15,24 @@ void Timer::update()
 {
   uint64_t systemClock = milliTime();
 
-  delta += float(systemClock - lastSystemClock) / tickLength;
-  deltaTicks = int(delta);
-  delta -= float(deltaTicks);
+  const float elapsed = float(systemClock - lastSystemClock) / tickLength;
+
+  delta += elapsed;
+  pendingTicks += int(delta);
+  delta -= float(int(delta));
   lastSystemClock = systemClock;
 
-  if (deltaTicks > MAX_DELTA_TICKS)
+  if (pendingTicks > MAX_DELTA_TICKS)
   {
-    deltaTicks = MAX_DELTA_TICKS;
+    pendingTicks = MAX_DELTA_TICKS;
   }
+
+  // After a stall, run the ticks we owe over the next few frames rather than all at once in the next one. Each frame
+  // still runs as many ticks as frames usually take, so a slow machine keeps up and only the backlog is spread out.
+  ticksPerFrame += (elapsed - ticksPerFrame) * TICKS_PER_FRAME_SMOOTHING;
+
+  deltaTicks = std::min(pendingTicks, int(std::ceil(ticksPerFrame)) + CATCH_UP_TICKS);
+  pendingTicks -= deltaTicks;
 }
 
 void Timer::tick()
@@ -31,5 +42,10 @@ void Timer::tick()
 
 uint64_t Timer::milliTime() 
 {
+  if (frozenTime)
+  {
+    return frozenTime;
+  }
+
   return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 }
@@ -16,9 +16,16 @@ public:
 
   int deltaTicks;
   float delta;
+
+  // Set while replaying, so every clock read within a frame sees the recorded time.
+  uint64_t frozenTime = 0;
 private:
   uint64_t lastSystemClock;
+  int pendingTicks = 0;
+  float ticksPerFrame = 0.0f;
   
   const int MAX_DELTA_TICKS = 100;
+  const int CATCH_UP_TICKS = 2;
+  const float TICKS_PER_FRAME_SMOOTHING = 0.05f;
 };
 
@@ -2,7 +2,8 @@
 #include "LocalPlayer.h"
 #include "Game.h"
 #include "Block.h"
-#include "Resources.h"
+#include "Baked.h"
+#include "SaveFile.h"
 
 #include <cstdio>
 #include <ctime>
@@ -64,10 +65,10 @@ void UI::init()
   blockVertices.init();
 
   fontVertices.init();
-  fontTexture = game.textureManager.load(fontResourceTexture, sizeof(fontResourceTexture));
+  fontTexture = game.textureManager.load(fontBakedTexture, "font");
 
   interfaceVertices.init();
-  interfaceTexture = game.textureManager.load(interfaceResourceTexture, sizeof(interfaceResourceTexture));
+  interfaceTexture = game.textureManager.load(interfaceBakedTexture, "interface");
 }
 
 bool UI::input(const SDL_Event& event)
@@ -477,7 +478,7 @@ void UI::log(const char* format, ...)
   update();
 }
 
-bool UI::refresh()
+bool UI::refresh(bool autosave)
 {
   page = 0;
   saves.clear();
@@ -488,7 +489,7 @@ bool UI::refresh()
     auto path = entry.path();
     auto filename = path.filename().u8string();
 
-    if (auto index = filename.find("Save "); index != std::string::npos)
+    if (auto index = filename.find("Save "); index != std::string::npos && path.extension() != ".part" && SaveFile::probe(path.u8string()))
     {
       auto lastWriteTime = entry.last_write_time();
       auto lastWriteSystemTime = std::chrono::time_point_cast<std::chrono::system_clock::duration>(
@@ -509,6 +510,15 @@ bool UI::refresh()
 
   std::sort(saves.begin(), saves.end(), [](Save& save, Save& save2) { return save.index < save2.index; });
 
+  if (auto path = std::filesystem::path(game.path) / game.journal.FILENAME; autosave && SaveFile::probe(path.u8string()))
+  {
+    Save save;
+    save.name = game.journal.FILENAME;
+    save.path = path.u8string();
+    save.index = 0;
+    saves.insert(saves.begin(), save);
+  }
+
   return !ec;
 }
 
@@ -519,31 +529,15 @@ bool UI::load(size_t index)
     return false;
   }
 
-  FILE* file = fopen(saves[index].path.c_str(), "r");
-  if (!file)
-  {
-    return false;
-  }
-
-  fread(game.level.blocks, std::size(game.level.blocks), sizeof(unsigned char), file);
-  fclose(file);
-
-  game.level.calculateLightDepths(0, 0, Level::WIDTH, Level::DEPTH);
-  game.level.calculateSpawnPosition();
-  game.level.reset();
-
-  game.levelRenderer.loadAllChunks();
-  game.network.sendLevel(UCHAR_MAX, true);
-
-  return true;
+  return game.levelStorage.load(saves[index].path);
 }
 
 bool UI::save(size_t index)
 {
-  FILE* file;
+  std::string path;
   if (index < saves.size())
   {
-    file = fopen(saves[index].path.c_str(), "w");
+    path = saves[index].path;
   }
   else
   {
@@ -551,31 +545,21 @@ bool UI::save(size_t index)
     filename /= game.path;
     filename /= std::string("Save ") + std::to_string(index + 1);
 
-    file = fopen(filename.u8string().c_str(), "w");
-  }
-
-  if (!file)
-  {
-    return false;
+    path = filename.u8string();
   }
 
-  fwrite(game.level.blocks, std::size(game.level.blocks), sizeof(unsigned char), file);
-  fclose(file);
-
-#if defined(EMSCRIPTEN)
-  EM_ASM(
-    FS.syncfs(false, function(err) {
-      console.log(err);
-    });
-  );
-#endif
-
-  return true;
+  return game.levelStorage.save(path);
 }
 
 void UI::drawHUD()
 {
   drawFPS();
+
+  if (game.profiler.visible)
+  {
+    drawProfiler();
+  }
+
   drawCrosshair();
   drawLogs();
   drawHotbar();
@@ -594,6 +578,75 @@ void UI::drawFPS()
   drawShadowedFont(fps.c_str(), 3.0f, 3.0f, 1.0f);
 }
 
+void UI::drawProfiler()
+{
+  const auto count = int(Profiler::LAST_OVERLAY_SCOPE) + 1;
+  const float top = 13.0f;
+  const float rowHeight = 9.0f;
+  const float tableWidth = AllocationTracker::ENABLED ? 230.0f : 170.0f;
+
+  drawInterface(1.0f, top, tableWidth, rowHeight * (count + 1) + 2.0f, 183, 0, 16, 16, 0.12f);
+  drawFont("Scope", 3.0f, top + 1.0f, 0.7f, 1.1f);
+  drawFont("avg", 113.0f, top + 1.0f, 0.7f, 1.1f);
+  drawFont("max", 143.0f, top + 1.0f, 0.7f, 1.1f);
+
+  if (AllocationTracker::ENABLED)
+  {
+    drawFont("allocs", 173.0f, top + 1.0f, 0.7f, 1.1f);
+    drawFont("KB", 208.0f, top + 1.0f, 0.7f, 1.1f);
+  }
+
+  char text[16];
+  for (int i = 0; i < count; i++)
+  {
+    const auto scope = Profiler::Scope(i);
+    const float y = top + 1.0f + rowHeight * (i + 1);
+
+    if (scope == Profiler::Scope::GPU && !game.profiler.gpuSupported)
+    {
+      drawFont(Profiler::getName(scope), 3.0f, y, 0.5f, 1.1f);
+      drawFont("n/a", 113.0f, y, 0.5f, 1.1f);
+      continue;
+    }
+
+    drawFont(Profiler::getName(scope), 3.0f, y, 1.0f, 1.1f);
+
+    std::snprintf(text, sizeof(text), "%.2f", game.profiler.getAverage(scope));
+    drawFont(text, 113.0f, y, 1.0f, 1.1f);
+
+    std::snprintf(text, sizeof(text), "%.2f", game.profiler.getMaximum(scope));
+    drawFont(text, 143.0f, y, 1.0f, 1.1f);
+
+    if (AllocationTracker::ENABLED && scope != Profiler::Scope::GPU)
+    {
+      std::snprintf(text, sizeof(text), "%.1f", game.profiler.getAverageAllocations(scope));
+      drawFont(text, 173.0f, y, 1.0f, 1.1f);
+
+      std::snprintf(text, sizeof(text), "%.1f", game.profiler.getAverageAllocatedBytes(scope) / 1024.0f);
+      drawFont(text, 208.0f, y, 1.0f, 1.1f);
+    }
+  }
+
+  const float graphX = tableWidth + 4.0f;
+  const float graphHeight = 50.0f;
+  const float frameBudget = 1000.0f / 60.0f;
+
+  drawInterface(graphX, top, float(Profiler::HISTORY) + 2.0f, graphHeight + 2.0f, 183, 0, 16, 16, 0.12f);
+  drawInterface(graphX, top + 1.0f + graphHeight - frameBudget, float(Profiler::HISTORY) + 2.0f, 0.5f, 183, 0, 16, 16, 0.5f, 1.2f);
+
+  for (int age = 0; age < Profiler::HISTORY; age++)
+  {
+    const float frameTime = game.profiler.getHistory(Profiler::Scope::Frame, age);
+    const float height = std::min(frameTime, graphHeight);
+    const float x = graphX + 1.0f + float(Profiler::HISTORY - 1 - age);
+
+    drawInterface(x, top + 1.0f + graphHeight - height, 1.0f, height, 183, 0, 16, 16, frameTime > frameBudget * 2.0f ? 1.0f : 0.6f, 1.1f);
+  }
+
+  std::snprintf(text, sizeof(text), "%.1f ms", game.profiler.getHistory(Profiler::Scope::Frame, 0));
+  drawShadowedFont(text, graphX + 2.0f, top + graphHeight + 5.0f, 1.0f);
+}
+
 void UI::drawCrosshair()
 {
   drawInterface(game.scaledWidth / 2 - 7, game.scaledHeight / 2 - 7, 211, 0, 16, 16);
@@ -959,11 +1012,7 @@ bool UI::drawLoadMenu()
   {
     if (drawButton(game.scaledWidth / 2 - 100, game.scaledHeight / 2 - offset + 16 + 24 * i, 65.0f, saves.size() >= i + 1 + 4 * page ? saves[i + 4 * page].name.c_str() : "-", saves.size() >= i + 1 + 4 * page))
     {
-      if (load(i + 4 * page))
-      {
-        closeMenu();
-      }
-      else 
+      if (!load(i + 4 * page))
       {
         closeMenu();
         log("Failed to load level.");
@@ -1064,7 +1113,7 @@ bool UI::drawMainMenu()
 
   if (drawButton(game.scaledWidth / 2 - 100, game.scaledHeight / 2 - offset + 40, 65.0f, "Load Level", game.network.isHost() || !game.network.isConnected(), 98.0f))
   {
-    if (refresh())
+    if (refresh(true))
     {
       openMenu(State::LoadMenu);
     }
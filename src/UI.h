@@ -92,12 +92,13 @@ private:
     bool isHolding;
   };
 
-  bool refresh();
+  bool refresh(bool autosave = false);
   bool load(size_t index);
   bool save(size_t index);
 
   void drawHUD();
   void drawFPS();
+  void drawProfiler();
   void drawCrosshair();
   void drawLogs();
   void drawHotbar();
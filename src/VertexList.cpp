@@ -46,7 +46,14 @@ void VertexList::reset()
 
 void VertexList::update()
 {
-  length = index;
+  update(allocator->data, index);
+
+  index = 0;
+}
+
+void VertexList::update(const Vertex* data, size_t count)
+{
+  length = count;
 
   if (length)
   {
@@ -55,16 +62,14 @@ void VertexList::update()
 
     if (length > bufferLength)
     {
-      glBufferData(GL_ARRAY_BUFFER, length * sizeof(VertexList::Vertex), allocator->data, GL_DYNAMIC_DRAW);
+      glBufferData(GL_ARRAY_BUFFER, length * sizeof(VertexList::Vertex), data, GL_DYNAMIC_DRAW);
 
       bufferLength = length;
     }
     else
     {
-      glBufferSubData(GL_ARRAY_BUFFER, 0, length * sizeof(VertexList::Vertex), allocator->data);
+      glBufferSubData(GL_ARRAY_BUFFER, 0, length * sizeof(VertexList::Vertex), data);
     }
-
-    index = 0;
   }
 }
 
@@ -74,5 +79,8 @@ void VertexList::render()
   {
     glBindVertexArray(vao);
     glDrawArrays(GL_TRIANGLES, 0, (GLsizei)length);
+
+    game.profiler.count(Profiler::Counter::DrawCalls);
+    game.profiler.count(Profiler::Counter::Vertices, length);
   }
 }
\ No newline at end of file
@@ -41,6 +41,7 @@ public:
 
   void destroy();
   void update();
+  void update(const Vertex* data, size_t count);
   void render();
   void reset();
 